@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#define MODULE bridge_data
+#include "module_state_event.h"
+#include "bridge_data.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(MODULE, CONFIG_BRIDGE_DATA_LOG_LEVEL);
+
+#define CHANNEL_COUNT 2
+
+struct channel_stats {
+	atomic_t bytes[BRIDGE_DATA_DIR_COUNT];
+	atomic_t dropped[BRIDGE_DATA_DIR_COUNT];
+};
+
+static struct channel_stats stats[CHANNEL_COUNT];
+
+void bridge_data_stats_add(uint8_t dev_idx, enum bridge_data_dir dir, size_t len,
+			   size_t dropped)
+{
+	if (dev_idx >= CHANNEL_COUNT) {
+		return;
+	}
+
+	atomic_add(&stats[dev_idx].bytes[dir], len);
+
+	if (dropped > 0) {
+		atomic_add(&stats[dev_idx].dropped[dir], dropped);
+	}
+}
+
+#if CONFIG_BRIDGE_DATA_STATS_LOG
+#define STATS_INTERVAL_S CONFIG_BRIDGE_DATA_STATS_LOG_INTERVAL
+
+static void stats_log_handler(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(stats_log_work, stats_log_handler);
+
+static void stats_log_handler(struct k_work *work)
+{
+	for (int i = 0; i < CHANNEL_COUNT; ++i) {
+		uint32_t uart_cdc = atomic_clear(&stats[i].bytes[BRIDGE_DATA_UART_TO_CDC]);
+		uint32_t cdc_uart = atomic_clear(&stats[i].bytes[BRIDGE_DATA_CDC_TO_UART]);
+		uint32_t uart_cdc_drop = atomic_clear(&stats[i].dropped[BRIDGE_DATA_UART_TO_CDC]);
+		uint32_t cdc_uart_drop = atomic_clear(&stats[i].dropped[BRIDGE_DATA_CDC_TO_UART]);
+
+		if ((uart_cdc | cdc_uart | uart_cdc_drop | cdc_uart_drop) == 0) {
+			continue;
+		}
+
+		LOG_INF("CH_%d UART->CDC %u B/s (%u dropped), CDC->UART %u B/s (%u dropped)",
+			i, uart_cdc / STATS_INTERVAL_S, uart_cdc_drop,
+			cdc_uart / STATS_INTERVAL_S, cdc_uart_drop);
+	}
+
+	k_work_reschedule(&stats_log_work, K_SECONDS(STATS_INTERVAL_S));
+}
+#endif /* CONFIG_BRIDGE_DATA_STATS_LOG */
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_module_state_event(aeh)) {
+		const struct module_state_event *event =
+			cast_module_state_event(aeh);
+
+#if CONFIG_BRIDGE_DATA_STATS_LOG
+		if (check_state(event, MODULE_ID(main), MODULE_STATE_READY)) {
+			k_work_reschedule(&stats_log_work, K_SECONDS(STATS_INTERVAL_S));
+		}
+#endif
+
+		return false;
+	}
+
+	/* If event is unhandled, unsubscribe. */
+	__ASSERT_NO_MSG(false);
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, module_state_event);
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BRIDGE_DATA_H_
+#define _BRIDGE_DATA_H_
+
+/**
+ * @brief Direct UART to USB CDC data path
+ * @defgroup bridge_data Direct UART to USB CDC data path
+ * @{
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Data path direction. */
+enum bridge_data_dir {
+	BRIDGE_DATA_UART_TO_CDC,
+	BRIDGE_DATA_CDC_TO_UART,
+
+	BRIDGE_DATA_DIR_COUNT
+};
+
+/**
+ * @brief Queue data received on UART for transmission on the CDC ACM port.
+ *
+ * Implemented by the USB CDC handler. Can be called from interrupt context.
+ *
+ * @param dev_idx Channel index.
+ * @param buf     Data.
+ * @param len     Data length.
+ */
+void bridge_data_cdc_write(uint8_t dev_idx, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Queue data received on the CDC ACM port for transmission on UART.
+ *
+ * Implemented by the UART handler. Can be called from interrupt context.
+ *
+ * @param dev_idx Channel index.
+ * @param buf     Data.
+ * @param len     Data length.
+ */
+void bridge_data_uart_write(uint8_t dev_idx, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Account data passed through the direct data path.
+ *
+ * @param dev_idx Channel index.
+ * @param dir     Direction of the data.
+ * @param len     Number of forwarded bytes.
+ * @param dropped Number of dropped bytes.
+ */
+void bridge_data_stats_add(uint8_t dev_idx, enum bridge_data_dir dir, size_t len,
+			   size_t dropped);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _BRIDGE_DATA_H_ */
@@ -15,6 +15,7 @@
 #include "ble_data_event.h"
 #include "cdc_data_event.h"
 #include "uart_data_event.h"
+#include "bridge_data.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_BRIDGE_UART_LOG_LEVEL);
@@ -63,6 +64,8 @@ static uint32_t uart_default_baudrate[UART_DEVICE_COUNT];
 static int subscriber_count[UART_DEVICE_COUNT];
 static bool enable_rx_retry[UART_DEVICE_COUNT];
 static atomic_t uart_tx_started[UART_DEVICE_COUNT];
+/* TX ringbuffers are filled both from the CDC interrupt and from BLE data events */
+static struct k_spinlock uart_tx_lock;
 
 static void enable_uart_rx(uint8_t dev_idx);
 static void disable_uart_rx(uint8_t dev_idx);
@@ -133,6 +136,17 @@ static void uart_callback(const struct device *dev, struct uart_event *evt,
 
 	switch (evt->type) {
 	case UART_RX_RDY:
+		if (IS_ENABLED(CONFIG_BRIDGE_DATA_DIRECT)) {
+			/* Data is copied, the RX buffer is not referenced after this */
+			bridge_data_cdc_write(dev_idx, &evt->data.rx.buf[evt->data.rx.offset],
+					      evt->data.rx.len);
+
+			/* Only one BLE Service instance: always mapped to UART_0 */
+			if (!IS_ENABLED(CONFIG_BRIDGE_BLE_ENABLE) || (dev_idx != 0)) {
+				break;
+			}
+		}
+
 		uart_rx_buf_ref(evt->data.rx.buf);
 
 		event = new_uart_data_event();
@@ -304,15 +318,19 @@ static void uart_tx_finish(uint8_t dev_idx, size_t len)
 	}
 }
 
-static int uart_tx_enqueue(uint8_t *data, size_t data_len, uint8_t dev_idx)
+static uint32_t uart_tx_put(const uint8_t *data, size_t data_len, uint8_t dev_idx)
 {
 	atomic_t started;
 	uint32_t written;
+	k_spinlock_key_t key;
 	int err;
 
+	key = k_spin_lock(&uart_tx_lock);
 	written = ring_buf_put(&uart_tx_ringbufs[dev_idx].rb, data, data_len);
+	k_spin_unlock(&uart_tx_lock, key);
+
 	if (written == 0) {
-		return -ENOMEM;
+		return 0;
 	}
 
 	started = atomic_set(&uart_tx_started[dev_idx], true);
@@ -324,14 +342,32 @@ static int uart_tx_enqueue(uint8_t *data, size_t data_len, uint8_t dev_idx)
 		}
 	}
 
-	if (written == data_len) {
+	return written;
+}
+
+static int uart_tx_enqueue(const uint8_t *data, size_t data_len, uint8_t dev_idx)
+{
+	if (uart_tx_put(data, data_len, dev_idx) == data_len) {
 		return 0;
 	} else {
 		return -ENOMEM;
 	}
+}
 
-	return 0;
+#if CONFIG_BRIDGE_DATA_DIRECT
+void bridge_data_uart_write(uint8_t dev_idx, const uint8_t *buf, size_t len)
+{
+	uint32_t written;
+
+	if (dev_idx >= UART_DEVICE_COUNT) {
+		return;
+	}
+
+	/* Data that does not fit in the TX ringbuffer is dropped */
+	written = uart_tx_put(buf, len, dev_idx);
+	bridge_data_stats_add(dev_idx, BRIDGE_DATA_CDC_TO_UART, written, len - written);
 }
+#endif
 
 static bool app_event_handler(const struct app_event_header *aeh)
 {
@@ -5,6 +5,7 @@
  */
 #include <stdio.h>
 #include <zephyr/types.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/usb/usb_device.h>
 
@@ -13,6 +14,7 @@
 #include "peer_conn_event.h"
 #include "cdc_data_event.h"
 #include "uart_data_event.h"
+#include "bridge_data.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_BRIDGE_CDC_LOG_LEVEL);
@@ -42,6 +44,16 @@ static uint32_t cdc_baudrate[CDC_DEVICE_COUNT];
 
 static uint8_t overflow_buf[64];
 
+#if CONFIG_BRIDGE_DATA_DIRECT
+#define CDC_TX_BUF_SIZE CONFIG_BRIDGE_DATA_CDC_TX_BUF_SIZE
+
+/* UART data waiting for the CDC ACM port, filled from the UART interrupt */
+static struct ring_buf cdc_tx_ringbufs[CDC_DEVICE_COUNT];
+static uint8_t cdc_tx_bufs[CDC_DEVICE_COUNT][CDC_TX_BUF_SIZE];
+/* Incoming CDC data is copied straight into the UART TX ringbuffers */
+static uint8_t cdc_rx_buf[256];
+#endif
+
 static bool fs_module_ready;
 static bool bulk_module_ready;
 
@@ -95,11 +107,71 @@ static void cdc_dtr_work_handler(struct k_work *work)
 	poll_dtr();
 }
 
+#if CONFIG_BRIDGE_DATA_DIRECT
+void bridge_data_cdc_write(uint8_t dev_idx, const uint8_t *buf, size_t len)
+{
+	uint32_t written;
+
+	if ((dev_idx >= CDC_DEVICE_COUNT) || (cdc_ready[dev_idx] == 0)) {
+		return;
+	}
+
+	/* Data that does not fit in the ringbuffer is dropped */
+	written = ring_buf_put(&cdc_tx_ringbufs[dev_idx], buf, len);
+	bridge_data_stats_add(dev_idx, BRIDGE_DATA_UART_TO_CDC, written, len - written);
+
+	if (written > 0) {
+		uart_irq_tx_enable(devices[dev_idx]);
+	}
+}
+
+static void cdc_tx_fill(int dev_idx)
+{
+	struct ring_buf *rb = &cdc_tx_ringbufs[dev_idx];
+	uint8_t *data;
+	uint32_t len;
+	int written;
+
+	len = ring_buf_get_claim(rb, &data, CDC_TX_BUF_SIZE);
+	if (len == 0) {
+		uart_irq_tx_disable(devices[dev_idx]);
+
+		/* Data may have been queued before TX interrupt was disabled */
+		if (!ring_buf_is_empty(rb)) {
+			uart_irq_tx_enable(devices[dev_idx]);
+		}
+		return;
+	}
+
+	written = uart_fifo_fill(devices[dev_idx], data, len);
+	ring_buf_get_finish(rb, MAX(written, 0));
+}
+
+static void cdc_rx_direct(const struct device *dev, int dev_idx)
+{
+	int data_length;
+
+	do {
+		data_length = uart_fifo_read(dev, cdc_rx_buf, sizeof(cdc_rx_buf));
+		if (data_length > 0) {
+			bridge_data_uart_write(dev_idx, cdc_rx_buf, data_length);
+		}
+	} while (data_length == sizeof(cdc_rx_buf));
+}
+#endif
+
 static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data)
 {
 	int dev_idx = (int) user_data;
 
 	uart_irq_update(dev);
+
+#if CONFIG_BRIDGE_DATA_DIRECT
+	if (uart_irq_tx_ready(dev)) {
+		cdc_tx_fill(dev_idx);
+	}
+#endif
+
 	if (!uart_irq_rx_ready(dev)) {
 		return;
 	}
@@ -110,6 +182,11 @@ static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data
 
 	poll_dtr();
 
+#if CONFIG_BRIDGE_DATA_DIRECT
+	cdc_rx_direct(dev, dev_idx);
+	return;
+#endif
+
 	do {
 		err = k_mem_slab_alloc(&cdc_rx_slab, &rx_buf, K_NO_WAIT);
 		if (err) {
@@ -190,6 +267,11 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			cast_uart_data_event(aeh);
 		int tx_written;
 
+		if (IS_ENABLED(CONFIG_BRIDGE_DATA_DIRECT)) {
+			/* Data is already forwarded from the UART interrupt */
+			return false;
+		}
+
 		if (event->dev_idx >= CDC_DEVICE_COUNT) {
 			return false;
 		}
@@ -250,6 +332,10 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			}
 			for (int i = 0; i < CDC_DEVICE_COUNT; ++i) {
 				cdc_ready[i] = 0;
+#if CONFIG_BRIDGE_DATA_DIRECT
+				ring_buf_init(&cdc_tx_ringbufs[i], sizeof(cdc_tx_bufs[i]),
+					      cdc_tx_bufs[i]);
+#endif
 				if (device_is_ready(devices[i])) {
 					enable_rx_irq(i);
 					LOG_DBG("%s available", devices[i]->name);
@@ -14,6 +14,7 @@
 #include <drivers/gpio/hpf_gpio.h>
 #include <hal/nrf_vpr_csr.h>
 #include <hal/nrf_vpr_csr_vio.h>
+#include <hal/nrf_vpr_csr_vtim.h>
 #include <haly/nrfy_gpio.h>
 
 #define HRT_IRQ_PRIORITY          2
@@ -92,6 +93,12 @@ static const uint8_t pin_to_vio_map[] = {
 volatile uint16_t irq_arg;
 volatile uint16_t irq_arg2;
 
+static volatile hpf_gpio_stream_t *stream;
+static uint16_t stream_vio_mask;
+static uint8_t stream_pin_count;
+static uint32_t stream_pins[VIO_PIN_COUNT];
+static uint16_t stream_vios[VIO_PIN_COUNT];
+
 static uint8_t gpio_pin_port_to_vio_index(uint8_t port, uint16_t pin)
 {
 	/* Check if the pin and the port can be accessed by VIO. */
@@ -195,6 +202,66 @@ static int gpio_hpf_pin_configure(uint8_t port, uint16_t pin, uint32_t flags)
 	return 0;
 }
 
+static void stream_pins_set(uint32_t gpio_pin_mask)
+{
+	stream_pin_count = 0;
+
+	for (int i = 0; i < VIO_PIN_COUNT; i++) {
+		if (gpio_pin_mask & BIT(i + VIO_PIN_OFFSET)) {
+			stream_pins[stream_pin_count] = BIT(i + VIO_PIN_OFFSET);
+			stream_vios[stream_pin_count] = BIT(pin_to_vio_map[i]);
+			stream_pin_count++;
+		}
+	}
+}
+
+static inline uint16_t stream_value_to_vio(uint32_t value)
+{
+	uint16_t vio = 0;
+
+	for (uint8_t i = 0; i < stream_pin_count; i++) {
+		if (value & stream_pins[i]) {
+			vio |= stream_vios[i];
+		}
+	}
+	return vio;
+}
+
+static void stream_play(void)
+{
+	uint32_t idx = 0;
+
+	/* Counter 0 generates an event every period, the out values are written
+	 * right after the event to keep the timing independent of the data.
+	 */
+	nrf_vpr_csr_vtim_count_mode_set(0, NRF_VPR_CSR_VTIM_COUNT_RELOAD);
+	nrf_vpr_csr_vtim_simple_counter_top_set(0, stream->period);
+	nrf_vpr_csr_vtim_simple_counter_set(0, stream->period);
+
+	while (stream->len[idx] != 0) {
+		const uint32_t *buf = stream->buf[idx];
+		uint32_t len = stream->len[idx];
+		uint16_t out = stream_value_to_vio(buf[0]);
+
+		for (uint32_t i = 0; i < len; i++) {
+			nrf_vpr_csr_vtim_simple_wait_set(0, false, 0);
+			nrf_vpr_csr_vio_out_set((nrf_vpr_csr_vio_out_get() & ~stream_vio_mask) | out);
+
+			if (i + 1 < len) {
+				out = stream_value_to_vio(buf[i + 1]);
+			}
+		}
+
+		/* Release the buffer and continue with the next one. */
+		stream->len[idx] = 0;
+		idx = (idx + 1) % HPF_GPIO_STREAM_BUF_COUNT;
+	}
+
+	nrf_vpr_csr_vtim_count_mode_set(0, NRF_VPR_CSR_VTIM_COUNT_STOP);
+	stream->active = false;
+	stream = NULL;
+}
+
 void process_packet(hpf_gpio_data_packet_t *packet)
 {
 	if (packet->opcode == HPF_GPIO_PIN_CONFIGURE) {
@@ -227,6 +294,18 @@ void process_packet(hpf_gpio_data_packet_t *packet)
 			nrf_vpr_clic_int_pending_set(NRF_VPRCLIC,
 						     VEVIF_IRQN(HRT_VEVIF_IDX_GPIO_SET_MASKED));
 			break;
+		case HPF_GPIO_PORT_STREAM:
+			/* The stream is played out from the main loop, a new stream
+			 * is ignored until the active one stops.
+			 */
+			if (stream == NULL) {
+				stream_vio_mask = vio_mask;
+				stream_pins_set(packet->pin);
+				stream = (volatile hpf_gpio_stream_t *)packet->flags;
+			} else if (stream != (volatile hpf_gpio_stream_t *)packet->flags) {
+				((volatile hpf_gpio_stream_t *)packet->flags)->active = false;
+			}
+			break;
 		default:
 			break;
 		}
@@ -275,7 +354,14 @@ int main(void)
 	}
 
 	while (true) {
-		k_cpu_idle();
+		unsigned int key = irq_lock();
+
+		if (stream == NULL) {
+			k_cpu_atomic_idle(key);
+		} else {
+			irq_unlock(key);
+			stream_play();
+		}
 	}
 
 	return 0;
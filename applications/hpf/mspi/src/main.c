@@ -566,6 +566,22 @@ static void ep_recv(const void *data, size_t len, void *priv)
 		}
 		break;
 	}
+#ifdef CONFIG_HPF_MSPI_IPC_NO_COPY
+	case HPF_MSPI_XFER_QUEUE: {
+		hpf_mspi_xfer_queue_msg_t *queue = (hpf_mspi_xfer_queue_msg_t *)data;
+
+		for (uint32_t i = 0; i < queue->num_packets; i++) {
+			hpf_mspi_xfer_packet_msg_t *packet = &queue->packets[i];
+
+			if (packet->opcode == HPF_MSPI_TX) {
+				xfer_execute(packet, NULL);
+			} else if (packet->num_bytes > 0) {
+				xfer_execute(packet, packet->data);
+			}
+		}
+		break;
+	}
+#endif
 	default:
 		opcode = HPF_MSPI_WRONG_OPCODE;
 		break;
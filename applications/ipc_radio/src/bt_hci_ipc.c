@@ -62,6 +62,11 @@ K_MSGQ_DEFINE(ipc_block_queue, sizeof(struct ipc_block_item), MAX_IPC_BLOCKS, si
 static K_FIFO_DEFINE(tx_queue);
 static K_FIFO_DEFINE(rx_queue);
 
+#if defined(CONFIG_IPC_RADIO_BT_HCI_IPC_RX_DIRECT)
+/* Number of received blocks that are held until the queue thread processes them. */
+static atomic_t rx_blocks_pending;
+#endif /* CONFIG_IPC_RADIO_BT_HCI_IPC_RX_DIRECT */
+
 enum hci_h4_type {
 	HCI_H4_CMD = 0x01, /* rx */
 	HCI_H4_ACL = 0x02, /* rx */
@@ -72,7 +77,7 @@ enum hci_h4_type {
 #define HCI_FATAL_MSG true
 #define HCI_REGULAR_MSG false
 
-static struct net_buf *recv_cmd(const uint8_t *data, size_t len)
+static struct net_buf *recv_cmd(const uint8_t *data, size_t len, k_timeout_t timeout)
 {
 	const struct bt_hci_cmd_hdr *hdr = (const struct bt_hci_cmd_hdr *)data;
 	struct net_buf *buf;
@@ -87,7 +92,11 @@ static struct net_buf *recv_cmd(const uint8_t *data, size_t len)
 		return NULL;
 	}
 
-	buf = bt_buf_get_tx(BT_BUF_CMD, K_FOREVER, hdr, sizeof(*hdr));
+	buf = bt_buf_get_tx(BT_BUF_CMD, timeout, hdr, sizeof(*hdr));
+	if (!buf) {
+		return NULL;
+	}
+
 	data += sizeof(*hdr);
 	len -= sizeof(*hdr);
 
@@ -104,7 +113,7 @@ static struct net_buf *recv_cmd(const uint8_t *data, size_t len)
 	return buf;
 }
 
-static struct net_buf *recv_acl(const uint8_t *data, size_t len)
+static struct net_buf *recv_acl(const uint8_t *data, size_t len, k_timeout_t timeout)
 {
 	const struct bt_hci_acl_hdr *hdr = (const struct bt_hci_acl_hdr *)data;
 	struct net_buf *buf;
@@ -119,7 +128,11 @@ static struct net_buf *recv_acl(const uint8_t *data, size_t len)
 		return NULL;
 	}
 
-	buf = bt_buf_get_tx(BT_BUF_ACL_OUT, K_FOREVER, hdr, sizeof(*hdr));
+	buf = bt_buf_get_tx(BT_BUF_ACL_OUT, timeout, hdr, sizeof(*hdr));
+	if (!buf) {
+		return NULL;
+	}
+
 	data += sizeof(*hdr);
 	len -= sizeof(*hdr);
 
@@ -136,7 +149,7 @@ static struct net_buf *recv_acl(const uint8_t *data, size_t len)
 	return buf;
 }
 
-static struct net_buf *recv_iso(const uint8_t *data, size_t len)
+static struct net_buf *recv_iso(const uint8_t *data, size_t len, k_timeout_t timeout)
 {
 	const struct bt_hci_iso_hdr *hdr = (const struct bt_hci_iso_hdr *)data;
 	struct net_buf *buf;
@@ -151,7 +164,11 @@ static struct net_buf *recv_iso(const uint8_t *data, size_t len)
 		return NULL;
 	}
 
-	buf = bt_buf_get_tx(BT_BUF_ISO_OUT, K_FOREVER, hdr, sizeof(*hdr));
+	buf = bt_buf_get_tx(BT_BUF_ISO_OUT, timeout, hdr, sizeof(*hdr));
+	if (!buf) {
+		return NULL;
+	}
+
 	data += sizeof(*hdr);
 	len -= sizeof(*hdr);
 
@@ -168,6 +185,29 @@ static struct net_buf *recv_iso(const uint8_t *data, size_t len)
 	return buf;
 }
 
+static struct net_buf *recv_packet(const uint8_t *data, size_t len, k_timeout_t timeout)
+{
+	enum hci_h4_type type;
+
+	type = (enum hci_h4_type)*data++;
+	len -= sizeof(type);
+
+	switch (type) {
+	case HCI_H4_CMD:
+		return recv_cmd(data, len, timeout);
+
+	case HCI_H4_ACL:
+		return recv_acl(data, len, timeout);
+
+	case HCI_H4_ISO:
+		return recv_iso(data, len, timeout);
+
+	default:
+		LOG_ERR("Unknown HCI type %u.", type);
+		return NULL;
+	}
+}
+
 static void send(struct net_buf *buf, bool is_fatal_err)
 {
 	uint8_t retries = 0;
@@ -215,6 +255,23 @@ static void recv(const void *data, size_t len, void *priv)
 	LOG_INF("Received hci message of %u bytes.", len);
 	LOG_HEXDUMP_DBG(data, len, "HCI data:");
 
+#if defined(CONFIG_IPC_RADIO_BT_HCI_IPC_RX_DIRECT)
+	/* Copy the packet at once if a buffer is available, so that the IPC block is
+	 * released without waiting for the queue thread. The packets that are still
+	 * held must be processed first to keep the order.
+	 */
+	if (atomic_get(&rx_blocks_pending) == 0) {
+		struct net_buf *buf = recv_packet(data, len, K_NO_WAIT);
+
+		if (buf) {
+			k_fifo_put(&tx_queue, buf);
+			return;
+		}
+	}
+
+	atomic_inc(&rx_blocks_pending);
+#endif /* CONFIG_IPC_RADIO_BT_HCI_IPC_RX_DIRECT */
+
 	block.ptr = data;
 	block.len = len;
 
@@ -231,36 +288,13 @@ static void queue_thread(void)
 {
 	struct ipc_block_item block;
 	struct net_buf *buf;
-	const uint8_t *tmp;
-	enum hci_h4_type type;
 	int err;
 
 	while (1) {
 		err = k_msgq_get(&ipc_block_queue, &block, K_FOREVER);
 		__ASSERT(err == 0, "Failed to get data from msgq: %d.", err);
 
-		tmp = (const uint8_t *)block.ptr;
-		type = (enum hci_h4_type)*tmp++;
-		block.len -= sizeof(type);
-
-		switch (type) {
-		case HCI_H4_CMD:
-			buf = recv_cmd(tmp, block.len);
-			break;
-
-		case HCI_H4_ACL:
-			buf = recv_acl(tmp, block.len);
-			break;
-
-		case HCI_H4_ISO:
-			buf = recv_iso(tmp, block.len);
-			break;
-
-		default:
-			LOG_ERR("Unknown HCI type %u.", type);
-			buf = NULL;
-			break;
-		}
+		buf = recv_packet(block.ptr, block.len, K_FOREVER);
 
 		err = ipc_service_release_rx_buffer(&hci_ept, (void *)block.ptr);
 		if (err < 0) {
@@ -272,6 +306,10 @@ static void queue_thread(void)
 		if (buf) {
 			k_fifo_put(&tx_queue, buf);
 		}
+
+#if defined(CONFIG_IPC_RADIO_BT_HCI_IPC_RX_DIRECT)
+		atomic_dec(&rx_blocks_pending);
+#endif /* CONFIG_IPC_RADIO_BT_HCI_IPC_RX_DIRECT */
 	}
 }
 
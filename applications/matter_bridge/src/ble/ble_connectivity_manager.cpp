@@ -86,32 +86,99 @@ void BLEConnectivityManager::FilterMatch(bt_scan_device_info *device_info, bt_sc
 	Instance().mScannedDevicesCounter++;
 }
 
-int BLEConnectivityManager::StartGattDiscovery(bt_conn *conn, BLEBridgedDeviceProvider *provider)
+int BLEConnectivityManager::StartGattDiscovery(BLEBridgedDeviceProvider *provider)
 {
+	bt_conn *conn = provider->GetConnectionObject();
+
+	if (!conn) {
+		LOG_ERR("The device has been disconnected before the discovery procedure");
+		return -ENOTCONN;
+	}
+
 	/* Start GATT discovery for the device's service UUID. */
 	int err = bt_gatt_dm_start(conn, provider->GetServiceUuid(), &discovery_cb, provider);
 	if (err) {
 		LOG_ERR("Could not start the discovery procedure, error "
 			"code: %d",
 			err);
+	} else {
+		mDiscoveryProvider = provider;
 	}
 	return err;
 }
 
+void BLEConnectivityManager::QueueGattDiscovery(BLEBridgedDeviceProvider *provider)
+{
+	/* The discovery queue is handled only in the Matter thread context. */
+	DeviceLayer::PlatformMgr().ScheduleWork(
+		[](intptr_t context) {
+			BLEBridgedDeviceProvider *provider = reinterpret_cast<BLEBridgedDeviceProvider *>(context);
+
+			if (Instance().mDiscoveryProvider) {
+				if (!Recovery::PutProvider(provider, &Instance().mListToDiscover)) {
+					Instance().HandleDiscoveryFailure(provider);
+				}
+			} else if (Instance().StartGattDiscovery(provider) != 0) {
+				Instance().HandleDiscoveryFailure(provider);
+			}
+		},
+		reinterpret_cast<intptr_t>(provider));
+}
+
+void BLEConnectivityManager::StartNextGattDiscovery()
+{
+	BLEBridgedDeviceProvider *provider;
+
+	mDiscoveryProvider = nullptr;
+
+	while ((provider = Recovery::GetProvider(&mListToDiscover)) != nullptr) {
+		if (StartGattDiscovery(provider) == 0) {
+			break;
+		}
+
+		HandleDiscoveryFailure(provider);
+	}
+
+	UpdateRecovery();
+}
+
+void BLEConnectivityManager::HandleDiscoveryFailure(BLEBridgedDeviceProvider *provider)
+{
+	if (!provider->IsInitiallyConnected()) {
+		/* Trigger the connection callback to inform the application that the connection procedure failed. */
+		provider->GetBLEBridgedDevice().mFirstConnectionCallback(
+			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
+	}
+}
+
 void BLEConnectivityManager::UpdateRecovery()
 {
-	if (!sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
-		/* There is another provider to re-connect, schedule this operation. */
-		BLEBridgedDeviceProvider *providerToRecover =
-			Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
+	Recovery &recovery = Instance().mRecovery;
+
+	if (recovery.mReconnectPending) {
+		/* The next provider will be re-connected once the pending connection is established. */
+		Instance().UpdateStateFlag(State::LostDevice, true);
+	} else if (!sys_slist_is_empty(&recovery.mListToReconnect)) {
+		/* There is another provider to re-connect, schedule this operation. It runs in parallel with the GATT
+		 * discoveries of the providers connected before. */
+		BLEBridgedDeviceProvider *providerToRecover = recovery.GetProvider(&recovery.mListToReconnect);
+
+		recovery.mReconnectPending = true;
 		DeviceLayer::PlatformMgr().ScheduleWork(
 			[](intptr_t context) {
-				Instance().Reconnect(reinterpret_cast<BLEBridgedDeviceProvider *>(context));
+				if (CHIP_NO_ERROR !=
+				    Instance().Reconnect(reinterpret_cast<BLEBridgedDeviceProvider *>(context))) {
+					Instance().mRecovery.mReconnectPending = false;
+					Instance().UpdateRecovery();
+				}
 			},
 			reinterpret_cast<intptr_t>(providerToRecover));
 		/* We have still a device to recover, keep the LostDevice state active */
 		Instance().UpdateStateFlag(State::LostDevice, true);
-	} else if (!sys_slist_is_empty(&Instance().mRecovery.mListToRecover)) {
+	} else if (Instance().mDiscoveryProvider) {
+		/* Wait for the pending discoveries, as the discovered providers are removed from the list to recover. */
+		Instance().UpdateStateFlag(State::LostDevice, true);
+	} else if (!sys_slist_is_empty(&recovery.mListToRecover)) {
 		/* There are pending providers to recover and no more scanned ones, schedule next scan operation. */
 		Instance().mRecovery.StartTimer();
 	} else {
@@ -145,9 +212,18 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 		return;
 	}
 
-	/* If there was an error during the initial connection, we should notify the application */
-	bool firstConnFailed = (conn_err && !provider->IsInitiallyConnected());
-	VerifyOrExit(!firstConnFailed, err = conn_err);
+	if (provider->IsInitiallyConnected()) {
+		/* The re-connection is not pending anymore, so the next provider can be re-connected. */
+		Instance().mRecovery.mReconnectPending = false;
+
+		if (conn_err) {
+			bt_conn_unref(provider->GetConnectionObject());
+			provider->RemoveConnectionObject();
+		}
+	}
+
+	/* If there was an error during the connection, we should notify the application */
+	VerifyOrExit(!conn_err, err = conn_err);
 
 	char addrStr[BT_ADDR_LE_STR_LEN];
 	bt_addr_le_to_str(dstAddr, addrStr, sizeof(addrStr));
@@ -162,14 +238,17 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 	/* Start GATT discovery only if this specific device was successfully connected before. Otherwise, it will be
 	 * called after a successful pairing. */
 	if (provider->IsInitiallyConnected()) {
-		err = StartGattDiscovery(conn, provider);
-		VerifyOrExit(err == 0, );
+		QueueGattDiscovery(provider);
 	}
 #else
-	err = StartGattDiscovery(conn, provider);
-	VerifyOrExit(err == 0, );
+	QueueGattDiscovery(provider);
 #endif
 
+	if (provider->IsInitiallyConnected()) {
+		/* Re-connect the next provider while this one is being discovered. */
+		Instance().UpdateRecovery();
+	}
+
 	return;
 
 exit:
@@ -306,7 +385,7 @@ void BLEConnectivityManager::PairingComplete(struct bt_conn *conn, bool bonded)
 	Instance().UpdateStateFlag(State::Pairing, false);
 
 	/* Once pairing completed successfully, start GATT discovery procedure. */
-	StartGattDiscovery(conn, provider);
+	QueueGattDiscovery(provider);
 }
 
 void BLEConnectivityManager::PairingFailed(struct bt_conn *conn, enum bt_security_err reason)
@@ -360,6 +439,7 @@ void BLEConnectivityManager::DiscoveryCompletedHandler(bt_gatt_dm *dm, void *con
 	if (provider->IsInitiallyConnected()) {
 		Instance().mRecovery.RemoveRecovered(provider);
 		provider->NotifySuccessfulRecovery();
+		LOG_INF("The device has been recovered in %u ms", provider->GetLastRecoveryTimeMs());
 	}
 
 exit:
@@ -382,7 +462,8 @@ exit:
 					ctx->mProvider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
 				ctx->mProvider->ConfirmInitialConnection();
 				VerifyOrReturn(CHIP_NO_ERROR == err, bt_gatt_dm_data_release(ctx->mDiscoveryData);
-					       Instance().RemoveBLEProvider(ctx->mProvider->GetBtAddress()););
+					       Instance().RemoveBLEProvider(ctx->mProvider->GetBtAddress());
+					       Instance().StartNextGattDiscovery(););
 			}
 
 			if (CHIP_NO_ERROR != ctx->mProvider->NotifyReachableStatusChange(true)) {
@@ -393,6 +474,9 @@ exit:
 				LOG_ERR("Cannot parse the GATT discovered data.");
 			}
 			bt_gatt_dm_data_release(ctx->mDiscoveryData);
+
+			/* The next discovery can be started only after the data has been released. */
+			Instance().StartNextGattDiscovery();
 		},
 		reinterpret_cast<intptr_t>(discoveryCtx.get()));
 
@@ -401,8 +485,6 @@ exit:
 	} else {
 		bt_gatt_dm_data_release(dm);
 	}
-
-	Instance().UpdateRecovery();
 }
 
 void BLEConnectivityManager::DiscoveryNotFound(bt_conn *conn, void *context)
@@ -419,7 +501,7 @@ void BLEConnectivityManager::DiscoveryNotFound(bt_conn *conn, void *context)
 		}
 	}
 
-	Instance().UpdateRecovery();
+	DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { Instance().StartNextGattDiscovery(); });
 }
 
 void BLEConnectivityManager::DiscoveryError(bt_conn *conn, int err, void *context)
@@ -433,7 +515,7 @@ void BLEConnectivityManager::DiscoveryError(bt_conn *conn, int err, void *contex
 			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
 	}
 
-	Instance().UpdateRecovery();
+	DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { Instance().StartNextGattDiscovery(); });
 }
 
 CHIP_ERROR BLEConnectivityManager::Init(const bt_uuid **serviceUuids, uint8_t serviceUuidsCount)
@@ -597,7 +679,6 @@ void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 {
 	DeviceLayer::PlatformMgr().ScheduleWork(
 		[](intptr_t context) {
-			BLEBridgedDeviceProvider *provider;
 			ScanResult result = *reinterpret_cast<ScanResult *>(context);
 			sys_snode_t *node;
 			sys_snode_t *tmpNodeSafe;
@@ -634,13 +715,7 @@ void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 			if (sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
 				Instance().mRecovery.StartTimer();
 			} else {
-				provider = Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
-				DeviceLayer::PlatformMgr().ScheduleWork(
-					[](intptr_t context) {
-						Instance().Reconnect(
-							reinterpret_cast<BLEBridgedDeviceProvider *>(context));
-					},
-					reinterpret_cast<intptr_t>(provider));
+				Instance().UpdateRecovery();
 			}
 		},
 		reinterpret_cast<intptr_t>(&result));
@@ -903,6 +978,7 @@ BLEConnectivityManager::Recovery::Recovery()
 void BLEConnectivityManager::Recovery::NotifyProviderToRecover(BLEBridgedDeviceProvider *provider)
 {
 	if (provider) {
+		provider->NotifyRecoveryStarted();
 		PutProvider(provider, &mListToRecover);
 		StartTimer();
 	}
@@ -100,6 +100,9 @@ private:
 		sys_slist_t mListToRecover;
 		sys_slist_t mListToReconnect;
 		k_timer mRecoveryTimer;
+		/* A re-connection is pending. The Bluetooth host can establish only one connection at a time, so the next
+		 * device is re-connected once the pending connection is established. */
+		bool mReconnectPending = false;
 	};
 
 	struct DiscoveryHandlerCtx {
@@ -176,6 +179,18 @@ public:
 	 */
 	BLEBridgedDeviceProvider *FindBLEProvider(bt_addr_le_t address);
 
+	/**
+	 * @brief Get BLE provider stored on the specified position of the manager's list.
+	 *
+	 * @param index position on the manager's list, lower than kMaxConnectedDevices
+	 * @return address of provider on success
+	 * @return nullptr if there is no provider on the specified position
+	 */
+	BLEBridgedDeviceProvider *GetBLEProvider(uint8_t index)
+	{
+		return index < kMaxConnectedDevices ? mConnectedProviders[index] : nullptr;
+	}
+
 	/**
 	 * @brief Add the BLE provider's address to the manager's list.
 	 *
@@ -244,7 +259,7 @@ public:
 	static void DiscoveryCompletedHandler(bt_gatt_dm *dm, void *context);
 	static void DiscoveryNotFound(bt_conn *conn, void *context);
 	static void DiscoveryError(bt_conn *conn, int err, void *context);
-	static int StartGattDiscovery(bt_conn *conn, BLEBridgedDeviceProvider *provider);
+	static void QueueGattDiscovery(BLEBridgedDeviceProvider *provider);
 #ifdef CONFIG_BRIDGE_FORCE_BT_CONNECTION_PARAMS
 	static bool ParamChangeRequestHandler(struct bt_conn *conn, struct bt_le_conn_param *param);
 #endif
@@ -277,6 +292,9 @@ private:
 	State GetCurrentState();
 	void UpdateStateFlag(State state, bool enabled);
 	void UpdateRecovery();
+	int StartGattDiscovery(BLEBridgedDeviceProvider *provider);
+	void StartNextGattDiscovery();
+	void HandleDiscoveryFailure(BLEBridgedDeviceProvider *provider);
 
 	StateChangedCallback mStateChangedCb = nullptr;
 	uint8_t mStateBitmask = 0;
@@ -295,6 +313,10 @@ private:
 	ConnectionSecurityRequest mConnectionSecurityRequest;
 #endif /* CONFIG_BT_SMP */
 	Recovery mRecovery;
+	/* GATT Discovery Manager can run only one discovery at a time, so the discoveries of the devices connected in the
+	 * meantime are queued. */
+	BLEBridgedDeviceProvider *mDiscoveryProvider = nullptr;
+	sys_slist_t mListToDiscover = {};
 };
 
 } /* namespace Nrf */
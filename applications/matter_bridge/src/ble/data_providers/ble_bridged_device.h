@@ -111,14 +111,48 @@ public:
 	/**
 	 * @brief Inform provider that recovery attempt for it succeeded.
 	 *
-	 * This method resets the number of failed recovery attempts.
+	 * This method resets the number of failed recovery attempts and stores the recovery time.
 	 *
 	 */
-	void NotifySuccessfulRecovery() { mFailedRecoveryAttempts = 0; }
+	void NotifySuccessfulRecovery()
+	{
+		mFailedRecoveryAttempts = 0;
+
+		if (mRecoveryStartTime) {
+			mLastRecoveryTimeMs = static_cast<uint32_t>(k_uptime_get() - mRecoveryStartTime);
+			mRecoveryStartTime = 0;
+		}
+	}
+
+	/**
+	 * @brief Inform provider that the connection with it is being recovered.
+	 *
+	 * This method starts the measurement of the recovery time, unless it is already in progress.
+	 *
+	 */
+	void NotifyRecoveryStarted()
+	{
+		if (!mRecoveryStartTime) {
+			mRecoveryStartTime = k_uptime_get();
+		}
+	}
+
+	/**
+	 * @brief Check if the connection with the provider is being recovered.
+	 */
+	bool IsRecovering() { return mRecoveryStartTime != 0; }
+
+	/**
+	 * @brief Get the time (in milliseconds) from losing the connection until the provider was rediscovered, measured
+	 * for the last successful recovery, or 0 if the provider has not been recovered yet.
+	 */
+	uint32_t GetLastRecoveryTimeMs() { return mLastRecoveryTimeMs; }
 
 protected:
 	BLEBridgedDevice mDevice = { 0 };
 	uint16_t mFailedRecoveryAttempts = 0;
+	int64_t mRecoveryStartTime = 0;
+	uint32_t mLastRecoveryTimeMs = 0;
 };
 
 } /* namespace Nrf */
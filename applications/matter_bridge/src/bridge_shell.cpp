@@ -8,12 +8,17 @@
 #include "platform/ConfigurationManager.h"
 
 #ifdef CONFIG_BRIDGED_DEVICE_BT
+#include "ble_bridged_device.h"
 #include "ble_bridged_device_factory.h"
 #include "ble_connectivity_manager.h"
 #else
 #include "simulated_bridged_device_factory.h"
 #endif /* CONFIG_BRIDGED_DEVICE_BT */
 
+#ifdef CONFIG_BRIDGE_BENCHMARK
+#include "simulated_bridge_benchmark.h"
+#endif
+
 #include <zephyr/shell/shell.h>
 
 #if defined(CONFIG_BRIDGED_DEVICE_BT) && defined(CONFIG_BT_SMP)
@@ -248,6 +253,89 @@ static int SimulatedBridgedDeviceOnOffLightSwitchWriteHandler(const struct shell
 }
 #endif
 
+#ifdef CONFIG_BRIDGE_BENCHMARK
+static int BenchmarkStartHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	unsigned long devices = strtoul(argv[1], nullptr, 0);
+	unsigned long attributes = strtoul(argv[2], nullptr, 0);
+	unsigned long intervalMs = strtoul(argv[3], nullptr, 0);
+
+	if (devices > UINT8_MAX || attributes > UINT8_MAX) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: invalid arguments\n");
+		return -EINVAL;
+	}
+
+	CHIP_ERROR err = SimulatedBridgeBenchmark::Instance().Start(devices, attributes, intervalMs);
+
+	if (err == CHIP_ERROR_INCORRECT_STATE) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: benchmark is already running\n");
+	} else if (err == CHIP_ERROR_INVALID_ARGUMENT) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: invalid arguments, up to %u devices and %u attributes\n",
+			      Nrf::BridgeManager::kMaxBridgedDevices, SimulatedBridgeBenchmark::kMaxAttributes);
+	} else if (err != CHIP_NO_ERROR) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: cannot add benchmark devices\n");
+	} else {
+		shell_fprintf(shell, SHELL_INFO, "Done\n");
+	}
+
+	return 0;
+}
+
+static int BenchmarkStopHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	SimulatedBridgeBenchmark::Instance().Stop();
+	shell_fprintf(shell, SHELL_INFO, "Done\n");
+
+	return 0;
+}
+
+static int BenchmarkStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	SimulatedBridgeBenchmark::Stats stats;
+
+	SimulatedBridgeBenchmark::Instance().GetStats(stats);
+
+	shell_fprintf(shell, SHELL_INFO, "Benchmark %s: %u devices x %u attributes every %u ms, %u ms elapsed\n",
+		      SimulatedBridgeBenchmark::Instance().IsRunning() ? "running" : "stopped", stats.mDevices,
+		      stats.mAttributes, stats.mIntervalMs, stats.mDurationMs);
+	shell_fprintf(shell, SHELL_INFO, "Updates: %u generated, %u handled, %u dropped\n", stats.mGeneratedUpdates,
+		      stats.mHandledUpdates, stats.mDroppedUpdates);
+	shell_fprintf(shell, SHELL_INFO, "Update latency: avg %u us, max %u us\n", stats.mUpdateLatencyAvgUs,
+		      stats.mUpdateLatencyMaxUs);
+	shell_fprintf(shell, SHELL_INFO, "Report latency: avg %u us, max %u us (%u reports)\n",
+		      stats.mReportLatencyAvgUs, stats.mReportLatencyMaxUs, stats.mReports);
+
+	if (stats.mCpuLoad >= 0) {
+		shell_fprintf(shell, SHELL_INFO, "CPU load: %d%%\n", stats.mCpuLoad);
+	} else {
+		shell_fprintf(shell, SHELL_INFO, "CPU load: not available\n");
+	}
+
+	shell_fprintf(shell, SHELL_INFO, "Heap high-water mark: %llu B\n", stats.mHeapHighWatermark);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(
+	sub_benchmark,
+	SHELL_CMD_ARG(start, NULL,
+		      "Starts the benchmark. \n"
+		      "Usage: start <devices> <attributes> <interval_ms>\n"
+		      "* devices - the number of simulated bridged devices to add\n"
+		      "* attributes - the number of attributes updated by each device, from 1 to 3\n"
+		      "* interval_ms - the interval between two updates of each device, in milliseconds\n",
+		      BenchmarkStartHandler, 4, 0),
+	SHELL_CMD_ARG(stop, NULL,
+		      "Stops the benchmark and removes its bridged devices. \n"
+		      "Usage: stop\n",
+		      BenchmarkStopHandler, 1, 0),
+	SHELL_CMD_ARG(stats, NULL,
+		      "Prints the statistics of the current or last benchmark. \n"
+		      "Usage: stats\n",
+		      BenchmarkStatsHandler, 1, 0),
+	SHELL_SUBCMD_SET_END);
+#endif /* CONFIG_BRIDGE_BENCHMARK */
+
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 static void BluetoothScanResult(Nrf::BLEConnectivityManager::ScanResult &result, void *context)
 {
@@ -298,6 +386,33 @@ static int ScanBridgedDeviceHandler(const struct shell *shell, size_t argc, char
 
 	return 0;
 }
+
+static int RecoveryStatusHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	shell_fprintf(shell, SHELL_INFO, "Bluetooth LE devices recovery:\n");
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+	shell_fprintf(shell, SHELL_INFO, "|      Address      |   State    | Last recovery (ms) | Failed scans \n");
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+
+	for (uint8_t i = 0; i < Nrf::BLEConnectivityManager::kMaxConnectedDevices; i++) {
+		Nrf::BLEBridgedDeviceProvider *provider = Nrf::BLEConnectivityManager::Instance().GetBLEProvider(i);
+
+		if (!provider) {
+			continue;
+		}
+
+		bt_addr_le_t addr = provider->GetBtAddress();
+
+		shell_fprintf(shell, SHELL_INFO, "| %02x:%02x:%02x:%02x:%02x:%02x | %-10s | %-18u | %u\n",
+			      addr.a.val[5], addr.a.val[4], addr.a.val[3], addr.a.val[2], addr.a.val[1],
+			      addr.a.val[0], provider->IsRecovering() ? "recovering" : "connected",
+			      provider->GetLastRecoveryTimeMs(), provider->GetFailedRecoveryAttempts());
+	}
+
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+
+	return 0;
+}
 #endif /* CONFIG_BRIDGED_DEVICE_BT */
 
 SHELL_STATIC_SUBCMD_SET_CREATE(
@@ -347,11 +462,19 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		"* bridged_device_endpoint_id - the bridged device's endpoint on which it was previously created\n",
 		SimulatedBridgedDeviceOnOffLightSwitchWriteHandler, 3, 0),
 #endif
+#ifdef CONFIG_BRIDGE_BENCHMARK
+	SHELL_CMD(benchmark, &sub_benchmark, "Bridge throughput benchmark commands", NULL),
+#endif
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 	SHELL_CMD_ARG(scan, NULL,
 		      "Scan for Bluetooth LE devices to bridge. \n"
 		      "Usage: scan\n",
 		      ScanBridgedDeviceHandler, 1, 0),
+	SHELL_CMD_ARG(recovery, NULL,
+		      "Lists the recovery state of Bluetooth LE bridged devices. \n"
+		      "Usage: recovery\n"
+		      "Displays address, state, time of the last connection recovery, and number of failed recovery scans.\n",
+		      RecoveryStatusHandler, 1, 0),
 #ifdef CONFIG_BT_SMP
 	SHELL_CMD_ARG(pincode, NULL,
 		      "Insert pincode for Bluetooth LE device pairing. \n"
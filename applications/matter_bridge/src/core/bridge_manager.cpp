@@ -53,6 +53,8 @@ CHIP_ERROR BridgeManager::Init(LoadStoredBridgedDevicesCallback loadStoredBridge
 
 	Nrf::Matter::BindingHandler::Init();
 
+	k_timer_init(&mReportTimer, ReportTimerTimeoutCallback, nullptr);
+
 	/* Invoke the callback to load stored devices in a proper moment. */
 	CHIP_ERROR err = loadStoredBridgedDevicesCb();
 
@@ -120,24 +122,19 @@ CHIP_ERROR BridgeManager::DoAddBridgedDevices(MatterBridgedDevice *devices[], Br
 
 CHIP_ERROR BridgeManager::RemoveBridgedDevice(uint16_t endpoint, uint8_t &devicesPairIndex)
 {
-	uint8_t index = 0;
-
 	DeviceLayer::StackLock lock;
 
-	while (index < kMaxBridgedDevices) {
-		if (mDevicesMap.Contains(index)) {
-			auto &devicePair = mDevicesMap[index];
-			if (devicePair.mDevice->GetEndpointId() == endpoint) {
-				LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
-				/* Free dynamically allocated memory */
-				emberAfClearDynamicEndpoint(index);
-				devicesPairIndex = index;
-				return SafelyRemoveDevice(index);
-			}
-		}
-		index++;
+	uint16_t index = GetDeviceIndex(endpoint);
+
+	if (!mDevicesMap.Contains(index)) {
+		return CHIP_ERROR_NOT_FOUND;
 	}
-	return CHIP_ERROR_NOT_FOUND;
+
+	LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
+	/* Free dynamically allocated memory */
+	emberAfClearDynamicEndpoint(index);
+	devicesPairIndex = index;
+	return SafelyRemoveDevice(index);
 }
 
 CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
@@ -145,6 +142,7 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 	uint16_t duplicatedItemKeys[kMaxBridgedDevices];
 	bool removeProvider = true;
 	auto &devicePair = mDevicesMap[index];
+	EndpointId endpoint = devicePair.mDevice ? devicePair.mDevice->GetEndpointId() : kInvalidEndpointId;
 
 	uint8_t duplicatesNumber = mDevicesMap.GetDuplicatesCount(devicePair, duplicatedItemKeys);
 	/* There must be at least 2 duplicates in the map to determine the real duplicate,
@@ -174,6 +172,12 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 			mNumberOfProviders--;
 		}
 
+		/* The endpoint is indexed only if it was created successfully. */
+		auto endpointIndex = mEndpointIndexes.TryAt(endpoint);
+		if (endpointIndex && *endpointIndex == index) {
+			mEndpointIndexes.Erase(endpoint);
+		}
+
 		/* Find the required index on the list, remove it and move all following indexes one position earlier.
 		 */
 		bool indexFound = false;
@@ -326,6 +330,7 @@ CHIP_ERROR BridgeManager::CreateEndpoint(uint8_t index, uint16_t endpointId)
 	if (err == CHIP_NO_ERROR) {
 		LOG_INF("Added device to dynamic endpoint %d (index=%d)", endpointId, index);
 		storedDevice->Init(endpointId);
+		mEndpointIndexes.Insert(endpointId, uint8_t(index));
 		return CHIP_NO_ERROR;
 	} else if (err != CHIP_ERROR_ENDPOINT_EXISTS) {
 		LOG_ERR("Failed to add dynamic endpoint: Internal error!");
@@ -470,12 +475,69 @@ void BridgeManager::HandleUpdate(BridgedDeviceDataProvider &dataProvider, Cluste
 			 * report. */
 			auto *device = item.value.mDevice;
 			if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
-				MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
+				Instance().MarkAttributeDirty(device->GetEndpointId(), clusterId, attributeId);
 			}
 		}
 	}
 }
 
+void BridgeManager::MarkAttributeDirty(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+	if (kReportCoalescingWindowMs == 0) {
+		MatterReportingAttributeChangeCallback(endpointId, clusterId, attributeId);
+#ifdef CONFIG_BRIDGE_BENCHMARK
+		if (mAttributeReportCallback) {
+			mAttributeReportCallback(endpointId, clusterId, attributeId);
+		}
+#endif
+		return;
+	}
+
+	for (uint8_t i = 0; i < mDirtyAttributesCount; i++) {
+		const AttributePath &path = mDirtyAttributes[i];
+
+		if (path.mEndpointId == endpointId && path.mClusterId == clusterId &&
+		    path.mAttributeId == attributeId) {
+			/* The attribute will be reported at the end of the window anyway. */
+			return;
+		}
+	}
+
+	if (mDirtyAttributesCount == kMaxCoalescedAttributes) {
+		ReportDirtyAttributes(0);
+	}
+
+	mDirtyAttributes[mDirtyAttributesCount++] = { endpointId, clusterId, attributeId };
+
+	/* Do not restart the running timer, so that the changes are not delayed by more than the window. */
+	if (k_timer_remaining_get(&mReportTimer) == 0) {
+		k_timer_start(&mReportTimer, K_MSEC(kReportCoalescingWindowMs), K_NO_WAIT);
+	}
+}
+
+void BridgeManager::ReportDirtyAttributes(intptr_t)
+{
+	BridgeManager &manager = Instance();
+
+	for (uint8_t i = 0; i < manager.mDirtyAttributesCount; i++) {
+		const AttributePath &path = manager.mDirtyAttributes[i];
+
+		MatterReportingAttributeChangeCallback(path.mEndpointId, path.mClusterId, path.mAttributeId);
+#ifdef CONFIG_BRIDGE_BENCHMARK
+		if (manager.mAttributeReportCallback) {
+			manager.mAttributeReportCallback(path.mEndpointId, path.mClusterId, path.mAttributeId);
+		}
+#endif
+	}
+
+	manager.mDirtyAttributesCount = 0;
+}
+
+void BridgeManager::ReportTimerTimeoutCallback(k_timer *timer)
+{
+	DeviceLayer::PlatformMgr().ScheduleWork(ReportDirtyAttributes);
+}
+
 void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, ClusterId clusterId, CommandId commandId,
 				  Nrf::Matter::BindingHandler::InvokeCommand invokeCommand)
 {
@@ -505,7 +567,7 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 
 BridgedDeviceDataProvider *BridgeManager::GetProvider(EndpointId endpoint, uint16_t &deviceType)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
+	uint16_t endpointIndex = GetDeviceIndex(endpoint);
 	if (Instance().mDevicesMap.Contains(endpointIndex)) {
 		BridgedDevicePair &bridgedDevices = Instance().mDevicesMap[endpointIndex];
 		if (bridgedDevices.mDevice) {
@@ -516,9 +578,16 @@ BridgedDeviceDataProvider *BridgeManager::GetProvider(EndpointId endpoint, uint1
 	return nullptr;
 }
 
+uint16_t BridgeManager::GetDeviceIndex(EndpointId endpoint)
+{
+	auto index = Instance().mEndpointIndexes.TryAt(endpoint);
+
+	return index ? *index : kInvalidDeviceIndex;
+}
+
 const char *BridgeManager::GetNodeLabel(EndpointId endpoint)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
+	uint16_t endpointIndex = GetDeviceIndex(endpoint);
 	if (Instance().mDevicesMap.Contains(endpointIndex)) {
 		BridgedDevicePair &bridgedDevices = Instance().mDevicesMap[endpointIndex];
 		if (bridgedDevices.mDevice) {
@@ -535,7 +604,7 @@ emberAfExternalAttributeReadCallback(EndpointId endpoint, ClusterId clusterId,
 				     const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer,
 				     uint16_t maxReadLength)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
+	uint16_t endpointIndex = Nrf::BridgeManager::Instance().GetDeviceIndex(endpoint);
 
 	if (CHIP_NO_ERROR == Nrf::BridgeManager::Instance().HandleRead(endpointIndex, clusterId, attributeMetadata,
 								       buffer, maxReadLength)) {
@@ -549,7 +618,7 @@ Protocols::InteractionModel::Status
 emberAfExternalAttributeWriteCallback(EndpointId endpoint, ClusterId clusterId,
 				      const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
+	uint16_t endpointIndex = Nrf::BridgeManager::Instance().GetDeviceIndex(endpoint);
 
 	if (CHIP_NO_ERROR ==
 	    Nrf::BridgeManager::Instance().HandleWrite(endpointIndex, clusterId, attributeMetadata, buffer)) {
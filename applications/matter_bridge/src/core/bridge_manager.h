@@ -12,6 +12,8 @@
 #include "bridged_device_data_provider.h"
 #include "matter_bridged_device.h"
 
+#include <zephyr/kernel.h>
+
 namespace Nrf
 {
 
@@ -20,6 +22,9 @@ public:
 	static constexpr uint8_t kMaxBridgedDevices = CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT;
 	static constexpr uint8_t kMaxBridgedDevicesPerProvider = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER_PER_PROVIDER;
 	static constexpr chip::EndpointId kAggregatorEndpointId = CONFIG_BRIDGE_AGGREGATOR_ENDPOINT_ID;
+	static constexpr uint16_t kInvalidDeviceIndex = UINT16_MAX;
+	static constexpr uint32_t kReportCoalescingWindowMs = CONFIG_BRIDGE_REPORT_COALESCING_WINDOW_MS;
+	static constexpr uint8_t kMaxCoalescedAttributes = CONFIG_BRIDGE_REPORT_COALESCING_MAX_ATTRIBUTES;
 
 	using LoadStoredBridgedDevicesCallback = CHIP_ERROR (*)();
 
@@ -117,6 +122,14 @@ public:
 	 */
 	const char *GetNodeLabel(chip::EndpointId endpoint);
 
+	/**
+	 * @brief Get the index of the bridged device pair stored on the specified endpoint in constant time.
+	 *
+	 * @param endpoint endpoint on which the bridged device is stored
+	 * @return index of the bridged device pair, or kInvalidDeviceIndex if endpoint not found
+	 */
+	uint16_t GetDeviceIndex(chip::EndpointId endpoint);
+
 	static CHIP_ERROR HandleRead(uint16_t index, chip::ClusterId clusterId,
 				     const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer,
 				     uint16_t maxReadLength);
@@ -127,6 +140,18 @@ public:
 	static void HandleCommand(BridgedDeviceDataProvider &dataProvider, chip::ClusterId clusterId,
 				  chip::CommandId commandId, Nrf::Matter::BindingHandler::InvokeCommand invokeCommand);
 
+#ifdef CONFIG_BRIDGE_BENCHMARK
+	using AttributeReportCallback = void (*)(chip::EndpointId endpointId, chip::ClusterId clusterId,
+						 chip::AttributeId attributeId);
+
+	/**
+	 * @brief Set the callback called when an attribute of a bridged device is marked dirty for Matter reporting.
+	 *
+	 * @param callback callback to be called, or nullptr to remove the callback
+	 */
+	void SetAttributeReportCallback(AttributeReportCallback callback) { mAttributeReportCallback = callback; }
+#endif
+
 	static BridgeManager &Instance()
 	{
 		static BridgeManager sInstance;
@@ -184,9 +209,17 @@ private:
 		BridgedDeviceDataProvider *mProvider;
 	};
 
+	struct AttributePath {
+		chip::EndpointId mEndpointId;
+		chip::ClusterId mClusterId;
+		chip::AttributeId mAttributeId;
+	};
+
 	static constexpr uint8_t kMaxDataProviders = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER;
 
-	using DeviceMap = FiniteMap<uint16_t, BridgedDevicePair, kMaxBridgedDevices>;
+	using DeviceMap = FiniteMap<uint16_t, BridgedDevicePair, kMaxBridgedDevices, true>;
+	/* Maps the endpoint ids of the bridged devices to the indexes of the pairs in DeviceMap. */
+	using EndpointIndexMap = FiniteMap<chip::EndpointId, uint8_t, kMaxBridgedDevices, true>;
 
 	/**
 	 * @brief Add pair of single bridged device and its data provider using optional index and endpoint id.
@@ -256,7 +289,26 @@ private:
 	 */
 	CHIP_ERROR CreateEndpoint(uint8_t index, uint16_t endpointId);
 
+	/**
+	 * @brief Mark the attribute dirty for Matter reporting. The attributes are collected during the report
+	 * coalescing window and marked dirty together when the window expires.
+	 *
+	 * @param endpointId endpoint id of the changed attribute
+	 * @param clusterId cluster id of the changed attribute
+	 * @param attributeId attribute id of the changed attribute
+	 */
+	void MarkAttributeDirty(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId);
+	static void ReportDirtyAttributes(intptr_t context);
+	static void ReportTimerTimeoutCallback(k_timer *timer);
+
 	DeviceMap mDevicesMap;
+	EndpointIndexMap mEndpointIndexes;
+	AttributePath mDirtyAttributes[kMaxCoalescedAttributes];
+	uint8_t mDirtyAttributesCount{ 0 };
+	k_timer mReportTimer;
+#ifdef CONFIG_BRIDGE_BENCHMARK
+	AttributeReportCallback mAttributeReportCallback{ nullptr };
+#endif
 	uint16_t mNumberOfProviders{ 0 };
 	uint8_t mDevicesIndexes[BridgeManager::kMaxBridgedDevices] = { 0 };
 	uint8_t mDevicesIndexesCounter;
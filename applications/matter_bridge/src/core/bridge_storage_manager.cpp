@@ -104,6 +104,7 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV1 &device
 }
 #endif
 
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
 template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device, uint8_t index)
 {
 	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
@@ -185,6 +186,102 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device
 
 	return true;
 }
+#endif
+
+template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV3 &device, uint8_t index)
+{
+	if (index >= kMaxBridgedDevices) {
+		return false;
+	}
+
+	return DeserializeRecord(mRecords[index], device);
+}
+
+bool BridgeStorageManager::SerializeRecord(const BridgedDevice &device, Record &record)
+{
+	RecordHeader header;
+	uint16_t counter = 0;
+	const size_t userDataSize = device.mUserData ? device.mUserDataSize : 0;
+
+	if (device.mUniqueIDLength > sizeof(device.mUniqueID) || device.mNodeLabelLength > sizeof(device.mNodeLabel) ||
+	    userDataSize > kMaxUserDataSize) {
+		return false;
+	}
+
+	header.mVersion = kCurrentVersion;
+	header.mEndpointId = device.mEndpointId;
+	header.mDeviceType = device.mDeviceType;
+	header.mUniqueIDLength = device.mUniqueIDLength;
+	header.mNodeLabelLength = device.mNodeLabelLength;
+	header.mUserDataSize = userDataSize;
+
+	/* Serialize data structure and insert it into record buffer. */
+	memcpy(record.mData, &header, sizeof(header));
+	counter += sizeof(header);
+	memcpy(record.mData + counter, device.mUniqueID, device.mUniqueIDLength);
+	counter += device.mUniqueIDLength;
+	memcpy(record.mData + counter, device.mNodeLabel, device.mNodeLabelLength);
+	counter += device.mNodeLabelLength;
+
+	if (userDataSize > 0) {
+		memcpy(record.mData + counter, device.mUserData, userDataSize);
+		counter += userDataSize;
+	}
+
+	record.mSize = counter;
+
+	return true;
+}
+
+bool BridgeStorageManager::DeserializeRecord(const Record &record, BridgedDevice &device)
+{
+	RecordHeader header;
+	uint16_t counter = 0;
+
+	/* Validate that record size is big enough to include the header. */
+	if (record.mSize < sizeof(header)) {
+		return false;
+	}
+
+	memcpy(&header, record.mData, sizeof(header));
+	counter += sizeof(header);
+
+	/* Validate the record version and that the record size matches the header. */
+	if (header.mVersion != kCurrentVersion ||
+	    record.mSize != sizeof(header) + header.mUniqueIDLength + header.mNodeLabelLength + header.mUserDataSize) {
+		return false;
+	}
+
+	if (header.mUniqueIDLength > sizeof(device.mUniqueID) || header.mNodeLabelLength > sizeof(device.mNodeLabel)) {
+		return false;
+	}
+
+	/* Deserialize data and copy it from record buffer into structure's fields. */
+	device.mEndpointId = header.mEndpointId;
+	device.mDeviceType = header.mDeviceType;
+	device.mUniqueIDLength = header.mUniqueIDLength;
+	memcpy(device.mUniqueID, record.mData + counter, device.mUniqueIDLength);
+	counter += device.mUniqueIDLength;
+	device.mNodeLabelLength = header.mNodeLabelLength;
+	memcpy(device.mNodeLabel, record.mData + counter, device.mNodeLabelLength);
+	counter += device.mNodeLabelLength;
+
+	/* Check if user prepared a buffer for reading user data. It can be nullptr if not needed. */
+	if (!device.mUserData) {
+		device.mUserDataSize = 0;
+		return true;
+	}
+
+	/* Validate that the user data is present and fits the buffer expected by the user. */
+	if (header.mUserDataSize == 0 || device.mUserDataSize < header.mUserDataSize) {
+		return false;
+	}
+
+	device.mUserDataSize = header.mUserDataSize;
+	memcpy(device.mUserData, record.mData + counter, device.mUserDataSize);
+
+	return true;
+}
 
 bool BridgeStorageManager::Init()
 {
@@ -194,13 +291,63 @@ bool BridgeStorageManager::Init()
 		return false;
 	}
 
+	LoadIndexes();
+
 	/* Perform data migration from previous data structure versions if needed. */
-	return MigrateData();
+	if (!MigrateData()) {
+		return false;
+	}
+
+	LoadRecords();
+
+	return true;
 }
 
 void BridgeStorageManager::FactoryReset()
 {
 	Nrf::GetPersistentStorage().NonSecureFactoryReset();
+
+	for (auto &record : mRecords) {
+		record.mSize = 0;
+	}
+
+	mIndexesStored = false;
+	mIndexesCount = 0;
+	mCountStored = false;
+	mCount = 0;
+}
+
+void BridgeStorageManager::LoadIndexes()
+{
+	size_t indexesCount = 0;
+
+	mCountStored = LoadDataToObject(&mBridgedDevicesCount, mCount);
+	mIndexesStored = Nrf::GetPersistentStorage().NonSecureLoad(&mBridgedDevicesIndexes, mIndexes, sizeof(mIndexes),
+								    indexesCount) == PSErrorCode::Success;
+	mIndexesCount = mIndexesStored ? indexesCount : 0;
+}
+
+void BridgeStorageManager::LoadRecords()
+{
+	for (size_t i = 0; i < mIndexesCount; i++) {
+		const uint8_t index = mIndexes[i];
+		size_t readSize = 0;
+
+		/* Skip invalid indexes and the records already stored during the migration. */
+		if (index >= kMaxBridgedDevices || mRecords[index].mSize > 0) {
+			continue;
+		}
+
+		Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
+
+		if (Nrf::GetPersistentStorage().NonSecureLoad(&id, mRecords[index].mData, sizeof(mRecords[index].mData),
+							      readSize) != PSErrorCode::Success) {
+			LOG_WRN("Failed to load bridged device %u from the storage", index);
+			readSize = 0;
+		}
+
+		mRecords[index].mSize = readSize;
+	}
 }
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
@@ -303,6 +450,44 @@ bool BridgeStorageManager::MigrateDataVersion1(uint8_t bridgedDeviceIndex)
 }
 #endif
 
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+bool BridgeStorageManager::MigrateDataVersion2(uint8_t bridgedDeviceIndex)
+{
+	BridgedDeviceV2 v2;
+	BridgedDevice device;
+
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+	bt_addr_le_t btAddr;
+
+	/* Insert Bluetooth LE address as a part of implementation specific user data. */
+	v2.mUserDataSize = sizeof(btAddr);
+	v2.mUserData = reinterpret_cast<uint8_t *>(&btAddr);
+#endif
+
+	/* Load all information from old scheme */
+	if (!LoadBridgedDevice(v2, bridgedDeviceIndex)) {
+		return false;
+	}
+
+	/* Copy all information to new scheme */
+	device.mEndpointId = v2.mEndpointId;
+	device.mDeviceType = v2.mDeviceType;
+	device.mUniqueIDLength = v2.mUniqueIDLength;
+	memcpy(device.mUniqueID, v2.mUniqueID, v2.mUniqueIDLength);
+	device.mNodeLabelLength = v2.mNodeLabelLength;
+	memcpy(device.mNodeLabel, v2.mNodeLabel, v2.mNodeLabelLength);
+	device.mUserDataSize = v2.mUserDataSize;
+	device.mUserData = v2.mUserData;
+
+	/* Store all information using new scheme */
+	if (!StoreBridgedDevice(device, bridgedDeviceIndex)) {
+		return false;
+	}
+
+	return true;
+}
+#endif
+
 bool BridgeStorageManager::MigrateData()
 {
 	/* Check if migration is needed to provide backward compatibility between releases.
@@ -351,52 +536,97 @@ bool BridgeStorageManager::MigrateData()
 				/* Migration not enabled */
 				LOG_ERR("Migration of data scheme version 1 not enabled.");
 				return false;
+#endif
+			} else if (version == 2) {
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+				if (!MigrateDataVersion2(indexes[i])) {
+					return false;
+				}
+#else
+				/* Migration not enabled */
+				LOG_ERR("Migration of data scheme version 2 not enabled.");
+				return false;
 #endif
 			}
 		}
 	}
 
+	/* Make sure the migrated data is written before the version that marks it as migrated. */
+	if (Nrf::GetPersistentStorage().NonSecureFlush() != PSErrorCode::Success) {
+		return false;
+	}
+
 	/* Store current version */
 	version = kCurrentVersion;
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&mVersion, &version, sizeof(version));
+	const PSErrorCode status =
+		Nrf::GetPersistentStorage().NonSecureStore(&mVersion, &version, sizeof(version), true);
 
 	return status == PSErrorCode::Success;
 }
 
 bool BridgeStorageManager::StoreBridgedDevicesCount(uint8_t count)
 {
+	if (mCountStored && mCount == count) {
+		return true;
+	}
+
 	const PSErrorCode status =
 		Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesCount, &count, sizeof(count));
 
-	return status == PSErrorCode::Success;
+	if (status != PSErrorCode::Success) {
+		return false;
+	}
+
+	mCount = count;
+	mCountStored = true;
+
+	return true;
 }
 
 bool BridgeStorageManager::LoadBridgedDevicesCount(uint8_t &count)
 {
-	return LoadDataToObject(&mBridgedDevicesCount, count);
+	if (!mCountStored) {
+		return false;
+	}
+
+	count = mCount;
+
+	return true;
 }
 
 bool BridgeStorageManager::StoreBridgedDevicesIndexes(uint8_t *indexes, uint8_t count)
 {
-	if (!indexes) {
+	if (!indexes || count > kMaxBridgedDevices) {
 		return false;
 	}
 
+	if (mIndexesStored && mIndexesCount == count && memcmp(mIndexes, indexes, count) == 0) {
+		return true;
+	}
+
 	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesIndexes, indexes, count);
 
-	return status == PSErrorCode::Success;
+	if (status != PSErrorCode::Success) {
+		return false;
+	}
+
+	memcpy(mIndexes, indexes, count);
+	mIndexesCount = count;
+	mIndexesStored = true;
+
+	return true;
 }
 
 bool BridgeStorageManager::LoadBridgedDevicesIndexes(uint8_t *indexes, uint8_t maxCount, size_t &count)
 {
-	if (!indexes) {
+	if (!indexes || !mIndexesStored || mIndexesCount > maxCount) {
 		return false;
 	}
 
-	const PSErrorCode status =
-		Nrf::GetPersistentStorage().NonSecureLoad(&mBridgedDevicesIndexes, indexes, maxCount, count);
+	memcpy(indexes, mIndexes, mIndexesCount);
+	count = mIndexesCount;
 
-	return status == PSErrorCode::Success;
+	return true;
 }
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
@@ -450,39 +680,27 @@ bool BridgeStorageManager::RemoveBridgedDeviceType(uint8_t bridgedDeviceIndex)
 
 bool BridgeStorageManager::StoreBridgedDevice(BridgedDevice &device, uint8_t index)
 {
-	uint8_t buffer[sizeof(BridgedDevice) + kMaxUserDataSize];
-	uint16_t counter = 0;
-	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
+	Record record;
 
-	/* Serialize data structure and insert it into buffer. */
-	memcpy(buffer, &device.mEndpointId, sizeof(device.mEndpointId));
-	counter += sizeof(device.mEndpointId);
-	memcpy(buffer + counter, &device.mDeviceType, sizeof(device.mDeviceType));
-	counter += sizeof(device.mDeviceType);
-	memcpy(buffer + counter, &device.mUniqueIDLength, sizeof(device.mUniqueIDLength));
-	counter += sizeof(device.mUniqueIDLength);
-	memcpy(buffer + counter, device.mUniqueID, device.mUniqueIDLength);
-	counter += device.mUniqueIDLength;
-	memcpy(buffer + counter, &device.mNodeLabelLength, sizeof(device.mNodeLabelLength));
-	counter += sizeof(device.mNodeLabelLength);
-	memcpy(buffer + counter, device.mNodeLabel, device.mNodeLabelLength);
-	counter += device.mNodeLabelLength;
+	if (index >= kMaxBridgedDevices || !SerializeRecord(device, record)) {
+		return false;
+	}
 
-	/* Check if there are any user data to save. mUserData can be nullptr if not needed. */
-	if (device.mUserData && device.mUserDataSize > 0) {
-		if (device.mUserDataSize > kMaxUserDataSize) {
-			return false;
-		}
+	/* Skip the write if the same record is already stored, for example when a restored device is stored again. */
+	if (record.mSize == mRecords[index].mSize && memcmp(record.mData, mRecords[index].mData, record.mSize) == 0) {
+		return true;
+	}
+
+	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
+	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&id, record.mData, record.mSize);
 
-		memcpy(buffer + counter, &device.mUserDataSize, sizeof(device.mUserDataSize));
-		counter += sizeof(device.mUserDataSize);
-		memcpy(buffer + counter, device.mUserData, device.mUserDataSize);
-		counter += device.mUserDataSize;
+	if (status != PSErrorCode::Success) {
+		return false;
 	}
 
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&id, buffer, counter);
+	mRecords[index] = record;
 
-	return status == PSErrorCode::Success;
+	return true;
 }
 
 bool BridgeStorageManager::RemoveBridgedDevice(uint8_t index)
@@ -490,6 +708,10 @@ bool BridgeStorageManager::RemoveBridgedDevice(uint8_t index)
 	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
 	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureRemove(&id);
 
+	if (index < kMaxBridgedDevices) {
+		mRecords[index].mSize = 0;
+	}
+
 	return status == PSErrorCode::Success;
 }
 
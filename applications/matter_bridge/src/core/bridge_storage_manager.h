@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "bridge_manager.h"
 #include "matter_bridged_device.h"
 #include "persistent_storage/persistent_storage.h"
 
@@ -29,6 +30,13 @@ namespace Nrf
  *			.
  *			/n/ /<BridgedDevice>/
  *		/ver/ <uint8_t>
+ *
+ * Each bridged device is stored as a single packed record, consisting of a RecordHeader followed by the unique ID,
+ * the node label and the optional user data. The header starts with the record format version, so that a record can be
+ * validated on its own.
+ *
+ * All records, the count and the indexes are loaded once in Init() and kept in RAM. The load methods are served from
+ * this copy and the store methods skip the write if the stored data does not change.
  */
 class BridgeStorageManager {
 public:
@@ -61,6 +69,7 @@ public:
 	};
 #endif
 
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
 	struct BridgedDeviceV2 {
 		uint16_t mEndpointId;
 		uint16_t mDeviceType;
@@ -71,9 +80,21 @@ public:
 		size_t mUserDataSize = 0;
 		uint8_t *mUserData = nullptr;
 	};
+#endif
+
+	struct BridgedDeviceV3 {
+		uint16_t mEndpointId;
+		uint16_t mDeviceType;
+		size_t mUniqueIDLength;
+		char mUniqueID[MatterBridgedDevice::kUniqueIDSize] = { 0 };
+		size_t mNodeLabelLength;
+		char mNodeLabel[MatterBridgedDevice::kNodeLabelSize] = { 0 };
+		size_t mUserDataSize = 0;
+		uint8_t *mUserData = nullptr;
+	};
 
-	using BridgedDevice = BridgedDeviceV2;
-	static constexpr uint8_t kCurrentVersion = 2;
+	using BridgedDevice = BridgedDeviceV3;
+	static constexpr uint8_t kCurrentVersion = 3;
 
 	static constexpr auto kMaxIndexLength = 3;
 
@@ -164,6 +185,8 @@ public:
 	 * data and mUserDataSize must be set to this data size. On success, the method overrides mUserDataSize with
 	 * the data size actually obtained from the storage.
 	 *
+	 * The current version of the record is read from the RAM copy loaded in Init(), without accessing settings.
+	 *
 	 * @param device instance of bridged device object to be filled with loaded data.
 	 * @param index index describing specific bridged device
 	 * @return true if key has been loaded successfully
@@ -192,6 +215,27 @@ public:
 	bool RemoveBridgedDevice(uint8_t bridgedDeviceIndex);
 
 private:
+	static constexpr auto kMaxBridgedDevices = BridgeManager::kMaxBridgedDevices;
+
+	struct __attribute__((packed)) RecordHeader {
+		uint8_t mVersion;
+		uint16_t mEndpointId;
+		uint16_t mDeviceType;
+		uint8_t mUniqueIDLength;
+		uint8_t mNodeLabelLength;
+		uint8_t mUserDataSize;
+	};
+
+	static_assert(kMaxUserDataSize <= UINT8_MAX, "User data size does not fit into the record header");
+
+	static constexpr size_t kMaxRecordSize = sizeof(RecordHeader) + MatterBridgedDevice::kUniqueIDSize +
+						 MatterBridgedDevice::kNodeLabelSize + kMaxUserDataSize;
+
+	struct Record {
+		uint8_t mData[kMaxRecordSize];
+		uint16_t mSize = 0;
+	};
+
 	/**
 	 * @brief Provides backward compatibility between non-compatible data scheme versions.
 	 *
@@ -231,6 +275,49 @@ private:
 	bool MigrateDataVersion1(uint8_t bridgedDeviceIndex);
 #endif
 
+#ifdef CONFIG_BRIDGE_MIGRATE_VERSION_2
+	/**
+	 * @brief Migrate bridged device data at given index.
+	 *
+	 * It migrates bridge device structure from version 2 to current one.
+	 *
+	 * @param bridgedDeviceIndex index describing specific bridged device to be removed
+	 * @return true if migration was successful
+	 * @return false an error occurred
+	 */
+	bool MigrateDataVersion2(uint8_t bridgedDeviceIndex);
+#endif
+
+	/**
+	 * @brief Load bridged devices count and indexes from settings into RAM.
+	 */
+	void LoadIndexes();
+
+	/**
+	 * @brief Load records of all bridged devices listed in the indexes from settings into RAM.
+	 */
+	void LoadRecords();
+
+	/**
+	 * @brief Serialize bridged device into a packed record.
+	 *
+	 * @param device instance of bridged device object to be serialized
+	 * @param record reference to the record object to be filled with serialized data
+	 * @return true if device has been serialized successfully
+	 * @return false an error occurred
+	 */
+	bool SerializeRecord(const BridgedDevice &device, Record &record);
+
+	/**
+	 * @brief Deserialize bridged device from a packed record.
+	 *
+	 * @param record reference to the record object containing serialized data
+	 * @param device instance of bridged device object to be filled with deserialized data
+	 * @return true if record has been deserialized successfully
+	 * @return false an error occurred
+	 */
+	bool DeserializeRecord(const Record &record, BridgedDevice &device);
+
 	/* The below methods are deprecated and used only for the migration purposes between the older scheme versions.
 	 */
 
@@ -323,6 +410,13 @@ private:
 	Nrf::PersistentStorageNode mBridgedDevice;
 	Nrf::PersistentStorageNode mVersion;
 
+	Record mRecords[kMaxBridgedDevices];
+	uint8_t mIndexes[kMaxBridgedDevices] = { 0 };
+	uint8_t mIndexesCount = 0;
+	bool mIndexesStored = false;
+	uint8_t mCount = 0;
+	bool mCountStored = false;
+
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 	/* The below fields are deprecated and used only for the migration purposes between the older scheme versions.
 	 */
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "simulated_bridge_benchmark.h"
+#include "temperature_sensor.h"
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/ConfigurationManager.h>
+#include <platform/DiagnosticDataProvider.h>
+
+#include <zephyr/logging/log.h>
+
+#include <cstdio>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+using namespace ::chip::DeviceLayer;
+
+namespace
+{
+constexpr AttributeId kAttributes[SimulatedBridgeBenchmark::kMaxAttributes] = {
+	Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id,
+	Clusters::TemperatureMeasurement::Attributes::MinMeasuredValue::Id,
+	Clusters::TemperatureMeasurement::Attributes::MaxMeasuredValue::Id,
+};
+
+/* Data provider that only forwards the updates generated by the benchmark to the Bridge Manager. */
+class BenchmarkDataProvider : public Nrf::BridgedDeviceDataProvider {
+public:
+	explicit BenchmarkDataProvider(UpdateAttributeCallback updateCallback)
+		: Nrf::BridgedDeviceDataProvider(updateCallback)
+	{
+	}
+
+	void Init() override {}
+
+	void NotifyUpdateState(ClusterId clusterId, AttributeId attributeId, void *data, size_t dataSize) override
+	{
+		if (mUpdateAttributeCallback) {
+			mUpdateAttributeCallback(*this, clusterId, attributeId, data, dataSize);
+		}
+	}
+
+	CHIP_ERROR UpdateState(ClusterId clusterId, AttributeId attributeId, uint8_t *buffer) override
+	{
+		if (clusterId == Clusters::BridgedDeviceBasicInformation::Id &&
+		    attributeId == Clusters::BridgedDeviceBasicInformation::Attributes::NodeLabel::Id) {
+			return CHIP_NO_ERROR;
+		}
+
+		return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+	}
+};
+
+intptr_t EncodeContext(uint8_t runId, uint8_t index)
+{
+	return (static_cast<intptr_t>(runId) << 8) | index;
+}
+} /* namespace */
+
+SimulatedBridgeBenchmark::SimulatedBridgeBenchmark()
+{
+	k_timer_init(&mTimer, TimerTimeoutCallback, nullptr);
+}
+
+CHIP_ERROR SimulatedBridgeBenchmark::Start(uint8_t devices, uint8_t attributes, uint32_t intervalMs)
+{
+	CHIP_ERROR err = CHIP_NO_ERROR;
+
+	VerifyOrReturnError(!mRunning, CHIP_ERROR_INCORRECT_STATE);
+	VerifyOrReturnError(devices > 0 && devices <= ArraySize(mDevices), CHIP_ERROR_INVALID_ARGUMENT);
+	VerifyOrReturnError(attributes > 0 && attributes <= kMaxAttributes, CHIP_ERROR_INVALID_ARGUMENT);
+	VerifyOrReturnError(intervalMs > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+	mAttributes = attributes;
+	mIntervalMs = intervalMs;
+	mCpuLoad = -1;
+	atomic_clear(&mGeneratedUpdates);
+	atomic_clear(&mDroppedUpdates);
+	mHandledUpdates = 0;
+	mUpdateLatencySumUs = 0;
+	mUpdateLatencyMaxUs = 0;
+	mReports = 0;
+	mReportLatencySumUs = 0;
+	mReportLatencyMaxUs = 0;
+
+	PlatformMgr().LockChipStack();
+
+	mRunId++;
+
+	for (uint8_t i = 0; i < devices; i++) {
+		err = AddDevice(mDevices[i]);
+
+		if (err != CHIP_NO_ERROR) {
+			LOG_ERR("Failed to add benchmark bridged device: %" CHIP_ERROR_FORMAT, err.Format());
+			break;
+		}
+
+		mDevicesCount++;
+	}
+
+	if (err == CHIP_NO_ERROR) {
+		Nrf::BridgeManager::Instance().SetAttributeReportCallback(HandleAttributeReport);
+		GetDiagnosticDataProvider().ResetWatermarks();
+	} else {
+		RemoveDevices();
+	}
+
+	PlatformMgr().UnlockChipStack();
+
+	ReturnErrorOnFailure(err);
+
+	SampleCpuUsage(mStartBusyCycles, mStartTotalCycles);
+	mStartTime = k_uptime_get();
+	mRunning = true;
+	k_timer_start(&mTimer, K_MSEC(intervalMs), K_MSEC(intervalMs));
+
+	LOG_INF("Benchmark started: %u devices, %u attributes, %u ms interval", devices, attributes, intervalMs);
+
+	return CHIP_NO_ERROR;
+}
+
+void SimulatedBridgeBenchmark::Stop()
+{
+	VerifyOrReturn(mRunning);
+
+	k_timer_stop(&mTimer);
+	mRunning = false;
+	mStopTime = k_uptime_get();
+
+	uint64_t busyCycles;
+	uint64_t totalCycles;
+
+	SampleCpuUsage(busyCycles, totalCycles);
+
+	if (totalCycles > mStartTotalCycles) {
+		mCpuLoad = static_cast<int8_t>((busyCycles - mStartBusyCycles) * 100 / (totalCycles - mStartTotalCycles));
+	}
+
+	PlatformMgr().LockChipStack();
+	/* Discard the updates that are still waiting in the Matter work queue. */
+	mRunId++;
+	Nrf::BridgeManager::Instance().SetAttributeReportCallback(nullptr);
+	RemoveDevices();
+	PlatformMgr().UnlockChipStack();
+
+	LOG_INF("Benchmark stopped");
+}
+
+void SimulatedBridgeBenchmark::GetStats(Stats &stats)
+{
+	PlatformMgr().LockChipStack();
+
+	stats.mDevices = mDevicesCount;
+	stats.mAttributes = mAttributes;
+	stats.mIntervalMs = mIntervalMs;
+	stats.mDurationMs = static_cast<uint32_t>((mRunning ? k_uptime_get() : mStopTime) - mStartTime);
+	stats.mGeneratedUpdates = atomic_get(&mGeneratedUpdates);
+	stats.mHandledUpdates = mHandledUpdates;
+	stats.mDroppedUpdates = atomic_get(&mDroppedUpdates);
+	stats.mUpdateLatencyAvgUs = mHandledUpdates ? mUpdateLatencySumUs * mAttributes / mHandledUpdates : 0;
+	stats.mUpdateLatencyMaxUs = mUpdateLatencyMaxUs;
+	stats.mReports = mReports;
+	stats.mReportLatencyAvgUs = mReports ? mReportLatencySumUs / mReports : 0;
+	stats.mReportLatencyMaxUs = mReportLatencyMaxUs;
+	stats.mCpuLoad = mCpuLoad;
+
+	if (mRunning) {
+		uint64_t busyCycles;
+		uint64_t totalCycles;
+
+		SampleCpuUsage(busyCycles, totalCycles);
+
+		if (totalCycles > mStartTotalCycles) {
+			stats.mCpuLoad = static_cast<int8_t>((busyCycles - mStartBusyCycles) * 100 /
+							     (totalCycles - mStartTotalCycles));
+		}
+	}
+
+	if (GetDiagnosticDataProvider().GetCurrentHeapHighWatermark(stats.mHeapHighWatermark) != CHIP_NO_ERROR) {
+		stats.mHeapHighWatermark = 0;
+	}
+
+	PlatformMgr().UnlockChipStack();
+}
+
+CHIP_ERROR SimulatedBridgeBenchmark::AddDevice(Device &device)
+{
+	char uniqueID[ConfigurationManager::kMaxUniqueIDLength];
+	char nodeLabel[Nrf::MatterBridgedDevice::kNodeLabelSize];
+
+	ConfigurationMgrImpl().GenerateUniqueId(uniqueID, sizeof(uniqueID));
+	snprintf(nodeLabel, sizeof(nodeLabel), "Benchmark %u", mDevicesCount);
+
+	auto *provider = Platform::New<BenchmarkDataProvider>(Nrf::BridgeManager::HandleUpdate);
+	VerifyOrReturnError(provider != nullptr, CHIP_ERROR_NO_MEMORY);
+
+	auto *bridgedDevice = Platform::New<TemperatureSensorDevice>(uniqueID, nodeLabel);
+	if (!bridgedDevice) {
+		Platform::Delete(provider);
+		return CHIP_ERROR_NO_MEMORY;
+	}
+
+	Nrf::MatterBridgedDevice *bridgedDevices[] = { bridgedDevice };
+	uint8_t deviceIndex[] = { 0 };
+
+	/* The Bridge Manager takes the ownership of the device and the provider, and the benchmark devices are not
+	 * stored in the persistent storage, so that they are not recovered after a reboot. */
+	ReturnErrorOnFailure(Nrf::BridgeManager::Instance().AddBridgedDevices(bridgedDevices, provider,
+									       ArraySize(bridgedDevices), deviceIndex));
+
+	device.mProvider = provider;
+	device.mEndpointId = bridgedDevice->GetEndpointId();
+	device.mGeneratedAt = 0;
+	device.mReportPendingSince = 0;
+	device.mReportPending = false;
+	device.mValue = 0;
+	atomic_clear(&device.mUpdatePending);
+
+	return CHIP_NO_ERROR;
+}
+
+void SimulatedBridgeBenchmark::RemoveDevices()
+{
+	for (uint8_t i = 0; i < mDevicesCount; i++) {
+		uint8_t index;
+
+		if (Nrf::BridgeManager::Instance().RemoveBridgedDevice(mDevices[i].mEndpointId, index) != CHIP_NO_ERROR) {
+			LOG_ERR("Failed to remove benchmark bridged device on the endpoint %u", mDevices[i].mEndpointId);
+		}
+	}
+
+	mDevicesCount = 0;
+}
+
+void SimulatedBridgeBenchmark::SampleCpuUsage(uint64_t &busyCycles, uint64_t &totalCycles)
+{
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	k_thread_runtime_stats_t stats;
+
+	if (k_thread_runtime_stats_all_get(&stats) == 0) {
+		busyCycles = stats.total_cycles;
+		totalCycles = stats.execution_cycles;
+		return;
+	}
+#endif
+	busyCycles = 0;
+	totalCycles = 0;
+}
+
+void SimulatedBridgeBenchmark::TimerTimeoutCallback(k_timer *timer)
+{
+	SimulatedBridgeBenchmark &benchmark = Instance();
+
+	for (uint8_t i = 0; i < benchmark.mDevicesCount; i++) {
+		Device &device = benchmark.mDevices[i];
+
+		atomic_add(&benchmark.mGeneratedUpdates, benchmark.mAttributes);
+
+		/* The previous update of the device is not handled yet, the Matter thread does not keep up. */
+		if (!atomic_cas(&device.mUpdatePending, 0, 1)) {
+			atomic_add(&benchmark.mDroppedUpdates, benchmark.mAttributes);
+			continue;
+		}
+
+		device.mGeneratedAt = k_cycle_get_32();
+
+		if (PlatformMgr().ScheduleWork(HandleUpdate, EncodeContext(benchmark.mRunId, i)) != CHIP_NO_ERROR) {
+			atomic_clear(&device.mUpdatePending);
+			atomic_add(&benchmark.mDroppedUpdates, benchmark.mAttributes);
+		}
+	}
+}
+
+void SimulatedBridgeBenchmark::HandleUpdate(intptr_t context)
+{
+	SimulatedBridgeBenchmark &benchmark = Instance();
+	const uint8_t runId = static_cast<uint8_t>(context >> 8);
+	const uint8_t index = static_cast<uint8_t>(context);
+
+	VerifyOrReturn(runId == benchmark.mRunId && index < benchmark.mDevicesCount);
+
+	Device &device = benchmark.mDevices[index];
+	const uint32_t generatedAt = device.mGeneratedAt;
+
+	atomic_clear(&device.mUpdatePending);
+
+	/* Emulate a measurement within the -10 to +10 Celsius degrees range with varying limits. */
+	device.mValue = (device.mValue + 1) % 2000;
+
+	int16_t values[kMaxAttributes] = { static_cast<int16_t>(device.mValue - 1000),
+					   static_cast<int16_t>(device.mValue - 2000),
+					   static_cast<int16_t>(device.mValue) };
+
+	/* Set before notifying, as the attribute may be reported immediately if the report coalescing is disabled. */
+	if (!device.mReportPending) {
+		device.mReportPending = true;
+		device.mReportPendingSince = generatedAt;
+	}
+
+	for (uint8_t i = 0; i < benchmark.mAttributes; i++) {
+		device.mProvider->NotifyUpdateState(Clusters::TemperatureMeasurement::Id, kAttributes[i], &values[i],
+						    sizeof(values[i]));
+	}
+
+	const uint32_t latencyUs = k_cyc_to_us_floor32(k_cycle_get_32() - generatedAt);
+
+	benchmark.mHandledUpdates += benchmark.mAttributes;
+	benchmark.mUpdateLatencySumUs += latencyUs;
+	benchmark.mUpdateLatencyMaxUs = MAX(benchmark.mUpdateLatencyMaxUs, latencyUs);
+}
+
+void SimulatedBridgeBenchmark::HandleAttributeReport(EndpointId endpointId, ClusterId clusterId,
+						     AttributeId attributeId)
+{
+	SimulatedBridgeBenchmark &benchmark = Instance();
+
+	for (uint8_t i = 0; i < benchmark.mDevicesCount; i++) {
+		Device &device = benchmark.mDevices[i];
+
+		if (device.mEndpointId != endpointId || !device.mReportPending) {
+			continue;
+		}
+
+		const uint32_t latencyUs = k_cyc_to_us_floor32(k_cycle_get_32() - device.mReportPendingSince);
+
+		device.mReportPending = false;
+		benchmark.mReports++;
+		benchmark.mReportLatencySumUs += latencyUs;
+		benchmark.mReportLatencyMaxUs = MAX(benchmark.mReportLatencyMaxUs, latencyUs);
+		break;
+	}
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "bridge_manager.h"
+
+#include <lib/core/CHIPError.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/**
+ * @brief Load generator that measures the performance of the Bridge Manager.
+ *
+ * The benchmark adds a number of simulated temperature sensor bridged devices that are not stored
+ * in the persistent storage, and updates a number of their attributes periodically. The following
+ * values are measured:
+ *  - update latency, from the generation of an update to its handling by the Bridge Manager,
+ *  - report latency, from the generation of an update to marking the attribute dirty for Matter reporting,
+ *  - CPU load, if the CONFIG_SCHED_THREAD_USAGE_ALL Kconfig option is enabled,
+ *  - heap high-water mark,
+ *  - updates dropped because the previous update of the device was not handled yet, or because the Matter
+ *    work queue was full.
+ */
+class SimulatedBridgeBenchmark {
+public:
+	/* Number of attributes of the temperature sensor device that can be updated. */
+	static constexpr uint8_t kMaxAttributes = 3;
+
+	struct Stats {
+		uint8_t mDevices;
+		uint8_t mAttributes;
+		uint32_t mIntervalMs;
+		uint32_t mDurationMs;
+		uint32_t mGeneratedUpdates;
+		uint32_t mHandledUpdates;
+		uint32_t mDroppedUpdates;
+		uint32_t mUpdateLatencyAvgUs;
+		uint32_t mUpdateLatencyMaxUs;
+		uint32_t mReports;
+		uint32_t mReportLatencyAvgUs;
+		uint32_t mReportLatencyMaxUs;
+		/* CPU load in percent, or -1 if not available. */
+		int8_t mCpuLoad;
+		uint64_t mHeapHighWatermark;
+	};
+
+	static SimulatedBridgeBenchmark &Instance()
+	{
+		static SimulatedBridgeBenchmark sInstance;
+		return sInstance;
+	}
+
+	/**
+	 * @brief Start the benchmark.
+	 *
+	 * @param devices number of simulated bridged devices to add.
+	 * @param attributes number of attributes updated by each device, up to kMaxAttributes.
+	 * @param intervalMs interval between two updates of each device, in milliseconds.
+	 * @return CHIP_ERROR_INCORRECT_STATE if the benchmark is already running.
+	 * @return CHIP_ERROR_INVALID_ARGUMENT if the arguments are invalid.
+	 * @return other error code if adding the bridged devices failed.
+	 * @return CHIP_NO_ERROR on success.
+	 */
+	CHIP_ERROR Start(uint8_t devices, uint8_t attributes, uint32_t intervalMs);
+
+	/**
+	 * @brief Stop the benchmark and remove its bridged devices.
+	 *
+	 * The statistics are kept until the next benchmark is started.
+	 */
+	void Stop();
+
+	bool IsRunning() const { return mRunning; }
+
+	/**
+	 * @brief Get the statistics of the current or last benchmark.
+	 */
+	void GetStats(Stats &stats);
+
+private:
+	struct Device {
+		Nrf::BridgedDeviceDataProvider *mProvider;
+		chip::EndpointId mEndpointId;
+		/* Cycle counter value at the generation of the update that is not handled yet. */
+		uint32_t mGeneratedAt;
+		/* Cycle counter value at the generation of the oldest update that is not reported yet. */
+		uint32_t mReportPendingSince;
+		bool mReportPending;
+		atomic_t mUpdatePending;
+		int16_t mValue;
+	};
+
+	SimulatedBridgeBenchmark();
+
+	static void TimerTimeoutCallback(k_timer *timer);
+	static void HandleUpdate(intptr_t context);
+	static void HandleAttributeReport(chip::EndpointId endpointId, chip::ClusterId clusterId,
+					  chip::AttributeId attributeId);
+
+	CHIP_ERROR AddDevice(Device &device);
+	void RemoveDevices();
+	void SampleCpuUsage(uint64_t &busyCycles, uint64_t &totalCycles);
+
+	Device mDevices[Nrf::BridgeManager::kMaxBridgedDevices];
+	uint8_t mDevicesCount = 0;
+	uint8_t mAttributes = 0;
+	uint32_t mIntervalMs = 0;
+	/* Identifier of the benchmark run, used to discard the updates scheduled by a previous run. */
+	uint8_t mRunId = 0;
+	bool mRunning = false;
+	k_timer mTimer;
+
+	int64_t mStartTime = 0;
+	int64_t mStopTime = 0;
+	uint64_t mStartBusyCycles = 0;
+	uint64_t mStartTotalCycles = 0;
+	int8_t mCpuLoad = -1;
+	atomic_t mGeneratedUpdates = ATOMIC_INIT(0);
+	atomic_t mDroppedUpdates = ATOMIC_INIT(0);
+	uint32_t mHandledUpdates = 0;
+	uint64_t mUpdateLatencySumUs = 0;
+	uint32_t mUpdateLatencyMaxUs = 0;
+	uint32_t mReports = 0;
+	uint64_t mReportLatencySumUs = 0;
+	uint32_t mReportLatencyMaxUs = 0;
+};
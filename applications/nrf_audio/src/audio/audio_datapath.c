@@ -26,6 +26,7 @@
 #include "streamctrl.h"
 #include "sd_card_playback.h"
 #include "audio_clock.h"
+#include "audio_datapath_telemetry.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
@@ -93,6 +94,19 @@ LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
 /* How often to print under-run warning */
 #define LOG_INTERVAL_BLKS 5000
 
+/* Worst-case end-to-end latency, excluding the presentation delay: one frame of capture,
+ * encoding, the just-in-time lead time to the controller, and the ISO transport latency.
+ */
+#define LATENCY_BUDGET_NO_PRES_DLY_US                                                              \
+	(CONFIG_AUDIO_FRAME_DURATION_US + LC3_ENC_TIME_US + CONFIG_NRF_AUDIO_TX_TGT_LEAD_TIME_US +  \
+	 (CONFIG_BT_AUDIO_MAX_TRANSPORT_LATENCY_MS * USEC_PER_MSEC))
+
+#if (CONFIG_AUDIO_LATENCY_TARGET_US > 0)
+BUILD_ASSERT((LATENCY_BUDGET_NO_PRES_DLY_US + CONFIG_BT_AUDIO_PRESENTATION_DELAY_US) <=
+		     CONFIG_AUDIO_LATENCY_TARGET_US,
+	     "Latency budget exceeds CONFIG_AUDIO_LATENCY_TARGET_US");
+#endif /* (CONFIG_AUDIO_LATENCY_TARGET_US > 0) */
+
 NET_BUF_POOL_FIXED_DEFINE(pool_i2s_rx, FIFO_NUM_BLKS / CONFIG_FIFO_FRAME_SPLIT_NUM,
 			  (BLK_MULTI_CHAN_SIZE_OCTETS * CONFIG_FIFO_FRAME_SPLIT_NUM),
 			  sizeof(struct audio_metadata), NULL);
@@ -198,9 +212,13 @@ static struct audio_metadata i2s_meta = {.data_coding = PCM,
 					 .bad_data = 0};
 
 static bool tone_active;
+#if defined(CONFIG_TONE_OSC)
+static struct tone_osc test_tone_osc;
+#else
 /* Buffer which can hold max 1 period test tone at 100 Hz */
 static uint16_t test_tone_buf[CONFIG_AUDIO_SAMPLE_RATE_HZ / 100];
 static size_t test_tone_size;
+#endif /* CONFIG_TONE_OSC */
 
 /* Upon first received audio frame, the delta will be invalid (as there is no
  * previous value to compare it to). Hence, this function only prints LOG_ERR
@@ -314,6 +332,8 @@ static inline void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 			return;
 		}
 
+		audio_datapath_telemetry_record(AUDIO_DATAPATH_TELEMETRY_DRIFT_FREQ_ADJ, freq_adj);
+
 		drift_comp_state_set(DRIFT_STATE_OFFSET);
 
 		break;
@@ -338,6 +358,8 @@ static inline void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 			return;
 		}
 
+		audio_datapath_telemetry_record(AUDIO_DATAPATH_TELEMETRY_DRIFT_FREQ_ADJ, freq_adj);
+
 		if ((err_us < DRIFT_ERR_THRESH_LOCK) && (err_us > -DRIFT_ERR_THRESH_LOCK)) {
 			drift_comp_state_set(DRIFT_STATE_LOCKED);
 		}
@@ -364,6 +386,8 @@ static inline void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 			return;
 		}
 
+		audio_datapath_telemetry_record(AUDIO_DATAPATH_TELEMETRY_DRIFT_FREQ_ADJ, freq_adj);
+
 		if ((err_us > DRIFT_ERR_THRESH_UNLOCK) || (err_us < -DRIFT_ERR_THRESH_UNLOCK)) {
 			drift_comp_state_set(DRIFT_STATE_INIT);
 		}
@@ -426,6 +450,9 @@ static void audio_datapath_presentation_compensation(uint32_t recv_frame_ts_us,
 		ctrl_blk.pres_comp.pres_delay_us - (recv_frame_ts_us - sdu_ref_us);
 	int32_t pres_adj_us = 0;
 
+	audio_datapath_telemetry_record(AUDIO_DATAPATH_TELEMETRY_PRES_ERR_US,
+					wanted_pres_dly_us - ctrl_blk.current_pres_dly_us);
+
 	switch (ctrl_blk.pres_comp.state) {
 	case PRES_STATE_INIT: {
 		ctrl_blk.pres_comp.ctr = 0;
@@ -503,6 +530,11 @@ static void audio_datapath_presentation_compensation(uint32_t recv_frame_ts_us,
 		LOG_WRN("Requested presentation delay out of range: pres_adj_us=%d", pres_adj_us);
 	}
 
+	if (pres_adj_blks != 0) {
+		audio_datapath_telemetry_record(AUDIO_DATAPATH_TELEMETRY_PRES_ADJ_BLKS,
+						pres_adj_blks);
+	}
+
 	if (pres_adj_blks > 0) {
 		LOG_DBG("Presentation delay inserted: pres_adj_blks=%d", pres_adj_blks);
 
@@ -532,7 +564,9 @@ static void audio_datapath_presentation_compensation(uint32_t recv_frame_ts_us,
 static void tone_stop_worker(struct k_work *work)
 {
 	tone_active = false;
+#if !defined(CONFIG_TONE_OSC)
 	memset(test_tone_buf, 0, sizeof(test_tone_buf));
+#endif /* CONFIG_TONE_OSC */
 	LOG_DBG("Tone stopped");
 }
 
@@ -554,8 +588,12 @@ int audio_datapath_tone_play(uint16_t freq, uint16_t dur_ms, float amplitude)
 	}
 
 	if (IS_ENABLED(CONFIG_AUDIO_TEST_TONE)) {
+#if defined(CONFIG_TONE_OSC)
+		ret = tone_osc_init(&test_tone_osc, freq, CONFIG_AUDIO_SAMPLE_RATE_HZ, amplitude);
+#else
 		ret = tone_gen(test_tone_buf, &test_tone_size, freq, CONFIG_AUDIO_SAMPLE_RATE_HZ,
 			       amplitude);
+#endif /* CONFIG_TONE_OSC */
 		if (ret) {
 			return ret;
 		}
@@ -583,12 +621,20 @@ void audio_datapath_tone_stop(void)
 static void tone_mix(uint8_t *tx_buf)
 {
 	int ret;
-	int8_t tone_buf_continuous[BLK_MONO_SIZE_OCTETS];
+	int8_t __aligned(sizeof(uint32_t)) tone_buf_continuous[BLK_MONO_SIZE_OCTETS];
+
+#if defined(CONFIG_TONE_OSC)
+	/* The oscillator keeps its phase, so only the samples for this block are generated */
+	ret = tone_osc_gen(&test_tone_osc, tone_buf_continuous, BLK_MONO_NUM_SAMPS,
+			   CONFIG_AUDIO_BIT_DEPTH_BITS);
+	ERR_CHK(ret);
+#else
 	static uint32_t finite_pos;
 
 	ret = contin_array_create(tone_buf_continuous, BLK_MONO_SIZE_OCTETS, test_tone_buf,
 				  test_tone_size, &finite_pos);
 	ERR_CHK(ret);
+#endif /* CONFIG_TONE_OSC */
 
 	ret = pcm_mix(tx_buf, BLK_MULTI_CHAN_SIZE_OCTETS, tone_buf_continuous, BLK_MONO_SIZE_OCTETS,
 		      B_MONO_INTO_A_STEREO_L);
@@ -652,6 +698,44 @@ static void alt_buffer_free_both(void)
 	alt.buf_1_in_use = false;
 }
 
+/* Timestamp of the previous I2S block complete, 0 until the first block after start */
+static uint32_t prev_blk_complete_ts_us;
+
+/**
+ * @brief	Record the largest I2S block interval deviation seen within each frame.
+ *
+ * @note	Recording every block would fill the telemetry buffer with jitter samples only,
+ *		so one record is made per NUM_BLKS_IN_FRAME blocks.
+ *
+ * @param	frame_start_ts_us	I2S frame start timestamp.
+ */
+static void i2s_jitter_record(uint32_t frame_start_ts_us)
+{
+	static int32_t jitter_max_us;
+	static uint32_t num_blks;
+
+	if (prev_blk_complete_ts_us == 0) {
+		jitter_max_us = 0;
+		num_blks = 0;
+	} else {
+		int32_t jitter_us =
+			(int32_t)(frame_start_ts_us - prev_blk_complete_ts_us) - BLK_PERIOD_US;
+
+		if (abs(jitter_us) > abs(jitter_max_us)) {
+			jitter_max_us = jitter_us;
+		}
+
+		if (++num_blks == NUM_BLKS_IN_FRAME) {
+			audio_datapath_telemetry_record(AUDIO_DATAPATH_TELEMETRY_I2S_JITTER_US,
+							jitter_max_us);
+			jitter_max_us = 0;
+			num_blks = 0;
+		}
+	}
+
+	prev_blk_complete_ts_us = frame_start_ts_us;
+}
+
 /*
  * This handler function is called every time I2S needs new buffers for
  * TX and RX data.
@@ -674,6 +758,10 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 
 	num_calls++;
 
+	if (IS_ENABLED(CONFIG_AUDIO_DATAPATH_TELEMETRY)) {
+		i2s_jitter_record(frame_start_ts_us);
+	}
+
 	alt_buffer_free(tx_buf_released);
 
 	/*** Presentation delay measurement ***/
@@ -847,6 +935,8 @@ static void audio_datapath_i2s_start(void)
 				   .fifo[ctrl_blk.out.cons_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS];
 	}
 
+	prev_blk_complete_ts_us = 0;
+
 	/* Start I2S */
 	audio_i2s_start(tx_buf_0, rx_buf_0);
 	audio_i2s_set_next_buf(tx_buf_1, rx_buf_1);
@@ -965,6 +1055,12 @@ int audio_datapath_pres_delay_us_set(uint32_t delay_us)
 
 	LOG_DBG("Presentation delay set to %d us", delay_us);
 
+	if ((CONFIG_AUDIO_LATENCY_TARGET_US > 0) &&
+	    ((LATENCY_BUDGET_NO_PRES_DLY_US + delay_us) > CONFIG_AUDIO_LATENCY_TARGET_US)) {
+		LOG_WRN("Latency budget %d us exceeds target %d us",
+			LATENCY_BUDGET_NO_PRES_DLY_US + delay_us, CONFIG_AUDIO_LATENCY_TARGET_US);
+	}
+
 	return 0;
 }
 
@@ -1098,6 +1194,8 @@ void audio_datapath_stream_out(struct net_buf *audio_frame_in)
 	/*** Add audio data to FIFO buffer ***/
 	uint32_t num_blks_in_fifo = filled_blocks_get();
 
+	audio_datapath_telemetry_record(AUDIO_DATAPATH_TELEMETRY_FIFO_FILL_BLKS, num_blks_in_fifo);
+
 	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
 		LOG_WRN("Output audio stream overrun - Discarding audio frame");
 
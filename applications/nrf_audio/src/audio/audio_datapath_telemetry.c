@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "audio_datapath_telemetry.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+#include <nrf_profiler.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(audio_datapath_telemetry, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
+
+#define TELEMETRY_NUM_RECORDS CONFIG_AUDIO_DATAPATH_TELEMETRY_NUM_RECORDS
+
+struct telemetry_record {
+	uint32_t timestamp_us;
+	int32_t value;
+	enum audio_datapath_telemetry_type type: 8;
+};
+
+struct telemetry_stats {
+	uint32_t count;
+	int32_t min;
+	int32_t max;
+	int64_t sum;
+};
+
+static const char *const telemetry_type_names[] = {
+	"pres_err_us", "i2s_jitter_us", "fifo_fill_blks", "drift_freq_adj", "pres_adj_blks",
+};
+
+BUILD_ASSERT(ARRAY_SIZE(telemetry_type_names) == AUDIO_DATAPATH_TELEMETRY_TYPE_NUM);
+
+static struct {
+	struct telemetry_record records[TELEMETRY_NUM_RECORDS];
+	/* Total number of records written since last clear */
+	uint32_t num_written;
+	struct telemetry_stats stats[AUDIO_DATAPATH_TELEMETRY_TYPE_NUM];
+} telemetry;
+
+static struct k_spinlock telemetry_lock;
+
+#if defined(CONFIG_NRF_PROFILER)
+static uint16_t profiler_event_id;
+
+static int telemetry_profiler_init(void)
+{
+	static const char *const arg_names[] = {"type", "value"};
+	static const enum nrf_profiler_arg arg_types[] = {NRF_PROFILER_ARG_U8,
+							  NRF_PROFILER_ARG_S32};
+	int ret;
+
+	ret = nrf_profiler_init();
+	if (ret) {
+		LOG_ERR("Failed to initialize nRF Profiler: %d", ret);
+		return ret;
+	}
+
+	profiler_event_id = nrf_profiler_register_event_type("audio_telemetry", arg_names,
+							     arg_types, ARRAY_SIZE(arg_types));
+
+	return 0;
+}
+
+SYS_INIT(telemetry_profiler_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+static void telemetry_profiler_send(enum audio_datapath_telemetry_type type, int32_t value)
+{
+	struct log_event_buf buf;
+
+	if (!is_profiling_enabled(profiler_event_id)) {
+		return;
+	}
+
+	nrf_profiler_log_start(&buf);
+	nrf_profiler_log_encode_uint8(&buf, type);
+	nrf_profiler_log_encode_int32(&buf, value);
+	nrf_profiler_log_send(&buf, profiler_event_id);
+}
+#endif /* CONFIG_NRF_PROFILER */
+
+void audio_datapath_telemetry_record(enum audio_datapath_telemetry_type type, int32_t value)
+{
+	if (type >= AUDIO_DATAPATH_TELEMETRY_TYPE_NUM) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&telemetry_lock);
+	struct telemetry_record *record =
+		&telemetry.records[telemetry.num_written % TELEMETRY_NUM_RECORDS];
+	struct telemetry_stats *stats = &telemetry.stats[type];
+
+	record->timestamp_us = k_cyc_to_us_floor32(k_cycle_get_32());
+	record->value = value;
+	record->type = type;
+	telemetry.num_written++;
+
+	if (stats->count == 0) {
+		stats->min = value;
+		stats->max = value;
+	} else {
+		stats->min = MIN(stats->min, value);
+		stats->max = MAX(stats->max, value);
+	}
+
+	stats->count++;
+	stats->sum += value;
+
+	k_spin_unlock(&telemetry_lock, key);
+
+#if defined(CONFIG_NRF_PROFILER)
+	telemetry_profiler_send(type, value);
+#endif /* CONFIG_NRF_PROFILER */
+}
+
+void audio_datapath_telemetry_clear(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&telemetry_lock);
+
+	memset(&telemetry, 0, sizeof(telemetry));
+
+	k_spin_unlock(&telemetry_lock, key);
+}
+
+static int cmd_telemetry_stats(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct telemetry_stats stats[AUDIO_DATAPATH_TELEMETRY_TYPE_NUM];
+	k_spinlock_key_t key = k_spin_lock(&telemetry_lock);
+
+	memcpy(stats, telemetry.stats, sizeof(stats));
+
+	k_spin_unlock(&telemetry_lock, key);
+
+	for (int i = 0; i < AUDIO_DATAPATH_TELEMETRY_TYPE_NUM; i++) {
+		if (stats[i].count == 0) {
+			shell_print(shell, "%-16s count: 0", telemetry_type_names[i]);
+			continue;
+		}
+
+		shell_print(shell, "%-16s count: %u min: %d max: %d avg: %d",
+			    telemetry_type_names[i], stats[i].count, stats[i].min, stats[i].max,
+			    (int32_t)(stats[i].sum / (int64_t)stats[i].count));
+	}
+
+	return 0;
+}
+
+static int cmd_telemetry_dump(const struct shell *shell, size_t argc, const char **argv)
+{
+	uint32_t num_requested = TELEMETRY_NUM_RECORDS;
+
+	if (argc > 1) {
+		num_requested = strtoul(argv[1], NULL, 10);
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&telemetry_lock);
+	uint32_t num_written = telemetry.num_written;
+
+	k_spin_unlock(&telemetry_lock, key);
+
+	uint32_t num_available = MIN(num_written, TELEMETRY_NUM_RECORDS);
+
+	num_requested = MIN(num_requested, num_available);
+
+	/* Records are printed oldest first. New records may overwrite the oldest ones while
+	 * printing, so each record is copied out under the lock.
+	 */
+	for (uint32_t i = num_written - num_requested; i < num_written; i++) {
+		struct telemetry_record record;
+
+		key = k_spin_lock(&telemetry_lock);
+		record = telemetry.records[i % TELEMETRY_NUM_RECORDS];
+		k_spin_unlock(&telemetry_lock, key);
+
+		shell_print(shell, "%10u %-16s %d", record.timestamp_us,
+			    telemetry_type_names[record.type], record.value);
+	}
+
+	return 0;
+}
+
+static int cmd_telemetry_clear(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	audio_datapath_telemetry_clear();
+	shell_print(shell, "Audio datapath telemetry cleared");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(telemetry_cmd,
+			       SHELL_COND_CMD(CONFIG_SHELL, stats, NULL,
+					      "Print min, max, and average per record type",
+					      cmd_telemetry_stats),
+			       SHELL_COND_CMD_ARG(CONFIG_SHELL, dump, NULL,
+						  "Print the latest records, oldest first. "
+						  "Optional argument: number of records",
+						  cmd_telemetry_dump, 1, 1),
+			       SHELL_COND_CMD(CONFIG_SHELL, clear, NULL,
+					      "Clear all records and statistics",
+					      cmd_telemetry_clear),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(audio_telemetry, &telemetry_cmd, "Audio datapath telemetry commands", NULL);
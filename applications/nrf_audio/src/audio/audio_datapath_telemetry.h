@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ * @defgroup audio_app_datapath_telemetry Audio Datapath Telemetry
+ * @{
+ * @brief Latency and jitter telemetry for the audio datapath.
+ *
+ * This module keeps the most recent presentation errors, I2S timing jitter, output FIFO fill
+ * levels, and compensation actions of the audio datapath in a ring buffer, together with
+ * running statistics. The data can be read through the shell and is also sent as
+ * nRF Profiler events when the nRF Profiler is enabled.
+ */
+
+#ifndef _AUDIO_DATAPATH_TELEMETRY_H_
+#define _AUDIO_DATAPATH_TELEMETRY_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Telemetry record types.
+ */
+enum audio_datapath_telemetry_type {
+	/** Per-frame presentation delay error [us]. */
+	AUDIO_DATAPATH_TELEMETRY_PRES_ERR_US,
+	/** Largest deviation of the I2S block-complete interval from the block period within
+	 *  one frame [us].
+	 */
+	AUDIO_DATAPATH_TELEMETRY_I2S_JITTER_US,
+	/** Number of filled blocks in the output FIFO when a frame is added. */
+	AUDIO_DATAPATH_TELEMETRY_FIFO_FILL_BLKS,
+	/** Audio clock frequency adjustment applied by drift compensation. */
+	AUDIO_DATAPATH_TELEMETRY_DRIFT_FREQ_ADJ,
+	/** Number of blocks inserted (positive) or removed (negative) by presentation
+	 *  compensation.
+	 */
+	AUDIO_DATAPATH_TELEMETRY_PRES_ADJ_BLKS,
+	AUDIO_DATAPATH_TELEMETRY_TYPE_NUM,
+};
+
+#if defined(CONFIG_AUDIO_DATAPATH_TELEMETRY)
+/**
+ * @brief Add a telemetry record.
+ *
+ * @note Can be called from interrupt context.
+ *
+ * @param	type	Record type.
+ * @param	value	Record value.
+ */
+void audio_datapath_telemetry_record(enum audio_datapath_telemetry_type type, int32_t value);
+
+/**
+ * @brief Clear all telemetry records and statistics.
+ */
+void audio_datapath_telemetry_clear(void);
+#else
+static inline void audio_datapath_telemetry_record(enum audio_datapath_telemetry_type type,
+						   int32_t value)
+{
+}
+
+static inline void audio_datapath_telemetry_clear(void)
+{
+}
+#endif /* CONFIG_AUDIO_DATAPATH_TELEMETRY */
+
+/**
+ * @}
+ */
+
+#endif /* _AUDIO_DATAPATH_TELEMETRY_H_ */
@@ -67,10 +67,11 @@ static uint8_t sync_stream_cnt;
 
 static struct bt_audio_codec_cap codec_cap = BT_AUDIO_CODEC_CAP_LC3(
 	BT_AUDIO_CODEC_CAPABILIY_FREQ,
-	(BT_AUDIO_CODEC_CAP_DURATION_10 | BT_AUDIO_CODEC_CAP_DURATION_PREFER_10),
+	LE_AUDIO_CODEC_CAP_DURATION,
 	BT_AUDIO_CODEC_CAP_CHAN_COUNT_SUPPORT(1),
-	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MIN, 10000),
-	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MAX, 10000), 1u, BT_AUDIO_CONTEXT_TYPE_ANY);
+	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MIN, CONFIG_AUDIO_FRAME_DURATION_US),
+	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MAX, CONFIG_AUDIO_FRAME_DURATION_US),
+	1u, BT_AUDIO_CONTEXT_TYPE_ANY);
 
 static struct bt_pacs_cap capabilities = {
 	.codec_cap = &codec_cap,
@@ -42,19 +42,30 @@
 #error No sample rate supported
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER */
 
+#if (CONFIG_AUDIO_FRAME_DURATION_US == 7500)
+#define LE_AUDIO_CODEC_CFG_DURATION BT_AUDIO_CODEC_CFG_DURATION_7_5
+#define LE_AUDIO_CODEC_CAP_DURATION                                                                \
+	(BT_AUDIO_CODEC_CAP_DURATION_7_5 | BT_AUDIO_CODEC_CAP_DURATION_PREFER_7_5)
+#else
+#define LE_AUDIO_CODEC_CFG_DURATION BT_AUDIO_CODEC_CFG_DURATION_10
+#define LE_AUDIO_CODEC_CAP_DURATION                                                                \
+	(BT_AUDIO_CODEC_CAP_DURATION_10 | BT_AUDIO_CODEC_CAP_DURATION_PREFER_10)
+#endif /* (CONFIG_AUDIO_FRAME_DURATION_US == 7500) */
+
 /** Configure LC3 codec preset with customizable parameters for LE Audio streams
  *  using location, stream context, and bitrate parameters.
  */
 #define BT_BAP_LC3_PRESET_CONFIGURABLE(_loc, _stream_context, _bitrate)                            \
-	BT_BAP_LC3_PRESET(BT_AUDIO_CODEC_LC3_CONFIG(CONFIG_BT_AUDIO_PREF_SINK_SAMPLE_RATE_VALUE,   \
-						    BT_AUDIO_CODEC_CFG_DURATION_10, _loc,          \
-						    LE_AUDIO_SDU_SIZE_OCTETS(_bitrate, 10000), 1,  \
-						    _stream_context),                              \
-			  BT_BAP_QOS_CFG_UNFRAMED(10000u,                                          \
-						  LE_AUDIO_SDU_SIZE_OCTETS(_bitrate, 10000),       \
-						  CONFIG_BT_AUDIO_RETRANSMITS,                     \
-						  CONFIG_BT_AUDIO_MAX_TRANSPORT_LATENCY_MS,        \
-						  CONFIG_BT_AUDIO_PRESENTATION_DELAY_US))
+	BT_BAP_LC3_PRESET(                                                                         \
+		BT_AUDIO_CODEC_LC3_CONFIG(                                                         \
+			CONFIG_BT_AUDIO_PREF_SINK_SAMPLE_RATE_VALUE, LE_AUDIO_CODEC_CFG_DURATION,  \
+			_loc, LE_AUDIO_SDU_SIZE_OCTETS(_bitrate, CONFIG_AUDIO_FRAME_DURATION_US),  \
+			1, _stream_context),                                                       \
+		BT_BAP_QOS_CFG_UNFRAMED(                                                           \
+			CONFIG_AUDIO_FRAME_DURATION_US,                                            \
+			LE_AUDIO_SDU_SIZE_OCTETS(_bitrate, CONFIG_AUDIO_FRAME_DURATION_US),        \
+			CONFIG_BT_AUDIO_RETRANSMITS, CONFIG_BT_AUDIO_MAX_TRANSPORT_LATENCY_MS,     \
+			CONFIG_BT_AUDIO_PRESENTATION_DELAY_US))
 
 /**
  * @brief Callback for receiving Bluetooth LE Audio data.
@@ -118,19 +118,21 @@ struct bt_csip_set_member_register_param csip_param = {
 #if defined(CONFIG_BT_AUDIO_RX)
 static struct bt_audio_codec_cap lc3_codec_sink = BT_AUDIO_CODEC_CAP_LC3(
 	BT_AUDIO_CODEC_CAPABILIY_FREQ,
-	(BT_AUDIO_CODEC_CAP_DURATION_10 | BT_AUDIO_CODEC_CAP_DURATION_PREFER_10),
+	LE_AUDIO_CODEC_CAP_DURATION,
 	BT_AUDIO_CODEC_CAP_CHAN_COUNT_SUPPORT(1),
-	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MIN, 10000),
-	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MAX, 10000), 1u, AVAILABLE_SINK_CONTEXT);
+	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MIN, CONFIG_AUDIO_FRAME_DURATION_US),
+	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MAX, CONFIG_AUDIO_FRAME_DURATION_US),
+	1u, AVAILABLE_SINK_CONTEXT);
 #endif /* (CONFIG_BT_AUDIO_RX) */
 
 #if defined(CONFIG_BT_AUDIO_TX)
 static struct bt_audio_codec_cap lc3_codec_source = BT_AUDIO_CODEC_CAP_LC3(
 	BT_AUDIO_CODEC_CAPABILIY_FREQ,
-	(BT_AUDIO_CODEC_CAP_DURATION_10 | BT_AUDIO_CODEC_CAP_DURATION_PREFER_10),
+	LE_AUDIO_CODEC_CAP_DURATION,
 	BT_AUDIO_CODEC_CAP_CHAN_COUNT_SUPPORT(1),
-	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MIN, 10000),
-	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MAX, 10000), 1u, AVAILABLE_SOURCE_CONTEXT);
+	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MIN, CONFIG_AUDIO_FRAME_DURATION_US),
+	LE_AUDIO_SDU_SIZE_OCTETS(CONFIG_LC3_BITRATE_MAX, CONFIG_AUDIO_FRAME_DURATION_US),
+	1u, AVAILABLE_SOURCE_CONTEXT);
 #endif /* (CONFIG_BT_AUDIO_TX) */
 
 static enum bt_audio_dir caps_dirs[] = {
@@ -7,11 +7,127 @@
 #include "lc3_file.h"
 #include "sd_card.h"
 
+#include <string.h>
+#include <zephyr/kernel.h>
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sd_card_lc3_file, CONFIG_MODULE_SD_CARD_LC3_FILE_LOG_LEVEL);
 
 #define LC3_FILE_ID 0xCC1C
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+#define READ_AHEAD_SECTOR_SIZE 512
+#define READ_AHEAD_HALF_SIZE   CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_SIZE
+#define READ_AHEAD_BUF_SIZE    (2 * READ_AHEAD_HALF_SIZE)
+
+BUILD_ASSERT((READ_AHEAD_HALF_SIZE % READ_AHEAD_SECTOR_SIZE) == 0,
+	     "Read-ahead size must be a multiple of the SD card sector size");
+
+K_MEM_SLAB_DEFINE_STATIC(read_ahead_slab, READ_AHEAD_BUF_SIZE,
+			 CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_NUM_BUFFERS, 4);
+
+/**
+ * @brief Refill every half of the double buffer that has been fully consumed.
+ *
+ * @details The file offset is used as the write position, so after the first (short) read that
+ *          follows the LC3 header, all reads start on a sector boundary and cover whole halves.
+ */
+static int read_ahead_fill(struct lc3_file_ctx *file)
+{
+	int ret;
+
+	while (!file->read_ahead_eof) {
+		uint32_t offset = file->read_ahead_head % READ_AHEAD_HALF_SIZE;
+		size_t size = READ_AHEAD_HALF_SIZE - offset;
+
+		if ((file->read_ahead_head + size - file->read_ahead_tail) > READ_AHEAD_BUF_SIZE) {
+			/* Next half still holds unread data */
+			break;
+		}
+
+		size_t requested = size;
+		uint8_t *dst = file->read_ahead_buf +
+			       (file->read_ahead_head % READ_AHEAD_BUF_SIZE);
+
+		ret = sd_card_read((char *)dst, &size, &file->file_object);
+		if (ret) {
+			LOG_ERR("Failed to read ahead: %d", ret);
+			return ret;
+		}
+
+		file->read_ahead_head += size;
+
+		if (size < requested) {
+			file->read_ahead_eof = true;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Copy up to size bytes out of the double buffer.
+ *
+ * @return Number of bytes copied.
+ */
+static size_t read_ahead_copy(struct lc3_file_ctx *file, uint8_t *dst, size_t size)
+{
+	size_t available = file->read_ahead_head - file->read_ahead_tail;
+	size_t copied = 0;
+
+	size = MIN(size, available);
+
+	while (copied < size) {
+		uint32_t offset = file->read_ahead_tail % READ_AHEAD_BUF_SIZE;
+		size_t chunk = MIN(size - copied, READ_AHEAD_BUF_SIZE - offset);
+
+		memcpy(&dst[copied], &file->read_ahead_buf[offset], chunk);
+		copied += chunk;
+		file->read_ahead_tail += chunk;
+	}
+
+	return copied;
+}
+
+static int lc3_file_frame_get_read_ahead(struct lc3_file_ctx *file, uint8_t *buffer,
+					 size_t buffer_size)
+{
+	int ret;
+
+	ret = read_ahead_fill(file);
+	if (ret) {
+		return ret;
+	}
+
+	/* Read frame header */
+	uint16_t frame_header;
+
+	if (read_ahead_copy(file, (uint8_t *)&frame_header, sizeof(frame_header)) !=
+		    sizeof(frame_header) ||
+	    (frame_header == 0)) {
+		LOG_DBG("No more frames to read");
+		return -ENODATA;
+	}
+
+	LOG_DBG("Size of frame is %d", frame_header);
+
+	if (buffer_size < frame_header) {
+		LOG_ERR("Buffer size too small: %d < %d", buffer_size, frame_header);
+		return -ENOMEM;
+	}
+
+	/* Read frame data */
+	size_t frame_size = read_ahead_copy(file, buffer, frame_header);
+
+	if (frame_size != frame_header) {
+		LOG_ERR("Frame size mismatch: %d != %d", frame_size, frame_header);
+		return -EIO;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD */
+
 static void lc3_header_print(struct lc3_file_header *header)
 {
 	if (header == NULL) {
@@ -49,6 +165,12 @@ int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	if (file->read_ahead_buf != NULL) {
+		return lc3_file_frame_get_read_ahead(file, buffer, buffer_size);
+	}
+#endif /* CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD */
+
 	/* Read frame header */
 	uint16_t frame_header;
 	size_t frame_header_size = sizeof(frame_header);
@@ -104,6 +226,10 @@ int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 		return ret;
 	}
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	file->read_ahead_buf = NULL;
+#endif /* CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD */
+
 	/* Read LC3 header and store in struct */
 	ret = sd_card_read((char *)&file->lc3_header, &size, &file->file_object);
 	if (ret) {
@@ -119,6 +245,19 @@ int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	ret = k_mem_slab_alloc(&read_ahead_slab, (void **)&file->read_ahead_buf, K_NO_WAIT);
+	if (ret) {
+		LOG_DBG("No read-ahead buffer available, reading frames directly");
+		file->read_ahead_buf = NULL;
+	}
+
+	/* Buffered data is tracked by file offset, starting right after the header */
+	file->read_ahead_head = size;
+	file->read_ahead_tail = size;
+	file->read_ahead_eof = false;
+#endif /* CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD */
+
 	return 0;
 }
 
@@ -131,6 +270,13 @@ int lc3_file_close(struct lc3_file_ctx *file)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	if (file->read_ahead_buf != NULL) {
+		k_mem_slab_free(&read_ahead_slab, (void *)file->read_ahead_buf);
+		file->read_ahead_buf = NULL;
+	}
+#endif /* CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD */
+
 	ret = sd_card_close(&file->file_object);
 	if (ret) {
 		LOG_ERR("Failed to close file: %d", ret);
@@ -52,6 +52,15 @@ struct lc3_file_ctx {
 	struct fs_file_t file_object;
 	struct lc3_file_header lc3_header;
 	uint32_t number_of_samples;
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	/* Double buffer taken from the shared read-ahead pool, NULL if frames are read directly */
+	uint8_t *read_ahead_buf;
+	/* Absolute file offsets of the end of buffered data and of the next unread byte */
+	uint32_t read_ahead_head;
+	uint32_t read_ahead_tail;
+	/* Set when the SD card returned less data than requested */
+	bool read_ahead_eof;
+#endif /* CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD */
 };
 
 /**
@@ -72,6 +81,11 @@ int lc3_header_get(struct lc3_file_ctx const *const file, struct lc3_file_header
  * @param[out]	buffer		Pointer to the buffer to store the frame.
  * @param[in]	buffer_size	Size of the buffer.
  *
+ * @note With CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD, frames are parsed from a double
+ *       buffer that is refilled with sector-aligned reads. The buffer is taken from a shared
+ *       pool by lc3_file_open() and returned by lc3_file_close(). If the pool is exhausted,
+ *       frames are read directly from the SD card.
+ *
  * @retval -ENODATA	No more frames to read.
  * @retval 0		Success.
  */
@@ -18,7 +18,7 @@ K_THREAD_STACK_DEFINE(lc3_streamer_work_q_stack_area, CONFIG_SD_CARD_LC3_STREAME
 
 struct k_work_q lc3_streamer_work_q;
 
-#define LC3_STREAMER_BUFFER_NUM_FRAMES 2
+#define LC3_STREAMER_BUFFER_NUM_FRAMES CONFIG_SD_CARD_LC3_STREAMER_PREFETCH_FRAMES
 
 #if CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS > UINT8_MAX
 #error "CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS must be less than or equal to UINT8_MAX"
@@ -48,6 +48,9 @@ struct lc3_stream {
 	/* Pointer to the data_fifo buffer that holds valid, readable LC3 data */
 	char *active_buffer;
 
+	/* Number of times a frame was requested before the work queue had loaded it */
+	uint32_t underruns;
+
 	/* Filename of the file being streamed */
 	char filename[CONFIG_FS_FATFS_MAX_LFN];
 
@@ -198,24 +201,37 @@ static int stream_loop(struct lc3_stream *stream)
 static void next_frame_load(struct k_work *work)
 {
 	int ret;
+	uint32_t msgq_num_used;
+	uint32_t slab_num_used;
 	struct lc3_stream *stream = CONTAINER_OF(work, struct lc3_stream, work);
 
-	ret = put_next_frame_to_fifo(stream);
-	if (ret == -ENODATA) {
-		LOG_DBG("End of stream");
-		if (stream->loop_stream) {
-			ret = stream_loop(stream);
-			if (ret) {
-				LOG_ERR("Failed to loop stream %d", ret);
-				stream->state = STREAM_ENDED;
+	/* Fill all free buffers, so the file module can serve several frames per SD card read */
+	do {
+		ret = put_next_frame_to_fifo(stream);
+		if (ret == -ENODATA) {
+			LOG_DBG("End of stream");
+			if (stream->loop_stream) {
+				ret = stream_loop(stream);
+				if (ret) {
+					LOG_ERR("Failed to loop stream %d", ret);
+					stream->state = STREAM_ENDED;
+				}
+			} else {
+				stream->state = STREAM_PLAYING_LAST_FRAME;
 			}
-		} else {
-			stream->state = STREAM_PLAYING_LAST_FRAME;
+			return;
+		} else if (ret) {
+			LOG_ERR("Failed to put next frame to fifo %d", ret);
+			stream->state = STREAM_ENDED;
+			return;
 		}
-	} else if (ret) {
-		LOG_ERR("Failed to put next frame to fifo %d", ret);
-		stream->state = STREAM_ENDED;
-	}
+
+		ret = data_fifo_num_used_get(&stream->fifo, &msgq_num_used, &slab_num_used);
+		if (ret) {
+			LOG_ERR("Failed to get number of used blocks %d", ret);
+			return;
+		}
+	} while (slab_num_used < LC3_STREAMER_BUFFER_NUM_FRAMES);
 }
 
 int lc3_streamer_next_frame_get(const uint8_t streamer_idx, const uint8_t **const frame_buffer)
@@ -246,17 +262,16 @@ int lc3_streamer_next_frame_get(const uint8_t streamer_idx, const uint8_t **cons
 		stream->active_buffer = NULL;
 	}
 
-	if (stream->state == STREAM_PLAYING_LAST_FRAME) {
+	ret = data_fifo_pointer_last_filled_get(&stream->fifo, (void **)&data_ptr, &data_len,
+						K_NO_WAIT);
+	if (ret == -ENOMSG && stream->state == STREAM_PLAYING_LAST_FRAME) {
 		LOG_INF("Stream ended");
 		stream->state = STREAM_ENDED;
 		return -ENODATA;
-	}
-
-	ret = data_fifo_pointer_last_filled_get(&stream->fifo, (void **)&data_ptr, &data_len,
-						K_NO_WAIT);
-	if (ret) {
+	} else if (ret) {
 		if (ret == -ENOMSG) {
 			LOG_DBG("Next block is not ready %d", ret);
+			stream->underruns++;
 		} else {
 			LOG_ERR("Failed to get last filled block %d", ret);
 		}
@@ -266,6 +281,11 @@ int lc3_streamer_next_frame_get(const uint8_t streamer_idx, const uint8_t **cons
 	*frame_buffer = (uint8_t *)data_ptr;
 	stream->active_buffer = data_ptr;
 
+	if (stream->state == STREAM_PLAYING_LAST_FRAME) {
+		/* Remaining frames are already buffered */
+		return 0;
+	}
+
 	ret = k_work_submit_to_queue(&lc3_streamer_work_q, &stream->work);
 	if (ret < 0) {
 		LOG_ERR("Failed to submit work item %d", ret);
@@ -402,6 +422,7 @@ int lc3_streamer_stream_register(const char *const filename, uint8_t *const stre
 
 	streams[*streamer_idx].state = STREAM_PLAYING;
 	streams[*streamer_idx].loop_stream = loop;
+	streams[*streamer_idx].underruns = 0;
 
 	return 0;
 }
@@ -455,6 +476,23 @@ bool lc3_streamer_is_looping(const uint8_t streamer_idx)
 	return streams[streamer_idx].loop_stream;
 }
 
+int lc3_streamer_underruns_get(const uint8_t streamer_idx, uint32_t *const underruns)
+{
+	if (streamer_idx >= ARRAY_SIZE(streams)) {
+		LOG_ERR("Invalid streamer index %d", streamer_idx);
+		return -EINVAL;
+	}
+
+	if (underruns == NULL) {
+		LOG_ERR("Nullptr received for underruns");
+		return -EINVAL;
+	}
+
+	*underruns = streams[streamer_idx].underruns;
+
+	return 0;
+}
+
 int lc3_streamer_stream_close(const uint8_t streamer_idx)
 {
 	int ret;
@@ -48,6 +48,7 @@ struct lc3_stream_cfg {
  *
  * @retval 0		Success.
  * @retval -EINVAL	Invalid streamer index.
+ * @retval -ENOMSG	Next frame has not been loaded from the SD card yet (underrun).
  * @retval -ENODATA	No more frames to read, call lc3_streamer_end_stream to clean context.
  * @retval -EFAULT	Module has not been initialized, or stream is not in a valid state. If
  *			stream has been playing an error has occurred preventing from further
@@ -122,6 +123,21 @@ int lc3_streamer_file_path_get(const uint8_t streamer_idx, char *const path, con
  */
 bool lc3_streamer_is_looping(const uint8_t streamer_idx);
 
+/**
+ * @brief Get the number of underruns for a stream.
+ *
+ * @details An underrun is counted each time lc3_streamer_next_frame_get() returns -ENOMSG
+ *          because the SD card had not delivered the next frame in time. The counter is reset
+ *          when a stream is registered.
+ *
+ * @param[in]	streamer_idx	Index of the streamer.
+ * @param[out]	underruns	Pointer to store the number of underruns in.
+ *
+ * @retval	-EINVAL		Null pointer or invalid index given.
+ * @retval	0		Success.
+ */
+int lc3_streamer_underruns_get(const uint8_t streamer_idx, uint32_t *const underruns);
+
 /**
  * @brief End a stream that's playing.
  *
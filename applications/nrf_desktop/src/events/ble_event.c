@@ -47,3 +47,18 @@ APP_EVENT_TYPE_DEFINE(ble_qos_event,
 			IF_ENABLED(CONFIG_DESKTOP_INIT_LOG_BLE_QOS_EVENT,
 				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
 #endif
+
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+static void log_ble_qos_link_event(const struct app_event_header *aeh)
+{
+	const struct ble_qos_link_event *event = cast_ble_qos_link_event(aeh);
+
+	APP_EVENT_MANAGER_LOG(aeh, "conn:0x%04x per:%u%% missed:%u%%%s", event->conn_handle,
+			      event->per, event->missed, event->poor ? " poor" : "");
+}
+
+APP_EVENT_TYPE_DEFINE(ble_qos_link_event,
+		  log_ble_qos_link_event,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+#endif
@@ -58,6 +58,26 @@ struct ble_qos_event {
 APP_EVENT_TYPE_DECLARE(ble_qos_event);
 #endif
 
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+/** @brief BLE link quality event.
+ *
+ * Submitted by the BLE QoS module for every connection at every processing interval.
+ */
+struct ble_qos_link_event {
+	struct app_event_header header;
+
+	/** Connection handle. */
+	uint16_t conn_handle;
+	/** Packet error rate in percent. */
+	uint8_t per;
+	/** Percent of connection events that were not reported by the controller. */
+	uint8_t missed;
+	/** The link quality is poor. */
+	bool poor;
+};
+APP_EVENT_TYPE_DECLARE(ble_qos_link_event);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
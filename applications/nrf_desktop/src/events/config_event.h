@@ -37,7 +37,8 @@ extern "C" {
 	X(REJECT)			\
 	X(WRITE_FAIL)			\
 	X(DISCONNECTED)			\
-	X(GET_PEERS_CACHE)
+	X(GET_PEERS_CACHE)		\
+	X(GET_WINDOW_SIZE)
 
 enum config_status {
 #define X(name) _CONCAT(CONFIG_STATUS_, name),
@@ -40,6 +40,20 @@ struct hid_report_event {
 APP_EVENT_TYPE_DYNDATA_DECLARE(hid_report_event);
 
 
+/** @brief Function that delivers a HID input report directly to a HID subscriber.
+ *
+ * The function bypasses the HID report event and must be called from a cooperative thread.
+ *
+ * @param subscriber	Id of the report subscriber.
+ * @param report_id	Report id.
+ * @param data		Report data, without the report id.
+ * @param size		Size of the report data.
+ *
+ * @return 0 if the report was accepted by the subscriber. Otherwise, a (negative) error code.
+ */
+typedef int (*hid_report_direct_submit_t)(const void *subscriber, uint8_t report_id,
+					  const uint8_t *data, size_t size);
+
 /** @brief Report subscriber event. */
 struct hid_report_subscriber_event {
 	struct app_event_header header; /**< Event header. */
@@ -54,6 +68,14 @@ struct hid_report_subscriber_event {
 		uint8_t report_max; /**< Maximum number of reports with different ID, which can be
 				      * processed.
 				      */
+		hid_report_direct_submit_t direct_submit; /**< Function that delivers HID input
+							    * reports directly to the subscriber,
+							    * or NULL if not supported. If used, the
+							    * HID report event is submitted after
+							    * the report is delivered only to notify
+							    * other modules and is ignored by the
+							    * subscriber.
+							    */
 	} params; /**< Subscriber parameters. Only needed when a subscriber is connecting.
 		    * Ignored when disconnecting.
 		    */
@@ -21,6 +21,8 @@
 #include "hid_event.h"
 #include "config_event.h"
 #include "usb_event.h"
+#include "hid_report_desc.h"
+#include "hid_latency_meas.h"
 
 #define MODULE motion
 #include <caf/events/module_state_event.h>
@@ -242,6 +244,10 @@ static int motion_read(int16_t *dx, int16_t *dy)
 	if (!err) {
 		*dx = value_x.val1;
 		*dy = value_y.val1;
+
+		if (IS_ENABLED(CONFIG_DESKTOP_HID_LATENCY_MEAS_ENABLE) && ((*dx != 0) || (*dy != 0))) {
+			hid_latency_meas_stamp(HID_LATENCY_MEAS_POINT_SENSOR_READ, REPORT_ID_MOUSE);
+		}
 	}
 
 	return err;
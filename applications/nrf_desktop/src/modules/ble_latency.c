@@ -10,6 +10,7 @@
 #include <caf/events/ble_common_event.h>
 #include <caf/events/ble_smp_event.h>
 #include "config_event.h"
+#include "ble_event.h"
 #include <caf/events/power_event.h>
 
 #define MODULE ble_latency
@@ -293,6 +294,19 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		return false;
 	}
 
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+	if (is_ble_qos_link_event(aeh)) {
+		/* Keep the low latency while the link quality is poor. Lost packets
+		 * are then retransmitted in the next connection event.
+		 */
+		if (cast_ble_qos_link_event(aeh)->poor) {
+			use_low_latency();
+		}
+
+		return false;
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_DESKTOP_BLE_LOW_LATENCY_LOCK) &&
 	    IS_ENABLED(CONFIG_DESKTOP_BLE_LATENCY_PM_EVENTS) &&
 	    is_power_down_event(aeh)) {
@@ -326,6 +340,9 @@ APP_EVENT_LISTENER(MODULE, app_event_handler);
 APP_EVENT_SUBSCRIBE(MODULE, module_state_event);
 APP_EVENT_SUBSCRIBE(MODULE, ble_peer_event);
 APP_EVENT_SUBSCRIBE(MODULE, ble_peer_conn_params_event);
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+APP_EVENT_SUBSCRIBE(MODULE, ble_qos_link_event);
+#endif
 #if CONFIG_CAF_BLE_SMP_TRANSFER_EVENTS
 APP_EVENT_SUBSCRIBE(MODULE, ble_smp_transfer_event);
 #endif
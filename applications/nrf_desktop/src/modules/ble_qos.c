@@ -83,6 +83,25 @@ struct params_blacklist {
 	uint16_t wifi_chn_bitmask;
 } __packed;
 
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+/* Number of packet error rate histogram buckets of a link. */
+#define LINK_PER_BUCKETS 8
+
+struct link_quality {
+	uint16_t conn_handle;
+	bool used;
+	bool poor;
+	uint16_t last_event_counter;
+	/* Statistics of the current processing interval. */
+	uint32_t events;
+	uint32_t events_elapsed;
+	uint32_t crc_ok;
+	uint32_t crc_error;
+	/* Histogram of the packet error rate measured at every processing interval. */
+	uint16_t per_hist[LINK_PER_BUCKETS];
+};
+#endif
+
 static uint8_t chmap_instance_buf[CHMAP_FILTER_INST_SIZE] __aligned(CHMAP_FILTER_INST_ALIGN);
 static struct chmap_instance *chmap_inst;
 static uint8_t current_chmap[CHMAP_BLE_BITMASK_SIZE] = CHMAP_BLE_BITMASK_DEFAULT;
@@ -91,6 +110,13 @@ static atomic_t new_blacklist;
 static atomic_t params_updated;
 static struct chmap_filter_params filter_params;
 static struct k_mutex data_access_mutex;
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+static struct link_quality links[CONFIG_BT_MAX_CONN];
+static uint8_t link_sel;
+
+BUILD_ASSERT(CONFIG_DESKTOP_BLE_QOS_LINK_GOOD_PER < CONFIG_DESKTOP_BLE_QOS_LINK_POOR_PER);
+BUILD_ASSERT(sizeof(links[0].per_hist) <= CONFIG_CHANNEL_FETCHED_DATA_MAX_SIZE);
+#endif
 
 BUILD_ASSERT(sizeof(struct bt_hci_cp_le_set_host_chan_classif) ==
 	     sizeof(struct params_chmap));
@@ -107,6 +133,7 @@ enum ble_qos_opt {
 	BLE_QOS_OPT_CHMAP,
 	BLE_QOS_OPT_PARAM_BLE,
 	BLE_QOS_OPT_PARAM_WIFI,
+	BLE_QOS_OPT_LINK_QUALITY,
 
 	BLE_QOS_OPT_COUNT
 };
@@ -115,7 +142,8 @@ static const char * const opt_descr[] = {
 	[BLE_QOS_OPT_BLACKLIST] = "blacklist",
 	[BLE_QOS_OPT_CHMAP] = "chmap",
 	[BLE_QOS_OPT_PARAM_BLE]	= "param_ble",
-	[BLE_QOS_OPT_PARAM_WIFI] = "param_wifi"
+	[BLE_QOS_OPT_PARAM_WIFI] = "param_wifi",
+	[BLE_QOS_OPT_LINK_QUALITY] = "link_quality"
 };
 
 
@@ -398,6 +426,115 @@ static void hid_pkt_stats_print(uint32_t ble_recv)
 	send_uart_data(cdc_dev, (uint8_t *)str, str_len);
 }
 
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+static void link_quality_update(const sdc_hci_subevent_vs_qos_conn_event_report_t *evt)
+{
+	struct link_quality *link = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		if (links[i].used && (links[i].conn_handle == evt->conn_handle)) {
+			link = &links[i];
+			break;
+		}
+
+		if (!link && !links[i].used) {
+			link = &links[i];
+		}
+	}
+
+	if (!link) {
+		return;
+	}
+
+	if (!link->used) {
+		memset(link, 0, sizeof(*link));
+		link->used = true;
+		link->conn_handle = evt->conn_handle;
+		link->last_event_counter = evt->event_counter - 1;
+	}
+
+	/* No report is generated for the connection events skipped by the controller. */
+	link->events_elapsed += (uint16_t)(evt->event_counter - link->last_event_counter);
+	link->last_event_counter = evt->event_counter;
+	link->events++;
+	link->crc_ok += evt->crc_ok_count;
+	link->crc_error += evt->crc_error_count;
+}
+
+static void link_quality_process(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		struct link_quality *link = &links[i];
+
+		if (!link->used) {
+			continue;
+		}
+
+		if (link->events == 0) {
+			/* No reports during the whole interval, the link is gone. */
+			k_mutex_lock(&data_access_mutex, K_FOREVER);
+			link->used = false;
+			k_mutex_unlock(&data_access_mutex);
+			continue;
+		}
+
+		uint32_t packets = link->crc_ok + link->crc_error;
+		uint8_t per = (packets > 0) ? (link->crc_error * 100 / packets) : 0;
+		uint8_t missed = (link->events_elapsed - link->events) * 100 / link->events_elapsed;
+		size_t bucket = MIN(per * LINK_PER_BUCKETS / 100, LINK_PER_BUCKETS - 1);
+
+		k_mutex_lock(&data_access_mutex, K_FOREVER);
+		if (link->per_hist[bucket] < UINT16_MAX) {
+			link->per_hist[bucket]++;
+		}
+		k_mutex_unlock(&data_access_mutex);
+
+		if (per >= CONFIG_DESKTOP_BLE_QOS_LINK_POOR_PER) {
+			link->poor = true;
+		} else if (per < CONFIG_DESKTOP_BLE_QOS_LINK_GOOD_PER) {
+			link->poor = false;
+		}
+
+		struct ble_qos_link_event *event = new_ble_qos_link_event();
+
+		event->conn_handle = link->conn_handle;
+		event->per = per;
+		event->missed = missed;
+		event->poor = link->poor;
+		APP_EVENT_SUBMIT(event);
+
+		link->events = 0;
+		link->events_elapsed = 0;
+		link->crc_ok = 0;
+		link->crc_error = 0;
+	}
+}
+
+static void fill_qos_link_quality(uint8_t *data, size_t *size)
+{
+	size_t pos = 0;
+
+	k_mutex_lock(&data_access_mutex, K_FOREVER);
+	if ((link_sel < ARRAY_SIZE(links)) && links[link_sel].used) {
+		for (size_t i = 0; i < LINK_PER_BUCKETS; i++) {
+			sys_put_le16(links[link_sel].per_hist[i], &data[pos]);
+			pos += sizeof(links[link_sel].per_hist[i]);
+		}
+	}
+	k_mutex_unlock(&data_access_mutex);
+
+	*size = pos;
+}
+#else
+static void link_quality_update(const sdc_hci_subevent_vs_qos_conn_event_report_t *evt)
+{
+}
+
+static void link_quality_process(void)
+{
+}
+#endif /* CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY */
+
 static bool on_vs_evt(struct net_buf_simple *buf)
 {
 	uint8_t *subevent_code;
@@ -422,6 +559,7 @@ static bool on_vs_evt(struct net_buf_simple *buf)
 			evt->channel_index,
 			evt->crc_ok_count,
 			evt->crc_error_count);
+		link_quality_update(evt);
 		return true;
 	default:
 		return false;
@@ -505,6 +643,19 @@ static void update_config(const uint8_t opt_id, const uint8_t *data,
 		}
 		break;
 
+	case BLE_QOS_OPT_LINK_QUALITY:
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+		/* Select the link of which histogram is fetched. */
+		if (size != sizeof(link_sel)) {
+			LOG_WRN("Invalid size");
+		} else {
+			link_sel = data[0];
+		}
+#else
+		LOG_WRN("Not supported");
+#endif
+		break;
+
 	default:
 		LOG_WRN("Unknown opt %" PRIu8, opt_id);
 		return;
@@ -604,6 +755,14 @@ static void fetch_config(const uint8_t opt_id, uint8_t *data, size_t *size)
 		fill_qos_wifi_params(data, size);
 		break;
 
+	case BLE_QOS_OPT_LINK_QUALITY:
+#if CONFIG_DESKTOP_BLE_QOS_LINK_QUALITY
+		fill_qos_link_quality(data, size);
+#else
+		LOG_WRN("Not supported");
+#endif
+		break;
+
 	default:
 		LOG_WRN("Unknown opt: %" PRIu8, opt_id);
 	}
@@ -755,6 +914,7 @@ static void ble_qos_thread_fn(void)
 		/* (this thread runs at the lowest priority) */
 		atomic_set(&processing, true);
 		update_channel_map = chmap_filter_process(chmap_inst);
+		link_quality_process();
 		atomic_set(&processing, false);
 
 		ble_chn_stats_print(update_channel_map);
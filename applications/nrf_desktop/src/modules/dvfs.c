@@ -4,11 +4,15 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
+
 #include <caf/events/ble_common_event.h>
 #include <caf/events/ble_smp_event.h>
 
 #include "usb_event.h"
 #include "config_event.h"
+#include "hid_event.h"
+#include "cpu_load_event.h"
 
 #define MODULE dvfs
 #include <caf/events/module_state_event.h>
@@ -18,6 +22,8 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_DVFS_LOG_LEVEL);
 
 #include <zephyr/drivers/clock_control/nrf_clock_control.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/shell/shell.h>
 
 #define CLOCK_NODE DT_ALIAS(nrfdesktop_dvfs_clock)
 
@@ -62,6 +68,8 @@ static enum state module_state = STATE_DISABLED;
 	MACRO(USB_CONNECTED, __VA_ARGS__)					\
 	MACRO(CONFIG_CHANNEL, __VA_ARGS__)					\
 	MACRO(SMP_TRANSFER, __VA_ARGS__)					\
+	MACRO(CPU_LOAD, __VA_ARGS__)						\
+	MACRO(HID_REPORT_RATE, __VA_ARGS__)					\
 	MACRO(COUNT, __VA_ARGS__)
 
 #define DVFS_STATE(name, ...) DVFS_STATE_ ## name,
@@ -116,6 +124,28 @@ static uint32_t current_freq = dvfs_freq_array[0].freq;
 BUILD_ASSERT(sizeof(dvfs_freq_array[0].bitmask) == sizeof(dfvs_requests_state_bitmask));
 BUILD_ASSERT(CHAR_BIT * sizeof(dfvs_requests_state_bitmask) >= DVFS_STATE_COUNT);
 
+#if CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_ENABLE
+BUILD_ASSERT(CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_OFF_THRESHOLD <
+	     CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_ON_THRESHOLD);
+#endif
+
+#if CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_ENABLE
+BUILD_ASSERT(CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_OFF_THRESHOLD <
+	     CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_ON_THRESHOLD);
+BUILD_ASSERT(CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_WINDOW_MS <
+	     CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_TIMEOUT_MS);
+
+static struct {
+	int64_t window_start;
+	uint32_t report_cnt;
+} hid_report_rate;
+#endif
+
+/* Time spent in each frequency point, protected by freq_time_lock. */
+static uint64_t freq_time_ms[ARRAY_SIZE(dvfs_freq_array)];
+static int64_t freq_change_uptime;
+static struct k_spinlock freq_time_lock;
+
 static struct dvfs_retry {
 	struct k_work_delayable retry_work;
 	uint8_t retries_cnt;
@@ -189,6 +219,30 @@ static uint32_t check_required_frequency(void)
 	return dvfs_freq_array[ARRAY_SIZE(dvfs_freq_array) - 1].freq;
 }
 
+static size_t get_freq_idx(uint32_t freq)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(dvfs_freq_array); i++) {
+		if (dvfs_freq_array[i].freq == freq) {
+			return i;
+		}
+	}
+
+	__ASSERT_NO_MSG(false);
+	return ARRAY_SIZE(dvfs_freq_array) - 1;
+}
+
+static void update_current_freq(uint32_t freq)
+{
+	k_spinlock_key_t key = k_spin_lock(&freq_time_lock);
+	int64_t now = k_uptime_get();
+
+	freq_time_ms[get_freq_idx(current_freq)] += now - freq_change_uptime;
+	freq_change_uptime = now;
+	current_freq = freq;
+
+	k_spin_unlock(&freq_time_lock, key);
+}
+
 static void dvfs_notify_cb(struct onoff_manager *srv,
 			   struct onoff_client *cli,
 			   uint32_t state,
@@ -262,7 +316,7 @@ static void dvfs_notify_work_handler(struct k_work *work)
 	 * module will change cpu frequency, so current_freq is effectively
 	 * equal to requested_freq.
 	 */
-	current_freq = requested_freq;
+	update_current_freq(requested_freq);
 
 	dvfs_retry.retries_cnt = 0;
 	LOG_INF("DVFS completed, current frequency is: %" PRIu32, current_freq);
@@ -288,6 +342,11 @@ static void process_dvfs_states(enum dvfs_state state, bool turn_on)
 	dvfs_frequency_update();
 }
 
+static bool is_dvfs_state_active(enum dvfs_state state)
+{
+	return (dfvs_requests_state_bitmask & BIT(state));
+}
+
 static bool handle_ble_peer_conn_params_event(const struct ble_peer_conn_params_event *event)
 {
 	if (!event->updated) {
@@ -302,6 +361,65 @@ static bool handle_ble_peer_conn_params_event(const struct ble_peer_conn_params_
 
 	return false;
 }
+
+static bool handle_cpu_load_event(const struct cpu_load_event *event)
+{
+#if CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_ENABLE
+	/* Scale the CPU load to the lowest frequency to make it independent of the
+	 * currently used frequency. Otherwise switching to a higher frequency would
+	 * lower the measured CPU load and turn the state off again.
+	 */
+	uint64_t load = (uint64_t)event->load * current_freq / CONFIG_DESKTOP_DVFS_FREQ_LOW;
+	bool active = is_dvfs_state_active(DVFS_STATE_CPU_LOAD);
+
+	if (!active && (load >= CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_ON_THRESHOLD)) {
+		process_dvfs_states(DVFS_STATE_CPU_LOAD, true);
+	} else if (active && (load < CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_OFF_THRESHOLD)) {
+		process_dvfs_states(DVFS_STATE_CPU_LOAD, false);
+	}
+#endif
+
+	return false;
+}
+
+static bool handle_hid_report_sent_event(const struct hid_report_sent_event *event)
+{
+#if CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_ENABLE
+	struct dvfs_state_timeout *rate_timeout = &dvfs_state_timeouts[DVFS_STATE_HID_REPORT_RATE];
+	int64_t now = k_uptime_get();
+	int64_t elapsed = now - hid_report_rate.window_start;
+
+	if (event->error) {
+		return false;
+	}
+
+	hid_report_rate.report_cnt++;
+
+	if (elapsed >= CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_WINDOW_MS) {
+		uint32_t rate = (uint64_t)hid_report_rate.report_cnt * MSEC_PER_SEC / elapsed;
+		bool active = is_dvfs_state_active(DVFS_STATE_HID_REPORT_RATE);
+
+		if (!active && (rate >= CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_ON_THRESHOLD)) {
+			process_dvfs_states(DVFS_STATE_HID_REPORT_RATE, true);
+		} else if (active &&
+			   (rate < CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_OFF_THRESHOLD)) {
+			process_dvfs_states(DVFS_STATE_HID_REPORT_RATE, false);
+		}
+
+		hid_report_rate.window_start = now;
+		hid_report_rate.report_cnt = 0;
+	}
+
+	/* The state is turned off on timeout if HID reports are no longer sent. */
+	if (is_dvfs_state_active(DVFS_STATE_HID_REPORT_RATE)) {
+		(void) k_work_reschedule(&rate_timeout->timeout_work,
+					 K_MSEC(rate_timeout->timeout_ms));
+	}
+#endif
+
+	return false;
+}
+
 static void dvfs_state_timeout_work_handler(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -423,6 +541,16 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		return false;
 	}
 
+	if (IS_ENABLED(CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_ENABLE) &&
+	    is_cpu_load_event(aeh)) {
+		return handle_cpu_load_event(cast_cpu_load_event(aeh));
+	}
+
+	if (IS_ENABLED(CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_ENABLE) &&
+	    is_hid_report_sent_event(aeh)) {
+		return handle_hid_report_sent_event(cast_hid_report_sent_event(aeh));
+	}
+
 	if (IS_ENABLED(CONFIG_DESKTOP_DVFS_STATE_CONFIG_CHANNEL_ENABLE) && is_config_event(aeh)) {
 		struct dvfs_state_timeout *config_channel_timeout =
 			&dvfs_state_timeouts[DVFS_STATE_CONFIG_CHANNEL];
@@ -441,6 +569,44 @@ static bool app_event_handler(const struct app_event_header *aeh)
 	return false;
 }
 
+#if CONFIG_DESKTOP_DVFS_SHELL
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	uint64_t time_ms[ARRAY_SIZE(dvfs_freq_array)];
+	uint32_t freq;
+	uint8_t states;
+
+	k_spinlock_key_t key = k_spin_lock(&freq_time_lock);
+
+	memcpy(time_ms, freq_time_ms, sizeof(time_ms));
+	time_ms[get_freq_idx(current_freq)] += k_uptime_get() - freq_change_uptime;
+	freq = current_freq;
+	states = dfvs_requests_state_bitmask;
+
+	k_spin_unlock(&freq_time_lock, key);
+
+	for (size_t i = 0; i < ARRAY_SIZE(dvfs_freq_array); i++) {
+		shell_print(sh, "%" PRIu32 " Hz: %" PRIu64 " ms%s", dvfs_freq_array[i].freq,
+			    time_ms[i], (dvfs_freq_array[i].freq == freq) ? " (current)" : "");
+	}
+
+	for (size_t i = 0; i < DVFS_STATE_COUNT; i++) {
+		if (states & BIT(i)) {
+			shell_print(sh, "%s ACTIVE", get_dvfs_state_name(i));
+		}
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_dvfs,
+	SHELL_CMD_ARG(stats, NULL, "Print time spent in DVFS frequency points", cmd_stats, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(dvfs, &sub_dvfs, "DVFS commands", NULL);
+#endif /* CONFIG_DESKTOP_DVFS_SHELL */
+
 APP_EVENT_LISTENER(MODULE, app_event_handler);
 APP_EVENT_SUBSCRIBE(MODULE, module_state_event);
 #if CONFIG_DESKTOP_DVFS_STATE_LLPM_CONNECTED_ENABLE
@@ -453,6 +619,12 @@ APP_EVENT_SUBSCRIBE(MODULE, usb_state_event);
 #if CONFIG_DESKTOP_DVFS_STATE_SMP_TRANSFER_ENABLE
 APP_EVENT_SUBSCRIBE(MODULE, ble_smp_transfer_event);
 #endif
+#if CONFIG_DESKTOP_DVFS_STATE_CPU_LOAD_ENABLE
+APP_EVENT_SUBSCRIBE(MODULE, cpu_load_event);
+#endif
+#if CONFIG_DESKTOP_DVFS_STATE_HID_REPORT_RATE_ENABLE
+APP_EVENT_SUBSCRIBE(MODULE, hid_report_sent_event);
+#endif
 #if CONFIG_DESKTOP_DVFS_STATE_CONFIG_CHANNEL_ENABLE
 APP_EVENT_SUBSCRIBE_EARLY(MODULE, config_event);
 #endif
@@ -1087,7 +1087,8 @@ static bool handle_hid_report_subscriber_event(const struct hid_report_subscribe
 
 		__ASSERT_NO_MSG(sub);
 
-		sub->in_reportq = hid_reportq_alloc(event->subscriber, event->params.report_max);
+		sub->in_reportq = hid_reportq_alloc(event->subscriber, event->params.report_max,
+						    event->params.direct_submit);
 		__ASSERT_NO_MSG(sub->in_reportq);
 	} else {
 		struct subscriber *sub = find_subscriber(event->subscriber);
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/byteorder.h>
+
+#define MODULE hid_latency_meas
+#include <caf/events/module_state_event.h>
+
+#include "hid_event.h"
+#include "config_event.h"
+#include "hid_report_desc.h"
+#include "hid_latency_meas.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_HID_LATENCY_MEAS_LOG_LEVEL);
+
+#define BUCKET_US	CONFIG_DESKTOP_HID_LATENCY_MEAS_BUCKET_US
+#define BUCKET_COUNT	CONFIG_DESKTOP_HID_LATENCY_MEAS_BUCKET_COUNT
+
+enum latency_segment {
+	LATENCY_SEGMENT_TOTAL,
+	LATENCY_SEGMENT_SENSOR,
+	LATENCY_SEGMENT_REPORT,
+	LATENCY_SEGMENT_TRANSPORT,
+
+	LATENCY_SEGMENT_COUNT
+};
+
+enum latency_opt {
+	LATENCY_OPT_TOTAL = LATENCY_SEGMENT_TOTAL,
+	LATENCY_OPT_SENSOR = LATENCY_SEGMENT_SENSOR,
+	LATENCY_OPT_REPORT = LATENCY_SEGMENT_REPORT,
+	LATENCY_OPT_TRANSPORT = LATENCY_SEGMENT_TRANSPORT,
+	LATENCY_OPT_COUNT_MEAS,
+
+	LATENCY_OPT_COUNT
+};
+
+static const char * const opt_descr[] = {
+	[LATENCY_OPT_TOTAL] = "total",
+	[LATENCY_OPT_SENSOR] = "sensor",
+	[LATENCY_OPT_REPORT] = "report",
+	[LATENCY_OPT_TRANSPORT] = "transport",
+	[LATENCY_OPT_COUNT_MEAS] = "count"
+};
+
+/* Percentiles provided for every segment over the config channel. */
+static const uint8_t percentiles[] = {50, 90, 99};
+
+struct segment_stats {
+	uint32_t hist[BUCKET_COUNT];
+	uint32_t max_us;
+};
+
+static struct k_spinlock lock;
+static uint32_t stamp[HID_LATENCY_MEAS_POINT_COUNT];
+static enum hid_latency_meas_point next_point = HID_LATENCY_MEAS_POINT_SENSOR_READ;
+static struct segment_stats stats[LATENCY_SEGMENT_COUNT];
+static uint32_t meas_cnt;
+static bool initialized;
+
+
+static bool is_mouse_report(uint8_t report_id)
+{
+	return (report_id == REPORT_ID_MOUSE) || (report_id == REPORT_ID_BOOT_MOUSE);
+}
+
+static void segment_add(enum latency_segment segment, enum hid_latency_meas_point start,
+			enum hid_latency_meas_point end)
+{
+	struct segment_stats *s = &stats[segment];
+	uint32_t latency_us = k_cyc_to_us_floor32(stamp[end] - stamp[start]);
+
+	s->hist[MIN(latency_us / BUCKET_US, BUCKET_COUNT - 1)]++;
+	s->max_us = MAX(s->max_us, latency_us);
+}
+
+static void measurement_finish(void)
+{
+	segment_add(LATENCY_SEGMENT_TOTAL, HID_LATENCY_MEAS_POINT_SENSOR_READ,
+		    HID_LATENCY_MEAS_POINT_REPORT_SENT);
+	segment_add(LATENCY_SEGMENT_SENSOR, HID_LATENCY_MEAS_POINT_SENSOR_READ,
+		    HID_LATENCY_MEAS_POINT_REPORT_SEND);
+	segment_add(LATENCY_SEGMENT_REPORT, HID_LATENCY_MEAS_POINT_REPORT_SEND,
+		    HID_LATENCY_MEAS_POINT_TRANSPORT_SUBMIT);
+	segment_add(LATENCY_SEGMENT_TRANSPORT, HID_LATENCY_MEAS_POINT_TRANSPORT_SUBMIT,
+		    HID_LATENCY_MEAS_POINT_REPORT_SENT);
+
+	meas_cnt++;
+}
+
+void hid_latency_meas_stamp(enum hid_latency_meas_point point, uint8_t report_id)
+{
+	__ASSERT_NO_MSG(point < HID_LATENCY_MEAS_POINT_COUNT);
+
+	if (!initialized || !is_mouse_report(report_id)) {
+		return;
+	}
+
+	uint32_t now = k_cycle_get_32();
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (point == HID_LATENCY_MEAS_POINT_SENSOR_READ) {
+		uint32_t timeout = k_ms_to_cyc_ceil32(CONFIG_DESKTOP_HID_LATENCY_MEAS_TIMEOUT_MS);
+
+		/* Restart the measurement if the measured report was lost. */
+		if ((next_point == HID_LATENCY_MEAS_POINT_SENSOR_READ) ||
+		    ((now - stamp[HID_LATENCY_MEAS_POINT_SENSOR_READ]) > timeout)) {
+			stamp[point] = now;
+			next_point = HID_LATENCY_MEAS_POINT_REPORT_SEND;
+		}
+	} else if (point == next_point) {
+		stamp[point] = now;
+
+		if (point == HID_LATENCY_MEAS_POINT_REPORT_SENT) {
+			measurement_finish();
+			next_point = HID_LATENCY_MEAS_POINT_SENSOR_READ;
+		} else {
+			next_point++;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+static uint32_t percentile_get(const struct segment_stats *s, uint32_t cnt, uint8_t percentile)
+{
+	/* Rank of the sample, rounded up. */
+	uint32_t rank = DIV_ROUND_UP((uint64_t)cnt * percentile, 100);
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < BUCKET_COUNT - 1; i++) {
+		sum += s->hist[i];
+
+		if (sum >= rank) {
+			/* Report the upper bound of the bucket. */
+			return MIN((i + 1) * BUCKET_US, s->max_us);
+		}
+	}
+
+	return s->max_us;
+}
+
+static void fetch_segment(enum latency_segment segment, uint8_t *data, size_t *size)
+{
+	BUILD_ASSERT((ARRAY_SIZE(percentiles) + 1) * sizeof(uint32_t) <=
+		     CONFIG_CHANNEL_FETCHED_DATA_MAX_SIZE);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	const struct segment_stats *s = &stats[segment];
+	size_t pos = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(percentiles); i++) {
+		uint32_t value = (meas_cnt > 0) ? percentile_get(s, meas_cnt, percentiles[i]) : 0;
+
+		sys_put_le32(value, &data[pos]);
+		pos += sizeof(value);
+	}
+
+	sys_put_le32(s->max_us, &data[pos]);
+	pos += sizeof(s->max_us);
+
+	k_spin_unlock(&lock, key);
+
+	*size = pos;
+}
+
+static void fetch_config(const uint8_t opt_id, uint8_t *data, size_t *size)
+{
+	switch (opt_id) {
+	case LATENCY_OPT_TOTAL:
+	case LATENCY_OPT_SENSOR:
+	case LATENCY_OPT_REPORT:
+	case LATENCY_OPT_TRANSPORT:
+		fetch_segment((enum latency_segment)opt_id, data, size);
+		break;
+
+	case LATENCY_OPT_COUNT_MEAS:
+	{
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		sys_put_le32(meas_cnt, data);
+		k_spin_unlock(&lock, key);
+		*size = sizeof(meas_cnt);
+		break;
+	}
+
+	default:
+		LOG_WRN("Unknown opt: %" PRIu8, opt_id);
+		break;
+	}
+}
+
+static void update_config(const uint8_t opt_id, const uint8_t *data, const size_t size)
+{
+	if (opt_id != LATENCY_OPT_COUNT_MEAS) {
+		LOG_WRN("Unsupported set opt_id: %" PRIu8, opt_id);
+		return;
+	}
+
+	/* Setting the count option resets the measurement. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(stats, 0, sizeof(stats));
+	meas_cnt = 0;
+	next_point = HID_LATENCY_MEAS_POINT_SENSOR_READ;
+
+	k_spin_unlock(&lock, key);
+
+	LOG_INF("Measurement reset");
+}
+
+static bool handle_hid_report_sent_event(const struct hid_report_sent_event *event)
+{
+	if (event->error) {
+		/* The measured report was not delivered. The measurement times out. */
+		return false;
+	}
+
+	hid_latency_meas_stamp(HID_LATENCY_MEAS_POINT_REPORT_SENT, event->report_id);
+
+	return false;
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_hid_report_sent_event(aeh)) {
+		return handle_hid_report_sent_event(cast_hid_report_sent_event(aeh));
+	}
+
+	if (is_module_state_event(aeh)) {
+		struct module_state_event *event = cast_module_state_event(aeh);
+
+		if (check_state(event, MODULE_ID(main), MODULE_STATE_READY)) {
+			__ASSERT_NO_MSG(!initialized);
+			initialized = true;
+
+			module_set_state(MODULE_STATE_READY);
+		}
+
+		return false;
+	}
+
+	GEN_CONFIG_EVENT_HANDLERS(STRINGIFY(MODULE), opt_descr, update_config, fetch_config);
+
+	/* If event is unhandled, unsubscribe. */
+	__ASSERT_NO_MSG(false);
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, module_state_event);
+APP_EVENT_SUBSCRIBE(MODULE, hid_report_sent_event);
+#if CONFIG_DESKTOP_CONFIG_CHANNEL_ENABLE
+APP_EVENT_SUBSCRIBE_EARLY(MODULE, config_event);
+#endif
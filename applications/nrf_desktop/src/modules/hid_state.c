@@ -16,6 +16,7 @@
 
 #include CONFIG_DESKTOP_HID_STATE_HID_KEYBOARD_LEDS_DEF_PATH
 #include "hid_report_desc.h"
+#include "hid_latency_meas.h"
 
 #define MODULE hid_state
 #include <caf/events/module_state_event.h>
@@ -205,6 +206,12 @@ static bool report_send(struct report_state *rs,
 		}
 
 		if (sent) {
+			if (IS_ENABLED(CONFIG_DESKTOP_HID_LATENCY_MEAS_ENABLE) &&
+			    (provider->linked_rs == rs)) {
+				hid_latency_meas_stamp(HID_LATENCY_MEAS_POINT_REPORT_SEND,
+						       provider->report_id);
+			}
+
 			__ASSERT_NO_MSG(rs->cnt < UINT8_MAX);
 			rs->cnt++;
 			rs->subscriber->report_cnt++;
@@ -21,6 +21,7 @@
 
 #include "hid_report_desc.h"
 #include "config_channel_transport.h"
+#include "hid_latency_meas.h"
 
 #define MODULE hids
 #include <caf/events/module_state_event.h>
@@ -475,6 +476,10 @@ static void send_hid_report(const struct hid_report_event *event)
 	size_t size = event->dyndata.size - sizeof(report_id);
 	int err;
 
+	if (IS_ENABLED(CONFIG_DESKTOP_HID_LATENCY_MEAS_ENABLE)) {
+		hid_latency_meas_stamp(HID_LATENCY_MEAS_POINT_TRANSPORT_SUBMIT, report_id);
+	}
+
 	switch (report_id) {
 	case REPORT_ID_BOOT_MOUSE:
 		if (!protocol_boot) {
@@ -536,6 +541,7 @@ static void broadcast_hids_subscriber_state(void *subscriber, bool enabled)
 	event->params.pipeline_size = HIDS_SUBSCRIBER_PIPELINE_SIZE;
 	event->params.priority = HIDS_SUBSCRIBER_PRIORITY;
 	event->params.report_max = HIDS_SUBSCRIBER_REPORT_MAX;
+	event->params.direct_submit = NULL;
 	event->connected = enabled;
 
 	APP_EVENT_SUBMIT(event);
@@ -89,6 +89,17 @@ static bool handle_config_event(const struct config_event *event)
 		return true;
 	}
 
+	case CONFIG_STATUS_GET_WINDOW_SIZE:
+	{
+		BUILD_ASSERT(CONFIG_DESKTOP_CONFIG_CHANNEL_WINDOW_SIZE <= UINT8_MAX);
+
+		struct config_event *rsp = generate_response(event, sizeof(uint8_t));
+
+		rsp->dyndata.data[0] = CONFIG_DESKTOP_CONFIG_CHANNEL_WINDOW_SIZE;
+		submit_response(rsp);
+		return true;
+	}
+
 	default:
 		break;
 	}
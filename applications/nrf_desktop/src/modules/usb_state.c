@@ -29,6 +29,7 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_USB_STATE_LOG_LEVEL);
 
 #include "hid_report_desc.h"
 #include "config_channel_transport.h"
+#include "hid_latency_meas.h"
 
 #include "hid_event.h"
 #include "usb_event.h"
@@ -202,8 +203,7 @@ static uint8_t usb_hid_buf_get_report_id(struct usb_hid_buf *buf)
 	return report_id;
 }
 
-static struct usb_hid_buf *usb_hid_buf_alloc(struct usb_hid_device *usb_hid, const uint8_t *data,
-					     size_t size)
+static struct usb_hid_buf *usb_hid_buf_alloc_raw(struct usb_hid_device *usb_hid, size_t size)
 {
 	for (size_t i = 0; i < ARRAY_SIZE(usb_hid->report_bufs); i++) {
 		struct usb_hid_buf *r = &usb_hid->report_bufs[i];
@@ -211,7 +211,6 @@ static struct usb_hid_buf *usb_hid_buf_alloc(struct usb_hid_device *usb_hid, con
 		if (r->status_bm == 0) {
 			__ASSERT_NO_MSG(sizeof(r->data) >= size);
 
-			memcpy(r->data, data, size);
 			r->size = size;
 			r->status_bm |= USB_HID_BUF_ALLOCATED;
 			return r;
@@ -221,6 +220,18 @@ static struct usb_hid_buf *usb_hid_buf_alloc(struct usb_hid_device *usb_hid, con
 	return NULL;
 }
 
+static struct usb_hid_buf *usb_hid_buf_alloc(struct usb_hid_device *usb_hid, const uint8_t *data,
+					     size_t size)
+{
+	struct usb_hid_buf *r = usb_hid_buf_alloc_raw(usb_hid, size);
+
+	if (r) {
+		memcpy(r->data, data, size);
+	}
+
+	return r;
+}
+
 static void usb_hid_buf_free(struct usb_hid_buf *report_buf)
 {
 	report_buf->status_bm = 0;
@@ -308,6 +319,10 @@ static void usb_hid_buf_send(struct usb_hid_device *usb_hid, struct usb_hid_buf
 
 	int err;
 
+	if (IS_ENABLED(CONFIG_DESKTOP_HID_LATENCY_MEAS_ENABLE)) {
+		hid_latency_meas_stamp(HID_LATENCY_MEAS_POINT_TRANSPORT_SUBMIT, report_id);
+	}
+
 	if (IS_ENABLED(CONFIG_DESKTOP_USB_STACK_NEXT)) {
 		err = hid_device_submit_report(usb_hid->dev, size, data);
 	} else {
@@ -517,6 +532,49 @@ static struct usb_hid_device *subscriber_to_usb_hid(const void *subscriber)
 	return NULL;
 }
 
+static void usb_hid_buf_submit(struct usb_hid_device *usb_hid, struct usb_hid_buf *new_buf)
+{
+	struct usb_hid_buf *sending_buf = usb_hid_buf_find(usb_hid, USB_HID_BUF_SENDING);
+
+	/* Send HID report instantly only if there is no report that is currently being sent.
+	 * Otherwise wait until the previous report is sent.
+	 */
+	if (!sending_buf) {
+		usb_hid_buf_send(usb_hid, new_buf);
+	} else {
+		__ASSERT_NO_MSG(sending_buf->status_bm & USB_HID_BUF_ALLOCATED);
+	}
+}
+
+static int hid_report_direct_submit(const void *subscriber, uint8_t report_id,
+				    const uint8_t *data, size_t size)
+{
+	/* Ensure that the function is executed in a cooperative thread context and no extra
+	 * synchronization is required.
+	 */
+	__ASSERT_NO_MSG(!k_is_in_isr());
+	__ASSERT_NO_MSG(!k_is_preempt_thread());
+
+	struct usb_hid_device *usb_hid = subscriber_to_usb_hid(subscriber);
+
+	if (!usb_hid) {
+		return -ENOENT;
+	}
+
+	struct usb_hid_buf *new_buf = usb_hid_buf_alloc_raw(usb_hid, sizeof(report_id) + size);
+
+	if (!new_buf) {
+		return -ENOBUFS;
+	}
+
+	new_buf->data[0] = report_id;
+	memcpy(&new_buf->data[1], data, size);
+
+	usb_hid_buf_submit(usb_hid, new_buf);
+
+	return 0;
+}
+
 static bool handle_hid_report_event(struct hid_report_event *event)
 {
 	/* Ensure that the function is executed in a cooperative thread context and no extra
@@ -532,21 +590,18 @@ static bool handle_hid_report_event(struct hid_report_event *event)
 		return false;
 	}
 
+	if (IS_ENABLED(CONFIG_DESKTOP_USB_HID_REPORT_DIRECT)) {
+		/* The report was already delivered using hid_report_direct_submit. */
+		return false;
+	}
+
 	const uint8_t *data = event->dyndata.data;
 	size_t size = event->dyndata.size;
-	struct usb_hid_buf *sending_buf = usb_hid_buf_find(usb_hid, USB_HID_BUF_SENDING);
 	struct usb_hid_buf *new_buf = usb_hid_buf_alloc(usb_hid, data, size);
 
 	__ASSERT_NO_MSG(new_buf);
 
-	/* Send HID report instantly only if there is no report that is currently being sent.
-	 * Otherwise wait until the previous report is sent.
-	 */
-	if (!sending_buf) {
-		usb_hid_buf_send(usb_hid, new_buf);
-	} else {
-		__ASSERT_NO_MSG(sending_buf->status_bm & USB_HID_BUF_ALLOCATED);
-	}
+	usb_hid_buf_submit(usb_hid, new_buf);
 
 	return false;
 }
@@ -568,6 +623,8 @@ static void broadcast_subscriber_change(struct usb_hid_device *usb_hid)
 	event->params.pipeline_size = USB_SUBSCRIBER_PIPELINE_SIZE;
 	event->params.priority = USB_SUBSCRIBER_PRIORITY;
 	event->params.report_max = USB_SUBSCRIBER_REPORT_MAX;
+	event->params.direct_submit = IS_ENABLED(CONFIG_DESKTOP_USB_HID_REPORT_DIRECT) ?
+				      hid_report_direct_submit : NULL;
 	event->connected = usb_hid->enabled;
 
 	APP_EVENT_SUBMIT(event);
@@ -13,6 +13,7 @@
 #define MODULE config_channel_transport
 #define TRANSPORT_HEADER_SIZE		4
 #define CONFIG_STATUS_POS		2
+#define DATA_LEN_POS			3
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_CONFIG_CHANNEL_LOG_LEVEL);
@@ -154,6 +155,96 @@ static void drop_transactions(struct config_channel_transport *transport)
 	transport->transport_id++;
 }
 
+#if CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0
+static bool request_enqueue(struct config_channel_transport *transport,
+			    const uint8_t *buffer, size_t length)
+{
+	/* Only set requests can be queued. The frame is verified before it is
+	 * queued, because a queued request cannot be rejected later.
+	 */
+	if (frame_length_check(length) ||
+	    (buffer[CONFIG_STATUS_POS] != CONFIG_STATUS_SET) ||
+	    data_len_check(buffer[DATA_LEN_POS]) ||
+	    ((length - TRANSPORT_HEADER_SIZE) < buffer[DATA_LEN_POS])) {
+		return false;
+	}
+
+	if (transport->queue_cnt == CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE) {
+		return false;
+	}
+
+	uint8_t idx = (transport->queue_head + transport->queue_cnt) %
+		      CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE;
+
+	memcpy(transport->queue[idx], buffer, length);
+	transport->queue_len[idx] = length;
+	transport->queue_cnt++;
+
+	return true;
+}
+
+static bool request_dequeue(struct config_channel_transport *transport,
+			    uint8_t *buffer, size_t *length)
+{
+	if (transport->queue_cnt == 0) {
+		return false;
+	}
+
+	uint8_t idx = transport->queue_head;
+
+	*length = transport->queue_len[idx];
+	memcpy(buffer, transport->queue[idx], *length);
+
+	transport->queue_head = (idx + 1) % CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE;
+	transport->queue_cnt--;
+
+	return true;
+}
+
+static void queue_reset(struct config_channel_transport *transport)
+{
+	if (transport->queue_cnt > 0) {
+		LOG_WRN("Dropped %" PRIu8 " queued requests", transport->queue_cnt);
+	}
+
+	transport->queue_head = 0;
+	transport->queue_cnt = 0;
+}
+
+static void queue_drop(struct config_channel_transport *transport)
+{
+	k_spinlock_key_t key = k_spin_lock(&transport->queue_lock);
+
+	queue_reset(transport);
+
+	k_spin_unlock(&transport->queue_lock, key);
+}
+#endif /* CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0 */
+
+static int request_submit(struct config_channel_transport *transport,
+			  const uint8_t *buffer, size_t length)
+{
+	struct config_event *event =
+		new_config_event(length - TRANSPORT_HEADER_SIZE);
+
+	int err = config_channel_report_parse(buffer, length, event);
+
+	if (err < 0) {
+		LOG_WRN("Received improper frame");
+		app_event_manager_free(event);
+		return -EINVAL;
+	}
+
+	event->transport_id = transport->transport_id;
+	event->is_request = true;
+	APP_EVENT_SUBMIT(event);
+
+	BUILD_ASSERT(CONFIG_DESKTOP_CONFIG_CHANNEL_TIMEOUT > 0, "");
+	k_work_reschedule(&transport->timeout, K_SECONDS(CONFIG_DESKTOP_CONFIG_CHANNEL_TIMEOUT));
+
+	return 0;
+}
+
 static void timeout_fn(struct k_work *work)
 {
 	struct config_channel_transport *transport = CONTAINER_OF(work,
@@ -165,6 +256,9 @@ static void timeout_fn(struct k_work *work)
 	/* Send response with timeout status, without aditional data. */
 	transport->data[CONFIG_STATUS_POS] = CONFIG_STATUS_TIMEOUT;
 	drop_transactions(transport);
+#if CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0
+	queue_drop(transport);
+#endif
 	transport->state = CONFIG_CHANNEL_TRANSPORT_RSP_READY;
 }
 
@@ -204,6 +298,18 @@ int config_channel_transport_set(struct config_channel_transport *transport,
 {
 	__ASSERT_NO_MSG(transport->state != CONFIG_CHANNEL_TRANSPORT_DISABLED);
 
+#if CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0
+	k_spinlock_key_t key = k_spin_lock(&transport->queue_lock);
+	bool queued = (transport->state == CONFIG_CHANNEL_TRANSPORT_WAIT_RSP) &&
+		      request_enqueue(transport, buffer, length);
+
+	k_spin_unlock(&transport->queue_lock, key);
+
+	if (queued) {
+		return 0;
+	}
+#endif
+
 	if (transport->state == CONFIG_CHANNEL_TRANSPORT_WAIT_RSP) {
 		LOG_WRN("Transport %p busy", (void *)transport);
 		return -EBUSY;
@@ -214,24 +320,12 @@ int config_channel_transport_set(struct config_channel_transport *transport,
 			(void *)transport);
 	}
 
-	struct config_event *event =
-		new_config_event(length - TRANSPORT_HEADER_SIZE);
+	int err = request_submit(transport, buffer, length);
 
-	int err = config_channel_report_parse(buffer, length, event);
-
-	if (err < 0) {
-		LOG_WRN("Received improper frame");
-		app_event_manager_free(event);
-		return -EINVAL;
+	if (err) {
+		return err;
 	}
 
-	event->transport_id = transport->transport_id;
-	event->is_request = true;
-	APP_EVENT_SUBMIT(event);
-
-	BUILD_ASSERT(CONFIG_DESKTOP_CONFIG_CHANNEL_TIMEOUT > 0, "");
-	k_work_reschedule(&transport->timeout, K_SECONDS(CONFIG_DESKTOP_CONFIG_CHANNEL_TIMEOUT));
-
 	/* Store the data to send it as pending response. */
 	fill_response_pending(transport->data);
 	transport->data_len = TRANSPORT_HEADER_SIZE;
@@ -269,6 +363,33 @@ bool config_channel_transport_rsp_receive(struct config_channel_transport *trans
 		event->dyndata.size = 0;
 	}
 
+#if CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0
+	/* The lock is held until the response is ready, so that no request is
+	 * queued after the queue is found empty.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&transport->queue_lock);
+
+	if (event->status == CONFIG_STATUS_SUCCESS) {
+		uint8_t buffer[REPORT_SIZE_USER_CONFIG];
+		size_t length;
+
+		/* Response is provided to the host after all queued requests are handled. */
+		if (request_dequeue(transport, buffer, &length)) {
+			k_spin_unlock(&transport->queue_lock, key);
+
+			int err = request_submit(transport, buffer, length);
+
+			__ASSERT_NO_MSG(!err);
+			ARG_UNUSED(err);
+
+			return true;
+		}
+	} else {
+		/* Provide the response of the failed request and drop the rest of the window. */
+		queue_reset(transport);
+	}
+#endif
+
 	int pos = config_channel_report_fill(transport->data,
 				event->dyndata.size + TRANSPORT_HEADER_SIZE,
 				event);
@@ -278,6 +399,10 @@ bool config_channel_transport_rsp_receive(struct config_channel_transport *trans
 
 	transport->state = CONFIG_CHANNEL_TRANSPORT_RSP_READY;
 
+#if CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0
+	k_spin_unlock(&transport->queue_lock, key);
+#endif
+
 	int err = k_work_cancel_delayable(&transport->timeout);
 
 	__ASSERT_NO_MSG(!err);
@@ -294,6 +419,9 @@ void config_channel_transport_disconnect(struct config_channel_transport *transp
 	if (transport->state == CONFIG_CHANNEL_TRANSPORT_WAIT_RSP) {
 		drop_transactions(transport);
 	}
+#if CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0
+	queue_drop(transport);
+#endif
 	transport->state = CONFIG_CHANNEL_TRANSPORT_IDLE;
 
 	int err = k_work_cancel_delayable(&transport->timeout);
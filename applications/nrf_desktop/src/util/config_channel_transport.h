@@ -14,6 +14,8 @@
  * @brief API for the configuration channel transport.
  */
 
+#include <zephyr/spinlock.h>
+
 #include "config_event.h"
 
 #ifdef __cplusplus
@@ -55,6 +57,9 @@ enum config_channel_transport_state {
 	CONFIG_CHANNEL_TRANSPORT_RSP_READY
 };
 
+/** @brief Number of set requests queued while a request is in progress. */
+#define CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE (CONFIG_DESKTOP_CONFIG_CHANNEL_WINDOW_SIZE - 1)
+
 /** @brief Configuration channel transport. */
 struct config_channel_transport {
 	struct k_work_delayable timeout;
@@ -62,6 +67,15 @@ struct config_channel_transport {
 	uint16_t transport_id;
 	uint8_t data[REPORT_SIZE_USER_CONFIG];
 
+#if CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE > 0
+	/* Set requests waiting for the response to the previous request. */
+	uint8_t queue[CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE][REPORT_SIZE_USER_CONFIG];
+	uint8_t queue_len[CONFIG_CHANNEL_TRANSPORT_QUEUE_SIZE];
+	uint8_t queue_head;
+	uint8_t queue_cnt;
+	struct k_spinlock queue_lock;
+#endif
+
 	enum config_channel_transport_state state;
 };
 
@@ -88,6 +102,12 @@ int config_channel_transport_get(struct config_channel_transport *transport,
 /**
  * @brief Handle a set operation on the configuration channel.
  *
+ * If a request is in progress, a set request is queued if the transport
+ * window (CONFIG_DESKTOP_CONFIG_CHANNEL_WINDOW_SIZE) is not full. The queued
+ * requests are submitted one by one and the response is ready after all of
+ * them are handled. The response of the first failed request is provided and
+ * the subsequent requests are dropped.
+ *
  * @param transport Pointer to the configuration channel transport instance.
  * @param buffer    Pointer to the report buffer to be parsed to handle
  *                  the set request.
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _HID_LATENCY_MEAS_H_
+#define _HID_LATENCY_MEAS_H_
+
+#include <zephyr/types.h>
+
+/**
+ * @defgroup hid_latency_meas HID latency measurement API
+ * @brief HID latency measurement API
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Points of the HID mouse report path that are timestamped. */
+enum hid_latency_meas_point {
+	/** Motion was read from the motion sensor. */
+	HID_LATENCY_MEAS_POINT_SENSOR_READ,
+
+	/** HID report was sent by the HID state module. */
+	HID_LATENCY_MEAS_POINT_REPORT_SEND,
+
+	/** HID report was submitted to the Bluetooth or USB stack. */
+	HID_LATENCY_MEAS_POINT_TRANSPORT_SUBMIT,
+
+	/** HID report sent event was received. */
+	HID_LATENCY_MEAS_POINT_REPORT_SENT,
+
+	/** Number of measurement points. */
+	HID_LATENCY_MEAS_POINT_COUNT
+};
+
+/** Timestamp a point of the HID report path.
+ *
+ * Only one HID mouse report is measured at a time. The measurement is started
+ * by the motion sensor read and the subsequent points are timestamped for the
+ * first HID mouse report that reaches them. Timestamps of other HID reports
+ * are ignored.
+ *
+ * The function can be called from any thread context.
+ *
+ * @param point		Measurement point.
+ * @param report_id	ID of the HID report.
+ */
+void hid_latency_meas_stamp(enum hid_latency_meas_point point, uint8_t report_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _HID_LATENCY_MEAS_H_ */
@@ -35,6 +35,7 @@ struct hid_reportq {
 	uint8_t report_max;
 	uint8_t report_cnt;
 	const void *sub_id;
+	hid_report_direct_submit_t direct_submit;
 };
 
 static struct hid_reportq queues[CONFIG_DESKTOP_HID_REPORTQ_QUEUE_COUNT];
@@ -128,7 +129,8 @@ static struct hid_reportq *reportq_find_free(void)
 	return NULL;
 }
 
-struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max)
+struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max,
+				      hid_report_direct_submit_t direct_submit)
 {
 	__ASSERT_NO_MSG(sub_id);
 	__ASSERT_NO_MSG(report_max > 0);
@@ -151,6 +153,7 @@ struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max)
 
 	q->sub_id = sub_id;
 	q->report_max = report_max;
+	q->direct_submit = direct_submit;
 
 	return q;
 }
@@ -169,6 +172,7 @@ void hid_reportq_free(struct hid_reportq *q)
 	q->report_max = 0;
 	q->report_cnt = 0;
 	q->sub_id = NULL;
+	q->direct_submit = NULL;
 }
 
 const void *hid_reportq_get_sub_id(struct hid_reportq *q)
@@ -210,6 +214,17 @@ int hid_reportq_report_add(struct hid_reportq *q, const void *src_id, uint8_t re
 		return -EACCES;
 	}
 
+	bool send_now = (q->report_cnt < q->report_max);
+
+	if (send_now && q->direct_submit) {
+		/* Deliver the report before the event is allocated to reduce the latency. */
+		int err = q->direct_submit(q->sub_id, rep_id, data, size);
+
+		if (err) {
+			return err;
+		}
+	}
+
 	struct hid_report_event *event = new_hid_report_event(sizeof(rep_id) + size);
 
 	event->source = src_id;
@@ -219,7 +234,7 @@ int hid_reportq_report_add(struct hid_reportq *q, const void *src_id, uint8_t re
 	event->dyndata.data[0] = rep_id;
 	memcpy(&event->dyndata.data[1], data, size);
 
-	if (q->report_cnt < q->report_max) {
+	if (send_now) {
 		APP_EVENT_SUBMIT(event);
 		q->last_sent_report_idx = rep_idx;
 		q->report_cnt++;
@@ -258,6 +273,17 @@ void hid_reportq_report_sent(struct hid_reportq *q, uint8_t rep_id, bool err)
 
 	struct hid_report_event *event = get_next_enqueued_event(q);
 
+	if (event && q->direct_submit) {
+		int err = q->direct_submit(q->sub_id, event->dyndata.data[0],
+					   &event->dyndata.data[1], event->dyndata.size - 1);
+
+		if (err) {
+			LOG_WRN("Direct submit of enqueued report failed (err: %d)", err);
+			app_event_manager_free(event);
+			event = NULL;
+		}
+	}
+
 	if (event) {
 		APP_EVENT_SUBMIT(event);
 	} else {
@@ -11,6 +11,8 @@
 #ifndef _HID_REPORTQ_H_
 #define _HID_REPORTQ_H_
 
+#include "hid_event.h"
+
 /**
  * @defgroup hid_reportq HID report queue
  * @brief Utility that simplifies queuing HID reports from HID peripherals on a HID dongle.
@@ -30,14 +32,21 @@ struct hid_reportq;
  *
  * The function allocates HID report queue object instance from internal pool.
  *
+ * If the direct submit function is provided, the HID reports are delivered to the HID subscriber
+ * using the function before the related HID report event is allocated. The HID report event is
+ * still submitted afterwards to notify other application modules about the HID report.
+ *
  * @param[in] sub_id		ID of related HID subscriber.
  * @param[in] report_max	Maximum number of reports with different ID, which can be processed
  *                              by related HID subscriber.
+ * @param[in] direct_submit	Function that delivers HID reports directly to the HID subscriber
+ *				or NULL if not supported by the subscriber.
  *
  * @return Pointer to the allocated HID report queue object instance or NULL in case of too small
  *         object pool.
  */
-struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max);
+struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max,
+				      hid_report_direct_submit_t direct_submit);
 
 /**
  * @brief Free HID report queue object instance.
@@ -357,3 +357,22 @@ function(import_pm_config dotconf_file keys_out)
   endforeach()
   set("${keys_out}" "${keys}" PARENT_SCOPE)
 endfunction()
+
+#
+# Usage
+#   ncs_generate_sha256_inc_file(<source_file> <generated_file>)
+#
+# Generate <generated_file> with the SHA-256 digest of <source_file> as a
+# comma-separated list of bytes, which can be included in a C array initializer.
+# The digest is regenerated when <source_file> changes.
+#
+# Example usage:
+#   ncs_generate_sha256_inc_file(${CMAKE_CURRENT_SOURCE_DIR}/cert/ca.pem
+#                                ${ZEPHYR_BINARY_DIR}/include/generated/ca.pem.sha256.inc)
+#
+function(ncs_generate_sha256_inc_file source_file generated_file)
+  file(SHA256 ${source_file} digest)
+  string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1, " digest_bytes "${digest}")
+  file(CONFIGURE OUTPUT ${generated_file} CONTENT "${digest_bytes}\n")
+  set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${source_file})
+endfunction()
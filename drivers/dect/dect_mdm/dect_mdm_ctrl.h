@@ -57,13 +57,6 @@ struct dect_mdm_ctrl_api_tx_cmd_params {
 	uint32_t transaction_id;
 };
 
-struct dect_mdm_ctrl_dlc_rx_data_with_pkt_ptr {
-	struct net_if *iface;
-	struct nrf_modem_dect_dlc_data_rx_ntf_cb_params mdm_params;
-	size_t data_len;
-	struct net_pkt *pkt;
-};
-
 
 #define DECT_MDM_DLC_DATA_INFO_MAX_COUNT 40
 #define DECT_MDM_RSSI_MEAS_ARR_SIZE (DECT_RSSI_MEAS_SUBSLOT_COUNT / 8)
@@ -224,19 +224,10 @@ dect_mdm_ctrl_mdm_dlc_data_rx_ntf_cb(struct nrf_modem_dect_dlc_data_rx_ntf_cb_pa
 		return;
 	}
 
-	/* Prepare data for RX thread processing */
-	struct dect_mdm_ctrl_dlc_rx_data_with_pkt_ptr mdm_dlc_data_with_pkt_ptr_params;
-
-	mdm_dlc_data_with_pkt_ptr_params.mdm_params = *params;
-	mdm_dlc_data_with_pkt_ptr_params.data_len = params->data_len;
-	/* See comment above: iface is safe to read without mutex in ISR context */
-	mdm_dlc_data_with_pkt_ptr_params.iface = ctrl_data.iface;
-	mdm_dlc_data_with_pkt_ptr_params.pkt = rcv_pkt;
-
-	/* Queue for processing in RX thread */
-	ret = dect_mdm_rx_msgq_data_op_add(
-		DECT_MDM_RX_OP_RX_DATA_WITH_PKT_PTR, (void *)&mdm_dlc_data_with_pkt_ptr_params,
-		sizeof(struct dect_mdm_ctrl_dlc_rx_data_with_pkt_ptr));
+	/* Queue for processing in RX thread.
+	 * See comment above: iface is safe to read without mutex in ISR context.
+	 */
+	ret = dect_mdm_rx_pkt_queue(ctrl_data.iface, rcv_pkt, params);
 	if (ret) {
 		printk("%s: Failed to queue RX data for processing, err=%d\n", __func__, ret);
 		net_pkt_unref(rcv_pkt); /* Clean up packet if queueing fails */
@@ -26,46 +26,38 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(dect_mdm, CONFIG_DECT_MDM_LOG_LEVEL);
 
-K_MSGQ_DEFINE(dect_mdm_rx_th_op_event_msgq, sizeof(struct dect_mdm_common_op_event_msgq_item),
+/* Received packets are queued by value together with the few fields of the modem
+ * notification that are needed for delivery, so that the modem callback does not need
+ * to allocate or copy any event data in addition to the net_pkt itself.
+ */
+struct dect_mdm_rx_pkt_item {
+	struct net_if *iface;
+	struct net_pkt *pkt;
+	uint32_t long_rd_id;
+	uint32_t data_len;
+	uint8_t flow_id;
+};
+
+K_MSGQ_DEFINE(dect_mdm_rx_pkt_msgq, sizeof(struct dect_mdm_rx_pkt_item),
 	      CONFIG_DECT_MDM_NRF_RX_MSGQ_SIZE, 4);
 
 #define DECT_MDM_RX_THREAD_STACK_SIZE CONFIG_DECT_MDM_NRF_RX_THREAD_STACK_SIZE
 #define DECT_MDM_RX_THREAD_PRIORITY   5
 
-/* Memory Pool for RX Event Data */
-
-/* Simple memory pool for RX event data - sized for the main structure we need */
-#define DECT_RX_EVENT_POOL_BLOCK_SIZE sizeof(struct dect_mdm_ctrl_dlc_rx_data_with_pkt_ptr)
-
-#ifndef CONFIG_DECT_MDM_NRF_RX_EVENT_POOL_COUNT
-#define CONFIG_DECT_MDM_NRF_RX_EVENT_POOL_COUNT 10
-#endif
-
-K_MEM_SLAB_DEFINE_STATIC(dect_rx_event_slab, DECT_RX_EVENT_POOL_BLOCK_SIZE,
-			 CONFIG_DECT_MDM_NRF_RX_EVENT_POOL_COUNT, 4);
-
-static bool dect_mdm_data_rx_with_pkt_ptr(struct dect_mdm_ctrl_dlc_rx_data_with_pkt_ptr *params)
+static bool dect_mdm_data_rx_pkt(const struct dect_mdm_rx_pkt_item *item,
+				 const struct net_linkaddr *ll_dst)
 {
 	struct net_linkaddr ll_src;
-	struct net_linkaddr ll_dst;
 	/* Pkt has been allocated and written, now set the addressing part */
-	struct net_pkt *rcv_pkt = params->pkt;
-
+	struct net_pkt *rcv_pkt = item->pkt;
 	int ret;
-	bool handled = false;
 
 	__ASSERT_NO_MSG(rcv_pkt != NULL);
 
-	/* Set ll source and destination addresses based on long RD IDs:
-	 * src as received and dst as configured in this device for long rd id
-	 */
-	struct dect_mdm_settings *set_ptr = dect_mdm_settings_ref_get();
-
-	dect_utils_lib_net_linkaddr_set_from_long_rd_id(&ll_src, params->mdm_params.long_rd_id);
-	dect_utils_lib_net_linkaddr_set_from_long_rd_id(
-		&ll_dst, set_ptr->net_mgmt_common.identities.transmitter_long_rd_id);
+	/* Set ll source address based on the received long RD ID */
+	dect_utils_lib_net_linkaddr_set_from_long_rd_id(&ll_src, item->long_rd_id);
 
-	ret = net_linkaddr_set(net_pkt_lladdr_dst(rcv_pkt), ll_dst.addr, ll_dst.len);
+	ret = net_linkaddr_set(net_pkt_lladdr_dst(rcv_pkt), ll_dst->addr, ll_dst->len);
 	if (ret < 0) {
 		LOG_ERR("%s: cannot set destination link address, ret %d", (__func__), ret);
 		net_pkt_unref(rcv_pkt);
@@ -79,78 +71,50 @@ static bool dect_mdm_data_rx_with_pkt_ptr(struct dect_mdm_ctrl_dlc_rx_data_with_
 		return false;
 	}
 
-	ret = net_recv_data(params->iface, rcv_pkt);
+	ret = net_recv_data(item->iface, rcv_pkt);
 	if (ret < 0) {
 		LOG_ERR("%s: received packet dropped from %u (%d bytes), ret %d", (__func__),
-			params->mdm_params.long_rd_id, params->data_len, ret);
+			item->long_rd_id, item->data_len, ret);
 		net_pkt_unref(rcv_pkt);
-	} else {
-		LOG_DBG("%s: received packet from %u (%d bytes)", (__func__),
-			params->mdm_params.long_rd_id, params->data_len);
-		handled = true;
-	}
-	return handled;
-}
-
-/* Memory pool allocation helper */
-static void *dect_mdm_rx_event_alloc(size_t size)
-{
-	void *ptr = NULL;
-
-	if (size > DECT_RX_EVENT_POOL_BLOCK_SIZE) {
-		printk("%s: Event size %zu exceeds pool block size %d\n", __func__,
-			size, DECT_RX_EVENT_POOL_BLOCK_SIZE);
-		return NULL;
-	}
-	if (k_mem_slab_alloc(&dect_rx_event_slab, &ptr, K_NO_WAIT) != 0) {
-		printk("Failed to allocate memory from RX event pool\n");
-		return NULL;
+		return false;
 	}
-	return ptr;
-}
 
-/* Memory pool free helper */
-static void dect_mdm_rx_event_free(void *ptr)
-{
-	if (ptr == NULL) {
-		return;
-	}
-	k_mem_slab_free(&dect_rx_event_slab, ptr);
+	LOG_DBG("%s: received packet from %u (%d bytes)", (__func__), item->long_rd_id,
+		item->data_len);
+	return true;
 }
 
 static void dect_mdm_rx_th_op_handler_thread_fn(void)
 {
-	struct dect_mdm_common_op_event_msgq_item event;
+	struct dect_mdm_rx_pkt_item item;
+	struct net_linkaddr ll_dst;
+	int count;
 
 	while (true) {
-		k_msgq_get(&dect_mdm_rx_th_op_event_msgq, &event, K_FOREVER);
+		k_msgq_get(&dect_mdm_rx_pkt_msgq, &item, K_FOREVER);
+
+		/* The destination is the long RD ID configured in this device, which is the
+		 * same for all packets of the batch.
+		 */
+		struct dect_mdm_settings *set_ptr = dect_mdm_settings_ref_get();
 
-		switch (event.id) {
-		case DECT_MDM_RX_OP_RX_DATA_WITH_PKT_PTR: {
-			struct dect_mdm_ctrl_dlc_rx_data_with_pkt_ptr *params =
-				(struct dect_mdm_ctrl_dlc_rx_data_with_pkt_ptr *)event.data;
-			bool data_handled = false;
+		dect_utils_lib_net_linkaddr_set_from_long_rd_id(
+			&ll_dst, set_ptr->net_mgmt_common.identities.transmitter_long_rd_id);
 
+		/* Deliver the packets received within the same frame in one go */
+		count = 0;
+		do {
 			LOG_DBG("DLC data received to iface %p, transmitter: %u (0x%X), "
 				"flow ID: %hhu, data_len: %u",
-				params->iface, params->mdm_params.long_rd_id,
-				params->mdm_params.long_rd_id, params->mdm_params.flow_id,
-				params->data_len);
-
-			data_handled = dect_mdm_data_rx_with_pkt_ptr(params);
-			if (!data_handled) {
-				LOG_ERR("DECT_MDM_RX_OP_RX_DATA_WITH_PKT_PTR: Cannot pass DLC RX "
-					"data upwards in stack (len %d)",
-					params->data_len);
+				item.iface, item.long_rd_id, item.long_rd_id, item.flow_id,
+				item.data_len);
+
+			if (!dect_mdm_data_rx_pkt(&item, &ll_dst)) {
+				LOG_ERR("Cannot pass DLC RX data upwards in stack (len %d)",
+					item.data_len);
 			}
-			break;
-		}
-		default:
-			LOG_ERR("DECT RX: Unknown event %d received", event.id);
-			break;
-		}
-		/* Free memory back to pool */
-		dect_mdm_rx_event_free(event.data);
+		} while (++count < CONFIG_DECT_MDM_NRF_RX_BATCH_SIZE &&
+			 k_msgq_get(&dect_mdm_rx_pkt_msgq, &item, K_NO_WAIT) == 0);
 	}
 }
 
@@ -158,36 +122,26 @@ K_THREAD_DEFINE(dect_mdm_rx_th, DECT_MDM_RX_THREAD_STACK_SIZE,
 		dect_mdm_rx_th_op_handler_thread_fn, NULL, NULL, NULL,
 		K_PRIO_PREEMPT(DECT_MDM_RX_THREAD_PRIORITY), 0, 0);
 
-int dect_mdm_rx_msgq_data_op_add(uint16_t event_id, void *data, size_t data_size)
+int dect_mdm_rx_pkt_queue(struct net_if *iface, struct net_pkt *pkt,
+			  const struct nrf_modem_dect_dlc_data_rx_ntf_cb_params *params)
 {
-	int ret = 0;
-	struct dect_mdm_common_op_event_msgq_item event;
+	struct dect_mdm_rx_pkt_item item;
+	int ret;
 
 	/* Input validation */
-	if (data == NULL || data_size == 0) {
+	if (pkt == NULL || params == NULL) {
 		return -EINVAL;
 	}
 
-	/* Allocate from memory pool */
-	event.data = dect_mdm_rx_event_alloc(data_size);
-	if (event.data == NULL) {
-		return -ENOMEM;
-	}
-
-	/* Copy data and set up event */
-	memcpy(event.data, data, data_size);
-	event.id = event_id;
+	item.iface = iface;
+	item.pkt = pkt;
+	item.long_rd_id = params->long_rd_id;
+	item.data_len = params->data_len;
+	item.flow_id = params->flow_id;
 
-	/* Try to put in message queue */
-	ret = k_msgq_put(&dect_mdm_rx_th_op_event_msgq, &event, K_NO_WAIT);
+	ret = k_msgq_put(&dect_mdm_rx_pkt_msgq, &item, K_NO_WAIT);
 	if (ret) {
-		if (ret == -ENOMSG) {
-			printk("RX message queue full, dropping event %u\n", event_id);
-		} else {
-			printk("Failed to put event %d to RX message queue, err: %d\n",
-				event_id, ret);
-		}
-		dect_mdm_rx_event_free(event.data);
+		printk("RX message queue full, dropping packet (len=%d)\n", params->data_len);
 		return -ENOBUFS;
 	}
 	return 0;
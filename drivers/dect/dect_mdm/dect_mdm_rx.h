@@ -8,17 +8,21 @@
 #define DECT_MDM_RX_H
 
 #include <zephyr/kernel.h>
-
-#define DECT_MDM_RX_OP_RX_DATA_WITH_PKT_PTR 1
+#include <zephyr/net/net_pkt.h>
+#include <nrf_modem_dect.h>
 
 /**
- * @brief Add RX operation to message queue for processing.
- * @param event_id Event type identifier (DECT_MDM_RX_OP_*).
- * @param data Pointer to event data (must not be NULL).
- * @param data_size Size of event data (must be > 0).
- * @return 0 on success, -EINVAL for invalid params, -ENOMEM for allocation failure,
- *         -ENOBUFS if message queue is full.
+ * @brief Queue received packet for delivery to the network stack in RX thread.
+ *
+ * The packet is queued by value, so this can be called from modem callback (ISR) context.
+ * On success, the ownership of the packet is taken over.
+ *
+ * @param iface Network interface the packet was received on.
+ * @param pkt Packet holding the received data (must not be NULL).
+ * @param params Modem notification parameters of the received data (must not be NULL).
+ * @return 0 on success, -EINVAL for invalid params, -ENOBUFS if message queue is full.
  */
-int dect_mdm_rx_msgq_data_op_add(uint16_t event_id, void *data, size_t data_size);
+int dect_mdm_rx_pkt_queue(struct net_if *iface, struct net_pkt *pkt,
+			  const struct nrf_modem_dect_dlc_data_rx_ntf_cb_params *params);
 
 #endif /* DECT_MDM_RX_H */
@@ -41,11 +41,41 @@ NRF_RPC_GROUP_DEFINE(flash_rpc_api, "flash_rpc_api", &flash_rpc_api_tr, NULL, NU
 
 #define FLASH_RPC_PAGE_COUNT (FLASH_RPC_FLASH_SIZE/FLASH_RPC_ERASE_UNIT)
 
+#define FLASH_RPC_LOCK_NEEDED \
+	(IS_ENABLED(CONFIG_FLASH_RPC_READ_CACHE) || IS_ENABLED(CONFIG_FLASH_RPC_WRITE_BUFFER))
+
 static const struct flash_parameters flash_rpc_parameters = {
 	.write_block_size = FLASH_RPC_PROG_UNIT,
 	.erase_value = 0xff,
 };
 
+#if FLASH_RPC_LOCK_NEEDED
+static K_MUTEX_DEFINE(flash_rpc_lock);
+#endif
+
+#if defined(CONFIG_FLASH_RPC_READ_CACHE)
+struct read_cache_page {
+	/* Offset of the cached page, -1 if the entry is not used. */
+	off_t offset;
+	uint32_t last_use;
+	uint8_t __aligned(4) data[FLASH_RPC_ERASE_UNIT];
+};
+
+static struct read_cache_page read_cache[CONFIG_FLASH_RPC_READ_CACHE_PAGES];
+static uint32_t read_cache_use;
+#endif
+
+#if defined(CONFIG_FLASH_RPC_WRITE_BUFFER)
+static struct {
+	struct k_work_delayable flush_work;
+	off_t offset;
+	size_t len;
+	/* Error of the last deferred write. */
+	int err;
+	uint8_t __aligned(4) data[FLASH_RPC_ERASE_UNIT];
+} write_buf;
+#endif
+
 static void flash_rpc_get_rsp(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				 void *handler_data)
 {
@@ -92,6 +122,16 @@ int flash_rpc_init(const struct device *dev)
 
 	ARG_UNUSED(dev_config);
 
+#if defined(CONFIG_FLASH_RPC_READ_CACHE)
+	for (size_t i = 0; i < ARRAY_SIZE(read_cache); i++) {
+		read_cache[i].offset = -1;
+	}
+#endif
+
+#if defined(CONFIG_FLASH_RPC_WRITE_BUFFER)
+	k_work_init_delayable(&write_buf.flush_work, write_buf_flush_work);
+#endif
+
 #ifndef CONFIG_FLASH_RPC_SYS_INIT
 	err = nrf_rpc_init(err_handler);
 	if (err) {
@@ -112,21 +152,12 @@ int flash_rpc_init(const struct device *dev)
 	return result;
 }
 
-int flash_rpc_read(const struct device *dev, off_t offset, void *buffer, size_t len)
+static int rpc_read(off_t offset, void *buffer, size_t len)
 {
-	ARG_UNUSED(dev);
 	int err;
 	int result;
 	struct nrf_rpc_cbor_ctx ctx;
 
-	if (len == 0) {
-		return 0;
-	}
-
-	if (buffer == NULL) {
-		return -EINVAL;
-	}
-
 	if (!encode_flash_msg(&ctx, &offset, buffer, &len)) {
 		LOG_ERR("Could not encode flash_rpc message");
 		return -EMSGSIZE;
@@ -144,20 +175,27 @@ int flash_rpc_read(const struct device *dev, off_t offset, void *buffer, size_t
 	return result;
 }
 
-int flash_rpc_write(const struct device *dev, off_t offset, const void *data, size_t len)
+static void read_cache_invalidate(off_t offset, size_t len)
+{
+#if defined(CONFIG_FLASH_RPC_READ_CACHE)
+	for (size_t i = 0; i < ARRAY_SIZE(read_cache); i++) {
+		struct read_cache_page *page = &read_cache[i];
+
+		if ((page->offset >= 0) && (page->offset < offset + (off_t)len) &&
+		    (page->offset + FLASH_RPC_ERASE_UNIT > offset)) {
+			page->offset = -1;
+		}
+	}
+#endif
+}
+
+static int rpc_write(off_t offset, const void *data, size_t len)
 {
-	ARG_UNUSED(dev);
 	int err;
 	int result;
 	struct nrf_rpc_cbor_ctx ctx;
 
-	if (len == 0) {
-		return 0;
-	}
-
-	if (data == NULL) {
-		return -EINVAL;
-	}
+	read_cache_invalidate(offset, len);
 
 	if (!encode_flash_msg(&ctx, &offset, (void *)data, &len)) {
 		return -EMSGSIZE;
@@ -175,14 +213,15 @@ int flash_rpc_write(const struct device *dev, off_t offset, const void *data, si
 	return result;
 }
 
-int flash_rpc_erase(const struct device *dev, off_t offset, size_t size)
+static int rpc_erase(off_t offset, size_t size)
 {
-	ARG_UNUSED(dev);
 	int err;
 	int result;
 
 	struct nrf_rpc_cbor_ctx ctx;
 
+	read_cache_invalidate(offset, size);
+
 	if (!encode_flash_msg(&ctx, &offset, NULL, &size)) {
 		return -EMSGSIZE;
 	}
@@ -197,6 +236,250 @@ int flash_rpc_erase(const struct device *dev, off_t offset, size_t size)
 	return result;
 }
 
+#if defined(CONFIG_FLASH_RPC_READ_CACHE)
+static struct read_cache_page *read_cache_get(off_t page_offset, int *err)
+{
+	struct read_cache_page *victim = &read_cache[0];
+
+	for (size_t i = 0; i < ARRAY_SIZE(read_cache); i++) {
+		struct read_cache_page *page = &read_cache[i];
+
+		if (page->offset == page_offset) {
+			page->last_use = ++read_cache_use;
+			return page;
+		}
+
+		/* Replace an unused or the least recently used page. */
+		if ((victim->offset >= 0) &&
+		    ((page->offset < 0) || (page->last_use < victim->last_use))) {
+			victim = page;
+		}
+	}
+
+	*err = rpc_read(page_offset, victim->data, FLASH_RPC_ERASE_UNIT);
+	if (*err) {
+		victim->offset = -1;
+		return NULL;
+	}
+
+	victim->offset = page_offset;
+	victim->last_use = ++read_cache_use;
+
+	return victim;
+}
+
+static int read_cached(off_t offset, uint8_t *buffer, size_t len)
+{
+	int err = 0;
+
+	while (len > 0) {
+		off_t page_offset = ROUND_DOWN(offset, FLASH_RPC_ERASE_UNIT);
+		size_t chunk = MIN(len, page_offset + FLASH_RPC_ERASE_UNIT - offset);
+		struct read_cache_page *page = read_cache_get(page_offset, &err);
+
+		if (page == NULL) {
+			return err;
+		}
+
+		memcpy(buffer, &page->data[offset - page_offset], chunk);
+		buffer += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_FLASH_RPC_WRITE_BUFFER)
+static int write_buf_flush(void)
+{
+	int err;
+
+	if (write_buf.len == 0) {
+		return 0;
+	}
+
+	(void)k_work_cancel_delayable(&write_buf.flush_work);
+
+	err = rpc_write(write_buf.offset, write_buf.data, write_buf.len);
+	write_buf.len = 0;
+
+	return err;
+}
+
+static void write_buf_flush_work(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&flash_rpc_lock, K_FOREVER);
+
+	err = write_buf_flush();
+	if (err) {
+		LOG_ERR("Deferred write failed: %d", err);
+		write_buf.err = err;
+	}
+
+	k_mutex_unlock(&flash_rpc_lock);
+}
+
+/* Read data is overlaid with the data waiting in the write buffer. */
+static void write_buf_overlay(off_t offset, uint8_t *buffer, size_t len)
+{
+	off_t start = MAX(offset, write_buf.offset);
+	off_t end = MIN(offset + (off_t)len, write_buf.offset + (off_t)write_buf.len);
+
+	if ((write_buf.len == 0) || (start >= end)) {
+		return;
+	}
+
+	memcpy(&buffer[start - offset], &write_buf.data[start - write_buf.offset], end - start);
+}
+
+static int write_buf_add(off_t offset, const void *data, size_t len)
+{
+	int err;
+
+	if (len >= sizeof(write_buf.data)) {
+		err = write_buf_flush();
+
+		return err ? err : rpc_write(offset, data, len);
+	}
+
+	/* Unaligned writes are rejected at once, as they would fail when flushed. */
+	if ((offset % FLASH_RPC_PROG_UNIT) || (len % FLASH_RPC_PROG_UNIT)) {
+		return -EINVAL;
+	}
+
+	if ((write_buf.len > 0) &&
+	    ((offset != write_buf.offset + (off_t)write_buf.len) ||
+	     (write_buf.len + len > sizeof(write_buf.data)))) {
+		err = write_buf_flush();
+		if (err) {
+			return err;
+		}
+	}
+
+	if (write_buf.len == 0) {
+		write_buf.offset = offset;
+	}
+
+	memcpy(&write_buf.data[write_buf.len], data, len);
+	write_buf.len += len;
+
+	if (write_buf.len == sizeof(write_buf.data)) {
+		return write_buf_flush();
+	}
+
+	k_work_schedule(&write_buf.flush_work, K_MSEC(CONFIG_FLASH_RPC_WRITE_BUFFER_TIMEOUT_MS));
+
+	return 0;
+}
+#endif
+
+int flash_rpc_read(const struct device *dev, off_t offset, void *buffer, size_t len)
+{
+	ARG_UNUSED(dev);
+	int err;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (buffer == NULL) {
+		return -EINVAL;
+	}
+
+#if FLASH_RPC_LOCK_NEEDED
+	k_mutex_lock(&flash_rpc_lock, K_FOREVER);
+
+#if defined(CONFIG_FLASH_RPC_READ_CACHE)
+	if (len < FLASH_RPC_ERASE_UNIT) {
+		err = read_cached(offset, buffer, len);
+	} else {
+		err = rpc_read(offset, buffer, len);
+	}
+#else
+	err = rpc_read(offset, buffer, len);
+#endif
+
+#if defined(CONFIG_FLASH_RPC_WRITE_BUFFER)
+	if (!err) {
+		write_buf_overlay(offset, buffer, len);
+	}
+#endif
+
+	k_mutex_unlock(&flash_rpc_lock);
+#else
+	err = rpc_read(offset, buffer, len);
+#endif
+
+	return err;
+}
+
+int flash_rpc_write(const struct device *dev, off_t offset, const void *data, size_t len)
+{
+	ARG_UNUSED(dev);
+	int err;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (data == NULL) {
+		return -EINVAL;
+	}
+
+#if FLASH_RPC_LOCK_NEEDED
+	k_mutex_lock(&flash_rpc_lock, K_FOREVER);
+
+#if defined(CONFIG_FLASH_RPC_WRITE_BUFFER)
+	/* Report the error of a deferred write. */
+	err = write_buf.err;
+	write_buf.err = 0;
+
+	if (!err) {
+		err = write_buf_add(offset, data, len);
+	}
+#else
+	err = rpc_write(offset, data, len);
+#endif
+
+	k_mutex_unlock(&flash_rpc_lock);
+#else
+	err = rpc_write(offset, data, len);
+#endif
+
+	return err;
+}
+
+int flash_rpc_erase(const struct device *dev, off_t offset, size_t size)
+{
+	ARG_UNUSED(dev);
+	int err;
+
+#if FLASH_RPC_LOCK_NEEDED
+	k_mutex_lock(&flash_rpc_lock, K_FOREVER);
+
+#if defined(CONFIG_FLASH_RPC_WRITE_BUFFER)
+	err = write_buf_flush();
+	if (!err) {
+		err = rpc_erase(offset, size);
+	}
+#else
+	err = rpc_erase(offset, size);
+#endif
+
+	k_mutex_unlock(&flash_rpc_lock);
+#else
+	err = rpc_erase(offset, size);
+#endif
+
+	return err;
+}
+
 static const struct flash_parameters *flash_rpc_get_parameters(const struct device *dev)
 {
 	ARG_UNUSED(dev);
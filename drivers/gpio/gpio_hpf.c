@@ -74,6 +74,38 @@ static int gpio_hpf_port_toggle_bits(const struct device *port, gpio_port_pins_t
 	return gpio_send(&msg);
 }
 
+#if defined(CONFIG_GPIO_HPF_STREAM)
+int gpio_hpf_stream_start(const struct device *port, gpio_port_pins_t mask,
+			  hpf_gpio_stream_t *stream)
+{
+	int ret;
+
+	if ((stream->len[0] == 0) || (stream->period == 0)) {
+		return -EINVAL;
+	}
+
+	if (stream->active) {
+		return -EBUSY;
+	}
+
+	hpf_gpio_data_packet_t msg = {
+		.opcode = HPF_GPIO_PORT_STREAM,
+		.pin = mask,
+		.port = get_port_cfg(port)->port_num,
+		.flags = (uint32_t)stream,
+	};
+
+	stream->active = true;
+
+	ret = gpio_send(&msg);
+	if (ret < 0) {
+		stream->active = false;
+	}
+
+	return ret;
+}
+#endif
+
 static const struct gpio_driver_api gpio_hpf_drv_api_funcs = {
 	.pin_configure = gpio_hpf_pin_configure,
 	.port_set_masked_raw = gpio_hpf_port_set_masked_raw,
@@ -106,6 +106,10 @@ static atomic_t ipc_atomic_sem = ATOMIC_INIT(0);
 
 struct mspi_hpf_data {
 	hpf_mspi_xfer_config_msg_t xfer_config_msg;
+#if defined(CONFIG_MSPI_HPF_XFER_QUEUE)
+	hpf_mspi_xfer_queue_msg_t xfer_queue_msg;
+	hpf_mspi_xfer_packet_msg_t xfer_queue[CONFIG_MSPI_HPF_XFER_QUEUE_SIZE];
+#endif
 };
 
 struct mspi_hpf_config {
@@ -231,6 +235,16 @@ static void ep_recv(const void *data, size_t len, void *priv)
 #endif
 		break;
 	}
+#if defined(CONFIG_MSPI_HPF_XFER_QUEUE)
+	case HPF_MSPI_XFER_QUEUE: {
+#if defined(CONFIG_MULTITHREADING)
+		k_sem_give(&ipc_sem_xfer);
+#else
+		atomic_set_bit(&ipc_atomic_sem, HPF_MSPI_XFER_QUEUE);
+#endif
+		break;
+	}
+#endif
 	case HPF_MSPI_HPF_APP_HARD_FAULT: {
 
 		const uint32_t mcause_exc_mask = 0xfff;
@@ -281,6 +295,7 @@ static int hpf_mspi_wait_for_response(hpf_mspi_opcode_t opcode, uint32_t timeout
 	}
 	case HPF_MSPI_TX:
 	case HPF_MSPI_TXRX:
+	case HPF_MSPI_XFER_QUEUE:
 		ret = k_sem_take(&ipc_sem_xfer, K_MSEC(timeout));
 		break;
 	default:
@@ -384,10 +399,12 @@ static int hpf_mspi_register_endpoint_with_retry(const struct device *ipc_instan
  * @param opcode The configuration packet opcode to send.
  * @param data The data to send.
  * @param len The length of the data to send.
+ * @param timeout The response timeout in milliseconds.
  *
  * @return 0 on success, negative errno code on failure.
  */
-static int send_data(hpf_mspi_opcode_t opcode, const void *data, size_t len)
+static int send_data_timeout(hpf_mspi_opcode_t opcode, const void *data, size_t len,
+			     uint32_t timeout)
 {
 	LOG_DBG("Sending msg with opcode: %d", (uint8_t)opcode);
 
@@ -427,7 +444,7 @@ static int send_data(hpf_mspi_opcode_t opcode, const void *data, size_t len)
 		return rc;
 	}
 
-	rc = hpf_mspi_wait_for_response(opcode, IPC_TIMEOUT_MS);
+	rc = hpf_mspi_wait_for_response(opcode, timeout);
 	if (rc < 0) {
 		LOG_ERR("Data transfer: %d response timeout: %d!", opcode, rc);
 	}
@@ -435,6 +452,20 @@ static int send_data(hpf_mspi_opcode_t opcode, const void *data, size_t len)
 	return rc;
 }
 
+/**
+ * @brief Send data to the FLPR core using the IPC service, and wait for FLPR response.
+ *
+ * @param opcode The configuration packet opcode to send.
+ * @param data The data to send.
+ * @param len The length of the data to send.
+ *
+ * @return 0 on success, negative errno code on failure.
+ */
+static int send_data(hpf_mspi_opcode_t opcode, const void *data, size_t len)
+{
+	return send_data_timeout(opcode, data, len, IPC_TIMEOUT_MS);
+}
+
 static int check_pin_assignments(const struct pinctrl_state *state)
 {
 	uint8_t data_pins[HPF_MSPI_DATA_LINE_CNT_MAX];
@@ -932,6 +963,72 @@ static int start_next_packet(struct mspi_xfer *xfer, uint32_t packets_done)
 	return send_packet(packet, xfer->timeout);
 }
 
+#if defined(CONFIG_MSPI_HPF_XFER_QUEUE)
+/**
+ * @brief Counts the packets that can be sent in a single queued transfer.
+ *
+ * Packets are queued as long as their buffers are word aligned, as the FLPR
+ * core accesses them directly.
+ *
+ * @param xfer Pointer to the mspi_xfer structure.
+ * @param packets_done Number of packets that have already been processed.
+ *
+ * @return Number of consecutive packets that can be queued.
+ */
+static uint32_t queueable_packets_get(const struct mspi_xfer *xfer, uint32_t packets_done)
+{
+	uint32_t count = 0;
+
+	while ((packets_done + count < xfer->num_packet) &&
+	       (count < CONFIG_MSPI_HPF_XFER_QUEUE_SIZE)) {
+		const struct mspi_xfer_packet *packet = &xfer->packets[packets_done + count];
+
+		if ((((uint32_t)packet->data_buf) % sizeof(uint32_t) != 0) ||
+		    (packet->num_bytes >= MAX_TX_MSG_SIZE)) {
+			break;
+		}
+		++count;
+	}
+
+	return count;
+}
+
+/**
+ * @brief Sends several packets of an MSPI transaction in a single message.
+ *
+ * The FLPR core executes the packets back to back and responds once
+ * after the last one.
+ *
+ * @param drv_data Pointer to the driver data.
+ * @param xfer Pointer to the mspi_xfer structure.
+ * @param packets_done Number of packets that have already been processed.
+ * @param count Number of packets to send.
+ *
+ * @return 0 on success, negative errno code on failure.
+ */
+static int send_packet_queue(struct mspi_hpf_data *drv_data, const struct mspi_xfer *xfer,
+			     uint32_t packets_done, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		const struct mspi_xfer_packet *packet = &xfer->packets[packets_done + i];
+		hpf_mspi_xfer_packet_msg_t *xfer_packet = &drv_data->xfer_queue[i];
+
+		xfer_packet->opcode = (packet->dir == MSPI_RX) ? HPF_MSPI_TXRX : HPF_MSPI_TX;
+		xfer_packet->command = packet->cmd;
+		xfer_packet->address = packet->address;
+		xfer_packet->num_bytes = packet->num_bytes;
+		xfer_packet->data = packet->data_buf;
+	}
+
+	drv_data->xfer_queue_msg.opcode = HPF_MSPI_XFER_QUEUE;
+	drv_data->xfer_queue_msg.num_packets = count;
+	drv_data->xfer_queue_msg.packets = drv_data->xfer_queue;
+
+	return send_data_timeout(HPF_MSPI_XFER_QUEUE, &drv_data->xfer_queue_msg,
+				 sizeof(hpf_mspi_xfer_queue_msg_t), IPC_TIMEOUT_MS * count);
+}
+#endif
+
 /**
  * @brief Send a multi-packet transfer request to the host.
  *
@@ -982,6 +1079,19 @@ static int api_transceive(const struct device *dev, const struct mspi_dev_id *de
 	}
 
 	while (packets_done < req->num_packet) {
+#if defined(CONFIG_MSPI_HPF_XFER_QUEUE)
+		uint32_t count = queueable_packets_get(req, packets_done);
+
+		if (count > 1) {
+			rc = send_packet_queue(drv_data, req, packets_done, count);
+			if (rc < 0) {
+				LOG_ERR("Send packet queue error: %d", rc);
+				return rc;
+			}
+			packets_done += count;
+			continue;
+		}
+#endif
 		rc = start_next_packet((struct mspi_xfer *)req, packets_done);
 		if (rc < 0) {
 			LOG_ERR("Start next packet error: %d", rc);
@@ -67,6 +67,7 @@ static int api_reset(const struct device *dev)
 static int send_request(const struct device *dev,
 			nrf_semmc_cmd_desc_t *semmc_cmd,
 			nrf_semmc_transfer_desc_t *semmc_transfer,
+			size_t transfer_count,
 			int timeout_ms)
 {
 	struct sdhc_semmc_data *dev_data = dev->data;
@@ -86,13 +87,14 @@ static int send_request(const struct device *dev,
 
 	if (semmc_transfer == NULL) {
 		semmc_transfer = &no_transfer;
+		transfer_count = 1;
 	}
 
 	k_sem_reset(&dev_data->finished);
 
 	err = nrf_semmc_cmd(&dev_config->semmc, semmc_cmd,
 			    &dev_data->semmc_config,
-			    semmc_transfer, 1, 0);
+			    semmc_transfer, transfer_count, 0);
 	if (err != NRF_SEMMC_SUCCESS) {
 		LOG_ERR("nrf_semmc_cmd() failed (%d), CMD%d",
 			err, semmc_cmd->cmd);
@@ -118,6 +120,76 @@ static int send_request(const struct device *dev,
 	return 0;
 }
 
+static void transfer_release(const struct sdhc_semmc_config *dev_config,
+			     struct sdhc_data *data, bool out_buf,
+			     nrf_semmc_transfer_desc_t *transfer, size_t count)
+{
+	uint8_t *user_buf = data->data;
+
+	for (size_t i = 0; i < count; i++) {
+		uint32_t size = transfer[i].num_blocks * transfer[i].block_size;
+
+		if (out_buf) {
+			(void)dmm_buffer_out_release(dev_config->mem_reg,
+						     transfer[i].buffer);
+		} else {
+			(void)dmm_buffer_in_release(dev_config->mem_reg,
+						    user_buf, size,
+						    transfer[i].buffer);
+		}
+
+		user_buf += size;
+	}
+}
+
+/* Splits the data of a request into chained transfer descriptors, which are
+ * processed by sEMMC within a single command. This way, multi-block transfers
+ * are not limited by the size of a single DMM buffer.
+ */
+static int transfer_prepare(const struct sdhc_semmc_config *dev_config,
+			    struct sdhc_data *data, bool out_buf,
+			    nrf_semmc_transfer_desc_t *transfer, size_t *count)
+{
+	uint32_t desc_blocks = MAX(DIV_ROUND_UP(data->blocks,
+					CONFIG_SDHC_NRF_SEMMC_XFER_DESC_COUNT),
+				   CONFIG_SDHC_NRF_SEMMC_XFER_DESC_MIN_BLOCKS);
+	uint32_t blocks_left = data->blocks;
+	uint8_t *user_buf = data->data;
+	size_t n = 0;
+	int rc;
+
+	while (blocks_left > 0) {
+		uint32_t blocks = MIN(blocks_left, desc_blocks);
+		uint32_t size = blocks * data->block_size;
+
+		transfer[n].block_size = data->block_size;
+		transfer[n].num_blocks = blocks;
+
+		if (out_buf) {
+			rc = dmm_buffer_out_prepare(dev_config->mem_reg,
+						    user_buf, size,
+						    &transfer[n].buffer);
+		} else {
+			rc = dmm_buffer_in_prepare(dev_config->mem_reg,
+						   user_buf, size,
+						   &transfer[n].buffer);
+		}
+		if (rc < 0) {
+			LOG_ERR("Failed to prepare DMM buffer (%d)", rc);
+			transfer_release(dev_config, data, out_buf, transfer, n);
+			return rc;
+		}
+
+		user_buf += size;
+		blocks_left -= blocks;
+		n++;
+	}
+
+	*count = n;
+
+	return 0;
+}
+
 static int _api_request(const struct device *dev,
 			struct sdhc_command *cmd,
 			struct sdhc_data *data)
@@ -173,50 +245,32 @@ static int _api_request(const struct device *dev,
 			.resp_buffer = semmc_cmd.resp_buffer,
 		};
 
-		rc = send_request(dev, &blk_cnt_cmd, NULL, cmd->timeout_ms);
+		rc = send_request(dev, &blk_cnt_cmd, NULL, 0, cmd->timeout_ms);
 		if (rc < 0) {
 			return rc;
 		}
 	}
 
 	if (data) {
-		nrf_semmc_transfer_desc_t transfer = {
-			.block_size = data->block_size,
-			.num_blocks = data->blocks,
-		};
-		uint32_t buf_size = data->blocks * data->block_size;
+		nrf_semmc_transfer_desc_t
+			transfer[CONFIG_SDHC_NRF_SEMMC_XFER_DESC_COUNT];
+		size_t transfer_count;
 		bool out_buf = cmd->opcode == SD_WRITE_SINGLE_BLOCK ||
 			       cmd->opcode == SD_WRITE_MULTIPLE_BLOCK;
 
-		if (out_buf) {
-			rc = dmm_buffer_out_prepare(dev_config->mem_reg,
-						    data->data,
-						    buf_size,
-						    &transfer.buffer);
-		} else {
-			rc = dmm_buffer_in_prepare(dev_config->mem_reg,
-						   data->data,
-						   buf_size,
-						   &transfer.buffer);
-		}
+		rc = transfer_prepare(dev_config, data, out_buf,
+				      transfer, &transfer_count);
 		if (rc < 0) {
-			LOG_ERR("Failed to prepare DMM buffer (%d)", rc);
 			return rc;
 		}
 
-		rc = send_request(dev, &semmc_cmd, &transfer, data->timeout_ms);
+		rc = send_request(dev, &semmc_cmd, transfer, transfer_count,
+				  data->timeout_ms);
 
-		if (out_buf) {
-			(void)dmm_buffer_out_release(dev_config->mem_reg,
-						     transfer.buffer);
-		} else {
-			(void)dmm_buffer_in_release(dev_config->mem_reg,
-						    data->data,
-						    buf_size,
-						    transfer.buffer);
-		}
+		transfer_release(dev_config, data, out_buf,
+				 transfer, transfer_count);
 	} else {
-		rc = send_request(dev, &semmc_cmd, NULL, cmd->timeout_ms);
+		rc = send_request(dev, &semmc_cmd, NULL, 0, cmd->timeout_ms);
 	}
 
 	if (rc < 0) {
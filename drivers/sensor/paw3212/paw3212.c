@@ -750,6 +750,17 @@ static int paw3212_sample_fetch(const struct device *dev, enum sensor_channel ch
 		return -EBUSY;
 	}
 
+	if (IS_ENABLED(CONFIG_PAW3212_FETCH_SKIP_NO_MOTION)) {
+		const struct paw3212_config *config = dev->config;
+
+		/* Motion pin is active until the accumulated motion is read. */
+		if (gpio_pin_get_dt(&config->irq_gpio) == 0) {
+			data->x = 0;
+			data->y = 0;
+			return 0;
+		}
+	}
+
 	err = reg_read(dev, PAW3212_REG_MOTION, &motion_status);
 	if (err) {
 		LOG_ERR("Cannot read motion");
@@ -869,6 +869,17 @@ static int pmw3360_sample_fetch(const struct device *dev, enum sensor_channel ch
 		return -EBUSY;
 	}
 
+	if (IS_ENABLED(CONFIG_PMW3360_FETCH_SKIP_NO_MOTION)) {
+		const struct pmw3360_config *config = dev->config;
+
+		/* Motion pin is active until the accumulated motion is read. */
+		if (gpio_pin_get_dt(&config->irq_gpio) == 0) {
+			data->x = 0;
+			data->y = 0;
+			return 0;
+		}
+	}
+
 	int err = motion_burst_read(dev, buf, sizeof(buf));
 
 	if (!err) {
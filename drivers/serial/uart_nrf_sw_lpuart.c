@@ -13,6 +13,7 @@
 #include <gpiote_nrfx.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/onoff.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/drivers/clock_control/nrf_clock_control.h>
 
 LOG_MODULE_REGISTER(lpuart, CONFIG_NRF_SW_LPUART_LOG_LEVEL);
@@ -55,6 +56,11 @@ struct lpuart_int_driven {
 	size_t rxlen;
 	size_t rxrd;
 
+#if CONFIG_NRF_SW_LPUART_INT_DRV_RX_RING_SIZE > 0
+	struct ring_buf rxring;
+	uint8_t rxring_buf[CONFIG_NRF_SW_LPUART_INT_DRV_RX_RING_SIZE];
+#endif
+
 	bool tx_enabled;
 	bool rx_enabled;
 	bool err_enabled;
@@ -825,9 +831,29 @@ static int api_rx_disable(const struct device *dev)
 
 #if CONFIG_NRF_SW_LPUART_INT_DRIVEN
 
+#define INT_DRV_RX_RING (CONFIG_NRF_SW_LPUART_INT_DRV_RX_RING_SIZE > 0)
+
+BUILD_ASSERT(!INT_DRV_RX_RING ||
+	     CONFIG_NRF_SW_LPUART_INT_DRV_RX_RING_SIZE >= CONFIG_NRF_SW_LPUART_MAX_PACKET_SIZE,
+	     "RX ring buffer must fit a packet");
+
 static uint32_t int_driven_rd_available(struct lpuart_data *data)
 {
+#if INT_DRV_RX_RING
+	return ring_buf_size_get(&data->int_driven.rxring);
+#else
 	return data->int_driven.rxlen - data->int_driven.rxrd;
+#endif
+}
+
+/* Returns true if the RX buffer can be handed back to the receiver. */
+static bool int_driven_rx_can_feed(struct lpuart_data *data)
+{
+#if INT_DRV_RX_RING
+	return ring_buf_space_get(&data->int_driven.rxring) >= sizeof(data->int_driven.rxbuf);
+#else
+	return int_driven_rd_available(data) == 0;
+#endif
 }
 
 static void int_driven_rx_feed(const struct device *dev,
@@ -842,6 +868,17 @@ static void int_driven_rx_feed(const struct device *dev,
 	__ASSERT_NO_MSG(err >= 0);
 }
 
+#if CONFIG_NRF_SW_LPUART_INT_DRV_TX_BATCH
+/* Returns true if data can be appended to the pending transfer, which is
+ * the case until the receiver confirms the request.
+ */
+static bool int_driven_tx_appendable(struct lpuart_data *data)
+{
+	return (data->tx_buf == data->int_driven.txbuf) && !data->tx_active &&
+	       (data->int_driven.txlen < sizeof(data->int_driven.txbuf));
+}
+#endif
+
 static void trampoline_timeout(struct k_timer *timer)
 {
 	const struct device *dev = k_timer_user_data_get(timer);
@@ -854,7 +891,7 @@ static void trampoline_timeout(struct k_timer *timer)
 	 * we must feed the buffer back to the uart to allow reception of the
 	 * next packet.
 	 */
-	if (!int_driven_rd_available(data) && data->rx_state == RX_BLOCKED) {
+	if (int_driven_rx_can_feed(data) && data->rx_state == RX_BLOCKED) {
 		/* Whole packet read, RX can be re-enabled. */
 		int_driven_rx_feed(dev, data);
 	}
@@ -875,12 +912,24 @@ static void int_driven_evt_handler(const struct device *lpuart,
 		call_handler = true;
 		break;
 	case UART_RX_RDY:
+#if INT_DRV_RX_RING
+	{
+		uint32_t put = ring_buf_put(&data->int_driven.rxring,
+					    &evt->data.rx.buf[evt->data.rx.offset],
+					    evt->data.rx.len);
+
+		/* RX buffer is fed only if the ring buffer can fit a whole packet. */
+		__ASSERT_NO_MSG(put == evt->data.rx.len);
+		(void)put;
+	}
+#else
 		__ASSERT_NO_MSG(data->int_driven.rxlen == 0);
 		data->int_driven.rxlen = evt->data.rx.len;
+#endif
 		call_handler = data->int_driven.rx_enabled;
 		break;
 	case UART_RX_BUF_REQUEST:
-		if (int_driven_rd_available(data) == 0) {
+		if (int_driven_rx_can_feed(data)) {
 			int_driven_rx_feed(lpuart, data);
 		}
 		break;
@@ -916,11 +965,15 @@ static int api_fifo_read(const struct device *dev,
 	uint32_t cpylen = 0;
 
 	if (available) {
+#if INT_DRV_RX_RING
+		cpylen = ring_buf_get(&data->int_driven.rxring, rx_data, size);
+#else
 		cpylen = MIN(available, size);
 		memcpy(rx_data,
 		       &data->int_driven.rxbuf[data->int_driven.rxrd],
 		       cpylen);
 		data->int_driven.rxrd += cpylen;
+#endif
 	}
 
 	return cpylen;
@@ -933,6 +986,27 @@ static int api_fifo_fill(const struct device *dev,
 	struct lpuart_data *data = get_dev_data(dev);
 	int err;
 
+#if CONFIG_NRF_SW_LPUART_INT_DRV_TX_BATCH
+	if (data->int_driven.txlen != 0) {
+		unsigned int key = irq_lock();
+
+		/* Merge the data into the pending transfer, which is sent in the same
+		 * request/ready handshake.
+		 */
+		if (int_driven_tx_appendable(data)) {
+			size = MIN(size, sizeof(data->int_driven.txbuf) - data->int_driven.txlen);
+			memcpy(&data->int_driven.txbuf[data->int_driven.txlen], tx_data, size);
+			data->int_driven.txlen += size;
+			data->tx_len = data->int_driven.txlen;
+		} else {
+			size = 0;
+		}
+		irq_unlock(key);
+
+		return size;
+	}
+#endif
+
 	size = MIN(size, sizeof(data->int_driven.txbuf));
 	if (!atomic_cas((atomic_t *)&data->int_driven.txlen, 0, size)) {
 		return 0;
@@ -952,12 +1026,24 @@ static int api_fifo_fill(const struct device *dev,
 	return size;
 }
 
+static int api_irq_tx_ready(const struct device *dev)
+{
+	struct lpuart_data *data = get_dev_data(dev);
+
+#if CONFIG_NRF_SW_LPUART_INT_DRV_TX_BATCH
+	if (data->int_driven.tx_enabled && int_driven_tx_appendable(data)) {
+		return 1;
+	}
+#endif
+	return data->int_driven.tx_enabled && (data->tx_buf == NULL);
+}
+
 static void api_irq_tx_enable(const struct device *dev)
 {
 	struct lpuart_data *data = get_dev_data(dev);
 
 	data->int_driven.tx_enabled = true;
-	if (data->tx_buf == NULL) {
+	if (api_irq_tx_ready(dev)) {
 		/* We need to move to the interrupt context of the same priority as UARTE. */
 		k_timer_start(&data->int_driven.trampoline_timer, K_NO_WAIT, K_NO_WAIT);
 	}
@@ -970,13 +1056,6 @@ static void api_irq_tx_disable(const struct device *dev)
 	data->int_driven.tx_enabled = false;
 }
 
-static int api_irq_tx_ready(const struct device *dev)
-{
-	struct lpuart_data *data = get_dev_data(dev);
-
-	return data->int_driven.tx_enabled && (data->tx_buf == NULL);
-}
-
 static void api_irq_callback_set(const struct device *dev,
 				 uart_irq_callback_user_data_t cb,
 				 void *user_data)
@@ -1015,7 +1094,9 @@ static int api_irq_rx_ready(const struct device *dev)
 
 static int api_irq_tx_complete(const struct device *dev)
 {
-	return api_irq_tx_ready(dev);
+	struct lpuart_data *data = get_dev_data(dev);
+
+	return data->int_driven.tx_enabled && (data->tx_buf == NULL);
 }
 
 static void api_irq_err_enable(const struct device *dev)
@@ -1084,6 +1165,11 @@ static int lpuart_init(const struct device *dev)
 		return -EINVAL;
 	}
 
+#if INT_DRV_RX_RING
+	ring_buf_init(&data->int_driven.rxring, sizeof(data->int_driven.rxring_buf),
+		      data->int_driven.rxring_buf);
+#endif
+
 	err = api_rx_enable(dev, data->int_driven.rxbuf,
 				sizeof(data->int_driven.rxbuf), 1000);
 #endif
@@ -27,6 +27,9 @@
 #include "timer.h"
 #include "osal_ops.h"
 #include "common/hal_structs_common.h"
+#if CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0
+#include "system/fmac_rx.h"
+#endif /* CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0 */
 
 LOG_MODULE_REGISTER(wifi_nrf, CONFIG_WIFI_NRF71_LOG_LEVEL);
 
@@ -262,12 +265,75 @@ struct nwb {
 #ifdef CONFIG_NRF_WIFI_ZERO_COPY_TX
 	struct net_pkt *pkt;
 #endif
+#if CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0
+	unsigned int size;
+#endif /* CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0 */
 };
 
+#if CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0
+/* Size of the RX buffers allocated by nrf_wifi_fmac_rx_cmd_send() */
+#define RX_BUF_RECYCLE_SIZE (CONFIG_NRF71_RX_MAX_DATA_SIZE + RX_BUF_HEADROOM)
+
+/* Freed RX buffers kept for reuse, linked through their next field */
+static struct nwb *rx_buf_recycle_list;
+static unsigned int rx_buf_recycle_cnt;
+static struct k_spinlock rx_buf_recycle_lock;
+
+static struct nwb *rx_buf_recycle_get(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&rx_buf_recycle_lock);
+	struct nwb *nwb = rx_buf_recycle_list;
+
+	if (nwb) {
+		rx_buf_recycle_list = nwb->next;
+		rx_buf_recycle_cnt--;
+	}
+
+	k_spin_unlock(&rx_buf_recycle_lock, key);
+
+	return nwb;
+}
+
+static bool rx_buf_recycle_put(struct nwb *nwb)
+{
+	k_spinlock_key_t key;
+	bool kept = false;
+
+	if (nwb->size != RX_BUF_RECYCLE_SIZE) {
+		return false;
+	}
+
+	key = k_spin_lock(&rx_buf_recycle_lock);
+
+	if (rx_buf_recycle_cnt < CONFIG_NRF71_RX_BUF_RECYCLE_COUNT) {
+		nwb->next = rx_buf_recycle_list;
+		rx_buf_recycle_list = nwb;
+		rx_buf_recycle_cnt++;
+		kept = true;
+	}
+
+	k_spin_unlock(&rx_buf_recycle_lock, key);
+
+	return kept;
+}
+#endif /* CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0 */
+
 static void *zep_shim_nbuf_alloc(unsigned int size)
 {
 	struct nwb *nbuff;
 
+#if CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0
+	nbuff = (size == RX_BUF_RECYCLE_SIZE) ? rx_buf_recycle_get() : NULL;
+
+	if (nbuff) {
+		void *priv = nbuff->priv;
+
+		(void)memset(nbuff, 0, sizeof(*nbuff));
+		nbuff->priv = priv;
+		goto init;
+	}
+#endif /* CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0 */
+
 	nbuff = (struct nwb *)zep_shim_data_mem_zalloc(sizeof(struct nwb));
 
 	if (!nbuff) {
@@ -281,6 +347,10 @@ static void *zep_shim_nbuf_alloc(unsigned int size)
 		return NULL;
 	}
 
+#if CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0
+init:
+	nbuff->size = size;
+#endif /* CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0 */
 	nbuff->data = (unsigned char *)nbuff->priv;
 	nbuff->tail = nbuff->data;
 	nbuff->end = (unsigned char *)nbuff->priv + size;
@@ -303,6 +373,12 @@ static void zep_shim_nbuf_free(void *nbuf)
 	}
 #endif /* CONFIG_NRF_WIFI_ZERO_COPY_TX */
 
+#if CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0
+	if (rx_buf_recycle_put(nbuf)) {
+		return;
+	}
+#endif /* CONFIG_NRF71_RX_BUF_RECYCLE_COUNT > 0 */
+
 	zep_shim_data_mem_free(((struct nwb *)nbuf)->priv);
 	zep_shim_data_mem_free(nbuf);
 }
@@ -499,6 +575,15 @@ void *net_pkt_to_nbuf(struct net_pkt *pkt)
 	}
 
 #ifdef CONFIG_NRF_WIFI_ZERO_COPY_TX
+	/* The TX descriptor holds a single pointer per frame, so move the data
+	 * of a fragmented packet into the first buffer if it fits there.
+	 */
+	if (pkt->buffer && pkt->buffer->frags &&
+	    net_pkt_get_len(pkt) <= pkt->buffer->len + net_buf_tailroom(pkt->buffer)) {
+		net_pkt_compact(pkt);
+		net_pkt_cursor_init(pkt);
+	}
+
 	/* For zero-copy, check if packet has single buffer */
 	if (pkt->buffer && !pkt->buffer->frags) {
 		return net_pkt_to_nbuf_zc(pkt);
@@ -330,6 +330,12 @@ struct peers_info {
 	int ps_token_count;
 	/** Port authorized */
 	bool authorized;
+#if defined(NRF_WIFI_TX_AIRTIME_FAIRNESS) || defined(__DOXYGEN__)
+	/** Airtime deficit per access category, in microseconds. */
+	int atf_deficit[NRF_WIFI_FMAC_AC_MAX];
+	/** Average TX rate measured at TX done, in bytes per millisecond. */
+	unsigned int atf_rate;
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
 };
 
 /**
@@ -59,6 +59,14 @@ struct tx_pkt_info {
 	void *pkt;
 	/** Peer ID. */
 	unsigned int peer_id;
+#if defined(NRF_WIFI_TX_AIRTIME_FAIRNESS) || defined(__DOXYGEN__)
+	/** Time the frames were passed to the RPU, in microseconds. */
+	unsigned long atf_start_us;
+	/** Number of bytes passed to the RPU. */
+	unsigned int atf_bytes;
+	/** Access category of the frames. */
+	unsigned char atf_ac;
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
 };
 
 #ifdef NRF71_RAW_DATA_TX
@@ -426,7 +426,7 @@ nrf_wifi_fmac_data_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 	switch (event) {
 	case NRF_WIFI_CMD_RX_BUFF:
-#ifdef NRF71_RX_DONE_WQ_ENABLED
+#ifdef NRF71_RX_WQ_ENABLED
 		struct nrf_wifi_rx_buff *config = nrf_wifi_osal_mem_zalloc(
 			sizeof(struct nrf_wifi_rx_buff));
 		if (!config) {
@@ -438,7 +438,7 @@ nrf_wifi_fmac_data_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		nrf_wifi_osal_mem_cpy(config,
 				      umac_head,
 				      sizeof(struct nrf_wifi_rx_buff));
-		status = nrf_wifi_utils_q_enqueue(sys_dev_ctx->rx_config.rx_tasklet_event_q,
+		status = nrf_wifi_utils_q_enqueue(sys_dev_ctx->rx_tasklet_event_q,
 						  config);
 		if (status != NRF_WIFI_STATUS_SUCCESS) {
 			nrf_wifi_osal_log_err("%s: Failed to enqueue RX buffer",
@@ -450,7 +450,7 @@ nrf_wifi_fmac_data_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 #else
 		status = nrf_wifi_fmac_rx_event_process(fmac_dev_ctx,
 							umac_head);
-#endif /* NRF71_RX_DONE_WQ_ENABLED */
+#endif /* NRF71_RX_WQ_ENABLED */
 		break;
 #ifdef NRF71_DATA_TX
 	case NRF_WIFI_CMD_TX_BUFF_DONE:
@@ -301,6 +301,7 @@ void nrf_wifi_fmac_rx_tasklet(void *data)
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	enum NRF_WIFI_HAL_STATUS hal_status;
+	unsigned int cnt = 0;
 
 	nrf_wifi_sys_hal_lock_rx(fmac_dev_ctx->hal_dev_ctx);
 	hal_status = nrf_wifi_hal_status_unlocked(fmac_dev_ctx->hal_dev_ctx);
@@ -310,25 +311,32 @@ void nrf_wifi_fmac_rx_tasklet(void *data)
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
-	config = (struct nrf_wifi_rx_buff *)nrf_wifi_utils_q_dequeue(
-		sys_dev_ctx->rx_tasklet_event_q);
+	/* The RX events queued while the tasklet is pending are handled by a
+	 * single run, so process them in batches.
+	 */
+	for (cnt = 0; cnt < NRF71_RX_WQ_BATCH_SIZE; cnt++) {
+		config = (struct nrf_wifi_rx_buff *)nrf_wifi_utils_q_dequeue(
+			sys_dev_ctx->rx_tasklet_event_q);
 
-	if (!config) {
-		nrf_wifi_osal_log_err("%s: No RX config available",
-					  __func__);
-		goto out;
-	}
+		if (!config) {
+			break;
+		}
 
-	status = nrf_wifi_fmac_rx_event_process(fmac_dev_ctx,
-						config);
+		status = nrf_wifi_fmac_rx_event_process(fmac_dev_ctx,
+							config);
 
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: nrf_wifi_fmac_rx_event_process failed",
-					  __func__);
-		goto out;
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: nrf_wifi_fmac_rx_event_process failed",
+						  __func__);
+		}
+
+		nrf_wifi_osal_mem_free(config);
+	}
+
+	if (nrf_wifi_utils_q_len(sys_dev_ctx->rx_tasklet_event_q)) {
+		nrf_wifi_osal_tasklet_schedule(sys_dev_ctx->rx_tasklet);
 	}
 out:
-	nrf_wifi_osal_mem_free(config);
 	nrf_wifi_sys_hal_unlock_rx(fmac_dev_ctx->hal_dev_ctx);
 }
 #endif /* NRF71_RX_WQ_ENABLED */
@@ -462,6 +462,123 @@ static int get_peer_from_wakeup_q(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+/* Lower bound of the airtime deficit of a peer, so that a peer charged for
+ * a long TX, for instance after many retries, recovers in a few rounds.
+ */
+#define ATF_DEFICIT_MIN (-4 * NRF_WIFI_TX_AIRTIME_QUANTUM_US)
+
+static int atf_peer_get(struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx,
+			unsigned int ac)
+{
+	struct tx_config *tx_config = &sys_dev_ctx->tx_config;
+	struct peers_info *peer = NULL;
+	unsigned int init_peer_opp = 0;
+	unsigned int peer_id = 0;
+	unsigned int i = 0;
+	bool pending = false;
+
+	init_peer_opp = tx_config->curr_peer_opp[ac];
+
+	/* Deficit round robin over the peers with pending frames. A peer keeps
+	 * the TX opportunity while it has airtime left, otherwise it is given
+	 * a new quantum and the next peer is checked.
+	 */
+	do {
+		pending = false;
+
+		for (i = 0; i < MAX_PEERS; i++) {
+			peer_id = (init_peer_opp + i) % MAX_PEERS;
+			peer = &tx_config->peers[peer_id];
+
+			if (peer->ps_state == NRF_WIFI_CLIENT_PS_MODE ||
+			    !nrf_wifi_utils_q_len(tx_config->data_pending_txq[peer_id][ac])) {
+				continue;
+			}
+
+			pending = true;
+
+			if (peer->atf_deficit[ac] > 0) {
+				tx_config->curr_peer_opp[ac] = peer_id;
+				return peer_id;
+			}
+
+			peer->atf_deficit[ac] += NRF_WIFI_TX_AIRTIME_QUANTUM_US;
+		}
+	} while (pending);
+
+	return -1;
+}
+
+
+static int atf_aggr_len_get(struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx,
+			    int peer_id,
+			    int aggr_len)
+{
+	unsigned int rate = 0;
+	unsigned int max_len = 0;
+
+	if (peer_id < 0 || peer_id >= MAX_PEERS) {
+		return aggr_len;
+	}
+
+	rate = sys_dev_ctx->tx_config.peers[peer_id].atf_rate;
+
+	/* No TX done measured yet */
+	if (!rate) {
+		return aggr_len;
+	}
+
+	max_len = rate * NRF_WIFI_TX_AIRTIME_MAX_AGGR_US / 1000;
+
+	if (max_len < (unsigned int)aggr_len) {
+		return max_len;
+	}
+
+	return aggr_len;
+}
+
+
+static void atf_tx_done(struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx,
+			struct tx_pkt_info *pkt_info)
+{
+	struct peers_info *peer = NULL;
+	unsigned int airtime_us = 0;
+	unsigned int rate = 0;
+	int deficit = 0;
+
+	if (pkt_info->peer_id >= MAX_PEERS || !pkt_info->atf_bytes) {
+		return;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[pkt_info->peer_id];
+
+	/* The time between passing the frames to the RPU and the TX done
+	 * includes the retries of the peer, and is charged as its airtime.
+	 */
+	airtime_us = nrf_wifi_osal_time_elapsed_us(pkt_info->atf_start_us);
+
+	if (airtime_us > (unsigned int)(-ATF_DEFICIT_MIN)) {
+		airtime_us = -ATF_DEFICIT_MIN;
+	}
+
+	deficit = peer->atf_deficit[pkt_info->atf_ac] - (int)airtime_us;
+	peer->atf_deficit[pkt_info->atf_ac] = (deficit < ATF_DEFICIT_MIN) ?
+		ATF_DEFICIT_MIN : deficit;
+
+	if (airtime_us) {
+		rate = (pkt_info->atf_bytes * 1000) / airtime_us;
+		rate = rate ? rate : 1;
+
+		peer->atf_rate = peer->atf_rate ?
+			((peer->atf_rate * 3) + rate) / 4 : rate;
+	}
+
+	pkt_info->atf_bytes = 0;
+}
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
+
+
 static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			 unsigned int ac)
 {
@@ -486,6 +603,10 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		return peer_id;
 	}
 
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+	return atf_peer_get(sys_dev_ctx, ac);
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
+
 	init_peer_opp = sys_dev_ctx->tx_config.curr_peer_opp[ac];
 
 	for (i = 0; i < MAX_PEERS; i++) {
@@ -528,6 +649,9 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 	int max_txq_len, avail_ampdu_len_per_token;
 	int ampdu_len = 0;
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+	unsigned int txq_bytes = 0;
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
 
@@ -564,6 +688,15 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
 	txq = pkt_info->pkt;
 
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+	/* Limit the aggregate of a slow peer to what it sends in the
+	 * maximum aggregate airtime.
+	 */
+	avail_ampdu_len_per_token = atf_aggr_len_get(sys_dev_ctx,
+						     peer_id,
+						     avail_ampdu_len_per_token);
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
+
 	/* Aggregate Only MPDU's with same RA, same Rate,
 	 * same Rate flags, same Tx Info flags
 	 */
@@ -591,6 +724,9 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 		nrf_wifi_utils_list_add_tail(txq,
 					     nwb);
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+		txq_bytes += nrf_wifi_osal_nbuf_data_size(nwb);
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
 	}
 
 	/* If our criterion rejects all pending frames, or
@@ -607,12 +743,20 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 		nrf_wifi_utils_list_add_tail(txq,
 					     nwb);
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+		txq_bytes += nrf_wifi_osal_nbuf_data_size(nwb);
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
 	}
 
 	len = nrf_wifi_utils_q_len(txq);
 
 	if (len > 0) {
 		sys_dev_ctx->tx_config.pkt_info_p[desc].peer_id = peer_id;
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+		pkt_info->atf_start_us = nrf_wifi_osal_time_get_curr_us();
+		pkt_info->atf_bytes = txq_bytes;
+		pkt_info->atf_ac = ac;
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
 	}
 
 	update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
@@ -1252,6 +1396,10 @@ static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_d
 	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
 	nwb_list = pkt_info->pkt;
 
+#ifdef NRF_WIFI_TX_AIRTIME_FAIRNESS
+	atf_tx_done(sys_dev_ctx, pkt_info);
+#endif /* NRF_WIFI_TX_AIRTIME_FAIRNESS */
+
 	pkt = 0;
 
 	sys_dev_ctx->host_stats.total_tx_done_pkts += pkt;
@@ -55,6 +55,13 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** places events of this type in the high priority event queue.
+	 *  Events from the high priority queue are processed before events from
+	 *  the normal priority queue. The flag is only taken into account if
+	 *  @kconfig{CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE} is enabled.
+	 *  Flag set by user.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -90,6 +97,54 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  */
 #define APP_EVENT_LISTENER(lname, cb_fn) _APP_EVENT_LISTENER(lname, cb_fn)
 
+/** @brief Create an event listener object notified from a dedicated work queue.
+ *
+ * The listener is not notified directly by the event dispatcher. Instead, the event is queued
+ * for the listener and the listener is notified from the given work queue. This allows a slow
+ * listener to run in parallel with the other listeners without delaying them.
+ *
+ * The listener is notified about events in the order of submission, and only if the event
+ * was not consumed by a listener that precedes it in the subscriber order.
+ * The listener cannot consume events, so its handler must return false.
+ * If the listener's queue is full, the event dispatcher waits until there is room in it.
+ *
+ * The event is freed after all listeners are notified.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ} option needs to be enabled.
+ *
+ * @param lname       Module name.
+ * @param cb_fn       Pointer to the event handler function.
+ * @param work_q      Pointer to the work queue used to notify the listener.
+ *                    The work queue must not be the system work queue.
+ * @param queue_size  Maximum number of events pending delivery to the listener.
+ */
+#define APP_EVENT_LISTENER_WORKQ(lname, cb_fn, work_q, queue_size) \
+	_APP_EVENT_LISTENER_WORKQ(lname, cb_fn, work_q, queue_size)
+
+/** @brief Create a deferred event listener object.
+ *
+ * The listener is notified from a work queue that runs at the lowest application thread
+ * priority, which means that the listener runs only when no other application thread is ready,
+ * in particular after the event dispatcher has processed all the queued events. This is meant
+ * for listeners that are not latency critical, for example writing settings or updating
+ * statistics.
+ *
+ * To prevent starvation, the priority of the work queue is raised if an event waits for
+ * delivery for longer than @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED_MAX_DELAY_MS}.
+ * The priority is restored after all pending events are delivered.
+ *
+ * Other than that, the listener behaves like a listener defined with
+ * @ref APP_EVENT_LISTENER_WORKQ.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED} option needs to be enabled.
+ *
+ * @param lname       Module name.
+ * @param cb_fn       Pointer to the event handler function.
+ * @param queue_size  Maximum number of events pending delivery to the listener.
+ */
+#define APP_EVENT_LISTENER_DEFERRED(lname, cb_fn, queue_size) \
+	_APP_EVENT_LISTENER_DEFERRED(lname, cb_fn, queue_size)
+
 
 /** @brief Subscribe a listener to an event type as first module that is
  *  being notified.
@@ -178,6 +233,30 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define coalescing policy for an event type.
+ *
+ * If an event of the given type is submitted while another event of the same type is still
+ * waiting in the event queue, the events are coalesced according to the selected policy:
+ *
+ * - @ref APP_EVENT_COALESCE_REPLACE_LATEST - The data of the new event is copied into the queued
+ *   event, which keeps its position in the queue. Not available for events with dynamic data.
+ * - @ref APP_EVENT_COALESCE_ACCUMULATE - The merge function is called to merge the new event
+ *   into the queued event, which keeps its position in the queue.
+ * - @ref APP_EVENT_COALESCE_DROP_OLDEST - The queued event is dropped and the new event
+ *   is appended at the end of the queue.
+ *
+ * The coalesced events are freed without being processed. The merge function is called with
+ * the event queue locked and must not block.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING} option needs to be enabled.
+ *
+ * @param ename     Name of the event.
+ * @param policy    Coalescing policy, see @ref app_event_coalesce_policy.
+ * @param merge_fn  Pointer to the merge function. Used only by the
+ *                  @ref APP_EVENT_COALESCE_ACCUMULATE policy, NULL otherwise.
+ */
+#define APP_EVENT_COALESCE(ename, policy, merge_fn) _APP_EVENT_COALESCE(ename, policy, merge_fn)
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -193,6 +272,9 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  *
  * This helper macro simplifies the event submission.
  *
+ * If @kconfig{CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE} is enabled, the event is appended to
+ * the event queue without taking a lock and can be submitted from any context, including ISRs.
+ *
  * @param event  Pointer to the event object.
  */
 #define APP_EVENT_SUBMIT(event) _event_submit(&event->header)
@@ -403,6 +485,116 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Memory slab statistics.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_SLAB} option needs to be enabled.
+ */
+struct app_event_manager_mem_slab_stats {
+	/** Size of a single block in bytes. */
+	size_t block_size;
+
+	/** Number of blocks in the memory slab. */
+	uint32_t block_count;
+
+	/** Number of blocks that are currently in use. */
+	uint32_t used;
+
+	/** Maximum number of blocks that were in use at the same time. */
+	uint32_t max_used;
+};
+
+/** @brief Get number of memory slabs used by the event allocator.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_SLAB} option needs to be enabled.
+ *
+ * @return Number of memory slabs. The memory slabs are sorted by block size in ascending order.
+ */
+size_t app_event_manager_mem_slab_count(void);
+
+/** @brief Get statistics of a memory slab used by the event allocator.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_SLAB} option needs to be enabled.
+ *
+ * @param idx    Index of the memory slab.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the index is out of range.
+ */
+int app_event_manager_mem_slab_stats_get(size_t idx,
+					 struct app_event_manager_mem_slab_stats *stats);
+
+/** @brief Get number of events allocated from the heap by the memory slab event allocator.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_SLAB} option needs to be enabled.
+ *
+ * @return Number of events that did not fit into any of the memory slabs.
+ */
+uint32_t app_event_manager_mem_slab_heap_alloc_count(void);
+
+
+/** @brief Event type statistics.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ */
+struct app_event_manager_event_stats {
+	/** Number of submitted events. */
+	uint32_t submitted;
+
+	/** Number of listener notifications about the events. */
+	uint32_t delivered;
+
+	/** Number of events consumed by a listener. */
+	uint32_t consumed;
+
+	/** Number of events that are currently waiting in the event queue. */
+	uint32_t queued;
+
+	/** Maximum number of events that were waiting in the event queue at the same time. */
+	uint32_t max_queued;
+};
+
+/** @brief Event listener statistics.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ */
+struct app_event_manager_listener_stats {
+	/** Number of notifications. */
+	uint32_t notified;
+
+	/** Cumulative execution time of the notifications in microseconds. */
+	uint64_t exec_time_us;
+};
+
+/** @brief Get statistics of an event type.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ */
+void app_event_manager_event_stats_get(const struct event_type *et,
+				       struct app_event_manager_event_stats *stats);
+
+/** @brief Get statistics of an event listener.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ *
+ * @param el     Pointer to the event listener.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ */
+void app_event_manager_listener_stats_get(const struct event_listener *el,
+					  struct app_event_manager_listener_stats *stats);
+
+/** @brief Reset event type and event listener statistics.
+ *
+ * The number of currently queued events is not reset.
+ *
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ */
+void app_event_manager_stats_reset(void);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
@@ -70,6 +70,30 @@ struct nrf_profiler_info {
 	BUILD_ASSERT(profile_func != NULL);			\
 	_APP_EVENT_INFO_DEFINE(ename, ENCODE(types), ENCODE(labels), profile_func)
 
+/** Define event profiling information with a generated packed encoder.
+ *
+ * This macro provides definitions required for an event to be profiled
+ * in the same way as @ref APP_EVENT_INFO_DEFINE, but instead of a user
+ * provided function, the event data is encoded by a function generated
+ * at compile time. The listed event structure fields are copied to a
+ * packed structure of a fixed layout and added to the Profiler buffer
+ * with a single bounded copy.
+ *
+ * Only fixed size types can be used. The size of every field must match
+ * the size of its profiled type. Both conditions, together with the fact
+ * that the encoded data fits in the Profiler event buffer, are verified
+ * at build time.
+ *
+ * @note Types, labels and fields should be wrapped with the @ref ENCODE macro.
+ *
+ * @param ename Name of the event.
+ * @param types Types of values to profile (represented as @ref nrf_profiler_arg).
+ * @param labels Labels of values to profile.
+ * @param fields Names of the event structure fields to profile, in the order of types.
+ */
+#define APP_EVENT_INFO_DEFINE_PACKED(ename, types, labels, fields) \
+	_APP_EVENT_INFO_DEFINE_PACKED(ename, ENCODE(types), ENCODE(labels), ENCODE(fields))
+
 
 
 #ifdef __cplusplus
@@ -283,6 +283,11 @@ struct audio_module_parameters {
 	struct audio_module_thread_configuration thread;
 };
 
+/**
+ * @brief Audio module graph.
+ */
+struct audio_module_graph;
+
 /**
  * @brief Private module handle.
  */
@@ -323,10 +328,44 @@ struct audio_module_handle {
 	/* Module's thread configuration. */
 	struct audio_module_thread_configuration thread;
 
+#if defined(CONFIG_AUDIO_MODULE_SHARED_BUFFER)
+	/* Reference counts of the output audio data buffers, indexed by the position of the
+	 * buffer in the audio data slab.
+	 */
+	atomic_t data_ref_cnt[CONFIG_AUDIO_MODULE_SHARED_BUFFER_BLOCKS_MAX];
+#endif
+
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+	/* The graph that runs this module, NULL if the module is not in a graph. */
+	struct audio_module_graph *graph;
+#endif
+
 	/* Private context for the module. */
 	struct audio_module_context *context;
 };
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Audio module graph, running a chain of connected modules in a single thread.
+ */
+struct audio_module_graph {
+	/* The modules of the graph in the order they are run. */
+	struct audio_module_handle *modules[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* Number of modules in the graph. */
+	size_t modules_num;
+
+	/* Semaphore counting the pending runs of the graph. */
+	struct k_sem trigger;
+
+	/* Thread ID. */
+	k_tid_t thread_id;
+
+	/* Thread data. */
+	struct k_thread thread_data;
+};
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 /**
  * @brief Private structure describing a data_in message into the module thread.
  */
@@ -502,6 +541,53 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 			    struct audio_data const *const audio_data_tx,
 			    struct audio_data *audio_data_rx, k_timeout_t timeout);
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Initialize an audio module graph and start its thread.
+ *
+ * @note The graph contains the source module and all the modules it is connected to, directly or
+ *       through other modules, that have been opened without a thread (the thread stack set to
+ *       NULL and the stack size to 0). The modules are run in topological order, so each module
+ *       is run after all the modules that send audio data to it. Modules with their own thread
+ *       still receive audio data from the graph through their RX FIFO.
+ *
+ * @note The graph must be uninitialized and initialized again after changing the connections of
+ *       its modules.
+ *
+ * @param graph       [out]  Pointer to the graph.
+ * @param source      [in]   The handle of the first module to run.
+ * @param stack       [in]   Stack of the graph thread.
+ * @param stack_size  [in]   Size of the graph thread stack.
+ * @param priority    [in]   Priority of the graph thread.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_init(struct audio_module_graph *graph, struct audio_module_handle *source,
+			    k_thread_stack_t *stack, size_t stack_size, int priority);
+
+/**
+ * @brief Stop the graph thread and release the modules of the graph.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_uninit(struct audio_module_graph *graph);
+
+/**
+ * @brief Schedule a run of all the modules of the graph in the graph thread.
+ *
+ * @note An input module processes one audio data item per run, while the other modules process
+ *       all queued audio data items. The function can be called from an ISR, for example from
+ *       the I2S block complete callback.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_trigger(struct audio_module_graph *graph);
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 /**
  * @brief Helper to get the base and instance names for a given audio
  *        module handle.
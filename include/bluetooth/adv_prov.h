@@ -64,6 +64,12 @@ struct bt_le_adv_prov_feedback {
 	 * The time of grace period advertising is equal to maximum time requested by providers.
 	 */
 	size_t grace_period_s;
+
+	/** Set by the subsystem, not by the providers. True if the data differs from the data
+	 * that was previously provided for the same advertising set. The field is always set to
+	 * true if the CONFIG_BT_ADV_PROV_CHANGE_DETECTION Kconfig option is disabled.
+	 */
+	bool data_changed;
 };
 
 /**
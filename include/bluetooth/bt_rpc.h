@@ -58,6 +58,29 @@ int bt_rpc_gatt_subscribe_flag_clear(struct bt_gatt_subscribe_params *params, ui
  */
 int bt_rpc_gatt_subscribe_flag_get(struct bt_gatt_subscribe_params *params, uint32_t flags_bit);
 
+/** @brief Mirror the value of an attribute in the host.
+ *
+ * After this call, reads of the attribute by peers are answered by the host
+ * with the given value, without calling the read callback of the attribute.
+ * Call this function again whenever the value changes. Use it for static
+ * attributes or attributes whose value is updated by the application only.
+ *
+ * Requires the CONFIG_BT_RPC_GATT_MIRROR Kconfig option.
+ *
+ * @param attr  Attribute of a registered service.
+ * @param value Attribute value, or NULL to stop mirroring the attribute.
+ * @param len   Value length.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the attribute is not found in the host.
+ * @retval -EMSGSIZE If the value is longer than CONFIG_BT_RPC_GATT_MIRROR_VALUE_MAX
+ *                   on the host.
+ * @retval -ENOMEM If CONFIG_BT_RPC_GATT_MIRROR_COUNT attributes are already
+ *                 mirrored on the host.
+ */
+int bt_rpc_gatt_attr_value_mirror(const struct bt_gatt_attr *attr, const void *value,
+				  uint16_t len);
+
 #ifdef __cplusplus
 }
 #endif
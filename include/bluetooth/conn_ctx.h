@@ -51,7 +51,7 @@ struct bt_conn_ctx {
 
 /** @brief Bluetooth connection context library structure. */
 struct bt_conn_ctx_lib {
-	/** Connection contexts. */
+	/** Connection contexts, indexed by @c bt_conn_index. */
 	struct bt_conn_ctx ctx[CONFIG_BT_MAX_CONN];
 
 	/** Context data mutex that ensures that only one connection context is
@@ -137,6 +137,27 @@ void bt_conn_ctx_free_all(struct bt_conn_ctx_lib *ctx_lib);
  */
 void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn);
 
+/**
+ * @brief Look up the context data of a connection without locking.
+ *
+ * This function finds a connection's context data in the memory pool
+ * in constant time, without taking the library mutex. Unlike
+ * @ref bt_conn_ctx_get, it must not be followed by @ref bt_conn_ctx_release.
+ *
+ * @note The caller must ensure that the context data cannot be freed and
+ *       is not modified by another thread while it is used, for example by
+ *       using the function only from the Bluetooth callbacks of
+ *       the connection and freeing the context data in the disconnected
+ *       callback.
+ *
+ * @param ctx_lib	Bluetooth connection context library instance.
+ * @param conn		Bluetooth connection.
+ *
+ * @return Pointer to the connection context data if the operation
+ *         was successful. Otherwise NULL.
+ */
+void *bt_conn_ctx_lookup(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn);
+
 /**
  * @brief Get a specific connection context from the memory pool.
  *
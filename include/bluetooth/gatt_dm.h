@@ -283,6 +283,10 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
  * service instances may be discovered.
  * Call @ref bt_gatt_dm_continue to discover the next service instance.
  *
+ * If @kconfig{CONFIG_BT_GATT_DM_CACHE} is enabled and @p svc_uuid is set,
+ * the first service instance on a bonded peer is taken from the cache
+ * when the Database Hash of the peer did not change.
+ *
  * @retval 0 If the operation was successful.
  *           Otherwise, a (negative) error code is returned.
  */
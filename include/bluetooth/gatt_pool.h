@@ -49,6 +49,32 @@ extern "C" {
 	const static struct bt_gatt_pool _name =  \
 		BT_GATT_POOL_INIT(_attr_array_size)
 
+/** @brief Initialization of a pre-built GATT attribute pool variable.
+ *
+ *  This macro creates the initializer for an attribute pool that uses
+ *  the given attribute array as a complete, pre-built service table.
+ *  No pool memory is taken for the attributes of such a pool.
+ *
+ *  @param _attrs Array of service attributes.
+ */
+#define BT_GATT_POOL_PREBUILT_INIT(_attrs)                                     	{                                                                      		.svc = BT_GATT_SERVICE(_attrs),                                		.attr_array_size = ARRAY_SIZE(_attrs),                         		.prebuilt = true                                               	}
+
+/** @brief Define a pre-built GATT attribute pool.
+ *
+ *  This macro creates a new attribute pool from the service table built at
+ *  compile time. Use the Zephyr attribute macros, for example
+ *  BT_GATT_PRIMARY_SERVICE, BT_GATT_CHARACTERISTIC, BT_GATT_CCC_MANAGED
+ *  and BT_GATT_DESCRIPTOR, to describe the attributes.
+ *
+ *  The UUIDs and the characteristic declarations are referenced directly
+ *  and not copied into the pools. Only the attribute array is placed in RAM,
+ *  as the attribute handles are assigned when the service is registered.
+ *
+ *  @param _name Name of the pool created.
+ *  @param ...   Service attributes.
+ */
+#define BT_GATT_POOL_PREBUILT_DEF(_name, ...)                                  	static struct bt_gatt_attr _CONCAT(_name, _attrs)[] = { __VA_ARGS__ }; 	static struct bt_gatt_pool _name =                                     		BT_GATT_POOL_PREBUILT_INIT(_CONCAT(_name, _attrs))
+
 /** @brief Register a primary service descriptor.
  *
  *  @param _gp GATT service object with dynamic attribute allocation.
@@ -130,6 +156,8 @@ struct bt_gatt_pool {
 	struct bt_gatt_service svc;
 	/** Maximum number of attributes supported. */
 	size_t attr_array_size;
+	/** The service table is pre-built and does not use pool memory. */
+	bool prebuilt;
 };
 
 /** @brief Take a primary service descriptor from the pool.
@@ -180,6 +208,9 @@ int bt_gatt_pool_ccc_alloc(struct bt_gatt_pool *gp,
 			   uint8_t perm);
 
 /** @brief Free the whole dynamically created GATT service.
+ *
+ *  The function has no effect on a pre-built pool, see
+ *  @ref BT_GATT_POOL_PREBUILT_DEF.
  *
  *  @param gp GATT service object with dynamic attribute allocation.
  */
@@ -34,13 +34,40 @@ extern "C" {
 	}
 
 /** Specification-defined illuminance regulator context. */
+/** Floating-point regulator input and its fixed-point representation. */
+struct bt_mesh_light_ctrl_reg_spec_fixed {
+	/** Last converted floating-point value. */
+	float src;
+	/** Fixed-point value with 16 fractional bits. */
+	int64_t val;
+};
+
 struct bt_mesh_light_ctrl_reg_spec {
 	/** Common regulator context. */
 	struct bt_mesh_light_ctrl_reg reg;
 	/** Regulator step timer. */
 	struct k_work_delayable timer;
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_SHARED_TICK)
+	/** Node in the list of regulators served by the shared regulator tick. */
+	sys_snode_t node;
+#endif
 	/** Internal integral sum. */
 	float i;
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_FIXED_POINT)
+	/** Internal integral sum in fixed-point format. */
+	int64_t i_fixed;
+	/** Fixed-point representations of the regulator inputs. */
+	struct {
+		struct bt_mesh_light_ctrl_reg_spec_fixed target;
+		struct bt_mesh_light_ctrl_reg_spec_fixed prev_target;
+		struct bt_mesh_light_ctrl_reg_spec_fixed measured;
+		struct bt_mesh_light_ctrl_reg_spec_fixed accuracy;
+		struct bt_mesh_light_ctrl_reg_spec_fixed ki_up;
+		struct bt_mesh_light_ctrl_reg_spec_fixed ki_down;
+		struct bt_mesh_light_ctrl_reg_spec_fixed kp_up;
+		struct bt_mesh_light_ctrl_reg_spec_fixed kp_down;
+	} fixed;
+#endif
 	/** Regulator enabled flag. */
 	bool enabled;
 	/* If true, internal integral sum can be negative until it becomes positive. */
@@ -67,6 +67,24 @@ struct bt_mesh_scene_srv;
 						 _srv),                        \
 			 &_bt_mesh_scene_setup_srv_cb)
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+/** Scene image cached in RAM. */
+struct bt_mesh_scene_cache_entry {
+	/** Scene number, or @ref BT_MESH_SCENE_NONE if the entry is not valid. */
+	uint16_t scene;
+	/** Length of the SIG model scene data. */
+	uint16_t sig_len;
+	/** Length of the vendor model scene data, following the SIG model data. */
+	uint16_t vnd_len;
+	/** The scene data does not fit in the entry. */
+	bool overflow;
+	/** Scene data, in the format it is stored in. */
+	uint8_t data[CONFIG_BT_MESH_SCENE_SRV_CACHE_IMAGE_SIZE];
+};
+#endif
+/** @endcond */
+
 /** Scene Server model instance */
 struct bt_mesh_scene_srv {
 	/** All known scenes. */
@@ -107,6 +125,14 @@ struct bt_mesh_scene_srv {
 	/** Publication message buffer. */
 	uint8_t buf[BT_MESH_MODEL_BUF_LEN(BT_MESH_SCENE_OP_STATUS,
 					  BT_MESH_SCENE_MSG_MAXLEN_STATUS)];
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	/** Cached scene images. */
+	struct bt_mesh_scene_cache_entry cache[CONFIG_BT_MESH_SCENE_SRV_CACHE_ENTRIES];
+	/** Cache entry that is filled with the scene data loaded from settings. */
+	struct bt_mesh_scene_cache_entry *cache_fill;
+	/** Index of the next cache entry to replace. */
+	uint8_t cache_next;
+#endif
 	/** @endcond */
 };
 
@@ -625,6 +625,14 @@ struct bt_mesh_sensor {
 
 		/** Flag indicating whether the sensor cadence state has been configured. */
 		uint8_t configured : 1;
+
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+		/** Flag indicating whether the sensor has a pending batched publication. */
+		uint8_t batched : 1;
+
+		/** Sensor value of the pending batched publication. */
+		struct bt_mesh_sensor_value batch[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+#endif
 	} state;
 };
 
@@ -108,6 +108,10 @@ struct bt_mesh_sensor_srv {
 			BT_MESH_SENSOR_MSG_MAXLEN_CADENCE_STATUS))];
 	/** Composition data model pointer. */
 	const struct bt_mesh_model *model;
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+	/** Batched publication work. */
+	struct k_work_delayable batch_work;
+#endif
 };
 
 /** @brief Publish a sensor value.
@@ -115,6 +119,12 @@ struct bt_mesh_sensor_srv {
  *  Immediately publishes the given sensor value, without checking thresholds
  *  or intervals.
  *
+ *  If @kconfig{CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH} is enabled and @c ctx is
+ *  NULL, the value is instead published together with the other values
+ *  published within @kconfig{CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH_WINDOW}
+ *  milliseconds, or with the next periodic publication if it comes first. A
+ *  newer value of the same sensor replaces the pending one.
+ *
  *  @see bt_mesh_sensor_srv_pub
  *
  *  @param[in] srv    Sensor server instance.
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @defgroup bt_ctlr_sdc_hci_driver SoftDevice Controller HCI driver APIs
+ * @{
+ * @brief APIs of the HCI driver for the SoftDevice Controller.
+ */
+
+#ifndef BT_NRF_HCI_DRIVER_H_
+#define BT_NRF_HCI_DRIVER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief HCI receive statistics. */
+struct bt_ctlr_sdc_rx_stats {
+	/** Number of discardable HCI events dropped because no event buffer
+	 *  was available in the host.
+	 */
+	uint32_t evt_discarded;
+	/** Number of the dropped events that were advertising reports. */
+	uint32_t adv_report_discarded;
+};
+
+/** @brief Get the HCI receive statistics.
+ *
+ *  Requires the CONFIG_BT_CTLR_SDC_RX_STATS Kconfig option.
+ *
+ *  @param[out] stats Statistics.
+ */
+void bt_ctlr_sdc_rx_stats_get(struct bt_ctlr_sdc_rx_stats *stats);
+
+/** @brief Reset the HCI receive statistics.
+ *
+ *  Requires the CONFIG_BT_CTLR_SDC_RX_STATS Kconfig option.
+ */
+void bt_ctlr_sdc_rx_stats_reset(void);
+
+/** @brief ISO SDU received by the direct ISO data receive path. */
+struct bt_ctlr_sdc_iso_rx_sdu {
+	/** Connection handle of the CIS or BIS. */
+	uint16_t conn_handle;
+	/** Packet sequence number. */
+	uint16_t seq_num;
+	/** Time stamp of the SDU in microseconds, valid if @c ts_valid is set. */
+	uint32_t timestamp;
+	/** The SDU has a time stamp. */
+	bool ts_valid;
+	/** Packet status flag, as defined for HCI ISO data packets. */
+	uint8_t status;
+	/** SDU data. */
+	const uint8_t *data;
+	/** SDU length. */
+	uint16_t len;
+};
+
+/** @brief Direct ISO data receive callback.
+ *
+ *  The callback is called from the context that passes the HCI packets to
+ *  the host for every complete ISO SDU received. Copy the data, for example
+ *  into a ring buffer of the application, before returning, as the buffer is
+ *  reused for the next packet.
+ *
+ *  @param sdu Received SDU.
+ *
+ *  @retval true  The SDU was consumed and is not passed to the host.
+ *  @retval false The SDU is passed to the host.
+ */
+typedef bool (*bt_ctlr_sdc_iso_rx_cb_t)(const struct bt_ctlr_sdc_iso_rx_sdu *sdu);
+
+/** @brief Register the direct ISO data receive callback.
+ *
+ *  Requires the CONFIG_BT_CTLR_SDC_ISO_RX_DIRECT Kconfig option.
+ *  SDUs that are fragmented into several HCI ISO data packets are always
+ *  passed to the host.
+ *
+ *  @param cb Callback, or NULL to unregister the callback.
+ *
+ *  @retval 0 The callback was registered.
+ *  @retval -EALREADY Another callback is already registered.
+ */
+int bt_ctlr_sdc_iso_rx_cb_register(bt_ctlr_sdc_iso_rx_cb_t cb);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* BT_NRF_HCI_DRIVER_H_ */
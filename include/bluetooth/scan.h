@@ -105,7 +105,7 @@ struct bt_scan_filter_info {
 	bool enabled;
 
 	/** Filter count. */
-	uint8_t cnt;
+	uint16_t cnt;
 };
 
 /**@brief Filter status structure.
@@ -79,9 +79,16 @@ extern "C" {
 /**@brief Helping macro for @ref BT_HIDS_DEF, that calculates
  *        the link context size for HIDS instance.
  */
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+/* Reserve space for the coalesced reports after the other contexts. */
+#define _BT_HIDS_CONN_CTX_SIZE_CALC(...)		   \
+	(2 * (FOR_EACH(_BT_HIDS_GET_ARG1, (+), __VA_ARGS__)) + \
+	sizeof(struct bt_hids_conn_data))
+#else
 #define _BT_HIDS_CONN_CTX_SIZE_CALC(...)		   \
 	(FOR_EACH(_BT_HIDS_GET_ARG1, (+), __VA_ARGS__)	+ \
 	sizeof(struct bt_hids_conn_data))
+#endif
 #define _BT_HIDS_GET_ARG1(...) GET_ARG_N(1, __VA_ARGS__)
 
 /** @brief Possible values for the Protocol Mode Characteristic value.
@@ -232,6 +239,20 @@ typedef void (*bt_hids_rep_handler_t) (struct bt_hids_rep *rep,
 				       struct bt_conn *conn,
 				       bool write);
 
+/** @brief Relative field of an Input Report.
+ *
+ * The field holds a signed value, such as mouse motion or wheel, that is
+ * summed when reports are coalesced. The bits are counted from the least
+ * significant bit of the first byte of the report, as in the HID Report Map.
+ */
+struct bt_hids_rel_field {
+	/** Offset of the field in bits. */
+	uint8_t offset;
+
+	/** Size of the field in bits, from 2 to 16. */
+	uint8_t size;
+};
+
 /** @brief Input Report.
  */
 struct bt_hids_inp_rep {
@@ -289,6 +310,17 @@ struct bt_hids_inp_rep {
 	 * Has preference over the normal callback.
 	 */
 	bt_hids_notify_ext_handler_t handler_ext;
+
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE) || defined(__DOXYGEN__)
+	/** Relative fields of the report. If set, the report is coalesced
+	 * when it is sent to a connection while its previous notification to
+	 * that connection is pending. See @kconfig{CONFIG_BT_HIDS_INP_REP_COALESCE}.
+	 */
+	const struct bt_hids_rel_field *rel_fields;
+
+	/** Number of relative fields. */
+	uint8_t rel_field_cnt;
+#endif
 };
 
 
@@ -587,6 +619,29 @@ struct bt_hids_conn_data {
 	/** SCI mode value. */
 	uint8_t sci_mode;
 #endif
+
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	/** Pointer to coalesced Input Reports Context data. */
+	uint8_t *inp_rep_coalesce_ctx;
+
+	/** Input Reports with a pending notification. */
+	uint16_t inp_rep_pending;
+
+	/** Input Reports coalesced while the notification was pending. */
+	uint16_t inp_rep_coalesced;
+
+	/** Callbacks of the pending notifications. */
+	bt_gatt_complete_func_t inp_rep_pending_cb[CONFIG_BT_HIDS_INPUT_REP_MAX];
+
+	/** User data of the pending notifications. */
+	void *inp_rep_pending_user_data[CONFIG_BT_HIDS_INPUT_REP_MAX];
+
+	/** Callbacks of the coalesced reports. */
+	bt_gatt_complete_func_t inp_rep_coalesced_cb[CONFIG_BT_HIDS_INPUT_REP_MAX];
+
+	/** User data of the coalesced reports. */
+	void *inp_rep_coalesced_user_data[CONFIG_BT_HIDS_INPUT_REP_MAX];
+#endif
 };
 
 
@@ -639,6 +694,11 @@ int bt_hids_disconnected(struct bt_hids *hids_obj, struct bt_conn *conn);
  *  @note The function is not thread safe.
  *	     It cannot be called from multiple threads at the same time.
  *
+ *  @note If the report is coalesced, it is sent when the pending
+ *	  notification completes, together with the reports coalesced after
+ *	  it. Only the callback passed with the last of these reports is
+ *	  called.
+ *
  *  @param hids_obj Pointer to HIDS instance.
  *  @param conn Pointer to Connection Object.
  *  @param rep_index Index of report descriptor.
@@ -274,8 +274,25 @@ struct bt_hogp {
 		 * current state of this process.
 		 */
 		uint8_t rep_idx;
+#if defined(CONFIG_BT_HOGP_READ_MULTIPLE)
+		/** Index of the next value to be read. */
+		uint16_t read_idx;
+		/** Index of the first value read with the current request. */
+		uint16_t read_start;
+		/** Index past the last value read with the current request. */
+		uint16_t read_end;
+		/** Processing of the current response failed. */
+		bool read_failed;
+#endif
 	} init_repref;
 
+#if defined(CONFIG_BT_HOGP_READ_MULTIPLE)
+	/** Handles of the values read with a single request during
+	 *  the initialization.
+	 */
+	uint16_t read_handles[CONFIG_BT_HOGP_READ_MULTIPLE_MAX];
+#endif
+
 	struct {
 		/** Keyboard input boot report. Input and Output keyboard
 		 *  reports come in pairs.
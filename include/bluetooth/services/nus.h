@@ -15,6 +15,8 @@
  */
 
 #include <zephyr/types.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/bluetooth/conn.h>
 #include <zephyr/bluetooth/uuid.h>
 #include <zephyr/bluetooth/gatt.h>
@@ -126,6 +128,129 @@ static inline uint32_t bt_nus_get_mtu(struct bt_conn *conn)
 	return bt_gatt_get_mtu(conn) - 3;
 }
 
+#if defined(CONFIG_BT_NUS_STREAM) || defined(__DOXYGEN__)
+
+struct bt_nus_stream;
+
+/**@brief Stream transfer done callback.
+ *
+ * Called from the system workqueue when all notifications of the transfer
+ * have been sent, or when the transfer has been stopped. The stream can be
+ * used for the next transfer from within the callback.
+ *
+ * @param[in] stream Stream that finished the transfer.
+ * @param[in] conn   Connection object the data was sent on.
+ * @param[in] err    0 if all data was sent, -ECANCELED if the transfer was
+ *                   stopped, or a negative error code returned by
+ *                   @ref bt_gatt_notify_cb.
+ */
+typedef void (*bt_nus_stream_done_cb_t)(struct bt_nus_stream *stream,
+					struct bt_conn *conn, int err);
+
+/** @brief NUS stream statistics. */
+struct bt_nus_stream_stats {
+	/** Number of bytes sent since the last reset. */
+	uint64_t bytes;
+
+	/** Number of notifications sent since the last reset. */
+	uint32_t notifications;
+
+	/** Uptime in milliseconds of the first notification after
+	 *  the last reset, or 0 if none was sent yet.
+	 */
+	int64_t start_time;
+};
+
+/** @brief NUS stream.
+ *
+ * Sends a buffer of any length as a sequence of notifications that are
+ * as long as the ATT MTU allows, keeping up to
+ * @kconfig{CONFIG_BT_NUS_STREAM_TX_COUNT} of them queued in the Bluetooth stack.
+ *
+ * Zero-initialize the structure before the first use. The members are
+ * internal, except for @c stats.
+ */
+struct bt_nus_stream {
+	/** Statistics of the stream. */
+	struct bt_nus_stream_stats stats;
+
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work_delayable work;
+	struct bt_conn *conn;
+	const uint8_t *data;
+	size_t len;
+	size_t offset;
+	int err;
+	bt_nus_stream_done_cb_t done;
+	atomic_t flags;
+	atomic_t in_flight;
+	uint16_t tx_len[CONFIG_BT_NUS_STREAM_TX_COUNT];
+	uint8_t tx_head;
+	uint8_t tx_tail;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+enum {
+	BT_NUS_STREAM_FLAG_INIT,
+	BT_NUS_STREAM_FLAG_ACTIVE,
+	BT_NUS_STREAM_FLAG_STOP,
+};
+/** @endcond */
+
+/**@brief Send a buffer over a stream.
+ *
+ * @details The data is split into notifications of the maximum length
+ *          returned by @ref bt_nus_get_mtu. Every time a notification
+ *          is sent, the next one is queued, so that the connection events are
+ *          filled without the application pacing on the sent callback. The
+ *          sent callback of @ref bt_nus_cb is not called for these
+ *          notifications.
+ *
+ * @param[in] stream Stream to use.
+ * @param[in] conn   Pointer to connection object.
+ * @param[in] data   Pointer to a data buffer. It must stay valid until
+ *                   the done callback is called.
+ * @param[in] len    Length of the data in the buffer.
+ * @param[in] done   Callback called when the transfer is done. Can be NULL.
+ *
+ * @retval 0 If the transfer is started.
+ * @retval -EINVAL If a parameter is invalid or the peer has not enabled
+ *                 notifications.
+ * @retval -EBUSY If a transfer is ongoing on the stream.
+ */
+int bt_nus_stream_send(struct bt_nus_stream *stream, struct bt_conn *conn,
+		       const uint8_t *data, size_t len, bt_nus_stream_done_cb_t done);
+
+/**@brief Stop the ongoing transfer of a stream.
+ *
+ * @details No more notifications are queued. The done callback is called
+ *          with -ECANCELED when the queued ones have been sent.
+ *
+ * @param[in] stream Stream to stop.
+ *
+ * @retval 0 If the transfer is being stopped.
+ * @retval -EALREADY If no transfer is ongoing.
+ */
+int bt_nus_stream_stop(struct bt_nus_stream *stream);
+
+/**@brief Get the throughput of a stream.
+ *
+ * @param[in] stream Stream.
+ *
+ * @return Average number of bytes sent per second since the first
+ *         notification after the last statistics reset.
+ */
+uint32_t bt_nus_stream_throughput_get(const struct bt_nus_stream *stream);
+
+/**@brief Reset the statistics of a stream.
+ *
+ * @param[in] stream Stream.
+ */
+void bt_nus_stream_stats_reset(struct bt_nus_stream *stream);
+
+#endif /* defined(CONFIG_BT_NUS_STREAM) || defined(__DOXYGEN__) */
+
 #ifdef __cplusplus
 }
 #endif
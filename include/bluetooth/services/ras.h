@@ -195,6 +195,18 @@ struct bt_ras_rd_buffer_cb {
 	 */
 	void (*ranging_data_overwritten)(struct bt_conn *conn, uint16_t ranging_counter);
 
+	/** @brief New subevent data has been stored in a ranging data buffer.
+	 *
+	 *  This callback notifies the application that a subevent of a ranging procedure
+	 *  that is not complete yet has been stored in the ranging data buffer.
+	 *  It is also called when a procedure that is being streamed has been dropped.
+	 *  Only called with the CONFIG_BT_RAS_RRSP_REALTIME_STREAMING Kconfig option.
+	 *
+	 *  @param conn Connection object.
+	 *  @param ranging_counter Ranging counter of the procedure.
+	 */
+	void (*subevent_data_received)(struct bt_conn *conn, uint16_t ranging_counter);
+
 	sys_snode_t node;
 };
 
@@ -225,6 +237,10 @@ struct ras_rd_buffer {
 	bool busy;
 	/** The peer has ACKed this buffer, the overwritten callback will not be called. */
 	bool acked;
+	/** Number of bytes of complete subevents that can be read before all
+	 *  ranging data has been written.
+	 */
+	atomic_t streamable_len;
 	/** Complete ranging data procedure buffer. */
 	union {
 		uint8_t buf[BT_RAS_PROCEDURE_MEM];
@@ -293,6 +309,22 @@ bool bt_ras_rd_buffer_ready_check(struct bt_conn *conn, uint16_t ranging_counter
  */
 struct ras_rd_buffer *bt_ras_rd_buffer_claim(struct bt_conn *conn, uint16_t ranging_counter);
 
+/** @brief Claim a buffer with a given ranging counter that is being written.
+ *
+ *  Returns a pointer to a buffer to which the ranging data with the requested
+ *  procedure counter is being written, and increments its reference counter.
+ *  Use @ref bt_ras_rd_buffer_bytes_pull to read the subevents stored so far.
+ *
+ *  @note Requires the CONFIG_BT_RAS_RRSP_REALTIME_STREAMING Kconfig option.
+ *
+ *  @param conn Connection instance.
+ *  @param ranging_counter CS procedure ranging counter.
+ *
+ *  @return Pointer to ranging data buffer structure or NULL if no such buffer exists.
+ */
+struct ras_rd_buffer *bt_ras_rd_buffer_stream_claim(struct bt_conn *conn,
+						    uint16_t ranging_counter);
+
 /** @brief Release a claimed ranging data buffer.
  *
  *  Returns a buffer and decrements its reference counter.
@@ -310,6 +342,8 @@ int bt_ras_rd_buffer_release(struct ras_rd_buffer *buf);
  *
  *  Utility method to consume up to max_data_len bytes from a buffer.
  *  The provided read_cursor will be used as the initial offset and updated.
+ *  If the buffer is still being written, only max_data_len bytes of complete
+ *  subevents are consumed at a time.
  *
  *  @param buf Pointer to claimed ranging data buffer.
  *  @param out_buf Destination to copy up to max_data_len bytes to.
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SENSOR_DATA_AGGREGATOR_H_
+#define _SENSOR_DATA_AGGREGATOR_H_
+
+/**
+ * @file
+ * @defgroup caf_sensor_data_aggregator CAF Sensor Data Aggregator
+ * @{
+ * @brief CAF Sensor Data Aggregator direct sample API.
+ */
+
+#include <stddef.h>
+#include <zephyr/drivers/sensor.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Claim space for a sample in the active aggregator buffer.
+ *
+ * The sample is written directly into the buffer that is passed in
+ * sensor_data_aggregator_event, without submitting a sensor_event.
+ * On success, the aggregator is locked until the sample is committed with
+ * @ref sensor_data_aggregator_sample_commit.
+ *
+ * Requires the CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT Kconfig option.
+ *
+ * @param[in]  sensor_descr Description of the sensor.
+ * @param[in]  value_cnt    Number of sensor values in the sample.
+ * @param[out] sample       Location of the sample in the buffer.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOENT If there is no aggregator for the sensor.
+ * @retval -EBADMSG If the sample size does not match the aggregator.
+ * @retval -ENOMEM If no buffer is available.
+ */
+int sensor_data_aggregator_sample_claim(const char *sensor_descr, size_t value_cnt,
+					struct sensor_value **sample);
+
+/**
+ * @brief Commit the claimed sample.
+ *
+ * The buffer is sent in sensor_data_aggregator_event when it is full.
+ *
+ * @param sensor_descr Description of the sensor.
+ * @param store        True to store the sample, false to discard it.
+ */
+void sensor_data_aggregator_sample_commit(const char *sensor_descr, bool store);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _SENSOR_DATA_AGGREGATOR_H_ */
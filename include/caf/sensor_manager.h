@@ -16,6 +16,10 @@ extern "C" {
 #include <caf/events/sensor_event.h>
 #include <caf/caf_sensor_common.h>
 
+#ifdef CONFIG_CAF_SENSOR_MANAGER_PPI_SEQ
+#include <drivers/ppi_seq/ppi_seq_i2c_spi.h>
+#endif
+
 
 enum act_type {
 	ACT_TYPE_ABS,
@@ -32,6 +36,38 @@ struct sm_trigger {
 	struct sm_trigger_activation activation;
 };
 
+#ifdef CONFIG_CAF_SENSOR_MANAGER_PPI_SEQ
+/**
+ * @brief Hardware sequenced sampling configuration
+ *
+ * The sensor is sampled by the PPI Sequencer for I2C/SPI without waking up the CPU.
+ * The sensor manager is woken up once per batch of transfers.
+ */
+struct sm_ppi_seq_config {
+	/**
+	 * @brief Job descriptor
+	 *
+	 * Transfer descriptor, buffers and batch size used by the sequencer. The callback,
+	 * user data and repeat count are set by the sensor manager.
+	 */
+	const struct ppi_seq_i2c_spi_job *job;
+	/**
+	 * @brief Decode a transfer
+	 *
+	 * Called from the sensor manager thread for every transfer in the completed batch.
+	 * The function must fill the sensor values of all the channels of the sensor.
+	 *
+	 * @param batch Completed batch.
+	 * @param idx   Index of the transfer in the batch.
+	 * @param data  Sensor values.
+	 *
+	 * @return 0 on success, negative error code otherwise.
+	 */
+	int (*decode)(const struct ppi_seq_i2c_spi_batch *batch, uint8_t idx,
+		      struct sensor_value *data);
+};
+#endif /* CONFIG_CAF_SENSOR_MANAGER_PPI_SEQ */
+
 /**
  * @brief Sensor configuration
  *
@@ -85,6 +121,16 @@ struct sm_sensor_config {
 	 * @brief Flag to indicate whether sensor should be suspended or not.
 	 */
 	bool suspend;
+#ifdef CONFIG_CAF_SENSOR_MANAGER_PPI_SEQ
+	/**
+	 * @brief Hardware sequenced sampling configuration
+	 *
+	 * If set, the device is a PPI Sequencer for I2C/SPI that samples the sensor. A single
+	 * sensor_event contains samples of the whole batch. Sensor trigger and suspend are not
+	 * supported for the sensor.
+	 */
+	const struct sm_ppi_seq_config *ppi_seq;
+#endif
 };
 
 #ifdef __cplusplus
@@ -39,6 +39,20 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	/* Single-producer/single-consumer ring, see DATA_FIFO_SPSC_DEFINE. */
+	bool spsc;
+	/* Free running block counters. The producer owns alloced and locked,
+	 * the consumer owns read and freed.
+	 */
+	atomic_t spsc_alloced;
+	atomic_t spsc_locked;
+	atomic_t spsc_read;
+	atomic_t spsc_freed;
+	atomic_t spsc_waiting;
+	struct k_sem spsc_vacant_sem;
+	struct k_sem spsc_filled_sem;
+#endif
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +66,32 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+#if defined(CONFIG_DATA_FIFO_SPSC) || defined(__DOXYGEN__)
+/**
+ * @brief Define a lock-free single-producer/single-consumer data_fifo.
+ *
+ * The FIFO is used through the same API as a FIFO defined with DATA_FIFO_DEFINE,
+ * but the blocks are taken from a ring buffer tracked by atomic counters instead
+ * of a memory slab and a message queue. The kernel is only entered when a call
+ * has to wait for a vacant or a filled block.
+ *
+ * Only one context may take and lock blocks and only one context may read and
+ * free them. The producer can take one block at a time, and the consumer must
+ * free the blocks in the order they were read.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc = true}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -91,6 +91,28 @@ int date_time_uptime_to_unix_time_ms(int64_t *uptime);
  */
 int date_time_now(int64_t *unix_time_ms);
 
+/** @brief Get the current date time UTC and its uncertainty.
+ *
+ *  @details The uncertainty is the resolution of the time source the date time was obtained
+ *           from, increased by @kconfig{CONFIG_DATE_TIME_DRIFT_TOLERANCE_PPM} of the time
+ *           elapsed since. If @kconfig{CONFIG_DATE_TIME_RETAINED} is enabled, the date time is
+ *           available immediately after a warm reset, with an uncertainty that also covers the
+ *           duration of the reset, until it is updated from a time source.
+ *
+ *  @note If the function fails, the passed in variables retain their
+ *        old values.
+ *
+ *  @param[out] unix_time_ms   Pointer to a variable to store the current date
+ *                             time UTC.
+ *  @param[out] uncertainty_ms Pointer to a variable to store the maximum expected error of
+ *                             the date time, in milliseconds.
+ *
+ *  @return 0        If the operation was successful.
+ *  @return -ENODATA If the library does not have a valid date time UTC.
+ *  @return -EINVAL  If a passed in pointer is NULL.
+ */
+int date_time_now_uncertainty(int64_t *unix_time_ms, uint32_t *uncertainty_ms);
+
 /** @brief Get the current date time in local time.
  *
  *  @note If the function fails, the passed in variable retains its
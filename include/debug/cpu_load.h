@@ -50,6 +50,37 @@ void cpu_load_reset(void);
  */
 int cpu_load_get(void);
 
+struct k_thread;
+
+/** @brief Get the CPU load of a thread.
+ *
+ * The load is represented in the same units as in @ref cpu_load_get and
+ * excludes the time spent in interrupts.
+ *
+ * Requires the CONFIG_NRF_CPU_LOAD_BREAKDOWN Kconfig option.
+ *
+ * @param thread Thread.
+ *
+ * @retval non-negative the current CPU load of the thread.
+ * @retval -ENOENT if the thread is not accounted.
+ * @retval -ENODEV if module failed to initialize.
+ */
+int cpu_load_thread_get(const struct k_thread *thread);
+
+/** @brief Get the CPU load of an interrupt line.
+ *
+ * The load is represented in the same units as in @ref cpu_load_get.
+ *
+ * Requires the CONFIG_NRF_CPU_LOAD_BREAKDOWN Kconfig option.
+ *
+ * @param irq Interrupt line.
+ *
+ * @retval non-negative the current CPU load of the interrupt line.
+ * @retval -EINVAL if the interrupt line is invalid.
+ * @retval -ENODEV if module failed to initialize.
+ */
+int cpu_load_irq_get(unsigned int irq);
+
 /** @} */
 
 #ifdef __cplusplus
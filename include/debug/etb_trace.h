@@ -45,6 +45,30 @@ void etb_trace_stop(void);
  */
 size_t etb_data_get(uint32_t *buf, size_t buf_size);
 
+/**
+ * @brief Take a snapshot of the ETB trace data.
+ *
+ * Tracing is briefly stopped and the ETB content is copied into the
+ * snapshot ring. If the ring is full, the oldest snapshot is overwritten.
+ *
+ * Requires the CONFIG_ETB_TRACE_SNAPSHOT Kconfig option.
+ */
+void etb_trace_snapshot_take(void);
+
+/**
+ * @brief Retrieve and release the oldest stored snapshot.
+ *
+ * Requires the CONFIG_ETB_TRACE_SNAPSHOT Kconfig option.
+ *
+ * @param[out] buf Output buffer.
+ * @param[in] buf_size Size of output buffer in words.
+ * @param[out] seq Sequence number of the snapshot, can be NULL.
+ * @retval Number of words of trace data returned in buf.
+ * @retval -EINVAL On invalid input parameters.
+ * @retval -ENODATA If no snapshot is stored.
+ */
+int etb_trace_snapshot_get(uint32_t *buf, size_t buf_size, uint32_t *seq);
+
 /** @} */
 
 #ifdef __cplusplus
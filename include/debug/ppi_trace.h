@@ -85,6 +85,73 @@ void ppi_trace_enable(void *handle);
  */
 void ppi_trace_disable(void *handle);
 
+#if defined(CONFIG_PPI_TRACE_LATENCY) || defined(__DOXYGEN__)
+
+/** @brief Latency statistics of an event pair. */
+struct ppi_trace_latency_stats {
+	/** Name of the event pair. */
+	const char *name;
+
+	/** Number of measured latencies. */
+	uint32_t cnt;
+
+	/** Shortest latency in nanoseconds. */
+	uint32_t min_ns;
+
+	/** Longest latency in nanoseconds. */
+	uint32_t max_ns;
+
+	/** Average latency in nanoseconds. */
+	uint32_t avg_ns;
+
+	/** 50th, 90th and 99th percentile of the latency in nanoseconds. */
+	uint32_t p50_ns;
+	uint32_t p90_ns;
+	uint32_t p99_ns;
+};
+
+/** @brief Configure latency measurement between two hardware events.
+ *
+ * The events capture the value of a free-running TIMER, and the difference is added to the
+ * latency histogram of the event pair. The measurement is enabled when the function returns.
+ *
+ * @note The same rules for events used by DPPI in the application apply as for
+ *	 @ref ppi_trace_config.
+ *
+ * @param name		Name of the event pair, used in the shell output.
+ * @param start_evt	Hardware event that starts the measurement.
+ * @param stop_evt	Hardware event that ends the measurement, or 0 if the measurement
+ *			is ended by calling @ref ppi_trace_latency_stop, for example on
+ *			the entry to an interrupt handler.
+ *
+ * @return Handle, or NULL if the configuration failed.
+ */
+void *ppi_trace_latency_config(const char *name, uint32_t start_evt, uint32_t stop_evt);
+
+/** @brief End the measurement of an event pair from software.
+ *
+ * The function captures the TIMER and adds the latency since the last start event to the
+ * histogram. It can be called from an interrupt handler.
+ *
+ * @param handle	Handle of the event pair configured without a stop event.
+ */
+void ppi_trace_latency_stop(void *handle);
+
+/** @brief Get the latency statistics of an event pair.
+ *
+ * @param handle	Handle of the event pair.
+ * @param stats		Statistics.
+ */
+void ppi_trace_latency_stats_get(void *handle, struct ppi_trace_latency_stats *stats);
+
+/** @brief Reset the latency statistics of an event pair.
+ *
+ * @param handle	Handle of the event pair.
+ */
+void ppi_trace_latency_reset(void *handle);
+
+#endif /* defined(CONFIG_PPI_TRACE_LATENCY) || defined(__DOXYGEN__) */
+
 /** @} */
 
 #ifdef __cplusplus
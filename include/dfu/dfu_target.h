@@ -36,16 +36,22 @@ enum dfu_target_image_type {
 	DFU_TARGET_IMAGE_TYPE_FULL_MODEM = 4,
 	/** SMP external MCU */
 	DFU_TARGET_IMAGE_TYPE_SMP = 8,
+	/** Compressed application image in MCUBoot format */
+	DFU_TARGET_IMAGE_TYPE_MCUBOOT_COMPRESSED = 16,
+	/** Delta patch for an application image in MCUBoot format */
+	DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA = 32,
 	/** Custom update implementation */
 	DFU_TARGET_IMAGE_TYPE_CUSTOM = 128,
 	/** Any application image type */
-	DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION = DFU_TARGET_IMAGE_TYPE_MCUBOOT,
+	DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION =
+		(DFU_TARGET_IMAGE_TYPE_MCUBOOT | DFU_TARGET_IMAGE_TYPE_MCUBOOT_COMPRESSED |
+		 DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA),
 	/** Any modem image */
 	DFU_TARGET_IMAGE_TYPE_ANY_MODEM =
 		(DFU_TARGET_IMAGE_TYPE_MODEM_DELTA | DFU_TARGET_IMAGE_TYPE_FULL_MODEM),
 	/** Any DFU image type */
 	DFU_TARGET_IMAGE_TYPE_ANY =
-		(DFU_TARGET_IMAGE_TYPE_MCUBOOT | DFU_TARGET_IMAGE_TYPE_MODEM_DELTA |
+		(DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION | DFU_TARGET_IMAGE_TYPE_MODEM_DELTA |
 		 DFU_TARGET_IMAGE_TYPE_FULL_MODEM | DFU_TARGET_IMAGE_TYPE_CUSTOM),
 };
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file dfu_target_mcuboot_compressed.h
+ *
+ * @defgroup dfu_target_mcuboot_compressed Compressed MCUBoot DFU Target
+ * @{
+ * @brief DFU Target for compressed upgrades performed by MCUBoot
+ *
+ * The image is decompressed while it is received and the decompressed
+ * MCUBoot image is written to the secondary slot. The MCUBoot DFU target
+ * is used for writing, so the buffer set with dfu_target_mcuboot_set_buf()
+ * is used for flash write operations.
+ */
+
+#ifndef DFU_TARGET_MCUBOOT_COMPRESSED_H__
+#define DFU_TARGET_MCUBOOT_COMPRESSED_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
+#include <dfu/dfu_target.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic word at the start of a compressed MCUBoot image ("NLZ2"). */
+#define DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC 0x325a4c4e
+
+/** The ARM thumb filter has been applied to the image before compression. */
+#define DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_ARM_THUMB BIT(0)
+
+/**
+ * @brief Header of a compressed MCUBoot image.
+ *
+ * The header is followed by the LZMA2-compressed MCUBoot image, in the same
+ * format as used for MCUBoot compressed images. All fields are little-endian.
+ */
+struct dfu_target_mcuboot_compressed_header {
+	/** Magic word, #DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC. */
+	uint32_t magic;
+	/** Flags, DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_*. */
+	uint32_t flags;
+	/** Size of the decompressed MCUBoot image. */
+	uint32_t image_size;
+} __packed;
+
+/**
+ * @brief See if data in buf indicates a compressed MCUBoot style upgrade.
+ *
+ * @retval true if data matches, false otherwise.
+ */
+bool dfu_target_mcuboot_compressed_identify(const void *const buf);
+
+/**
+ * @brief Initialize dfu target, perform steps necessary to receive firmware.
+ *
+ * The MCUBoot DFU target is initialized once the image header has been
+ * received.
+ *
+ * @param[in] file_size Size of the compressed file being downloaded.
+ * @param[in] img_num Image pair index.
+ * @param[in] cb Callback for signaling events(unused).
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_mcuboot_compressed_init(size_t file_size, int img_num, dfu_target_callback_t cb);
+
+/**
+ * @brief Get offset of firmware
+ *
+ * The decompression can not be resumed, so the offset is reset to zero
+ * when the upgrade is aborted.
+ *
+ * @param[out] offset Returns the offset in the compressed file.
+ *
+ * @return 0 if success, otherwise negative value if unable to get the offset
+ */
+int dfu_target_mcuboot_compressed_offset_get(size_t *offset);
+
+/**
+ * @brief Decompress firmware data and write it to the secondary slot.
+ *
+ * @param[in] buf Pointer to compressed data.
+ * @param[in] len Length of data to write.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_compressed_write(const void *const buf, size_t len);
+
+/**
+ * @brief Deinitialize resources and finalize firmware upgrade if successful.
+ *
+ * @param[in] successful Indicate whether the firmware was successfully recived.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_compressed_done(bool successful);
+
+/**
+ * @brief Schedule update of one or more images.
+ *
+ * @param[in] img_num Given image pair index or -1 for all
+ *		      of image pair indexes.
+ *
+ * @return 0 for a successful request or a negative error
+ *	   code identicating reason of failure.
+ **/
+int dfu_target_mcuboot_compressed_schedule_update(int img_num);
+
+/**
+ * @brief Release resources and erase the download area.
+ *
+ * Cancels any ongoing updates.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_compressed_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DFU_TARGET_MCUBOOT_COMPRESSED_H__ */
+
+/**@} */
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file dfu_target_mcuboot_delta.h
+ *
+ * @defgroup dfu_target_mcuboot_delta Delta MCUBoot DFU Target
+ * @{
+ * @brief DFU Target for delta upgrades performed by MCUBoot
+ *
+ * The received patch is applied to the image in the primary slot and the
+ * resulting MCUBoot image is written to the secondary slot. The MCUBoot DFU
+ * target is used for writing, so the buffer set with
+ * dfu_target_mcuboot_set_buf() is used for flash write operations.
+ */
+
+#ifndef DFU_TARGET_MCUBOOT_DELTA_H__
+#define DFU_TARGET_MCUBOOT_DELTA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <dfu/dfu_target.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic word at the start of a delta patch ("NDL1"). */
+#define DFU_TARGET_MCUBOOT_DELTA_MAGIC 0x314c444e
+
+/**
+ * @brief Header of a delta patch.
+ *
+ * The header is followed by a sequence of commands. All fields are
+ * little-endian.
+ */
+struct dfu_target_mcuboot_delta_header {
+	/** Magic word, #DFU_TARGET_MCUBOOT_DELTA_MAGIC. */
+	uint32_t magic;
+	/** Size of the source image in the primary slot. */
+	uint32_t source_size;
+	/** CRC32 (IEEE) of the source image. */
+	uint32_t source_crc;
+	/** Size of the resulting MCUBoot image. */
+	uint32_t target_size;
+	/** CRC32 (IEEE) of the resulting MCUBoot image. */
+	uint32_t target_crc;
+} __packed;
+
+/** Delta patch command types. */
+enum dfu_target_mcuboot_delta_cmd_type {
+	/** Copy bytes from the source image. */
+	DFU_TARGET_MCUBOOT_DELTA_CMD_COPY = 0,
+	/** Add the following bytes to the bytes of the source image. */
+	DFU_TARGET_MCUBOOT_DELTA_CMD_ADD = 1,
+	/** Insert the following bytes. */
+	DFU_TARGET_MCUBOOT_DELTA_CMD_INSERT = 2,
+};
+
+/**
+ * @brief Delta patch command.
+ *
+ * For #DFU_TARGET_MCUBOOT_DELTA_CMD_ADD and
+ * #DFU_TARGET_MCUBOOT_DELTA_CMD_INSERT, the command is followed by
+ * @c length bytes of data.
+ */
+struct dfu_target_mcuboot_delta_cmd {
+	/** Command type, #dfu_target_mcuboot_delta_cmd_type. */
+	uint32_t type;
+	/** Number of bytes produced by the command. */
+	uint32_t length;
+	/** Offset in the source image, unused for insert commands. */
+	uint32_t source_offset;
+} __packed;
+
+/**
+ * @brief See if data in buf indicates a delta MCUBoot style upgrade.
+ *
+ * @retval true if data matches, false otherwise.
+ */
+bool dfu_target_mcuboot_delta_identify(const void *const buf);
+
+/**
+ * @brief Initialize dfu target, perform steps necessary to receive firmware.
+ *
+ * The MCUBoot DFU target is initialized once the patch header has been
+ * received and the source image has been verified.
+ *
+ * @param[in] file_size Size of the patch being downloaded.
+ * @param[in] img_num Image pair index.
+ * @param[in] cb Callback for signaling events(unused).
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_mcuboot_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb);
+
+/**
+ * @brief Get offset of firmware
+ *
+ * The patch application can not be resumed, so the offset is reset to zero
+ * when the upgrade is aborted.
+ *
+ * @param[out] offset Returns the offset in the patch.
+ *
+ * @return 0 if success, otherwise negative value if unable to get the offset
+ */
+int dfu_target_mcuboot_delta_offset_get(size_t *offset);
+
+/**
+ * @brief Apply patch data and write the result to the secondary slot.
+ *
+ * @param[in] buf Pointer to patch data.
+ * @param[in] len Length of data to write.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_delta_write(const void *const buf, size_t len);
+
+/**
+ * @brief Deinitialize resources and finalize firmware upgrade if successful.
+ *
+ * @param[in] successful Indicate whether the firmware was successfully recived.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_delta_done(bool successful);
+
+/**
+ * @brief Schedule update of one or more images.
+ *
+ * @param[in] img_num Given image pair index or -1 for all
+ *		      of image pair indexes.
+ *
+ * @return 0 for a successful request or a negative error
+ *	   code identicating reason of failure.
+ **/
+int dfu_target_mcuboot_delta_schedule_update(int img_num);
+
+/**
+ * @brief Release resources and erase the download area.
+ *
+ * Cancels any ongoing updates.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_delta_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DFU_TARGET_MCUBOOT_DELTA_H__ */
+
+/**@} */
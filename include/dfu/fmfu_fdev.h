@@ -29,6 +29,8 @@ extern "C" {
  * function.
  *
  * @param[in] buf Pointer to buffer used to read data from external flash.
+ *                With CONFIG_FMFU_FDEV_READ_AHEAD, each half of the buffer
+ *                holds one chunk of data.
  * @param[in] buf_len Length of provided buffer.
  * @param[in] fdev Flash device to read modem firmware from.
  * @param[in] offset Offset within configured flash device to first byte of
@@ -104,6 +104,10 @@ struct dm_result {
 			float rtt;
 		} rtt;
 	} dist_estimates;
+#ifdef CONFIG_DM_PEER_RATE
+	/** Rate of successful measurements with the peer, in millihertz. */
+	uint32_t rate_mhz;
+#endif
 };
 
 /** @brief Event callback structure. */
@@ -21,8 +21,26 @@ typedef enum {
 	HPF_GPIO_PIN_SET       = 2, /* Set eGPIO pin. */
 	HPF_GPIO_PIN_TOGGLE    = 3, /* Toggle eGPIO pin. */
 	HPF_GPIO_PORT_SET_MASKED = 4, /* Atomically update selected eGPIO pins. */
+	HPF_GPIO_PORT_STREAM   = 5, /* Play out a waveform stream on selected eGPIO pins. */
 } hpf_gpio_opcode_t;
 
+/** @brief Number of buffers of an eGPIO waveform stream. */
+#define HPF_GPIO_STREAM_BUF_COUNT 2
+
+/** @brief eGPIO waveform stream, shared between the cores.
+ *
+ * The FLPR core plays out the buffers in turn, writing one raw port value
+ * to the selected pins every period. A buffer is released by clearing its
+ * length, after which the application core can fill it again. The stream
+ * stops when the next buffer is not filled in time.
+ */
+typedef struct {
+	const uint32_t *buf[HPF_GPIO_STREAM_BUF_COUNT]; /* Buffers of raw port values. */
+	volatile uint32_t len[HPF_GPIO_STREAM_BUF_COUNT]; /* Number of values, 0 if empty. */
+	uint32_t period; /* Period of a value in FLPR core clock cycles. */
+	volatile bool active; /* Cleared by the FLPR core when the stream stops. */
+} hpf_gpio_stream_t;
+
 /** @brief eGPIO data packet. */
 typedef struct __packed {
 	uint8_t opcode; /* eGPIO opcode. */
@@ -31,6 +49,7 @@ typedef struct __packed {
 	uint32_t flags; /* Configuration flags when opcode
 			 * is HPF_GPIO_PIN_CONFIGURE (gpio_flags_t).
 			 * Raw pin value when opcode is HPF_GPIO_PORT_SET_MASKED.
+			 * Address of hpf_gpio_stream_t when opcode is HPF_GPIO_PORT_STREAM.
 			 * Not used in other cases.
 			 */
 } hpf_gpio_data_packet_t;
@@ -40,6 +59,28 @@ typedef struct {
 	hpf_gpio_data_packet_t data;
 } hpf_gpio_mbox_data_t;
 
+#if defined(CONFIG_GPIO_HPF_STREAM)
+#include <zephyr/drivers/gpio.h>
+
+/**
+ * @brief Start playing out a waveform stream on the pins of an HPF GPIO port.
+ *
+ * Fill the first buffer and set its length before starting the stream, and keep
+ * filling the released buffers while @c active is set.
+ *
+ * @param port   HPF GPIO port.
+ * @param mask   Mask of the pins driven by the stream.
+ * @param stream Stream, must stay valid until the FLPR core clears @c active.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the stream has no data or no period.
+ * @retval -EBUSY If the stream is already active.
+ * @retval -EIO If the stream could not be passed to the FLPR core.
+ */
+int gpio_hpf_stream_start(const struct device *port, gpio_port_pins_t mask,
+			  hpf_gpio_stream_t *stream);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,7 @@ typedef enum {
 	HPF_MSPI_CONFIG_XFER,      /* hpf_mspi_xfer_config_msg_t */
 	HPF_MSPI_TX,	            /* hpf_mspi_xfer_packet_msg_t + data buffer at the end */
 	HPF_MSPI_TXRX,
+	HPF_MSPI_XFER_QUEUE,       /* hpf_mspi_xfer_queue_msg_t, IPC no copy mode only */
 	HPF_MSPI_HPF_APP_HARD_FAULT,
 	HPF_MSPI_WRONG_OPCODE,
 	HPF_MSPI_OPCODES_COUNT = HPF_MSPI_WRONG_OPCODE,
@@ -91,6 +92,15 @@ typedef struct {
 #endif
 } hpf_mspi_xfer_packet_msg_t;
 
+#if (defined(CONFIG_MSPI_HPF_IPC_NO_COPY) || defined(CONFIG_HPF_MSPI_IPC_NO_COPY))
+typedef struct {
+	hpf_mspi_opcode_t opcode; /* HPF_MSPI_XFER_QUEUE */
+	uint32_t num_packets;
+	/* Packets executed back to back, opcode of each is HPF_MSPI_TX or HPF_MSPI_TXRX. */
+	hpf_mspi_xfer_packet_msg_t *packets;
+} hpf_mspi_xfer_queue_msg_t;
+#endif
+
 typedef struct {
 	hpf_mspi_opcode_t opcode;
 	uint8_t data;
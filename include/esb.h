@@ -309,6 +309,15 @@ struct esb_evt {
 	uint32_t tx_attempts;	/**< Number of TX retransmission attempts. */
 };
 
+/** @brief Enhanced ShockBurst per-pipe TX statistics. */
+struct esb_pipe_stats {
+	uint32_t tx_success;	 /**< Number of acknowledged payloads. */
+	uint32_t tx_failed;	 /**< Number of payloads that were not acknowledged. */
+	uint32_t retransmits;	 /**< Number of retransmissions. */
+	uint32_t latency_avg_us; /**< Average time from writing to acknowledgment. */
+	uint32_t latency_max_us; /**< Maximum time from writing to acknowledgment. */
+};
+
 /** @brief Event handler prototype. */
 typedef void (*esb_event_handler)(const struct esb_evt *event);
 
@@ -561,6 +570,32 @@ int esb_set_rf_channel(uint32_t channel);
  */
 int esb_get_rf_channel(uint32_t *channel);
 
+/** @brief Set the channels to hop between.
+ *
+ *  The first channel is used until a PTX fails a transmission or a PRX does
+ *  not receive packets for the dwell time. The packet error rate of each
+ *  channel is tracked, and channels with a high error rate are skipped for
+ *  a while. Requires the CONFIG_ESB_CHANNEL_HOPPING Kconfig option.
+ *
+ *  @param[in] channels	Channels (between 0 and 100). Use the same list on the
+ *			PTX and the PRX.
+ *  @param[in] count	Number of channels. Pass 0 or 1 to disable hopping.
+ *
+ * @retval 0 If successful.
+ * @retval -EBUSY  If the radio is not idle.
+ * @retval -EINVAL If the channel list is invalid.
+ */
+int esb_set_hop_channels(const uint8_t *channels, uint8_t count);
+
+/** @brief Get the adaptive channel map.
+ *
+ *  Requires the CONFIG_ESB_CHANNEL_HOPPING Kconfig option.
+ *
+ * @return Bit field where bit n is set if the nth channel set with
+ *         @ref esb_set_hop_channels is currently used for hopping.
+ */
+uint32_t esb_hop_channel_map_get(void);
+
 /** @brief Set the radio output power.
  *
  *  @param[in] tx_output_power	Output power in dBm. The @ref esb_tx_power values can be used
@@ -616,6 +651,26 @@ int esb_set_bitrate(enum esb_bitrate bitrate);
  */
 int esb_reuse_pid(uint8_t pipe);
 
+/** @brief Get the TX statistics of a pipe.
+ *
+ *  In PTX mode, the statistics cover the transmitted payloads. In PRX mode,
+ *  they cover the ACK payloads. Requires the CONFIG_ESB_PIPE_STATS Kconfig
+ *  option.
+ *
+ *  @param[in]  pipe	Pipe.
+ *  @param[out] stats	Statistics of the pipe.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the pipe is invalid.
+ */
+int esb_pipe_stats_get(uint8_t pipe, struct esb_pipe_stats *stats);
+
+/** @brief Reset the TX statistics of all pipes.
+ *
+ *  Requires the CONFIG_ESB_PIPE_STATS Kconfig option.
+ */
+void esb_pipe_stats_reset(void);
+
 /** @} */
 
 #ifdef __cplusplus
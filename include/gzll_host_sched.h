@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef __GZLL_HOST_SCHED_H
+#define __GZLL_HOST_SCHED_H
+
+/**
+ * @file
+ * @brief Gazell Host scheduler
+ *
+ * Services the RX FIFOs of the pipes of a Host in priority order and
+ * gathers per-pipe statistics.
+ */
+
+#include <stdint.h>
+#include <nrf_gzll.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup gzll_host_sched Gazell Host scheduler
+ *
+ * Services the RX FIFOs of the pipes of a Host in priority order and
+ * gathers per-pipe statistics.
+ *
+ * @{
+ */
+
+/** Number of packet error rate histogram buckets, each covering 10 percent. */
+#define GZLL_HOST_SCHED_PER_BUCKETS 10
+
+/** @brief Statistics of a pipe. */
+struct gzll_host_sched_stats {
+	/** Number of received packets. */
+	uint32_t packets;
+	/** Number of packets received with a CRC failure. */
+	uint32_t crc_failures;
+	/** Longest interval between two received packets, in milliseconds. */
+	uint32_t interval_max_ms;
+	/** Average RSSI of the received packets, in dBm. */
+	int16_t rssi_avg;
+	/** Histogram of the intervals between two received packets. Bucket n counts the
+	 *  intervals shorter than 2^n milliseconds, the last bucket counts all longer intervals.
+	 */
+	uint32_t interval_hist[CONFIG_GAZELL_HOST_SCHED_INTERVAL_BUCKETS];
+	/** Histogram of the packet error rate, measured over
+	 *  CONFIG_GAZELL_HOST_SCHED_PER_WINDOW packets. Bucket n counts the measurements from
+	 *  n * 10 percent up to (n + 1) * 10 percent.
+	 */
+	uint32_t per_hist[GZLL_HOST_SCHED_PER_BUCKETS];
+};
+
+/**
+ * @brief Initialize the Host scheduler.
+ *
+ * Must be called after @ref nrf_gzll_init. The scheduler registers the CRC failure
+ * callback of Gazell.
+ *
+ * @retval true  if initialization is successful.
+ * @retval false if initialization is unsuccessful.
+ */
+bool gzll_host_sched_init(void);
+
+/**
+ * @brief Set the priority of a pipe.
+ *
+ * All pipes have the priority 0 by default.
+ *
+ * @param pipe Pipe.
+ * @param prio Priority, a lower value is a higher priority.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the pipe is invalid.
+ */
+int gzll_host_sched_prio_set(uint8_t pipe, uint8_t prio);
+
+/**
+ * @brief Notify the scheduler of a received packet.
+ *
+ * Call this function from @ref nrf_gzll_host_rx_data_ready.
+ *
+ * @param pipe    Pipe the packet was received on.
+ * @param rx_info Receive information of the packet.
+ */
+void gzll_host_sched_rx(uint32_t pipe, nrf_gzll_host_rx_info_t rx_info);
+
+/**
+ * @brief Get the next pipe to service.
+ *
+ * Pipes with the same priority are serviced in a round-robin fashion.
+ *
+ * @return The pipe with the highest priority that has packets in its RX FIFO,
+ *         or -ENODATA if all RX FIFOs are empty.
+ */
+int gzll_host_sched_next(void);
+
+/**
+ * @brief Get the statistics of a pipe.
+ *
+ * @param pipe  Pipe.
+ * @param stats Statistics of the pipe.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the pipe is invalid.
+ */
+int gzll_host_sched_stats_get(uint8_t pipe, struct gzll_host_sched_stats *stats);
+
+/**
+ * @brief Reset the statistics of all pipes.
+ */
+void gzll_host_sched_stats_reset(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GZLL_HOST_SCHED_H */
@@ -36,6 +36,20 @@ enum at_parser_cmd_type {
 	AT_PARSER_CMD_TYPE_TEST
 };
 
+/**
+ * @brief Position of a value in an AT command line, recorded by @ref at_parser_index_set.
+ *
+ * The contents are internal to the AT parser.
+ */
+struct at_parser_index_entry {
+	/* Offset of the value from the beginning of the AT command line. */
+	uint16_t start;
+	/* Length of the value. */
+	uint16_t len;
+	/* Type of the value. */
+	uint8_t type;
+};
+
 /**
  * @brief AT parser
  *
@@ -53,6 +67,16 @@ struct at_parser {
 	bool is_next_empty;
 	/* Sentinel value for determining initialization state. */
 	uint32_t init_sentinel;
+	/* Optional index of the values in the current AT command line. */
+	struct at_parser_index_entry *index;
+	/* Number of entries in the index. */
+	size_t index_size;
+	/* Number of values recorded in the index. */
+	size_t index_count;
+	/* Error that terminated the tokenization of the indexed AT command line, or zero if the
+	 * line is indexed partially.
+	 */
+	int index_err;
 };
 
 /**
@@ -118,6 +142,31 @@ int at_parser_init(struct at_parser *parser, const char *at);
  */
 int at_parser_cmd_next(struct at_parser *parser);
 
+/**
+ * @brief Index the values of the current AT command line of an AT parser.
+ *
+ * Tokenizes the current AT command line once and records the position of each value in
+ * @p index, so that subsequent calls to the getter functions run in constant time instead
+ * of tokenizing the AT command line from its beginning up to the requested index.
+ * The index is rebuilt for each new line when calling @ref at_parser_cmd_next, and is
+ * discarded when calling @ref at_parser_init.
+ *
+ * If the AT command line has more values than @p size, getting the values that are not
+ * recorded falls back to tokenizing the AT command line.
+ *
+ * @param[in] parser A pointer to the AT parser.
+ * @param[in] index  Array to record the position of the values in. Must remain valid for as
+ *                   long as @p parser is used.
+ * @param[in] size   Number of entries in @p index.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ * @retval -EPERM  @p parser has not been initialized.
+ */
+int at_parser_index_set(struct at_parser *parser, struct at_parser_index_entry *index,
+			size_t size);
+
 /**
  * @brief Get the type of the command prefix in the current AT command line.
  *
@@ -347,6 +396,134 @@ int at_parser_string_get(struct at_parser *parser, size_t index, char *str, size
 int at_parser_string_ptr_get(struct at_parser *parser, size_t index, const char **str_ptr,
 			     size_t *len);
 
+/** @brief Type of a value reported by the incremental AT parser. */
+enum at_parser_value_type {
+	/** AT command prefix or notification header. */
+	AT_PARSER_VALUE_TYPE_PREFIX,
+	/** Integer subparameter. */
+	AT_PARSER_VALUE_TYPE_INT,
+	/** Quoted or non-quoted string subparameter. */
+	AT_PARSER_VALUE_TYPE_STRING,
+	/** Array subparameter, without the enclosing parentheses. */
+	AT_PARSER_VALUE_TYPE_ARRAY,
+	/** Empty subparameter. */
+	AT_PARSER_VALUE_TYPE_EMPTY,
+};
+
+/** @brief Value reported by the incremental AT parser. */
+struct at_parser_value {
+	/** Line number in the AT command string, starting from zero. */
+	size_t line;
+	/** Index of the value in the current line. */
+	size_t index;
+	/** Value type. */
+	enum at_parser_value_type type;
+	/** AT command type, for values of type @ref AT_PARSER_VALUE_TYPE_PREFIX. */
+	enum at_parser_cmd_type cmd_type;
+	/** Value string, not null-terminated. Only valid in the callback. */
+	const char *str;
+	/** Length of @c str. */
+	size_t len;
+	/** Integer value, for values of type @ref AT_PARSER_VALUE_TYPE_INT. */
+	int64_t num;
+};
+
+/**
+ * @brief Incremental AT parser callback.
+ *
+ * @param[in] value     Parsed value.
+ * @param[in] user_data User data given in @ref at_parser_stream_init.
+ *
+ * @return 0 to continue parsing, or a (negative) error code to stop.
+ */
+typedef int (*at_parser_stream_cb_t)(const struct at_parser_value *value, void *user_data);
+
+/**
+ * @brief Incremental AT parser
+ *
+ * Holds the parsing state for an AT command string that is fed in chunks.
+ * Only the value currently being parsed is kept in the buffer given at initialization,
+ * so the buffer must only be large enough to hold the longest single value.
+ */
+struct at_parser_stream {
+	/* Buffer holding the value currently being parsed. */
+	char *buf;
+	/* Size of the buffer. */
+	size_t buf_size;
+	/* Number of bytes in the buffer. */
+	size_t len;
+	/* Callback for parsed values. */
+	at_parser_stream_cb_t cb;
+	/* User data for the callback. */
+	void *user_data;
+	/* Current line number. */
+	size_t line;
+	/* Number of values parsed so far for the current line. */
+	size_t count;
+	/* Indicates that the previous subparameter had a trailing comma. */
+	bool is_next_empty;
+	/* Indicates that the previous subparameter terminated the line. */
+	bool is_line_end;
+	/* Indicates that a final response was found, and the rest is ignored. */
+	bool is_resp;
+	/* Error that stopped parsing, if any. */
+	int err;
+};
+
+/**
+ * @brief Initialize an incremental AT parser.
+ *
+ * @param[out] stream    Incremental AT parser.
+ * @param[in]  buf       Buffer for the value currently being parsed.
+ * @param[in]  buf_size  Size of @p buf. Must be larger than the longest value, including its
+ *                       quotes and separators.
+ * @param[in]  cb        Callback for parsed values.
+ * @param[in]  user_data User data passed to @p cb.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ */
+int at_parser_stream_init(struct at_parser_stream *stream, char *buf, size_t buf_size,
+			  at_parser_stream_cb_t cb, void *user_data);
+
+/**
+ * @brief Feed a chunk of an AT command string to an incremental AT parser.
+ *
+ * The callback is called for each value which is complete in the data fed so far.
+ * A chunk can split the AT command string at any position.
+ * Parsing stops at the first final response (OK, ERROR, +CME ERROR or +CMS ERROR),
+ * the rest of the data is ignored.
+ *
+ * @param[in] stream Incremental AT parser.
+ * @param[in] data   Chunk of the AT command string. Does not need to be null-terminated.
+ * @param[in] len    Length of @p data.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned, and all subsequent calls fail
+ *           with the same error.
+ * @retval -EINVAL  One or more of the supplied parameters are invalid.
+ * @retval -ENOMEM  A value does not fit the buffer of @p stream.
+ * @retval -EBADMSG The AT command string is malformed.
+ * @retval Other    Error returned by the callback.
+ */
+int at_parser_stream_feed(struct at_parser_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Signal the end of the AT command string to an incremental AT parser.
+ *
+ * Parses the last value if the AT command string does not end with a line terminator.
+ *
+ * @param[in] stream Incremental AT parser.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL  One or more of the supplied parameters are invalid.
+ * @retval -EBADMSG The AT command string is malformed.
+ * @retval Other    Error returned by the callback.
+ */
+int at_parser_stream_finish(struct at_parser_stream *stream);
+
 /** @} */
 
 #ifdef __cplusplus
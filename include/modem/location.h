@@ -754,6 +754,32 @@ void location_cloud_location_ext_result_set(
 	enum location_ext_result result,
 	struct location_data *location);
 
+/**
+ * @brief Give a hint on whether the device is stationary.
+ *
+ * @details The application can use this, for example, with an accelerometer to tell the library
+ * whether the device has moved. When the device is reported stationary, the cached location
+ * acquired after that is returned for location requests until it expires, without checking the
+ * serving cell or the Wi-Fi access points. When the device is reported not stationary, the cached
+ * location is cleared and no location is cached until the device is reported stationary again.
+ *
+ * @param[in] stationary Whether the device is stationary.
+ *
+ * @return 0 on success, or negative error code on failure.
+ * @retval -ENOTSUP @kconfig{CONFIG_LOCATION_CACHE} is not set.
+ */
+int location_stationary_hint_set(bool stationary);
+
+/**
+ * @brief Clear the cached location.
+ *
+ * @details The next location request acquires a new location with the requested methods.
+ *
+ * @return 0 on success, or negative error code on failure.
+ * @retval -ENOTSUP @kconfig{CONFIG_LOCATION_CACHE} is not set.
+ */
+int location_cache_clear(void);
+
 /** @} */
 
 #ifdef __cplusplus
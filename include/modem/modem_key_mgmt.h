@@ -165,6 +165,58 @@ int modem_key_mgmt_digest(nrf_sec_tag_t sec_tag,
 			  enum modem_key_mgmt_cred_type cred_type,
 			  void *buf, size_t len);
 
+/**
+ * @brief Compare the SHA-256 digest of a credential in persistent storage with a given digest.
+ *
+ * Only the digest is read from the modem, so this is much faster than
+ * @ref modem_key_mgmt_cmp for large credentials. The digest can be generated
+ * at build time from the credential file, see @ref modem_key_mgmt_write_if_changed.
+ *
+ * @param[in] sec_tag		The security tag of the credential.
+ * @param[in] cred_type		The credential type.
+ * @param[in] digest		Digest to compare with, @ref MODEM_KEY_MGMT_DIGEST_SIZE bytes long.
+ *
+ * @retval 0		If the digests match.
+ * @retval 1		If the digests do not match.
+ * @retval -EINVAL	Invalid parameters or invalid response from the modem.
+ * @retval -ENOENT	No credential associated with the given
+ *			@p sec_tag and @p cred_type.
+ */
+int modem_key_mgmt_digest_cmp(nrf_sec_tag_t sec_tag,
+			      enum modem_key_mgmt_cred_type cred_type,
+			      const void *digest);
+
+/**
+ * @brief Write a credential to persistent storage if its digest differs from the stored one.
+ *
+ * The SHA-256 digest of the stored credential is compared with @p digest using
+ * @ref modem_key_mgmt_digest_cmp. The credential is written only if it does not exist
+ * or the digests do not match.
+ *
+ * The @p digest must be the SHA-256 digest of the @p len bytes of @p buf.
+ * Use the ``ncs_generate_sha256_inc_file`` CMake function to generate it at build time
+ * from the credential file.
+ *
+ * @note If the credential needs to be written and the LTE link is active,
+ *	 the function will return an error and the key will not be written.
+ *
+ * @param[in] sec_tag		Security tag to associate with this credential.
+ * @param[in] cred_type		The credential type.
+ * @param[in] buf		Buffer containing the credential data.
+ * @param[in] len		Length of the buffer.
+ * @param[in] digest		SHA-256 digest of the credential data,
+ *				@ref MODEM_KEY_MGMT_DIGEST_SIZE bytes long.
+ *
+ * @retval 0		On success, or if the stored credential is up to date.
+ * @retval -EINVAL	Invalid parameters.
+ * @return		Other negative error codes returned by
+ *			@ref modem_key_mgmt_digest_cmp or @ref modem_key_mgmt_write.
+ */
+int modem_key_mgmt_write_if_changed(nrf_sec_tag_t sec_tag,
+				    enum modem_key_mgmt_cred_type cred_type,
+				    const void *buf, size_t len,
+				    const void *digest);
+
 /**
  * @brief Check if a credential exists in persistent storage.
  *
@@ -248,6 +248,33 @@ struct nrf_modem_lib_diag_stats {
 int nrf_modem_lib_diag_stats_get(struct nrf_modem_lib_diag_stats *stats);
 #endif
 
+#if defined(CONFIG_NRF_MODEM_LIB_RECV_LOAN) || defined(__DOXYGEN__)
+/**
+ * @brief Receive data from a socket into a loaned buffer.
+ *
+ * Receives up to @kconfig{CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_SIZE} bytes into a buffer
+ * owned by the library, so that the data can be processed in place instead of being copied
+ * again from an application receive buffer.
+ * The buffer must be returned with @ref nrf_modem_lib_recv_loan_release once processed.
+ *
+ * @param fd Socket descriptor.
+ * @param[out] data Set to the loaned buffer when data is received, or to NULL otherwise.
+ * @param flags Receive flags, as for @c recv.
+ *
+ * @return Number of bytes received on success, 0 if the peer has closed the connection,
+ *         or -1 with @c errno set on failure. @c errno is set to @c ENOBUFS if all
+ *         the loaned buffers are in use.
+ */
+ssize_t nrf_modem_lib_recv_loan(int fd, const void **data, int flags);
+
+/**
+ * @brief Release a buffer loaned by @ref nrf_modem_lib_recv_loan.
+ *
+ * @param data Loaned buffer.
+ */
+void nrf_modem_lib_recv_loan_release(const void *data);
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
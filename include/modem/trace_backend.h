@@ -145,6 +145,38 @@ struct nrf_modem_lib_trace_backend {
 	int (*resume)(void);
 };
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__)
+/**
+ * @brief Report the bitrate of a completed trace data transfer.
+ *
+ * Trace backends that transfer trace data asynchronously, after @c write has returned,
+ * call this function when a transfer completes and select the
+ * @kconfig{CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_REPORTED} Kconfig option.
+ * The reported samples are used for @ref nrf_modem_lib_trace_backend_bitrate_get.
+ *
+ * This function can be called from interrupt context.
+ *
+ * @param len Number of bytes transferred.
+ * @param ticks Duration of the transfer, in system ticks.
+ */
+void trace_backend_bitrate_report(size_t len, int64_t ticks);
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Built-in trace backends are instantiated under their own name when the fan-out backend
+ * is selected, so that several of them can be linked at the same time.
+ */
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FANOUT)
+#define TRACE_BACKEND_INSTANCE(name) trace_backend_##name
+#define TRACE_BACKEND_LOG_MODULE(name) modem_trace_backend_##name
+#else
+#define TRACE_BACKEND_INSTANCE(name) trace_backend
+#define TRACE_BACKEND_LOG_MODULE(name) modem_trace_backend
+#endif
+
+/** @endcond */
+
 /**@} */ /* defgroup trace_backend */
 
 #ifdef __cplusplus
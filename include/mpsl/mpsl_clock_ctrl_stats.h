@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file mpsl_clock_ctrl_stats.h
+ *
+ * @defgroup mpsl_clock_ctrl_stats Multiprotocol Service Layer external clock control statistics
+ *
+ * @brief MPSL external clock control HFCLK statistics
+ * @{
+ */
+
+#ifndef MPSL_CLOCK_CTRL_STATS__
+#define MPSL_CLOCK_CTRL_STATS__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/** @brief Statistics of the HFCLK requested by MPSL. */
+struct mpsl_clock_ctrl_hfclk_stats {
+	/** Number of times MPSL requested HFCLK while no other MPSL request was pending. */
+	uint32_t requests;
+	/** Number of times HFCLK was requested from the clock driver. Requests served within
+	 *  the keep-alive window of a previous release do not cause a ramp-up.
+	 */
+	uint32_t ramps;
+	/** Total time HFCLK was requested from the clock driver, in microseconds. */
+	uint64_t on_time_us;
+};
+
+/** @brief Get the HFCLK statistics.
+ *
+ * Requires the CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS Kconfig option.
+ *
+ * @param[out] stats Statistics of the HFCLK.
+ */
+void mpsl_clock_ctrl_hfclk_stats_get(struct mpsl_clock_ctrl_hfclk_stats *stats);
+
+/** @brief Reset the HFCLK statistics.
+ *
+ * Requires the CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS Kconfig option.
+ */
+void mpsl_clock_ctrl_hfclk_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MPSL_CLOCK_CTRL_STATS__ */
+
+/**@} */
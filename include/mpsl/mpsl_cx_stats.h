@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file mpsl_cx_stats.h
+ *
+ * @defgroup mpsl_cx_stats Multiprotocol Service Layer Radio Coexistence statistics
+ *
+ * @brief MPSL Radio Coexistence statistics
+ * @{
+ */
+
+#ifndef MPSL_CX_STATS__
+#define MPSL_CX_STATS__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/** @brief Radio operations tracked by the statistics. */
+enum mpsl_cx_stats_op {
+	/** Idle listening, MPSL_CX_OP_IDLE_LISTEN. */
+	MPSL_CX_STATS_OP_IDLE_LISTEN,
+	/** Reception, MPSL_CX_OP_RX. */
+	MPSL_CX_STATS_OP_RX,
+	/** Transmission, MPSL_CX_OP_TX. */
+	MPSL_CX_STATS_OP_TX,
+	/** Number of tracked radio operations. */
+	MPSL_CX_STATS_OP_COUNT
+};
+
+/** @brief Statistics of a radio operation. */
+struct mpsl_cx_stats_op_counters {
+	/** Number of requests for the radio operation. */
+	uint32_t requests;
+	/** Number of requests that were granted. */
+	uint32_t grants;
+	/** Number of requests that were released or replaced before being granted. */
+	uint32_t denials;
+	/** Average time from request to grant, in microseconds. */
+	uint32_t latency_avg_us;
+	/** Longest time from request to grant, in microseconds. */
+	uint32_t latency_max_us;
+};
+
+/** @brief Radio Coexistence statistics. */
+struct mpsl_cx_stats {
+	/** Statistics of each radio operation, indexed by @ref mpsl_cx_stats_op. */
+	struct mpsl_cx_stats_op_counters ops[MPSL_CX_STATS_OP_COUNT];
+};
+
+/**
+ * @brief Gets the Radio Coexistence statistics.
+ *
+ * The statistics are gathered by the Radio Coexistence interface implementation selected in
+ * the MPSL_CX_CHOICE Kconfig choice, if the CONFIG_MPSL_CX_STATS Kconfig option is enabled.
+ *
+ * @note The statistics are updated by MPSL in high-priority context. The snapshot is not
+ * guaranteed to be consistent between the radio operations.
+ *
+ * @param[out] stats Radio Coexistence statistics.
+ */
+void mpsl_cx_stats_get(struct mpsl_cx_stats *stats);
+
+/**
+ * @brief Resets the Radio Coexistence statistics.
+ */
+void mpsl_cx_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MPSL_CX_STATS__ */
+
+/**@} */
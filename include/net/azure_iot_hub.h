@@ -363,6 +363,14 @@ int azure_iot_hub_connect(const struct azure_iot_hub_config *config);
 int azure_iot_hub_disconnect(void);
 
 /** @brief Send data to Azure IoT Hub.
+ *
+ *  @note If @kconfig{CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH} is enabled, telemetry messages
+ *	  without properties are added to a batch that is sent as a JSON array when the batch
+ *	  window expires or the batch buffer is full. If
+ *	  @kconfig{CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE} is enabled, reported property
+ *	  patches are merged into one patch that is sent when the coalescing window expires.
+ *	  In both cases, a new message ID is used for the publication, and send errors are
+ *	  only logged. The request ID of the last merged patch is used for the merged patch.
  *
  *  @param[in] tx_data Pointer to struct containing data to be transmitted to
  *                     Azure IoT Hub.
@@ -373,11 +381,27 @@ int azure_iot_hub_disconnect(void);
  *  @retval -EMSGSIZE an internal buffer is too small to hold the topic data. This can for instance
  *		      happen if message properties are in use, as they are appended to the topic.
  *  @retval -ENOTCONN if the device is not connected to an IoT Hub.
- *  @retval -ENOMEM if the request ID buffer was insufficient to create the ID.
+ *  @retval -ENOMEM if the request ID buffer was insufficient to create the ID, or if a
+ *		    reported property patch does not fit in the coalescing buffer.
+ *  @retval -EBADMSG if a coalesced reported property patch is not a JSON object.
  *  @retval -EFAULT if there was an internal error in the library.
  */
 int azure_iot_hub_send(const struct azure_iot_hub_msg *const tx_data);
 
+/** @brief Send the pending telemetry batch and reported property patch immediately,
+ *	   without waiting for the end of the batching and coalescing windows.
+ *
+ *  @note If neither @kconfig{CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH} nor
+ *	  @kconfig{CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE} is enabled, this function
+ *	  does nothing.
+ *
+ *  @retval 0 If successful.
+ *  @retval -ENOTCONN if the device is not connected to an IoT Hub. The pending data is
+ *		      retained and sent when the connection is re-established.
+ *  @retval Otherwise a negative error code from sending the pending data.
+ */
+int azure_iot_hub_flush(void);
+
 /** @brief Send response to a direct method invoked from the cloud.
  *
  *  @param[in] result Structure containing result data from the direct method
@@ -40,6 +40,58 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 		      const char *const *uri_path_options, uint8_t *payload,
 		      uint16_t payload_size, coap_reply_t reply_cb);
 
+/** @brief Send CoAP confirmable request.
+ *
+ * The request is retransmitted with exponential back-off until it is
+ * acknowledged or the retransmission limit is reached. Several requests can be
+ * outstanding at the same time, see @kconfig{CONFIG_COAP_UTILS_MAX_PENDINGS}
+ * and @kconfig{CONFIG_COAP_UTILS_MAX_REPLIES}.
+ *
+ * @param[in] method           CoAP method type.
+ * @param[in] addr             pointer to socket address struct for IPv6.
+ * @param[in] uri_path_options pointer to CoAP URI schemes option.
+ * @param[in] payload          pointer to the CoAP message payload.
+ * @param[in] payload_size     size of the CoAP message payload.
+ * @param[in] reply_cb         function to call when the response comes.
+ *
+ * @retval >= 0 On success.
+ * @retval -ENOMEM No free slot for the request.
+ * @retval < 0 On other failure.
+ */
+int coap_send_con_request(enum coap_method method, const struct sockaddr *addr,
+			  const char *const *uri_path_options, uint8_t *payload,
+			  uint16_t payload_size, coap_reply_t reply_cb);
+
+/** @brief Register an observation of a CoAP resource.
+ *
+ * The reply callback is called for the registration response and for every
+ * following notification, until the observation is cancelled with
+ * @ref coap_observe_cancel.
+ *
+ * @param[in] addr             pointer to socket address struct for IPv6.
+ * @param[in] uri_path_options pointer to CoAP URI schemes option.
+ * @param[in] reply_cb         function to call when a notification comes.
+ *
+ * @retval >= 0 On success.
+ * @retval -EINVAL No reply callback provided.
+ * @retval < 0 On other failure.
+ */
+int coap_observe(const struct sockaddr *addr,
+		 const char *const *uri_path_options, coap_reply_t reply_cb);
+
+/** @brief Cancel an observation of a CoAP resource.
+ *
+ * @param[in] addr             pointer to socket address struct for IPv6.
+ * @param[in] uri_path_options pointer to CoAP URI schemes option.
+ * @param[in] reply_cb         function passed to @ref coap_observe.
+ *
+ * @retval >= 0 On success.
+ * @retval -ENOENT No observation registered with the given callback.
+ * @retval < 0 On other failure.
+ */
+int coap_observe_cancel(const struct sockaddr *addr,
+			const char *const *uri_path_options, coap_reply_t reply_cb);
+
 #endif /* __COAP_UTILS_H__ */
 
 /**
@@ -137,6 +137,80 @@ int ical_parser_init(struct icalendar_parser *ical,
 size_t ical_parser_parse(struct icalendar_parser *ical,
 			const char *data, size_t len);
 
+/**
+ * @brief Streaming iCalendar parser instance.
+ */
+struct ical_stream_parser {
+	/** Unfolded content line being received. */
+	char line[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
+	/** Length of the content line. */
+	size_t line_len;
+	/** Content line was truncated. */
+	bool line_overflow;
+	/** Line break received, the next character decides if the line is folded. */
+	bool line_end;
+	/** Parsing the calendar object. */
+	bool in_calendar;
+	/** Parsing a top level calendar component. */
+	bool in_component;
+	/** Component is not known and is not reported. */
+	bool skip;
+	/** Depth of the subcomponents of the component, such as VALARM. */
+	uint8_t depth;
+	/** Parsing stopped by the callback. */
+	bool stopped;
+	/** Component being parsed. */
+	struct ical_parser_evt evt;
+	/** Event handler. */
+	icalendar_parser_callback_t callback;
+};
+
+/**
+ * @brief Initialize streaming iCalendar parser.
+ *
+ * Requires the CONFIG_ICAL_PARSER_STREAM Kconfig option.
+ *
+ * @param[in,out] parser Streaming iCalendar parser instance.
+ * @param[in] callback Callback for sending calendar parsing event.
+ *
+ * @return 0 If successful, or an error code on failure.
+ */
+int ical_stream_parser_init(struct ical_stream_parser *parser,
+			    icalendar_parser_callback_t callback);
+
+/**
+ * @brief Feed a fragment of the iCalendar data stream to the parser.
+ *
+ * The fragment can have any length and can end anywhere in the stream,
+ * for example the fragment of a @c DOWNLOADER_EVT_FRAGMENT event. The data
+ * is not kept after the function returns. The callback is called for each
+ * calendar component completed by the fragment.
+ *
+ * @param[in,out] parser Streaming iCalendar parser instance.
+ * @param[in] data Fragment of the data stream.
+ * @param[in] len Length of the fragment.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the parameters are invalid.
+ * @retval -ECANCELED If the parsing was stopped by the callback.
+ */
+int ical_stream_parser_feed(struct ical_stream_parser *parser,
+			    const char *data, size_t len);
+
+/**
+ * @brief Finish parsing the iCalendar data stream.
+ *
+ * Parses the last content line, which is not delimited until the next
+ * character or the end of the stream.
+ *
+ * @param[in,out] parser Streaming iCalendar parser instance.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the parameters are invalid.
+ * @retval -ECANCELED If the parsing was stopped by the callback.
+ */
+int ical_stream_parser_finish(struct ical_stream_parser *parser);
+
 /**@} */
 
 #ifdef __cplusplus
@@ -142,7 +142,9 @@ enum lwm2m_fota_event_id {
 	/** Request to reconnect the modem and LwM2M client*/
 	LWM2M_FOTA_UPDATE_MODEM_RECONNECT_REQ,
 	/** FOTA process fail or cancelled  */
-	LWM2M_FOTA_UPDATE_ERROR
+	LWM2M_FOTA_UPDATE_ERROR,
+	/** Download progress changed */
+	LWM2M_FOTA_DOWNLOAD_PROGRESS
 };
 
 /** Event data for id LWM2M_FOTA_DOWNLOAD_START. */
@@ -151,6 +153,14 @@ struct lwm2m_fota_download_start {
 	uint16_t obj_inst_id;
 };
 
+/** Event data for id LWM2M_FOTA_DOWNLOAD_PROGRESS. */
+struct lwm2m_fota_download_progress {
+	/** Object Instance ID for event */
+	uint16_t obj_inst_id;
+	/** Downloaded part of the image, in percent */
+	uint8_t percent;
+};
+
 /** Event data for id LWM2M_FOTA_DOWNLOAD_FINISHED. */
 struct lwm2m_fota_download_finished {
 	/** Object Instance ID for event */
@@ -195,6 +205,8 @@ struct lwm2m_fota_event {
 		struct lwm2m_fota_reconnect reconnect_req;
 		/** LWM2M_FOTA_UPDATE_ERROR */
 		struct lwm2m_fota_update_failure failure;
+		/** LWM2M_FOTA_DOWNLOAD_PROGRESS */
+		struct lwm2m_fota_download_progress download_progress;
 	};
 };
 
@@ -226,6 +238,10 @@ struct lwm2m_fota_event {
  *
  * LWM2M_FOTA_UPDATE_ERROR: Indicate that FOTA process have failed or cancelled.
  *
+ * LWM2M_FOTA_DOWNLOAD_PROGRESS: Indicate that the downloaded part of the image has grown by
+ * at least one percent. The event is not sent when the image size is not known. The firmware
+ * state resource is not changed and no LwM2M notification is sent for the progress.
+ *
  * @return zero indicating OK or negative error code indicating an failure and will mark the
  *         whole FOTA process to failed.
  *         Positive return code will postpone the request, but can only be used in
@@ -333,6 +349,32 @@ void lwm2m_utils_connection_manage(struct lwm2m_ctx *client,
 void lwm2m_utils_rai_event_cb(struct lwm2m_ctx *client,
 				      enum lwm2m_rd_client_event *client_event);
 
+/**
+ * @brief Add a resource to the batch of the LwM2M Send operation.
+ *
+ * The values of all paths in the batch are sent in a single LwM2M Send operation when the
+ * aggregation window set by CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH_WINDOW expires, or when
+ * the batch is full. Requires CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH.
+ *
+ * The value is read when the batch is sent, so a path that is already in the batch is not
+ * added again. The window is started by the first path added after the previous batch was
+ * sent. If the send fails, for example because the client is not registered, the paths are
+ * kept for the next batch.
+ *
+ * @param path Path of the changed resource.
+ *
+ * @return Zero if success, negative error code otherwise.
+ */
+int lwm2m_utils_send_batch_add(const struct lwm2m_obj_path *path);
+
+/**
+ * @brief Send the batch without waiting for the aggregation window to expire.
+ *
+ * @return Zero if success, -ENOTCONN if the client is not registered, or another negative
+ *         error code. The batch is kept if the send fails.
+ */
+int lwm2m_utils_send_batch_flush(void);
+
 /* Advanced firmare object support */
 uint8_t lwm2m_adv_firmware_get_update_state(uint16_t obj_inst_id);
 void lwm2m_adv_firmware_set_update_state(uint16_t obj_inst_id, uint8_t state);
@@ -64,9 +64,32 @@ typedef void (*mqtt_helper_on_connack_t)(enum mqtt_conn_return_code return_code,
 typedef void (*mqtt_helper_on_disconnect_t)(int result);
 typedef void (*mqtt_helper_on_publish_t)(struct mqtt_helper_buf topic_buf,
 					 struct mqtt_helper_buf payload_buf);
+
+/** @brief Handler invoked for each chunk of an incoming MQTT PUBLISH payload.
+ *
+ *  The payload is read in chunks of up to CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN bytes, so
+ *  payloads of any size can be processed. The handler is called at least once for each
+ *  message, also when the payload is empty.
+ *
+ *  @param topic_buf Topic of the message.
+ *  @param chunk_buf Chunk of the payload. Valid only until the handler returns.
+ *  @param offset Offset of the chunk within the payload.
+ *  @param payload_len Total length of the payload. The chunk is the last one when
+ *		       offset + chunk_buf.size equals payload_len.
+ */
+typedef void (*mqtt_helper_on_publish_chunk_t)(struct mqtt_helper_buf topic_buf,
+					       struct mqtt_helper_buf chunk_buf, size_t offset,
+					       size_t payload_len);
 typedef void (*mqtt_helper_on_puback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_suback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_pingresp_t)(void);
+
+/** @brief Handler invoked when a slot of the QoS 1 publish window becomes free.
+ *
+ *  Called after a PUBACK is received while the window was full, so that a publication that
+ *  failed with -EAGAIN can be retried. Requires CONFIG_MQTT_HELPER_PUBLISH_WINDOW.
+ */
+typedef void (*mqtt_helper_on_publish_window_available_t)(void);
 typedef void (*mqtt_helper_on_error_t)(enum mqtt_helper_error error);
 
 struct mqtt_helper_cfg {
@@ -75,9 +98,14 @@ struct mqtt_helper_cfg {
 		mqtt_helper_on_connack_t on_connack;
 		mqtt_helper_on_disconnect_t on_disconnect;
 		mqtt_helper_on_publish_t on_publish;
+		/** If set, incoming payloads are passed to this handler in chunks,
+		 *  and on_publish is not called.
+		 */
+		mqtt_helper_on_publish_chunk_t on_publish_chunk;
 		mqtt_helper_on_puback_t on_puback;
 		mqtt_helper_on_suback_t on_suback;
 		mqtt_helper_on_pingresp_t on_pingresp;
+		mqtt_helper_on_publish_window_available_t on_publish_window_available;
 		mqtt_helper_on_error_t on_error;
 	} cb;
 
@@ -136,9 +164,13 @@ int mqtt_helper_disconnect(void);
 int mqtt_helper_subscribe(struct mqtt_subscription_list *sub_list);
 
 /** @brief Publish an MQTT message.
+ *
+ *  If CONFIG_MQTT_HELPER_PUBLISH_WINDOW is set, at most that many QoS 1 messages can be
+ *  awaiting a PUBACK at a time. The window is cleared on disconnect.
  *
  *  @retval 0 if successful.
  *  @retval -EOPNOTSUPP if operation is not supported in the current state.
+ *  @retval -EAGAIN if the QoS 1 publish window is full.
  *  @return Otherwise a negative error code.
  */
 int mqtt_helper_publish(const struct mqtt_publish_param *param);
@@ -28,6 +28,7 @@ extern "C" {
 #endif
 
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
 
 /** Invalid client index (no active client). */
 #define NRF_802154_CALLBACKS_DISPATCHER_INDEX_NONE UINT32_MAX
@@ -102,6 +103,104 @@ struct nrf_802154_cb_dispatch_entry {
 		.pan_id = {0},                                                                     \
 	}
 
+/** @brief Radio driver events that can be passed to an observer. */
+enum nrf_802154_cb_observer_evt_type {
+	NRF_802154_CB_OBSERVER_EVT_RECEIVED,
+	NRF_802154_CB_OBSERVER_EVT_RECEIVE_FAILED,
+	NRF_802154_CB_OBSERVER_EVT_TRANSMITTED,
+	NRF_802154_CB_OBSERVER_EVT_TRANSMIT_FAILED,
+	NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTED,
+	NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTION_FAILED,
+
+	NRF_802154_CB_OBSERVER_EVT_COUNT
+};
+
+/** Bit of an event type in the interest mask of an observer. */
+#define NRF_802154_CB_OBSERVER_EVT_MASK(_type) BIT(NRF_802154_CB_OBSERVER_EVT_##_type)
+
+/** Interest mask of an observer that receives all events. */
+#define NRF_802154_CB_OBSERVER_EVT_MASK_ALL BIT_MASK(NRF_802154_CB_OBSERVER_EVT_COUNT)
+
+/**
+ * @brief Radio driver event passed to an observer.
+ *
+ * The frame pointed to by @c psdu is valid only during the call of the observer handler.
+ * The first byte of the frame is PHR (length).
+ */
+struct nrf_802154_cb_observer_evt {
+	/** Event type. */
+	enum nrf_802154_cb_observer_evt_type type;
+	/** Received or transmitted frame, or NULL if the event has no frame. */
+	const uint8_t *psdu;
+	union {
+		/** Data of the @c NRF_802154_CB_OBSERVER_EVT_RECEIVED event. */
+		struct {
+			int8_t power;
+			uint8_t lqi;
+			uint64_t time;
+		} received;
+		/** Data of the @c NRF_802154_CB_OBSERVER_EVT_RECEIVE_FAILED event. */
+		struct {
+			nrf_802154_rx_error_t error;
+			uint32_t id;
+		} receive_failed;
+		/** Data of the @c NRF_802154_CB_OBSERVER_EVT_TRANSMIT_FAILED event. */
+		struct {
+			nrf_802154_tx_error_t error;
+		} transmit_failed;
+		/** Data of the @c NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTED event. */
+		struct {
+			int8_t ed_dbm;
+		} energy_detected;
+		/** Data of the @c NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTION_FAILED event. */
+		struct {
+			nrf_802154_ed_error_t error;
+		} energy_detection_failed;
+	};
+};
+
+/** @brief Static observer registration entry in the iterable linker section. */
+struct nrf_802154_cb_observer {
+	/** Observer name. */
+	const char *name;
+	/** Events passed to the observer, built with @ref NRF_802154_CB_OBSERVER_EVT_MASK. */
+	uint32_t evt_mask;
+	/** Whether the observer is called from the system workqueue instead of the driver
+	 *  callout context.
+	 */
+	bool deferred;
+	/** Observer handler. */
+	void (*handler)(const struct nrf_802154_cb_observer_evt *evt);
+};
+
+/**
+ * @brief Statically register an IEEE 802.15.4 radio driver event observer.
+ *
+ * Observers are notified about the radio driver events selected by the interest mask,
+ * in addition to the active client and independently of it. Observers cannot take
+ * ownership of the received frames.
+ *
+ * Non-deferred observers are called in the driver callout context, which is usually an
+ * interrupt. Deferred observers are called from the system workqueue with a copy of the
+ * event. Deferred events that do not fit in the queue set by the
+ * CONFIG_NRF_802154_CALLBACKS_DISPATCHER_OBSERVER_QUEUE_SIZE Kconfig option are dropped.
+ *
+ * Requires the CONFIG_NRF_802154_CALLBACKS_DISPATCHER_OBSERVERS Kconfig option.
+ *
+ * @param _observer_name Unique name for this registration.
+ * @param _evt_mask      Interest mask, built with @ref NRF_802154_CB_OBSERVER_EVT_MASK.
+ * @param _deferred      True to call the handler from the system workqueue.
+ * @param _handler       Observer handler.
+ */
+#define NRF_802154_CALLBACKS_DISPATCHER_OBSERVER_REGISTER(_observer_name, _evt_mask, _deferred,  \
+							  _handler)                            \
+	static const STRUCT_SECTION_ITERABLE(nrf_802154_cb_observer, _observer_name) = {       \
+		.name = NRF_802154_CALLBACKS_DISPATCHER_NAME_STR_EXPAND(_observer_name),           \
+		.evt_mask = (_evt_mask),                                                           \
+		.deferred = (_deferred),                                                           \
+		.handler = (_handler),                                                             \
+	}
+
 /**
  * @brief Switch the active IEEE 802.15.4 radio driver client.
  *
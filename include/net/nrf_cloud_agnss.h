@@ -83,6 +83,26 @@ void nrf_cloud_agnss_processed(struct nrf_modem_gnss_agnss_data_frame *received_
  */
 bool nrf_cloud_agnss_request_in_progress(void);
 
+#if defined(CONFIG_NRF_CLOUD_AGNSS_CACHE)
+/** @brief Inject cached A-GNSS data to the modem and remove it from a request.
+ *
+ * GPS and QZSS ephemerides and almanacs that are requested, cached, and valid for at least
+ * @kconfig{CONFIG_NRF_CLOUD_AGNSS_CACHE_EXPIRY_MARGIN} minutes are written to the modem and
+ * cleared from the request. Other data is left in the request. The function is called by
+ * @ref nrf_cloud_agnss_request. When other transports are used, call it before the request
+ * is sent to nRF Cloud.
+ *
+ * @param request A-GNSS data need reported by the modem, updated by the function.
+ *
+ * @retval true Data is still needed from nRF Cloud.
+ * @retval false All requested data was injected from the cache.
+ */
+bool nrf_cloud_agnss_cache_apply(struct nrf_modem_gnss_agnss_data_frame *request);
+
+/** @brief Remove all data from the A-GNSS cache. */
+void nrf_cloud_agnss_cache_clear(void);
+#endif /* CONFIG_NRF_CLOUD_AGNSS_CACHE */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -352,6 +352,66 @@ int nrf_cloud_coap_message_send(const char *app_id, const char *message, bool js
  */
 int nrf_cloud_coap_json_message_send(const char *message, bool bulk, bool confirmable);
 
+/**
+ * @brief Add a sensor value to the batch of messages sent to nRF Cloud.
+ *
+ *  The message is sent later, together with the other batched messages, as one JSON array
+ *  to the bulk resource. See @kconfig{CONFIG_NRF_CLOUD_COAP_BATCH} for when the batch is sent.
+ *  If the batch is full, it is sent before the message is added.
+ *
+ * @param[in]     app_id The app ID identifying the type of data. See the values
+ *                       that begin with NRF_CLOUD_JSON_APPID_ in nrf_cloud_defs.h. You may
+ *                       also use custom names.
+ * @param[in]     value  Sensor reading.
+ * @param[in]     ts_ms  Timestamp the data was measured, or NRF_CLOUD_NO_TIMESTAMP
+ *                       to use the current time.
+ *
+ * @retval -EINVAL Invalid parameter.
+ * @retval -E2BIG The message does not fit in an empty batch.
+ * @return 0 If successful, nonzero if the full batch could not be sent,
+ *           see @ref nrf_cloud_coap_batch_flush.
+ */
+int nrf_cloud_coap_sensor_batch_add(const char *app_id, double value, int64_t ts_ms);
+
+/**
+ * @brief Add a message object to the batch of messages sent to nRF Cloud.
+ *
+ *  Objects of type NRF_CLOUD_OBJ_TYPE_JSON and NRF_CLOUD_OBJ_TYPE_COAP_CBOR are supported.
+ *  The object is encoded when it is added, so it can be freed afterwards.
+ *  Use @ref nrf_cloud_obj_msg_ts_init to add a timestamp to the message.
+ *
+ * @param[in]     obj    Message object.
+ *
+ * @retval -EINVAL Invalid parameter.
+ * @retval -ENOENT Object is not initialized.
+ * @retval -ENOTSUP Object type or bulk object not supported.
+ * @retval -E2BIG The message does not fit in an empty batch.
+ * @return 0 If successful, nonzero if the full batch could not be sent,
+ *           see @ref nrf_cloud_coap_batch_flush.
+ */
+int nrf_cloud_coap_obj_batch_add(struct nrf_cloud_obj *const obj);
+
+/**
+ * @brief Send the batched messages to nRF Cloud now.
+ *
+ *  If sending fails on the device side, the messages are kept and sent with the next
+ *  attempt. Messages rejected by the cloud are discarded.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @return 0 If successful or the batch is empty, nonzero if failed.
+ *           Negative values are device-side errors defined in errno.h.
+ *           Positive values are cloud-side errors (CoAP result codes)
+ *           defined in zephyr/net/coap.h.
+ */
+int nrf_cloud_coap_batch_flush(void);
+
+/**
+ * @brief Get the number of batched messages waiting to be sent.
+ *
+ * @return Number of messages.
+ */
+size_t nrf_cloud_coap_batch_count(void);
+
 /**
  * @brief Send the device location in the @ref nrf_cloud_gnss_data PVT field to nRF Cloud.
  *
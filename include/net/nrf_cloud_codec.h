@@ -39,6 +39,10 @@ enum nrf_cloud_obj_type {
 	 *  using the corresponding field in the union in struct nrf_cloud_obj_coap_cbor.
 	 */
 	NRF_CLOUD_OBJ_TYPE_COAP_CBOR,
+	/** This object type is serialized as JSON into a buffer as items are added,
+	 *  see @ref NRF_CLOUD_OBJ_JSON_STREAM_DEFINE.
+	 */
+	NRF_CLOUD_OBJ_TYPE_JSON_STREAM,
 
 	NRF_CLOUD_OBJ_TYPE__LAST,
 };
@@ -80,6 +84,24 @@ struct nrf_cloud_obj_coap_cbor {
 	int64_t ts;
 };
 
+/** @brief Writer state of an object of type NRF_CLOUD_OBJ_TYPE_JSON_STREAM */
+struct nrf_cloud_obj_json_stream {
+	/** Output buffer */
+	char *buf;
+	/** Size of the output buffer */
+	size_t size;
+	/** Length of the output; larger than size if the output did not fit */
+	size_t len;
+	/** Bit n is set if the object at nesting level n has members */
+	uint32_t members;
+	/** Nesting level; 0 if the object is not initialized */
+	uint8_t depth;
+	/** Nesting level of the "data" object; 0 if it is not open */
+	uint8_t data_depth;
+	/** The "data" object was closed and can not be added to anymore */
+	bool data_closed;
+};
+
 /** @brief Object used for building nRF Cloud messages. */
 struct nrf_cloud_obj {
 
@@ -87,6 +109,7 @@ struct nrf_cloud_obj {
 	union {
 		cJSON *json;
 		struct nrf_cloud_obj_coap_cbor *coap_cbor;
+		struct nrf_cloud_obj_json_stream *json_stream;
 	};
 
 	/** Source of encoded data */
@@ -193,6 +216,27 @@ struct nrf_cloud_obj_shadow_data {
 				       .enc_src = NRF_CLOUD_ENC_SRC_NONE, \
 				       .encoded_data = { .len = 0, .ptr = NULL } }
 
+/** @brief Define an nRF Cloud JSON stream object.
+ *
+ * This macro defines a codec object with the type of NRF_CLOUD_OBJ_TYPE_JSON_STREAM.
+ * The object is serialized into the provided buffer as items are added, so no memory
+ * is allocated and the size of the message is limited by the buffer.
+ * Items are added in order; once an item is added to the provided object after items
+ * were added to the "data" object, no more items can be added to the "data" object.
+ * Nested objects are added with @ref nrf_cloud_obj_object_begin.
+ *
+ * @param _name	Name of the object.
+ * @param _buf	Output buffer; must remain valid until the encoded data is no longer used.
+ * @param _buf_sz	Size of the output buffer.
+ */
+#define NRF_CLOUD_OBJ_JSON_STREAM_DEFINE(_name, _buf, _buf_sz) \
+	struct nrf_cloud_obj_json_stream _name##_json_stream = { .buf = _buf, \
+								  .size = _buf_sz }; \
+	struct nrf_cloud_obj _name = { .type = NRF_CLOUD_OBJ_TYPE_JSON_STREAM, \
+				       .json_stream = &_name##_json_stream, \
+				       .enc_src = NRF_CLOUD_ENC_SRC_NONE, \
+				       .encoded_data = { .len = 0, .ptr = NULL } }
+
 /** @brief Define an nRF Cloud codec object of the specified type.
  *
  * @param _name	Name of the object.
@@ -566,6 +610,42 @@ int nrf_cloud_obj_null_add(struct nrf_cloud_obj *const obj, const char *const ke
 int nrf_cloud_obj_object_add(struct nrf_cloud_obj *const obj, const char *const key,
 			     struct nrf_cloud_obj *const obj_to_add, const bool data_child);
 
+/**
+ * @brief Start a nested object with the given key in a JSON stream object.
+ *
+ * @details Items added to the object until @ref nrf_cloud_obj_object_end is called
+ *          are added to the nested object, and their data_child parameter is ignored.
+ *
+ * @param[in,out] obj JSON stream object.
+ * @param[in] key Key string.
+ * @param[in] data_child If true, the nested object will be added as a child to a "data" object.
+ *                       If false, the nested object will be added as a child to the provided
+ *                       object.
+ *
+ * @retval -EINVAL Invalid parameter.
+ * @retval -ENOENT Object is not initialized.
+ * @retval -EPERM The "data" object can no longer be added to.
+ * @retval -E2BIG Too many nested objects.
+ * @retval -ENOMEM The output buffer is full.
+ * @retval -ENOTSUP Action not supported for the object's type.
+ * @retval 0 Success; nested object started.
+ */
+int nrf_cloud_obj_object_begin(struct nrf_cloud_obj *const obj, const char *const key,
+			       const bool data_child);
+
+/**
+ * @brief End the nested object started with @ref nrf_cloud_obj_object_begin.
+ *
+ * @param[in,out] obj JSON stream object.
+ *
+ * @retval -EINVAL Invalid parameter.
+ * @retval -ENOENT No nested object is open.
+ * @retval -ENOMEM The output buffer is full.
+ * @retval -ENOTSUP Action not supported for the object's type.
+ * @retval 0 Success; nested object ended.
+ */
+int nrf_cloud_obj_object_end(struct nrf_cloud_obj *const obj);
+
 /**
  * @brief Add a key string and integer array value to the provided object.
  *
@@ -636,6 +716,28 @@ int nrf_cloud_obj_cloud_encode(struct nrf_cloud_obj *const obj);
  */
 int nrf_cloud_obj_cloud_encoded_free(struct nrf_cloud_obj *const obj);
 
+/**
+ * @brief Encode the object's data for transport to nRF Cloud into the provided buffer.
+ *
+ * @details No memory is allocated. The encoded data points to the provided buffer,
+ *          which must remain valid until the object is sent.
+ *          Objects of type @ref NRF_CLOUD_OBJ_TYPE_COAP_CBOR are encoded as CBOR when
+ *          CoAP is used, and as JSON otherwise.
+ *
+ * @param[in,out] obj Object to encode.
+ * @param[out] buf Buffer for the encoded data.
+ * @param[in,out] len Size of the buffer; set to the length of the encoded data on success.
+ *
+ * @retval -EINVAL Invalid parameter.
+ * @retval -ENOENT Object is not initialized.
+ * @retval -EACCES Object already contains encoded data.
+ * @retval -E2BIG The buffer is too small.
+ * @retval -ENOTSUP Action not supported for the object's type.
+ * @retval 0 Success; object encoded.
+ */
+int nrf_cloud_obj_cloud_buf_encode(struct nrf_cloud_obj *const obj, char *const buf,
+				   size_t *const len);
+
 /**
  * @brief Create an nRF Cloud GNSS message object.
  *
@@ -168,6 +168,14 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
  */
 void rest_client_request_defaults_set(struct rest_client_req_context *req_ctx);
 
+/**
+ * @brief Close all idle connections kept in the connection pool.
+ *
+ * @details Intended to be used, for example, before the network connection is taken down.
+ *          Requires the @kconfig{CONFIG_REST_CLIENT_CONN_POOL} Kconfig option.
+ */
+void rest_client_conn_pool_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
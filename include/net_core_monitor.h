@@ -42,6 +42,17 @@ enum ncm_event_type {
  */
 extern void ncm_net_core_event_handler(enum ncm_event_type event, uint32_t reset_reas);
 
+/** @brief Get the CPU load of the network core.
+ *
+ * The network core measures its load over every feeding interval.
+ * Requires the CONFIG_NCM_NET_CORE_LOAD Kconfig option on both cores.
+ * Can be called only on the application core.
+ *
+ * @retval 0-100    The network core load, in percent.
+ * @retval -ENODATA The load is not available yet, for example after the network core reset.
+ */
+int ncm_net_core_load_get(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NFC_T4T_FAST_READ_H_
+#define NFC_T4T_FAST_READ_H_
+
+/**@file
+ *
+ * @defgroup nfc_t4t_fast_read NFC Type 4 Tag fast read path
+ * @{
+ * @brief Answering NDEF reads of the NFC Type 4 Tag from the interrupt context.
+ *
+ */
+
+#include <stddef.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Set the NDEF File served by the fast read path.
+ *
+ * The Capability Container file is precomputed for the given NDEF File. The NDEF Tag
+ * Application select, the file selects and the READ BINARY commands are then answered from
+ * the NFCT interrupt, before they are deferred to the thread that calls the NFC callback.
+ * The tag is reported as read-only. Other commands are passed to the application callback.
+ *
+ * The Type 4 Tag library must run in the @c NFC_T4T_EMUMODE_PICC mode.
+ *
+ * @param[in] ndef_file Pointer to the NDEF File, as encoded by @ref nfc_t4t_ndef_file_encode.
+ *                      The buffer must remain valid while it is set. To change the NDEF
+ *                      message without blocking the reader, encode it into another buffer
+ *                      and set that buffer. NULL disables the fast read path.
+ * @param[in] size Size of the NDEF File.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the NDEF File size is invalid.
+ */
+int nfc_t4t_fast_read_ndef_set(const uint8_t *ndef_file, size_t size);
+
+/**@brief Handle a C-APDU in the interrupt context.
+ *
+ * This function is called by the NFC platform for every data indication of the Type 4 Tag
+ * library. It should not be used directly.
+ *
+ * @param[in] apdu Received C-APDU.
+ * @param[in] len Length of the C-APDU.
+ *
+ * @retval true If the C-APDU was answered.
+ * @retval false If the C-APDU must be passed to the application callback.
+ */
+bool nfc_t4t_fast_read_handle(const uint8_t *apdu, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NFC_T4T_FAST_READ_H_ */
@@ -271,6 +271,26 @@ static inline void nrf_profiler_log_encode_string(struct log_event_buf *buf,
 #endif
 
 
+/** @brief Add raw data to a buffer.
+ *
+ * The data is copied to the buffer as is, so it must already be in the
+ * little-endian format used for the encoded values.
+ *
+ * @note The buffer must be initialized with @ref nrf_profiler_log_start
+ *       before calling this function.
+ *
+ * @param buf Pointer to the data buffer.
+ * @param data Pointer to the data.
+ * @param len Length of the data in bytes.
+ */
+#ifdef CONFIG_NRF_PROFILER
+void nrf_profiler_log_encode_mem(struct log_event_buf *buf, const void *data, size_t len);
+#else
+static inline void nrf_profiler_log_encode_mem(struct log_event_buf *buf,
+					      const void *data, size_t len) {}
+#endif
+
+
 /** @brief Encode and add the event's address in memory to the buffer.
  *
  * This information is used for event identification.
@@ -290,13 +310,39 @@ static inline void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 #endif
 
 
+/** @brief Get the current timestamp used by the Profiler.
+ *
+ * The timestamp source is selected with Kconfig. It is either the system clock
+ * or the high-resolution timing counter.
+ *
+ * @return Current timestamp in the timestamp source ticks.
+ */
+#ifdef CONFIG_NRF_PROFILER
+uint32_t nrf_profiler_timestamp_get(void);
+#else
+static inline uint32_t nrf_profiler_timestamp_get(void) {return 0; }
+#endif
+
+/** @brief Convert a timestamp difference to microseconds.
+ *
+ * @param ticks Number of the timestamp source ticks.
+ * @return Number of microseconds, rounded down.
+ */
+#ifdef CONFIG_NRF_PROFILER
+uint32_t nrf_profiler_timestamp_to_us(uint32_t ticks);
+#else
+static inline uint32_t nrf_profiler_timestamp_to_us(uint32_t ticks) {return 0; }
+#endif
+
+
 /** @brief Send data from the buffer to the host.
  *
  * This function only sends data that is already stored in the buffer.
  * Use @ref nrf_profiler_log_encode_uint32, @ref nrf_profiler_log_encode_int32,
  * @ref nrf_profiler_log_encode_uint16, @ref nrf_profiler_log_encode_int16,
  * @ref nrf_profiler_log_encode_uint8, @ref nrf_profiler_log_encode_int8,
- * @ref nrf_profiler_log_encode_string or @ref nrf_profiler_log_add_mem_address
+ * @ref nrf_profiler_log_encode_string, @ref nrf_profiler_log_encode_mem or
+ * @ref nrf_profiler_log_add_mem_address
  * to add data to the buffer.
  *
  * @param event_type_id Event type ID as assigned to the event type
@@ -128,6 +128,22 @@ void nrf_rpc_encode_str(struct nrf_rpc_cbor_ctx *ctx, const char *value, int len
  */
 void nrf_rpc_encode_buffer(struct nrf_rpc_cbor_ctx *ctx, const void *data, size_t size);
 
+/** @brief Reserve space for a buffer in the CBOR stream.
+ *
+ * Encodes the header of a buffer of @p size bytes and returns a pointer to
+ * the space reserved for its content, which must be filled in by the caller.
+ * This lets large payloads be written once, directly into the Tx buffer of
+ * the transport, instead of being prepared elsewhere and copied by
+ * @ref nrf_rpc_encode_buffer.
+ *
+ * @param[in,out] ctx CBOR encoding context.
+ * @param[in] size Buffer size.
+ *
+ * @retval Pointer to the reserved space of @p size bytes.
+ * @retval NULL If the buffer does not fit into the CBOR stream.
+ */
+void *nrf_rpc_encode_buffer_zero_copy(struct nrf_rpc_cbor_ctx *ctx, size_t size);
+
 /** @brief Encode a callback.
  *
  * This function will use callback proxy module to convert a callback pointer
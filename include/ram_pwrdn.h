@@ -18,6 +18,9 @@
  *
  */
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -55,6 +58,30 @@ void power_down_unused_ram(void);
  */
 void power_up_unused_ram(void);
 
+/**
+ * @brief Update the RAM sections that are not used by thread stacks.
+ *
+ * Check the high-water mark of all thread stacks and find the sections that
+ * are fully within the never used part of the stacks, leaving
+ * CONFIG_RAM_POWER_DOWN_ADAPTIVE_STACK_MARGIN bytes. The stacks of the idle
+ * threads are not tracked.
+ *
+ * With CONFIG_RAM_POWER_DOWN_ADAPTIVE_IDLE, the sections are powered down
+ * in the low power states.
+ *
+ * Requires the CONFIG_RAM_POWER_DOWN_ADAPTIVE Kconfig option.
+ *
+ * @return Size of the sections in bytes.
+ */
+size_t ram_pwrdn_adaptive_update(void);
+
+/**
+ * @brief Log the tracked RAM sections and the heap usage.
+ *
+ * Requires the CONFIG_RAM_POWER_DOWN_ADAPTIVE Kconfig option.
+ */
+void ram_pwrdn_adaptive_report(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,9 +42,16 @@
 /** Filter types supported by the sample rate converter */
 enum sample_rate_converter_filter {
 	SAMPLE_RATE_FILTER_TEST = 1,
-	SAMPLE_RATE_FILTER_SIMPLE
+	SAMPLE_RATE_FILTER_SIMPLE,
+	SAMPLE_RATE_FILTER_FRACTIONAL
 };
 
+/** Largest supported ratio between the input and output sample rate for the fractional filter */
+#define SAMPLE_RATE_CONVERTER_FRACTIONAL_RATIO_MAX 2
+
+/** Largest adjustment of the fractional conversion ratio in parts per million */
+#define SAMPLE_RATE_CONVERTER_FRACTIONAL_ADJUST_PPM_MAX 10000
+
 /**
  * To maintain filter requirements the input buffer must in some cases store two samples between
  * each block processed.
@@ -123,8 +130,49 @@ struct sample_rate_converter_ctx {
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
 	q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
 #endif
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+	/* Polyphase filter coefficients used by the fractional conversion. */
+	void const *frac_filter;
+
+	/* Read position in the state buffer, as a 32.32 fixed point number of input samples. */
+	uint64_t frac_pos;
+
+	/* Number of input samples to advance per output sample, as a 32.32 fixed point number.
+	 * The nominal step is given by the sample rates, and the step used for the conversion
+	 * is the nominal step trimmed by the requested adjustment.
+	 */
+	uint64_t frac_step_nominal;
+	uint64_t frac_step;
+
+	/* Adjustment of the output sample rate in parts per million. */
+	int32_t frac_adjust_ppm;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
 };
 
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL)
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define SAMPLE_RATE_CONVERTER_CH_BUF_SIZE (CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define SAMPLE_RATE_CONVERTER_CH_BUF_SIZE (CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
+#else
+#define SAMPLE_RATE_CONVERTER_CH_BUF_SIZE 0
+#endif
+
+/** Context for the sample rate conversion of an interleaved multi-channel stream */
+struct sample_rate_converter_mc_ctx {
+	/* Number of interleaved channels in the stream. */
+	uint8_t channels;
+
+	/* Conversion context for each channel. */
+	struct sample_rate_converter_ctx ch_ctx[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX];
+
+	/* Buffers used to deinterleave and interleave a channel for the integer ratio filters. */
+	uint8_t ch_input_buf[SAMPLE_RATE_CONVERTER_CH_BUF_SIZE];
+	uint8_t ch_output_buf[SAMPLE_RATE_CONVERTER_CH_BUF_SIZE];
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL */
+
 /**
  * @brief	Open the sample rate converter for a new context.
  *
@@ -161,6 +209,11 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx);
  * @param[out]		output_written		Number of bytes written to output.
  * @param[in]		output_sample_rate	Sample rate of output.
  *
+ *		When the SAMPLE_RATE_FILTER_FRACTIONAL filter is used, any pair of sample rates with
+ *		a ratio up to SAMPLE_RATE_CONVERTER_FRACTIONAL_RATIO_MAX is supported. The number of
+ *		bytes written to the output then varies between calls, and the output array must be
+ *		able to hold one sample more than the input size multiplied by the adjusted ratio.
+ *
  * @retval	0	On success.
  * @retval	-EINVAL	Invalid parameters for sample rate conversion.
  * @retval	-EFAULT	Output ring buffer has either not enough bytes to output, or not enough
@@ -172,6 +225,86 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+/**
+ * @brief	Adjust the ratio of a fractional sample rate conversion.
+ *
+ * @details	Trims the output sample rate of the SAMPLE_RATE_FILTER_FRACTIONAL conversion
+ *		relative to the nominal output sample rate, so that a positive adjustment produces
+ *		more output samples for the same input. This can be used to smoothly compensate for
+ *		drift between the input and output clocks instead of adding or dropping samples.
+ *		The adjustment takes effect from the next call to sample_rate_converter_process(),
+ *		and is kept if the sample rates change. It is cleared by
+ *		sample_rate_converter_open().
+ *
+ * @param[in,out]	ctx	Pointer to the sample rate conversion context.
+ * @param[in]		ppm	Adjustment in parts per million.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context, or adjustment larger than
+ *			SAMPLE_RATE_CONVERTER_FRACTIONAL_ADJUST_PPM_MAX.
+ */
+int sample_rate_converter_ratio_adjust(struct sample_rate_converter_ctx *ctx, int32_t ppm);
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL)
+/**
+ * @brief	Open the sample rate converter for a new multi-channel context.
+ *
+ * @details	Sets the entire context to 0 and opens a conversion context for each channel.
+ *
+ * @param[out]	ctx		Pointer to the multi-channel sample rate conversion context.
+ * @param[in]	channels	Number of interleaved channels in the stream.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context, or invalid number of channels.
+ */
+int sample_rate_converter_mc_open(struct sample_rate_converter_mc_ctx *ctx, uint8_t channels);
+
+/**
+ * @brief	Process interleaved input frames and produce interleaved output frames with new
+ *		sample rate.
+ *
+ * @details	Converts all channels of the stream in one call, with the same parameters and
+ *		requirements as sample_rate_converter_process() for each channel. The input size
+ *		and the output size are given for all channels, and the number of samples in each
+ *		channel is limited by CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX.
+ *
+ * @param[in,out]	ctx			Pointer to the multi-channel conversion context.
+ * @param[in]		filter			Filter type to be used for the conversion.
+ * @param[in]		input			Pointer to interleaved frames to process.
+ * @param[in]		input_size		Size of the input in bytes.
+ * @param[in]		input_sample_rate	Sample rate of the input frames.
+ * @param[out]		output			Array that interleaved output will be written.
+ * @param[in]		output_size		Size of the output array in bytes.
+ * @param[out]		output_written		Number of bytes written to output.
+ * @param[in]		output_sample_rate	Sample rate of output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters for sample rate conversion.
+ * @retval	-EFAULT	Output ring buffer has either not enough bytes to output, or not enough
+ *			space to store bytes.
+ */
+int sample_rate_converter_mc_process(struct sample_rate_converter_mc_ctx *ctx,
+				     enum sample_rate_converter_filter filter,
+				     void const *const input, size_t input_size,
+				     uint32_t input_sample_rate, void *const output,
+				     size_t output_size, size_t *output_written,
+				     uint32_t output_sample_rate);
+
+/**
+ * @brief	Adjust the ratio of a fractional multi-channel sample rate conversion.
+ *
+ * @details	Applies sample_rate_converter_ratio_adjust() to all channels, so that the channels
+ *		stay aligned.
+ *
+ * @param[in,out]	ctx	Pointer to the multi-channel conversion context.
+ * @param[in]		ppm	Adjustment in parts per million.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context, or adjustment out of range.
+ */
+int sample_rate_converter_mc_ratio_adjust(struct sample_rate_converter_mc_ctx *ctx, int32_t ppm);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL */
+
 /**
  * @}
  */
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SECURE_STORAGE_KEY_CACHE_H_
+#define SECURE_STORAGE_KEY_CACHE_H_
+
+/**
+ * @file
+ * @defgroup secure_storage_key_cache Secure storage AEAD key cache
+ * @{
+ * @brief Cache of the AEAD keys derived from the hardware unique key for the
+ *        ITS entries of the secure storage subsystem.
+ *
+ * Requires the CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_CACHE Kconfig option.
+ */
+
+#include <stdbool.h>
+#include <zephyr/secure_storage/its/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Decide whether the key of an ITS entry can be cached.
+ *
+ * The default implementation allows caching the keys of all entries.
+ * Override this function to keep the keys of sensitive entries out of RAM.
+ *
+ * @param uid UID of the ITS entry.
+ *
+ * @retval true  The key can be cached.
+ * @retval false The key is derived every time it is used.
+ */
+bool secure_storage_key_cache_policy(secure_storage_its_uid_t uid);
+
+/**
+ * @brief Lock the cache.
+ *
+ * Zeroizes the cached keys. Until @ref secure_storage_key_cache_unlock is called,
+ * keys are derived every time they are used and are not cached.
+ * Lock the cache, for example, when the application has finished reading the
+ * secure storage during boot.
+ */
+void secure_storage_key_cache_lock(void);
+
+/**
+ * @brief Unlock the cache, so that derived keys are cached again.
+ *
+ * The cache is unlocked after boot.
+ */
+void secure_storage_key_cache_unlock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* SECURE_STORAGE_KEY_CACHE_H_ */
@@ -65,6 +65,58 @@ int tone_gen(int16_t *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t s
 int tone_gen_size(void *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t sample_freq_hz,
 		  uint8_t sample_bits, uint8_t carrier_bits, float amplitude);
 
+/**
+ * @brief Phase accumulator oscillator.
+ *
+ * @note  The members are internal to the library and must not be accessed directly.
+ */
+struct tone_osc {
+	/** Current phase, where the full range of the variable is one period. */
+	uint32_t phase;
+
+	/** Phase increment per sample. */
+	uint32_t phase_inc;
+
+	/** Amplitude in Q15 format. */
+	int32_t amplitude;
+};
+
+/**
+ * @brief                 Initialize a phase accumulator oscillator.
+ *
+ * @note                  Unlike tone_gen(), the tone frequency does not need to divide the
+ *                        sampling frequency.
+ *
+ * @param osc             Oscillator to initialize.
+ * @param tone_freq_hz    The desired tone frequency in the range [100..10000] Hz.
+ * @param smpl_freq_hz    Sampling frequency, must be more than twice the tone frequency.
+ * @param amplitude       Amplitude in the range [0..1].
+ *
+ * @retval 0              Oscillator initialized.
+ * @retval -ENXIO         If osc is NULL.
+ * @retval -EINVAL        If smpl_freq_hz or tone_freq_hz is out of range.
+ * @retval -EPERM         If amplitude is out of range.
+ */
+int tone_osc_init(struct tone_osc *osc, uint16_t tone_freq_hz, uint32_t smpl_freq_hz,
+		  float amplitude);
+
+/**
+ * @brief                 Generate the next samples of the oscillator tone.
+ *
+ * @details               The samples are interpolated from a sine table and continue from the
+ *                        phase reached by the previous call.
+ *
+ * @param osc             Initialized oscillator.
+ * @param tone            User provided buffer for the samples.
+ * @param samples         Number of samples to generate.
+ * @param carrier_bits    Number of bits to carry a sample (i.e. 16 or 32 bit).
+ *
+ * @retval 0              Samples generated.
+ * @retval -ENXIO         If osc or tone is NULL.
+ * @retval -EINVAL        If carrier_bits is not supported.
+ */
+int tone_osc_gen(struct tone_osc *osc, void *tone, size_t samples, uint8_t carrier_bits);
+
 /**
  * @}
  */
@@ -12,6 +12,7 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -77,6 +78,12 @@ struct uart_async_adapter_data {
 		int32_t timeout;
 		/** Timer used for timeout */
 		struct k_timer timeout_timer;
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+		/** Ring buffer for the data read in the interrupt */
+		struct ring_buf ring;
+		/** Ring buffer storage */
+		uint8_t ring_data[CONFIG_UART_ASYNC_ADAPTER_RX_RING_SIZE];
+#endif
 		/** RX state */
 		bool enabled;
 	} rx;
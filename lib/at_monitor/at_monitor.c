@@ -41,6 +41,204 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 	return (mon->filter == ANY || strstr(notif, mon->filter));
 }
 
+#if defined(CONFIG_AT_MONITOR_FILTER_INDEX)
+
+#define INDEX_ROOT 0
+#define INDEX_NONE 0
+#define MON_NONE UINT16_MAX
+
+/* Filters are substring matches, so the index is an Aho-Corasick automaton
+ * built over all monitor filters. A single pass over the notification then
+ * yields every monitor whose filter occurs in it.
+ */
+struct filter_index_node {
+	uint16_t child;
+	uint16_t sibling;
+	uint16_t fail;
+	/* Closest node on the failure chain which terminates a filter */
+	uint16_t out;
+	/* First monitor whose filter terminates at this node */
+	uint16_t mon;
+	char c;
+};
+
+static struct filter_index_node index_nodes[CONFIG_AT_MONITOR_FILTER_INDEX_NODES];
+/* Next monitor sharing the same filter */
+static uint16_t index_mon_next[CONFIG_AT_MONITOR_FILTER_INDEX_MONITORS];
+#define MATCH_SET_WORDS DIV_ROUND_UP(CONFIG_AT_MONITOR_FILTER_INDEX_MONITORS, 32)
+
+typedef uint32_t match_set_t[MATCH_SET_WORDS];
+
+/* Monitors matching any notification */
+static match_set_t index_any;
+static size_t index_num_nodes;
+static bool index_ready;
+
+static uint16_t monitor_idx(const struct at_monitor_entry *mon)
+{
+	return mon - STRUCT_SECTION_START(at_monitor_entry);
+}
+
+static uint16_t index_child(uint16_t node, char c)
+{
+	for (uint16_t n = index_nodes[node].child; n != INDEX_NONE; n = index_nodes[n].sibling) {
+		if (index_nodes[n].c == c) {
+			return n;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+static int index_insert(const char *filter, uint16_t mon_idx)
+{
+	uint16_t node = INDEX_ROOT;
+	uint16_t next;
+
+	for (const char *p = filter; *p != '\0'; p++) {
+		next = index_child(node, *p);
+		if (next == INDEX_NONE) {
+			if (index_num_nodes == ARRAY_SIZE(index_nodes)) {
+				return -ENOMEM;
+			}
+			next = index_num_nodes++;
+			index_nodes[next] = (struct filter_index_node){
+				.sibling = index_nodes[node].child,
+				.mon = MON_NONE,
+				.c = *p,
+			};
+			index_nodes[node].child = next;
+		}
+		node = next;
+	}
+
+	index_mon_next[mon_idx] = index_nodes[node].mon;
+	index_nodes[node].mon = mon_idx;
+
+	return 0;
+}
+
+static void index_link(void)
+{
+	/* Nodes are visited in breadth-first order, so the failure link of a
+	 * parent is always resolved before its children.
+	 */
+	static uint16_t queue[CONFIG_AT_MONITOR_FILTER_INDEX_NODES];
+	size_t head = 0;
+	size_t tail = 0;
+
+	for (uint16_t n = index_nodes[INDEX_ROOT].child; n != INDEX_NONE;
+	     n = index_nodes[n].sibling) {
+		index_nodes[n].fail = INDEX_ROOT;
+		index_nodes[n].out = INDEX_NONE;
+		queue[tail++] = n;
+	}
+
+	while (head < tail) {
+		uint16_t node = queue[head++];
+
+		for (uint16_t n = index_nodes[node].child; n != INDEX_NONE;
+		     n = index_nodes[n].sibling) {
+			uint16_t f = index_nodes[node].fail;
+			uint16_t fail;
+
+			while (f != INDEX_ROOT && index_child(f, index_nodes[n].c) == INDEX_NONE) {
+				f = index_nodes[f].fail;
+			}
+			fail = index_child(f, index_nodes[n].c);
+
+			index_nodes[n].fail = fail;
+			index_nodes[n].out = (index_nodes[fail].mon != MON_NONE) ?
+					     fail : index_nodes[fail].out;
+			queue[tail++] = n;
+		}
+	}
+}
+
+static int index_build(void)
+{
+	int err;
+	int count;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	if (count > CONFIG_AT_MONITOR_FILTER_INDEX_MONITORS) {
+		LOG_WRN("Too many monitors for filter index (%d)", count);
+		return -ENOMEM;
+	}
+
+	index_nodes[INDEX_ROOT] = (struct filter_index_node){ .mon = MON_NONE };
+	index_num_nodes = 1;
+
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		uint16_t idx = monitor_idx(e);
+
+		if (e->filter == ANY || e->filter[0] == '\0') {
+			index_any[idx / 32] |= BIT(idx % 32);
+			continue;
+		}
+
+		err = index_insert(e->filter, idx);
+		if (err) {
+			LOG_WRN("Filter index too small, increase "
+				"CONFIG_AT_MONITOR_FILTER_INDEX_NODES");
+			return err;
+		}
+	}
+
+	index_link();
+
+	LOG_DBG("Filter index: %d monitors, %d nodes", count, index_num_nodes);
+
+	return 0;
+}
+
+static void index_match(const char *notif, match_set_t matches)
+{
+	uint16_t state = INDEX_ROOT;
+	uint16_t next;
+
+	memcpy(matches, index_any, sizeof(match_set_t));
+
+	for (const char *p = notif; *p != '\0'; p++) {
+		while ((next = index_child(state, *p)) == INDEX_NONE && state != INDEX_ROOT) {
+			state = index_nodes[state].fail;
+		}
+		state = next;
+
+		for (uint16_t n = (index_nodes[state].mon != MON_NONE) ? state :
+				  index_nodes[state].out;
+		     n != INDEX_NONE; n = index_nodes[n].out) {
+			for (uint16_t m = index_nodes[n].mon; m != MON_NONE;
+			     m = index_mon_next[m]) {
+				matches[m / 32] |= BIT(m % 32);
+			}
+		}
+	}
+}
+
+static bool index_has_match(const match_set_t matches, const struct at_monitor_entry *mon)
+{
+	uint16_t idx = monitor_idx(mon);
+
+	return matches[idx / 32] & BIT(idx % 32);
+}
+
+#endif /* CONFIG_AT_MONITOR_FILTER_INDEX */
+
+/* Match a monitor against the notification, using the result of a single
+ * index lookup when available, or against its filter otherwise.
+ */
+static bool monitor_matches(const struct at_monitor_entry *mon, const char *notif,
+			    const uint32_t *matches)
+{
+#if defined(CONFIG_AT_MONITOR_FILTER_INDEX)
+	if (matches) {
+		return index_has_match(matches, mon);
+	}
+#endif
+	return has_match(mon, notif);
+}
+
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
  * Keep this function public so that it can be called by tests.
  * This function is called from an ISR.
@@ -50,12 +248,22 @@ void at_monitor_dispatch(const char *notif)
 	bool monitored;
 	struct at_notif_fifo *at_notif;
 	size_t sz_needed;
+	const uint32_t *matches = NULL;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
+#if defined(CONFIG_AT_MONITOR_FILTER_INDEX)
+	match_set_t set;
+
+	if (index_ready) {
+		index_match(notif, set);
+		matches = set;
+	}
+#endif
+
 	monitored = false;
 	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
+		if (!is_paused(e) && monitor_matches(e, notif, matches)) {
 			if (is_direct(e)) {
 				LOG_DBG("Dispatching to %p (ISR)", e->handler);
 				e->handler(notif);
@@ -89,12 +297,24 @@ void at_monitor_dispatch(const char *notif)
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	const uint32_t *matches = NULL;
+
+#if defined(CONFIG_AT_MONITOR_FILTER_INDEX)
+	match_set_t set;
+#endif
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
 		/* Match notification with all monitors */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
+#if defined(CONFIG_AT_MONITOR_FILTER_INDEX)
+		if (index_ready) {
+			index_match(at_notif->data, set);
+			matches = set;
+		}
+#endif
 		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
+			if (!is_paused(e) && !is_direct(e) &&
+			    monitor_matches(e, at_notif->data, matches)) {
 				LOG_DBG("Dispatching to %p", e->handler);
 				e->handler(at_notif->data);
 			}
@@ -107,6 +327,11 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+#if defined(CONFIG_AT_MONITOR_FILTER_INDEX)
+	/* Fall back to matching each filter if the index can't be built */
+	index_ready = (index_build() == 0);
+#endif
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
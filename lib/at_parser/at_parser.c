@@ -231,11 +231,78 @@ finalize:
 	return 0;
 }
 
+/* Record the position of all the tokens of the current AT command line. */
+static void at_parser_index_build(struct at_parser *parser)
+{
+	int err;
+	bool partial = false;
+	struct at_token token = {0};
+
+	/* Rewind parser. */
+	parser->cursor = parser->at;
+	parser->count = 0;
+	parser->is_next_empty = false;
+	parser->index_count = 0;
+
+	do {
+		err = at_parser_tok(parser, &token);
+		if (err) {
+			break;
+		}
+
+		if (parser->index_count < parser->index_size &&
+		    token.start - parser->at <= UINT16_MAX && token.len <= UINT16_MAX) {
+			parser->index[parser->index_count++] = (struct at_parser_index_entry){
+				.start = token.start - parser->at,
+				.len = token.len,
+				.type = token.type,
+			};
+		} else {
+			partial = true;
+		}
+	} while (true);
+
+	parser->index_err = partial ? 0 : err;
+}
+
+/* Look up the token at the given index, if recorded. */
+static bool at_parser_index_lookup(struct at_parser *parser, size_t index,
+				   struct at_token *token, int *err)
+{
+	const struct at_parser_index_entry *entry;
+
+	if (!parser->index) {
+		return false;
+	}
+
+	if (index >= parser->index_count) {
+		/* Tokenization of a fully indexed line ends at the same error again. */
+		if (parser->index_err) {
+			*err = parser->index_err;
+			return true;
+		}
+		return false;
+	}
+
+	entry = &parser->index[index];
+
+	token->start = parser->at + entry->start;
+	token->len = entry->len;
+	token->type = entry->type;
+	*err = 0;
+
+	return true;
+}
+
 /* Seek the AT parser cursor to the given index. */
 static int at_parser_seek(struct at_parser *parser, size_t index, struct at_token *token)
 {
 	int err;
 
+	if (at_parser_index_lookup(parser, index, token, &err)) {
+		return err;
+	}
+
 	if (!is_index_ahead(parser, index)) {
 		/* Rewind parser. */
 		parser->cursor = parser->at;
@@ -291,6 +358,32 @@ int at_parser_cmd_next(struct at_parser *parser)
 	 */
 	parser->at = parser->cursor;
 
+	if (parser->index) {
+		at_parser_index_build(parser);
+	}
+
+	return 0;
+}
+
+int at_parser_index_set(struct at_parser *parser, struct at_parser_index_entry *index,
+			size_t size)
+{
+	int err;
+
+	if (!index || size == 0) {
+		return -EINVAL;
+	}
+
+	err = at_parser_check(parser);
+	if (err) {
+		return err;
+	}
+
+	parser->index = index;
+	parser->index_size = size;
+
+	at_parser_index_build(parser);
+
 	return 0;
 }
 
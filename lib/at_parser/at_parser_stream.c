@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <zephyr/sys/util.h>
+#include <modem/at_parser.h>
+
+#include "at_token.h"
+#include "at_match.h"
+
+/* Carriage Return. */
+#define CR '\r'
+/* Line Feed. */
+#define LF '\n'
+/* Null Terminator. */
+#define NULL_TERMINATOR '\0'
+
+/* All possible response variants. */
+static const char * const resp[] = {
+	"OK\r\n",
+	"ERROR\r\n",
+	"+CME ERROR:",
+	"+CMS ERROR:"
+};
+
+static bool is_cr_lf(char c)
+{
+	return c == CR || c == LF;
+}
+
+static void consume(struct at_parser_stream *stream, size_t n)
+{
+	stream->len -= n;
+	memmove(stream->buf, stream->buf + n, stream->len);
+}
+
+/* Check if the buffer starts with a response, or could once more data is fed. */
+static int resp_check(const struct at_parser_stream *stream, bool final)
+{
+	bool partial = false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(resp); i++) {
+		size_t n = MIN(stream->len, strlen(resp[i]));
+
+		if (strncmp(stream->buf, resp[i], n) == 0) {
+			if (n == strlen(resp[i])) {
+				return 1;
+			}
+			partial = true;
+		}
+	}
+
+	return (partial && !final) ? -EAGAIN : 0;
+}
+
+/* Find the end of the AT command prefix at the beginning of the buffer. */
+static int prefix_end(const struct at_parser_stream *stream, bool final, size_t *end)
+{
+	for (size_t i = 0; i < stream->len; i++) {
+		switch (stream->buf[i]) {
+		case '=':
+			/* Lookahead to distinguish test commands from set commands. */
+			if (i + 1 < stream->len) {
+				*end = (stream->buf[i + 1] == '?') ? i + 1 : i;
+				return 0;
+			}
+			if (final) {
+				*end = i;
+				return 0;
+			}
+			return -EAGAIN;
+		case ':':
+		case '?':
+		case ',':
+		case CR:
+		case LF:
+			*end = i;
+			return 0;
+		default:
+			break;
+		}
+	}
+
+	if (final) {
+		*end = stream->len - 1;
+		return 0;
+	}
+
+	return -EAGAIN;
+}
+
+/* Find the end of the subparameter at the beginning of the buffer. */
+static int subparam_end(const struct at_parser_stream *stream, bool final, size_t *end)
+{
+	bool in_quotes = false;
+	bool in_array = false;
+
+	for (size_t i = 0; i < stream->len; i++) {
+		char c = stream->buf[i];
+
+		if (in_quotes) {
+			in_quotes = (c != '"');
+		} else if (c == '"') {
+			in_quotes = true;
+		} else if (c == '(') {
+			in_array = true;
+		} else if (c == ')') {
+			in_array = false;
+		} else if (!in_array && (c == ',' || is_cr_lf(c))) {
+			*end = i;
+			return 0;
+		}
+	}
+
+	if (final) {
+		*end = stream->len - 1;
+		return 0;
+	}
+
+	return -EAGAIN;
+}
+
+static int value_emit(struct at_parser_stream *stream, const struct at_token *token)
+{
+	struct at_parser_value value = {
+		.line = stream->line,
+		.index = stream->count,
+		.cmd_type = AT_PARSER_CMD_TYPE_UNKNOWN,
+		.str = token->start,
+		.len = token->len,
+	};
+
+	switch (token->type) {
+	case AT_TOKEN_TYPE_CMD_TEST:
+		value.type = AT_PARSER_VALUE_TYPE_PREFIX;
+		value.cmd_type = AT_PARSER_CMD_TYPE_TEST;
+		break;
+	case AT_TOKEN_TYPE_CMD_READ:
+		value.type = AT_PARSER_VALUE_TYPE_PREFIX;
+		value.cmd_type = AT_PARSER_CMD_TYPE_READ;
+		break;
+	case AT_TOKEN_TYPE_CMD_SET:
+		value.type = AT_PARSER_VALUE_TYPE_PREFIX;
+		value.cmd_type = AT_PARSER_CMD_TYPE_SET;
+		break;
+	case AT_TOKEN_TYPE_NOTIF:
+		value.type = AT_PARSER_VALUE_TYPE_PREFIX;
+		break;
+	case AT_TOKEN_TYPE_INT:
+		value.type = AT_PARSER_VALUE_TYPE_INT;
+		value.num = strtoll(token->start, NULL, 10);
+		break;
+	case AT_TOKEN_TYPE_QUOTED_STRING:
+	case AT_TOKEN_TYPE_STRING:
+		value.type = AT_PARSER_VALUE_TYPE_STRING;
+		break;
+	case AT_TOKEN_TYPE_ARRAY:
+		value.type = AT_PARSER_VALUE_TYPE_ARRAY;
+		/* Trim the enclosing parentheses. */
+		value.str++;
+		value.len -= 2;
+		break;
+	case AT_TOKEN_TYPE_EMPTY:
+	default:
+		value.type = AT_PARSER_VALUE_TYPE_EMPTY;
+		value.str = NULL;
+		value.len = 0;
+		break;
+	}
+
+	stream->count++;
+
+	return stream->cb(&value, stream->user_data);
+}
+
+static int empty_emit(struct at_parser_stream *stream)
+{
+	struct at_token token = { .type = AT_TOKEN_TYPE_EMPTY };
+
+	stream->is_next_empty = false;
+
+	return value_emit(stream, &token);
+}
+
+/* Match and emit one value, terminated at the given buffer index. */
+static int value_parse(struct at_parser_stream *stream, size_t end)
+{
+	int err;
+	char saved;
+	const char *remainder = NULL;
+	struct at_token token;
+
+	/* The matching functions need a null-terminated string. The buffer is never filled
+	 * completely, so there is always room for the null terminator.
+	 */
+	saved = stream->buf[end + 1];
+	stream->buf[end + 1] = NULL_TERMINATOR;
+
+	if (stream->count == 0) {
+		token = at_match_cmd(stream->buf, &remainder);
+	} else {
+		token = at_match_subparam(stream->buf, &remainder);
+	}
+
+	if (token.type == AT_TOKEN_TYPE_INVALID) {
+		token = at_match_str(stream->buf, &remainder);
+	}
+
+	if (token.type == AT_TOKEN_TYPE_INVALID) {
+		stream->buf[end + 1] = saved;
+		return -EBADMSG;
+	}
+
+	switch (token.type) {
+	case AT_TOKEN_TYPE_INT:
+	case AT_TOKEN_TYPE_QUOTED_STRING:
+	case AT_TOKEN_TYPE_ARRAY:
+	case AT_TOKEN_TYPE_EMPTY:
+		/* A subparameter without a trailing comma is the last one of the line. */
+		stream->is_next_empty = (token.var == AT_TOKEN_VAR_COMMA);
+		stream->is_line_end = (token.var == AT_TOKEN_VAR_NO_COMMA);
+		break;
+	default:
+		break;
+	}
+
+	err = value_emit(stream, &token);
+
+	stream->buf[end + 1] = saved;
+	consume(stream, remainder - stream->buf);
+
+	return err;
+}
+
+static int line_end(struct at_parser_stream *stream)
+{
+	int err = 0;
+
+	if (stream->is_next_empty) {
+		/* A trailing comma is followed by an empty subparameter. */
+		err = empty_emit(stream);
+	}
+
+	stream->count = 0;
+	stream->line++;
+	stream->is_line_end = false;
+
+	return err;
+}
+
+static int process(struct at_parser_stream *stream, bool final)
+{
+	int err;
+	size_t end;
+
+	while (stream->len > 0 && !stream->is_resp) {
+		if (stream->count == 0) {
+			/* Trim CR, LF, or CRLF between lines. */
+			if (is_cr_lf(stream->buf[0])) {
+				consume(stream, 1);
+				continue;
+			}
+
+			err = resp_check(stream, final);
+			if (err == -EAGAIN) {
+				break;
+			} else if (err) {
+				/* Don't tokenize response. */
+				stream->is_resp = true;
+				break;
+			}
+
+			err = prefix_end(stream, final, &end);
+		} else {
+			if (is_cr_lf(stream->buf[0])) {
+				err = line_end(stream);
+				if (err) {
+					return err;
+				}
+				continue;
+			}
+
+				/* The last subparameter must be followed by CR or LF. */
+				/* The last subparameter of the line must be followed by CR or LF. */
+				return -EBADMSG;
+			}
+
+			err = subparam_end(stream, final, &end);
+		}
+
+		if (err == -EAGAIN) {
+			break;
+		}
+
+		err = value_parse(stream, end);
+		if (err) {
+			return err;
+		}
+	}
+
+	/* Nothing was matched and the buffer is full, the value does not fit. */
+	if (!stream->is_resp && stream->len == stream->buf_size - 1) {
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+int at_parser_stream_init(struct at_parser_stream *stream, char *buf, size_t buf_size,
+			  at_parser_stream_cb_t cb, void *user_data)
+{
+	if (!stream || !buf || buf_size < 2 || !cb) {
+		return -EINVAL;
+	}
+
+	memset(stream, 0, sizeof(struct at_parser_stream));
+
+	stream->buf = buf;
+	stream->buf_size = buf_size;
+	stream->cb = cb;
+	stream->user_data = user_data;
+
+	return 0;
+}
+
+int at_parser_stream_feed(struct at_parser_stream *stream, const char *data, size_t len)
+{
+	size_t n;
+
+	if (!stream || !stream->buf || (!data && len > 0)) {
+		return -EINVAL;
+	}
+
+	while (len > 0 && !stream->err && !stream->is_resp) {
+		/* Keep one byte free for the null terminator. */
+		n = MIN(len, stream->buf_size - 1 - stream->len);
+
+		memcpy(stream->buf + stream->len, data, n);
+		stream->len += n;
+		data += n;
+		len -= n;
+
+		stream->err = process(stream, false);
+	}
+
+	return stream->err;
+}
+
+int at_parser_stream_finish(struct at_parser_stream *stream)
+{
+	if (!stream || !stream->buf) {
+		return -EINVAL;
+	}
+
+	if (stream->err || stream->is_resp) {
+		return stream->err;
+	}
+
+	stream->err = process(stream, true);
+	if (!stream->err && stream->count > 0) {
+		stream->err = line_end(stream);
+	}
+
+	return stream->err;
+}
@@ -41,6 +41,172 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	return 0;
 }
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+enum spsc_wait_bit {
+	SPSC_WAIT_VACANT,
+	SPSC_WAIT_FILLED,
+};
+
+static struct data_fifo_msgq *spsc_entry(struct data_fifo *data_fifo, atomic_val_t cnt)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[(uint32_t)cnt %
+								  data_fifo->elements_max];
+}
+
+static void *spsc_block(struct data_fifo *data_fifo, atomic_val_t cnt)
+{
+	return data_fifo->slab_buffer +
+	       ((uint32_t)cnt % data_fifo->elements_max) * data_fifo->block_size_max;
+}
+
+/** @brief Wait until the other side has moved the counter away from cnt.
+ *
+ * The waiting bit is set before the counter is checked again, so an update
+ * from the other side either is seen here or gives the semaphore.
+ */
+static int spsc_wait(struct data_fifo *data_fifo, enum spsc_wait_bit bit, struct k_sem *sem,
+		     atomic_t *counter, atomic_val_t cnt, k_timepoint_t end)
+{
+	int ret;
+
+	atomic_set_bit(&data_fifo->spsc_waiting, bit);
+
+	if (atomic_get(counter) != cnt) {
+		atomic_clear_bit(&data_fifo->spsc_waiting, bit);
+		return 0;
+	}
+
+	ret = k_sem_take(sem, sys_timepoint_timeout(end));
+	if (ret) {
+		atomic_clear_bit(&data_fifo->spsc_waiting, bit);
+	}
+
+	return ret;
+}
+
+static void spsc_wake(struct data_fifo *data_fifo, enum spsc_wait_bit bit, struct k_sem *sem)
+{
+	if (atomic_test_and_clear_bit(&data_fifo->spsc_waiting, bit)) {
+		k_sem_give(sem);
+	}
+}
+
+static int spsc_vacant_get(struct data_fifo *data_fifo, void **data, k_timeout_t timeout)
+{
+	int ret;
+	atomic_val_t locked = atomic_get(&data_fifo->spsc_locked);
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	/* A block taken but not locked is handed out again. */
+	if (atomic_get(&data_fifo->spsc_alloced) == locked) {
+		while ((uint32_t)(locked - atomic_get(&data_fifo->spsc_freed)) >=
+		       data_fifo->elements_max) {
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				return -ENOMEM;
+			}
+
+			ret = spsc_wait(data_fifo, SPSC_WAIT_VACANT, &data_fifo->spsc_vacant_sem,
+					&data_fifo->spsc_freed, locked - data_fifo->elements_max,
+					end);
+			if (ret) {
+				return ret;
+			}
+		}
+
+		atomic_set(&data_fifo->spsc_alloced, locked + 1);
+	}
+
+	*data = spsc_block(data_fifo, locked);
+
+	return 0;
+}
+
+static int spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	atomic_val_t locked = atomic_get(&data_fifo->spsc_locked);
+	struct data_fifo_msgq *entry = spsc_entry(data_fifo, locked);
+
+	if (atomic_get(&data_fifo->spsc_alloced) == locked ||
+	    *data != spsc_block(data_fifo, locked)) {
+		LOG_ERR("Block %p has not been taken from the FIFO", *data);
+		return -ESPIPE;
+	}
+
+	entry->block_ptr = *data;
+	entry->size = size;
+
+	/* The atomic store orders the entry before the new counter value. */
+	atomic_set(&data_fifo->spsc_locked, locked + 1);
+
+	spsc_wake(data_fifo, SPSC_WAIT_FILLED, &data_fifo->spsc_filled_sem);
+
+	return 0;
+}
+
+static int spsc_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+			   k_timeout_t timeout)
+{
+	int ret;
+	atomic_val_t read = atomic_get(&data_fifo->spsc_read);
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct data_fifo_msgq *entry;
+
+	while (atomic_get(&data_fifo->spsc_locked) == read) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		ret = spsc_wait(data_fifo, SPSC_WAIT_FILLED, &data_fifo->spsc_filled_sem,
+				&data_fifo->spsc_locked, read, end);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	entry = spsc_entry(data_fifo, read);
+	*data = entry->block_ptr;
+	*size = entry->size;
+
+	atomic_set(&data_fifo->spsc_read, read + 1);
+
+	return 0;
+}
+
+static void spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	atomic_val_t freed = atomic_get(&data_fifo->spsc_freed);
+	atomic_val_t locked;
+
+	if (freed != atomic_get(&data_fifo->spsc_read) &&
+	    data == spsc_block(data_fifo, freed)) {
+		atomic_set(&data_fifo->spsc_freed, freed + 1);
+
+		spsc_wake(data_fifo, SPSC_WAIT_VACANT, &data_fifo->spsc_vacant_sem);
+		return;
+	}
+
+	/* Otherwise, the producer gives back the block it has taken but not locked. */
+	locked = atomic_get(&data_fifo->spsc_locked);
+
+	__ASSERT(atomic_get(&data_fifo->spsc_alloced) != locked &&
+			 data == spsc_block(data_fifo, locked),
+		 "Block %p freed out of order", data);
+
+	atomic_set(&data_fifo->spsc_alloced, locked);
+}
+
+static void spsc_reset(struct data_fifo *data_fifo)
+{
+	atomic_clear(&data_fifo->spsc_alloced);
+	atomic_clear(&data_fifo->spsc_locked);
+	atomic_clear(&data_fifo->spsc_read);
+	atomic_clear(&data_fifo->spsc_freed);
+	atomic_clear(&data_fifo->spsc_waiting);
+	k_sem_init(&data_fifo->spsc_vacant_sem, 0, 1);
+	k_sem_init(&data_fifo->spsc_filled_sem, 0, 1);
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout)
 {
@@ -48,6 +214,12 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		return spsc_vacant_get(data_fifo, data, timeout);
+	}
+#endif
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +238,12 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		return spsc_block_lock(data_fifo, data, size);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -91,6 +269,12 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		return spsc_filled_get(data_fifo, data, size, timeout);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -108,6 +292,13 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		spsc_block_free(data_fifo, data);
+		return;
+	}
+#endif
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +311,20 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		atomic_val_t freed = atomic_get(&data_fifo->spsc_freed);
+		atomic_val_t read = atomic_get(&data_fifo->spsc_read);
+		atomic_val_t locked = atomic_get(&data_fifo->spsc_locked);
+		atomic_val_t alloced = atomic_get(&data_fifo->spsc_alloced);
+
+		*locked_num = (uint32_t)(locked - read);
+		*alloced_num = (uint32_t)(alloced - freed);
+
+		return 0;
+	}
+#endif
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -138,6 +343,13 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		spsc_reset(data_fifo);
+		return 0;
+	}
+#endif
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +404,14 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		spsc_reset(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+#endif
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
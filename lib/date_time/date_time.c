@@ -126,6 +126,20 @@ int date_time_now(int64_t *unix_time_ms)
 	return err;
 }
 
+int date_time_now_uncertainty(int64_t *unix_time_ms, uint32_t *uncertainty_ms)
+{
+	if ((unix_time_ms == NULL) || (uncertainty_ms == NULL)) {
+		LOG_ERR("The passed in pointer cannot be NULL");
+		return -EINVAL;
+	}
+	if (!date_time_is_valid()) {
+		LOG_WRN("Valid time not currently available");
+		return -ENODATA;
+	}
+
+	return date_time_core_now_uncertainty(unix_time_ms, uncertainty_ms);
+}
+
 int date_time_now_local(int64_t *local_time_ms)
 {
 	if (local_time_ms == NULL) {
@@ -11,9 +11,13 @@
 #define _POSIX_C_SOURCE 200809L /* Required for gmtime_r */
 
 #include <time.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 #include <date_time.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/clock.h>
+#include <zephyr/sys/crc.h>
 #include <modem/at_monitor.h>
 #include <modem/lte_lc.h>
 
@@ -47,6 +51,50 @@ static atomic_t reschedule_blocked;
 /* Number of consecutive retries that have been attempted so far */
 static atomic_t retry_count;
 
+/* Uncertainty of the time obtained from each time source. The modem reports the time with a
+ * resolution of one second. The NTP time is delayed by the transport.
+ */
+#define DATE_TIME_MODEM_UNCERTAINTY_MS	1000
+#define DATE_TIME_NTP_UNCERTAINTY_MS	500
+#define DATE_TIME_EXT_UNCERTAINTY_MS	1000
+
+/* Estimated drifts larger than this, in parts per billion, are considered time jumps. */
+#define DATE_TIME_DRIFT_MAX_PPB		1000000
+
+#define DATE_TIME_RETAINED_MAGIC	0x64747274
+
+/* The last time obtained from a time source. */
+struct date_time_sync {
+	/* UNIX time obtained from the time source, zero if no time has been obtained. */
+	int64_t unix_ms;
+	/* Uptime when the time was obtained. Negative if it was obtained before a warm reset. */
+	int64_t uptime_ms;
+	/* Time elapsed since the time was obtained, when the state was last retained. */
+	int64_t retained_elapsed_ms;
+	/* Uncertainty of the time when it was obtained. */
+	uint32_t uncertainty_ms;
+	/* Estimated drift of the uptime relative to the time sources, in parts per billion. */
+	int32_t drift_ppb;
+	int32_t tz;
+	uint32_t magic;
+	uint32_t crc;
+};
+
+#if defined(CONFIG_DATE_TIME_RETAINED)
+/* Not initialized at boot, so that the last obtained time survives warm resets. */
+static __noinit struct date_time_sync date_time_sync;
+
+/* Whether the time was restored after a reset and not obtained from a time source since. */
+static bool date_time_restored;
+
+static void date_time_retain_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(date_time_retain_work, date_time_retain_work_fn);
+#else
+static struct date_time_sync date_time_sync;
+#endif
+
+static struct k_spinlock date_time_sync_lock;
+
 static void date_time_core_notify_event(enum date_time_evt_type time_source)
 {
 	static struct date_time_evt evt;
@@ -166,6 +214,168 @@ static void date_time_update_work_fn(struct k_work *work)
 	date_time_core_notify_event(DATE_TIME_NOT_OBTAINED);
 }
 
+static uint32_t date_time_source_uncertainty_ms(enum date_time_evt_type time_source)
+{
+	switch (time_source) {
+	case DATE_TIME_OBTAINED_MODEM:
+		return DATE_TIME_MODEM_UNCERTAINTY_MS;
+	case DATE_TIME_OBTAINED_NTP:
+		return DATE_TIME_NTP_UNCERTAINTY_MS;
+	default:
+		return DATE_TIME_EXT_UNCERTAINTY_MS;
+	}
+}
+
+static int64_t date_time_sync_elapsed_ms(void)
+{
+	return k_uptime_get() - date_time_sync.uptime_ms;
+}
+
+static uint32_t date_time_sync_uncertainty_ms(int64_t elapsed_ms)
+{
+	int64_t uncertainty_ms = date_time_sync.uncertainty_ms +
+				 (elapsed_ms * CONFIG_DATE_TIME_DRIFT_TOLERANCE_PPM) / 1000000;
+
+	return MIN(uncertainty_ms, UINT32_MAX);
+}
+
+#if defined(CONFIG_DATE_TIME_RETAINED)
+static int64_t date_time_sync_estimate_ms(int64_t elapsed_ms)
+{
+	return date_time_sync.unix_ms + elapsed_ms +
+	       (elapsed_ms * date_time_sync.drift_ppb) / 1000000000;
+}
+
+static uint32_t date_time_sync_crc(void)
+{
+	return crc32_ieee((const uint8_t *)&date_time_sync, offsetof(struct date_time_sync, crc));
+}
+
+/* Must be called with date_time_sync_lock held. */
+static void date_time_sync_retain(void)
+{
+	date_time_sync.retained_elapsed_ms = date_time_sync_elapsed_ms();
+	date_time_sync.magic = DATE_TIME_RETAINED_MAGIC;
+	date_time_sync.crc = date_time_sync_crc();
+}
+
+static void date_time_retain_work_fn(struct k_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&date_time_sync_lock);
+
+	if (date_time_sync.unix_ms != 0) {
+		date_time_sync_retain();
+	}
+
+	k_spin_unlock(&date_time_sync_lock, key);
+
+	k_work_reschedule_for_queue(&date_time_work_q, &date_time_retain_work,
+				    K_SECONDS(CONFIG_DATE_TIME_RETAINED_SAVE_INTERVAL_SECONDS));
+}
+
+/* Update the drift estimate with the error of the estimated time when a new time is obtained.
+ * The error is only measured when the drift over the elapsed time can exceed the uncertainty
+ * of the time sources. Must be called with date_time_sync_lock held.
+ */
+static void date_time_sync_drift_update(int64_t unix_ms, int64_t uptime_ms,
+					uint32_t uncertainty_ms)
+{
+	int64_t elapsed_ms = uptime_ms - date_time_sync.uptime_ms;
+	int64_t min_elapsed_ms = ((int64_t)date_time_sync.uncertainty_ms + uncertainty_ms) *
+				 1000000 / CONFIG_DATE_TIME_DRIFT_TOLERANCE_PPM;
+	int64_t error_ms;
+	int32_t drift_ppb;
+
+	/* The duration of the reset is unknown, so the restored time cannot be used. */
+	if ((date_time_sync.unix_ms == 0) || date_time_restored ||
+	    (elapsed_ms < min_elapsed_ms)) {
+		return;
+	}
+
+	error_ms = unix_ms - (date_time_sync.unix_ms + elapsed_ms);
+
+	if (llabs(error_ms) > (elapsed_ms * DATE_TIME_DRIFT_MAX_PPB) / 1000000000) {
+		LOG_DBG("Date time changed by %lld ms, not used for drift estimation", error_ms);
+		return;
+	}
+
+	drift_ppb = (error_ms * 1000000000) / elapsed_ms;
+
+	date_time_sync.drift_ppb = (date_time_sync.drift_ppb == 0) ?
+		drift_ppb : (3 * date_time_sync.drift_ppb + drift_ppb) / 4;
+
+	LOG_DBG("Estimated drift: %d ppb", date_time_sync.drift_ppb);
+}
+
+static void date_time_sync_restore(void)
+{
+	struct timespec tp;
+	int64_t restored_ms;
+	int64_t uncertainty_ms;
+	int ret;
+
+	if ((date_time_sync.magic != DATE_TIME_RETAINED_MAGIC) ||
+	    (date_time_sync.crc != date_time_sync_crc()) || (date_time_sync.unix_ms == 0)) {
+		LOG_DBG("No retained date time");
+		memset(&date_time_sync, 0, sizeof(date_time_sync));
+		return;
+	}
+
+	/* The uptime restarted at boot. The time between the last retention of the state and the
+	 * reset is unknown, so it is added to the uncertainty.
+	 */
+	date_time_sync.uptime_ms = k_uptime_get() - date_time_sync.retained_elapsed_ms;
+
+	uncertainty_ms = (int64_t)date_time_sync.uncertainty_ms +
+			 CONFIG_DATE_TIME_RETAINED_SAVE_INTERVAL_SECONDS * MSEC_PER_SEC +
+			 CONFIG_DATE_TIME_RETAINED_RESET_UNCERTAINTY_MS;
+	date_time_sync.uncertainty_ms = MIN(uncertainty_ms, UINT32_MAX);
+
+	restored_ms = date_time_sync_estimate_ms(date_time_sync_elapsed_ms());
+
+	tp.tv_sec = restored_ms / 1000;
+	tp.tv_nsec = (restored_ms % 1000) * 1000000;
+
+	ret = sys_clock_settime(SYS_CLOCK_REALTIME, &tp);
+	if (ret != 0) {
+		LOG_ERR("Could not set system time, %d", ret);
+		memset(&date_time_sync, 0, sizeof(date_time_sync));
+		return;
+	}
+
+	date_time_tz = date_time_sync.tz;
+	date_time_restored = true;
+
+	date_time_sync_retain();
+
+	LOG_DBG("Date time restored, uncertainty: %u ms",
+		date_time_sync_uncertainty_ms(date_time_sync_elapsed_ms()));
+}
+#endif /* defined(CONFIG_DATE_TIME_RETAINED) */
+
+static void date_time_sync_update(int64_t unix_ms, enum date_time_evt_type time_source, int tz)
+{
+	k_spinlock_key_t key = k_spin_lock(&date_time_sync_lock);
+	int64_t uptime_ms = k_uptime_get();
+	uint32_t uncertainty_ms = date_time_source_uncertainty_ms(time_source);
+
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	date_time_sync_drift_update(unix_ms, uptime_ms, uncertainty_ms);
+	date_time_restored = false;
+#endif
+
+	date_time_sync.unix_ms = unix_ms;
+	date_time_sync.uptime_ms = uptime_ms;
+	date_time_sync.uncertainty_ms = uncertainty_ms;
+	date_time_sync.tz = tz;
+
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	date_time_sync_retain();
+#endif
+
+	k_spin_unlock(&date_time_sync_lock, key);
+}
+
 void date_time_lte_ind_handler(const struct lte_lc_evt *const evt)
 {
 #if defined(CONFIG_DATE_TIME_AUTO_UPDATE) && defined(CONFIG_LTE_LINK_CONTROL)
@@ -175,7 +385,8 @@ void date_time_lte_ind_handler(const struct lte_lc_evt *const evt)
 		switch (evt->nw_reg_status) {
 		case LTE_LC_NW_REG_REGISTERED_HOME:
 		case LTE_LC_NW_REG_REGISTERED_ROAMING:
-			if (!date_time_is_valid()) {
+			/* Also update a date time that was restored after a reset. */
+			if (date_time_last_update_uptime == 0) {
 				LOG_DBG("Date time update scheduled in 1 second "
 					"due to LTE registration");
 				k_work_reschedule_for_queue(
@@ -207,6 +418,15 @@ void date_time_core_init(void)
 		K_LOWEST_APPLICATION_THREAD_PRIO,
 		&cfg);
 
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	date_time_sync_restore();
+
+	if (CONFIG_DATE_TIME_RETAINED_SAVE_INTERVAL_SECONDS > 0) {
+		k_work_schedule_for_queue(&date_time_work_q, &date_time_retain_work,
+					  K_SECONDS(CONFIG_DATE_TIME_RETAINED_SAVE_INTERVAL_SECONDS));
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_DATE_TIME_AUTO_UPDATE) && IS_ENABLED(CONFIG_LTE_LINK_CONTROL)) {
 		lte_lc_register_handler(date_time_lte_ind_handler);
 	}
@@ -227,6 +447,21 @@ int date_time_core_now(int64_t *unix_time_ms)
 	int err;
 	struct timespec tp;
 
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	k_spinlock_key_t key = k_spin_lock(&date_time_sync_lock);
+
+	if (date_time_sync.unix_ms != 0) {
+		/* Apply the drift estimate, and retain the elapsed time while at it. */
+		*unix_time_ms = date_time_sync_estimate_ms(date_time_sync_elapsed_ms());
+		date_time_sync_retain();
+
+		k_spin_unlock(&date_time_sync_lock, key);
+		return 0;
+	}
+
+	k_spin_unlock(&date_time_sync_lock, key);
+#endif
+
 	err = sys_clock_gettime(SYS_CLOCK_REALTIME, &tp);
 	if (err) {
 		LOG_WRN("sys_clock_gettime failed, errno %d", errno);
@@ -237,6 +472,23 @@ int date_time_core_now(int64_t *unix_time_ms)
 	return 0;
 }
 
+int date_time_core_now_uncertainty(int64_t *unix_time_ms, uint32_t *uncertainty_ms)
+{
+	k_spinlock_key_t key;
+	int err;
+
+	err = date_time_core_now(unix_time_ms);
+	if (err) {
+		return err;
+	}
+
+	key = k_spin_lock(&date_time_sync_lock);
+	*uncertainty_ms = date_time_sync_uncertainty_ms(date_time_sync_elapsed_ms());
+	k_spin_unlock(&date_time_sync_lock, key);
+
+	return 0;
+}
+
 int date_time_core_now_local(int64_t *local_time_ms)
 {
 	int err;
@@ -288,6 +540,11 @@ void date_time_core_register_handler(date_time_evt_handler_t evt_handler)
 
 bool date_time_core_is_valid(void)
 {
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	if (date_time_restored) {
+		return true;
+	}
+#endif
 	return (date_time_last_update_uptime != 0);
 }
 
@@ -302,7 +559,17 @@ bool date_time_core_is_valid_local(void)
 
 void date_time_core_clear(void)
 {
+	k_spinlock_key_t key = k_spin_lock(&date_time_sync_lock);
+
 	date_time_last_update_uptime = 0;
+
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	date_time_restored = false;
+#endif
+	/* Also invalidates the retained date time. */
+	memset(&date_time_sync, 0, sizeof(date_time_sync));
+
+	k_spin_unlock(&date_time_sync_lock, key);
 }
 
 int date_time_core_current_check(void)
@@ -337,6 +604,8 @@ void date_time_core_store_tz(int64_t curr_time_ms, enum date_time_evt_type time_
 
 	date_time_tz = tz;
 
+	date_time_sync_update(curr_time_ms, time_source, tz);
+
 	date_time_core_schedule_update();
 
 	/* Reset the retry counter since we have successfully acquired a time. */
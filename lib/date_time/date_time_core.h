@@ -11,6 +11,7 @@
 
 void date_time_core_init(void);
 int date_time_core_now(int64_t *unix_time_ms);
+int date_time_core_now_uncertainty(int64_t *unix_time_ms, uint32_t *uncertainty_ms);
 int date_time_core_now_local(int64_t *local_time_ms);
 int date_time_core_update_async(date_time_evt_handler_t evt_handler);
 void date_time_core_register_handler(date_time_evt_handler_t evt_handler);
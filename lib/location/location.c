@@ -17,6 +17,9 @@
 
 #include "location_core.h"
 #include "location_utils.h"
+#if defined(CONFIG_LOCATION_CACHE)
+#include "location_cache.h"
+#endif
 
 LOG_MODULE_REGISTER(location, CONFIG_LOCATION_LOG_LEVEL);
 
@@ -398,3 +401,23 @@ void location_cloud_location_ext_result_set(
 	location_core_cloud_location_ext_result_set(result, location);
 #endif
 }
+
+int location_stationary_hint_set(bool stationary)
+{
+#if defined(CONFIG_LOCATION_CACHE)
+	location_cache_stationary_hint_set(stationary);
+
+	return 0;
+#endif
+	return -ENOTSUP;
+}
+
+int location_cache_clear(void)
+{
+#if defined(CONFIG_LOCATION_CACHE)
+	location_cache_reset();
+
+	return 0;
+#endif
+	return -ENOTSUP;
+}
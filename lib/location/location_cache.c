@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <modem/location.h>
+#include <modem/lte_lc.h>
+
+#include "location_cache.h"
+
+LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
+
+#define LOCATION_CACHE_MAX_AGE_MS (CONFIG_LOCATION_CACHE_MAX_AGE * MSEC_PER_SEC)
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+#define LOCATION_CACHE_WIFI_AP_COUNT CONFIG_LOCATION_METHOD_WIFI_SCANNING_RESULTS_MAX_CNT
+
+struct location_cache_wifi_ap {
+	uint8_t mac[WIFI_MAC_ADDR_LEN];
+};
+#endif
+
+/** Motion state of the device reported by the application. */
+enum location_cache_motion {
+	LOCATION_CACHE_MOTION_UNKNOWN,
+	LOCATION_CACHE_MOTION_STATIONARY,
+	LOCATION_CACHE_MOTION_MOVING,
+};
+
+struct location_cache_entry {
+	bool valid;
+	struct location_data location;
+	enum location_method method;
+	/** Uptime when the location was stored. */
+	int64_t timestamp;
+	/** Serving cell when the location was stored. */
+	uint32_t cell_id;
+	uint32_t tac;
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	/** Wi-Fi access points the location is based on. */
+	struct location_cache_wifi_ap wifi_aps[LOCATION_CACHE_WIFI_AP_COUNT];
+	uint8_t wifi_ap_count;
+#endif
+};
+
+static struct location_cache_entry cache_entry;
+static enum location_cache_motion motion;
+/* Uptime when the device was reported stationary. */
+static int64_t stationary_timestamp;
+
+/* Serving cell tracked from LTE link controller cell updates. */
+static uint32_t serving_cell_id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+static uint32_t serving_tac;
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+/* Wi-Fi access points of the latest scan, stored along with the next location. */
+static struct location_cache_wifi_ap scan_wifi_aps[LOCATION_CACHE_WIFI_AP_COUNT];
+static uint8_t scan_wifi_ap_count;
+#endif
+
+static K_MUTEX_DEFINE(location_cache_mutex);
+
+static void location_cache_lte_ind_handler(const struct lte_lc_evt *const evt)
+{
+	if (evt->type != LTE_LC_EVT_CELL_UPDATE) {
+		return;
+	}
+
+	k_mutex_lock(&location_cache_mutex, K_FOREVER);
+	serving_cell_id = evt->cell.id;
+	serving_tac = evt->cell.tac;
+	k_mutex_unlock(&location_cache_mutex);
+}
+
+/* Must be called with location_cache_mutex locked. */
+static bool location_cache_entry_valid(void)
+{
+	if (!cache_entry.valid) {
+		return false;
+	}
+
+	if (k_uptime_get() - cache_entry.timestamp > LOCATION_CACHE_MAX_AGE_MS) {
+		LOG_DBG("Cached location expired");
+		cache_entry.valid = false;
+		return false;
+	}
+
+	return true;
+}
+
+/* Must be called with location_cache_mutex locked. */
+static bool location_cache_cell_match(uint32_t cell_id, uint32_t tac)
+{
+	return cache_entry.cell_id != LTE_LC_CELL_EUTRAN_ID_INVALID &&
+	       cache_entry.cell_id == cell_id &&
+	       cache_entry.tac == tac;
+}
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+/* Must be called with location_cache_mutex locked. */
+static bool location_cache_wifi_match(const struct wifi_scan_info *wifi_data)
+{
+	uint8_t match_count = 0;
+
+	if (cache_entry.wifi_ap_count == 0 || wifi_data == NULL) {
+		return false;
+	}
+
+	for (int i = 0; i < cache_entry.wifi_ap_count; i++) {
+		for (int j = 0; j < wifi_data->cnt; j++) {
+			if (memcmp(cache_entry.wifi_aps[i].mac, wifi_data->ap_info[j].mac,
+				   WIFI_MAC_ADDR_LEN) == 0) {
+				match_count++;
+				break;
+			}
+		}
+	}
+
+	LOG_DBG("%d of %d cached Wi-Fi access points found",
+		match_count, cache_entry.wifi_ap_count);
+
+	return match_count * 100 >=
+	       cache_entry.wifi_ap_count * CONFIG_LOCATION_CACHE_WIFI_AP_MATCH_PERCENT;
+}
+#endif
+
+bool location_cache_get(struct location_data *location, enum location_method *method)
+{
+	bool hit = false;
+
+	k_mutex_lock(&location_cache_mutex, K_FOREVER);
+
+	if (!location_cache_entry_valid()) {
+		goto exit;
+	}
+
+	if (motion == LOCATION_CACHE_MOTION_STATIONARY &&
+	    cache_entry.timestamp >= stationary_timestamp) {
+		LOG_DBG("Device has been stationary, using cached location");
+		hit = true;
+		goto exit;
+	}
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	if (cache_entry.wifi_ap_count > 0) {
+		/* Cannot be verified without a Wi-Fi scan */
+		goto exit;
+	}
+#endif
+
+	if (location_cache_cell_match(serving_cell_id, serving_tac)) {
+		LOG_DBG("Serving cell has not changed, using cached location");
+		hit = true;
+	}
+
+exit:
+	if (hit) {
+		*location = cache_entry.location;
+		*method = cache_entry.method;
+	}
+
+	k_mutex_unlock(&location_cache_mutex);
+
+	return hit;
+}
+
+bool location_cache_scan_match(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	struct location_data *location)
+{
+	bool hit = false;
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	k_mutex_lock(&location_cache_mutex, K_FOREVER);
+
+	if (!location_cache_entry_valid()) {
+		goto exit;
+	}
+
+	if (cell_data != NULL &&
+	    cell_data->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID &&
+	    !location_cache_cell_match(cell_data->current_cell.id, cell_data->current_cell.tac)) {
+		goto exit;
+	}
+
+	if (location_cache_wifi_match(wifi_data)) {
+		LOG_DBG("Wi-Fi access points have not changed, using cached location");
+		*location = cache_entry.location;
+		hit = true;
+	}
+
+exit:
+	k_mutex_unlock(&location_cache_mutex);
+#else
+	ARG_UNUSED(cell_data);
+	ARG_UNUSED(wifi_data);
+	ARG_UNUSED(location);
+#endif
+	return hit;
+}
+
+void location_cache_scan_set(const struct wifi_scan_info *wifi_data)
+{
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	k_mutex_lock(&location_cache_mutex, K_FOREVER);
+
+	scan_wifi_ap_count = 0;
+
+	if (wifi_data != NULL) {
+		for (int i = 0; i < MIN(wifi_data->cnt, LOCATION_CACHE_WIFI_AP_COUNT); i++) {
+			memcpy(scan_wifi_aps[i].mac, wifi_data->ap_info[i].mac, WIFI_MAC_ADDR_LEN);
+		}
+		scan_wifi_ap_count = MIN(wifi_data->cnt, LOCATION_CACHE_WIFI_AP_COUNT);
+	}
+
+	k_mutex_unlock(&location_cache_mutex);
+#else
+	ARG_UNUSED(wifi_data);
+#endif
+}
+
+void location_cache_store(const struct location_data *location, enum location_method method)
+{
+	k_mutex_lock(&location_cache_mutex, K_FOREVER);
+
+	if (motion == LOCATION_CACHE_MOTION_MOVING) {
+		/* The location will be outdated by the time the device stops */
+		goto exit;
+	}
+
+	cache_entry.location = *location;
+	cache_entry.method = method;
+	cache_entry.timestamp = k_uptime_get();
+	cache_entry.cell_id = serving_cell_id;
+	cache_entry.tac = serving_tac;
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	cache_entry.wifi_ap_count = 0;
+	if (method == LOCATION_METHOD_WIFI || method == LOCATION_METHOD_WIFI_CELLULAR) {
+		memcpy(cache_entry.wifi_aps, scan_wifi_aps,
+		       scan_wifi_ap_count * sizeof(scan_wifi_aps[0]));
+		cache_entry.wifi_ap_count = scan_wifi_ap_count;
+	}
+	scan_wifi_ap_count = 0;
+#endif
+	cache_entry.valid = true;
+
+	LOG_DBG("Location stored into the cache");
+
+exit:
+	k_mutex_unlock(&location_cache_mutex);
+}
+
+void location_cache_reset(void)
+{
+	k_mutex_lock(&location_cache_mutex, K_FOREVER);
+	cache_entry.valid = false;
+	k_mutex_unlock(&location_cache_mutex);
+}
+
+void location_cache_stationary_hint_set(bool stationary)
+{
+	k_mutex_lock(&location_cache_mutex, K_FOREVER);
+
+	if (stationary) {
+		if (motion != LOCATION_CACHE_MOTION_STATIONARY) {
+			stationary_timestamp = k_uptime_get();
+		}
+		motion = LOCATION_CACHE_MOTION_STATIONARY;
+	} else {
+		/* The cached location is no longer valid if the device has moved */
+		motion = LOCATION_CACHE_MOTION_MOVING;
+		cache_entry.valid = false;
+	}
+
+	k_mutex_unlock(&location_cache_mutex);
+}
+
+void location_cache_init(void)
+{
+	lte_lc_register_handler(location_cache_lte_ind_handler);
+}
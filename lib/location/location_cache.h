@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef LOCATION_CACHE_H
+#define LOCATION_CACHE_H
+
+#include <modem/location.h>
+#include <modem/lte_lc.h>
+#include <net/wifi_location_common.h>
+
+void location_cache_init(void);
+
+/**
+ * @brief Get the cached location without scanning.
+ *
+ * @details The cached location is returned if it has not expired and either the device has been
+ * reported stationary, or the location is not based on a Wi-Fi scan and the serving cell has not
+ * changed since the location was stored.
+ *
+ * @param[out] location Cached location.
+ * @param[out] method Method the cached location was acquired with.
+ *
+ * @retval true  Cached location was returned.
+ * @retval false No usable location in the cache.
+ */
+bool location_cache_get(struct location_data *location, enum location_method *method);
+
+/**
+ * @brief Get the cached location if it matches the given scan results.
+ *
+ * @details The cached location is returned if it has not expired, it is based on a Wi-Fi scan,
+ * the serving cell in the given cell information has not changed and enough of the cached Wi-Fi
+ * access points are found in the given scan results.
+ *
+ * @param[in] cell_data Cellular scan results, or NULL if not available.
+ * @param[in] wifi_data Wi-Fi scan results, or NULL if not available.
+ * @param[out] location Cached location.
+ *
+ * @retval true  Cached location was returned.
+ * @retval false No cached location matching the scan results.
+ */
+bool location_cache_scan_match(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	struct location_data *location);
+
+/**
+ * @brief Set the scan results that the next stored location is based on.
+ *
+ * @param[in] wifi_data Wi-Fi scan results, or NULL if not available.
+ */
+void location_cache_scan_set(const struct wifi_scan_info *wifi_data);
+
+/**
+ * @brief Store a location acquired with the given method.
+ *
+ * @param[in] location Acquired location.
+ * @param[in] method Method the location was acquired with.
+ */
+void location_cache_store(const struct location_data *location, enum location_method method);
+
+void location_cache_reset(void);
+void location_cache_stationary_hint_set(bool stationary);
+
+#endif /* LOCATION_CACHE_H */
@@ -12,6 +12,9 @@
 
 #include "location_core.h"
 #include "location_utils.h"
+#if defined(CONFIG_LOCATION_CACHE)
+#include "location_cache.h"
+#endif
 #if defined(CONFIG_LOCATION_METHOD_GNSS)
 #include "method_gnss.h"
 #endif
@@ -157,6 +160,9 @@ static void location_core_current_event_data_init(enum location_method method)
 
 	loc_req_info.current_method = method;
 	loc_req_info.elapsed_time_method_start_timestamp = k_uptime_get();
+#if defined(CONFIG_LOCATION_CACHE)
+	loc_req_info.cache_hit = false;
+#endif
 }
 
 static void location_core_current_config_clear(void)
@@ -178,6 +184,46 @@ static const struct location_method_api *location_method_api_get(enum location_m
 	return method_api;
 }
 
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) || defined(CONFIG_LOCATION_PARALLEL_SCAN)
+static bool location_core_is_cloud_method(int method)
+{
+	if (method == LOCATION_METHOD_CELLULAR ||
+	    method == LOCATION_METHOD_WIFI ||
+	    method == LOCATION_METHOD_WIFI_CELLULAR) {
+		return true;
+	}
+
+	return false;
+}
+#endif
+
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+/**
+ * Starts the scans of the next method in parallel with GNSS if the method is a cloud method.
+ *
+ * This needs to be called before the location_get() of the GNSS method so that the scan work
+ * gets ahead of the GNSS work in the work queue.
+ */
+static void location_core_parallel_scan_start(enum location_method requested_method)
+{
+	int next_method_index = loc_req_info.current_method_index + 1;
+	enum location_method next_method;
+
+	if (requested_method != LOCATION_METHOD_GNSS ||
+	    loc_req_info.config.mode != LOCATION_REQ_MODE_FALLBACK ||
+	    next_method_index >= loc_req_info.methods_count) {
+		return;
+	}
+
+	next_method = loc_req_info.methods[next_method_index];
+	if (!location_core_is_cloud_method(next_method)) {
+		return;
+	}
+
+	method_cloud_location_scan_start(&loc_req_info, next_method);
+}
+#endif
+
 #if defined(CONFIG_LOG)
 
 static const char LOCATION_ACCURACY_LOW_STR[] = "low";
@@ -219,6 +265,9 @@ int location_core_init(void)
 	 * a failing one would result in two calls to k_work_queue_start,
 	 * which is not allowed.
 	 */
+#if defined(CONFIG_LOCATION_CACHE)
+	location_cache_init();
+#endif
 	for (int i = 0; methods_supported[i] != NULL; i++) {
 		if (methods_supported[i]->init == NULL) {
 			continue;
@@ -336,13 +385,34 @@ static int location_core_location_get_pos(void)
 		k_uptime_get() + loc_req_info.config.timeout : SYS_FOREVER_MS;
 	loc_req_info.execute_fallback = true;
 	loc_req_info.current_method_index = 0;
+
+#if defined(CONFIG_LOCATION_CACHE)
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_FALLBACK) {
+		struct location_data location;
+
+		if (location_cache_get(&location, &requested_method)) {
+			LOG_DBG("Using cached location acquired with '%s' method",
+				(char *)location_method_api_get(requested_method)->method_string);
+			location_core_current_event_data_init(requested_method);
+			location_core_event_cb_cached(&location);
+			return 0;
+		}
+	}
+#endif
+
 	requested_method = loc_req_info.methods[loc_req_info.current_method_index];
 	LOG_DBG("Requesting location with '%s' method",
 		(char *)location_method_api_get(requested_method)->method_string);
 	location_core_current_event_data_init(requested_method);
 
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+	location_core_parallel_scan_start(requested_method);
+#endif
 	err = location_method_api_get(requested_method)->location_get(&loc_req_info);
 	if (err != 0) {
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+		method_cloud_location_scan_cancel();
+#endif
 		return err;
 	}
 
@@ -475,6 +545,15 @@ void location_core_event_cb_timeout(void)
 	location_core_event_cb(NULL);
 }
 
+#if defined(CONFIG_LOCATION_CACHE)
+void location_core_event_cb_cached(const struct location_data *location)
+{
+	loc_req_info.cache_hit = true;
+
+	location_core_event_cb(location);
+}
+#endif
+
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && defined(CONFIG_NRF_CLOUD_AGNSS)
 void location_core_event_cb_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *request)
 {
@@ -534,17 +613,6 @@ void location_core_event_cb_cloud_location_request(struct location_data_cloud *r
 	location_utils_event_dispatch(&cloud_location_request_event_data);
 }
 
-static bool location_core_is_cloud_method(int method)
-{
-	if (method == LOCATION_METHOD_CELLULAR ||
-	    method == LOCATION_METHOD_WIFI ||
-	    method == LOCATION_METHOD_WIFI_CELLULAR) {
-		return true;
-	}
-
-	return false;
-}
-
 void location_core_cloud_location_ext_result_set(
 	enum location_ext_result result,
 	struct location_data *location)
@@ -649,6 +717,12 @@ static void location_core_event_cb_fn(struct k_work *work)
 		}
 		LOG_DBG("  Google maps URL: https://maps.google.com/?q=%s,%s",
 			latitude_str, longitude_str);
+#if defined(CONFIG_LOCATION_CACHE)
+		if (!loc_req_info.cache_hit) {
+			location_cache_store(&loc_req_info.current_event_data.location,
+					     loc_req_info.current_method);
+		}
+#endif
 		if (loc_req_info.config.mode == LOCATION_REQ_MODE_ALL) {
 			/* Get possible next method */
 			loc_req_info.current_method_index++;
@@ -715,6 +789,9 @@ static void location_core_event_cb_fn(struct k_work *work)
 			}
 
 			location_core_current_event_data_init(requested_method);
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+			location_core_parallel_scan_start(requested_method);
+#endif
 			err = location_method_api_get(requested_method)->location_get(
 				&loc_req_info);
 			return;
@@ -726,6 +803,10 @@ static void location_core_event_cb_fn(struct k_work *work)
 		}
 	}
 
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+	/* Scans started in parallel with GNSS are no longer needed */
+	method_cloud_location_scan_cancel();
+#endif
 	location_utils_event_dispatch(&loc_req_info.current_event_data);
 
 	k_work_cancel_delayable(&location_core_timeout_work);
@@ -854,6 +935,10 @@ int location_core_cancel(void)
 		LOG_DBG("No location request pending so not cancelling anything");
 	}
 
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+	method_cloud_location_scan_cancel();
+#endif
+
 	location_core_current_config_clear();
 
 	k_sem_give(&location_core_sem);
@@ -43,6 +43,11 @@ struct location_request_info {
 	 * This is used in cloud location method to calculate timeout for the cloud operation.
 	 */
 	int64_t timeout_uptime;
+
+#if defined(CONFIG_LOCATION_CACHE)
+	/** Whether the location of the current method was taken from the location cache. */
+	bool cache_hit;
+#endif
 };
 
 struct location_method_api {
@@ -66,6 +71,9 @@ int location_core_cancel(void);
 void location_core_event_cb(const struct location_data *location);
 void location_core_event_cb_error(void);
 void location_core_event_cb_timeout(void);
+#if defined(CONFIG_LOCATION_CACHE)
+void location_core_event_cb_cached(const struct location_data *location);
+#endif
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && defined(CONFIG_NRF_CLOUD_AGNSS)
 void location_core_event_cb_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *request);
 #endif
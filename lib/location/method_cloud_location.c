@@ -16,6 +16,9 @@
 #include "scan_cellular.h"
 #include "scan_wifi.h"
 #include "cloud_service.h"
+#if defined(CONFIG_LOCATION_CACHE)
+#include "location_cache.h"
+#endif
 
 LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
 
@@ -38,6 +41,8 @@ struct method_cloud_location_start_work_args {
 	const struct location_wifi_config *wifi_config;
 	const struct location_cellular_config *cell_config;
 	int64_t locreq_timeout_uptime;
+	/** Whether the scans were already started in parallel with GNSS. */
+	bool scanned;
 };
 
 static struct method_cloud_location_start_work_args method_cloud_location_start_work;
@@ -47,6 +52,37 @@ static bool running;
 static K_SEM_DEFINE(wifi_scan_ready, 0, 1);
 #endif
 
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+struct method_cloud_location_scan_work_args {
+	struct k_work work_item;
+	const struct location_wifi_config *wifi_config;
+	const struct location_cellular_config *cell_config;
+};
+
+static struct method_cloud_location_scan_work_args method_cloud_location_scan_work;
+/* Method for which the scans were started in parallel with GNSS, zero if none. */
+static enum location_method scan_method;
+#endif
+
+static void method_cloud_location_scan(
+	const struct location_wifi_config *wifi_config,
+	const struct location_cellular_config *cell_config)
+{
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	k_sem_reset(&wifi_scan_ready);
+
+	if (wifi_config != NULL) {
+		scan_wifi_execute(wifi_config->timeout, &wifi_scan_ready);
+	}
+#endif
+
+#if defined(CONFIG_LOCATION_METHOD_CELLULAR)
+	if (cell_config != NULL) {
+		scan_cellular_execute(cell_config->timeout, cell_config->cell_count);
+	}
+#endif
+}
+
 static void method_cloud_location_positioning_work_fn(struct k_work *work)
 {
 	struct method_cloud_location_start_work_args *work_data =
@@ -61,17 +97,14 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 	struct lte_lc_cells_info *scan_cellular_info = NULL;
 	int err = 0;
 
-#if defined(CONFIG_LOCATION_METHOD_WIFI)
-	k_sem_reset(&wifi_scan_ready);
-
-	if (wifi_config != NULL) {
-		scan_wifi_execute(wifi_config->timeout, &wifi_scan_ready);
+	if (work_data->scanned) {
+		LOG_DBG("Using scan results obtained in parallel with GNSS");
+	} else {
+		method_cloud_location_scan(work_data->wifi_config, work_data->cell_config);
 	}
-#endif
 
 #if defined(CONFIG_LOCATION_METHOD_CELLULAR)
 	if (cell_config != NULL) {
-		scan_cellular_execute(cell_config->timeout, cell_config->cell_count);
 		scan_cellular_info = scan_cellular_results_get();
 	}
 #endif
@@ -93,6 +126,17 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 		goto end;
 	}
 
+#if defined(CONFIG_LOCATION_CACHE)
+	struct location_data cached_location;
+
+	/* Skip the cloud request if the scan results match the cached location */
+	if (location_cache_scan_match(scan_cellular_info, scan_wifi_info, &cached_location)) {
+		location_core_event_cb_cached(&cached_location);
+		goto end;
+	}
+	location_cache_scan_set(scan_wifi_info);
+#endif
+
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
 	struct location_data_cloud request = {
 #if defined(CONFIG_LOCATION_METHOD_CELLULAR)
@@ -199,6 +243,16 @@ int method_cloud_location_get(const struct location_request_info *request)
 	}
 
 	method_cloud_location_start_work.locreq_timeout_uptime = request->timeout_uptime;
+	method_cloud_location_start_work.scanned = false;
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+	/* The scan work was submitted to the same work queue before GNSS was started,
+	 * so it has been run by the time the positioning work is executed.
+	 */
+	if (scan_method == request->current_method) {
+		method_cloud_location_start_work.scanned = true;
+		scan_method = 0;
+	}
+#endif
 	k_work_submit_to_queue(
 		location_core_work_queue_get(),
 		&method_cloud_location_start_work.work_item);
@@ -208,6 +262,57 @@ int method_cloud_location_get(const struct location_request_info *request)
 	return 0;
 }
 
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+static void method_cloud_location_scan_work_fn(struct k_work *work)
+{
+	struct method_cloud_location_scan_work_args *work_data =
+		CONTAINER_OF(work, struct method_cloud_location_scan_work_args, work_item);
+
+	method_cloud_location_scan(work_data->wifi_config, work_data->cell_config);
+}
+
+void method_cloud_location_scan_start(
+	const struct location_request_info *request,
+	enum location_method method)
+{
+	__ASSERT_NO_MSG(request->cellular != NULL || request->wifi != NULL);
+
+	method_cloud_location_scan_work.wifi_config = NULL;
+	method_cloud_location_scan_work.cell_config = NULL;
+	if (method == LOCATION_METHOD_CELLULAR || method == LOCATION_METHOD_WIFI_CELLULAR) {
+		method_cloud_location_scan_work.cell_config = request->cellular;
+	}
+	if (method == LOCATION_METHOD_WIFI || method == LOCATION_METHOD_WIFI_CELLULAR) {
+		method_cloud_location_scan_work.wifi_config = request->wifi;
+	}
+
+	LOG_DBG("Starting scans for the fallback method in parallel with GNSS");
+
+	scan_method = method;
+	k_work_submit_to_queue(
+		location_core_work_queue_get(),
+		&method_cloud_location_scan_work.work_item);
+}
+
+void method_cloud_location_scan_cancel(void)
+{
+	if (scan_method == 0) {
+		return;
+	}
+
+	LOG_DBG("Cancelling scans started in parallel with GNSS");
+
+	(void)k_work_cancel(&method_cloud_location_scan_work.work_item);
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	scan_wifi_cancel();
+#endif
+#if defined(CONFIG_LOCATION_METHOD_CELLULAR)
+	(void)scan_cellular_cancel();
+#endif
+	scan_method = 0;
+}
+#endif /* CONFIG_LOCATION_PARALLEL_SCAN */
+
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 void method_cloud_location_details_get(struct location_data_details *details)
 {
@@ -223,6 +328,12 @@ void method_cloud_location_details_get(struct location_data_details *details)
 int method_cloud_location_init(void)
 {
 	running = false;
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+	scan_method = 0;
+	k_work_init(
+		&method_cloud_location_scan_work.work_item,
+		method_cloud_location_scan_work_fn);
+#endif
 
 	return 0;
 }
@@ -10,6 +10,12 @@
 int method_cloud_location_get(const struct location_request_info *request);
 int method_cloud_location_init(void);
 int method_cloud_location_cancel(void);
+#if defined(CONFIG_LOCATION_PARALLEL_SCAN)
+void method_cloud_location_scan_start(
+	const struct location_request_info *request,
+	enum location_method method);
+void method_cloud_location_scan_cancel(void);
+#endif
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 void method_cloud_location_details_get(struct location_data_details *details);
 #endif
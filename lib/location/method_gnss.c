@@ -255,6 +255,13 @@ static void method_gnss_nrf_cloud_agnss_request(void)
 {
 	int err;
 
+#if defined(CONFIG_NRF_CLOUD_AGNSS_CACHE)
+	if (!nrf_cloud_agnss_cache_apply(&agnss_request)) {
+		LOG_DBG("A-GNSS data injected from cache");
+		return;
+	}
+#endif
+
 	struct nrf_cloud_coap_agnss_request request = {
 		NRF_CLOUD_COAP_AGNSS_REQ_CUSTOM,
 		&agnss_request,
@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/logging/log.h>
@@ -29,6 +30,21 @@ static struct wifi_scan_info scan_wifi_info = {
 };
 static struct k_sem *scan_wifi_ready;
 
+#if defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE)
+struct scan_wifi_cache_entry {
+	struct wifi_scan_result result;
+	/* Uptime when the access point was last found, in milliseconds */
+	int64_t seen;
+};
+
+static struct scan_wifi_cache_entry
+	scan_wifi_cache[CONFIG_LOCATION_METHOD_WIFI_SCANNING_RESULTS_MAX_CNT];
+static size_t scan_wifi_cache_cnt;
+/* Uptime of the last completed scan, in milliseconds, 0 if there is none */
+static int64_t scan_wifi_cache_updated;
+static K_MUTEX_DEFINE(scan_wifi_cache_mutex);
+#endif /* defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE) */
+
 #if defined(CONFIG_LOCATION_METHOD_WIFI_NET_IF_UPDOWN)
 /* Timeout for waiting for Wi-Fi to be ready, max 10s in nRF70 + buffer */
 #define WIFI_READY_TIMEOUT_SEC 15
@@ -82,6 +98,112 @@ void scan_wifi_details_get(struct location_data_details *details)
 }
 #endif
 
+#if defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE)
+static void scan_wifi_cache_update(const struct wifi_scan_result *entry)
+{
+	struct scan_wifi_cache_entry *slot = NULL;
+	int64_t now = k_uptime_get();
+
+	k_mutex_lock(&scan_wifi_cache_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < scan_wifi_cache_cnt; i++) {
+		if (memcmp(scan_wifi_cache[i].result.mac, entry->mac, WIFI_MAC_ADDR_LEN) == 0) {
+			slot = &scan_wifi_cache[i];
+			break;
+		}
+	}
+
+	if (slot == NULL) {
+		if (scan_wifi_cache_cnt < ARRAY_SIZE(scan_wifi_cache)) {
+			slot = &scan_wifi_cache[scan_wifi_cache_cnt++];
+		} else {
+			/* Replace the access point found least recently in a previous scan */
+			for (size_t i = 0; i < scan_wifi_cache_cnt; i++) {
+				if (scan_wifi_cache[i].seen <= scan_wifi_cache_updated &&
+				    (slot == NULL || scan_wifi_cache[i].seen < slot->seen)) {
+					slot = &scan_wifi_cache[i];
+				}
+			}
+		}
+
+		if (slot == NULL) {
+			/* All access points were found in the ongoing scan, replace the
+			 * weakest one if the new one is stronger.
+			 */
+			slot = &scan_wifi_cache[0];
+			for (size_t i = 1; i < scan_wifi_cache_cnt; i++) {
+				if (scan_wifi_cache[i].result.rssi < slot->result.rssi) {
+					slot = &scan_wifi_cache[i];
+				}
+			}
+
+			if (slot->result.rssi >= entry->rssi) {
+				LOG_WRN("Scanning result (mac %02x:%02x:%02x:%02x:%02x:%02x) "
+					"did not fit to result buffer - dropping it",
+					entry->mac[0], entry->mac[1], entry->mac[2],
+					entry->mac[3], entry->mac[4], entry->mac[5]);
+				slot = NULL;
+			}
+		}
+	}
+
+	if (slot != NULL) {
+		slot->result = *entry;
+		slot->seen = now;
+	}
+
+	k_mutex_unlock(&scan_wifi_cache_mutex);
+}
+
+static void scan_wifi_cache_age(int64_t now)
+{
+	size_t cnt = 0;
+
+	for (size_t i = 0; i < scan_wifi_cache_cnt; i++) {
+		if (now - scan_wifi_cache[i].seen <=
+		    CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE_MAX_AGE * MSEC_PER_SEC) {
+			scan_wifi_cache[cnt++] = scan_wifi_cache[i];
+		}
+	}
+
+	scan_wifi_cache_cnt = cnt;
+}
+
+static void scan_wifi_cache_done(void)
+{
+	k_mutex_lock(&scan_wifi_cache_mutex, K_FOREVER);
+	scan_wifi_cache_updated = k_uptime_get();
+	scan_wifi_cache_age(scan_wifi_cache_updated);
+	k_mutex_unlock(&scan_wifi_cache_mutex);
+}
+
+/* Copy the cached access points into the scanning results. Returns whether the
+ * cache is recent enough to be used without a new scan.
+ */
+static bool scan_wifi_cache_get(void)
+{
+	int64_t now = k_uptime_get();
+	bool recent;
+
+	k_mutex_lock(&scan_wifi_cache_mutex, K_FOREVER);
+
+	scan_wifi_cache_age(now);
+
+	for (size_t i = 0; i < scan_wifi_cache_cnt; i++) {
+		scan_results[i] = scan_wifi_cache[i].result;
+	}
+	scan_wifi_info.cnt = scan_wifi_cache_cnt;
+
+	recent = scan_wifi_cache_updated != 0 &&
+		 now - scan_wifi_cache_updated <
+		 CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE_REUSE_TIME * MSEC_PER_SEC;
+
+	k_mutex_unlock(&scan_wifi_cache_mutex);
+
+	return recent;
+}
+#endif /* defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE) */
+
 #if defined(CONFIG_LOCATION_METHOD_WIFI_NET_IF_UPDOWN)
 static int scan_wifi_interface_shutdown(struct net_if *iface)
 {
@@ -145,6 +267,17 @@ void scan_wifi_execute(int32_t timeout, struct k_sem *wifi_scan_ready)
 
 	__ASSERT_NO_MSG(wifi_iface != NULL);
 
+#if defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE)
+	if (scan_wifi_cache_get()) {
+		LOG_DBG("Using %d cached Wi-Fi APs without scanning", scan_wifi_info.cnt);
+		k_sem_give(scan_wifi_ready);
+		scan_wifi_ready = NULL;
+		return;
+	}
+
+	scan_wifi_info.cnt = 0;
+#endif /* defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE) */
+
 #if defined(CONFIG_LOCATION_METHOD_WIFI_NET_IF_UPDOWN)
 	ret = scan_wifi_startup_interface(wifi_iface);
 	if (ret) {
@@ -187,6 +320,11 @@ static void scan_wifi_result_handle(struct net_mgmt_event_callback *cb)
 	const struct wifi_scan_result *entry = (const struct wifi_scan_result *)cb->info;
 	struct wifi_scan_result *current;
 
+	if (IS_ENABLED(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE)) {
+		/* The results are taken from the cache when the scan is done */
+		return;
+	}
+
 	if (scan_wifi_info.cnt < CONFIG_LOCATION_METHOD_WIFI_SCANNING_RESULTS_MAX_CNT) {
 		current = &scan_wifi_info.ap_info[scan_wifi_info.cnt];
 		*current = *entry;
@@ -214,6 +352,9 @@ static void scan_wifi_done_handle(struct net_mgmt_event_callback *cb)
 	if (status->status) {
 		LOG_WRN("Wi-Fi scan request failed (%d)", status->status);
 	} else {
+#if defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE)
+		(void)scan_wifi_cache_get();
+#endif
 		LOG_DBG("Scan request done with %d Wi-Fi APs", scan_wifi_info.cnt);
 	}
 
@@ -229,6 +370,24 @@ void scan_wifi_net_mgmt_event_handler(
 {
 	ARG_UNUSED(iface);
 
+#if defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE)
+	/* The cache is updated with the results of every scan, so that the results
+	 * of scans requested by other users are used too.
+	 */
+	switch (mgmt_event) {
+	case NET_EVENT_WIFI_SCAN_RESULT:
+		scan_wifi_cache_update((const struct wifi_scan_result *)cb->info);
+		break;
+	case NET_EVENT_WIFI_SCAN_DONE:
+		if (((const struct wifi_status *)cb->info)->status == 0) {
+			scan_wifi_cache_done();
+		}
+		break;
+	default:
+		break;
+	}
+#endif /* defined(CONFIG_LOCATION_METHOD_WIFI_SCANNING_CACHE) */
+
 	if (scan_wifi_ready != NULL) {
 		switch (mgmt_event) {
 		case NET_EVENT_WIFI_SCAN_RESULT:
@@ -57,6 +57,8 @@ LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 
 /* Requested NCELLMEAS params */
 static struct lte_lc_ncellmeas_params ncellmeas_params;
+/* Index of the NCELLMEAS notification values, including <timing_advance_measurement_time>. */
+static struct at_parser_index_entry ncellmeas_index[AT_NCELLMEAS_PARAMS_COUNT_MAX + 1];
 /* Sempahore value 1 means ncellmeas is not ongoing, and 0 means it's ongoing. */
 K_SEM_DEFINE(ncellmeas_idle_sem, 1, 1);
 
@@ -100,6 +102,7 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 			       struct lte_lc_cells_info *cells)
 {
 	struct at_parser parser;
+	struct at_parser_index_entry *index;
 	struct lte_lc_ncell *ncells = NULL;
 	int err, status, tmp_int, len;
 	int16_t tmp_short;
@@ -153,6 +156,17 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 	err = at_parser_init(&parser, at_response);
 	__ASSERT_NO_MSG(err == 0);
 
+	/* The parameters are read in order, index them to avoid tokenizing the response
+	 * from the beginning for each of them.
+	 */
+	index = k_malloc(param_count * sizeof(struct at_parser_index_entry));
+	if (index) {
+		err = at_parser_index_set(&parser, index, param_count);
+		__ASSERT_NO_MSG(err == 0);
+	} else {
+		LOG_DBG("No memory for NCELLMEAS parameter index (continue)");
+	}
+
 	/* Status code */
 	curr_index = AT_NCELLMEAS_STATUS_INDEX;
 	err = at_parser_num_get(&parser, curr_index, &status);
@@ -410,6 +424,8 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 	}
 
 clean_exit:
+	k_free(index);
+
 	return err;
 }
 
@@ -429,6 +445,9 @@ static int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *ce
 	err = at_parser_init(&parser, at_response);
 	__ASSERT_NO_MSG(err == 0);
 
+	err = at_parser_index_set(&parser, ncellmeas_index, ARRAY_SIZE(ncellmeas_index));
+	__ASSERT_NO_MSG(err == 0);
+
 	err = at_parser_cmd_count_get(&parser, &count);
 	if (err) {
 		LOG_ERR("Could not get NCELLMEAS param count, "
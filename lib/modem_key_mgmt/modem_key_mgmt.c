@@ -350,6 +350,54 @@ int modem_key_mgmt_digest(nrf_sec_tag_t sec_tag,
 
 }
 
+int modem_key_mgmt_digest_cmp(nrf_sec_tag_t sec_tag,
+			      enum modem_key_mgmt_cred_type cred_type,
+			      const void *digest)
+{
+	int err;
+	uint8_t stored_digest[MODEM_KEY_MGMT_DIGEST_SIZE];
+
+	if (digest == NULL) {
+		return -EINVAL;
+	}
+
+	err = modem_key_mgmt_digest(sec_tag, cred_type, stored_digest, sizeof(stored_digest));
+	if (err) {
+		return err;
+	}
+
+	if (memcmp(stored_digest, digest, sizeof(stored_digest))) {
+		LOG_DBG("Credential digest mismatch");
+		return 1;
+	}
+
+	return 0;
+}
+
+int modem_key_mgmt_write_if_changed(nrf_sec_tag_t sec_tag,
+				    enum modem_key_mgmt_cred_type cred_type,
+				    const void *buf, size_t len,
+				    const void *digest)
+{
+	int err;
+
+	if (buf == NULL || len == 0 || digest == NULL) {
+		return -EINVAL;
+	}
+
+	err = modem_key_mgmt_digest_cmp(sec_tag, cred_type, digest);
+	if (err == 0) {
+		LOG_DBG("Credential %u, type %d is up to date", sec_tag, cred_type);
+		return 0;
+	}
+
+	if (err != 1 && err != -ENOENT) {
+		return err;
+	}
+
+	return modem_key_mgmt_write(sec_tag, cred_type, buf, len);
+}
+
 int modem_key_mgmt_delete(nrf_sec_tag_t sec_tag,
 			  enum modem_key_mgmt_cred_type cred_type)
 {
@@ -4,16 +4,230 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
 #include "multithreading_lock.h"
 
 static K_MUTEX_DEFINE(mpsl_lock);
 
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS)
+static struct k_spinlock stats_lock;
+static struct multithreading_lock_stats stats;
+static uint32_t hold_start;
+static uint32_t nest_cnt;
+
+static void stats_wait_add(uint32_t start, bool contended, k_tid_t holder, int err)
+{
+	uint32_t wait_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	size_t idx = 0;
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	if (err) {
+		stats.timeouts++;
+		k_spin_unlock(&stats_lock, key);
+		return;
+	}
+
+	stats.acquired++;
+
+	/* The thread already held the lock. */
+	if (nest_cnt++ > 0) {
+		k_spin_unlock(&stats_lock, key);
+		return;
+	}
+
+	stats.holder = k_current_get();
+	hold_start = k_cycle_get_32();
+
+	if (contended) {
+		stats.contended++;
+
+		if (wait_us >= stats.max_wait_us) {
+			stats.max_wait_us = wait_us;
+			stats.max_wait_holder = holder;
+		}
+	}
+
+	while ((wait_us > 0) && (idx < ARRAY_SIZE(stats.wait_hist) - 1)) {
+		wait_us >>= 1;
+		idx++;
+	}
+	stats.wait_hist[idx]++;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+static void stats_release(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	if (--nest_cnt == 0) {
+		uint32_t hold_us = k_cyc_to_us_floor32(k_cycle_get_32() - hold_start);
+
+		if (hold_us >= stats.max_hold_us) {
+			stats.max_hold_us = hold_us;
+			stats.max_hold_thread = stats.holder;
+		}
+
+		stats.holder = NULL;
+	}
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+static k_tid_t holder_get(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+	k_tid_t holder = stats.holder;
+
+	k_spin_unlock(&stats_lock, key);
+
+	return holder;
+}
+
+void multithreading_lock_stats_get(struct multithreading_lock_stats *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	*out = stats;
+	k_spin_unlock(&stats_lock, key);
+}
+
+void multithreading_lock_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+	k_tid_t holder = stats.holder;
+
+	memset(&stats, 0, sizeof(stats));
+
+	/* The hold time of the current holder is still measured. */
+	stats.holder = holder;
+	k_spin_unlock(&stats_lock, key);
+}
+#endif /* defined(CONFIG_MULTITHREADING_LOCK_STATS) */
+
+#if defined(CONFIG_MULTITHREADING_LOCK_SPIN)
+static atomic_t spin_us = ATOMIC_INIT(CONFIG_MULTITHREADING_LOCK_SPIN_MAX_US);
+
+static int spin_lock(void)
+{
+	uint32_t budget = atomic_get(&spin_us);
+	uint32_t budget_cyc = k_us_to_cyc_ceil32(budget);
+	uint32_t start = k_cycle_get_32();
+
+	while ((k_cycle_get_32() - start) < budget_cyc) {
+		if (k_mutex_lock(&mpsl_lock, K_NO_WAIT) == 0) {
+			atomic_set(&spin_us, MIN(2 * budget, CONFIG_MULTITHREADING_LOCK_SPIN_MAX_US));
+			return 0;
+		}
+
+		k_busy_wait(1);
+	}
+
+	/* The critical section was too long, spin shorter next time. */
+	atomic_set(&spin_us, MAX(budget / 2, 1));
+
+	return -EBUSY;
+}
+#endif /* defined(CONFIG_MULTITHREADING_LOCK_SPIN) */
+
 int multithreading_lock_acquire(k_timeout_t timeout)
 {
-	return k_mutex_lock(&mpsl_lock, timeout);
+	int err;
+	bool contended = false;
+	k_tid_t holder = NULL;
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS)
+	uint32_t start = k_cycle_get_32();
+#endif
+
+	if (!IS_ENABLED(CONFIG_MULTITHREADING_LOCK_STATS) &&
+	    !IS_ENABLED(CONFIG_MULTITHREADING_LOCK_SPIN)) {
+		return k_mutex_lock(&mpsl_lock, timeout);
+	}
+
+	err = k_mutex_lock(&mpsl_lock, K_NO_WAIT);
+	if (err && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		contended = true;
+
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS)
+		holder = holder_get();
+#endif
+#if defined(CONFIG_MULTITHREADING_LOCK_SPIN)
+		err = spin_lock();
+#endif
+		if (err) {
+			err = k_mutex_lock(&mpsl_lock, timeout);
+		}
+	}
+
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS)
+	stats_wait_add(start, contended, holder, err);
+#else
+	ARG_UNUSED(contended);
+	ARG_UNUSED(holder);
+#endif
+
+	return err;
 }
 
 void multithreading_lock_release(void)
 {
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS)
+	stats_release();
+#endif
 	k_mutex_unlock(&mpsl_lock);
 }
+
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS_SHELL)
+static const char *thread_name_get(k_tid_t thread)
+{
+	const char *name = thread ? k_thread_name_get(thread) : NULL;
+
+	return name ? name : "";
+}
+
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	struct multithreading_lock_stats s;
+	uint32_t limit = 1;
+
+	multithreading_lock_stats_get(&s);
+
+	shell_print(sh, "Acquired: %u, contended: %u, timeouts: %u", s.acquired, s.contended,
+		    s.timeouts);
+	shell_print(sh, "Holder: %p %s", (void *)s.holder, thread_name_get(s.holder));
+	shell_print(sh, "Max wait: %u us, holder: %p %s", s.max_wait_us, (void *)s.max_wait_holder,
+		    thread_name_get(s.max_wait_holder));
+	shell_print(sh, "Max hold: %u us, thread: %p %s", s.max_hold_us,
+		    (void *)s.max_hold_thread, thread_name_get(s.max_hold_thread));
+
+	for (size_t i = 0; i < ARRAY_SIZE(s.wait_hist); i++) {
+		if (i == ARRAY_SIZE(s.wait_hist) - 1) {
+			shell_print(sh, "  >= %u us: %u", limit / 2, s.wait_hist[i]);
+		} else {
+			shell_print(sh, "  < %u us: %u", limit, s.wait_hist[i]);
+		}
+		limit *= 2;
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	multithreading_lock_stats_reset();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_mt_lock,
+	SHELL_CMD_ARG(stats, NULL, "Show lock contention statistics", cmd_stats, 1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset lock contention statistics", cmd_reset, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(mt_lock, &sub_mt_lock, "Multithreading lock commands", NULL);
+#endif /* defined(CONFIG_MULTITHREADING_LOCK_STATS_SHELL) */
@@ -54,6 +54,42 @@ int multithreading_lock_acquire(k_timeout_t timeout);
  */
 void multithreading_lock_release(void);
 
+#if defined(CONFIG_MULTITHREADING_LOCK_STATS)
+/** Lock contention statistics. */
+struct multithreading_lock_stats {
+	/** Number of successful acquisitions, including the nested ones. */
+	uint32_t acquired;
+	/** Number of acquisitions that had to wait for the lock. */
+	uint32_t contended;
+	/** Number of acquisitions that failed or timed out. */
+	uint32_t timeouts;
+	/** Maximum wait time in microseconds. */
+	uint32_t max_wait_us;
+	/** Thread that held the lock when the maximum wait started. */
+	k_tid_t max_wait_holder;
+	/** Maximum hold time in microseconds. */
+	uint32_t max_hold_us;
+	/** Thread that held the lock for the maximum hold time. */
+	k_tid_t max_hold_thread;
+	/** Thread that holds the lock, NULL if the lock is free. */
+	k_tid_t holder;
+	/** Histogram of the wait times. Bucket n counts the waits
+	 *  shorter than 2^n us, and not counted by the previous bucket.
+	 *  The last bucket counts all longer waits.
+	 */
+	uint32_t wait_hist[CONFIG_MULTITHREADING_LOCK_STATS_BUCKET_COUNT];
+};
+
+/** @brief Get the lock contention statistics.
+ *
+ * @param[out] stats Lock contention statistics.
+ */
+void multithreading_lock_stats_get(struct multithreading_lock_stats *stats);
+
+/** @brief Reset the lock contention statistics. */
+void multithreading_lock_stats_reset(void);
+#endif /* defined(CONFIG_MULTITHREADING_LOCK_STATS) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,7 @@
 
 #include <net/nrf_802154_callbacks_dispatcher.h>
 #include <errno.h>
+#include <string.h>
 #include <nrf_802154.h>
 #include <nrf_802154_types.h>
 #include <zephyr/kernel.h>
@@ -25,6 +26,108 @@ static struct nrf_802154_cb_dispatch_entry *active_entry;
 static struct k_spinlock dispatcher_lock;
 static K_MUTEX_DEFINE(switch_mutex);
 
+#if defined(CONFIG_NRF_802154_CALLBACKS_DISPATCHER_OBSERVERS)
+struct observer_deferred_evt {
+	struct nrf_802154_cb_observer_evt evt;
+	uint8_t psdu[PHR_SIZE + MAX_PACKET_SIZE];
+};
+
+static void observer_deferred_work_handler(struct k_work *work);
+
+K_MSGQ_DEFINE(observer_msgq, sizeof(struct observer_deferred_evt),
+	      CONFIG_NRF_802154_CALLBACKS_DISPATCHER_OBSERVER_QUEUE_SIZE, sizeof(uint32_t));
+static K_WORK_DEFINE(observer_deferred_work, observer_deferred_work_handler);
+static atomic_t observer_dropped_cnt;
+
+/* Events that any direct or deferred observer is interested in. */
+static uint32_t observer_direct_mask;
+static uint32_t observer_deferred_mask;
+
+static void observers_call(const struct nrf_802154_cb_observer_evt *evt, bool deferred)
+{
+	STRUCT_SECTION_FOREACH(nrf_802154_cb_observer, observer)
+	{
+		if ((observer->deferred == deferred) && (observer->evt_mask & BIT(evt->type))) {
+			observer->handler(evt);
+		}
+	}
+}
+
+static void observer_deferred_work_handler(struct k_work *work)
+{
+	struct observer_deferred_evt deferred_evt;
+	atomic_val_t dropped = atomic_clear(&observer_dropped_cnt);
+
+	ARG_UNUSED(work);
+
+	if (dropped > 0) {
+		LOG_WRN("Dropped %ld deferred observer events", (long)dropped);
+	}
+
+	while (!k_msgq_get(&observer_msgq, &deferred_evt, K_NO_WAIT)) {
+		if (deferred_evt.evt.psdu != NULL) {
+			deferred_evt.evt.psdu = deferred_evt.psdu;
+		}
+
+		observers_call(&deferred_evt.evt, true);
+	}
+}
+
+static void observers_defer(const struct nrf_802154_cb_observer_evt *evt)
+{
+	struct observer_deferred_evt deferred_evt;
+
+	deferred_evt.evt = *evt;
+
+	if (evt->psdu != NULL) {
+		/* The frame is copied, because its buffer is owned by the client or the driver. */
+		memcpy(deferred_evt.psdu, evt->psdu,
+		       MIN(evt->psdu[0] + PHR_SIZE, sizeof(deferred_evt.psdu)));
+	}
+
+	if (k_msgq_put(&observer_msgq, &deferred_evt, K_NO_WAIT)) {
+		atomic_inc(&observer_dropped_cnt);
+		return;
+	}
+
+	k_work_submit(&observer_deferred_work);
+}
+
+static void observers_notify(const struct nrf_802154_cb_observer_evt *evt)
+{
+	if (observer_direct_mask & BIT(evt->type)) {
+		observers_call(evt, false);
+	}
+
+	if (observer_deferred_mask & BIT(evt->type)) {
+		observers_defer(evt);
+	}
+}
+
+static void observers_init(void)
+{
+	STRUCT_SECTION_FOREACH(nrf_802154_cb_observer, observer)
+	{
+		__ASSERT_NO_MSG(observer->handler != NULL);
+
+		if (observer->deferred) {
+			observer_deferred_mask |= observer->evt_mask;
+		} else {
+			observer_direct_mask |= observer->evt_mask;
+		}
+	}
+}
+#else
+static inline void observers_notify(const struct nrf_802154_cb_observer_evt *evt)
+{
+	ARG_UNUSED(evt);
+}
+
+static inline void observers_init(void)
+{
+}
+#endif /* CONFIG_NRF_802154_CALLBACKS_DISPATCHER_OBSERVERS */
+
 static struct nrf_802154_cb_dispatch_entry *entry_lookup(const char *name)
 {
 	STRUCT_SECTION_FOREACH(nrf_802154_cb_dispatch_entry, entry)
@@ -166,6 +269,17 @@ void nrf_802154_received_timestamp_raw(uint8_t *data, int8_t power, uint8_t lqi,
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	/* Observers are notified first, because the client takes ownership of the frame. */
+	observers_notify(&(struct nrf_802154_cb_observer_evt) {
+		.type = NRF_802154_CB_OBSERVER_EVT_RECEIVED,
+		.psdu = data,
+		.received = {
+			.power = power,
+			.lqi = lqi,
+			.time = time,
+		},
+	});
+
 	if (cb != NULL && cb->received_timestamp_raw != NULL) {
 		cb->received_timestamp_raw(data, power, lqi, time);
 	}
@@ -175,6 +289,14 @@ void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	observers_notify(&(struct nrf_802154_cb_observer_evt) {
+		.type = NRF_802154_CB_OBSERVER_EVT_RECEIVE_FAILED,
+		.receive_failed = {
+			.error = error,
+			.id = id,
+		},
+	});
+
 	if (cb != NULL && cb->receive_failed != NULL) {
 		cb->receive_failed(error, id);
 	}
@@ -193,6 +315,11 @@ void nrf_802154_transmitted_raw(uint8_t *frame, const nrf_802154_transmit_done_m
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	observers_notify(&(struct nrf_802154_cb_observer_evt) {
+		.type = NRF_802154_CB_OBSERVER_EVT_TRANSMITTED,
+		.psdu = frame,
+	});
+
 	if (cb != NULL && cb->transmitted_raw != NULL) {
 		cb->transmitted_raw(frame, metadata);
 	}
@@ -203,6 +330,14 @@ void nrf_802154_transmit_failed(uint8_t *frame, nrf_802154_tx_error_t error,
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	observers_notify(&(struct nrf_802154_cb_observer_evt) {
+		.type = NRF_802154_CB_OBSERVER_EVT_TRANSMIT_FAILED,
+		.psdu = frame,
+		.transmit_failed = {
+			.error = error,
+		},
+	});
+
 	if (cb != NULL && cb->transmit_failed != NULL) {
 		cb->transmit_failed(frame, error, metadata);
 	}
@@ -212,6 +347,13 @@ void nrf_802154_energy_detected(const nrf_802154_energy_detected_t *result)
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	observers_notify(&(struct nrf_802154_cb_observer_evt) {
+		.type = NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTED,
+		.energy_detected = {
+			.ed_dbm = result->ed_dbm,
+		},
+	});
+
 	if (cb != NULL && cb->energy_detected != NULL) {
 		cb->energy_detected(result);
 	}
@@ -221,6 +363,13 @@ void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	observers_notify(&(struct nrf_802154_cb_observer_evt) {
+		.type = NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTION_FAILED,
+		.energy_detection_failed = {
+			.error = error,
+		},
+	});
+
 	if (cb != NULL && cb->energy_detection_failed != NULL) {
 		cb->energy_detection_failed(error);
 	}
@@ -243,6 +392,7 @@ static int nrf_802154_callbacks_dispatcher_init(void)
 	 * At this point no client is active, so a user must call
 	 * the switch function to activate a client before using the radio.
 	 */
+	observers_init();
 	nrf_802154_init();
 
 	return 0;
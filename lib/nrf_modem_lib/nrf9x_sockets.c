@@ -50,6 +50,7 @@
 static struct nrf_sock_ctx {
 	int nrf_fd; /* nRF socket descriptor. */
 	int zvfs_fd; /* ZVFS socket descriptor. */
+	int type; /* Socket type. */
 	struct k_mutex *lock; /* Mutex associated with the socket. */
 	struct k_poll_signal poll; /* poll() signal. */
 	struct socket_ncs_pollcb pollcb; /* Poll callback (owned by the app). */
@@ -65,7 +66,7 @@ static bool offload_disabled;
 /* TLS offloading disabled only. */
 static bool tls_offload_disabled;
 
-static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd)
+static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd, int type)
 {
 	struct nrf_sock_ctx *ctx = NULL;
 
@@ -76,6 +77,7 @@ static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd)
 			ctx = &offload_ctx[i];
 			ctx->nrf_fd = nrf_fd;
 			ctx->zvfs_fd = zvfs_fd;
+			ctx->type = type;
 			break;
 		}
 	}
@@ -408,7 +410,7 @@ static int nrf9x_socket_offload_accept(void *obj, struct net_sockaddr *addr,
 		goto error;
 	}
 
-	ctx = allocate_ctx(new_sd, fd);
+	ctx = allocate_ctx(new_sd, fd, OBJ_TO_CTX(obj)->type);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		goto error;
@@ -779,6 +781,9 @@ static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct net_msghdr *
 	ssize_t ret;
 	ssize_t offset;
 	int i;
+	int iov_count = 0;
+	const struct net_iovec *iov = NULL;
+	uint8_t *dgram_buf;
 	static K_MUTEX_DEFINE(sendmsg_lock);
 	static uint8_t buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE];
 
@@ -787,14 +792,35 @@ static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct net_msghdr *
 		return -1;
 	}
 
-	/* Try to reduce number of `sendto` calls - copy data if they fit into
-	 * a single buffer
-	 */
-
 	for (i = 0; i < msg->msg_iovlen; i++) {
 		len += msg->msg_iov[i].iov_len;
+		if (msg->msg_iov[i].iov_len > 0) {
+			iov = &msg->msg_iov[i];
+			iov_count++;
+		}
 	}
 
+	/* A single buffer can be sent as is, without copying it */
+	if (iov_count == 1) {
+		offset = 0;
+		ret = 0;
+		while ((offset < iov->iov_len) && (ret >= 0)) {
+			ret = nrf9x_socket_offload_sendto(obj,
+				(((uint8_t *)iov->iov_base) + offset),
+				(iov->iov_len - offset), flags,
+				msg->msg_name, msg->msg_namelen);
+			if (ret > 0) {
+				offset += ret;
+			}
+		}
+
+		return (ret < 0) ? ret : offset;
+	}
+
+	/* Try to reduce number of `sendto` calls - copy data if they fit into
+	 * a single buffer
+	 */
+
 	if (len <= sizeof(buf)) {
 		/* Protect `buf` access with a mutex. */
 		k_mutex_lock(&sendmsg_lock, K_FOREVER);
@@ -821,6 +847,32 @@ static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct net_msghdr *
 		return ret;
 	}
 
+	/* Each `sendto` call on a datagram socket sends a separate datagram,
+	 * so the message must be sent in a single call. Repack it into a
+	 * temporary buffer.
+	 */
+	if (OBJ_TO_CTX(obj)->type != NET_SOCK_STREAM) {
+		dgram_buf = k_malloc(len);
+		if (dgram_buf == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		len = 0;
+
+		for (i = 0; i < msg->msg_iovlen; i++) {
+			memcpy(dgram_buf + len, msg->msg_iov[i].iov_base,
+			       msg->msg_iov[i].iov_len);
+			len += msg->msg_iov[i].iov_len;
+		}
+
+		ret = nrf9x_socket_offload_sendto(obj, dgram_buf, len, flags,
+						  msg->msg_name, msg->msg_namelen);
+
+		k_free(dgram_buf);
+		return ret;
+	}
+
 	/* If the data won't fit into intermediate buffer, send the buffers
 	 * separately
 	 */
@@ -1193,7 +1245,7 @@ static int nrf9x_socket_create(int family, int type, int proto)
 		return -1;
 	}
 
-	ctx = allocate_ctx(sd, fd);
+	ctx = allocate_ctx(sd, fd, type);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		nrf_close(sd);
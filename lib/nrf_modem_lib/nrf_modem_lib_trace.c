@@ -7,6 +7,7 @@
 #include <sys/types.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
 #include <modem/nrf_modem_lib.h>
 #include <modem/nrf_modem_lib_trace.h>
 #include <modem/trace_backend.h>
@@ -77,11 +78,192 @@ static void backend_suspend_handle(struct k_work *item)
 }
 
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_COMPRESSION
+/* Each block of trace data is written as a self-contained LZ4 frame, so that the output
+ * can be decompressed with standard tools (`lz4 -d`) even if parts of it are lost.
+ * The frame descriptor is fixed: version 1, independent blocks, no checksums,
+ * 64 KB maximum block size. The last byte is the precomputed header checksum.
+ */
+#define LZ4_FRAME_HEADER { 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82 }
+#define LZ4_FRAME_HEADER_LEN 7
+#define LZ4_BLOCK_SIZE_LEN 4
+#define LZ4_END_MARK_LEN 4
+#define LZ4_BLOCK_UNCOMPRESSED BIT(31)
+#define LZ4_FRAME_OVERHEAD (LZ4_FRAME_HEADER_LEN + LZ4_BLOCK_SIZE_LEN + LZ4_END_MARK_LEN)
+
+/* Minimum match length, and the end-of-block restrictions of the LZ4 block format. */
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5
+#define LZ4_MF_LIMIT 12
+
+#define LZ4_HASH_BITS 10
+
+#define COMPRESS_BLOCK_SIZE CONFIG_NRF_MODEM_LIB_TRACE_COMPRESSION_BLOCK_SIZE
+
+/* Positions within a block are stored as 16-bit values. */
+BUILD_ASSERT(COMPRESS_BLOCK_SIZE <= UINT16_MAX);
+
+static struct {
+	/* Hash table of recent positions in the current block. Entries left over from
+	 * previous blocks are harmless, as each candidate match is verified.
+	 */
+	uint16_t table[1 << LZ4_HASH_BITS];
+	/* Compressed frame that is being written to the backend. */
+	uint8_t out[LZ4_FRAME_OVERHEAD + COMPRESS_BLOCK_SIZE];
+	/* Length of the compressed frame, zero if there is none pending. */
+	size_t out_len;
+	/* Bytes of the compressed frame that have been written to the backend. */
+	size_t out_off;
+	/* Trace data bytes contained in the compressed frame. */
+	size_t raw_len;
+} compress;
+
+static inline uint32_t lz4_hash(const uint8_t *p)
+{
+	return (sys_get_le32(p) * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+static uint8_t *lz4_len_put(uint8_t *op, size_t len)
+{
+	for (; len >= 255; len -= 255) {
+		*op++ = 255;
+	}
+	*op++ = len;
+
+	return op;
+}
+
+/* Worst-case size of a sequence with the given number of literals, excluding the match. */
+static inline size_t lz4_seq_bound(size_t lit)
+{
+	return 1 + lit + lit / 255 + 1;
+}
+
+/* Compress @p len bytes from @p src into an LZ4 block.
+ * Returns the size of the block, or zero if it would not be smaller than @p cap.
+ */
+static size_t lz4_block_compress(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+	const uint8_t *ip = src;
+	const uint8_t *anchor = src;
+	const uint8_t *const end = src + len;
+	const uint8_t *const match_limit = end - LZ4_LAST_LITERALS;
+	uint8_t *op = dst;
+	uint8_t *const oend = dst + cap;
+	uint8_t *token;
+	size_t lit;
+
+	while (len > LZ4_MF_LIMIT && ip < end - LZ4_MF_LIMIT) {
+		const uint32_t h = lz4_hash(ip);
+		const uint8_t *ref = src + compress.table[h];
+		size_t match_len = LZ4_MIN_MATCH;
+
+		compress.table[h] = ip - src;
+
+		if (ref >= ip || sys_get_le32(ref) != sys_get_le32(ip)) {
+			ip++;
+			continue;
+		}
+
+		while (ip + match_len < match_limit && ip[match_len] == ref[match_len]) {
+			match_len++;
+		}
+
+		lit = ip - anchor;
+		if ((size_t)(oend - op) < lz4_seq_bound(lit) + 2 + (match_len - LZ4_MIN_MATCH) / 255 + 1) {
+			return 0;
+		}
+
+		token = op++;
+		if (lit >= 15) {
+			*token = 15 << 4;
+			op = lz4_len_put(op, lit - 15);
+		} else {
+			*token = lit << 4;
+		}
+		memcpy(op, anchor, lit);
+		op += lit;
+
+		sys_put_le16(ip - ref, op);
+		op += 2;
+
+		if (match_len - LZ4_MIN_MATCH >= 15) {
+			*token |= 15;
+			op = lz4_len_put(op, match_len - LZ4_MIN_MATCH - 15);
+		} else {
+			*token |= match_len - LZ4_MIN_MATCH;
+		}
+
+		ip += match_len;
+		anchor = ip;
+	}
+
+	/* The block always ends with a literals-only sequence. */
+	lit = end - anchor;
+	if ((size_t)(oend - op) < lz4_seq_bound(lit)) {
+		return 0;
+	}
+
+	token = op++;
+	if (lit >= 15) {
+		*token = 15 << 4;
+		op = lz4_len_put(op, lit - 15);
+	} else {
+		*token = lit << 4;
+	}
+	memcpy(op, anchor, lit);
+	op += lit;
+
+	return ((size_t)(op - dst) < len) ? op - dst : 0;
+}
+
+/* Compress @p len bytes of trace data into an LZ4 frame in the output buffer. */
+static void trace_compress(const uint8_t *data, size_t len)
+{
+	static const uint8_t header[] = LZ4_FRAME_HEADER;
+	uint8_t *block = compress.out + LZ4_FRAME_HEADER_LEN + LZ4_BLOCK_SIZE_LEN;
+	size_t block_len;
+
+	memcpy(compress.out, header, sizeof(header));
+
+	block_len = lz4_block_compress(data, len, block, len);
+	if (block_len) {
+		sys_put_le32(block_len, compress.out + LZ4_FRAME_HEADER_LEN);
+	} else {
+		/* Not compressible, store the data as is. */
+		block_len = len;
+		memcpy(block, data, len);
+		sys_put_le32(block_len | LZ4_BLOCK_UNCOMPRESSED, compress.out + LZ4_FRAME_HEADER_LEN);
+	}
+
+	sys_put_le32(0, block + block_len);
+
+	compress.out_len = LZ4_FRAME_OVERHEAD + block_len;
+	compress.out_off = 0;
+	compress.raw_len = len;
+}
+
+/* The backend reports the compressed bytes it has processed. The trace data is marked as
+ * processed once the whole frame containing it has been written, see trace_fragment_compress_write().
+ */
+static int trace_compress_processed(size_t len)
+{
+	ARG_UNUSED(len);
+
+	return 0;
+}
+
+#define TRACE_PROCESSED_CB trace_compress_processed
+#else
+#define TRACE_PROCESSED_CB nrf_modem_trace_processed
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_COMPRESSION */
+
 #if CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE
 static uint32_t backend_bps_avg;
 static uint32_t backend_bps_tot;
 static uint32_t backend_bps_samples;
-static int64_t backend_measurement_start;
+/* Samples can be reported by the backend from interrupt context. */
+static struct k_spinlock backend_bps_lock;
 
 #define BACKEND_BPS_AVG_UPDATE_PERIOD K_MSEC(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_PERIOD_MS)
 
@@ -93,8 +275,16 @@ static void backend_bps_reset(void)
 
 static void backend_bps_update(int bps)
 {
-	backend_bps_tot += bps;
-	backend_bps_samples++;
+#if CONFIG_NRF_MODEM_LIB_TRACE_COMPRESSION
+	/* Report the rate at which trace data is consumed, not the rate of compressed data. */
+	if (compress.out_len) {
+		bps = (uint64_t)bps * compress.raw_len / compress.out_len;
+	}
+#endif
+	K_SPINLOCK(&backend_bps_lock) {
+		backend_bps_tot += bps;
+		backend_bps_samples++;
+	}
 }
 
 static void backend_bps_avg_update(struct k_work *item);
@@ -103,14 +293,16 @@ K_WORK_DELAYABLE_DEFINE(backend_bps_avg_update_work, backend_bps_avg_update);
 
 static void backend_bps_avg_update(struct k_work *item)
 {
-	if (backend_bps_samples != 0) {
-		backend_bps_avg = backend_bps_tot / backend_bps_samples;
-	} else {
-		/* With 0 samples the average is 0 */
-		backend_bps_avg = 0;
-	}
+	K_SPINLOCK(&backend_bps_lock) {
+		if (backend_bps_samples != 0) {
+			backend_bps_avg = backend_bps_tot / backend_bps_samples;
+		} else {
+			/* With 0 samples the average is 0 */
+			backend_bps_avg = 0;
+		}
 
-	backend_bps_reset();
+		backend_bps_reset();
+	}
 
 	k_work_schedule(&backend_bps_avg_update_work, BACKEND_BPS_AVG_UPDATE_PERIOD);
 }
@@ -120,6 +312,22 @@ uint32_t nrf_modem_lib_trace_backend_bitrate_get(void)
 	return backend_bps_avg;
 }
 
+void trace_backend_bitrate_report(size_t len, int64_t ticks)
+{
+	if (len > 0 && ticks > 0) {
+		backend_bps_update((uint64_t)len * 8 * CONFIG_SYS_CLOCK_TICKS_PER_SEC / ticks);
+	}
+}
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_REPORTED
+/* The backend reports the bitrate of its transfers, the duration of a write is not
+ * representative as it can return before the trace data is transferred.
+ */
+#define PERF_START(...)
+#define PERF_END(...)
+#else
+static int64_t backend_measurement_start;
+
 static void trace_backend_bitrate_perf_start(void)
 {
 	backend_measurement_start = k_uptime_ticks();
@@ -140,6 +348,7 @@ static void trace_backend_bitrate_perf_end(int size)
 
 #define PERF_START trace_backend_bitrate_perf_start
 #define PERF_END(size) trace_backend_bitrate_perf_end(size)
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_REPORTED */
 #else
 #define PERF_START(...)
 #define PERF_END(...)
@@ -279,6 +488,51 @@ static int trace_fragment_write(struct nrf_modem_trace_data *frag)
 	return 0;
 }
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_COMPRESSION
+static int trace_fragment_compress_write(struct nrf_modem_trace_data *frag)
+{
+	int err;
+	struct nrf_modem_trace_data out;
+
+	while (frag->len) {
+		/* A pending frame is left over from a previous attempt that failed. */
+		if (!compress.out_len) {
+			trace_compress(frag->data, MIN(frag->len, COMPRESS_BLOCK_SIZE));
+		}
+
+		out.data = compress.out + compress.out_off;
+		out.len = compress.out_len - compress.out_off;
+
+		err = trace_fragment_write(&out);
+
+		compress.out_off = compress.out_len - out.len;
+
+		if (err) {
+			if (err == -ENOSPC) {
+				/* Write the whole frame again once the backend is cleared. */
+				compress.out_off = 0;
+			}
+			return err;
+		}
+
+		err = nrf_modem_trace_processed(compress.raw_len);
+		if (err) {
+			LOG_ERR("nrf_modem_trace_processed failed with err: %d", err);
+		}
+
+		frag->data = (void *)((uint8_t *)frag->data + compress.raw_len);
+		frag->len -= compress.raw_len;
+		compress.out_len = 0;
+	}
+
+	return 0;
+}
+
+#define TRACE_FRAGMENT_WRITE trace_fragment_compress_write
+#else
+#define TRACE_FRAGMENT_WRITE trace_fragment_write
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_COMPRESSION */
+
 void trace_thread_handler(void)
 {
 	int err;
@@ -332,7 +586,7 @@ trace_reset:
 
 		for (int i = 0; i < n_frags; i++) {
 retry:
-			err = trace_fragment_write(&frags[i]);
+			err = TRACE_FRAGMENT_WRITE(&frags[i]);
 			switch (err) {
 			case 0:
 				break;
@@ -393,7 +647,7 @@ static int trace_init(void)
 
 	k_sem_take(&trace_done_sem, K_FOREVER);
 
-	err = trace_backend.init(nrf_modem_trace_processed);
+	err = trace_backend.init(TRACE_PROCESSED_CB);
 	if (err) {
 		LOG_ERR("trace_backend: init failed with err: %d", err);
 		return err;
@@ -448,6 +702,10 @@ static int trace_deinit(void)
 		return err;
 	}
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_COMPRESSION
+	/* Any pending frame belongs to trace data that is dropped. */
+	compress.out_len = 0;
+#endif
 
 #if CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE
 	k_work_cancel_delayable(&backend_bps_avg_update_work);
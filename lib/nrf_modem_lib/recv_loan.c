@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <modem/nrf_modem_lib.h>
+
+/* The Modem library copies received data out of the shared memory in nrf_recvfrom(),
+ * so the data is received directly into the loaned buffer, and no further copy is needed
+ * by the application to keep the data while processing it.
+ */
+BUILD_ASSERT(CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_SIZE % sizeof(void *) == 0,
+	     "Loaned buffer size must be a multiple of the pointer size");
+
+K_MEM_SLAB_DEFINE_STATIC(recv_loan_slab, CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_SIZE,
+			 CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_COUNT, sizeof(void *));
+
+ssize_t nrf_modem_lib_recv_loan(int fd, const void **data, int flags)
+{
+	void *buf;
+	ssize_t len;
+
+	if (data == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*data = NULL;
+
+	if (k_mem_slab_alloc(&recv_loan_slab, &buf, K_NO_WAIT)) {
+		errno = ENOBUFS;
+		return -1;
+	}
+
+	len = zsock_recv(fd, buf, CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_SIZE, flags);
+	if (len <= 0) {
+		k_mem_slab_free(&recv_loan_slab, buf);
+		return len;
+	}
+
+	*data = buf;
+
+	return len;
+}
+
+void nrf_modem_lib_recv_loan_release(const void *data)
+{
+	if (data == NULL) {
+		return;
+	}
+
+	k_mem_slab_free(&recv_loan_slab, (void *)data);
+}
@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <sys/errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/logging/log.h>
+#include <modem/nrf_modem_lib_trace.h>
+#include <modem/trace_backend.h>
+
+LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
+
+#define CHUNK_SIZE CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_CHUNK_SIZE
+#define STACK_SIZE CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_STACK_SIZE
+#define FLUSH_TIMEOUT_MS CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_FLUSH_TIMEOUT_MS
+#define SUSPEND_DELAY K_MSEC(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_SUSPEND_DELAY_MS)
+
+#define THREAD_PRIORITY                                                                            \
+	COND_CODE_1(CONFIG_NRF_MODEM_LIB_TRACE_THREAD_PRIO_OVERRIDE,                               \
+		    (CONFIG_NRF_MODEM_LIB_TRACE_THREAD_PRIO), (K_LOWEST_APPLICATION_THREAD_PRIO))
+
+/* A backend written from a queue, by its own thread. */
+struct fanout_sink {
+	const char *name;
+	struct nrf_modem_lib_trace_backend *backend;
+	struct ring_buf *queue;
+	k_thread_stack_t *stack;
+	/* Maximum rate in bytes per second, or zero if unlimited. */
+	uint32_t rate_limit;
+	bool drop_oldest;
+
+	/* Protects the queue and the state below. */
+	struct k_mutex lock;
+	/* Serializes the calls to the backend. */
+	struct k_mutex io;
+	/* Given when trace data is queued. */
+	struct k_sem queued;
+	struct k_thread thread;
+
+	bool active;
+	bool full;
+	bool suspended;
+	size_t dropped;
+
+	/* Rate limiter state, used by the sink thread only. */
+	uint32_t tokens;
+	int64_t tokens_time;
+
+	uint8_t chunk[CHUNK_SIZE];
+};
+
+#define FANOUT_SINK_DEFINE(_name, _NAME)                                                           \
+	extern struct nrf_modem_lib_trace_backend trace_backend_##_name;                          \
+	RING_BUF_DECLARE(fanout_##_name##_queue,                                                   \
+			 CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_##_NAME##_QUEUE_SIZE);                  \
+	static K_THREAD_STACK_DEFINE(fanout_##_name##_stack, STACK_SIZE);                          \
+	static struct fanout_sink fanout_##_name##_sink = {                                        \
+		.name = STRINGIFY(_name),                                                          \
+		.backend = &trace_backend_##_name,                                                 \
+		.queue = &fanout_##_name##_queue,                                                  \
+		.stack = fanout_##_name##_stack,                                                   \
+		.rate_limit = CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_##_NAME##_RATE_LIMIT,              \
+		.drop_oldest = IS_ENABLED(CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_##_NAME##_DROP_OLDEST), \
+	}
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_UART
+FANOUT_SINK_DEFINE(uart, UART);
+#endif
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_FLASH
+FANOUT_SINK_DEFINE(flash, FLASH);
+#endif
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RTT
+FANOUT_SINK_DEFINE(rtt, RTT);
+#endif
+
+static struct fanout_sink *const sinks[] = {
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_UART
+	&fanout_uart_sink,
+#endif
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_FLASH
+	&fanout_flash_sink,
+#endif
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RTT
+	&fanout_rtt_sink,
+#endif
+};
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RAM
+extern struct nrf_modem_lib_trace_backend trace_backend_ram;
+#endif
+
+static trace_backend_processed_cb trace_processed_callback;
+static bool sinks_started;
+
+/* The trace data is marked as processed once it has been written to the RAM backend and
+ * queued for the other backends, so the backends do not report processed data themselves.
+ */
+static int backend_processed(size_t len)
+{
+	ARG_UNUSED(len);
+
+	return 0;
+}
+
+static void sink_put(struct fanout_sink *sink, const uint8_t *data, size_t len)
+{
+	uint32_t space;
+	uint32_t capacity;
+	size_t dropped = 0;
+
+	k_mutex_lock(&sink->lock, K_FOREVER);
+
+	if (!sink->active || sink->full) {
+		k_mutex_unlock(&sink->lock);
+		return;
+	}
+
+	space = ring_buf_space_get(sink->queue);
+
+	if (len > space) {
+		if (sink->drop_oldest) {
+			capacity = ring_buf_capacity_get(sink->queue);
+			if (len > capacity) {
+				/* Only the most recent data fits in the queue. */
+				dropped = len - capacity;
+				data += dropped;
+				len = capacity;
+			}
+
+			dropped += ring_buf_get(sink->queue, NULL, len - space);
+		} else {
+			dropped = len - space;
+			len = space;
+		}
+	}
+
+	ring_buf_put(sink->queue, data, len);
+	sink->dropped += dropped;
+
+	k_mutex_unlock(&sink->lock);
+
+	k_sem_give(&sink->queued);
+}
+
+/* Wait until @p len bytes may be written to the backend within its rate limit. */
+static void sink_rate_limit_wait(struct fanout_sink *sink, size_t len)
+{
+	const uint32_t burst = MAX(CHUNK_SIZE, sink->rate_limit / 10);
+	int64_t now;
+	uint64_t refill;
+
+	if (!sink->rate_limit) {
+		return;
+	}
+
+	while (true) {
+		now = k_uptime_get();
+		refill = (uint64_t)(now - sink->tokens_time) * sink->rate_limit / MSEC_PER_SEC;
+		if (refill) {
+			sink->tokens = MIN(sink->tokens + refill, burst);
+			sink->tokens_time = now;
+		}
+
+		if (sink->tokens >= len) {
+			sink->tokens -= len;
+			return;
+		}
+
+		k_sleep(K_MSEC(DIV_ROUND_UP((len - sink->tokens) * MSEC_PER_SEC, sink->rate_limit)));
+	}
+}
+
+/* Write a chunk to the backend. The io mutex must be held. */
+static void sink_write(struct fanout_sink *sink, size_t len)
+{
+	int ret;
+	size_t written = 0;
+
+	while (written < len && sink->active) {
+		ret = sink->backend->write(&sink->chunk[written], len - written);
+		if (ret == -EAGAIN) {
+			k_yield();
+			continue;
+		}
+
+		if (ret == -ENOSPC) {
+			LOG_WRN("Trace backend %s is full", sink->name);
+
+			k_mutex_lock(&sink->lock, K_FOREVER);
+			sink->full = true;
+			ring_buf_reset(sink->queue);
+			k_mutex_unlock(&sink->lock);
+
+			nrf_modem_lib_trace_callback(NRF_MODEM_LIB_TRACE_EVT_FULL);
+			break;
+		}
+
+		if (ret < 0) {
+			/* Drop the chunk, the backend might recover for the next one. */
+			LOG_ERR("Trace backend %s write failed, err %d", sink->name, ret);
+			break;
+		}
+
+		written += ret;
+	}
+}
+
+static void sink_drain(struct fanout_sink *sink)
+{
+	uint32_t len;
+	size_t dropped;
+
+	while (true) {
+		k_mutex_lock(&sink->lock, K_FOREVER);
+		len = MIN(ring_buf_size_get(sink->queue), CHUNK_SIZE);
+		k_mutex_unlock(&sink->lock);
+
+		if (!len) {
+			return;
+		}
+
+		sink_rate_limit_wait(sink, len);
+
+		/* Keep the backend locked until the chunk is written, so that deinit does not
+		 * complete while queued trace data is in flight.
+		 */
+		k_mutex_lock(&sink->io, K_FOREVER);
+
+		/* The queue might have been reset while waiting. */
+		k_mutex_lock(&sink->lock, K_FOREVER);
+		len = ring_buf_get(sink->queue, sink->chunk, len);
+		dropped = sink->dropped;
+		sink->dropped = 0;
+		k_mutex_unlock(&sink->lock);
+
+		if (dropped) {
+			LOG_WRN("Trace backend %s dropped %zu bytes", sink->name, dropped);
+		}
+
+		sink_write(sink, len);
+
+		k_mutex_unlock(&sink->io);
+	}
+}
+
+static void sink_suspend(struct fanout_sink *sink)
+{
+	int err;
+
+	k_mutex_lock(&sink->io, K_FOREVER);
+	if (sink->active && !sink->suspended) {
+		err = sink->backend->suspend();
+		if (err) {
+			LOG_ERR("Could not suspend trace backend %s", sink->name);
+		}
+		sink->suspended = true;
+	}
+	k_mutex_unlock(&sink->io);
+}
+
+static void sink_resume(struct fanout_sink *sink)
+{
+	int err;
+
+	k_mutex_lock(&sink->io, K_FOREVER);
+	if (sink->suspended) {
+		err = sink->backend->resume();
+		if (err) {
+			LOG_ERR("Could not resume trace backend %s", sink->name);
+		}
+		sink->suspended = false;
+	}
+	k_mutex_unlock(&sink->io);
+}
+
+static void sink_thread(void *p1, void *p2, void *p3)
+{
+	struct fanout_sink *sink = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		if (sink->backend->suspend && sink->backend->resume && !sink->suspended) {
+			/* Suspend the backend when no trace data is queued for a while. */
+			if (k_sem_take(&sink->queued, SUSPEND_DELAY) != 0) {
+				sink_suspend(sink);
+				continue;
+			}
+		} else {
+			k_sem_take(&sink->queued, K_FOREVER);
+		}
+
+		sink_resume(sink);
+		sink_drain(sink);
+	}
+}
+
+static void sink_start(struct fanout_sink *sink)
+{
+	k_tid_t tid;
+
+	k_mutex_init(&sink->lock);
+	k_mutex_init(&sink->io);
+	k_sem_init(&sink->queued, 0, 1);
+
+	tid = k_thread_create(&sink->thread, sink->stack, STACK_SIZE, sink_thread, sink, NULL,
+			      NULL, THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(tid, sink->name);
+}
+
+static int fanout_init(trace_backend_processed_cb trace_processed_cb)
+{
+	int err;
+
+	if (trace_processed_cb == NULL) {
+		return -EFAULT;
+	}
+
+	trace_processed_callback = trace_processed_cb;
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RAM
+	err = trace_backend_ram.init(backend_processed);
+	if (err) {
+		LOG_ERR("Trace backend ram init failed, err %d", err);
+		return err;
+	}
+#endif
+
+	for (size_t i = 0; i < ARRAY_SIZE(sinks); i++) {
+		struct fanout_sink *sink = sinks[i];
+
+		if (!sinks_started) {
+			sink_start(sink);
+		}
+
+		k_mutex_lock(&sink->io, K_FOREVER);
+
+		/* A failing backend does not prevent tracing to the others. */
+		err = sink->backend->init(backend_processed);
+		if (err) {
+			LOG_ERR("Trace backend %s init failed, err %d", sink->name, err);
+		}
+
+		k_mutex_lock(&sink->lock, K_FOREVER);
+		ring_buf_reset(sink->queue);
+		sink->active = (err == 0);
+		sink->full = false;
+		sink->dropped = 0;
+		sink->tokens = 0;
+		sink->tokens_time = k_uptime_get();
+		k_mutex_unlock(&sink->lock);
+
+		k_mutex_unlock(&sink->io);
+	}
+
+	sinks_started = true;
+
+	return 0;
+}
+
+static void sink_flush(struct fanout_sink *sink)
+{
+	const int64_t deadline = k_uptime_get() + FLUSH_TIMEOUT_MS;
+
+	while (!ring_buf_is_empty(sink->queue) && k_uptime_get() < deadline) {
+		k_sem_give(&sink->queued);
+		k_sleep(K_MSEC(10));
+	}
+
+	if (!ring_buf_is_empty(sink->queue)) {
+		LOG_WRN("Trace backend %s dropped %u bytes on deinit", sink->name,
+			ring_buf_size_get(sink->queue));
+	}
+}
+
+static int fanout_deinit(void)
+{
+	int err;
+	int ret = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(sinks); i++) {
+		struct fanout_sink *sink = sinks[i];
+
+		if (!sink->active) {
+			continue;
+		}
+
+		sink_flush(sink);
+
+		k_mutex_lock(&sink->lock, K_FOREVER);
+		sink->active = false;
+		ring_buf_reset(sink->queue);
+		k_mutex_unlock(&sink->lock);
+
+		/* Wait for an ongoing write to complete. */
+		k_mutex_lock(&sink->io, K_FOREVER);
+		if (sink->suspended) {
+			(void)sink->backend->resume();
+			sink->suspended = false;
+		}
+		err = sink->backend->deinit();
+		k_mutex_unlock(&sink->io);
+
+		if (err) {
+			LOG_ERR("Trace backend %s deinit failed, err %d", sink->name, err);
+			ret = err;
+		}
+	}
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RAM
+	err = trace_backend_ram.deinit();
+	if (err) {
+		ret = err;
+	}
+#endif
+
+	return ret;
+}
+
+static int fanout_write(const void *data, size_t len)
+{
+	int err;
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RAM
+	err = trace_backend_ram.write(data, len);
+	if (err < 0) {
+		LOG_ERR("Trace backend ram write failed, err %d", err);
+	}
+#endif
+
+	for (size_t i = 0; i < ARRAY_SIZE(sinks); i++) {
+		sink_put(sinks[i], data, len);
+	}
+
+	err = trace_processed_callback(len);
+	if (err) {
+		LOG_ERR("Trace processed callback failed, err %d", err);
+		return err;
+	}
+
+	return (int)len;
+}
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RAM
+static size_t fanout_data_size(void)
+{
+	return trace_backend_ram.data_size();
+}
+
+static int fanout_read(void *buf, size_t len)
+{
+	return trace_backend_ram.read(buf, len);
+}
+#endif
+
+static int fanout_clear(void)
+{
+	int err;
+	int ret = 0;
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RAM
+	ret = trace_backend_ram.clear();
+#endif
+
+	for (size_t i = 0; i < ARRAY_SIZE(sinks); i++) {
+		struct fanout_sink *sink = sinks[i];
+
+		if (!sink->backend->clear) {
+			continue;
+		}
+
+		k_mutex_lock(&sink->io, K_FOREVER);
+		err = sink->backend->clear();
+		k_mutex_unlock(&sink->io);
+
+		if (err) {
+			LOG_ERR("Trace backend %s clear failed, err %d", sink->name, err);
+			ret = ret ? ret : err;
+			continue;
+		}
+
+		/* Start tracing to the backend again. */
+		k_mutex_lock(&sink->lock, K_FOREVER);
+		sink->full = false;
+		k_mutex_unlock(&sink->lock);
+	}
+
+	return ret;
+}
+
+struct nrf_modem_lib_trace_backend trace_backend = {
+	.init = fanout_init,
+	.deinit = fanout_deinit,
+	.write = fanout_write,
+#if CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RAM
+	.data_size = fanout_data_size,
+	.read = fanout_read,
+#endif
+	.clear = fanout_clear,
+};
@@ -16,7 +16,7 @@
 
 #include <modem/trace_backend.h>
 
-LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
+LOG_MODULE_REGISTER(TRACE_BACKEND_LOG_MODULE(flash), CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 /* Partition offset is implicit in flash_area */
 
@@ -208,7 +208,7 @@ static int trace_flash_erase(void)
 	return err;
 }
 
-int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
+static int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 {
 	int err;
 	const struct flash_parameters *fparam;
@@ -290,7 +290,7 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 	return 0;
 }
 
-size_t trace_backend_data_size(void)
+static size_t trace_backend_data_size(void)
 {
 	/* Ensure we never report more data than the partition can hold */
 	return MIN(backend_state.trace_bytes_unread, modem_trace_area->fa_size);
@@ -324,7 +324,7 @@ static int read_from_offset(void *buf, size_t len)
 	return to_read;
 }
 
-int trace_backend_read(void *buf, size_t len)
+static int trace_backend_read(void *buf, size_t len)
 {
 	int err;
 	size_t ret;
@@ -405,7 +405,7 @@ out:
 	return ret;
 }
 
-int trace_backend_peek_at(size_t offset, void *buf, size_t len)
+static int trace_backend_peek_at(size_t offset, void *buf, size_t len)
 {
 	int err = 0;
 	size_t copied = 0;
@@ -581,7 +581,7 @@ static int stream_write(const void *buf, size_t len)
 	return written_total;
 }
 
-int trace_backend_write(const void *data, size_t len)
+static int trace_backend_write(const void *data, size_t len)
 {
 	int write_ret = stream_write(data, len);
 
@@ -594,7 +594,7 @@ int trace_backend_write(const void *data, size_t len)
 	return write_ret;
 }
 
-int trace_backend_clear(void)
+static int trace_backend_clear(void)
 {
 	int err;
 
@@ -622,7 +622,7 @@ int trace_backend_clear(void)
 	return err;
 }
 
-int trace_backend_deinit(void)
+static int trace_backend_deinit(void)
 {
 	buffer_flush_to_flash();
 	peek_at_cache_invalidate();
@@ -632,7 +632,7 @@ int trace_backend_deinit(void)
 	return 0;
 }
 
-struct nrf_modem_lib_trace_backend trace_backend = {
+struct nrf_modem_lib_trace_backend TRACE_BACKEND_INSTANCE(flash) = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
 	.write = trace_backend_write,
@@ -13,7 +13,7 @@
 #include <zephyr/logging/log.h>
 #include <modem/trace_backend.h>
 
-LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
+LOG_MODULE_REGISTER(TRACE_BACKEND_LOG_MODULE(ram), CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 
 /* Let's put this in noinit, so it can be read out after a crash/reboot. */
@@ -31,7 +31,7 @@ static bool is_initialized(void)
 	return ram_trace_buf_magic == 0xdeadbeed;
 }
 
-int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
+static int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 {
 	if (!is_initialized()) {
 		ram_trace_buf.buffer = _ring_buffer_data_ram_trace_buf;
@@ -43,13 +43,13 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 	return 0;
 }
 
-int trace_backend_deinit(void)
+static int trace_backend_deinit(void)
 {
 	/* nothing happens */
 	return 0;
 }
 
-size_t trace_backend_data_size(void)
+static size_t trace_backend_data_size(void)
 {
 	if (!is_initialized()) {
 		return -EPERM;
@@ -57,7 +57,7 @@ size_t trace_backend_data_size(void)
 	return ring_buf_size_get(&ram_trace_buf);
 }
 
-int trace_backend_read(void *buf, size_t len)
+static int trace_backend_read(void *buf, size_t len)
 {
 	if (!is_initialized()) {
 		return -EPERM;
@@ -65,7 +65,7 @@ int trace_backend_read(void *buf, size_t len)
 	return ring_buf_get(&ram_trace_buf, buf, len);
 }
 
-int trace_backend_write(const void *data, size_t len)
+static int trace_backend_write(const void *data, size_t len)
 {
 	if (!is_initialized()) {
 		return -EPERM;
@@ -89,7 +89,7 @@ int trace_backend_write(const void *data, size_t len)
 	return result;
 }
 
-int trace_backend_clear(void)
+static int trace_backend_clear(void)
 {
 	if (!is_initialized()) {
 		return -EPERM;
@@ -98,7 +98,7 @@ int trace_backend_clear(void)
 	return 0;
 }
 
-struct nrf_modem_lib_trace_backend trace_backend = {
+struct nrf_modem_lib_trace_backend TRACE_BACKEND_INSTANCE(ram) = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
 	.write = trace_backend_write,
@@ -11,14 +11,14 @@
 #include <SEGGER_RTT.h>
 #include <zephyr/kernel.h>
 
-LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
+LOG_MODULE_REGISTER(TRACE_BACKEND_LOG_MODULE(rtt), CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 static int trace_rtt_channel;
 static char rtt_buffer[CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_RTT_BUF_SIZE];
 
 static trace_backend_processed_cb trace_processed_callback;
 
-int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
+static int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 {
 	if (trace_processed_cb == NULL) {
 		return -EFAULT;
@@ -34,12 +34,12 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 	return 0;
 }
 
-int trace_backend_deinit(void)
+static int trace_backend_deinit(void)
 {
 	return 0;
 }
 
-int trace_backend_write(const void *data, size_t len)
+static int trace_backend_write(const void *data, size_t len)
 {
 	int err;
 	int ret;
@@ -77,7 +77,7 @@ int trace_backend_write(const void *data, size_t len)
 	return (int)len;
 }
 
-struct nrf_modem_lib_trace_backend trace_backend = {
+struct nrf_modem_lib_trace_backend TRACE_BACKEND_INSTANCE(rtt) = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
 	.write = trace_backend_write,
@@ -4,36 +4,116 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <modem/trace_backend.h>
 #include <zephyr/pm/device.h>
 
-LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
+LOG_MODULE_REGISTER(TRACE_BACKEND_LOG_MODULE(uart), CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 #define UART_DEVICE_NODE DT_CHOSEN(nordic_modem_trace_uart)
 #define TRACE_UART_BAUD_REQUIRED 1000000
 #define CHUNK_SZ CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_CHUNK_SZ
 
+#define BUF_COUNT CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUF_COUNT
+
 static const struct device *const uart_dev = DEVICE_DT_GET(UART_DEVICE_NODE);
 
 /* Maximum time to wait for a UART transfer to complete before aborting. */
 #define UART_TX_WAIT_TIME_MS 1000
 /* Maximum UART transfer attempts. */
 #define UART_TX_RETRIES 5
+/* Maximum time to wait for a transmit buffer to become available. */
+#define UART_TX_BUF_WAIT K_MSEC(UART_TX_WAIT_TIME_MS * UART_TX_RETRIES)
 
-/* Semaphores used to synchronize UART transfers. */
+/* Serializes writers. */
 static K_SEM_DEFINE(tx_sem, 0, 1);
-static K_SEM_DEFINE(tx_done_sem, 0, 1);
-/* Number of bytes that were transferred successfully in last transmission. */
-static int tx_bytes;
+/* Counts the transmit buffers that are available to be filled. */
+static K_SEM_DEFINE(tx_free_sem, BUF_COUNT, BUF_COUNT);
+
+/* Trace data is copied to a ring of transmit buffers, so that the next buffer can be filled
+ * while the previous one is transmitted by DMA.
+ */
+static uint8_t tx_buf[BUF_COUNT][CHUNK_SZ];
+static size_t tx_buf_len[BUF_COUNT];
+
+/* Protects the transmit state below, which is also updated from the UART callback. */
+static struct k_spinlock tx_lock;
+/* Next buffer to be filled. */
+static uint8_t tx_head;
+/* Buffer that is being transmitted. */
+static uint8_t tx_tail;
+/* Number of filled buffers that are not yet transmitted. */
+static uint8_t tx_pending;
+/* Bytes of the current buffer that are transmitted, in case the transfer was aborted. */
+static size_t tx_offset;
+static uint8_t tx_attempts;
+static bool tx_active;
+static int64_t tx_start_time;
 
 /* Callback to notify the trace library when trace data is processed. */
 static trace_backend_processed_cb trace_processed_callback;
 
 static bool suspended;
 
+/* Start transmitting the buffer at the tail. The transmit lock must be held. */
+static void tx_start(void)
+{
+	int err;
+
+	while (tx_pending) {
+		tx_start_time = k_uptime_ticks();
+
+		err = uart_tx(uart_dev, &tx_buf[tx_tail][tx_offset], tx_buf_len[tx_tail] - tx_offset,
+			      UART_TX_WAIT_TIME_MS * USEC_PER_MSEC);
+		if (!err) {
+			tx_active = true;
+			return;
+		}
+
+		LOG_ERR("UART TX failed, err %d", err);
+
+		/* Drop the buffer. */
+		tx_tail = (tx_tail + 1) % BUF_COUNT;
+		tx_pending--;
+		tx_offset = 0;
+		tx_attempts = 0;
+		k_sem_give(&tx_free_sem);
+	}
+
+	tx_active = false;
+}
+
+static void tx_complete(const struct uart_event_tx *tx, bool aborted)
+{
+	K_SPINLOCK(&tx_lock) {
+#if CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE
+		trace_backend_bitrate_report(tx->len, k_uptime_ticks() - tx_start_time);
+#endif
+		tx_offset += tx->len;
+
+		/* Resume an aborted transfer, unless it has failed too many times. */
+		if (aborted && tx_offset < tx_buf_len[tx_tail] && ++tx_attempts < UART_TX_RETRIES) {
+			tx_start();
+			K_SPINLOCK_BREAK;
+		}
+
+		if (tx_offset < tx_buf_len[tx_tail]) {
+			LOG_WRN("UART TX aborted, dropped %zu bytes", tx_buf_len[tx_tail] - tx_offset);
+		}
+
+		tx_tail = (tx_tail + 1) % BUF_COUNT;
+		tx_pending--;
+		tx_offset = 0;
+		tx_attempts = 0;
+		k_sem_give(&tx_free_sem);
+
+		tx_start();
+	}
+}
+
 static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	ARG_UNUSED(dev);
@@ -41,9 +121,10 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 
 	switch (evt->type) {
 	case UART_TX_DONE:
+		tx_complete(&evt->data.tx, false);
+		break;
 	case UART_TX_ABORTED:
-		tx_bytes = evt->data.tx.len;
-		k_sem_give(&tx_done_sem);
+		tx_complete(&evt->data.tx, true);
 		break;
 	case UART_RX_DISABLED:
 		LOG_DBG("UART RX disabled");
@@ -54,7 +135,28 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 	}
 }
 
-int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
+/* Wait for all the filled buffers to be transmitted. */
+static int tx_flush(void)
+{
+	int err = 0;
+	int taken;
+
+	for (taken = 0; taken < BUF_COUNT; taken++) {
+		err = k_sem_take(&tx_free_sem, UART_TX_BUF_WAIT);
+		if (err) {
+			LOG_ERR("Timed out waiting for UART TX to complete");
+			break;
+		}
+	}
+
+	while (taken--) {
+		k_sem_give(&tx_free_sem);
+	}
+
+	return err;
+}
+
+static int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 {
 	int err;
 	struct uart_config uart_cfg;
@@ -99,41 +201,22 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 	return 0;
 }
 
-int trace_backend_deinit(void)
+static int trace_backend_deinit(void)
 {
-	return 0;
-}
-
-/* Returns the number of bytes written, or negative error. */
-static int uart_send(const uint8_t *data, size_t len)
-{
-	int err;
-
-	for (int i = 0; i < UART_TX_RETRIES; i++) {
-		err = uart_tx(uart_dev, data, len,
-			UART_TX_WAIT_TIME_MS * USEC_PER_MSEC);
-		if (err) {
-			LOG_ERR("UART TX failed, err %d", err);
-			return err;
-		}
-
-		k_sem_take(&tx_done_sem, K_FOREVER);
-
-		if (tx_bytes) {
-			return tx_bytes;
-		}
-	}
+	/* Make sure all trace data is sent before the modem is re-initialized. */
+	(void)tx_flush();
 
 	return 0;
 }
 
-int trace_backend_write(const void *data, size_t len)
+static int trace_backend_write(const void *data, size_t len)
 {
 	int err;
 	int ret;
 
-	uint8_t *buf = (uint8_t *)data;
+	const uint8_t *buf = data;
 	size_t remaining_bytes = len;
+	size_t transfer_len;
 
 	if (suspended) {
 		return -EPERM;
@@ -142,20 +225,27 @@ int trace_backend_write(const void *data, size_t len)
 	k_sem_take(&tx_sem, K_FOREVER);
 
 	while (remaining_bytes) {
-		/* Split buffer into smaller DMA-able chunks */
-		size_t transfer_len = MIN(remaining_bytes, CHUNK_SZ);
-		size_t idx = len - remaining_bytes;
-
-		ret = uart_send(&buf[idx], transfer_len);
-		if (ret < 0) {
-			goto out;
-		} else if (ret == 0) {
+		/* Wait for a buffer, this only blocks when all buffers are being transmitted. */
+		if (k_sem_take(&tx_free_sem, UART_TX_BUF_WAIT)) {
+			LOG_ERR("Timed out waiting for UART TX buffer");
 			break;
 		}
 
-		transfer_len = ret;
+		/* Split buffer into smaller DMA-able chunks */
+		transfer_len = MIN(remaining_bytes, CHUNK_SZ);
 
-		/* Notify that we have processed the trace data, so that the memory can be freed. */
+		memcpy(tx_buf[tx_head], &buf[len - remaining_bytes], transfer_len);
+		tx_buf_len[tx_head] = transfer_len;
+
+		K_SPINLOCK(&tx_lock) {
+			tx_head = (tx_head + 1) % BUF_COUNT;
+			tx_pending++;
+			if (!tx_active) {
+				tx_start();
+			}
+		}
+
+		/* The trace data is copied, so the memory can be freed. */
 		err = trace_processed_callback(transfer_len);
 		if (err) {
 			ret = err;
@@ -176,11 +266,17 @@ out:
 	return ret;
 }
 
-int trace_backend_suspend(void)
+static int trace_backend_suspend(void)
 {
 #if CONFIG_PM_DEVICE
 	int err;
 
+	/* Do not suspend the UART while trace data is being transmitted. */
+	err = tx_flush();
+	if (err) {
+		return err;
+	}
+
 	err = pm_device_action_run(uart_dev, PM_DEVICE_ACTION_SUSPEND);
 	if (err && err != -EALREADY) {
 		LOG_ERR("Backend failed to enter suspended state, err %d\n", err);
@@ -192,7 +288,7 @@ int trace_backend_suspend(void)
 	return 0;
 }
 
-int trace_backend_resume(void)
+static int trace_backend_resume(void)
 {
 #if CONFIG_PM_DEVICE
 	int err;
@@ -209,7 +305,7 @@ int trace_backend_resume(void)
 	return 0;
 }
 
-struct nrf_modem_lib_trace_backend trace_backend = {
+struct nrf_modem_lib_trace_backend TRACE_BACKEND_INSTANCE(uart) = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
 	.write = trace_backend_write,
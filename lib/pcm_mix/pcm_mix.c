@@ -7,6 +7,9 @@
 #include <pcm_mix.h>
 
 #include <zephyr/kernel.h>
+#if defined(CONFIG_PCM_MIX_DSP)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
@@ -23,13 +26,37 @@ static void hard_limiter(int32_t *const pcm)
 	}
 }
 
+#if defined(CONFIG_PCM_MIX_DSP)
+/* Number of samples that can be mixed two at a time with saturating SIMD additions. */
+static uint32_t pcm_mix_dsp_samples(void const *const pcm_a, void const *const pcm_b,
+				    uint32_t samples)
+{
+	if (!IS_ALIGNED(pcm_a, sizeof(uint32_t)) || !IS_ALIGNED(pcm_b, sizeof(uint32_t))) {
+		return 0;
+	}
+
+	return samples & ~1U;
+}
+#endif /* CONFIG_PCM_MIX_DSP */
+
 /* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
 static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
 			      size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
+#if defined(CONFIG_PCM_MIX_DSP)
+	uint32_t *a = (uint32_t *)pcm_a;
+	uint32_t const *b = (uint32_t const *)pcm_b;
+
+	for (; i < pcm_mix_dsp_samples(pcm_a, pcm_b, size_b / 2); i += 2) {
+		*a = __QADD16(*a, *b++);
+		a++;
+	}
+#endif
+
+	for (; i < size_b / 2; i++) {
 		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
 
 		hard_limiter(&res);
@@ -43,12 +70,27 @@ static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
 					    void const *const pcm_b, size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
+
+#if defined(CONFIG_PCM_MIX_DSP)
+	uint32_t *a = (uint32_t *)pcm_a;
+	uint32_t const *b = (uint32_t const *)pcm_b;
+
+	/* Each word of B holds two mono samples, each mixed into both halves of a stereo frame. */
+	for (; i < pcm_mix_dsp_samples(pcm_a, pcm_b, size_b / 2) * 2; i += 4) {
+		*a = __QADD16(*a, __PKHBT(*b, *b, 16));
+		a++;
+		*a = __QADD16(*a, __PKHTB(*b, *b, 16));
+		a++;
+		b++;
+	}
+#endif
 
 	/* Use size_b as this is the length of the mono sample.
 	 * This must be *2 to traverse the stereo sample and /2 since
 	 * the sample is two bytes in size.
 	 */
-	for (uint32_t i = 0; i < size_b; i++) {
+	for (; i < size_b; i++) {
 		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
 
 		hard_limiter(&res);
@@ -62,8 +104,23 @@ static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
 					   void const *const pcm_b, size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
+
+#if defined(CONFIG_PCM_MIX_DSP)
+	uint32_t *a = (uint32_t *)pcm_a;
+	uint32_t const *b = (uint32_t const *)pcm_b;
+
+	/* Add zero to the right channel, which is in the upper half of a stereo frame. */
+	for (; i < pcm_mix_dsp_samples(pcm_a, pcm_b, size_b / 2); i += 2) {
+		*a = __QADD16(*a, *b & 0xFFFF);
+		a++;
+		*a = __QADD16(*a, *b >> 16);
+		a++;
+		b++;
+	}
+#endif
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
+	for (; i < size_b / 2; i++) {
 		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
 
 		hard_limiter(&res);
@@ -77,8 +134,23 @@ static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
 					   void const *const pcm_b, size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
+
+#if defined(CONFIG_PCM_MIX_DSP)
+	uint32_t *a = (uint32_t *)pcm_a;
+	uint32_t const *b = (uint32_t const *)pcm_b;
+
+	/* Add zero to the left channel, which is in the lower half of a stereo frame. */
+	for (; i < pcm_mix_dsp_samples(pcm_a, pcm_b, size_b / 2); i += 2) {
+		*a = __QADD16(*a, *b << 16);
+		a++;
+		*a = __QADD16(*a, *b & 0xFFFF0000);
+		a++;
+		b++;
+	}
+#endif
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
+	for (; i < size_b / 2; i++) {
 		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
 
 		hard_limiter(&res);
@@ -8,6 +8,9 @@
 
 #include <zephyr/kernel.h>
 #include <errno.h>
+#if defined(CONFIG_PSCM_DSP)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pscm, CONFIG_PSCM_LOG_LEVEL);
@@ -128,8 +131,39 @@ int pscm_combine(void const *const input_left, void const *const input_right, si
 	char *pointer_input_left = (char *)input_left;
 	char *pointer_input_right = (char *)input_right;
 	char *pointer_output = (char *)output;
+	uint32_t i = 0;
 
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i++) {
+	if (IS_ALIGNED(input_left, 4) && IS_ALIGNED(input_right, 4) && IS_ALIGNED(output, 4)) {
+		if (bytes_per_sample == sizeof(uint32_t)) {
+			const uint32_t *input_left_32 = (const uint32_t *)input_left;
+			const uint32_t *input_right_32 = (const uint32_t *)input_right;
+			uint32_t *output_32 = (uint32_t *)output;
+
+			for (; i < input_size / sizeof(uint32_t); i++) {
+				*output_32++ = *input_left_32++;
+				*output_32++ = *input_right_32++;
+			}
+		}
+#if defined(CONFIG_PSCM_DSP)
+		else if (bytes_per_sample == sizeof(uint16_t)) {
+			const uint32_t *input_left_32 = (const uint32_t *)input_left;
+			const uint32_t *input_right_32 = (const uint32_t *)input_right;
+			uint32_t *output_32 = (uint32_t *)output;
+
+			/* Pack two samples from each channel into two stereo frames. */
+			for (; i < (input_size / sizeof(uint16_t)) & ~1U; i += 2) {
+				*output_32++ = __PKHBT(*input_left_32, *input_right_32, 16);
+				*output_32++ = __PKHTB(*input_right_32++, *input_left_32++, 16);
+			}
+		}
+#endif
+
+		pointer_input_left += i * bytes_per_sample;
+		pointer_input_right += i * bytes_per_sample;
+		pointer_output += i * bytes_per_sample * 2;
+	}
+
+	for (; i < input_size / bytes_per_sample; i++) {
 		for (uint8_t j = 0; j < bytes_per_sample; j++) {
 			*pointer_output++ = *pointer_input_left++;
 		}
@@ -230,6 +264,31 @@ int pscm_interleave(void const *const input, size_t input_size, uint8_t channel,
 		uint16_t *output_16 = (uint16_t *)output + channel;
 		const uint16_t *input_16_end = input_16 + (input_size / sizeof(uint16_t));
 
+#if defined(CONFIG_PSCM_DSP)
+		if (output_channels == 2) {
+			const uint32_t *input_32 = (const uint32_t *)input;
+			uint32_t *output_32 = (uint32_t *)output;
+			const uint32_t *input_32_end = input_32 + (input_size / sizeof(uint32_t));
+
+			/* Replace one half of two stereo frames, keeping the other channel. */
+			while (input_32 < input_32_end) {
+				if (channel == 0) {
+					output_32[0] = __PKHBT(*input_32, output_32[0], 0);
+					output_32[1] = __PKHTB(output_32[1], *input_32, 16);
+				} else {
+					output_32[0] = __PKHBT(output_32[0], *input_32, 16);
+					output_32[1] = __PKHTB(*input_32, output_32[1], 0);
+				}
+
+				input_32++;
+				output_32 += 2;
+			}
+
+			input_16 = (const uint16_t *)input_32;
+			output_16 = (uint16_t *)output_32 + channel;
+		}
+#endif
+
 		while (input_16 < input_16_end) {
 			*output_16 = *input_16++;
 			output_16 += output_channels;
@@ -287,6 +346,28 @@ int pscm_deinterleave(void const *const input, size_t input_size, uint8_t input_
 		const uint16_t *input_16 = (const uint16_t *)input + channel;
 		uint16_t *output_16_end = output_16 + (bytes_to_copy / sizeof(uint16_t));
 
+#if defined(CONFIG_PSCM_DSP)
+		if (input_channels == 2) {
+			uint32_t *output_32 = (uint32_t *)output;
+			const uint32_t *input_32 = (const uint32_t *)input;
+			uint32_t *output_32_end = output_32 + (bytes_to_copy / sizeof(uint32_t));
+
+			/* Take the same half of two stereo frames. */
+			while (output_32 < output_32_end) {
+				if (channel == 0) {
+					*output_32++ = __PKHBT(input_32[0], input_32[1], 16);
+				} else {
+					*output_32++ = __PKHTB(input_32[1], input_32[0], 16);
+				}
+
+				input_32 += 2;
+			}
+
+			output_16 = (uint16_t *)output_32;
+			input_16 = (const uint16_t *)input_32 + channel;
+		}
+#endif
+
 		while (output_16 < output_16_end) {
 			*output_16++ = *input_16;
 			input_16 += input_channels;
@@ -6,6 +6,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
 #include <qos.h>
 
 #include <zephyr/logging/log.h>
@@ -18,10 +19,21 @@ LOG_MODULE_REGISTER(qos, CONFIG_QOS_LOG_LEVEL);
 #define STATIC static
 #endif
 
-/* Structure used to keep track of pending messages. Used in combination with a linked list. */
+/* Number of buckets in the message ID index. Message IDs are assigned sequentially, so the
+ * pending messages are spread evenly over the buckets.
+ */
+#define INDEX_BUCKETS CONFIG_QOS_PENDING_MESSAGES_MAX
+
+/* Structure used to keep track of pending messages. Used in combination with linked lists. */
 struct qos_metadata {
-	/* Mandatory variable used to construct a linked list. */
-	sys_snode_t header;
+	/* Node in the pending list, or in the free list if the entry is unused. */
+	sys_dnode_t header;
+
+	/* Node in the message ID index. */
+	sys_snode_t index_node;
+
+	/* Uptime in milliseconds at which the message is notified next. */
+	int64_t deadline;
 
 	/* Message associated with each node in the linked list. */
 	struct qos_data message;
@@ -35,8 +47,14 @@ STATIC struct ctx {
 	/* Internal array of pending messages. Used in combination with linked list. */
 	struct qos_metadata list_internal[CONFIG_QOS_PENDING_MESSAGES_MAX];
 
-	/* Linked list used to keep track of pending messages. */
-	sys_slist_t pending_list;
+	/* Linked list of pending messages, ordered by the notify deadline. */
+	sys_dlist_t pending_list;
+
+	/* Linked list of unused entries of the internal array. */
+	sys_dlist_t free_list;
+
+	/* Pending messages hashed by message ID. */
+	sys_slist_t index[INDEX_BUCKETS];
 
 	/* Variable used to prevent multiple library initializations. */
 	bool initialized;
@@ -64,99 +82,126 @@ static void notify_event(struct qos_evt *evt)
 	}
 }
 
+static sys_slist_t *index_bucket_get(uint32_t id)
+{
+	return &ctx.index[id % INDEX_BUCKETS];
+}
+
+/* Schedule the backoff timer for the first message in the pending list. The pending list is
+ * ordered by the notify deadline, because every message is appended with the same timeout.
+ */
+static void timer_schedule(void)
+{
+	struct qos_metadata *node = SYS_DLIST_PEEK_HEAD_CONTAINER(&ctx.pending_list, node,
+								   header);
+	int64_t delay;
+
+	if (node == NULL) {
+		return;
+	}
+
+	delay = MAX(node->deadline - k_uptime_get(), 0);
+
+	k_work_reschedule(&ctx.timeout_handler_work, K_MSEC(delay));
+}
+
+static void node_release(struct qos_metadata *node)
+{
+	struct qos_evt evt = {
+		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
+		.message = node->message,
+	};
+
+	notify_event(&evt);
+
+	sys_slist_find_and_remove(index_bucket_get(node->message.id), &node->index_node);
+	sys_dlist_remove(&node->header);
+	memset(&node->message, 0, sizeof(struct qos_data));
+	sys_dlist_append(&ctx.free_list, &node->header);
+}
+
 STATIC void timeout_handler_work_fn(struct k_work *work)
 {
-	struct qos_metadata *node = NULL, *next_node = NULL;
+	struct qos_metadata *node;
 	struct qos_evt evt = {
-		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST
+		.type = QOS_EVT_MESSAGE_TIMER_EXPIRED
 	};
+	int64_t now = k_uptime_get();
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	/* Remove all messages where the notified_count equals or exceeds
-	 * CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX
+	/* Only the messages at the head of the pending list are due. Notified messages are moved
+	 * to the tail with a new deadline, so the loop ends when it reaches them.
 	 */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	while (true) {
+		node = SYS_DLIST_PEEK_HEAD_CONTAINER(&ctx.pending_list, node, header);
+		if ((node == NULL) || (node->deadline > now)) {
+			break;
+		}
+
+		/* Remove messages where the notified_count equals or exceeds
+		 * CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX
+		 */
 		if (node->message.notified_count >= CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX) {
 			LOG_DBG("Notified count for message ID: %d exceeds the maximum allowed "
 				"value, remove message from pending list.", node->message.id);
-			evt.message = node->message;
-			notify_event(&evt);
-			memset(&node->message, 0, sizeof(struct qos_data));
-			sys_slist_find_and_remove(&ctx.pending_list, &node->header);
+			node_release(node);
+			continue;
 		}
-	};
-
-	/* Don't shedule a new work if the pending list is empty. */
-	if (sys_slist_is_empty(&ctx.pending_list)) {
-		LOG_DBG("QoS list is empty, don't reschedule work");
-		goto exit;
-	}
-
-	/* Notify all remaining entries in the list. */
-	evt.type = QOS_EVT_MESSAGE_TIMER_EXPIRED;
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		node->message.notified_count++;
 		evt.message = node->message;
 		notify_event(&evt);
-	};
 
-	k_work_reschedule(&ctx.timeout_handler_work,
-			  K_SECONDS(CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS));
-exit:
+		node->deadline = now + CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS * MSEC_PER_SEC;
+		sys_dlist_remove(&node->header);
+		sys_dlist_append(&ctx.pending_list, &node->header);
+	}
+
+	/* Don't shedule a new work if the pending list is empty. */
+	if (sys_dlist_is_empty(&ctx.pending_list)) {
+		LOG_DBG("QoS list is empty, don't reschedule work");
+	} else {
+		timer_schedule();
+	}
+
 	k_mutex_unlock(&ctx_lock);
 }
 
 /* @brief Function that appends a message to the internal list of pending messages.
  *
- * @returns A positive value indicating the index of the internal list that the message was
- *	    added to. Otherwise a negative value indicating the reason of failure.
- *
- * @retval -ENOMEM if the internal list is full.
+ * @returns A pointer to the list entry that the message was added to, or NULL if the internal
+ *	    list is full.
  */
-static int list_append(struct qos_data *message)
+static struct qos_metadata *list_append(struct qos_data *message)
 {
-	/* Mark the initial list index as invalid. */
-	int index_next = -1;
-
-	/* Find the next available list index. */
-	for (int i = 0; i < ARRAY_SIZE(ctx.list_internal); i++) {
-		if ((ctx.list_internal[i].message.notified_count == 0) &&
-		    (ctx.list_internal[i].message.data.buf == NULL)) {
-			index_next = i;
-			break;
-		}
-	}
+	struct qos_metadata *node = SYS_DLIST_PEEK_HEAD_CONTAINER(&ctx.free_list, node, header);
 
-	if (index_next == -1) {
+	if (node == NULL) {
 		LOG_ERR("No available entries in pending message list");
-		return -ENOMEM;
+		return NULL;
 	}
 
-	ctx.list_internal[index_next].message = *message;
+	sys_dlist_remove(&node->header);
+
+	node->message = *message;
+	node->deadline = k_uptime_get() + CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS * MSEC_PER_SEC;
 
-	sys_slist_append(&ctx.pending_list, &ctx.list_internal[index_next].header);
-	return index_next;
+	sys_dlist_append(&ctx.pending_list, &node->header);
+	sys_slist_append(index_bucket_get(message->id), &node->index_node);
+
+	return node;
 }
 
 static int list_remove(uint32_t id)
 {
-	struct qos_metadata *node = NULL, *next_node = NULL, *node_prev = NULL;
-	struct qos_evt evt = {
-		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
-	};
+	struct qos_metadata *node;
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	SYS_SLIST_FOR_EACH_CONTAINER(index_bucket_get(id), node, index_node) {
 		if (node->message.id == id) {
-			evt.message = node->message;
-			notify_event(&evt);
-			memset(&node->message, 0, sizeof(struct qos_data));
-			sys_slist_remove(&ctx.pending_list, &node_prev->header, &node->header);
+			node_release(node);
 			return 0;
 		}
-
-		node_prev = node;
 	};
 
 	return -ENODATA;
@@ -185,8 +230,18 @@ int qos_init(qos_evt_handler_t evt_handler)
 	LOG_DBG("Registering handler %p", evt_handler);
 	ctx.app_evt_handler = evt_handler;
 
-	/* Initializing linked list and delayed work. */
-	sys_slist_init(&ctx.pending_list);
+	/* Initializing linked lists and delayed work. */
+	sys_dlist_init(&ctx.pending_list);
+	sys_dlist_init(&ctx.free_list);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctx.list_internal); i++) {
+		sys_dlist_append(&ctx.free_list, &ctx.list_internal[i].header);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctx.index); i++) {
+		sys_slist_init(&ctx.index[i]);
+	}
+
 	k_work_init_delayable(&ctx.timeout_handler_work, timeout_handler_work_fn);
 
 exit:
@@ -196,7 +251,8 @@ exit:
 
 int qos_message_add(struct qos_data *message)
 {
-	int err = 0, ret;
+	int err = 0;
+	struct qos_metadata *node;
 	struct qos_evt evt = {
 		.type = QOS_EVT_MESSAGE_NEW
 	};
@@ -213,9 +269,9 @@ int qos_message_add(struct qos_data *message)
 
 	/* Only ACK_REQUIRED messages are added to the internal list. */
 	if (qos_message_has_flag(message, QOS_FLAG_RELIABILITY_ACK_REQUIRED)) {
-		ret = list_append(message);
-		if (ret < 0) {
-			LOG_WRN("No list entries available, error: %d", ret);
+		node = list_append(message);
+		if (node == NULL) {
+			LOG_WRN("No list entries available");
 			evt.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST;
 			notify_event(&evt);
 			err = -ENOMEM;
@@ -223,8 +279,8 @@ int qos_message_add(struct qos_data *message)
 		}
 
 		/* Increment notified count before the callback. */
-		ctx.list_internal[ret].message.notified_count++;
-		evt.message = ctx.list_internal[ret].message;
+		node->message.notified_count++;
+		evt.message = node->message;
 		notify_event(&evt);
 	} else {
 
@@ -241,9 +297,8 @@ int qos_message_add(struct qos_data *message)
 	 * pending list.
 	 */
 	if (!k_work_delayable_is_pending(&ctx.timeout_handler_work) &&
-	    !sys_slist_is_empty(&ctx.pending_list)) {
-		k_work_reschedule(&ctx.timeout_handler_work,
-				  K_SECONDS(CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS));
+	    !sys_dlist_is_empty(&ctx.pending_list)) {
+		timer_schedule();
 	}
 
 exit:
@@ -264,7 +319,7 @@ int qos_message_remove(uint32_t id)
 	}
 
 	/* If the removed message is the last in the pending list, we stop the internal timer. */
-	if (sys_slist_is_empty(&ctx.pending_list)) {
+	if (sys_dlist_is_empty(&ctx.pending_list)) {
 		LOG_DBG("QoS list is empty, cancel ongoing delayed work");
 		k_work_cancel_delayable(&ctx.timeout_handler_work);
 	}
@@ -309,14 +364,14 @@ uint16_t qos_message_id_get_next(void)
 
 void qos_message_notify_all(void)
 {
-	struct qos_metadata *node = NULL, *next_node = NULL;
+	struct qos_metadata *node = NULL;
 	struct qos_evt evt = {
 		.type = QOS_EVT_MESSAGE_TIMER_EXPIRED,
 	};
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	SYS_DLIST_FOR_EACH_CONTAINER(&ctx.pending_list, node, header) {
 		node->message.notified_count++;
 		evt.message = node->message;
 		notify_event(&evt);
@@ -328,17 +383,11 @@ void qos_message_notify_all(void)
 void qos_message_remove_all(void)
 {
 	struct qos_metadata *node = NULL, *next_node = NULL;
-	struct qos_evt evt = {
-		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
-	};
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
-		evt.message = node->message;
-		notify_event(&evt);
-		memset(&node->message, 0, sizeof(struct qos_data));
-		sys_slist_remove(&ctx.pending_list, NULL, &node->header);
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+		node_release(node);
 	};
 
 	k_mutex_unlock(&ctx_lock);
@@ -9,6 +9,16 @@
 #include <zephyr/sys/util.h>
 #include <zephyr/kernel.h>
 #include <stdint.h>
+#include <string.h>
+#include <ram_pwrdn.h>
+
+#if defined(CONFIG_RAM_POWER_DOWN_ADAPTIVE_IDLE)
+#include <zephyr/pm/pm.h>
+#endif
+
+#if defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+#include <zephyr/sys/sys_heap.h>
+#endif
 
 #if defined(CONFIG_SOC_NRF52840) || defined(CONFIG_SOC_NRF52833)
 #include <hal/nrf_power.h>
@@ -229,3 +239,224 @@ void power_up_unused_ram(void)
 {
 	power_up_ram(RAM_IMAGE_END_ADDR, ram_end_addr());
 }
+
+#if defined(CONFIG_RAM_POWER_DOWN_ADAPTIVE)
+/* Pattern used by CONFIG_INIT_STACKS to fill the thread stacks. */
+#define STACK_FILL_PATTERN 0xaa
+#define STACK_MARGIN CONFIG_RAM_POWER_DOWN_ADAPTIVE_STACK_MARGIN
+
+struct ram_range {
+	uintptr_t start;
+	uintptr_t end;
+	const struct k_thread *thread;
+	bool powered_down;
+};
+
+struct ram_ranges {
+	struct ram_range range[CONFIG_RAM_POWER_DOWN_ADAPTIVE_MAX_RANGES];
+	size_t count;
+};
+
+static struct ram_ranges tracked;
+static struct k_spinlock tracked_lock;
+
+/*
+ * Add the sections of all banks which fully fall within the given address range.
+ */
+static void ram_range_add(struct ram_ranges *ranges, uintptr_t start, uintptr_t end,
+			  const struct k_thread *thread)
+{
+	for (uint8_t bank_id = 0; bank_id < RAM_BANK_COUNT; ++bank_id) {
+		const struct ram_bank *bank = &banks[bank_id];
+		uint8_t section_begin = ram_bank_section_id_ceil(start, bank);
+		uint8_t section_end = ram_bank_section_id_floor(end, bank);
+
+		if (section_begin >= section_end) {
+			continue;
+		}
+
+		if (ranges->count == ARRAY_SIZE(ranges->range)) {
+			LOG_DBG("No space for the RAM range of thread %p", (void *)thread);
+			return;
+		}
+
+		ranges->range[ranges->count++] = (struct ram_range) {
+			.start = bank->start + section_begin * bank->section_size,
+			.end = bank->start + section_end * bank->section_size,
+			.thread = thread,
+		};
+	}
+}
+
+static void thread_stack_check(const struct k_thread *thread, void *user_data)
+{
+	struct ram_ranges *ranges = user_data;
+	size_t unused;
+
+	/* The idle threads enter the power states, so they use their stacks
+	 * while the sections are powered down.
+	 */
+	if (k_thread_priority_get((k_tid_t)thread) == K_IDLE_PRIO) {
+		return;
+	}
+
+	if (k_thread_stack_space_get(thread, &unused) || (unused <= STACK_MARGIN)) {
+		return;
+	}
+
+	/* The stack grows down, so the unused space is at its start. */
+	ram_range_add(ranges, thread->stack_info.start,
+		      thread->stack_info.start + unused - STACK_MARGIN, thread);
+}
+
+size_t ram_pwrdn_adaptive_update(void)
+{
+	struct ram_ranges ranges = {0};
+	size_t size = 0;
+	k_spinlock_key_t key;
+
+	k_thread_foreach(thread_stack_check, &ranges);
+
+	for (size_t i = 0; i < ranges.count; i++) {
+		size += ranges.range[i].end - ranges.range[i].start;
+	}
+
+	key = k_spin_lock(&tracked_lock);
+	tracked = ranges;
+	k_spin_unlock(&tracked_lock, key);
+
+	LOG_DBG("%zu bytes of RAM in %zu ranges not used by thread stacks", size, ranges.count);
+
+	return size;
+}
+
+void ram_pwrdn_adaptive_report(void)
+{
+	struct ram_ranges ranges;
+	k_spinlock_key_t key = k_spin_lock(&tracked_lock);
+
+	ranges = tracked;
+	k_spin_unlock(&tracked_lock, key);
+
+	for (size_t i = 0; i < ranges.count; i++) {
+		const char *name = k_thread_name_get((k_tid_t)ranges.range[i].thread);
+
+		LOG_INF("RAM 0x%08lx-0x%08lx safe, unused stack of thread %p %s",
+			(unsigned long)ranges.range[i].start, (unsigned long)ranges.range[i].end,
+			(void *)ranges.range[i].thread, name ? name : "");
+	}
+
+#if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_SYS_HEAP_ARRAY_SIZE > 0)
+	struct sys_heap **heaps;
+	int heap_cnt = sys_heap_array_get(&heaps);
+
+	for (int i = 0; i < heap_cnt; i++) {
+		struct sys_memory_stats stats;
+
+		if (sys_heap_runtime_stats_get(heaps[i], &stats)) {
+			continue;
+		}
+
+		LOG_INF("Heap %p: max allocated %zu of %zu bytes, not safe", (void *)heaps[i],
+			stats.max_allocated_bytes, stats.allocated_bytes + stats.free_bytes);
+	}
+#endif
+}
+
+#if defined(CONFIG_RAM_POWER_DOWN_ADAPTIVE_IDLE)
+/*
+ * Check that the stack did not grow into the margin above the range since the last update.
+ */
+static bool stack_margin_unused(const struct ram_range *range)
+{
+	const uint8_t *margin = (const uint8_t *)range->end;
+	uintptr_t stack_end = range->thread->stack_info.start + range->thread->stack_info.size;
+
+	for (size_t i = 0; (i < STACK_MARGIN) && ((uintptr_t)&margin[i] < stack_end); i++) {
+		if (margin[i] != STACK_FILL_PATTERN) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void pm_state_entry(enum pm_state state)
+{
+	if ((state == PM_STATE_ACTIVE) || (state == PM_STATE_RUNTIME_IDLE)) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&tracked_lock);
+
+	for (size_t i = 0; i < tracked.count; i++) {
+		struct ram_range *range = &tracked.range[i];
+
+		/* Keep the range powered on if the stack grew towards it. */
+		if (!stack_margin_unused(range)) {
+			continue;
+		}
+
+		power_down_ram(range->start, range->end);
+		range->powered_down = true;
+	}
+
+	k_spin_unlock(&tracked_lock, key);
+}
+
+static void pm_state_exit(enum pm_state state)
+{
+	k_spinlock_key_t key = k_spin_lock(&tracked_lock);
+
+	for (size_t i = 0; i < tracked.count; i++) {
+		struct ram_range *range = &tracked.range[i];
+
+		if (!range->powered_down) {
+			continue;
+		}
+
+		power_up_ram(range->start, range->end);
+
+		/* Restore the fill pattern, so that the stack usage can still be measured. */
+		memset((void *)range->start, STACK_FILL_PATTERN, range->end - range->start);
+		range->powered_down = false;
+	}
+
+	k_spin_unlock(&tracked_lock, key);
+}
+
+static struct pm_notifier notifier = {
+	.state_entry = pm_state_entry,
+	.state_exit = pm_state_exit,
+};
+#endif /* defined(CONFIG_RAM_POWER_DOWN_ADAPTIVE_IDLE) */
+
+#if CONFIG_RAM_POWER_DOWN_ADAPTIVE_UPDATE_INTERVAL > 0
+static void update_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(update_work, update_work_fn);
+
+static void update_work_fn(struct k_work *work)
+{
+	(void)ram_pwrdn_adaptive_update();
+	(void)k_work_reschedule(&update_work,
+				K_SECONDS(CONFIG_RAM_POWER_DOWN_ADAPTIVE_UPDATE_INTERVAL));
+}
+#endif
+
+static int ram_pwrdn_adaptive_init(void)
+{
+#if defined(CONFIG_RAM_POWER_DOWN_ADAPTIVE_IDLE)
+	pm_notifier_register(&notifier);
+#endif
+
+#if CONFIG_RAM_POWER_DOWN_ADAPTIVE_UPDATE_INTERVAL > 0
+	/* The stacks are used during the startup, so the first update is delayed. */
+	(void)k_work_schedule(&update_work,
+			      K_SECONDS(CONFIG_RAM_POWER_DOWN_ADAPTIVE_UPDATE_INTERVAL));
+#endif
+
+	return 0;
+}
+
+SYS_INIT(ram_pwrdn_adaptive_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* defined(CONFIG_RAM_POWER_DOWN_ADAPTIVE) */
@@ -11,6 +11,10 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+#include <dsp/basic_math_functions.h>
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
 
@@ -65,6 +69,176 @@ static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rat
 	return 0;
 }
 
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+/* The fractional conversion keeps its history in the CMSIS DSP state buffer */
+BUILD_ASSERT(CONFIG_SAMPLE_RATE_CONVERTER_MAX_FILTER_SIZE >= SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS,
+	     "Filter size too small for the fractional filter");
+
+#define FRAC_HISTORY_SAMPLES (SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS - 1)
+#define FRAC_ONE	     BIT64(32)
+#define PPM_ONE		     1000000
+
+static int validate_sample_rates_fractional(uint32_t sample_rate_input,
+					    uint32_t sample_rate_output)
+{
+	if ((sample_rate_input == 0) || (sample_rate_output == 0)) {
+		LOG_ERR("Sample rates can not be zero");
+		return -EINVAL;
+	}
+
+	if (((uint64_t)sample_rate_input >
+	     (uint64_t)sample_rate_output * SAMPLE_RATE_CONVERTER_FRACTIONAL_RATIO_MAX) ||
+	    ((uint64_t)sample_rate_output >
+	     (uint64_t)sample_rate_input * SAMPLE_RATE_CONVERTER_FRACTIONAL_RATIO_MAX)) {
+		LOG_ERR("Ratio between %d and %d is not supported", sample_rate_input,
+			sample_rate_output);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static void fractional_step_update(struct sample_rate_converter_ctx *ctx)
+{
+	/* A positive adjustment raises the output rate, which shortens the step */
+	ctx->frac_step = (ctx->frac_step_nominal * PPM_ONE) / (PPM_ONE + ctx->frac_adjust_ppm);
+}
+
+static int fractional_reconfigure(struct sample_rate_converter_ctx *ctx,
+				  uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	int ret;
+
+	ret = validate_sample_rates_fractional(sample_rate_input, sample_rate_output);
+	if (ret) {
+		LOG_ERR("Invalid sample rate given (%d)", ret);
+		return ret;
+	}
+
+	ret = sample_rate_converter_filter_fractional_get(&ctx->frac_filter);
+	if (ret) {
+		LOG_ERR("Failed to get filter (%d)", ret);
+		return ret;
+	}
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->conversion_ratio = 0;
+	ctx->filter_type = SAMPLE_RATE_FILTER_FRACTIONAL;
+	ctx->input_buf.bytes_in_buf = 0;
+
+	ctx->frac_step_nominal = ((uint64_t)sample_rate_input << 32) / sample_rate_output;
+	fractional_step_update(ctx);
+
+	/* Start with a silent history */
+	ctx->frac_pos = 0;
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	memset(ctx->state_buf_15, 0, FRAC_HISTORY_SAMPLES * sizeof(q15_t));
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	memset(ctx->state_buf_31, 0, FRAC_HISTORY_SAMPLES * sizeof(q31_t));
+#endif
+
+	LOG_DBG("Fractional sample rate converter initialized. Input sample rate: %d, Output "
+		"sample rate: %d, adjustment: %d ppm",
+		ctx->sample_rate_input, ctx->sample_rate_output, ctx->frac_adjust_ppm);
+	return 0;
+}
+
+/**
+ * @brief Get the number of output samples the fractional conversion produces.
+ *
+ * @details An output sample is produced for each read position where all filter taps are
+ *	    covered by the history and the new input samples.
+ */
+static size_t fractional_output_samples(struct sample_rate_converter_ctx const *ctx,
+					size_t samples_in)
+{
+	uint64_t limit = (uint64_t)samples_in << 32;
+
+	if (ctx->frac_pos >= limit) {
+		return 0;
+	}
+
+	return ((limit - ctx->frac_pos - 1) / ctx->frac_step) + 1;
+}
+
+/**
+ * @brief Run the polyphase filter over the history and the new input samples.
+ *
+ * @details For each output sample the filter is applied with the two phases surrounding the
+ *	    fractional read position, and the results are linearly interpolated. The last input
+ *	    samples are kept at the start of the state buffer as history for the next call.
+ */
+static void fractional_process(struct sample_rate_converter_ctx *ctx, void const *const input,
+			       size_t samples_in, void *const output, size_t samples_out)
+{
+	const uint32_t weight_shift = 32 - SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS - 15;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t *buf = ctx->state_buf_15;
+	q15_t const *filter = ctx->frac_filter;
+	q15_t *out = output;
+	q63_t acc_0, acc_1;
+	int32_t y_0, y_1;
+
+	memcpy(&buf[FRAC_HISTORY_SAMPLES], input, samples_in * sizeof(q15_t));
+
+	for (size_t i = 0; i < samples_out; i++) {
+		q15_t const *x = &buf[ctx->frac_pos >> 32];
+		uint32_t frac = (uint32_t)ctx->frac_pos;
+		q15_t const *h = &filter[(frac >> (32 - SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS)) *
+					 SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+		int32_t weight = (frac >> weight_shift) & INT16_MAX;
+
+		/* Results are in 34.30 format */
+		arm_dot_prod_q15(x, h, SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS, &acc_0);
+		arm_dot_prod_q15(x, h + SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS,
+				 SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS, &acc_1);
+
+		y_0 = CLAMP(acc_0 >> 15, INT16_MIN, INT16_MAX);
+		y_1 = CLAMP(acc_1 >> 15, INT16_MIN, INT16_MAX);
+		out[i] = y_0 + (((y_1 - y_0) * weight) >> 15);
+
+		ctx->frac_pos += ctx->frac_step;
+	}
+
+	memmove(buf, &buf[samples_in], FRAC_HISTORY_SAMPLES * sizeof(q15_t));
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t *buf = ctx->state_buf_31;
+	q31_t const *filter = ctx->frac_filter;
+	q31_t *out = output;
+	q63_t acc_0, acc_1;
+	int64_t y_0, y_1;
+
+	memcpy(&buf[FRAC_HISTORY_SAMPLES], input, samples_in * sizeof(q31_t));
+
+	for (size_t i = 0; i < samples_out; i++) {
+		q31_t const *x = &buf[ctx->frac_pos >> 32];
+		uint32_t frac = (uint32_t)ctx->frac_pos;
+		q31_t const *h = &filter[(frac >> (32 - SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS)) *
+					 SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+		int64_t weight = (frac >> weight_shift) & INT16_MAX;
+
+		/* Results are in 16.48 format */
+		arm_dot_prod_q31(x, h, SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS, &acc_0);
+		arm_dot_prod_q31(x, h + SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS,
+				 SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS, &acc_1);
+
+		y_0 = CLAMP(acc_0 >> 17, INT32_MIN, INT32_MAX);
+		y_1 = CLAMP(acc_1 >> 17, INT32_MIN, INT32_MAX);
+		out[i] = y_0 + (((y_1 - y_0) * weight) >> 15);
+
+		ctx->frac_pos += ctx->frac_step;
+	}
+
+	memmove(buf, &buf[samples_in], FRAC_HISTORY_SAMPLES * sizeof(q31_t));
+#endif
+
+	/* The read position is now relative to the new history */
+	ctx->frac_pos -= (uint64_t)samples_in << 32;
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
 static inline int calculate_conversion_ratio(uint32_t sample_rate_input,
 					     uint32_t sample_rate_output)
 {
@@ -102,6 +276,12 @@ static int sample_rate_converter_reconfigure(struct sample_rate_converter_ctx *c
 
 	__ASSERT(ctx != NULL, "Context cannot be NULL");
 
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+	if (filter == SAMPLE_RATE_FILTER_FRACTIONAL) {
+		return fractional_reconfigure(ctx, sample_rate_input, sample_rate_output);
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
 	ret = validate_sample_rates(sample_rate_input, sample_rate_output);
 	if (ret) {
 		LOG_ERR("Invalid sample rate given (%d)", ret);
@@ -187,6 +367,27 @@ static int sample_rate_converter_reconfigure(struct sample_rate_converter_ctx *c
 	return 0;
 }
 
+static int sample_rate_converter_config_update(struct sample_rate_converter_ctx *ctx,
+					       uint32_t sample_rate_input,
+					       uint32_t sample_rate_output,
+					       enum sample_rate_converter_filter filter)
+{
+	int ret;
+
+	if ((ctx->sample_rate_input != sample_rate_input) ||
+	    (ctx->sample_rate_output != sample_rate_output) || (ctx->filter_type != filter)) {
+		LOG_DBG("State has changed, re-initializing filter");
+		ret = sample_rate_converter_reconfigure(ctx, sample_rate_input, sample_rate_output,
+							filter);
+		if (ret) {
+			LOG_ERR("Failed to initialize converter (%d)", ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx)
 {
 	if (ctx == NULL) {
@@ -199,6 +400,36 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx)
 	return 0;
 }
 
+int sample_rate_converter_ratio_adjust(struct sample_rate_converter_ctx *ctx, int32_t ppm)
+{
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((ppm > SAMPLE_RATE_CONVERTER_FRACTIONAL_ADJUST_PPM_MAX) ||
+	    (ppm < -SAMPLE_RATE_CONVERTER_FRACTIONAL_ADJUST_PPM_MAX)) {
+		LOG_ERR("Adjustment of %d ppm is out of range", ppm);
+		return -EINVAL;
+	}
+
+	ctx->frac_adjust_ppm = ppm;
+
+	if (ctx->filter_type == SAMPLE_RATE_FILTER_FRACTIONAL) {
+		fractional_step_update(ctx);
+	}
+
+	return 0;
+#else
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(ppm);
+
+	LOG_ERR("Fractional sample rate conversion is not enabled");
+	return -EINVAL;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+}
+
 int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  enum sample_rate_converter_filter filter, void const *const input,
 				  size_t input_size, uint32_t sample_rate_input, void *const output,
@@ -236,16 +467,28 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		return -EINVAL;
 	}
 
-	if ((ctx->sample_rate_input != sample_rate_input) ||
-	    (ctx->sample_rate_output != sample_rate_output) || (ctx->filter_type != filter)) {
-		LOG_DBG("State has changed, re-initializing filter");
-		ret = sample_rate_converter_reconfigure(ctx, sample_rate_input, sample_rate_output,
-							filter);
-		if (ret) {
-			LOG_ERR("Failed to initialize converter (%d)", ret);
-			return ret;
+	ret = sample_rate_converter_config_update(ctx, sample_rate_input, sample_rate_output,
+						  filter);
+	if (ret) {
+		return ret;
+	}
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+	if (ctx->filter_type == SAMPLE_RATE_FILTER_FRACTIONAL) {
+		size_t samples_out = fractional_output_samples(ctx, samples_in);
+
+		if (samples_out * bytes_per_sample > output_size) {
+			LOG_ERR("Conversion process will produce more bytes than the output buffer "
+				"can hold");
+			return -EINVAL;
 		}
+
+		fractional_process(ctx, input, samples_in, output, samples_out);
+		*output_written = samples_out * bytes_per_sample;
+
+		return 0;
 	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
 
 	if ((ctx->conversion_ratio < 0) && (samples_in < abs(ctx->conversion_ratio))) {
 		LOG_ERR("Number of samples in can not be less than the conversion ratio (%d) when "
@@ -393,3 +636,271 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 
 	return 0;
 }
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL)
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define MC_BYTES_PER_SAMPLE sizeof(q15_t)
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define MC_BYTES_PER_SAMPLE sizeof(q31_t)
+#endif
+
+static void channel_copy(uint8_t *dst, size_t dst_stride, uint8_t const *src, size_t src_stride,
+			 size_t samples)
+{
+	for (size_t i = 0; i < samples; i++) {
+		memcpy(dst, src, MC_BYTES_PER_SAMPLE);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+/**
+ * @brief Run the polyphase filter for all channels of an interleaved stream.
+ *
+ * @details Same as fractional_process(), but each coefficient is loaded once and applied to
+ *	    all channels before moving on to the next tap. The read position of the first
+ *	    channel context is used for all channels and copied to the others afterwards.
+ */
+static void fractional_mc_process(struct sample_rate_converter_mc_ctx *ctx,
+				  uint8_t const *input, size_t samples_in, void *const output,
+				  size_t samples_out)
+{
+	const uint32_t weight_shift = 32 - SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS - 15;
+	struct sample_rate_converter_ctx *lead = &ctx->ch_ctx[0];
+	uint8_t channels = ctx->channels;
+	q63_t acc_0[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX];
+	q63_t acc_1[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX];
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t const *filter = lead->frac_filter;
+	q15_t *out = output;
+	int32_t y_0, y_1;
+
+	for (uint8_t c = 0; c < channels; c++) {
+		channel_copy((uint8_t *)&ctx->ch_ctx[c].state_buf_15[FRAC_HISTORY_SAMPLES],
+			     sizeof(q15_t), input + (c * sizeof(q15_t)), channels * sizeof(q15_t),
+			     samples_in);
+	}
+
+	for (size_t i = 0; i < samples_out; i++) {
+		size_t offset = lead->frac_pos >> 32;
+		uint32_t frac = (uint32_t)lead->frac_pos;
+		q15_t const *h = &filter[(frac >> (32 - SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS)) *
+					 SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+		int32_t weight = (frac >> weight_shift) & INT16_MAX;
+
+		memset(acc_0, 0, sizeof(acc_0));
+		memset(acc_1, 0, sizeof(acc_1));
+
+		for (size_t k = 0; k < SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS; k++) {
+			q31_t h_0 = h[k];
+			q31_t h_1 = h[k + SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+
+			for (uint8_t c = 0; c < channels; c++) {
+				q31_t x = ctx->ch_ctx[c].state_buf_15[offset + k];
+
+				acc_0[c] += x * h_0;
+				acc_1[c] += x * h_1;
+			}
+		}
+
+		for (uint8_t c = 0; c < channels; c++) {
+			y_0 = CLAMP(acc_0[c] >> 15, INT16_MIN, INT16_MAX);
+			y_1 = CLAMP(acc_1[c] >> 15, INT16_MIN, INT16_MAX);
+			out[(i * channels) + c] = y_0 + (((y_1 - y_0) * weight) >> 15);
+		}
+
+		lead->frac_pos += lead->frac_step;
+	}
+
+	for (uint8_t c = 0; c < channels; c++) {
+		q15_t *buf = ctx->ch_ctx[c].state_buf_15;
+
+		memmove(buf, &buf[samples_in], FRAC_HISTORY_SAMPLES * sizeof(q15_t));
+	}
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t const *filter = lead->frac_filter;
+	q31_t *out = output;
+	int64_t y_0, y_1;
+
+	for (uint8_t c = 0; c < channels; c++) {
+		channel_copy((uint8_t *)&ctx->ch_ctx[c].state_buf_31[FRAC_HISTORY_SAMPLES],
+			     sizeof(q31_t), input + (c * sizeof(q31_t)), channels * sizeof(q31_t),
+			     samples_in);
+	}
+
+	for (size_t i = 0; i < samples_out; i++) {
+		size_t offset = lead->frac_pos >> 32;
+		uint32_t frac = (uint32_t)lead->frac_pos;
+		q31_t const *h = &filter[(frac >> (32 - SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS)) *
+					 SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+		int64_t weight = (frac >> weight_shift) & INT16_MAX;
+
+		memset(acc_0, 0, sizeof(acc_0));
+		memset(acc_1, 0, sizeof(acc_1));
+
+		for (size_t k = 0; k < SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS; k++) {
+			q63_t h_0 = h[k];
+			q63_t h_1 = h[k + SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+
+			/* Same 16.48 format as arm_dot_prod_q31() */
+			for (uint8_t c = 0; c < channels; c++) {
+				q63_t x = ctx->ch_ctx[c].state_buf_31[offset + k];
+
+				acc_0[c] += (x * h_0) >> 14;
+				acc_1[c] += (x * h_1) >> 14;
+			}
+		}
+
+		for (uint8_t c = 0; c < channels; c++) {
+			y_0 = CLAMP(acc_0[c] >> 17, INT32_MIN, INT32_MAX);
+			y_1 = CLAMP(acc_1[c] >> 17, INT32_MIN, INT32_MAX);
+			out[(i * channels) + c] = y_0 + (((y_1 - y_0) * weight) >> 15);
+		}
+
+		lead->frac_pos += lead->frac_step;
+	}
+
+	for (uint8_t c = 0; c < channels; c++) {
+		q31_t *buf = ctx->ch_ctx[c].state_buf_31;
+
+		memmove(buf, &buf[samples_in], FRAC_HISTORY_SAMPLES * sizeof(q31_t));
+	}
+#endif
+
+	lead->frac_pos -= (uint64_t)samples_in << 32;
+
+	for (uint8_t c = 1; c < channels; c++) {
+		ctx->ch_ctx[c].frac_pos = lead->frac_pos;
+	}
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
+int sample_rate_converter_mc_open(struct sample_rate_converter_mc_ctx *ctx, uint8_t channels)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((channels == 0) || (channels > CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX)) {
+		LOG_ERR("Invalid number of channels: %d", channels);
+		return -EINVAL;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_mc_ctx));
+	ctx->channels = channels;
+
+	return 0;
+}
+
+int sample_rate_converter_mc_process(struct sample_rate_converter_mc_ctx *ctx,
+				     enum sample_rate_converter_filter filter,
+				     void const *const input, size_t input_size,
+				     uint32_t sample_rate_input, void *const output,
+				     size_t output_size, size_t *output_written,
+				     uint32_t sample_rate_output)
+{
+	int ret;
+	size_t frame_size;
+	size_t samples_in;
+	size_t ch_output_size;
+	size_t ch_output_written = 0;
+
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (ctx->channels == 0) {
+		LOG_ERR("Context has not been opened");
+		return -EINVAL;
+	}
+
+	frame_size = ctx->channels * MC_BYTES_PER_SAMPLE;
+
+	if (input_size % frame_size != 0) {
+		LOG_ERR("Size of input is not a frame multiple");
+		return -EINVAL;
+	}
+
+	samples_in = input_size / frame_size;
+
+	if (samples_in > CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX) {
+		LOG_ERR("Too many samples given as input");
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+	if (filter == SAMPLE_RATE_FILTER_FRACTIONAL) {
+		size_t samples_out;
+
+		for (uint8_t c = 0; c < ctx->channels; c++) {
+			ret = sample_rate_converter_config_update(&ctx->ch_ctx[c], sample_rate_input,
+								  sample_rate_output, filter);
+			if (ret) {
+				return ret;
+			}
+		}
+
+		samples_out = fractional_output_samples(&ctx->ch_ctx[0], samples_in);
+		if (samples_out * frame_size > output_size) {
+			LOG_ERR("Conversion process will produce more bytes than the output buffer "
+				"can hold");
+			return -EINVAL;
+		}
+
+		fractional_mc_process(ctx, input, samples_in, output, samples_out);
+		*output_written = samples_out * frame_size;
+
+		return 0;
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
+	ch_output_size = MIN(output_size / ctx->channels, sizeof(ctx->ch_output_buf));
+
+	for (uint8_t c = 0; c < ctx->channels; c++) {
+		channel_copy(ctx->ch_input_buf, MC_BYTES_PER_SAMPLE,
+			     (uint8_t const *)input + (c * MC_BYTES_PER_SAMPLE), frame_size,
+			     samples_in);
+
+		ret = sample_rate_converter_process(&ctx->ch_ctx[c], filter, ctx->ch_input_buf,
+						    samples_in * MC_BYTES_PER_SAMPLE,
+						    sample_rate_input, ctx->ch_output_buf,
+						    ch_output_size, &ch_output_written,
+						    sample_rate_output);
+		if (ret) {
+			LOG_ERR("Failed to convert channel %d (%d)", c, ret);
+			return ret;
+		}
+
+		channel_copy((uint8_t *)output + (c * MC_BYTES_PER_SAMPLE), frame_size,
+			     ctx->ch_output_buf, MC_BYTES_PER_SAMPLE,
+			     ch_output_written / MC_BYTES_PER_SAMPLE);
+	}
+
+	*output_written = ch_output_written * ctx->channels;
+
+	return 0;
+}
+
+int sample_rate_converter_mc_ratio_adjust(struct sample_rate_converter_mc_ctx *ctx, int32_t ppm)
+{
+	int ret;
+
+	if ((ctx == NULL) || (ctx->channels == 0)) {
+		LOG_ERR("Context has not been opened");
+		return -EINVAL;
+	}
+
+	for (uint8_t c = 0; c < ctx->channels; c++) {
+		ret = sample_rate_converter_ratio_adjust(&ctx->ch_ctx[c], ppm);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL */
@@ -135,6 +135,143 @@ static const q31_t filter_24khz_to_48khz_32bit_simple[] = {
 #endif
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_SIMPLE */
 
+/**
+ * The fractional filter is a Kaiser windowed sinc (beta 7) with the cut-off at 0.9 of the input
+ * Nyquist frequency. It is split into 32 phases of 16 taps, plus one extra phase equal to the
+ * first one delayed by one sample. Each phase is normalized to unity gain.
+ */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static const q15_t filter_fractional_16bit[] = {
+	0x0030, 0xFF40, 0x01FF, 0xFBE9, 0x06DB, 0xF640, 0x0BF7, 0x732E, 0x0BF7, 0xF640, 0x06DB,
+	0xFBE9, 0x01FF, 0xFF40, 0x0030, 0xFFFB, 0x0031, 0xFF41, 0x01F0, 0xFC22, 0x0643, 0xF7A9,
+	0x0861, 0x7306, 0x0FB5, 0xF4DC, 0x076C, 0xFBB7, 0x020B, 0xFF40, 0x002F, 0xFFFC, 0x0031,
+	0xFF45, 0x01DE, 0xFC60, 0x05A3, 0xF913, 0x04F6, 0x728F, 0x1397, 0xF380, 0x07F2, 0xFB8D,
+	0x0212, 0xFF42, 0x002D, 0xFFFC, 0x0030, 0xFF49, 0x01C8, 0xFCA3, 0x04FE, 0xFA7C, 0x01B8,
+	0x71C9, 0x179A, 0xF22E, 0x086D, 0xFB6A, 0x0215, 0xFF46, 0x002B, 0xFFFC, 0x002F, 0xFF4F,
+	0x01B0, 0xFCEA, 0x0456, 0xFBE0, 0xFEAB, 0x70B5, 0x1BB9, 0xF0EA, 0x08DC, 0xFB4F, 0x0214,
+	0xFF4C, 0x0027, 0xFFFD, 0x002E, 0xFF56, 0x0195, 0xFD34, 0x03AC, 0xFD3E, 0xFBCF, 0x6F55,
+	0x1FF2, 0xEFB7, 0x093B, 0xFB3D, 0x020E, 0xFF53, 0x0024, 0xFFFE, 0x002C, 0xFF5E, 0x0178,
+	0xFD81, 0x0300, 0xFE93, 0xF928, 0x6DAA, 0x243E, 0xEE99, 0x098B, 0xFB36, 0x0202, 0xFF5D,
+	0x001F, 0xFFFF, 0x002A, 0xFF68, 0x015A, 0xFDD0, 0x0256, 0xFFDC, 0xF6B6, 0x6BB7, 0x289B,
+	0xED92, 0x09CA, 0xFB38, 0x01F2, 0xFF6A, 0x001A, 0x0000, 0x0028, 0xFF71, 0x013A, 0xFE20,
+	0x01AD, 0x0118, 0xF47B, 0x697E, 0x2D03, 0xECA6, 0x09F6, 0xFB45, 0x01DD, 0xFF78, 0x0014,
+	0x0001, 0x0026, 0xFF7C, 0x0119, 0xFE70, 0x0108, 0x0245, 0xF278, 0x6702, 0x3171, 0xEBD8,
+	0x0A0F, 0xFB5C, 0x01C2, 0xFF89, 0x000D, 0x0003, 0x0023, 0xFF87, 0x00F8, 0xFEC0, 0x0068,
+	0x0360, 0xF0AC, 0x6446, 0x35E0, 0xEB2B, 0x0A13, 0xFB7F, 0x01A2, 0xFF9B, 0x0005, 0x0004,
+	0x0020, 0xFF92, 0x00D6, 0xFF0F, 0xFFCD, 0x0469, 0xEF18, 0x614E, 0x3A4B, 0xEAA1, 0x0A02,
+	0xFBAD, 0x017D, 0xFFB0, 0xFFFD, 0x0006, 0x001E, 0xFF9E, 0x00B5, 0xFF5D, 0xFF39, 0x055E,
+	0xEDBC, 0x5E1D, 0x3EAD, 0xEA3F, 0x09DB, 0xFBE7, 0x0152, 0xFFC7, 0xFFF4, 0x0008, 0x001B,
+	0xFFA9, 0x0093, 0xFFA8, 0xFEAD, 0x063D, 0xEC98, 0x5AB7, 0x4302, 0xEA06, 0x099D, 0xFC2C,
+	0x0122, 0xFFDF, 0xFFEB, 0x000B, 0x0018, 0xFFB5, 0x0073, 0xFFF0, 0xFE29, 0x0707, 0xEBAA,
+	0x5721, 0x4743, 0xE9F9, 0x0947, 0xFC7C, 0x00EE, 0xFFFA, 0xFFE1, 0x000D, 0x0015, 0xFFC0,
+	0x0053, 0x0036, 0xFDAE, 0x07BA, 0xEAF1, 0x5360, 0x4B6B, 0xEA1B, 0x08DA, 0xFCD7, 0x00B5,
+	0x0016, 0xFFD7, 0x0010, 0x0012, 0xFFCC, 0x0034, 0x0077, 0xFD3E, 0x0856, 0xEA6D, 0x4F77,
+	0x4F77, 0xEA6D, 0x0856, 0xFD3E, 0x0077, 0x0034, 0xFFCC, 0x0012, 0x0010, 0xFFD7, 0x0016,
+	0x00B5, 0xFCD7, 0x08DA, 0xEA1B, 0x4B6B, 0x5360, 0xEAF1, 0x07BA, 0xFDAE, 0x0036, 0x0053,
+	0xFFC0, 0x0015, 0x000D, 0xFFE1, 0xFFFA, 0x00EE, 0xFC7C, 0x0947, 0xE9F9, 0x4743, 0x5721,
+	0xEBAA, 0x0707, 0xFE29, 0xFFF0, 0x0073, 0xFFB5, 0x0018, 0x000B, 0xFFEB, 0xFFDF, 0x0122,
+	0xFC2C, 0x099D, 0xEA06, 0x4302, 0x5AB7, 0xEC98, 0x063D, 0xFEAD, 0xFFA8, 0x0093, 0xFFA9,
+	0x001B, 0x0008, 0xFFF4, 0xFFC7, 0x0152, 0xFBE7, 0x09DB, 0xEA3F, 0x3EAD, 0x5E1D, 0xEDBC,
+	0x055E, 0xFF39, 0xFF5D, 0x00B5, 0xFF9E, 0x001E, 0x0006, 0xFFFD, 0xFFB0, 0x017D, 0xFBAD,
+	0x0A02, 0xEAA1, 0x3A4B, 0x614E, 0xEF18, 0x0469, 0xFFCD, 0xFF0F, 0x00D6, 0xFF92, 0x0020,
+	0x0004, 0x0005, 0xFF9B, 0x01A2, 0xFB7F, 0x0A13, 0xEB2B, 0x35E0, 0x6446, 0xF0AC, 0x0360,
+	0x0068, 0xFEC0, 0x00F8, 0xFF87, 0x0023, 0x0003, 0x000D, 0xFF89, 0x01C2, 0xFB5C, 0x0A0F,
+	0xEBD8, 0x3171, 0x6702, 0xF278, 0x0245, 0x0108, 0xFE70, 0x0119, 0xFF7C, 0x0026, 0x0001,
+	0x0014, 0xFF78, 0x01DD, 0xFB45, 0x09F6, 0xECA6, 0x2D03, 0x697E, 0xF47B, 0x0118, 0x01AD,
+	0xFE20, 0x013A, 0xFF71, 0x0028, 0x0000, 0x001A, 0xFF6A, 0x01F2, 0xFB38, 0x09CA, 0xED92,
+	0x289B, 0x6BB7, 0xF6B6, 0xFFDC, 0x0256, 0xFDD0, 0x015A, 0xFF68, 0x002A, 0xFFFF, 0x001F,
+	0xFF5D, 0x0202, 0xFB36, 0x098B, 0xEE99, 0x243E, 0x6DAA, 0xF928, 0xFE93, 0x0300, 0xFD81,
+	0x0178, 0xFF5E, 0x002C, 0xFFFE, 0x0024, 0xFF53, 0x020E, 0xFB3D, 0x093B, 0xEFB7, 0x1FF2,
+	0x6F55, 0xFBCF, 0xFD3E, 0x03AC, 0xFD34, 0x0195, 0xFF56, 0x002E, 0xFFFD, 0x0027, 0xFF4C,
+	0x0214, 0xFB4F, 0x08DC, 0xF0EA, 0x1BB9, 0x70B5, 0xFEAB, 0xFBE0, 0x0456, 0xFCEA, 0x01B0,
+	0xFF4F, 0x002F, 0xFFFC, 0x002B, 0xFF46, 0x0215, 0xFB6A, 0x086D, 0xF22E, 0x179A, 0x71C9,
+	0x01B8, 0xFA7C, 0x04FE, 0xFCA3, 0x01C8, 0xFF49, 0x0030, 0xFFFC, 0x002D, 0xFF42, 0x0212,
+	0xFB8D, 0x07F2, 0xF380, 0x1397, 0x728F, 0x04F6, 0xF913, 0x05A3, 0xFC60, 0x01DE, 0xFF45,
+	0x0031, 0xFFFC, 0x002F, 0xFF40, 0x020B, 0xFBB7, 0x076C, 0xF4DC, 0x0FB5, 0x7306, 0x0861,
+	0xF7A9, 0x0643, 0xFC22, 0x01F0, 0xFF41, 0x0031, 0xFFFB, 0x0030, 0xFF40, 0x01FF, 0xFBE9,
+	0x06DB, 0xF640, 0x0BF7, 0x732E, 0x0BF7, 0xF640, 0x06DB, 0xFBE9, 0x01FF, 0xFF40, 0x0030};
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+static const q31_t filter_fractional_32bit[] = {
+	0x00300DE2, 0xFF3FC3B2, 0x01FF723C, 0xFBE97111, 0x06DB7825, 0xF6405A9C, 0x0BF6F168,
+	0x732D995C, 0x0BF6F168, 0xF6405A9C, 0x06DB7825, 0xFBE97111, 0x01FF723C, 0xFF3FC3B2,
+	0x00300DE2, 0xFFFB748F, 0x0030A78C, 0xFF4159DB, 0x01F0536A, 0xFC21D5AB, 0x0642B9DC,
+	0xF7A8DB9D, 0x0860F326, 0x7305C039, 0x0FB4ABA2, 0xF4DC5864, 0x076BDD1F, 0xFBB774D6,
+	0x020AD755, 0xFF3FE2E5, 0x002EDDFC, 0xFFFB9E7B, 0x0030B58E, 0xFF4486AC, 0x01DDCC80,
+	0xFC5FE25F, 0x05A33646, 0xF912DEE4, 0x04F5CA42, 0x728E947D, 0x1396C785, 0xF37FE1C6,
+	0x07F25BA2, 0xFB8C9802, 0x0212375E, 0xFF41D309, 0x002D0E58, 0xFFFBEB50, 0x0030432E,
+	0xFF4929A6, 0x01C83222, 0xFCA2D469, 0x04FE7CC4, 0xFA7B8882, 0x01B83CB5, 0x71C8ADB7,
+	0x1799A0EE, 0xF22E1A23, 0x086D68E9, 0xFB698B33, 0x02154BEF, 0xFF45AD0A, 0x002A9680,
+	0xFFFC5E49, 0x002F5C45, 0xFF4F209E, 0x01AFDBD3, 0xFCE9E697, 0x045617F8, 0xFBE01CB0,
+	0xFEAAC08D, 0x70B50999, 0x1BB951D0, 0xF0EA32FD, 0x08DB8294, 0xFB4EF529, 0x0213D54B,
+	0xFF4B866E, 0x00276F4A, 0xFFFCFA57, 0x002E0D13, 0xFF56482D, 0x01952311, 0xFD345313,
+	0x03AB8AC9, 0xFD3E0399, 0xFBCF798C, 0x6F550A83, 0x1FF1B722, 0xEFB766B5, 0x093B323A,
+	0xFB3D70D4, 0x020D9B4B, 0xFF5370E8, 0x00239307, 0xFFFDC20B, 0x002C6217, 0xFF5E7C17,
+	0x01786267, 0xFD815519, 0x03004D8D, 0xFE92CCC9, 0xF9283750, 0x6DAA7562, 0x243E7659,
+	0xEE98F312, 0x098B10F4, 0xFB358B7F, 0x02026E42, 0xFF5D79F3, 0x001EFDAC, 0xFFFEB78B,
+	0x002A67E6, 0xFF6797B4, 0x0159F492, 0xFDD02A9D, 0x0255CB62, 0xFFDC3242, 0xF6B67410,
+	0x6BB76EF7, 0x289B0342, 0xED92139B, 0x09C9CAF4, 0xFB37C2F4, 0x01F227DB, 0xFF69AA72,
+	0x0019ACFF, 0xFFFFDC79, 0x00282B02, 0xFF717651, 0x013A33AB, 0xFE2015D9, 0x01AD5FBB,
+	0x01181B25, 0xF47B53F0, 0x697E787D, 0x2D02A659, 0xECA5FBCE, 0x09F62311, 0xFB4483BF,
+	0x01DCABE8, 0xFF780658, 0x0013A0BD, 0x000131E8, 0x0025B7B8, 0xFF7BF391, 0x0119785A,
+	0xFE705EC3, 0x01085421, 0x02449E06, 0xF277A4DE, 0x67026BBA, 0x3170836E, 0xEBD7D142,
+	0x0A0EF641, 0xFB5C277D, 0x01C1E91D, 0xFF888C50, 0x000CDAB9, 0x0002B846, 0x00231A00,
+	0xFF86EBC3, 0x00F8191C, 0xFEC05467, 0x0067DE2D, 0x036002C5, 0xF0ABDF09, 0x6446767B,
+	0x35DFA0AD, 0xEB2AA5B8, 0x0A133F02, 0xFB7EF34B, 0x01A1D9BE, 0xFF9B357C, 0x00055F05,
+	0x00046F54, 0x00205D5D, 0xFF923C32, 0x00D6698D, 0xFF0F4E28, 0xFFCD1DBD, 0x0468C410,
+	0xEF1825E0, 0x614E158F, 0x3A4AEDE4, 0xEAA1712B, 0x0A0218A1, 0xFBAD164F, 0x017C843A,
+	0xFFAFF534, 0xFFFD3403, 0x0006560E, 0x001D8CC6, 0xFF9DC372, 0x00B4B9CB, 0xFF5CACD8,
+	0xFF391B6B, 0x055D9071, 0xEDBC49A1, 0x5E1D0F38, 0x3EAD4C0D, 0xEA3F0BF0, 0x09DAC25D,
+	0xFBE6A86A, 0x0151FBAA, 0xFFC6B8D7, 0xFFF46281, 0x00086AA9, 0x001AB28B, 0xFFA961A3,
+	0x009355E2, 0xFFA7DBBD, 0xFEACC73B, 0x063D4AF3, 0xEC97C96F, 0x5AB76D30, 0x430194FA,
+	0xEA0628E6, 0x099CA254, 0xFC2BA90B, 0x01226039, 0xFFDF67A5, 0xFFEAF5C8, 0x000AAA82,
+	0x0017D844, 0xFFB4F8AA, 0x0072854A, 0xFFF05166, 0xFE28F78F, 0x07070B66, 0xEBA9D5E8,
+	0x57217636, 0x4742A335, 0xE9F94FC4, 0x09474846, 0xFC7BFE38, 0x00EDDF74, 0xFFF9E2AB,
+	0xFFE0FBA2, 0x000D1216, 0x001506BF, 0xFFC06C67, 0x00528A78, 0x0035906C, 0xFDAE6856,
+	0x07BA1E37, 0xEAF1543D, 0x535FA74A, 0x4B6B59DB, 0xEA1AD7A4, 0x08DA7010, 0xFCD773B9,
+	0x00B4B478, 0x001604BE, 0xFFD68463, 0x000F9D01, 0x001245F6, 0xFFCBA2E0, 0x0033A27E,
+	0x00772804, 0xFD3DBA83, 0x085603E3, 0xEA6CE1B5, 0x4F76AC8D, 0x4F76AC8D, 0xEA6CE1B5,
+	0x085603E3, 0xFD3DBA83, 0x00772804, 0x0033A27E, 0xFFCBA2E0, 0x001245F6, 0x000F9D01,
+	0xFFD68463, 0x001604BE, 0x00B4B478, 0xFCD773B9, 0x08DA7010, 0xEA1AD7A4, 0x4B6B59DB,
+	0x535FA74A, 0xEAF1543D, 0x07BA1E37, 0xFDAE6856, 0x0035906C, 0x00528A78, 0xFFC06C67,
+	0x001506BF, 0x000D1216, 0xFFE0FBA2, 0xFFF9E2AB, 0x00EDDF74, 0xFC7BFE38, 0x09474846,
+	0xE9F94FC4, 0x4742A335, 0x57217636, 0xEBA9D5E8, 0x07070B66, 0xFE28F78F, 0xFFF05166,
+	0x0072854A, 0xFFB4F8AA, 0x0017D844, 0x000AAA82, 0xFFEAF5C8, 0xFFDF67A5, 0x01226039,
+	0xFC2BA90B, 0x099CA254, 0xEA0628E6, 0x430194FA, 0x5AB76D30, 0xEC97C96F, 0x063D4AF3,
+	0xFEACC73B, 0xFFA7DBBD, 0x009355E2, 0xFFA961A3, 0x001AB28B, 0x00086AA9, 0xFFF46281,
+	0xFFC6B8D7, 0x0151FBAA, 0xFBE6A86A, 0x09DAC25D, 0xEA3F0BF0, 0x3EAD4C0D, 0x5E1D0F38,
+	0xEDBC49A1, 0x055D9071, 0xFF391B6B, 0xFF5CACD8, 0x00B4B9CB, 0xFF9DC372, 0x001D8CC6,
+	0x0006560E, 0xFFFD3403, 0xFFAFF534, 0x017C843A, 0xFBAD164F, 0x0A0218A1, 0xEAA1712B,
+	0x3A4AEDE4, 0x614E158F, 0xEF1825E0, 0x0468C410, 0xFFCD1DBD, 0xFF0F4E28, 0x00D6698D,
+	0xFF923C32, 0x00205D5D, 0x00046F54, 0x00055F05, 0xFF9B357C, 0x01A1D9BE, 0xFB7EF34B,
+	0x0A133F02, 0xEB2AA5B8, 0x35DFA0AD, 0x6446767B, 0xF0ABDF09, 0x036002C5, 0x0067DE2D,
+	0xFEC05467, 0x00F8191C, 0xFF86EBC3, 0x00231A00, 0x0002B846, 0x000CDAB9, 0xFF888C50,
+	0x01C1E91D, 0xFB5C277D, 0x0A0EF641, 0xEBD7D142, 0x3170836E, 0x67026BBA, 0xF277A4DE,
+	0x02449E06, 0x01085421, 0xFE705EC3, 0x0119785A, 0xFF7BF391, 0x0025B7B8, 0x000131E8,
+	0x0013A0BD, 0xFF780658, 0x01DCABE8, 0xFB4483BF, 0x09F62311, 0xECA5FBCE, 0x2D02A659,
+	0x697E787D, 0xF47B53F0, 0x01181B25, 0x01AD5FBB, 0xFE2015D9, 0x013A33AB, 0xFF717651,
+	0x00282B02, 0xFFFFDC79, 0x0019ACFF, 0xFF69AA72, 0x01F227DB, 0xFB37C2F4, 0x09C9CAF4,
+	0xED92139B, 0x289B0342, 0x6BB76EF7, 0xF6B67410, 0xFFDC3242, 0x0255CB62, 0xFDD02A9D,
+	0x0159F492, 0xFF6797B4, 0x002A67E6, 0xFFFEB78B, 0x001EFDAC, 0xFF5D79F3, 0x02026E42,
+	0xFB358B7F, 0x098B10F4, 0xEE98F312, 0x243E7659, 0x6DAA7562, 0xF9283750, 0xFE92CCC9,
+	0x03004D8D, 0xFD815519, 0x01786267, 0xFF5E7C17, 0x002C6217, 0xFFFDC20B, 0x00239307,
+	0xFF5370E8, 0x020D9B4B, 0xFB3D70D4, 0x093B323A, 0xEFB766B5, 0x1FF1B722, 0x6F550A83,
+	0xFBCF798C, 0xFD3E0399, 0x03AB8AC9, 0xFD345313, 0x01952311, 0xFF56482D, 0x002E0D13,
+	0xFFFCFA57, 0x00276F4A, 0xFF4B866E, 0x0213D54B, 0xFB4EF529, 0x08DB8294, 0xF0EA32FD,
+	0x1BB951D0, 0x70B50999, 0xFEAAC08D, 0xFBE01CB0, 0x045617F8, 0xFCE9E697, 0x01AFDBD3,
+	0xFF4F209E, 0x002F5C45, 0xFFFC5E49, 0x002A9680, 0xFF45AD0A, 0x02154BEF, 0xFB698B33,
+	0x086D68E9, 0xF22E1A23, 0x1799A0EE, 0x71C8ADB7, 0x01B83CB5, 0xFA7B8882, 0x04FE7CC4,
+	0xFCA2D469, 0x01C83222, 0xFF4929A6, 0x0030432E, 0xFFFBEB50, 0x002D0E58, 0xFF41D309,
+	0x0212375E, 0xFB8C9802, 0x07F25BA2, 0xF37FE1C6, 0x1396C785, 0x728E947D, 0x04F5CA42,
+	0xF912DEE4, 0x05A33646, 0xFC5FE25F, 0x01DDCC80, 0xFF4486AC, 0x0030B58E, 0xFFFB9E7B,
+	0x002EDDFC, 0xFF3FE2E5, 0x020AD755, 0xFBB774D6, 0x076BDD1F, 0xF4DC5864, 0x0FB4ABA2,
+	0x7305C039, 0x0860F326, 0xF7A8DB9D, 0x0642B9DC, 0xFC21D5AB, 0x01F0536A, 0xFF4159DB,
+	0x0030A78C, 0xFFFB748F, 0x00300DE2, 0xFF3FC3B2, 0x01FF723C, 0xFBE97111, 0x06DB7825,
+	0xF6405A9C, 0x0BF6F168, 0x732D995C, 0x0BF6F168, 0xF6405A9C, 0x06DB7825, 0xFBE97111,
+	0x01FF723C, 0xFF3FC3B2, 0x00300DE2};
+#endif
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
 enum filter_conversion_ratio {
 	CONVERSION_48KHZ_TO_16KHZ = -3,
 	CONVERSION_48KHZ_TO_24KHZ = -2,
@@ -301,3 +438,26 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
 	return 0;
 }
+
+int sample_rate_converter_filter_fractional_get(void const **filter_ptr)
+{
+	__ASSERT(filter_ptr != NULL, "Filter pointer cannot be NULL");
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	BUILD_ASSERT(ARRAY_SIZE(filter_fractional_16bit) ==
+		     (SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES + 1) *
+			     SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS);
+	*filter_ptr = filter_fractional_16bit;
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	BUILD_ASSERT(ARRAY_SIZE(filter_fractional_32bit) ==
+		     (SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES + 1) *
+			     SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS);
+	*filter_ptr = filter_fractional_32bit;
+#endif
+	return 0;
+#else
+	LOG_ERR("Fractional filter is not included");
+	return -EINVAL;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+}
@@ -7,6 +7,7 @@
 #ifndef _SAMPLE_RATE_CONVERTER_FILTER_H_
 #define _SAMPLE_RATE_CONVERTER_FILTER_H_
 
+#include <zephyr/sys/util.h>
 #include <dsp/filtering_functions.h>
 
 /**
@@ -24,4 +25,26 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 				     int conversion_ratio, void const **filter_ptr,
 				     size_t *filter_size);
 
+/** Number of filter taps for each phase of the fractional filter */
+#define SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS 16
+
+/** Number of phases of the fractional filter, as a power of two */
+#define SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS 5
+#define SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES	     BIT(SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES_BITS)
+
+/**
+ * @brief Get the pointer to the polyphase filter coefficients for the fractional conversion.
+ *
+ * @details The filter holds SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES + 1 phases of
+ *	    SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS coefficients each, where the last phase equals the
+ *	    first phase delayed by one sample. This allows interpolation between any two adjacent
+ *	    phases.
+ *
+ * @param[out]	filter_ptr	Pointer to the filter coefficients.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Fractional filter not included.
+ */
+int sample_rate_converter_filter_fractional_get(void const **filter_ptr);
+
 #endif /* _SAMPLE_RATE_CONVERTER_FILTER_H_ */
@@ -332,13 +332,9 @@ int st25r3911b_non_response_timer_set(uint16_t fc, bool long_range, bool emv)
 		return err;
 	}
 
-	err = st25r3911b_reg_write(ST25R3911B_REG_NO_RSP_TIM_REG1, reg_data[0]);
-	if (err) {
-		return err;
-	}
-
-	return st25r3911b_reg_write(ST25R3911B_REG_NO_RSP_TIM_REG2,
-				    reg_data[1]);
+	/* Both timer registers are written in one burst. */
+	return st25r3911b_multiple_reg_write(ST25R3911B_REG_NO_RSP_TIM_REG1,
+					     reg_data, ARRAY_SIZE(reg_data));
 }
 
 int st25r3911b_mask_receive_timer_set(uint32_t fc)
@@ -470,6 +466,29 @@ int st25r3911b_tx_len_set(uint16_t len)
 	return err;
 }
 
+int st25r3911b_tx_frame_len_set(uint16_t len, uint8_t bits)
+{
+	int err;
+	uint8_t reg_data[2];
+
+	if (len > ST25R3911B_MAX_TX_LEN) {
+		return -EFAULT;
+	}
+
+	reg_data[0] = (len >> ST25R3911B_REG_NUM_TX_BYTES_NTX_SHIFT_LSB) & 0xFF;
+	reg_data[1] = ((len << ST25R3911B_REG_NUM_TX_BYTES_NTX_SHIFT) &
+		       ST25R3911B_REG_NUM_TX_BYTES_REG2_NTX_MASK) |
+		      (bits & ST25R3911B_REG_NUM_TX_BYTES_REG2_NBTX);
+
+	err = st25r3911b_multiple_reg_write(ST25R3911B_REG_NUM_TX_BYTES_REG1,
+					    reg_data, ARRAY_SIZE(reg_data));
+	if (!err) {
+		LOG_DBG("Fifo Tx length set to %u, incomplete bits %u", len, bits);
+	}
+
+	return err;
+}
+
 int st25r3911b_field_on(uint8_t collision_threshold, uint8_t peer_threshold,
 			uint8_t delay)
 {
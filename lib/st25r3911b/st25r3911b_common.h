@@ -94,6 +94,20 @@ int st25r3911b_init(void);
  */
 int st25r3911b_tx_len_set(uint16_t len);
 
+/** @brief Set the NFC Reader TX packet length and incomplete bits.
+ *
+ *  @details Both TX length registers are written in one SPI transfer,
+ *           without reading them first. The maximum packet length is
+ *           @ref ST25R3911B_MAX_TX_LEN.
+ *
+ *  @param[in] len TX packet length in complete bytes.
+ *  @param[in] bits Number of bits in the last incomplete byte.
+ *
+ *  @retval 0  If the operation was successful.
+ *             Otherwise, a (negative) error code is returned.
+ */
+int st25r3911b_tx_frame_len_set(uint16_t len, uint8_t bits);
+
 /** @brief Set NFC Reader No-Response timer.
  *
  *  @details This timer is set to verify whether a tag response is received
@@ -113,6 +113,9 @@ int st25r3911b_irq_modify(uint32_t clr_mask, uint32_t set_mask)
 	int err = 0;
 	uint32_t mask;
 	uint32_t old_mask;
+	uint8_t val[IRQ_REG_CNT];
+	size_t first = IRQ_REG_CNT;
+	size_t last = 0;
 
 	err = k_mutex_lock(&irq_modify_lock, K_NO_WAIT);
 	if (err) {
@@ -129,19 +132,20 @@ int st25r3911b_irq_modify(uint32_t clr_mask, uint32_t set_mask)
 	irq_mask = old_mask;
 
 	for (size_t i = 0; i < IRQ_REG_CNT; i++) {
-		if (!((mask >> (8 * i)) & 0xFF)) {
-			continue;
-		}
-
-		uint8_t val = (uint8_t)(old_mask >> (8 * i));
+		val[i] = (uint8_t)(old_mask >> (8 * i));
 
-		err = st25r3911b_reg_write(ST25R3911B_REG_MASK_MAIN_INT + i,
-					   val);
-		if (err) {
-			break;
+		if ((mask >> (8 * i)) & 0xFF) {
+			first = MIN(first, i);
+			last = i;
 		}
 	}
 
+	/* Write all changed mask registers in one burst. */
+	if (first < IRQ_REG_CNT) {
+		err = st25r3911b_multiple_reg_write(ST25R3911B_REG_MASK_MAIN_INT + first,
+						    &val[first], last - first + 1);
+	}
+
 	err = k_mutex_unlock(&irq_modify_lock);
 	if (err) {
 		LOG_DBG("Failed to unlock irq_modify mutex (err %d)", err);
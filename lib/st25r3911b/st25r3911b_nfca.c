@@ -120,12 +120,26 @@ struct nfc_fifo {
 	bool parity_miss;
 };
 
+/* Shadow of the frame configuration registers. Only this module writes them,
+ * so the SPI transfers are skipped when the configuration does not change
+ * between the frames, for example during the anticollision loop.
+ */
+struct nfc_reg_cache {
+	bool mode_valid;
+	bool antcl;
+	bool timers_valid;
+	uint32_t mask_timer;
+	uint16_t no_rsp_timer;
+	bool long_range;
+};
+
 struct st25r3911b_nfca {
 	struct st25r3911b_nfca_tag_info tag;
 	struct nfc_state state;
 	struct nfc_transfer transfer;
 	struct nfc_fifo fifo;
 	struct fifo_water_lvl water_lvl;
+	struct nfc_reg_cache regs;
 	uint32_t cmd;
 	const struct st25r3911b_nfca_cb *cb;
 };
@@ -186,11 +200,69 @@ static void state_set(uint32_t state)
 	atomic_set(&nfca.state.tag, state);
 }
 
-static int fifo_incomplete_bit_set(uint8_t bits)
+static int frame_mode_set(bool antcl)
+{
+	int err;
+
+	if (nfca.regs.mode_valid && (nfca.regs.antcl == antcl)) {
+		return 0;
+	}
+
+	nfca.regs.mode_valid = false;
+
+	/* Set or unset sending anticollision frame */
+	err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A,
+				    antcl ? 0 : ST25R3911B_REG_ISO14443A_ANTCL,
+				    antcl ? ST25R3911B_REG_ISO14443A_ANTCL : 0);
+	if (err) {
+		return err;
+	}
+
+	/* Rx data of the anticollision frames do not contain the CRC. */
+	err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY,
+				    antcl ? 0 : ST25R3911B_REG_AUXILIARY_NO_CRC_RX,
+				    antcl ? ST25R3911B_REG_AUXILIARY_NO_CRC_RX : 0);
+	if (err) {
+		return err;
+	}
+
+	nfca.regs.antcl = antcl;
+	nfca.regs.mode_valid = true;
+
+	return 0;
+}
+
+static int timers_set(uint32_t mask_timer, uint16_t no_rsp_timer, bool long_range)
 {
-	return st25r3911b_reg_modify(ST25R3911B_REG_NUM_TX_BYTES_REG2,
-				     ST25R3911B_REG_NUM_TX_BYTES_REG2_NBTX,
-				     bits & ST25R3911B_REG_NUM_TX_BYTES_REG2_NBTX);
+	int err;
+
+	if (nfca.regs.timers_valid &&
+	    (nfca.regs.mask_timer == mask_timer) &&
+	    (nfca.regs.no_rsp_timer == no_rsp_timer) &&
+	    (nfca.regs.long_range == long_range)) {
+		return 0;
+	}
+
+	nfca.regs.timers_valid = false;
+
+	/* Set time when RX is not active after transmission */
+	err = st25r3911b_mask_receive_timer_set(mask_timer);
+	if (err) {
+		return err;
+	}
+
+	/* Set time before it RX should be detected */
+	err = st25r3911b_non_response_timer_set(no_rsp_timer, long_range, false);
+	if (err) {
+		return err;
+	}
+
+	nfca.regs.mask_timer = mask_timer;
+	nfca.regs.no_rsp_timer = no_rsp_timer;
+	nfca.regs.long_range = long_range;
+	nfca.regs.timers_valid = true;
+
+	return 0;
 }
 
 static void timeout_process(void)
@@ -208,11 +280,15 @@ static int transmission_prepare(void)
 {
 	int err;
 
-	/* Clear EMVCo mode */
-	err = st25r3911b_reg_modify(ST25R3911B_REG_TIM_CTRl,
-				    ST25R3911B_REG_TIM_CTRl_NRT_EMV, 0);
-	if (err) {
-		return err;
+	/* Clear EMVCo mode, it is already cleared if the No-Response timer
+	 * was set by this module.
+	 */
+	if (!nfca.regs.timers_valid) {
+		err = st25r3911b_reg_modify(ST25R3911B_REG_TIM_CTRl,
+					    ST25R3911B_REG_TIM_CTRl_NRT_EMV, 0);
+		if (err) {
+			return err;
+		}
 	}
 
 	/* Clear FIFO */
@@ -239,52 +315,26 @@ static int anticollision_transmit(uint8_t *tx_buf, size_t tx_bytes,
 	uint32_t mask_timer;
 	uint16_t no_rsp_timer;
 
-	if (antcl) {
-		/* Set sending anticollision frame */
-		err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A, 0,
-					    ST25R3911B_REG_ISO14443A_ANTCL);
-		if (err) {
-			return err;
-		}
-
-		err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY, 0,
-					    ST25R3911B_REG_AUXILIARY_NO_CRC_RX);
-		if (err) {
-			return err;
-		}
+	err = frame_mode_set(antcl);
+	if (err) {
+		return err;
+	}
 
+	if (antcl) {
 		LOG_DBG("Bit oriented anticollision frame will be sent");
-
-	} else {
-		/* Unset sending anticollision frame */
-		err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A,
-					    ST25R3911B_REG_ISO14443A_ANTCL, 0);
-		if (err) {
-			return err;
-		}
-
-		err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY,
-					    ST25R3911B_REG_AUXILIARY_NO_CRC_RX, 0);
-		if (err) {
-			return err;
-		}
 	}
 
 	mask_timer = NFCA_MIN_LISTEN_FDT -
 		     (ST25R3911B_FDT_ADJUST + NFCA_POLL_FTD_ADJUSMENT);
 
-	/* Set time when RX is not active after transmission */
-	err = st25r3911b_mask_receive_timer_set(mask_timer);
-	if (err) {
-		return err;
-	}
-
 	no_rsp_timer = ST25R3911B_FC_TO_64FC(NFCA_MIN_LISTEN_FDT +
 				  ST25R3911B_FDT_ADJUST +
 				  NFCA_FWT_A_ADJUSMENT);
 
-	/* Set time before it RX should be detected */
-	err = st25r3911b_non_response_timer_set(no_rsp_timer, false, false);
+	/* The timers are the same for all frames of the anticollision loop,
+	 * so they are written only for the first one.
+	 */
+	err = timers_set(mask_timer, no_rsp_timer, false);
 	if (err) {
 		return err;
 	}
@@ -310,15 +360,12 @@ static int anticollision_transmit(uint8_t *tx_buf, size_t tx_bytes,
 		return err;
 	}
 
-	/* Set number of complete bytes */
-	err = st25r3911b_tx_len_set(tx_bytes);
+	/* Set number of complete bytes and incomplete bits in last byte */
+	err = st25r3911b_tx_frame_len_set(tx_bytes, tx_bits);
 	if (err) {
 		return err;
 	}
 
-	/* Set number of incomplete bit in last byte */
-	err = fifo_incomplete_bit_set(tx_bits);
-
 	if (antcl) {
 		cmd = ST25R3911B_CMD_TX_WITHOUT_CRC;
 
@@ -337,30 +384,24 @@ static int anticollision_transmit(uint8_t *tx_buf, size_t tx_bytes,
 
 static int transfer_fdt_set(uint32_t fdt)
 {
-	int err;
 	uint32_t mask_timer;
 
 	mask_timer = NFCA_MIN_LISTEN_FDT -
 		     (ST25R3911B_FDT_ADJUST + NFCA_POLL_FTD_ADJUSMENT);
 
-	/* Set mask receive timer, RX is disabled for this time. */
-	err = st25r3911b_mask_receive_timer_set(ST25R3911B_FC_TO_64FC(mask_timer));
-	if (err) {
-		return err;
-	}
-
 	fdt += ST25R3911B_FDT_ADJUST + NFCA_FWT_A_ADJUSMENT;
 
-	/* Set No-Response Timer, during this time RX should detect transmission. */
+	/* Set mask receive timer, RX is disabled for this time.
+	 * Set No-Response Timer, during this time RX should detect transmission.
+	 */
 	if (fdt > ST25R3911B_NRT_64FC_MAX) {
-		err = st25r3911b_non_response_timer_set(ST25R3911B_FC_TO_4096FC(MIN(fdt, ST25R3911B_NRT_FC_MAX)),
-							true, false);
-	} else {
-		err = st25r3911b_non_response_timer_set(ST25R3911B_FC_TO_64FC(fdt),
-							false, false);
+		return timers_set(ST25R3911B_FC_TO_64FC(mask_timer),
+				  ST25R3911B_FC_TO_4096FC(MIN(fdt, ST25R3911B_NRT_FC_MAX)),
+				  true);
 	}
 
-	return err;
+	return timers_set(ST25R3911B_FC_TO_64FC(mask_timer),
+			  ST25R3911B_FC_TO_64FC(fdt), false);
 }
 
 static uint8_t bcc_calculate(uint8_t *buf, uint8_t len)
@@ -379,30 +420,36 @@ static uint8_t bcc_calculate(uint8_t *buf, uint8_t len)
 	return bcc;
 }
 
-static int read_rx_data(uint8_t *data, size_t len)
+static int read_rx_data(uint8_t *data, size_t len, uint8_t *col_disp)
 {
 	int err;
-	uint8_t fifo_status;
+	/* FIFO Status 1, FIFO Status 2 and Collision Display registers. */
+	uint8_t fifo_status[3];
 	uint32_t received;
 
-	/* Check number of bytes in FIFO */
-	err = st25r3911b_reg_read(ST25R3911B_REG_FIFO_STATUS_1, &fifo_status);
+	BUILD_ASSERT((ST25R3911B_REG_FIFO_STATUS_2 == ST25R3911B_REG_FIFO_STATUS_1 + 1) &&
+		     (ST25R3911B_REG_COLLISION_DISP == ST25R3911B_REG_FIFO_STATUS_1 + 2),
+		     "FIFO status registers must be contiguous");
+
+	/* Check number of bytes in FIFO, number of incomplete bit in FIFO,
+	 * parity missing and optionally where collision occurred, in one burst.
+	 */
+	err = st25r3911b_multiple_reg_read(ST25R3911B_REG_FIFO_STATUS_1, fifo_status,
+					   col_disp ? 3 : 2);
 	if (err) {
 		return err;
 	}
 
-	nfca.fifo.bytes_to_read = fifo_status;
+	nfca.fifo.bytes_to_read = fifo_status[0];
 	received = nfca.transfer.received_byte;
 
-	/* Check number of incomplete bit in FIFO and parity missing */
-	err = st25r3911b_reg_read(ST25R3911B_REG_FIFO_STATUS_2, &fifo_status);
-	if (err) {
-		return err;
-	}
-
-	nfca.fifo.incomplete_bits = (fifo_status & ST25R3911B_REG_FIFO_STATUS_2_FIFO_LB_MASK) >>
+	nfca.fifo.incomplete_bits = (fifo_status[1] & ST25R3911B_REG_FIFO_STATUS_2_FIFO_LB_MASK) >>
 				     ST25R3911B_REG_FIFO_STATUS_2_FIFO_LB0;
-	nfca.fifo.parity_miss    = fifo_status & ST25R3911B_REG_FIFO_STATUS_2_NP_LB;
+	nfca.fifo.parity_miss    = fifo_status[1] & ST25R3911B_REG_FIFO_STATUS_2_NP_LB;
+
+	if (col_disp) {
+		*col_disp = fifo_status[2];
+	}
 
 	/* Check buffer size */
 	if (len - received < nfca.fifo.bytes_to_read) {
@@ -451,7 +498,7 @@ static int anticollision_rx(void)
 	uint8_t sel_rsp;
 	static uint8_t nfcid_idx;
 
-	err = read_rx_data(buff, sizeof(buff));
+	err = read_rx_data(buff, sizeof(buff), NULL);
 	if (err) {
 		return err;
 	}
@@ -543,7 +590,7 @@ static int on_rx_complete(void)
 
 	case STATE_TAG_DETECTION:
 		err = read_rx_data((uint8_t *)&nfca.tag.sens_resp,
-				   sizeof(nfca.tag.sens_resp));
+				   sizeof(nfca.tag.sens_resp), NULL);
 
 		if (nfca.tag.sens_resp.platform_info == NFCA_T1T_PLATFORM) {
 			nfca.tag.type = ST25R3911B_NFCA_TAG_TYPE_T1T;
@@ -561,7 +608,7 @@ static int on_rx_complete(void)
 
 	case STATE_TRANSFER:
 		err = read_rx_data(nfca.transfer.rx_buf->data,
-				   nfca.transfer.rx_buf->len);
+				   nfca.transfer.rx_buf->len, NULL);
 
 		nfca.transfer.received_byte += nfca.fifo.bytes_to_read;
 
@@ -654,13 +701,8 @@ static int on_collision(void)
 		return -EFAULT;
 	}
 
-	/* Check where collision occurred */
-	err = st25r3911b_reg_read(ST25R3911B_REG_COLLISION_DISP, &col_disp);
-	if (err) {
-		return err;
-	}
-
-	err = read_rx_data(buf, sizeof(buf));
+	/* Check where collision occurred together with the FIFO status */
+	err = read_rx_data(buf, sizeof(buf), &col_disp);
 	if (err) {
 		return err;
 	}
@@ -764,16 +806,8 @@ static int tag_detect(enum st25r3911b_nfca_detect_cmd cmd)
 	uint32_t mask_timer;
 	uint32_t no_rsp_timer;
 
-	/* Set sending anticollision frame */
-	err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A, 0,
-				    ST25R3911B_REG_ISO14443A_ANTCL);
-	if (err) {
-		return err;
-	}
-
-	/* Rx data do not contain the CRC. */
-	err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY, 0,
-				    ST25R3911B_REG_AUXILIARY_NO_CRC_RX);
+	/* Set sending anticollision frame, Rx data do not contain the CRC. */
+	err = frame_mode_set(true);
 	if (err) {
 		return err;
 	}
@@ -781,17 +815,12 @@ static int tag_detect(enum st25r3911b_nfca_detect_cmd cmd)
 	mask_timer = NFCA_MIN_LISTEN_FDT -
 		     (ST25R3911B_FDT_ADJUST + NFCA_POLL_FTD_ADJUSMENT);
 
-	/* Set time when RX is not active after transmission */
-	err = st25r3911b_mask_receive_timer_set(mask_timer);
-	if (err) {
-		return err;
-	}
-
 	no_rsp_timer = NFCA_MIN_LISTEN_FDT + ST25R3911B_FDT_ADJUST + NFCA_FWT_A_ADJUSMENT;
 
-	/* Set time before it RX should be detected */
-	err = st25r3911b_non_response_timer_set(ST25R3911B_FC_TO_64FC(no_rsp_timer),
-						false, false);
+	/* Set time when RX is not active after transmission and
+	 * time before it RX should be detected.
+	 */
+	err = timers_set(mask_timer, ST25R3911B_FC_TO_64FC(no_rsp_timer), false);
 	if (err) {
 		return err;
 	}
@@ -863,22 +892,10 @@ static int transfer(const struct st25r3911b_nfca_buf *tx,
 	uint8_t cmd;
 	uint32_t irq;
 
-	/* Do not set sending anticollision frame */
-	err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A,
-				    ST25R3911B_REG_ISO14443A_ANTCL, 0);
-	if (err) {
-		return err;
-	}
-
-	err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY,
-				    ST25R3911B_REG_AUXILIARY_NO_CRC_RX, 0);
-	if (err) {
-		return err;
-	}
-
-	/* Read FIFO water level */
-	err = st25r3911b_fifo_reload_lvl_get(&nfca.water_lvl.tx,
-					     &nfca.water_lvl.rx);
+	/* Do not set sending anticollision frame. The FIFO water level
+	 * was read during the initialization.
+	 */
+	err = frame_mode_set(false);
 	if (err) {
 		return err;
 	}
@@ -924,7 +941,7 @@ static int transfer(const struct st25r3911b_nfca_buf *tx,
 	nfca.transfer.rx_buf = rx;
 
 	/* Set data length to send */
-	err = st25r3911b_tx_len_set(tx->len);
+	err = st25r3911b_tx_frame_len_set(tx->len, 0);
 	if (err) {
 		return err;
 	}
@@ -1081,6 +1098,9 @@ int st25r3911b_nfca_init(struct k_poll_event *events, uint8_t cnt,
 		return err;
 	}
 
+	/* Register configuration is not known after the reset */
+	memset(&nfca.regs, 0, sizeof(nfca.regs));
+
 	/* Initialize ST25R3911B */
 	err = st25r3911b_init();
 	if (err) {
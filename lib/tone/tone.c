@@ -14,6 +14,35 @@
 #define FREQ_LIMIT_LOW	100
 #define FREQ_LIMIT_HIGH 10000
 
+#if defined(CONFIG_TONE_OSC)
+#define OSC_TABLE_BITS 8
+
+/* One period of a Q15 sine, with the first sample repeated at the end for interpolation */
+static const int16_t osc_sine_table[BIT(OSC_TABLE_BITS) + 1] = {
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039,
+	11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159,
+	20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245,
+	27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571, 30852, 31113, 31356, 31580,
+	31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757, 32767, 32757, 32728,
+	32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329,
+	24811, 24279, 23731, 23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530,
+	16846, 16151, 15446, 14732, 14010, 13279, 12539, 11793, 11039, 10278, 9512, 8739, 7962,
+	7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804, 0, -804, -1608, -2410, -3212, -4011,
+	-4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793, -12539, -13279,
+	-14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787,
+	-21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852,
+	-31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678,
+	-32728, -32757, -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137,
+	-31971, -31785, -31580, -31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268,
+	-28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279,
+	-23731, -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530,
+	-16846, -16151, -15446, -14732, -14010, -13279, -12539, -11793, -11039, -10278, -9512,
+	-8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804, 0
+};
+#endif /* CONFIG_TONE_OSC */
+
 int tone_gen(int16_t *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t smpl_freq_hz,
 	     float amplitude)
 {
@@ -163,3 +192,65 @@ int tone_gen_size(void *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t
 
 	return 0;
 }
+
+#if defined(CONFIG_TONE_OSC)
+int tone_osc_init(struct tone_osc *osc, uint16_t tone_freq_hz, uint32_t smpl_freq_hz,
+		  float amplitude)
+{
+	if (osc == NULL) {
+		return -ENXIO;
+	}
+
+	if (tone_freq_hz < FREQ_LIMIT_LOW || tone_freq_hz > FREQ_LIMIT_HIGH ||
+	    smpl_freq_hz <= 2 * (uint32_t)tone_freq_hz) {
+		return -EINVAL;
+	}
+
+	if (amplitude > 1 || amplitude <= 0) {
+		return -EPERM;
+	}
+
+	osc->phase = 0;
+	osc->phase_inc = ((uint64_t)tone_freq_hz << 32) / smpl_freq_hz;
+	osc->amplitude = amplitude * INT16_MAX;
+
+	return 0;
+}
+
+/* Table value for the phase in Q31 format, linearly interpolated */
+static inline int32_t osc_sample(uint32_t phase)
+{
+	uint32_t idx = phase >> (32 - OSC_TABLE_BITS);
+	int32_t frac = (phase >> (16 - OSC_TABLE_BITS)) & UINT16_MAX;
+	int32_t val = osc_sine_table[idx];
+
+	return (val * (1 << 16)) + (osc_sine_table[idx + 1] - val) * frac;
+}
+
+int tone_osc_gen(struct tone_osc *osc, void *tone, size_t samples, uint8_t carrier_bits)
+{
+	if (osc == NULL || tone == NULL) {
+		return -ENXIO;
+	}
+
+	if (carrier_bits == 16) {
+		int16_t *out = tone;
+
+		for (size_t i = 0; i < samples; i++) {
+			out[i] = ((osc_sample(osc->phase) >> 16) * osc->amplitude) >> 15;
+			osc->phase += osc->phase_inc;
+		}
+	} else if (carrier_bits == 32) {
+		int32_t *out = tone;
+
+		for (size_t i = 0; i < samples; i++) {
+			out[i] = ((int64_t)osc_sample(osc->phase) * osc->amplitude) >> 15;
+			osc->phase += osc->phase_inc;
+		}
+	} else {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_TONE_OSC */
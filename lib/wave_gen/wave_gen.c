@@ -17,6 +17,19 @@ LOG_MODULE_REGISTER(wave_gen, CONFIG_WAVE_GEN_LIB_LOG_LEVEL);
 
 #include <wave_gen.h>
 
+#if defined(CONFIG_WAVE_GEN_LIB_SINE_TABLE)
+#define SINE_TABLE_BITS 6
+
+/* Quarter period of a Q15 sine, including the peak value */
+static const int16_t sine_table[BIT(SINE_TABLE_BITS) + 1] = {
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039,
+	11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159,
+	20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245,
+	27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571, 30852, 31113, 31356, 31580,
+	31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757, 32767
+};
+#endif /* CONFIG_WAVE_GEN_LIB_SINE_TABLE */
+
 /**
  * @brief Generates a pseudo-random number between -1 and 1.
  *
@@ -37,9 +50,37 @@ static double generate_pseudo_random(void)
  */
 static double sine_val(uint32_t time, uint32_t period)
 {
+#if defined(CONFIG_WAVE_GEN_LIB_SINE_TABLE)
+	/* Full range of the phase is one period, the two top bits select the quadrant */
+	uint32_t phase = ((uint64_t)time << 32) / period;
+	uint32_t quadrant = phase >> 30;
+	uint32_t pos = (phase >> 14) & UINT16_MAX;
+	uint32_t idx;
+	uint32_t frac;
+	int32_t res;
+
+	if (quadrant & 1) {
+		pos = BIT(16) - pos;
+	}
+
+	idx = pos >> (16 - SINE_TABLE_BITS);
+	frac = pos & (BIT(16 - SINE_TABLE_BITS) - 1);
+	res = sine_table[idx];
+
+	if (frac) {
+		res += ((sine_table[idx + 1] - res) * (int32_t)frac) >> (16 - SINE_TABLE_BITS);
+	}
+
+	if (quadrant & 2) {
+		res = -res;
+	}
+
+	return (double)res / INT16_MAX;
+#else
 	double angle = 2 * M_PI * time / period;
 
 	return sin(angle);
+#endif /* CONFIG_WAVE_GEN_LIB_SINE_TABLE */
 }
 
 /**
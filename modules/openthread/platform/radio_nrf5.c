@@ -1840,7 +1840,14 @@ static void openthread_nrf_802154_received_timestamp_raw(uint8_t *data, int8_t p
 		nrf5_data.rx.last_frame_ack_seb = false;
 
 		k_fifo_put(&nrf5_data.rx.fifo, &nrf5_data.rx.frames[i]);
-		set_pending_event(PENDING_EVENT_FRAME_RECEIVED);
+
+		/* Signal the OpenThread thread only for the first frame of a burst. Frames
+		 * queued before the thread clears the pending event are handled together.
+		 */
+		if (!atomic_test_and_set_bit(nrf5_data.pending_events,
+					     PENDING_EVENT_FRAME_RECEIVED)) {
+			otSysEventSignalPending();
+		}
 
 		return;
 	}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <psa/crypto.h>
+
+#define ITERATIONS CONFIG_APP_ITERATIONS
+#define MAX_PAYLOAD_SIZE 4096
+#define MAX_TAG_SIZE 16
+
+enum bench_type {
+	BENCH_HASH,
+	BENCH_MAC,
+	BENCH_CIPHER,
+	BENCH_AEAD,
+};
+
+struct bench {
+	const char *name;
+	enum bench_type type;
+	psa_algorithm_t alg;
+	psa_key_type_t key_type;
+	size_t key_bits;
+	/* Length of the IV or nonce. */
+	size_t iv_length;
+};
+
+static const struct bench benches[] = {
+	{"sha256", BENCH_HASH, PSA_ALG_SHA_256},
+	{"sha512", BENCH_HASH, PSA_ALG_SHA_512},
+	{"hmac-sha256", BENCH_MAC, PSA_ALG_HMAC(PSA_ALG_SHA_256), PSA_KEY_TYPE_HMAC, 256},
+	{"aes128-cmac", BENCH_MAC, PSA_ALG_CMAC, PSA_KEY_TYPE_AES, 128},
+	{"aes128-cbc", BENCH_CIPHER, PSA_ALG_CBC_NO_PADDING, PSA_KEY_TYPE_AES, 128, 16},
+	{"aes128-ctr", BENCH_CIPHER, PSA_ALG_CTR, PSA_KEY_TYPE_AES, 128, 16},
+	{"aes128-ccm", BENCH_AEAD, PSA_ALG_CCM, PSA_KEY_TYPE_AES, 128, 13},
+	{"aes128-gcm", BENCH_AEAD, PSA_ALG_GCM, PSA_KEY_TYPE_AES, 128, 12},
+	{"chacha20-poly1305", BENCH_AEAD, PSA_ALG_CHACHA20_POLY1305, PSA_KEY_TYPE_CHACHA20, 256,
+	 12},
+};
+
+static const size_t payload_sizes[] = {16, 64, 256, 1024, MAX_PAYLOAD_SIZE};
+
+static uint8_t input[MAX_PAYLOAD_SIZE];
+static uint8_t output[MAX_PAYLOAD_SIZE + MAX_TAG_SIZE];
+static const uint8_t iv[16];
+
+static psa_status_t key_import(const struct bench *bench, psa_key_id_t *key_id)
+{
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+	static const uint8_t key[32] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6};
+
+	psa_set_key_type(&attr, bench->key_type);
+	psa_set_key_bits(&attr, bench->key_bits);
+	psa_set_key_algorithm(&attr, bench->alg);
+	psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_SIGN_MESSAGE);
+
+	return psa_import_key(&attr, key, PSA_BITS_TO_BYTES(bench->key_bits), key_id);
+}
+
+static psa_status_t cipher_encrypt(psa_key_id_t key_id, const struct bench *bench, size_t size)
+{
+	psa_cipher_operation_t operation = PSA_CIPHER_OPERATION_INIT;
+	size_t length;
+	size_t finish_length;
+	psa_status_t status;
+
+	/* The multi-part API is used to have a fixed IV instead of a generated one. */
+	status = psa_cipher_encrypt_setup(&operation, key_id, bench->alg);
+	if (status == PSA_SUCCESS) {
+		status = psa_cipher_set_iv(&operation, iv, bench->iv_length);
+	}
+	if (status == PSA_SUCCESS) {
+		status = psa_cipher_update(&operation, input, size, output, sizeof(output),
+					   &length);
+	}
+	if (status == PSA_SUCCESS) {
+		status = psa_cipher_finish(&operation, output + length, sizeof(output) - length,
+					   &finish_length);
+	}
+	if (status != PSA_SUCCESS) {
+		(void)psa_cipher_abort(&operation);
+	}
+
+	return status;
+}
+
+static psa_status_t run_once(psa_key_id_t key_id, const struct bench *bench, size_t size)
+{
+	size_t length;
+
+	switch (bench->type) {
+	case BENCH_HASH:
+		return psa_hash_compute(bench->alg, input, size, output, sizeof(output), &length);
+	case BENCH_MAC:
+		return psa_mac_compute(key_id, bench->alg, input, size, output, sizeof(output),
+				       &length);
+	case BENCH_CIPHER:
+		return cipher_encrypt(key_id, bench, size);
+	case BENCH_AEAD:
+		return psa_aead_encrypt(key_id, bench->alg, iv, bench->iv_length, NULL, 0, input,
+					size, output, sizeof(output), &length);
+	default:
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+}
+
+static void run_bench(const struct bench *bench)
+{
+	psa_key_id_t key_id = PSA_KEY_ID_NULL;
+	psa_status_t status;
+	uint32_t start;
+	uint32_t cycles;
+	uint64_t latency_ns;
+	uint64_t throughput;
+
+	if (bench->type != BENCH_HASH) {
+		status = key_import(bench, &key_id);
+		if (status != PSA_SUCCESS) {
+			printk("csv,%s,%s,0,0,0,0,%d\n", CONFIG_APP_DRIVER_NAME, bench->name,
+			       status);
+			return;
+		}
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(payload_sizes); i++) {
+		size_t size = payload_sizes[i];
+
+		/* The first operation is not measured, so that one-time initialization, like
+		 * powering up an accelerator, does not distort the results.
+		 */
+		status = run_once(key_id, bench, size);
+
+		start = k_cycle_get_32();
+		for (int n = 0; n < ITERATIONS && status == PSA_SUCCESS; n++) {
+			status = run_once(key_id, bench, size);
+		}
+		cycles = MAX(k_cycle_get_32() - start, 1);
+
+		if (status != PSA_SUCCESS) {
+			printk("csv,%s,%s,%zu,0,0,0,%d\n", CONFIG_APP_DRIVER_NAME, bench->name,
+			       size, status);
+			continue;
+		}
+
+		latency_ns = ((uint64_t)cycles * NSEC_PER_SEC) /
+			     ((uint64_t)sys_clock_hw_cycles_per_sec() * ITERATIONS);
+		throughput = ((uint64_t)size * ITERATIONS * sys_clock_hw_cycles_per_sec()) /
+			     cycles;
+
+		printk("csv,%s,%s,%zu,%d,%llu,%llu,0\n", CONFIG_APP_DRIVER_NAME, bench->name,
+		       size, ITERATIONS, latency_ns, throughput);
+	}
+
+	if (key_id != PSA_KEY_ID_NULL) {
+		(void)psa_destroy_key(key_id);
+	}
+}
+
+int main(void)
+{
+	psa_status_t status;
+
+	printk("PSA Crypto benchmark started\n");
+
+	status = psa_crypto_init();
+	if (status != PSA_SUCCESS) {
+		printk("psa_crypto_init failed (%d)\n", status);
+		return 0;
+	}
+
+	for (size_t i = 0; i < sizeof(input); i++) {
+		input[i] = i;
+	}
+
+	/* Lines starting with "csv," are the results, in comma-separated values. */
+	printk("csv,driver,algorithm,payload_bytes,iterations,latency_ns,throughput_bytes_per_s,"
+	       "status\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(benches); i++) {
+		run_bench(&benches[i]);
+	}
+
+	printk("PSA Crypto benchmark finished\n");
+
+	return 0;
+}
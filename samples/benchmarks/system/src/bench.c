@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+
+#include "bench.h"
+
+#define ITERATIONS CONFIG_APP_ITERATIONS
+#define WARMUP_ITERATIONS CONFIG_APP_WARMUP_ITERATIONS
+
+struct bench_result {
+	uint64_t total;
+	uint32_t min;
+	uint32_t max;
+	int status;
+};
+
+static void bench_measure(const struct bench_case *bench, struct bench_result *result)
+{
+	uint32_t start;
+	uint32_t cycles;
+
+	*result = (struct bench_result){.min = UINT32_MAX};
+
+	for (int i = 0; i < WARMUP_ITERATIONS; i++) {
+		result->status = bench->run();
+		if (result->status) {
+			return;
+		}
+	}
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		start = k_cycle_get_32();
+		result->status = bench->run();
+		cycles = k_cycle_get_32() - start;
+
+		if (result->status) {
+			return;
+		}
+
+		result->total += cycles;
+		result->min = MIN(result->min, cycles);
+		result->max = MAX(result->max, cycles);
+	}
+}
+
+static void bench_print(const char *suite, const struct bench_case *bench,
+			const struct bench_result *result)
+{
+	uint64_t mean_ns = 0;
+	uint64_t min_ns = 0;
+	uint64_t max_ns = 0;
+	uint64_t throughput = 0;
+
+	if (result->status == 0) {
+		mean_ns = k_cyc_to_ns_floor64(result->total / ITERATIONS);
+		min_ns = k_cyc_to_ns_floor64(result->min);
+		max_ns = k_cyc_to_ns_floor64(result->max);
+
+		if (bench->bytes && result->total) {
+			throughput = ((uint64_t)bench->bytes * ITERATIONS *
+				      sys_clock_hw_cycles_per_sec()) / result->total;
+		}
+	}
+
+	printk("{\"board\":\"%s\",\"suite\":\"%s\",\"case\":\"%s\",\"iterations\":%d,"
+	       "\"bytes\":%zu,\"mean_ns\":%llu,\"min_ns\":%llu,\"max_ns\":%llu,"
+	       "\"throughput_bytes_per_s\":%llu,\"status\":%d}\n",
+	       CONFIG_BOARD_TARGET, suite, bench->name, ITERATIONS, bench->bytes, mean_ns,
+	       min_ns, max_ns, throughput, result->status);
+}
+
+void bench_suite_run(const char *suite, const struct bench_case *cases, size_t count)
+{
+	struct bench_result result;
+
+	for (size_t i = 0; i < count; i++) {
+		const struct bench_case *bench = &cases[i];
+
+		result = (struct bench_result){0};
+
+		if (bench->setup) {
+			result.status = bench->setup();
+		}
+
+		if (result.status == 0) {
+			bench_measure(bench, &result);
+		}
+
+		if (bench->teardown) {
+			bench->teardown();
+		}
+
+		bench_print(suite, bench, &result);
+	}
+}
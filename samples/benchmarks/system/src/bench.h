@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stddef.h>
+
+/** A single benchmark of a suite. */
+struct bench_case {
+	/** Name of the benchmark, unique within the suite. */
+	const char *name;
+	/** Number of payload bytes processed by one iteration, or 0. */
+	size_t bytes;
+	/** Function called once before the warm-up iterations, or NULL. */
+	int (*setup)(void);
+	/** Function measured in every iteration. */
+	int (*run)(void);
+	/** Function called once after the measurement, or NULL. */
+	void (*teardown)(void);
+};
+
+/** @brief Run the benchmarks of a suite and print a JSON result line for each of them.
+ *
+ * @param suite Name of the suite.
+ * @param cases Benchmarks of the suite.
+ * @param count Number of benchmarks.
+ */
+void bench_suite_run(const char *suite, const struct bench_case *cases, size_t count);
+
+/* Entry points of the suites. A suite is built when the benchmarked library is enabled. */
+void bench_app_event_manager(void);
+void bench_data_fifo(void);
+void bench_pcm_mix(void);
+void bench_sample_rate_converter(void);
+void bench_at_parser(void);
+void bench_cbor(void);
+void bench_psa_crypto(void);
+
+#endif /* BENCH_H_ */
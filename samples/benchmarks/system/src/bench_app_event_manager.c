@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <app_event_manager.h>
+
+#include "bench.h"
+
+struct bench_event {
+	struct app_event_header header;
+
+	uint32_t value;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_event);
+APP_EVENT_TYPE_DEFINE(bench_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
+
+static K_SEM_DEFINE(dispatched_sem, 0, 1);
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_bench_event(aeh)) {
+		k_sem_give(&dispatched_sem);
+	}
+
+	return false;
+}
+
+APP_EVENT_LISTENER(bench, app_event_handler);
+APP_EVENT_SUBSCRIBE(bench, bench_event);
+
+static int alloc_free(void)
+{
+	struct bench_event *event = new_bench_event();
+
+	app_event_manager_free(event);
+
+	return 0;
+}
+
+static int submit_dispatch(void)
+{
+	struct bench_event *event = new_bench_event();
+
+	event->value = 1;
+	APP_EVENT_SUBMIT(event);
+
+	/* The event is processed in the system workqueue. */
+	return k_sem_take(&dispatched_sem, K_SECONDS(1));
+}
+
+static const struct bench_case cases[] = {
+	{.name = "alloc_free", .run = alloc_free},
+	{.name = "submit_dispatch", .run = submit_dispatch},
+};
+
+void bench_app_event_manager(void)
+{
+	int err;
+
+	err = app_event_manager_init();
+	if (err) {
+		printk("Application Event Manager not initialized (%d)\n", err);
+		return;
+	}
+
+	bench_suite_run("app_event_manager", cases, ARRAY_SIZE(cases));
+}
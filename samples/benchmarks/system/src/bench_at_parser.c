@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <modem/at_parser.h>
+
+#include "bench.h"
+
+static const char cereg[] =
+	"+CEREG: 5,\"4E2C\",\"0140D20E\",7,,,\"11100000\",\"11100000\"\r\n";
+
+static const char xmonitor[] =
+	"%XMONITOR: 1,\"Operator\",\"OP\",\"24201\",\"4E2C\",7,20,\"0140D20E\","
+	"7,6400,50,34,\"\",\"11100000\",\"11100000\",\"01001001\"\r\n";
+
+static int parse(const char *at, size_t params)
+{
+	struct at_parser parser;
+	size_t count;
+	uint16_t value;
+	const char *str;
+	size_t len;
+	int err;
+
+	err = at_parser_init(&parser, at);
+	if (err) {
+		return err;
+	}
+
+	err = at_parser_cmd_count_get(&parser, &count);
+	if (err) {
+		return err;
+	}
+
+	if (count != params) {
+		return -EBADMSG;
+	}
+
+	err = at_parser_num_get(&parser, 1, &value);
+	if (err) {
+		return err;
+	}
+
+	return at_parser_string_ptr_get(&parser, 2, &str, &len);
+}
+
+static int parse_cereg(void)
+{
+	return parse(cereg, 9);
+}
+
+static int parse_xmonitor(void)
+{
+	return parse(xmonitor, 17);
+}
+
+static const struct bench_case cases[] = {
+	{.name = "cereg", .bytes = sizeof(cereg) - 1, .run = parse_cereg},
+	{.name = "xmonitor", .bytes = sizeof(xmonitor) - 1, .run = parse_xmonitor},
+};
+
+void bench_at_parser(void)
+{
+	bench_suite_run("at_parser", cases, ARRAY_SIZE(cases));
+}
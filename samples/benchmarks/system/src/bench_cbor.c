@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zcbor_encode.h>
+
+#include "bench.h"
+
+#define SAMPLES_NUM 8
+
+static uint8_t payload[256];
+static size_t payload_len;
+
+/* Encodes a message like the ones sent to the cloud by the sensor samples:
+ * {"appId": "TEMP", "ts": <timestamp>, "data": [<samples>]}.
+ */
+static int encode_sensor_message(void)
+{
+	ZCBOR_STATE_E(state, 1, payload, sizeof(payload), 1);
+	bool ok;
+
+	ok = zcbor_map_start_encode(state, 3) &&
+	     zcbor_tstr_put_lit(state, "appId") &&
+	     zcbor_tstr_put_lit(state, "TEMP") &&
+	     zcbor_tstr_put_lit(state, "ts") &&
+	     zcbor_uint64_put(state, 1767225600000ULL) &&
+	     zcbor_tstr_put_lit(state, "data") &&
+	     zcbor_list_start_encode(state, SAMPLES_NUM);
+
+	for (int i = 0; ok && i < SAMPLES_NUM; i++) {
+		ok = zcbor_float64_put(state, 21.5 + i);
+	}
+
+	ok = ok && zcbor_list_end_encode(state, SAMPLES_NUM) &&
+	     zcbor_map_end_encode(state, 3);
+	if (!ok) {
+		return -ENOMEM;
+	}
+
+	payload_len = state->payload - payload;
+
+	return 0;
+}
+
+static struct bench_case cases[] = {
+	{.name = "sensor_message", .run = encode_sensor_message},
+};
+
+void bench_cbor(void)
+{
+	/* The throughput is given for the encoded message. */
+	if (encode_sensor_message() == 0) {
+		cases[0].bytes = payload_len;
+	}
+
+	bench_suite_run("cbor", cases, ARRAY_SIZE(cases));
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <data_fifo.h>
+
+#include "bench.h"
+
+#define BLOCK_SIZE 192
+#define BLOCKS_NUM 4
+
+DATA_FIFO_DEFINE(bench_fifo, BLOCKS_NUM, BLOCK_SIZE);
+
+static int fifo_setup(void)
+{
+	return data_fifo_init(&bench_fifo);
+}
+
+static int put_get(void)
+{
+	void *data;
+	size_t size;
+	int ret;
+
+	ret = data_fifo_pointer_first_vacant_get(&bench_fifo, &data, K_NO_WAIT);
+	if (ret) {
+		return ret;
+	}
+
+	ret = data_fifo_block_lock(&bench_fifo, &data, BLOCK_SIZE);
+	if (ret) {
+		return ret;
+	}
+
+	ret = data_fifo_pointer_last_filled_get(&bench_fifo, &data, &size, K_NO_WAIT);
+	if (ret) {
+		return ret;
+	}
+
+	data_fifo_block_free(&bench_fifo, data);
+
+	return 0;
+}
+
+static const struct bench_case cases[] = {
+	{.name = "put_get", .bytes = BLOCK_SIZE, .setup = fifo_setup, .run = put_get},
+};
+
+void bench_data_fifo(void)
+{
+	bench_suite_run("data_fifo", cases, ARRAY_SIZE(cases));
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <pcm_mix.h>
+
+#include "bench.h"
+
+/* 10 ms of 16-bit stereo audio at 48 kHz. */
+#define SAMPLES_PER_CH 480
+#define STEREO_SIZE (SAMPLES_PER_CH * 2 * sizeof(int16_t))
+#define MONO_SIZE (SAMPLES_PER_CH * sizeof(int16_t))
+
+static int16_t pcm_a[SAMPLES_PER_CH * 2] __aligned(4);
+static int16_t pcm_b[SAMPLES_PER_CH * 2] __aligned(4);
+
+static int pcm_setup(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pcm_b); i++) {
+		pcm_a[i] = (int16_t)(i * 67);
+		pcm_b[i] = (int16_t)(i * 131);
+	}
+
+	return 0;
+}
+
+static int stereo_into_stereo(void)
+{
+	return pcm_mix(pcm_a, STEREO_SIZE, pcm_b, STEREO_SIZE, B_STEREO_INTO_A_STEREO);
+}
+
+static int mono_into_stereo(void)
+{
+	return pcm_mix(pcm_a, STEREO_SIZE, pcm_b, MONO_SIZE, B_MONO_INTO_A_STEREO_LR);
+}
+
+static const struct bench_case cases[] = {
+	{.name = "stereo_into_stereo", .bytes = STEREO_SIZE, .setup = pcm_setup,
+	 .run = stereo_into_stereo},
+	{.name = "mono_into_stereo_lr", .bytes = STEREO_SIZE, .setup = pcm_setup,
+	 .run = mono_into_stereo},
+};
+
+void bench_pcm_mix(void)
+{
+	bench_suite_run("pcm_mix", cases, ARRAY_SIZE(cases));
+}
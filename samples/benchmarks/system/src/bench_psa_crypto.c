@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <psa/crypto.h>
+
+#include "bench.h"
+
+/* For a comparison of algorithms and drivers, see the PSA Crypto benchmark sample. */
+#define PAYLOAD_SIZE 256
+#define TAG_SIZE 16
+#define NONCE_SIZE 13
+
+static uint8_t input[PAYLOAD_SIZE];
+static uint8_t output[PAYLOAD_SIZE + TAG_SIZE];
+static const uint8_t nonce[NONCE_SIZE];
+static psa_key_id_t key_id;
+
+static int sha256(void)
+{
+	size_t length;
+
+	return psa_hash_compute(PSA_ALG_SHA_256, input, sizeof(input), output, sizeof(output),
+				&length);
+}
+
+static int aes_ccm_setup(void)
+{
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+	static const uint8_t key[16] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6};
+
+	psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attr, 128);
+	psa_set_key_algorithm(&attr, PSA_ALG_CCM);
+	psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_ENCRYPT);
+
+	return psa_import_key(&attr, key, sizeof(key), &key_id);
+}
+
+static int aes_ccm(void)
+{
+	size_t length;
+
+	return psa_aead_encrypt(key_id, PSA_ALG_CCM, nonce, sizeof(nonce), NULL, 0, input,
+				sizeof(input), output, sizeof(output), &length);
+}
+
+static void aes_ccm_teardown(void)
+{
+	(void)psa_destroy_key(key_id);
+	key_id = PSA_KEY_ID_NULL;
+}
+
+static int generate_random(void)
+{
+	return psa_generate_random(output, 32);
+}
+
+static const struct bench_case cases[] = {
+	{.name = "sha256", .bytes = PAYLOAD_SIZE, .run = sha256},
+	{.name = "aes128_ccm_encrypt", .bytes = PAYLOAD_SIZE, .setup = aes_ccm_setup,
+	 .run = aes_ccm, .teardown = aes_ccm_teardown},
+	{.name = "generate_random", .bytes = 32, .run = generate_random},
+};
+
+void bench_psa_crypto(void)
+{
+	psa_status_t status;
+
+	status = psa_crypto_init();
+	if (status != PSA_SUCCESS) {
+		printk("psa_crypto_init failed (%d)\n", status);
+		return;
+	}
+
+	for (size_t i = 0; i < sizeof(input); i++) {
+		input[i] = i;
+	}
+
+	bench_suite_run("psa_crypto", cases, ARRAY_SIZE(cases));
+}
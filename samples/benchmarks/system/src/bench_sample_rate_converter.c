@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <sample_rate_converter.h>
+
+#include "bench.h"
+
+/* 10 ms of 16-bit mono audio at 48 kHz. */
+#define BLOCK_SAMPLES 480
+#define BLOCK_SIZE (BLOCK_SAMPLES * sizeof(int16_t))
+
+BUILD_ASSERT(IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16),
+	     "The benchmark uses 16-bit samples");
+BUILD_ASSERT(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX >= BLOCK_SAMPLES);
+
+static struct sample_rate_converter_ctx ctx;
+static int16_t input[BLOCK_SAMPLES];
+static int16_t output[BLOCK_SAMPLES];
+
+static int src_setup(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(input); i++) {
+		input[i] = (int16_t)(i * 67);
+	}
+
+	return sample_rate_converter_open(&ctx);
+}
+
+static int convert(size_t input_size, uint32_t input_rate, uint32_t output_rate)
+{
+	size_t written;
+
+	return sample_rate_converter_process(&ctx, SAMPLE_RATE_FILTER_SIMPLE, input, input_size,
+					     input_rate, output, sizeof(output), &written,
+					     output_rate);
+}
+
+static int decimate_48k_24k(void)
+{
+	return convert(BLOCK_SIZE, 48000, 24000);
+}
+
+static int interpolate_24k_48k(void)
+{
+	return convert(BLOCK_SIZE / 2, 24000, 48000);
+}
+
+static const struct bench_case cases[] = {
+	{.name = "decimate_48k_24k", .bytes = BLOCK_SIZE, .setup = src_setup,
+	 .run = decimate_48k_24k},
+	{.name = "interpolate_24k_48k", .bytes = BLOCK_SIZE / 2, .setup = src_setup,
+	 .run = interpolate_24k_48k},
+};
+
+void bench_sample_rate_converter(void)
+{
+	bench_suite_run("sample_rate_converter", cases, ARRAY_SIZE(cases));
+}
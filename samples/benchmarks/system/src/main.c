@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+
+#include "bench.h"
+
+int main(void)
+{
+	printk("System benchmark started\n");
+
+	/* Every line starting with '{' is the result of one benchmark, as a JSON object. */
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER)) {
+		bench_app_event_manager();
+	}
+
+	if (IS_ENABLED(CONFIG_DATA_FIFO)) {
+		bench_data_fifo();
+	}
+
+	if (IS_ENABLED(CONFIG_PCM_MIX)) {
+		bench_pcm_mix();
+	}
+
+	if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER)) {
+		bench_sample_rate_converter();
+	}
+
+	if (IS_ENABLED(CONFIG_AT_PARSER)) {
+		bench_at_parser();
+	}
+
+	if (IS_ENABLED(CONFIG_ZCBOR)) {
+		bench_cbor();
+	}
+
+	if (IS_ENABLED(CONFIG_PSA_CRYPTO)) {
+		bench_psa_crypto();
+	}
+
+	printk("System benchmark finished\n");
+
+	return 0;
+}
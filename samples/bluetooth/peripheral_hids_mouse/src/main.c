@@ -646,6 +646,13 @@ static void hid_init(void)
 	struct bt_hids_init_param hids_init_param = { 0 };
 	struct bt_hids_inp_rep *hids_inp_rep;
 	static const uint8_t mouse_movement_mask[DIV_ROUND_UP(INPUT_REP_MOVEMENT_LEN, 8)] = {0};
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	/* X and Y, 12-bit each */
+	static const struct bt_hids_rel_field mouse_movement_fields[] = {
+		{ .offset = 0, .size = 12 },
+		{ .offset = 12, .size = 12 },
+	};
+#endif
 
 	static const uint8_t report_map[] = {
 		0x05, 0x01,     /* Usage Page (Generic Desktop) */
@@ -742,6 +749,10 @@ static void hid_init(void)
 	hids_inp_rep->size = INPUT_REP_MOVEMENT_LEN;
 	hids_inp_rep->id = INPUT_REP_REF_MOVEMENT_ID;
 	hids_inp_rep->rep_mask = mouse_movement_mask;
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	hids_inp_rep->rel_fields = mouse_movement_fields;
+	hids_inp_rep->rel_field_cnt = ARRAY_SIZE(mouse_movement_fields);
+#endif
 	hids_init_param.inp_rep_group_init.cnt++;
 
 	hids_inp_rep++;
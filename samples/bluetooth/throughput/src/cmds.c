@@ -5,12 +5,14 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <zephyr/bluetooth/conn.h>
 
 #include <errno.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/types.h>
+#include <zephyr/sys/util.h>
 
 #include "main.h"
 
@@ -25,19 +27,37 @@
 /* Requesting frame space of 0 us will result in the minimum frame space being used. */
 #define REQUEST_MIN_FRAME_SPACE_US 0
 
-static struct test_params {
-	struct bt_le_conn_param *conn_param;
-	struct bt_conn_le_phy_param *phy;
-	struct bt_conn_le_data_len_param *data_len;
-	uint16_t frame_space_us;
-} test_params = {
-	.conn_param = BT_LE_CONN_PARAM(INTERVAL_MIN, INTERVAL_MAX, CONN_LATENCY,
-				       SUPERVISION_TIMEOUT),
-	.phy = BT_CONN_LE_PHY_PARAM_2M,
-	.data_len = BT_LE_DATA_LEN_PARAM_MAX,
-	.frame_space_us = REQUEST_MIN_FRAME_SPACE_US,
+#define TEST_PARAMS_INIT(_i, _)							\
+	{									\
+		.conn_param = BT_LE_CONN_PARAM_INIT(INTERVAL_MIN, INTERVAL_MAX,	\
+						    CONN_LATENCY,		\
+						    SUPERVISION_TIMEOUT),	\
+		.phy = BT_CONN_LE_PHY_PARAM_INIT(BT_GAP_LE_PHY_2M,		\
+						 BT_GAP_LE_PHY_2M),		\
+		.data_len = BT_LE_DATA_LEN_PARAM_INIT(BT_GAP_DATA_LEN_MAX,	\
+						      BT_GAP_DATA_TIME_MAX),	\
+		.frame_space_us = REQUEST_MIN_FRAME_SPACE_US,			\
+	}
+
+#define LINK_ALL (-1)
+
+static struct test_params test_params[LINK_COUNT] = {
+	LISTIFY(LINK_COUNT, TEST_PARAMS_INIT, (,))
 };
 
+/* The link that the configuration commands apply to */
+static int selected_link = LINK_ALL;
+
+#define FOR_EACH_SELECTED_LINK(_p)						\
+	for (_p = &test_params[0]; _p < &test_params[LINK_COUNT]; _p++)		\
+		if ((selected_link == LINK_ALL) ||				\
+		    (_p == &test_params[selected_link]))
+
+static struct test_params *first_selected_link(void)
+{
+	return &test_params[(selected_link == LINK_ALL) ? 0 : selected_link];
+}
+
 static const char *phy_str(const struct bt_conn_le_phy_param *phy)
 {
 	static const char *const str[] = {
@@ -67,6 +87,17 @@ static const char *phy_str(const struct bt_conn_le_phy_param *phy)
 	}
 }
 
+static void phy_set(uint8_t phy, uint8_t options)
+{
+	struct test_params *params;
+
+	FOR_EACH_SELECTED_LINK(params) {
+		params->phy.options = options;
+		params->phy.pref_rx_phy = phy;
+		params->phy.pref_tx_phy = phy;
+	}
+}
+
 static int default_cmd(const struct shell *shell, size_t argc,
 		       char **argv)
 {
@@ -91,11 +122,9 @@ static int default_cmd(const struct shell *shell, size_t argc,
 static int cmd_phy_1m(const struct shell *shell, size_t argc,
 		      char **argv)
 {
-	test_params.phy->options = BT_CONN_LE_PHY_OPT_NONE;
-	test_params.phy->pref_rx_phy = BT_GAP_LE_PHY_1M;
-	test_params.phy->pref_tx_phy = BT_GAP_LE_PHY_1M;
+	phy_set(BT_GAP_LE_PHY_1M, BT_CONN_LE_PHY_OPT_NONE);
 
-	shell_print(shell, "PHY set to: %s", phy_str(test_params.phy));
+	shell_print(shell, "PHY set to: %s", phy_str(&first_selected_link()->phy));
 
 	return 0;
 }
@@ -103,11 +132,9 @@ static int cmd_phy_1m(const struct shell *shell, size_t argc,
 static int cmd_phy_2m(const struct shell *shell, size_t argc,
 		      char **argv)
 {
-	test_params.phy->options = BT_CONN_LE_PHY_OPT_NONE;
-	test_params.phy->pref_rx_phy = BT_GAP_LE_PHY_2M;
-	test_params.phy->pref_tx_phy = BT_GAP_LE_PHY_2M;
+	phy_set(BT_GAP_LE_PHY_2M, BT_CONN_LE_PHY_OPT_NONE);
 
-	shell_print(shell, "PHY set to: %s", phy_str(test_params.phy));
+	shell_print(shell, "PHY set to: %s", phy_str(&first_selected_link()->phy));
 
 	return 0;
 }
@@ -116,11 +143,9 @@ static int cmd_phy_2m(const struct shell *shell, size_t argc,
 static int cmd_phy_coded_s2(const struct shell *shell, size_t argc,
 			    char **argv)
 {
-	test_params.phy->options = BT_CONN_LE_PHY_OPT_CODED_S2;
-	test_params.phy->pref_rx_phy = BT_GAP_LE_PHY_CODED;
-	test_params.phy->pref_tx_phy = BT_GAP_LE_PHY_CODED;
+	phy_set(BT_GAP_LE_PHY_CODED, BT_CONN_LE_PHY_OPT_CODED_S2);
 
-	shell_print(shell, "PHY set to: %s", phy_str(test_params.phy));
+	shell_print(shell, "PHY set to: %s", phy_str(&first_selected_link()->phy));
 
 	return 0;
 }
@@ -132,12 +157,10 @@ static int cmd_phy_coded_s2(const struct shell *shell, size_t argc,
 static int cmd_phy_coded_s8(const struct shell *shell, size_t argc,
 			    char **argv)
 {
-	test_params.phy->options = BT_CONN_LE_PHY_OPT_CODED_S8;
-	test_params.phy->pref_rx_phy = BT_GAP_LE_PHY_CODED;
-	test_params.phy->pref_tx_phy = BT_GAP_LE_PHY_CODED;
+	phy_set(BT_GAP_LE_PHY_CODED, BT_CONN_LE_PHY_OPT_CODED_S8);
 
 	shell_print(shell, "PHY set to: %s",
-		    phy_str(test_params.phy));
+		    phy_str(&first_selected_link()->phy));
 
 	return 0;
 }
@@ -148,6 +171,7 @@ static int cmd_phy_coded_s8(const struct shell *shell, size_t argc,
 static int data_len_cmd(const struct shell *shell, size_t argc,
 			char **argv)
 {
+	struct test_params *params;
 	uint16_t data_len;
 
 	if (argc == 1) {
@@ -172,8 +196,10 @@ static int data_len_cmd(const struct shell *shell, size_t argc,
 		return -EINVAL;
 	}
 
-	test_params.data_len->tx_max_len = data_len;
-	test_params.data_len->tx_max_time = BT_GAP_DATA_TIME_MAX;
+	FOR_EACH_SELECTED_LINK(params) {
+		params->data_len.tx_max_len = data_len;
+		params->data_len.tx_max_time = BT_GAP_DATA_TIME_MAX;
+	}
 
 	shell_print(shell, "LE Data Packet Length set to: %d", data_len);
 
@@ -183,6 +209,7 @@ static int data_len_cmd(const struct shell *shell, size_t argc,
 static int conn_interval_cmd(const struct shell *shell, size_t argc,
 			     char **argv)
 {
+	struct test_params *params;
 	uint16_t interval;
 
 	if (argc == 1) {
@@ -207,10 +234,12 @@ static int conn_interval_cmd(const struct shell *shell, size_t argc,
 		return -EINVAL;
 	}
 
-	test_params.conn_param->interval_max = interval;
-	test_params.conn_param->interval_min = interval;
-	test_params.conn_param->latency = 0;
-	test_params.conn_param->timeout = SUPERVISION_TIMEOUT;
+	FOR_EACH_SELECTED_LINK(params) {
+		params->conn_param.interval_max = interval;
+		params->conn_param.interval_min = interval;
+		params->conn_param.latency = 0;
+		params->conn_param.timeout = SUPERVISION_TIMEOUT;
+	}
 
 	shell_print(shell, "Connection interval set to: %d",
 		    interval);
@@ -222,6 +251,7 @@ static int conn_interval_cmd(const struct shell *shell, size_t argc,
 static int frame_space_cmd(const struct shell *shell, size_t argc,
 			     char **argv)
 {
+	struct test_params *params;
 	int64_t frame_space_us;
 
 	if (argc == 1) {
@@ -243,9 +273,11 @@ static int frame_space_cmd(const struct shell *shell, size_t argc,
 		return -EINVAL;
 	}
 
-	test_params.frame_space_us = (uint16_t)frame_space_us;
+	FOR_EACH_SELECTED_LINK(params) {
+		params->frame_space_us = (uint16_t)frame_space_us;
+	}
 
-	shell_print(shell, "Minimum frame space: %d us", test_params.frame_space_us);
+	shell_print(shell, "Minimum frame space: %d us", (uint16_t)frame_space_us);
 	return 0;
 }
 #endif
@@ -254,16 +286,61 @@ static int print_cmd(const struct shell *shell, size_t argc,
 		     char **argv)
 {
 	shell_print(shell, "==== Current test configuration ====\n");
-	shell_print(shell, "Data length:\t\t%d\n"
-		    "Connection interval:\t%d units\n"
-		    "Preferred PHY:\t\t%s\n"
-		    "Frame space:\t\t%d us\n",
-		    test_params.data_len->tx_max_len,
-		    test_params.conn_param->interval_min,
-		    phy_str(test_params.phy),
-		    test_params.frame_space_us);
+
+	for (size_t i = 0; i < ARRAY_SIZE(test_params); i++) {
+		if (LINK_COUNT > 1) {
+			shell_print(shell, "Link %zu:", i);
+		}
+
+		shell_print(shell, "Data length:\t\t%d\n"
+			    "Connection interval:\t%d units\n"
+			    "Preferred PHY:\t\t%s\n"
+			    "Frame space:\t\t%d us\n",
+			    test_params[i].data_len.tx_max_len,
+			    test_params[i].conn_param.interval_min,
+			    phy_str(&test_params[i].phy),
+			    test_params[i].frame_space_us);
+	}
+
+	return 0;
+}
+
+#if LINK_COUNT > 1
+static int link_cmd(const struct shell *shell, size_t argc, char **argv)
+{
+	long link;
+
+	if (argc == 1) {
+		shell_help(shell);
+		return SHELL_CMD_HELP_PRINTED;
+	}
+
+	if (argc > 2) {
+		shell_error(shell, "%s: bad parameters count", argv[0]);
+		return -EINVAL;
+	}
+
+	if (!strcmp(argv[1], "all")) {
+		selected_link = LINK_ALL;
+		shell_print(shell, "Configuring all links");
+		return 0;
+	}
+
+	link = strtol(argv[1], NULL, 10);
+
+	if ((link < 0) || (link >= LINK_COUNT)) {
+		shell_error(shell, "%s: Invalid setting: %s", argv[0], argv[1]);
+		shell_error(shell, "Link must be \"all\" or between: 0 and %d",
+			    LINK_COUNT - 1);
+		return -EINVAL;
+	}
+
+	selected_link = link;
+	shell_print(shell, "Configuring link %ld", link);
+
 	return 0;
 }
+#endif /* LINK_COUNT > 1 */
 
 SHELL_STATIC_SUBCMD_SET_CREATE(phy_sub,
 	SHELL_CMD(1M, NULL, "Set preferred PHY to 1Mbps", cmd_phy_1m),
@@ -289,6 +366,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_config,
 	SHELL_CMD(frame_space, NULL, "Configure frame space <us>", frame_space_cmd),
 #endif
 	SHELL_CMD(print, NULL, "Print current configuration", print_cmd),
+#if LINK_COUNT > 1
+	SHELL_CMD(link, NULL,
+		  "Select the link that the configuration applies to <index|all>",
+		  link_cmd),
+#endif
 	SHELL_SUBCMD_SET_END
 );
 
@@ -296,8 +378,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_config,
 static int test_run_cmd(const struct shell *shell, size_t argc,
 			char **argv)
 {
-	return test_run(shell, test_params.conn_param, test_params.phy,
-			test_params.data_len, test_params.frame_space_us);
+	return test_run(shell, test_params);
 }
 
 static int test_central_cmd(const struct shell *shell, size_t argc,
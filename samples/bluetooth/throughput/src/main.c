@@ -25,6 +25,10 @@
 
 #include <dk_buttons_and_leds.h>
 
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+#include <bluetooth/hci_vs_sdc.h>
+#endif
+
 #include "main.h"
 
 #define DEVICE_NAME	CONFIG_BT_DEVICE_NAME
@@ -34,12 +38,50 @@
 
 #define THROUGHPUT_CONFIG_TIMEOUT K_SECONDS(20)
 
+#define SENDER_STACK_SIZE 1024
+
 static K_SEM_DEFINE(throughput_sem, 0, 1);
 
 static volatile bool data_length_req;
 static volatile bool test_ready;
-static struct bt_conn *default_conn;
-static struct bt_throughput throughput;
+
+/* A throughput test link. The peripheral uses only the first one. */
+static struct link {
+	struct bt_conn *conn;
+	struct bt_throughput throughput;
+	bool ready;
+
+	/* Results of the last test */
+	uint32_t sent;
+	int64_t duration;
+	int err;
+
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+	uint16_t conn_handle;
+	/* Connection event statistics reported by the controller */
+	struct {
+		uint32_t events;
+		uint32_t events_elapsed;
+		uint32_t crc_ok;
+		uint32_t crc_error;
+		uint32_t nak;
+		uint16_t last_event_counter;
+	} qos;
+#endif
+} links[LINK_COUNT];
+
+static K_THREAD_STACK_ARRAY_DEFINE(sender_stacks, LINK_COUNT, SENDER_STACK_SIZE);
+static struct k_thread sender_threads[LINK_COUNT];
+
+/* The link that the peer metrics are being read from */
+static struct link *peer_read_link;
+static uint32_t peer_total_len;
+static uint32_t peer_total_rate;
+
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+static atomic_t qos_measuring;
+#endif
+
 static const struct bt_uuid *uuid128 = BT_UUID_THROUGHPUT;
 static struct bt_gatt_exchange_params exchange_params;
 static struct bt_le_conn_param *conn_param =
@@ -57,6 +99,45 @@ static const struct bt_data sd[] = {
 };
 
 static void button_handler_cb(uint32_t button_state, uint32_t has_changed);
+static void scan_start(void);
+
+static struct link *link_get(const struct bt_conn *conn)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		if (links[i].conn == conn) {
+			return &links[i];
+		}
+	}
+
+	return NULL;
+}
+
+static size_t link_index(const struct link *link)
+{
+	return link - links;
+}
+
+static bool links_connected(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		if (!links[i].conn) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool links_ready(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		if (!links[i].ready) {
+			return false;
+		}
+	}
+
+	return true;
+}
 
 static const char *phy2str(uint8_t phy)
 {
@@ -122,8 +203,21 @@ static void exchange_func(struct bt_conn *conn, uint8_t att_err,
 	}
 
 	if (info.role == BT_CONN_ROLE_CENTRAL) {
-		instruction_print();
-		test_ready = true;
+		struct link *link = link_get(conn);
+
+		if (!link) {
+			return;
+		}
+
+		link->ready = true;
+
+		if (links_ready()) {
+			instruction_print();
+			test_ready = true;
+		} else {
+			printk("Link %zu ready, scanning for the next peer\n", link_index(link));
+			scan_start();
+		}
 	}
 }
 
@@ -141,7 +235,7 @@ static void discovery_complete(struct bt_gatt_dm *dm,
 
 	exchange_params.func = exchange_func;
 
-	err = bt_gatt_exchange_mtu(default_conn, &exchange_params);
+	err = bt_gatt_exchange_mtu(bt_gatt_dm_conn_get(dm), &exchange_params);
 	if (err) {
 		printk("MTU exchange failed (err %d)\n", err);
 	} else {
@@ -171,6 +265,7 @@ struct bt_gatt_dm_cb discovery_cb = {
 static void connected(struct bt_conn *conn, uint8_t hci_err)
 {
 	struct bt_conn_info info = {0};
+	struct link *link;
 	int err;
 
 	if (hci_err) {
@@ -183,19 +278,27 @@ static void connected(struct bt_conn *conn, uint8_t hci_err)
 		return;
 	}
 
-	if (default_conn) {
+	err = bt_conn_get_info(conn, &info);
+	if (err) {
+		printk("Failed to get connection info %d\n", err);
+		return;
+	}
+
+	link = link_get(NULL);
+	if (!link || ((info.role == BT_CONN_ROLE_PERIPHERAL) && (link != &links[0]))) {
 		printk("Connection exists, disconnect second connection\n");
 		bt_conn_disconnect(conn, BT_HCI_ERR_REMOTE_USER_TERM_CONN);
 		return;
 	}
 
-	default_conn = bt_conn_ref(conn);
+	link->conn = bt_conn_ref(conn);
 
-	err = bt_conn_get_info(default_conn, &info);
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+	err = bt_hci_get_conn_handle(conn, &link->conn_handle);
 	if (err) {
-		printk("Failed to get connection info %d\n", err);
-		return;
+		printk("Failed to get connection handle %d\n", err);
 	}
+#endif
 
 	printk("Connected as %s\n",
 	       info.role == BT_CONN_ROLE_CENTRAL ? "central" : "peripheral");
@@ -221,14 +324,15 @@ void security_changed(struct bt_conn *conn, bt_security_t level, enum bt_securit
 	}
 
 	struct bt_conn_info info = {0};
+	struct link *link = link_get(conn);
 	int err;
 
-	err = bt_conn_get_info(default_conn, &info);
-	if (info.role == BT_CONN_ROLE_CENTRAL) {
-		err = bt_gatt_dm_start(default_conn,
+	err = bt_conn_get_info(conn, &info);
+	if (!err && link && (info.role == BT_CONN_ROLE_CENTRAL)) {
+		err = bt_gatt_dm_start(conn,
 				       BT_UUID_THROUGHPUT,
 				       &discovery_cb,
-				       &throughput);
+				       &link->throughput);
 		if (err) {
 			printk("Discover failed (err %d)\n", err);
 		}
@@ -272,7 +376,7 @@ static void scan_start(void)
 	int err;
 
 	err = bt_scan_start(BT_SCAN_TYPE_SCAN_PASSIVE);
-	if (err) {
+	if (err && (err != -EALREADY)) {
 		printk("Starting scanning failed (err %d)\n", err);
 		return;
 	}
@@ -298,16 +402,21 @@ static void adv_start(void)
 static void disconnected(struct bt_conn *conn, uint8_t reason)
 {
 	struct bt_conn_info info = {0};
+	struct link *link = link_get(conn);
 	int err;
 
 	printk("Disconnected, reason 0x%02x %s\n", reason, bt_hci_err_to_str(reason));
 
-	test_ready = false;
-	if (default_conn) {
-		bt_conn_unref(default_conn);
-		default_conn = NULL;
+	if (!link) {
+		/* A rejected connection */
+		return;
 	}
 
+	test_ready = false;
+	bt_conn_unref(link->conn);
+	link->conn = NULL;
+	link->ready = false;
+
 	err = bt_conn_get_info(conn, &info);
 	if (err) {
 		printk("Failed to get connection info (%d)\n", err);
@@ -384,11 +493,20 @@ static void frame_space_updated(struct bt_conn *conn,
 
 static uint8_t throughput_read(const struct bt_throughput_metrics *met)
 {
-	printk("[peer] received %u bytes (%u KB)"
+	if (LINK_COUNT > 1) {
+		printk("[peer %zu] ", link_index(peer_read_link));
+	} else {
+		printk("[peer] ");
+	}
+
+	printk("received %u bytes (%u KB)"
 	       " in %u GATT writes at %u bps\n",
 	       met->write_len, met->write_len / 1024, met->write_count,
 	       met->write_rate);
 
+	peer_total_len += met->write_len;
+	peer_total_rate += met->write_rate;
+
 	k_sem_give(&throughput_sem);
 
 	return BT_GATT_ITER_STOP;
@@ -482,6 +600,7 @@ static void buttons_init(void)
 }
 
 static int connection_configuration_set(const struct shell *shell,
+			struct bt_conn *conn,
 			const struct bt_le_conn_param *conn_param,
 			const struct bt_conn_le_phy_param *phy,
 			const struct bt_conn_le_data_len_param *data_len,
@@ -490,7 +609,7 @@ static int connection_configuration_set(const struct shell *shell,
 	int err;
 	struct bt_conn_info info = {0};
 
-	err = bt_conn_get_info(default_conn, &info);
+	err = bt_conn_get_info(conn, &info);
 	if (err) {
 		shell_error(shell, "Failed to get connection info %d", err);
 		return err;
@@ -501,7 +620,7 @@ static int connection_configuration_set(const struct shell *shell,
 		"'run' command shall be executed only on the central board");
 	}
 
-	err = bt_conn_le_phy_update(default_conn, phy);
+	err = bt_conn_le_phy_update(conn, phy);
 	if (err) {
 		shell_error(shell, "PHY update failed: %d\n", err);
 		return err;
@@ -515,7 +634,7 @@ static int connection_configuration_set(const struct shell *shell,
 	}
 
 	if (BT_GAP_US_TO_CONN_INTERVAL(info.le.interval_us) != conn_param->interval_max) {
-		err = bt_conn_le_param_update(default_conn, conn_param);
+		err = bt_conn_le_param_update(conn, conn_param);
 		if (err) {
 			shell_error(shell,
 				    "Connection parameters update failed: %d",
@@ -535,7 +654,7 @@ static int connection_configuration_set(const struct shell *shell,
 	if (info.le.data_len->tx_max_len != data_len->tx_max_len) {
 		data_length_req = true;
 
-		err = bt_conn_le_data_len_update(default_conn, data_len);
+		err = bt_conn_le_data_len_update(conn, data_len);
 		if (err) {
 			shell_error(shell, "LE data length update failed: %d",
 				    err);
@@ -557,7 +676,7 @@ static int connection_configuration_set(const struct shell *shell,
 		fsu_params.frame_space_max = MAX(150, frame_space_us);
 		fsu_params.phys = phy->pref_tx_phy | phy->pref_rx_phy;
 		fsu_params.spacing_types = BT_CONN_LE_FRAME_SPACE_TYPES_MASK_ACL_IFS;
-		err = bt_conn_le_frame_space_update(default_conn, &fsu_params);
+		err = bt_conn_le_frame_space_update(conn, &fsu_params);
 		if (err) {
 			shell_error(shell, "Frame space update failed: %d\n", err);
 			return err;
@@ -574,21 +693,135 @@ static int connection_configuration_set(const struct shell *shell,
 	return 0;
 }
 
-int test_run(const struct shell *shell,
-	     const struct bt_le_conn_param *conn_param,
-	     const struct bt_conn_le_phy_param *phy,
-	     const struct bt_conn_le_data_len_param *data_len,
-	     uint16_t frame_space_us)
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+static bool on_vs_evt(struct net_buf_simple *buf)
+{
+	sdc_hci_subevent_vs_qos_conn_event_report_t *evt;
+	struct link *link = NULL;
+	uint16_t elapsed;
+	uint8_t code;
+
+	code = net_buf_simple_pull_u8(buf);
+	if (code != SDC_HCI_SUBEVENT_VS_QOS_CONN_EVENT_REPORT) {
+		return false;
+	}
+
+	if (!atomic_get(&qos_measuring)) {
+		return true;
+	}
+
+	evt = (void *)buf->data;
+
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		if (links[i].conn && (links[i].conn_handle == evt->conn_handle)) {
+			link = &links[i];
+			break;
+		}
+	}
+
+	if (!link) {
+		return true;
+	}
+
+	/* No report is generated for the connection events that the
+	 * controller skipped, for example, due to scheduling conflicts
+	 * with the other links.
+	 */
+	elapsed = link->qos.events ?
+		  (uint16_t)(evt->event_counter - link->qos.last_event_counter) : 1;
+
+	link->qos.last_event_counter = evt->event_counter;
+	link->qos.events++;
+	link->qos.events_elapsed += elapsed;
+	link->qos.crc_ok += evt->crc_ok_count;
+	link->qos.crc_error += evt->crc_error_count;
+	link->qos.nak += evt->nak_count;
+
+	return true;
+}
+
+static int qos_report_enable(void)
 {
 	int err;
-	uint64_t stamp;
-	int64_t delta;
-	uint32_t data = 0;
+	sdc_hci_cmd_vs_qos_conn_event_report_enable_t cmd_enable = {
+		.enable = true,
+	};
+
+	err = bt_hci_register_vnd_evt_cb(on_vs_evt);
+	if (err) {
+		printk("Failed registering vendor specific callback (err %d)\n",
+		       err);
+		return err;
+	}
+
+	err = hci_vs_sdc_qos_conn_event_report_enable(&cmd_enable);
+	if (err) {
+		printk("Could not enable QoS reports (err %d)\n", err);
+		return err;
+	}
+
+	return 0;
+}
+
+static void qos_print(const struct link *link)
+{
+	uint32_t rx_packets = link->qos.crc_ok + link->qos.crc_error;
+
+	if (!link->qos.events) {
+		printk("[local] no connection event reports\n");
+		return;
+	}
+
+	printk("[local] connection events used %u of %u (%u%%), ",
+	       link->qos.events, link->qos.events_elapsed,
+	       link->qos.events * 100 / link->qos.events_elapsed);
+	printk("%u.%02u packets received per event, "
+	       "%u CRC errors, %u retransmissions requested by peer\n",
+	       rx_packets / link->qos.events,
+	       (rx_packets % link->qos.events) * 100 / link->qos.events,
+	       link->qos.crc_error, link->qos.nak);
+}
+#endif /* CONFIG_BT_THROUGHPUT_QOS_REPORT */
+
+static void sender_fn(void *p1, void *p2, void *p3)
+{
+	struct link *link = p1;
+	int64_t stamp;
+	int err;
 
 	/* a dummy data buffer */
 	static char dummy[CONFIG_BT_L2CAP_TX_MTU - 3];
 
-	if (!default_conn) {
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* get cycle stamp */
+	stamp = k_uptime_get();
+
+	while (true) {
+		err = bt_throughput_write(&link->throughput, dummy, sizeof(dummy));
+		if (err) {
+			printk("GATT write failed (err %d)\n", err);
+			link->err = err;
+			break;
+		}
+		link->sent += sizeof(dummy);
+		if (k_uptime_get() - stamp > CONFIG_BT_THROUGHPUT_DURATION) {
+			break;
+		}
+	}
+
+	link->duration = k_uptime_delta(&stamp);
+}
+
+int test_run(const struct shell *shell, const struct test_params *params)
+{
+	int err;
+	uint32_t total_sent = 0;
+	int64_t max_duration = 0;
+	uint8_t reset = 0;
+
+	if (!links_connected()) {
 		shell_error(shell, "Device is disconnected %s",
 			    "Connect to the peer device before running test");
 		return -EFAULT;
@@ -602,9 +835,18 @@ int test_run(const struct shell *shell,
 
 	shell_print(shell, "\n==== Starting throughput test ====");
 
-	err = connection_configuration_set(shell, conn_param, phy, data_len, frame_space_us);
-	if (err) {
-		return err;
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		if (LINK_COUNT > 1) {
+			shell_print(shell, "Configuring link %zu", i);
+		}
+
+		err = connection_configuration_set(shell, links[i].conn,
+						   &params[i].conn_param, &params[i].phy,
+						   &params[i].data_len,
+						   params[i].frame_space_us);
+		if (err) {
+			return err;
+		}
 	}
 
 	shell_print(shell, "The test is in progress and will require around %d seconds "
@@ -614,41 +856,91 @@ int test_run(const struct shell *shell,
 	k_sleep(K_MSEC(500));
 
 	/* reset peer metrics */
-	err = bt_throughput_write(&throughput, dummy, 1);
-	if (err) {
-		shell_error(shell, "Reset peer metrics failed.");
-		return err;
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		err = bt_throughput_write(&links[i].throughput, &reset, sizeof(reset));
+		if (err) {
+			shell_error(shell, "Reset peer metrics failed.");
+			return err;
+		}
+
+		links[i].sent = 0;
+		links[i].err = 0;
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+		memset(&links[i].qos, 0, sizeof(links[i].qos));
+#endif
 	}
 
-	/* get cycle stamp */
-	stamp = k_uptime_get_32();
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+	atomic_set(&qos_measuring, true);
+#endif
 
-	while (true) {
-		err = bt_throughput_write(&throughput, dummy, sizeof(dummy));
-		if (err) {
-			shell_error(shell, "GATT write failed (err %d)", err);
-			break;
-		}
-		data += sizeof(dummy);
-		if (k_uptime_get_32() - stamp > CONFIG_BT_THROUGHPUT_DURATION) {
-			break;
-		}
+	/* Every link is fed by its own thread, so that a link that runs out
+	 * of transmit buffers does not hold back the others.
+	 */
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		k_thread_create(&sender_threads[i], sender_stacks[i],
+				K_THREAD_STACK_SIZEOF(sender_stacks[i]), sender_fn,
+				&links[i], NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+				K_NO_WAIT);
 	}
 
-	delta = k_uptime_delta(&stamp);
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		(void)k_thread_join(&sender_threads[i], K_FOREVER);
+	}
+
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+	atomic_set(&qos_measuring, false);
+#endif
 
 	printk("\nDone\n");
-	printk("[local] sent %u bytes (%u KB) in %lld ms at %llu kbps\n",
-	       data, data / 1024, delta, ((uint64_t)data * 8 / delta));
+
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		const struct link *link = &links[i];
+
+		if (LINK_COUNT > 1) {
+			printk("[local %zu] ", i);
+		} else {
+			printk("[local] ");
+		}
+
+		printk("sent %u bytes (%u KB) in %lld ms at %llu kbps\n",
+		       link->sent, link->sent / 1024, link->duration,
+		       ((uint64_t)link->sent * 8 / MAX(link->duration, 1)));
+
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+		qos_print(link);
+#endif
+
+		total_sent += link->sent;
+		max_duration = MAX(max_duration, link->duration);
+	}
+
+	if (LINK_COUNT > 1) {
+		printk("[local] total sent %u bytes (%u KB) in %lld ms at %llu kbps\n",
+		       total_sent, total_sent / 1024, max_duration,
+		       ((uint64_t)total_sent * 8 / MAX(max_duration, 1)));
+	}
 
 	/* read back char from peer */
-	err = bt_throughput_read(&throughput);
-	if (err) {
-		shell_error(shell, "GATT read failed (err %d)", err);
-		return err;
+	peer_total_len = 0;
+	peer_total_rate = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(links); i++) {
+		peer_read_link = &links[i];
+
+		err = bt_throughput_read(&links[i].throughput);
+		if (err) {
+			shell_error(shell, "GATT read failed (err %d)", err);
+			return err;
+		}
+
+		k_sem_take(&throughput_sem, THROUGHPUT_CONFIG_TIMEOUT);
 	}
 
-	k_sem_take(&throughput_sem, THROUGHPUT_CONFIG_TIMEOUT);
+	if (LINK_COUNT > 1) {
+		printk("[peer] total received %u bytes (%u KB) at %u bps\n",
+		       peer_total_len, peer_total_len / 1024, peer_total_rate);
+	}
 
 	instruction_print();
 
@@ -682,9 +974,16 @@ int main(void)
 
 	printk("Bluetooth initialized\n");
 
+#if defined(CONFIG_BT_THROUGHPUT_QOS_REPORT)
+	err = qos_report_enable();
+	if (err) {
+		printk("Connection event reports are not available\n");
+	}
+#endif
+
 	scan_init();
 
-	err = bt_throughput_init(&throughput, &throughput_cb);
+	err = bt_throughput_init(&links[0].throughput, &throughput_cb);
 	if (err) {
 		printk("Throughput service initialization failed.\n");
 		return 0;
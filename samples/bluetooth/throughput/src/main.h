@@ -7,20 +7,30 @@
 #ifndef THROUGHPUT_MAIN_H_
 #define THROUGHPUT_MAIN_H_
 
+#include <zephyr/bluetooth/conn.h>
+
+/** Number of links used by the central. */
+#define LINK_COUNT CONFIG_BT_THROUGHPUT_LINK_COUNT
+
+/** @brief Test parameters of a link. */
+struct test_params {
+	/** Connection parameters. */
+	struct bt_le_conn_param conn_param;
+	/** PHY parameters. */
+	struct bt_conn_le_phy_param phy;
+	/** Maximum transmission payload. */
+	struct bt_conn_le_data_len_param data_len;
+	/** Frame space in microseconds. */
+	uint16_t frame_space_us;
+};
+
 /**
  * @brief Run the test
  *
  * @param shell       Shell instance where output will be printed.
- * @param conn_param  Connection parameters.
- * @param phy         PHY parameters.
- * @param data_len    Maximum transmission payload.
- * @param frame_space_us Frame space in microseconds.
+ * @param params      Array of LINK_COUNT test parameters, one for each link.
  */
-int test_run(const struct shell *shell,
-	     const struct bt_le_conn_param *conn_param,
-	     const struct bt_conn_le_phy_param *phy,
-	     const struct bt_conn_le_data_len_param *data_len,
-	     uint16_t frame_space_us);
+int test_run(const struct shell *shell, const struct test_params *params);
 
 /**
  * @brief Set the board into a specific role.
@@ -255,6 +255,10 @@ static int lwm2m_firmware_event_cb(struct lwm2m_fota_event *event)
 		LOG_INF("FOTA failure %d by status %d", event->failure.obj_inst_id,
 			event->failure.update_failure);
 		break;
+	case LWM2M_FOTA_DOWNLOAD_PROGRESS:
+		LOG_DBG("FOTA download %d%% for instance %d", event->download_progress.percent,
+			event->download_progress.obj_inst_id);
+		break;
 	}
 	k_mutex_unlock(&lte_mutex);
 	return 0;
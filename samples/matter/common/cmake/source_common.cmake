@@ -26,6 +26,13 @@ zephyr_linker_sources(SECTIONS ${MATTER_COMMONS_SRC_DIR}/clusters/cluster_init.l
 # Set specific sources that depend on Kconfigs
 if(CONFIG_CHIP_OTA_REQUESTOR)
     target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/dfu/ota/ota_util.cpp)
+    if(CONFIG_NCS_SAMPLE_MATTER_OTA_IMAGE_DIGEST_VERIFY)
+        target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/dfu/ota/ota_image_processor_verify.cpp)
+    endif()
+endif()
+
+if(CONFIG_NCS_SAMPLE_MATTER_SENSOR_SCHEDULER)
+    target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/app/sensor_scheduler.cpp)
 endif()
 
 if(CONFIG_PWM)
@@ -73,6 +80,9 @@ if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS)
 
     if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS OR CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS)
         target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/diagnostic/diagnostic_logs_retention.cpp)
+        if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION)
+            target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/diagnostic/diagnostic_logs_compression.cpp)
+        endif()
         if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_REDIRECT)
             target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/diagnostic/log_backend_diagnostic.cpp)
         endif()
@@ -153,7 +153,7 @@ struct InitGuard {
 void FeedFromApp(Nrf::Watchdog::WatchdogSource *watchdogSource)
 {
 	if (watchdogSource) {
-		Nrf::PostTask([watchdogSource] { watchdogSource->Feed(); });
+		Nrf::PostTask([watchdogSource] { watchdogSource->Feed(); }, Nrf::TaskPriority::High);
 	}
 }
 
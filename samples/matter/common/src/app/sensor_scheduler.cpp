@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sensor_scheduler.h"
+
+#include <app/server/Server.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::DeviceLayer;
+
+namespace Nrf::Matter
+{
+
+CHIP_ERROR SensorScheduler::Init()
+{
+	VerifyOrReturnError(!mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+	k_timer_init(&mTimer, TimerTimeoutCallback, nullptr);
+
+#ifdef CONFIG_CHIP_ENABLE_ICD_SUPPORT
+	PlatformMgr().LockChipStack();
+	Server::GetInstance().GetICDManager().RegisterObserver(this);
+	PlatformMgr().UnlockChipStack();
+#endif
+
+	mInitialized = true;
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SensorScheduler::Register(MeasurementCallback callback, void *context, uint32_t minIntervalMs,
+				     uint32_t maxIntervalMs)
+{
+	VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+	VerifyOrReturnError(callback != nullptr && minIntervalMs <= maxIntervalMs && maxIntervalMs > 0,
+			    CHIP_ERROR_INVALID_ARGUMENT);
+	VerifyOrReturnError(mMeasurementsCount < ArraySize(mMeasurements), CHIP_ERROR_NO_MEMORY);
+
+	PlatformMgr().LockChipStack();
+	mMeasurements[mMeasurementsCount++] = { callback, context, minIntervalMs, maxIntervalMs, k_uptime_get() };
+	ScheduleTimer();
+	PlatformMgr().UnlockChipStack();
+
+	return CHIP_NO_ERROR;
+}
+
+#ifdef CONFIG_CHIP_ENABLE_ICD_SUPPORT
+void SensorScheduler::OnEnterActiveMode()
+{
+	RunMeasurements();
+}
+#endif
+
+void SensorScheduler::TimerTimeoutCallback(k_timer *timer)
+{
+	PlatformMgr().ScheduleWork([](intptr_t) { SensorScheduler::Instance().RunMeasurements(); });
+}
+
+void SensorScheduler::RunMeasurements()
+{
+	const int64_t now = k_uptime_get();
+	size_t count = 0;
+
+	for (size_t i = 0; i < mMeasurementsCount; i++) {
+		Measurement &measurement = mMeasurements[i];
+
+		if (now - measurement.mLastRun >= measurement.mMinIntervalMs) {
+			measurement.mLastRun = now;
+			measurement.mCallback(measurement.mContext);
+			count++;
+		}
+	}
+
+	if (count > 0) {
+		LOG_DBG("Run %zu batched sensor measurements", count);
+	}
+
+	ScheduleTimer();
+}
+
+void SensorScheduler::ScheduleTimer()
+{
+	const int64_t now = k_uptime_get();
+	int64_t timeout = INT64_MAX;
+
+	for (size_t i = 0; i < mMeasurementsCount; i++) {
+		const Measurement &measurement = mMeasurements[i];
+
+		timeout = MIN(timeout, MAX(measurement.mLastRun + measurement.mMaxIntervalMs - now, 0));
+	}
+
+	if (timeout == INT64_MAX) {
+		k_timer_stop(&mTimer);
+	} else {
+		k_timer_start(&mTimer, K_MSEC(timeout), K_NO_WAIT);
+	}
+}
+
+} /* namespace Nrf::Matter */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#ifdef CONFIG_CHIP_ENABLE_ICD_SUPPORT
+#include <app/icd/server/ICDStateObserver.h>
+#endif
+
+#include <zephyr/kernel.h>
+
+#include <cstdint>
+
+namespace Nrf::Matter
+{
+
+/**
+ * @brief Scheduler of periodic sensor measurements.
+ *
+ * Instead of waking the device on a separate timer for each sensor, the sensor measurements are
+ * batched. Each measurement registered in the scheduler has a minimum and a maximum interval.
+ * When the ICD enters the active mode, for example to send a check-in message or to handle a
+ * subscription, all measurements whose minimum interval has elapsed are run. Because the attributes
+ * are updated while the device is active, the resulting reports are sent within the same active
+ * period. The scheduler wakes the device on its own only when a measurement reaches its maximum
+ * interval, and then also runs all measurements whose minimum interval has elapsed.
+ *
+ * The measurements are run in the Matter thread, so they can update the attributes directly.
+ */
+class SensorScheduler
+#ifdef CONFIG_CHIP_ENABLE_ICD_SUPPORT
+	: public chip::app::ICDStateObserver
+#endif
+{
+public:
+	using MeasurementCallback = void (*)(void *context);
+
+	static SensorScheduler &Instance()
+	{
+		static SensorScheduler sInstance;
+		return sInstance;
+	}
+
+	/**
+	 * @brief Initialize the scheduler.
+	 *
+	 * Must be called after the Matter server is started, that is after the Nrf::Matter::StartServer().
+	 *
+	 * @return CHIP_NO_ERROR on success, other error code otherwise.
+	 */
+	CHIP_ERROR Init();
+
+	/**
+	 * @brief Register a periodic measurement.
+	 *
+	 * @param callback callback run in the Matter thread to perform the measurement.
+	 * @param context context passed to the callback.
+	 * @param minIntervalMs minimum interval between two measurements, in milliseconds.
+	 * @param maxIntervalMs maximum interval between two measurements, in milliseconds.
+	 * @return CHIP_ERROR_NO_MEMORY if the maximum number of measurements is already registered.
+	 * @return CHIP_ERROR_INVALID_ARGUMENT if the arguments are invalid.
+	 * @return CHIP_NO_ERROR on success.
+	 */
+	CHIP_ERROR Register(MeasurementCallback callback, void *context, uint32_t minIntervalMs,
+			    uint32_t maxIntervalMs);
+
+#ifdef CONFIG_CHIP_ENABLE_ICD_SUPPORT
+	void OnEnterActiveMode() override;
+	void OnEnterIdleMode() override {}
+	void OnTransitionToIdle() override {}
+	void OnICDModeChange() override {}
+#endif
+
+private:
+	struct Measurement {
+		MeasurementCallback mCallback;
+		void *mContext;
+		uint32_t mMinIntervalMs;
+		uint32_t mMaxIntervalMs;
+		int64_t mLastRun;
+	};
+
+	static void TimerTimeoutCallback(k_timer *timer);
+
+	void RunMeasurements();
+	void ScheduleTimer();
+
+	Measurement mMeasurements[CONFIG_NCS_SAMPLE_MATTER_SENSOR_SCHEDULER_MAX_MEASUREMENTS];
+	size_t mMeasurementsCount = 0;
+	k_timer mTimer;
+	bool mInitialized = false;
+};
+
+} /* namespace Nrf::Matter */
@@ -12,23 +12,85 @@
 LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
 
 constexpr size_t kTaskQueueSize = CONFIG_NCS_SAMPLE_MATTER_APP_TASK_QUEUE_SIZE;
+constexpr size_t kHighPriorityTaskQueueSize = CONFIG_NCS_SAMPLE_MATTER_APP_TASK_HIGH_PRIORITY_QUEUE_SIZE;
+constexpr size_t kLowPriorityTaskQueueSize = CONFIG_NCS_SAMPLE_MATTER_APP_TASK_LOW_PRIORITY_QUEUE_SIZE;
+constexpr size_t kTaskPriorityCount = static_cast<size_t>(Nrf::TaskPriority::Count);
 
+K_MSGQ_DEFINE(sHighPriorityTaskQueue, sizeof(Nrf::Task), kHighPriorityTaskQueueSize, alignof(Nrf::Task));
 K_MSGQ_DEFINE(sTaskQueue, sizeof(Nrf::Task), kTaskQueueSize, alignof(Nrf::Task));
+K_MSGQ_DEFINE(sLowPriorityTaskQueue, sizeof(Nrf::Task), kLowPriorityTaskQueueSize, alignof(Nrf::Task));
+
+/* Counts the tasks posted to all queues, so that the application thread waits for a task of any priority class. */
+K_SEM_DEFINE(sPendingTasks, 0, kHighPriorityTaskQueueSize + kTaskQueueSize + kLowPriorityTaskQueueSize);
+
+namespace
+{
+/* Queues ordered from the highest to the lowest priority class. */
+k_msgq *const sTaskQueues[kTaskPriorityCount] = { &sHighPriorityTaskQueue, &sTaskQueue, &sLowPriorityTaskQueue };
+atomic_t sMaxDepth[kTaskPriorityCount];
+atomic_t sDropped[kTaskPriorityCount];
+
+void UpdateMaxDepth(size_t queueIndex)
+{
+	const atomic_val_t depth = k_msgq_num_used_get(sTaskQueues[queueIndex]);
+	atomic_val_t maxDepth = atomic_get(&sMaxDepth[queueIndex]);
+
+	while (depth > maxDepth && !atomic_cas(&sMaxDepth[queueIndex], maxDepth, depth)) {
+		maxDepth = atomic_get(&sMaxDepth[queueIndex]);
+	}
+}
+} /* namespace */
 
 namespace Nrf
 {
-	void PostTask(const Task &task)
+	bool PostTask(const Task &task, TaskPriority priority)
 	{
-		if (k_msgq_put(&sTaskQueue, &task, K_NO_WAIT) != 0) {
-			LOG_ERR("Failed to post event to app task event queue");
+		const size_t queueIndex = static_cast<size_t>(priority);
+
+		if (queueIndex >= kTaskPriorityCount) {
+			return false;
+		}
+
+		if (k_msgq_put(sTaskQueues[queueIndex], &task, K_NO_WAIT) != 0) {
+			/* Log only the first drop, as the logging itself could add to the congestion. */
+			if (atomic_inc(&sDropped[queueIndex]) == 0) {
+				LOG_ERR("Failed to post event to app task event queue %u", queueIndex);
+			}
+			return false;
 		}
+
+		UpdateMaxDepth(queueIndex);
+		k_sem_give(&sPendingTasks);
+
+		return true;
 	}
 
 	void DispatchNextTask()
 	{
 		Task task;
-		k_msgq_get(&sTaskQueue, &task, K_FOREVER);
-		task();
+		k_sem_take(&sPendingTasks, K_FOREVER);
+
+		/* The semaphore counts the posted tasks, so one of the queues contains a task. */
+		for (k_msgq *queue : sTaskQueues) {
+			if (k_msgq_get(queue, &task, K_NO_WAIT) == 0) {
+				task();
+				return;
+			}
+		}
+	}
+
+	TaskQueueStats GetTaskQueueStats(TaskPriority priority)
+	{
+		const size_t queueIndex = static_cast<size_t>(priority);
+		TaskQueueStats stats = {};
+
+		if (queueIndex < kTaskPriorityCount) {
+			stats.mDepth = k_msgq_num_used_get(sTaskQueues[queueIndex]);
+			stats.mMaxDepth = atomic_get(&sMaxDepth[queueIndex]);
+			stats.mDropped = atomic_get(&sDropped[queueIndex]);
+		}
+
+		return stats;
 	}
 
 } /* namespace Nrf */
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
 namespace Nrf
@@ -50,6 +51,35 @@ namespace Nrf
 		Handler mHandler;
 	};
 
+	/**
+	 * @brief Priority class of a task.
+	 *
+	 * Each priority class uses a separate task queue. The application thread always dispatches the tasks of
+	 * the highest priority class first, so a full or a busy queue of a lower priority class does not delay
+	 * the tasks of a higher one. Tasks of the same priority class are dispatched in the order they were posted.
+	 */
+	enum class TaskPriority : uint8_t {
+		/* Latency-critical tasks, such as button and LED handling. */
+		High = 0,
+		/* Default priority class. */
+		Normal,
+		/* Tasks that may be delayed, such as periodic sensor measurements. */
+		Low,
+		Count
+	};
+
+	/**
+	 * @brief Statistics of the task queue of a single priority class.
+	 */
+	struct TaskQueueStats {
+		/* Number of tasks currently waiting in the queue. */
+		uint32_t mDepth;
+		/* Maximum number of tasks that waited in the queue at the same time. */
+		uint32_t mMaxDepth;
+		/* Number of tasks dropped because the queue was full. */
+		uint32_t mDropped;
+	};
+
 	/**
 	 * @brief Post a task to the task queue.
 	 *
@@ -64,9 +94,15 @@ namespace Nrf
 	 * uint32_t myNumber;
 	 * PostTask([myNumber]{ MyMethod(myNumber) };)
 	 *
+	 * The method can be called from any thread or from an interrupt. If the queue of the given priority class is
+	 * full, the task is dropped and counted in the queue statistics.
+	 *
 	 * @param task the Task to be posted to the application thread's task queue
+	 * @param priority the priority class of the task
+	 * @return true if the task has been posted successfully
+	 * @return false the queue of the given priority class is full
 	 */
-	void PostTask(const Task &task);
+	bool PostTask(const Task &task, TaskPriority priority = TaskPriority::Normal);
 
 	/**
 	 * @brief Dispatch the next available task.
@@ -77,4 +113,12 @@ namespace Nrf
 	 *
 	 */
 	void DispatchNextTask();
+
+	/**
+	 * @brief Get the statistics of the task queue of a priority class.
+	 *
+	 * @param priority the priority class of the queue
+	 * @return statistics of the queue
+	 */
+	TaskQueueStats GetTaskQueueStats(TaskPriority priority);
 } /* namespace Nrf */
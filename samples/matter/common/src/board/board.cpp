@@ -139,7 +139,7 @@ void Board::LEDStateUpdateHandler(LEDWidget &ledWidget)
 {
 	LEDEvent event;
 	event.LedWidget = &ledWidget;
-	PostTask([event] { UpdateLedStateEventHandler(event); });
+	PostTask([event] { UpdateLedStateEventHandler(event); }, TaskPriority::High);
 }
 
 void Board::UpdateLedStateEventHandler(const LEDEvent &event)
@@ -211,7 +211,7 @@ void Board::StartTimer(uint32_t timeoutInMs)
 
 void Board::FunctionTimerTimeoutCallback(k_timer *timer)
 {
-	PostTask([] { FunctionTimerEventHandler(); });
+	PostTask([] { FunctionTimerEventHandler(); }, TaskPriority::High);
 }
 
 void Board::FunctionTimerEventHandler()
@@ -240,13 +240,13 @@ void Board::ButtonEventHandler(ButtonState buttonState, ButtonMask hasChanged)
 	if (BLUETOOTH_ADV_BUTTON_MASK & hasChanged) {
 		ButtonAction action =
 			(BLUETOOTH_ADV_BUTTON_MASK & buttonState) ? ButtonAction::Pressed : ButtonAction::Released;
-		PostTask([action] { StartBLEAdvertisementHandler(action); });
+		PostTask([action] { StartBLEAdvertisementHandler(action); }, TaskPriority::High);
 	}
 
 	if (FUNCTION_BUTTON_MASK & hasChanged) {
 		ButtonAction action =
 			(FUNCTION_BUTTON_MASK & buttonState) ? ButtonAction::Pressed : ButtonAction::Released;
-		PostTask([action] { FunctionHandler(action); });
+		PostTask([action] { FunctionHandler(action); }, TaskPriority::High);
 	}
 }
 
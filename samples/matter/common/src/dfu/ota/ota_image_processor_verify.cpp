@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ota_image_processor_verify.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+using namespace chip;
+
+namespace
+{
+psa_algorithm_t GetHashAlgorithm(OTAImageDigestType type)
+{
+	/* The truncated SHA-256 digests are the leading bytes of the full SHA-256 digest. */
+	switch (type) {
+	case OTAImageDigestType::kSha256:
+	case OTAImageDigestType::kSha256_128:
+	case OTAImageDigestType::kSha256_120:
+	case OTAImageDigestType::kSha256_96:
+	case OTAImageDigestType::kSha256_64:
+	case OTAImageDigestType::kSha256_32:
+		return PSA_ALG_SHA_256;
+	case OTAImageDigestType::kSha384:
+		return PSA_ALG_SHA_384;
+	case OTAImageDigestType::kSha512:
+		return PSA_ALG_SHA_512;
+	default:
+		return PSA_ALG_NONE;
+	}
+}
+} /* namespace */
+
+namespace Nrf::Matter
+{
+
+CHIP_ERROR OTAImageProcessorVerifyImpl::PrepareDownload()
+{
+	ResetHash();
+	mHeaderParser.Init();
+
+	return OTAImageProcessorBaseImpl::PrepareDownload();
+}
+
+CHIP_ERROR OTAImageProcessorVerifyImpl::Finalize()
+{
+	if (mHeaderParser.IsInitialized()) {
+		ChipLogError(SoftwareUpdate, "OTA image header has not been received");
+		Abort();
+		return CHIP_ERROR_INCORRECT_STATE;
+	}
+
+	if (mHashActive) {
+		uint8_t digest[kMaxDigestSize];
+		size_t digestSize = 0;
+		psa_status_t status = psa_hash_finish(&mHashOperation, digest, sizeof(digest), &digestSize);
+
+		mHashActive = false;
+
+		if (status != PSA_SUCCESS || digestSize < mDigestSize || memcmp(digest, mDigest, mDigestSize) != 0) {
+			ChipLogError(SoftwareUpdate, "OTA image digest mismatch, rejecting the image");
+			Abort();
+			return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+		}
+
+		ChipLogProgress(SoftwareUpdate, "OTA image digest verified");
+	}
+
+	return OTAImageProcessorBaseImpl::Finalize();
+}
+
+CHIP_ERROR OTAImageProcessorVerifyImpl::Abort()
+{
+	ResetHash();
+	mHeaderParser.Clear();
+
+	return OTAImageProcessorBaseImpl::Abort();
+}
+
+CHIP_ERROR OTAImageProcessorVerifyImpl::ProcessBlock(ByteSpan &block)
+{
+	/* Work on a copy, as the header parser consumes the header bytes from the span and the base
+	   implementation must receive the complete block. */
+	ByteSpan payload = block;
+
+	if (mHeaderParser.IsInitialized()) {
+		OTAImageHeader header;
+		CHIP_ERROR err = mHeaderParser.AccumulateAndDecode(payload, header);
+
+		if (err == CHIP_ERROR_BUFFER_TOO_SMALL) {
+			return OTAImageProcessorBaseImpl::ProcessBlock(block);
+		}
+
+		if (err == CHIP_NO_ERROR) {
+			err = StartHash(header);
+		}
+
+		/* The parser owns the header data, so release it only after the digest has been copied. */
+		mHeaderParser.Clear();
+
+		if (err != CHIP_NO_ERROR) {
+			ChipLogError(SoftwareUpdate, "Failed to start OTA image verification: %" CHIP_ERROR_FORMAT,
+				     err.Format());
+			return err;
+		}
+	}
+
+	if (mHashActive && !payload.empty()) {
+		VerifyOrReturnError(psa_hash_update(&mHashOperation, payload.data(), payload.size()) == PSA_SUCCESS,
+				    CHIP_ERROR_INTERNAL);
+	}
+
+	return OTAImageProcessorBaseImpl::ProcessBlock(block);
+}
+
+CHIP_ERROR OTAImageProcessorVerifyImpl::StartHash(const OTAImageHeader &header)
+{
+	const psa_algorithm_t algorithm = GetHashAlgorithm(header.mImageDigestType);
+
+	if (algorithm == PSA_ALG_NONE) {
+		ChipLogError(SoftwareUpdate, "Unsupported OTA image digest type: %u",
+			     static_cast<unsigned>(header.mImageDigestType));
+		return CHIP_ERROR_NOT_IMPLEMENTED;
+	}
+
+	VerifyOrReturnError(!header.mImageDigest.empty() && header.mImageDigest.size() <= PSA_HASH_LENGTH(algorithm),
+			    CHIP_ERROR_INVALID_ARGUMENT);
+
+	memcpy(mDigest, header.mImageDigest.data(), header.mImageDigest.size());
+	mDigestSize = header.mImageDigest.size();
+
+	VerifyOrReturnError(psa_hash_setup(&mHashOperation, algorithm) == PSA_SUCCESS, CHIP_ERROR_INTERNAL);
+	mHashActive = true;
+
+	return CHIP_NO_ERROR;
+}
+
+void OTAImageProcessorVerifyImpl::ResetHash()
+{
+	psa_hash_abort(&mHashOperation);
+	mHashOperation = PSA_HASH_OPERATION_INIT;
+	mHashActive = false;
+	mDigestSize = 0;
+}
+
+} /* namespace Nrf::Matter */
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "ota_image_processor_base_impl.h"
+
+#include <lib/core/OTAImageHeader.h>
+
+#include <psa/crypto.h>
+
+namespace Nrf::Matter
+{
+
+/**
+ * @brief OTA image processor that verifies the image digest while the image is downloaded.
+ *
+ * The payload of the Matter OTA image is hashed block by block as it is received, so that
+ * the digest stored in the Matter OTA image header can be checked as soon as the last block
+ * arrives, without reading the image back from the flash. The hash is computed using the
+ * PSA Crypto API, which is accelerated by the CRACEN or CryptoCell peripheral if available.
+ *
+ * An image whose digest does not match is aborted in Finalize() and is never applied.
+ */
+class OTAImageProcessorVerifyImpl : public OTAImageProcessorBaseImpl {
+public:
+	using OTAImageProcessorBaseImpl::OTAImageProcessorBaseImpl;
+
+	CHIP_ERROR PrepareDownload() override;
+	CHIP_ERROR Finalize() override;
+	CHIP_ERROR Abort() override;
+	CHIP_ERROR ProcessBlock(chip::ByteSpan &block) override;
+
+private:
+	static constexpr size_t kMaxDigestSize = PSA_HASH_MAX_SIZE;
+
+	CHIP_ERROR StartHash(const chip::OTAImageHeader &header);
+	void ResetHash();
+
+	chip::OTAImageHeaderParser mHeaderParser;
+	psa_hash_operation_t mHashOperation = PSA_HASH_OPERATION_INIT;
+	uint8_t mDigest[kMaxDigestSize];
+	size_t mDigestSize = 0;
+	bool mHashActive = false;
+};
+
+} /* namespace Nrf::Matter */
@@ -6,6 +6,10 @@
 
 #include "ota_util.h"
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_OTA_IMAGE_DIGEST_VERIFY
+#include "ota_image_processor_verify.h"
+#endif
+
 #if CONFIG_CHIP_OTA_REQUESTOR
 #include <app/clusters/ota-requestor/BDXDownloader.h>
 #include <app/clusters/ota-requestor/DefaultOTARequestor.h>
@@ -38,10 +42,16 @@ namespace Nrf::Matter
 /* compile-time factory method */
 OTAImageProcessorImpl &GetOTAImageProcessor()
 {
+#ifdef CONFIG_NCS_SAMPLE_MATTER_OTA_IMAGE_DIGEST_VERIFY
+	using ImageProcessor = OTAImageProcessorVerifyImpl;
+#else
+	using ImageProcessor = OTAImageProcessorBaseImpl;
+#endif
+
 #if CONFIG_PM_DEVICE && CONFIG_NORDIC_QSPI_NOR
-	static OTAImageProcessorBaseImpl sOTAImageProcessor(&ExternalFlashManager::GetInstance());
+	static ImageProcessor sOTAImageProcessor(&ExternalFlashManager::GetInstance());
 #else
-	static OTAImageProcessorBaseImpl sOTAImageProcessor;
+	static ImageProcessor sOTAImageProcessor;
 #endif
 	return sOTAImageProcessor;
 }
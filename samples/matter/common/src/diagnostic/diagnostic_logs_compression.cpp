@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "diagnostic_logs_compression.h"
+
+#include <cstring>
+
+namespace
+{
+/* Strings commonly found in the Matter logs. The most frequent ones are placed at the end, so that they are close to
+ * the compressed data and can be referred to with a shorter distance.
+ */
+constexpr char kDictionary[] = "0x0000000000000000 Subscription subscription Interaction Commissioning commissioning "
+			       "DataVersion ReadClient WriteClient Retransmit connection disconnected connected "
+			       "Attribute attribute Endpoint endpoint Cluster cluster Command command Event event "
+			       "Exchange exchange Session session Message message Fabric fabric Node node "
+			       "Received received Sending sending Sent failed error timeout response request "
+			       "Report report handler State state Thread Wi-Fi BLE CASE PASE MRP counter "
+			       "[ATM][BLE][CTL][DIS][DNS][FP][IM][OTA][SPT][SVR][TOO][TS][ZCL][DL][EM][IN][SC] "
+			       "<err> app: <wrn> app: <dbg> app: <inf> app: "
+			       "<err> chip: [<wrn> chip: [<dbg> chip: [DMG] \r\n[00:00:] <inf> chip: [";
+constexpr size_t kDictionarySize = sizeof(kDictionary) - 1;
+
+constexpr uint8_t kLiteralLimit = 0x80;
+constexpr uint8_t kEscapeToken = 0xFF;
+constexpr size_t kMinMatchLength = 4;
+constexpr size_t kMaxMatchLength = kEscapeToken - 1 - kLiteralLimit + kMinMatchLength;
+constexpr size_t kShortDistanceLimit = 0x80;
+constexpr size_t kMaxDistance = 0x7FFF;
+constexpr size_t kMaxChainLength = 16;
+
+constexpr size_t kWindowSize = kDictionarySize + DiagnosticLogsCompression::kMaxBlockSize;
+constexpr size_t kHashSize = 256;
+constexpr int16_t kNoPosition = -1;
+
+static_assert(kWindowSize <= kMaxDistance, "Dictionary is too long");
+
+/* Hash chains of the window positions, used only by the compressor. */
+int16_t sHashHead[kHashSize];
+int16_t sHashPrev[kWindowSize];
+
+/* Window consists of the dictionary followed by the record data. */
+inline uint8_t WindowAt(const uint8_t *data, size_t position)
+{
+	return position < kDictionarySize ? static_cast<uint8_t>(kDictionary[position]) :
+					    data[position - kDictionarySize];
+}
+
+inline uint8_t Hash(const uint8_t *data, size_t position)
+{
+	return static_cast<uint8_t>(WindowAt(data, position) * 33 + WindowAt(data, position + 1) * 7 +
+				    WindowAt(data, position + 2));
+}
+
+inline void Insert(const uint8_t *data, size_t windowEnd, size_t position)
+{
+	if (position + 2 >= windowEnd) {
+		return;
+	}
+
+	const uint8_t hash = Hash(data, position);
+
+	sHashPrev[position] = sHashHead[hash];
+	sHashHead[hash] = static_cast<int16_t>(position);
+}
+
+} /* namespace */
+
+namespace DiagnosticLogsCompression
+{
+
+size_t Compress(const uint8_t *block, size_t offset, size_t size, uint8_t *output, size_t outputSize)
+{
+	if (!block || !output || offset > size || size > kMaxBlockSize) {
+		return 0;
+	}
+
+	const size_t windowEnd = kDictionarySize + size;
+	size_t outputPosition = 0;
+	size_t position = offset;
+
+	for (auto &head : sHashHead) {
+		head = kNoPosition;
+	}
+
+	/* Index the dictionary and the data already compressed in the block. */
+	for (size_t i = 0; i < kDictionarySize + offset; i++) {
+		Insert(block, windowEnd, i);
+	}
+
+	while (position < size) {
+		const size_t current = kDictionarySize + position;
+		const size_t maxLength = size - position < kMaxMatchLength ? size - position : kMaxMatchLength;
+		size_t bestLength = 0;
+		size_t bestDistance = 0;
+
+		if (maxLength >= kMinMatchLength) {
+			int16_t candidate = sHashHead[Hash(block, current)];
+
+			for (size_t chain = 0; candidate != kNoPosition && chain < kMaxChainLength; chain++) {
+				size_t length = 0;
+
+				while (length < maxLength &&
+				       WindowAt(block, candidate + length) == block[position + length]) {
+					length++;
+				}
+
+				if (length > bestLength) {
+					bestLength = length;
+					bestDistance = current - candidate;
+				}
+
+				candidate = sHashPrev[candidate];
+			}
+		}
+
+		if (bestLength >= kMinMatchLength) {
+			const size_t tokenSize = bestDistance < kShortDistanceLimit ? 2 : 3;
+
+			if (outputPosition + tokenSize > outputSize) {
+				return 0;
+			}
+
+			output[outputPosition++] = kLiteralLimit + (bestLength - kMinMatchLength);
+
+			if (bestDistance < kShortDistanceLimit) {
+				output[outputPosition++] = bestDistance;
+			} else {
+				output[outputPosition++] = kShortDistanceLimit | (bestDistance >> 8);
+				output[outputPosition++] = bestDistance & 0xFF;
+			}
+
+			for (size_t i = 0; i < bestLength; i++) {
+				Insert(block, windowEnd, current + i);
+			}
+
+			position += bestLength;
+		} else {
+			const uint8_t literal = block[position];
+			const size_t tokenSize = literal < kLiteralLimit ? 1 : 2;
+
+			if (outputPosition + tokenSize > outputSize) {
+				return 0;
+			}
+
+			if (literal >= kLiteralLimit) {
+				output[outputPosition++] = kEscapeToken;
+			}
+
+			output[outputPosition++] = literal;
+
+			Insert(block, windowEnd, current);
+			position++;
+		}
+	}
+
+	return outputPosition;
+}
+
+size_t Decompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputSize)
+{
+	if (!input || !output) {
+		return 0;
+	}
+
+	size_t inputPosition = 0;
+	size_t outputPosition = 0;
+
+	while (inputPosition < inputSize) {
+		const uint8_t token = input[inputPosition++];
+
+		if (token < kLiteralLimit || token == kEscapeToken) {
+			if (token == kEscapeToken && inputPosition >= inputSize) {
+				return 0;
+			}
+
+			if (outputPosition >= outputSize) {
+				return 0;
+			}
+
+			output[outputPosition++] = token == kEscapeToken ? input[inputPosition++] : token;
+			continue;
+		}
+
+		const size_t length = token - kLiteralLimit + kMinMatchLength;
+
+		if (inputPosition >= inputSize) {
+			return 0;
+		}
+
+		size_t distance = input[inputPosition++];
+
+		if (distance >= kShortDistanceLimit) {
+			if (inputPosition >= inputSize) {
+				return 0;
+			}
+
+			distance = ((distance & ~kShortDistanceLimit) << 8) | input[inputPosition++];
+		}
+
+		const size_t current = kDictionarySize + outputPosition;
+
+		if (distance == 0 || distance > current || outputPosition + length > outputSize) {
+			return 0;
+		}
+
+		/* Copy byte by byte, as the match may overlap the data being written. */
+		for (size_t i = 0; i < length; i++) {
+			output[outputPosition] = WindowAt(output, current - distance + i);
+			outputPosition++;
+		}
+	}
+
+	return outputPosition;
+}
+
+} /* namespace DiagnosticLogsCompression */
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Compression of the diagnostic log lines stored in the retention RAM.
+ *
+ * The logs are compressed in blocks. Each block is compressed on its own, so that the oldest blocks can be dropped from
+ * the ring buffer without affecting the remaining ones. Log lines are appended to the block one by one, and each line
+ * can refer to the previous lines of the block. The scheme is a byte-oriented LZ77 that also refers to a static
+ * dictionary of the strings commonly found in the Matter logs, so that also the first lines of a block compress well.
+ *
+ * The encoded stream consists of the following tokens:
+ * - 0x00-0x7F: ASCII literal.
+ * - 0xFF <byte>: escaped literal for the bytes of value 0x80-0xFF.
+ * - 0x80-0xFE <distance>: copy of (token - 0x80 + kMinMatchLength) bytes located the given distance back,
+ *   where the distance is one byte (0x01-0x7F) or two bytes (0x80-0xFF high byte with the top bit cleared).
+ */
+namespace DiagnosticLogsCompression
+{
+
+/* Maximum size of uncompressed data in a block. */
+constexpr size_t kMaxBlockSize = CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION_BLOCK_SIZE;
+
+/**
+ * @brief Get the maximum size of the compressed data, reached if all bytes must be escaped.
+ *
+ * @param size size of the data to be compressed
+ */
+constexpr size_t GetMaxCompressedSize(size_t size)
+{
+	return 2 * size;
+}
+
+/**
+ * @brief Compress data appended to a block.
+ *
+ * The method is not re-entrant and must be called with the write lock of the logs held.
+ *
+ * @param block address of the uncompressed block data, consisting of the data already compressed in the block
+ *	  followed by the data to be compressed
+ * @param offset size of the data already compressed in the block
+ * @param size total size of the block data, up to kMaxBlockSize
+ * @param output address of the buffer for the compressed data
+ * @param outputSize size of the output buffer
+ *
+ * @return size of the compressed data, or 0 if the data does not fit the output buffer.
+ */
+size_t Compress(const uint8_t *block, size_t offset, size_t size, uint8_t *output, size_t outputSize);
+
+/**
+ * @brief Decompress a block.
+ *
+ * @param input address of the compressed block data
+ * @param inputSize size of the compressed block data
+ * @param output address of the buffer for the decompressed block data
+ * @param outputSize size of the output buffer
+ *
+ * @return size of the decompressed data, or 0 if the compressed data is corrupted or does not fit the output buffer.
+ */
+size_t Decompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputSize);
+
+} /* namespace DiagnosticLogsCompression */
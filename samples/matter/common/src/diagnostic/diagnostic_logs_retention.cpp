@@ -13,6 +13,14 @@ using namespace chip;
 
 K_MUTEX_DEFINE(sWriteMutex);
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+namespace
+{
+/* Compressed data, shared by the writers and the readers under the write mutex. */
+uint8_t sCompressedBuffer[DiagnosticLogsCompression::GetMaxCompressedSize(DiagnosticLogsCompression::kMaxBlockSize)];
+} /* namespace */
+#endif
+
 CHIP_ERROR DiagnosticLogsRetention::Init()
 {
 	if (mIsInitialized) {
@@ -27,6 +35,34 @@ CHIP_ERROR DiagnosticLogsRetention::Init()
 
 	int ret = retention_is_valid(mPartition);
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	/* The buffer must be able to store at least a single block. */
+	VerifyOrReturnError(mCapacity >= kMaxBlockFootprint, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+	const bool valid = ret == 1;
+
+	if (valid) {
+		/* Load the header data from retention RAM. */
+		ret = retention_read(mPartition, 0, reinterpret_cast<uint8_t *>(&mCurrentSize), sizeof(mCurrentSize));
+		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+		ret = retention_read(mPartition, sizeof(mCurrentSize), reinterpret_cast<uint8_t *>(&mDataBegin),
+				     sizeof(mDataBegin));
+		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+		ret = retention_read(mPartition, sizeof(mCurrentSize) + sizeof(mDataBegin),
+				     reinterpret_cast<uint8_t *>(&mLogsSize), sizeof(mLogsSize));
+		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+	}
+
+	/* If data is invalid just clean the header data, as we are not sure which part is corrupted. */
+	if (!valid || mCurrentSize > mCapacity || mDataBegin >= mCapacity) {
+		mCurrentSize = 0;
+		mDataBegin = 0;
+		mLogsSize = 0;
+		ReturnErrorOnFailure(WriteHeader());
+	}
+#else
 	/* If data is invalid just clean the header data, as we are not sure which part is corrupted. */
 	if (ret != 1) {
 		ret = retention_write(mPartition, 0, reinterpret_cast<uint8_t *>(&mCurrentSize), sizeof(mCurrentSize));
@@ -43,6 +79,7 @@ CHIP_ERROR DiagnosticLogsRetention::Init()
 				     sizeof(mDataBegin));
 		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
 	}
+#endif
 
 	mDataEnd = mDataBegin + mCurrentSize > mCapacity ? mCurrentSize + mDataBegin - mCapacity :
 							   mDataBegin + mCurrentSize;
@@ -57,6 +94,14 @@ CHIP_ERROR DiagnosticLogsRetention::Clear()
 	int ret = retention_clear(mPartition);
 
 	if (ret == 0) {
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+		/* Count the cleared data as dropped, so that the readers in progress detect it. */
+		k_mutex_lock(&sWriteMutex, K_FOREVER);
+		mDroppedSize += mCurrentSize;
+		mLogsSize = 0;
+		mBlockOpen = false;
+		k_mutex_unlock(&sWriteMutex);
+#endif
 		mCurrentSize = 0;
 		mDataBegin = 0;
 		mDataEnd = 0;
@@ -69,6 +114,14 @@ CHIP_ERROR DiagnosticLogsRetention::PushLog(const void *data, size_t size)
 {
 	VerifyOrReturnError(data, CHIP_ERROR_INVALID_ARGUMENT);
 	VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	k_mutex_lock(&sWriteMutex, K_FOREVER);
+	const CHIP_ERROR err = PushCompressedLog(reinterpret_cast<const uint8_t *>(data), size);
+	k_mutex_unlock(&sWriteMutex);
+
+	return err;
+#else
 	VerifyOrReturnError(size < mCapacity, CHIP_ERROR_BUFFER_TOO_SMALL);
 
 	/* Make sure that no-one will start write operation from different thread in the same time. */
@@ -122,6 +175,7 @@ CHIP_ERROR DiagnosticLogsRetention::PushLog(const void *data, size_t size)
 	k_mutex_unlock(&sWriteMutex);
 
 	return CHIP_NO_ERROR;
+#endif
 }
 
 CHIP_ERROR DiagnosticLogsRetention::GetLogs(chip::MutableByteSpan &outBuffer, uint32_t &readOffset, size_t totalSize,
@@ -162,11 +216,254 @@ CHIP_ERROR DiagnosticLogsRetention::GetLogs(chip::MutableByteSpan &outBuffer, ui
 	return CHIP_NO_ERROR;
 }
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+CHIP_ERROR DiagnosticLogsRetention::ReadRing(uint32_t offset, void *data, size_t size)
+{
+	/* Split the read if the data wraps around the buffer. */
+	const size_t firstPart = MIN(size, mCapacity - offset);
+	int ret = retention_read(mPartition, GetRetentionAddress(offset), reinterpret_cast<uint8_t *>(data), firstPart);
+	VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+	if (firstPart < size) {
+		ret = retention_read(mPartition, GetRetentionAddress(0), reinterpret_cast<uint8_t *>(data) + firstPart,
+				     size - firstPart);
+		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+	}
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DiagnosticLogsRetention::WriteRing(uint32_t offset, const void *data, size_t size)
+{
+	/* Split the write if the data wraps around the buffer. */
+	const size_t firstPart = MIN(size, mCapacity - offset);
+	int ret = retention_write(mPartition, GetRetentionAddress(offset), reinterpret_cast<const uint8_t *>(data),
+				  firstPart);
+	VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+	if (firstPart < size) {
+		ret = retention_write(mPartition, GetRetentionAddress(0),
+				      reinterpret_cast<const uint8_t *>(data) + firstPart, size - firstPart);
+		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+	}
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DiagnosticLogsRetention::WriteHeader()
+{
+	int ret = retention_write(mPartition, 0, reinterpret_cast<uint8_t *>(&mCurrentSize), sizeof(mCurrentSize));
+	VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+	ret = retention_write(mPartition, sizeof(mCurrentSize), reinterpret_cast<uint8_t *>(&mDataBegin),
+			      sizeof(mDataBegin));
+	VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+	ret = retention_write(mPartition, sizeof(mCurrentSize) + sizeof(mDataBegin),
+			      reinterpret_cast<uint8_t *>(&mLogsSize), sizeof(mLogsSize));
+	VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DiagnosticLogsRetention::DropOldestBlock()
+{
+	BlockHeader header;
+
+	ReturnErrorOnFailure(ReadRing(mDataBegin, &header, sizeof(header)));
+
+	const size_t footprint = sizeof(header) + header.mCompressedSize;
+
+	/* The oldest block is corrupted, drop all data. */
+	if (footprint > mCurrentSize || header.mSize > mLogsSize) {
+		mDroppedSize += mCurrentSize;
+		mCurrentSize = 0;
+		mLogsSize = 0;
+		mBlockOpen = false;
+		return CHIP_NO_ERROR;
+	}
+
+	if (mBlockOpen && mBlockOffset == mDataBegin) {
+		mBlockOpen = false;
+	}
+
+	mDataBegin = RingOffset(mDataBegin + footprint);
+	mCurrentSize -= footprint;
+	mLogsSize -= header.mSize;
+	mDroppedSize += footprint;
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DiagnosticLogsRetention::PushCompressedLog(const uint8_t *data, size_t size)
+{
+	while (size > 0) {
+		const size_t chunkSize = MIN(size, kMaxBlockSize);
+
+		/* Start a new block if the data does not fit the one that the logs are appended to. */
+		if (!mBlockOpen || mBlockHeader.mSize + chunkSize > kMaxBlockSize) {
+			mBlockOpen = false;
+			mBlockHeader = {};
+		}
+
+		memcpy(mBlock + mBlockHeader.mSize, data, chunkSize);
+
+		const size_t compressedSize = DiagnosticLogsCompression::Compress(
+			mBlock, mBlockHeader.mSize, mBlockHeader.mSize + chunkSize, sCompressedBuffer,
+			sizeof(sCompressedBuffer));
+		VerifyOrReturnError(compressedSize > 0, CHIP_ERROR_INTERNAL);
+
+		const bool newBlock = !mBlockOpen;
+		const size_t requiredSize = compressedSize + (newBlock ? sizeof(BlockHeader) : 0);
+
+		/* There is no place for the new data. Forget the oldest blocks. */
+		while (mCapacity - mCurrentSize < requiredSize && (newBlock || mBlockOpen)) {
+			ReturnErrorOnFailure(DropOldestBlock());
+		}
+
+		/* The block that the logs are appended to has been dropped, store the data in a new block. */
+		if (!newBlock && !mBlockOpen) {
+			continue;
+		}
+
+		if (newBlock) {
+			mBlockOffset = RingOffset(mDataBegin + mCurrentSize);
+			mBlockOpen = true;
+			mCurrentSize += sizeof(BlockHeader);
+		}
+
+		ReturnErrorOnFailure(
+			WriteRing(RingOffset(mDataBegin + mCurrentSize), sCompressedBuffer, compressedSize));
+
+		mBlockHeader.mCompressedSize += compressedSize;
+		mBlockHeader.mSize += chunkSize;
+		mCurrentSize += compressedSize;
+		mLogsSize += chunkSize;
+
+		ReturnErrorOnFailure(WriteRing(mBlockOffset, &mBlockHeader, sizeof(mBlockHeader)));
+		ReturnErrorOnFailure(WriteHeader());
+
+		data += chunkSize;
+		size -= chunkSize;
+	}
+
+	mDataEnd = RingOffset(mDataBegin + mCurrentSize);
+
+	return CHIP_NO_ERROR;
+}
+
+void DiagnosticLogsRetention::StartReading(uint32_t &position, uint32_t &endPosition, size_t &logsSize)
+{
+	k_mutex_lock(&sWriteMutex, K_FOREVER);
+
+	/* Close the block, so that the new logs do not change the blocks being read. */
+	mBlockOpen = false;
+
+	position = mDroppedSize;
+	endPosition = mDroppedSize + mCurrentSize;
+	logsSize = mLogsSize;
+
+	k_mutex_unlock(&sWriteMutex);
+}
+
+CHIP_ERROR DiagnosticLogsRetention::ReadBlock(uint32_t &position, chip::MutableByteSpan &outBuffer)
+{
+	CHIP_ERROR err = CHIP_NO_ERROR;
+	BlockHeader header;
+	size_t size = 0;
+
+	k_mutex_lock(&sWriteMutex, K_FOREVER);
+
+	/* Detect the blocks dropped since the read process started. */
+	if (position < mDroppedSize || position - mDroppedSize >= mCurrentSize) {
+		err = CHIP_ERROR_NOT_FOUND;
+		goto exit;
+	}
+
+	{
+		const uint32_t offset = RingOffset(mDataBegin + (position - mDroppedSize));
+
+		SuccessOrExit(err = ReadRing(offset, &header, sizeof(header)));
+		VerifyOrExit(header.mCompressedSize <= sizeof(sCompressedBuffer) &&
+				     sizeof(header) + header.mCompressedSize <= mCurrentSize - (position - mDroppedSize),
+			     err = CHIP_ERROR_INTERNAL);
+		SuccessOrExit(err = ReadRing(RingOffset(offset + sizeof(header)), sCompressedBuffer,
+					     header.mCompressedSize));
+	}
+
+	size = DiagnosticLogsCompression::Decompress(sCompressedBuffer, header.mCompressedSize, outBuffer.data(),
+						     outBuffer.size());
+	VerifyOrExit(size == header.mSize, err = CHIP_ERROR_INTERNAL);
+
+	outBuffer.reduce_size(size);
+	position += sizeof(header) + header.mCompressedSize;
+
+exit:
+	k_mutex_unlock(&sWriteMutex);
+
+	return err;
+}
+#endif
+
 size_t DiagnosticLogsRetentionReader::GetLogsSize()
 {
 	return mDiagnosticLogsRetention.GetLogsSize();
 }
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+CHIP_ERROR DiagnosticLogsRetentionReader::GetLogs(chip::MutableByteSpan &outBuffer, bool &outIsEndOfLog)
+{
+	CHIP_ERROR err = CHIP_NO_ERROR;
+	size_t size = 0;
+
+	if (!mReadInProgress) {
+		/* Remember the positions, as the blocks read are not changed by later writes. */
+		mDiagnosticLogsRetention.StartReading(mReadOffset, mDataEnd, mTotalSize);
+		mBlockSize = 0;
+		mBlockReadOffset = 0;
+		mReadInProgress = true;
+	}
+
+	/* Decompress the logs lazily, one block at a time, as the output buffer is filled. */
+	while (size < outBuffer.size()) {
+		if (mBlockReadOffset == mBlockSize) {
+			if (mReadOffset >= mDataEnd) {
+				break;
+			}
+
+			MutableByteSpan block(mBlock);
+			err = mDiagnosticLogsRetention.ReadBlock(mReadOffset, block);
+
+			if (err != CHIP_NO_ERROR) {
+				/* The remaining blocks have been dropped or are corrupted, finish the logs here. */
+				mReadOffset = mDataEnd;
+				err = err == CHIP_ERROR_NOT_FOUND ? CHIP_NO_ERROR : err;
+				break;
+			}
+
+			mBlockSize = block.size();
+			mBlockReadOffset = 0;
+		}
+
+		const size_t copySize = MIN(outBuffer.size() - size, mBlockSize - mBlockReadOffset);
+
+		memcpy(outBuffer.data() + size, mBlock + mBlockReadOffset, copySize);
+		size += copySize;
+		mBlockReadOffset += copySize;
+	}
+
+	outBuffer.reduce_size(size);
+
+	if (mReadOffset >= mDataEnd && mBlockReadOffset == mBlockSize) {
+		mReadInProgress = false;
+		outIsEndOfLog = true;
+	} else {
+		outIsEndOfLog = false;
+	}
+
+	return err;
+}
+#else
 CHIP_ERROR DiagnosticLogsRetentionReader::GetLogs(chip::MutableByteSpan &outBuffer, bool &outIsEndOfLog)
 {
 	CHIP_ERROR err = CHIP_NO_ERROR;
@@ -190,6 +487,7 @@ CHIP_ERROR DiagnosticLogsRetentionReader::GetLogs(chip::MutableByteSpan &outBuff
 
 	return err;
 }
+#endif
 
 CHIP_ERROR DiagnosticLogsRetentionReader::FinishLogs()
 {
@@ -8,6 +8,10 @@
 
 #include "diagnostic_logs_intent_iface.h"
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+#include "diagnostic_logs_compression.h"
+#endif
+
 #include <lib/core/CHIPError.h>
 #include <lib/support/Span.h>
 #include <zephyr/retention/retention.h>
@@ -47,7 +51,11 @@ public:
 	 *
 	 * @return size of stored logs in bytes.
 	 */
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	size_t GetLogsSize() { return mLogsSize; }
+#else
 	size_t GetLogsSize() { return mCurrentSize; }
+#endif
 
 	/**
 	 * @brief Get an offset of the logs beginning in the buffer.
@@ -87,8 +95,55 @@ public:
 	CHIP_ERROR GetLogs(chip::MutableByteSpan &outBuffer, uint32_t &readOffset, size_t totalSize,
 			   uint32_t dataBegin);
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	/**
+	 * @brief Start reading the compressed logs.
+	 *
+	 * Closes the block that the logs are appended to, so that the blocks being read do not change.
+	 *
+	 * @param position reference to the position of the first block to be filled
+	 * @param endPosition reference to the position following the last block to be filled
+	 * @param logsSize reference to the uncompressed size of the logs to be filled
+	 */
+	void StartReading(uint32_t &position, uint32_t &endPosition, size_t &logsSize);
+
+	/**
+	 * @brief Read and decompress the block at the given position.
+	 *
+	 * Positions are counted from the boot over all the compressed data ever stored, so that the blocks dropped
+	 * during the read process can be detected.
+	 *
+	 * @param position reference to the position of the block, moved to the next block on success
+	 * @param outBuffer buffer for the decompressed block, its size is reduced to the block size
+	 *
+	 * @return CHIP_NO_ERROR on success, CHIP_ERROR_NOT_FOUND if the block has been dropped in the meantime,
+	 * the other error code on failure.
+	 */
+	CHIP_ERROR ReadBlock(uint32_t &position, chip::MutableByteSpan &outBuffer);
+#endif
+
 private:
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	struct BlockHeader {
+		uint16_t mCompressedSize;
+		uint16_t mSize;
+	};
+
+	static constexpr size_t kMaxBlockSize = DiagnosticLogsCompression::kMaxBlockSize;
+	static constexpr size_t kMaxBlockFootprint =
+		sizeof(BlockHeader) + DiagnosticLogsCompression::GetMaxCompressedSize(kMaxBlockSize);
+
+	CHIP_ERROR PushCompressedLog(const uint8_t *data, size_t size);
+	CHIP_ERROR ReadRing(uint32_t offset, void *data, size_t size);
+	CHIP_ERROR WriteRing(uint32_t offset, const void *data, size_t size);
+	CHIP_ERROR DropOldestBlock();
+	CHIP_ERROR WriteHeader();
+	uint32_t RingOffset(uint32_t offset) { return offset >= mCapacity ? offset - mCapacity : offset; }
+
+	const size_t kHeaderSize = sizeof(mCurrentSize) + sizeof(mDataBegin) + sizeof(mLogsSize);
+#else
 	const size_t kHeaderSize = sizeof(mCurrentSize) + sizeof(mDataBegin);
+#endif
 
 	bool mIsInitialized = false;
 	bool mWriteInProgress = false;
@@ -97,6 +152,18 @@ private:
 	uint32_t mDataEnd = 0;
 	size_t mCapacity = 0;
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	/* Uncompressed size of the stored logs. */
+	size_t mLogsSize = 0;
+	/* Compressed data dropped since the boot, used to track the read position of the blocks. */
+	uint32_t mDroppedSize = 0;
+	/* Uncompressed data of the block that the logs are appended to. */
+	uint8_t mBlock[kMaxBlockSize];
+	BlockHeader mBlockHeader = {};
+	uint32_t mBlockOffset = 0;
+	bool mBlockOpen = false;
+#endif
+
 	const struct device *mPartition;
 };
 
@@ -135,5 +202,11 @@ private:
 	size_t mTotalSize = 0;
 	uint32_t mDataBegin = 0;
 	uint32_t mDataEnd = 0;
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	/* Decompressed block being read, the logs are decompressed one block at a time. */
+	uint8_t mBlock[DiagnosticLogsCompression::kMaxBlockSize];
+	size_t mBlockSize = 0;
+	size_t mBlockReadOffset = 0;
+#endif
 	DiagnosticLogsRetention &mDiagnosticLogsRetention;
 };
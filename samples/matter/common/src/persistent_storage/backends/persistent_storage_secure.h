@@ -16,11 +16,12 @@ namespace Nrf
 class PersistentStorageSecure {
 protected:
 	PSErrorCode _NonSecureInit(PersistentStorageNode *rootNode);
-	PSErrorCode _NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
+	PSErrorCode _NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize, bool persistNow);
 	PSErrorCode _NonSecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
 	PSErrorCode _NonSecureHasEntry(PersistentStorageNode *node);
 	PSErrorCode _NonSecureRemove(PersistentStorageNode *node);
 	PSErrorCode _NonSecureFactoryReset();
+	PSErrorCode _NonSecureFlush();
 
 	PSErrorCode _SecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode _SecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
@@ -98,7 +99,7 @@ inline PSErrorCode PersistentStorageSecure::_NonSecureInit(PersistentStorageNode
 };
 
 inline PSErrorCode PersistentStorageSecure::_NonSecureStore(PersistentStorageNode *node, const void *data,
-							    size_t dataSize)
+							    size_t dataSize, bool persistNow)
 {
 	return PSErrorCode::NotSupported;
 }
@@ -124,4 +125,9 @@ inline PSErrorCode PersistentStorageSecure::_NonSecureFactoryReset()
 	return PSErrorCode::NotSupported;
 }
 
+inline PSErrorCode PersistentStorageSecure::_NonSecureFlush()
+{
+	return PSErrorCode::NotSupported;
+}
+
 } /* namespace Nrf */
@@ -5,6 +5,7 @@
  */
 
 #include "persistent_storage_settings.h"
+#include "../persistent_storage.h"
 
 #include <zephyr/logging/log.h>
 #include <zephyr/settings/settings.h>
@@ -96,10 +97,16 @@ PSErrorCode PersistentStorageSettings::_NonSecureInit(PersistentStorageNode *roo
 
 	mRootNode = rootNode;
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	k_mutex_init(&mCacheLock);
+	k_work_init_delayable(&mFlushWork, FlushWorkHandler);
+#endif
+
 	return settings_load() ? PSErrorCode::Failure : PSErrorCode::Success;
 }
 
-PSErrorCode PersistentStorageSettings::_NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize)
+PSErrorCode PersistentStorageSettings::_NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize,
+						       bool persistNow)
 {
 	if (!data || !node) {
 		return PSErrorCode::Failure;
@@ -111,7 +118,51 @@ PSErrorCode PersistentStorageSettings::_NonSecureStore(PersistentStorageNode *no
 		return PSErrorCode::Failure;
 	}
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	k_mutex_lock(&mCacheLock, K_FOREVER);
+
+	CacheEntry *entry = FindCacheEntry(key);
+
+	if (persistNow || dataSize == 0 || dataSize > sizeof(entry->mData)) {
+		/* Drop the cached data, as it is overwritten by the data written directly. */
+		if (entry) {
+			entry->mDirty = false;
+		}
+
+		k_mutex_unlock(&mCacheLock);
+
+		return (settings_save_one(key, data, dataSize) ? PSErrorCode::Failure : PSErrorCode::Success);
+	}
+
+	if (!entry) {
+		entry = FindCacheEntry(nullptr);
+	}
+
+	/* Write the cached data to free the entries if all are in use. */
+	if (!entry) {
+		FlushCache();
+		entry = FindCacheEntry(nullptr);
+	}
+
+	if (!entry) {
+		k_mutex_unlock(&mCacheLock);
+		return (settings_save_one(key, data, dataSize) ? PSErrorCode::Failure : PSErrorCode::Success);
+	}
+
+	strncpy(entry->mKey, key, sizeof(entry->mKey));
+	memcpy(entry->mData, data, dataSize);
+	entry->mDataSize = dataSize;
+	entry->mDirty = true;
+
+	/* The work is not rescheduled if already pending, so the deadline counts from the first cached write. */
+	k_work_schedule(&mFlushWork, K_MSEC(CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE_FLUSH_DEADLINE_MS));
+
+	k_mutex_unlock(&mCacheLock);
+
+	return PSErrorCode::Success;
+#else
 	return (settings_save_one(key, data, dataSize) ? PSErrorCode::Failure : PSErrorCode::Success);
+#endif
 }
 
 PSErrorCode PersistentStorageSettings::_NonSecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize,
@@ -127,6 +178,27 @@ PSErrorCode PersistentStorageSettings::_NonSecureLoad(PersistentStorageNode *nod
 		return PSErrorCode::Failure;
 	}
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	k_mutex_lock(&mCacheLock, K_FOREVER);
+
+	CacheEntry *entry = FindCacheEntry(key);
+
+	if (entry) {
+		const bool fits = entry->mDataSize <= dataMaxSize;
+
+		if (fits) {
+			memcpy(data, entry->mData, entry->mDataSize);
+			outSize = entry->mDataSize;
+		}
+
+		k_mutex_unlock(&mCacheLock);
+
+		return (fits ? PSErrorCode::Success : PSErrorCode::Failure);
+	}
+
+	k_mutex_unlock(&mCacheLock);
+#endif
+
 	size_t resultSize;
 
 	bool result = LoadEntry(key, data, dataMaxSize, &resultSize);
@@ -150,6 +222,16 @@ PSErrorCode PersistentStorageSettings::_NonSecureHasEntry(PersistentStorageNode
 		return PSErrorCode::Failure;
 	}
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	k_mutex_lock(&mCacheLock, K_FOREVER);
+	const bool cached = FindCacheEntry(key) != nullptr;
+	k_mutex_unlock(&mCacheLock);
+
+	if (cached) {
+		return PSErrorCode::Success;
+	}
+#endif
+
 	return (LoadEntry(key) ? PSErrorCode::Success : PSErrorCode::Failure);
 }
 
@@ -165,8 +247,23 @@ PSErrorCode PersistentStorageSettings::_NonSecureRemove(PersistentStorageNode *n
 		return PSErrorCode::Failure;
 	}
 
+	bool cached = false;
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	k_mutex_lock(&mCacheLock, K_FOREVER);
+
+	CacheEntry *entry = FindCacheEntry(key);
+
+	if (entry) {
+		entry->mDirty = false;
+		cached = true;
+	}
+
+	k_mutex_unlock(&mCacheLock);
+#endif
+
 	if (!LoadEntry(key)) {
-		return PSErrorCode::Failure;
+		return (cached ? PSErrorCode::Success : PSErrorCode::Failure);
 	}
 
 	settings_delete(key);
@@ -198,6 +295,17 @@ PSErrorCode PersistentStorageSettings::_NonSecureFactoryReset()
 		return PSErrorCode::Failure;
 	}
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	k_mutex_lock(&mCacheLock, K_FOREVER);
+
+	for (CacheEntry &cacheEntry : mCache) {
+		cacheEntry.mDirty = false;
+	}
+
+	k_mutex_unlock(&mCacheLock);
+	k_work_cancel_delayable(&mFlushWork);
+#endif
+
 	DeleteSubtreeEntry entry{ key, 0 };
 	int result = settings_load_subtree_direct(key, DeleteSubtreeCallback, &entry);
 
@@ -208,4 +316,57 @@ PSErrorCode PersistentStorageSettings::_NonSecureFactoryReset()
 	return PSErrorCode::Failure;
 }
 
+PSErrorCode PersistentStorageSettings::_NonSecureFlush()
+{
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	k_mutex_lock(&mCacheLock, K_FOREVER);
+	const bool result = FlushCache();
+	k_mutex_unlock(&mCacheLock);
+
+	return (result ? PSErrorCode::Success : PSErrorCode::Failure);
+#else
+	return PSErrorCode::Success;
+#endif
+}
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+PersistentStorageSettings::CacheEntry *PersistentStorageSettings::FindCacheEntry(const char *key)
+{
+	/* Entries that are not dirty are free. Passing nullptr as the key returns a free entry. */
+	for (CacheEntry &entry : mCache) {
+		if (key ? (entry.mDirty && strcmp(entry.mKey, key) == 0) : !entry.mDirty) {
+			return &entry;
+		}
+	}
+
+	return nullptr;
+}
+
+bool PersistentStorageSettings::FlushCache()
+{
+	bool result = true;
+
+	for (CacheEntry &entry : mCache) {
+		if (!entry.mDirty) {
+			continue;
+		}
+
+		if (settings_save_one(entry.mKey, entry.mData, entry.mDataSize) != 0) {
+			LOG_ERR("Failed to write cached key %s", entry.mKey);
+			result = false;
+		}
+
+		/* Free the entry even on failure, so a broken key does not block the cache. */
+		entry.mDirty = false;
+	}
+
+	return result;
+}
+
+void PersistentStorageSettings::FlushWorkHandler(k_work *work)
+{
+	GetPersistentStorage().NonSecureFlush();
+}
+#endif
+
 } /* namespace Nrf */
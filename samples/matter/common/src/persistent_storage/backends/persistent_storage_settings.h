@@ -8,16 +8,21 @@
 
 #include "../persistent_storage_common.h"
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+#include <zephyr/kernel.h>
+#endif
+
 namespace Nrf
 {
 class PersistentStorageSettings {
 protected:
 	PSErrorCode _NonSecureInit(PersistentStorageNode *rootNode);
-	PSErrorCode _NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
+	PSErrorCode _NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize, bool persistNow);
 	PSErrorCode _NonSecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
 	PSErrorCode _NonSecureHasEntry(PersistentStorageNode *node);
 	PSErrorCode _NonSecureRemove(PersistentStorageNode *node);
 	PSErrorCode _NonSecureFactoryReset();
+	PSErrorCode _NonSecureFlush();
 
 	PSErrorCode _SecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode _SecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
@@ -30,6 +35,24 @@ private:
 	bool LoadEntry(const char *key, void *data = nullptr, size_t dataMaxSize = 0, size_t *outSize = nullptr);
 
 	PersistentStorageNode *mRootNode{ nullptr };
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE
+	/* Entry of the write-behind cache, holding data that is not yet written to the settings. */
+	struct CacheEntry {
+		char mKey[PersistentStorageNode::kMaxKeyNameLength];
+		uint8_t mData[CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE_MAX_DATA_SIZE];
+		size_t mDataSize;
+		bool mDirty;
+	};
+
+	CacheEntry *FindCacheEntry(const char *key);
+	bool FlushCache();
+	static void FlushWorkHandler(k_work *work);
+
+	CacheEntry mCache[CONFIG_NCS_SAMPLE_MATTER_SETTINGS_STORAGE_WRITE_CACHE_ENTRIES];
+	k_mutex mCacheLock;
+	k_work_delayable mFlushWork;
+#endif
 };
 
 inline PSErrorCode PersistentStorageSettings::_SecureInit(PersistentStorageNode *rootNode)
@@ -36,13 +36,18 @@ public:
 	/**
 	 * @brief Store data into the persistent storage.
 	 *
+	 * If the backend caches the written data, the data is written to the persistent storage within the flush
+	 * deadline of the backend, unless persistNow is set.
+	 *
 	 * @param node address of the tree node containing information about the key.
 	 * @param data data to store into a specific key.
 	 * @param dataSize a size of input buffer.
+	 * @param persistNow write the data to the persistent storage before returning, bypassing the cache.
 	 * @return true if key has been written successfully.
 	 * @return false an error occurred.
 	 */
-	PSErrorCode NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
+	PSErrorCode NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize,
+				   bool persistNow = false);
 
 	/**
 	 * @brief Load data from the persistent storage.
@@ -85,6 +90,14 @@ public:
 	 */
 	PSErrorCode NonSecureFactoryReset();
 
+	/**
+	 * @brief Write all cached data to the persistent storage.
+	 *
+	 * @return true if all cached data has been written successfully or the backend does not cache data.
+	 * @return false an error occurred.
+	 */
+	PSErrorCode NonSecureFlush();
+
 	/* Secure storage API counterparts.*/
 	PSErrorCode SecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode SecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
@@ -126,9 +139,10 @@ inline PSErrorCode PersistentStorage::NonSecureInit(PersistentStorageNode *rootN
 	return Impl()->_NonSecureInit(rootNode);
 };
 
-inline PSErrorCode PersistentStorage::NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize)
+inline PSErrorCode PersistentStorage::NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize,
+						     bool persistNow)
 {
-	return Impl()->_NonSecureStore(node, data, dataSize);
+	return Impl()->_NonSecureStore(node, data, dataSize, persistNow);
 }
 
 inline PSErrorCode PersistentStorage::NonSecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize,
@@ -152,6 +166,11 @@ inline PSErrorCode PersistentStorage::NonSecureFactoryReset()
 	return Impl()->_NonSecureFactoryReset();
 }
 
+inline PSErrorCode PersistentStorage::NonSecureFlush()
+{
+	return Impl()->_NonSecureFlush();
+}
+
 /* Secure storage API. */
 inline PSErrorCode PersistentStorage::SecureInit(PersistentStorageNode *rootNode)
 {
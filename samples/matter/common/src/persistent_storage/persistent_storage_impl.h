@@ -36,6 +36,7 @@ class PersistentStorageImpl : public PersistentStorage
 	using PersistentStorageSettings::_NonSecureLoad;
 	using PersistentStorageSettings::_NonSecureRemove;
 	using PersistentStorageSettings::_NonSecureFactoryReset;
+	using PersistentStorageSettings::_NonSecureFlush;
 	using PersistentStorageSettings::_NonSecureStore;
 #endif
 
@@ -35,9 +35,13 @@ namespace Nrf
 	 * retrieving a value by key (At()) - this operation is not safe if the key may not exist in the map
 	 * retrieving a value by key (TryAt()) - this operation is safe if the key may not exist in the map, and returns
        a std::nullopt if the key is not found
+   By default, the lookup by key walks through all slots of the map. If Hashed is set to true, FiniteMap
+   additionally maintains an open addressing hash index of the stored keys, so that the lookup by key takes constant
+   time on average, at the cost of 2 * N to 4 * N additional ElementCounterType values.
    Prerequisites:
      * T1 must be trivial and the maximum numeric limit for the T1-type value is reserved and assigned as an invalid
    key.
+     * T1 must be an integral or enum type if Hashed is set to true.
      * T2 must have move semantics and bool()/==operators implemented
 */
 
@@ -49,14 +53,27 @@ template <typename T> struct KeyTypeHelper<T, true> {
 	using type = typename std::underlying_type<T>::type;
 };
 
-template <typename T1, typename T2, uint16_t N> struct FiniteMap {
+/* Returns the smallest power of two that is not less than n. */
+constexpr std::size_t FiniteMapIndexSize(std::size_t n)
+{
+	std::size_t size = 1;
+	while (size < n) {
+		size <<= 1;
+	}
+	return size;
+}
+
+template <typename T1, typename T2, uint16_t N, bool Hashed = false> struct FiniteMap {
 	static_assert(std::is_trivial_v<T1>);
+	static_assert(!Hashed || std::is_integral_v<T1> || std::is_enum_v<T1>);
 
 	using KeyType = typename KeyTypeHelper<T1, std::is_enum_v<T1>>::type;
 	using ElementCounterType = uint16_t;
 
 	static constexpr T1 kInvalidKey{ static_cast<T1>(std::numeric_limits<KeyType>::max()) };
 	static constexpr std::size_t kNoSlotsFound{ N + 1 };
+	/* The index is at least twice as big as the map, so it always has empty entries that terminate the probing. */
+	static constexpr std::size_t kIndexSize{ Hashed ? FiniteMapIndexSize(2 * N) : 1 };
 
 	struct Item {
 		/* Initialize with invalid key (0 is a valid key) */
@@ -77,6 +94,9 @@ template <typename T1, typename T2, uint16_t N> struct FiniteMap {
 			mMap[slot].key = key;
 			mMap[slot].value = std::move(value);
 			mElementsCount++;
+			if constexpr (Hashed) {
+				IndexInsert(slot);
+			}
 		} else {
 			return false;
 		}
@@ -85,11 +105,13 @@ template <typename T1, typename T2, uint16_t N> struct FiniteMap {
 
 	bool Erase(T1 key)
 	{
-		const auto &it = std::find_if(std::begin(mMap), std::end(mMap),
-					      [key](const Item &item) { return item.key == key; });
-		if (it != std::end(mMap)) {
-			it->value = T2{};
-			it->key = kInvalidKey;
+		std::size_t slot = FindSlot(key);
+		if (slot != kNoSlotsFound) {
+			if constexpr (Hashed) {
+				IndexErase(slot);
+			}
+			mMap[slot].value = T2{};
+			mMap[slot].key = kInvalidKey;
 			mElementsCount--;
 			return true;
 		}
@@ -100,37 +122,30 @@ template <typename T1, typename T2, uint16_t N> struct FiniteMap {
 	T2 &operator[](T1 key)
 	{
 		static T2 dummyObject;
-		for (auto &it : mMap) {
-			if (key == it.key)
-				return it.value;
+		std::size_t slot = FindSlot(key);
+		if (slot != kNoSlotsFound) {
+			return mMap[slot].value;
 		}
 		return dummyObject;
 	}
 
-	bool Contains(T1 key) const
-	{
-		for (const auto &it : mMap) {
-			if (key == it.key)
-				return true;
-		}
-		return false;
-	}
+	bool Contains(T1 key) const { return FindSlot(key) != kNoSlotsFound; }
 
 	T2 At(T1 key) const
 	{
 		static T2 dummyObject;
-		for (const auto &it : mMap) {
-			if (key == it.key)
-				return it.value;
+		std::size_t slot = FindSlot(key);
+		if (slot != kNoSlotsFound) {
+			return mMap[slot].value;
 		}
 		return dummyObject;
 	}
 
 	std::optional<T2> TryAt(T1 key) const
 	{
-		for (const auto &it : mMap) {
-			if (key == it.key)
-				return it.value;
+		std::size_t slot = FindSlot(key);
+		if (slot != kNoSlotsFound) {
+			return mMap[slot].value;
 		}
 		return std::nullopt;
 	}
@@ -168,6 +183,62 @@ template <typename T1, typename T2, uint16_t N> struct FiniteMap {
 
 	Item mMap[N];
 	ElementCounterType mElementsCount{ 0 };
+
+private:
+	/* Index entries store the slot number increased by one, 0 marks an empty entry. */
+	using IndexType = std::conditional_t<Hashed, ElementCounterType[kIndexSize], ElementCounterType>;
+
+	static constexpr std::size_t kIndexMask{ kIndexSize - 1 };
+
+	static std::size_t Hash(T1 key) { return static_cast<std::size_t>(static_cast<KeyType>(key)) & kIndexMask; }
+
+	std::size_t FindSlot(T1 key) const
+	{
+		if constexpr (Hashed) {
+			for (std::size_t pos = Hash(key); mIndex[pos] != 0; pos = (pos + 1) & kIndexMask) {
+				if (mMap[mIndex[pos] - 1].key == key) {
+					return mIndex[pos] - 1;
+				}
+			}
+		} else {
+			for (std::size_t slot = 0; slot < N; slot++) {
+				if (key == mMap[slot].key) {
+					return slot;
+				}
+			}
+		}
+		return kNoSlotsFound;
+	}
+
+	void IndexInsert(std::size_t slot)
+	{
+		std::size_t pos = Hash(mMap[slot].key);
+		while (mIndex[pos] != 0) {
+			pos = (pos + 1) & kIndexMask;
+		}
+		mIndex[pos] = static_cast<ElementCounterType>(slot + 1);
+	}
+
+	void IndexErase(std::size_t slot)
+	{
+		std::size_t pos = Hash(mMap[slot].key);
+		while (mIndex[pos] != slot + 1) {
+			pos = (pos + 1) & kIndexMask;
+		}
+
+		/* Shift back the following entries of the probe sequence, so that no tombstones are needed. */
+		mIndex[pos] = 0;
+		for (std::size_t next = (pos + 1) & kIndexMask; mIndex[next] != 0; next = (next + 1) & kIndexMask) {
+			std::size_t home = Hash(mMap[mIndex[next] - 1].key);
+			if (((next - home) & kIndexMask) >= ((next - pos) & kIndexMask)) {
+				mIndex[pos] = mIndex[next];
+				mIndex[next] = 0;
+				pos = next;
+			}
+		}
+	}
+
+	IndexType mIndex{};
 };
 
 } /* namespace Nrf */
@@ -7,6 +7,9 @@
 #include "app_task.h"
 
 #include "app/matter_init.h"
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SENSOR_SCHEDULER
+#include "app/sensor_scheduler.h"
+#endif
 #include "app/task_executor.h"
 #include "board/board.h"
 #include "clusters/identify.h"
@@ -166,6 +169,19 @@ void AppTask::UpdateTemperatureMeasurement()
 #endif
 }
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SENSOR_SCHEDULER
+void AppTask::UpdateTemperature(void *context)
+{
+	AppTask::Instance().UpdateTemperatureMeasurement();
+
+	Protocols::InteractionModel::Status status = Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Set(
+		kTemperatureSensorEndpointId, AppTask::Instance().GetCurrentTemperature());
+
+	if (status != Protocols::InteractionModel::Status::Success) {
+		LOG_ERR("Updating temperature measurement failed %x", to_underlying(status));
+	}
+}
+#else
 void AppTask::UpdateTemperatureTimeoutCallback(k_timer *timer)
 {
 	if (!timer || !timer->user_data) {
@@ -186,6 +202,7 @@ void AppTask::UpdateTemperatureTimeoutCallback(k_timer *timer)
 		},
 		reinterpret_cast<intptr_t>(timer->user_data));
 }
+#endif
 
 CHIP_ERROR AppTask::Init()
 {
@@ -236,9 +253,15 @@ CHIP_ERROR AppTask::StartApp()
 
 	mTemperatureSensorMaxValue = val.Value();
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SENSOR_SCHEDULER
+	ReturnErrorOnFailure(Nrf::Matter::SensorScheduler::Instance().Init());
+	ReturnErrorOnFailure(Nrf::Matter::SensorScheduler::Instance().Register(
+		AppTask::UpdateTemperature, this, kTemperatureMeasurementIntervalMs, kTemperatureMeasurementMaxIntervalMs));
+#else
 	k_timer_init(&mTimer, AppTask::UpdateTemperatureTimeoutCallback, nullptr);
 	k_timer_user_data_set(&mTimer, this);
 	k_timer_start(&mTimer, K_MSEC(kTemperatureMeasurementIntervalMs), K_MSEC(kTemperatureMeasurementIntervalMs));
+#endif
 #ifndef CONFIG_NCS_SAMPLE_MATTER_USE_DEFAULT_BUTTON_HANDLER
 	k_timer_init(&sBtn1Timer, &ButtonTimerTimeoutCallback, nullptr);
 #endif
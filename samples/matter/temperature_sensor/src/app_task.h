@@ -34,12 +34,20 @@ public:
 
 private:
 	CHIP_ERROR Init();
-	k_timer mTimer;
 
 	static constexpr uint16_t kTemperatureMeasurementIntervalMs = 10000; /* 10 seconds */
 	static constexpr uint16_t kTemperatureMeasurementStep = 100; /* 1 degree Celsius */
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_SENSOR_SCHEDULER
+	/* Maximum interval between two measurements when the device does not enter the active mode. */
+	static constexpr uint32_t kTemperatureMeasurementMaxIntervalMs = 60000; /* 1 minute */
+
+	static void UpdateTemperature(void *context);
+#else
+	k_timer mTimer;
+
 	static void UpdateTemperatureTimeoutCallback(k_timer *timer);
+#endif
 
 	static void ButtonEventHandler(Nrf::ButtonState state, Nrf::ButtonMask hasChanged);
 
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Utility for creating delta patches for the delta MCUboot DFU target.
+
+The patch transforms the signed MCUboot image running on the device (source)
+into the new signed MCUboot image (target). It consists of a header followed
+by a sequence of commands, all little-endian:
+
+header:  magic ("NDL1"), source size, source CRC32, target size, target CRC32
+command: type, length, source offset
+         COPY   (0) - copy length bytes from the source offset
+         ADD    (1) - followed by length bytes, added to the source bytes
+         INSERT (2) - followed by length bytes
+
+Usage example:
+./dfu_delta_tool.py create old/app_update.bin new/app_update.bin app_update.delta
+"""
+
+import argparse
+import struct
+import zlib
+
+MAGIC = 0x314c444e
+HEADER_FORMAT = '<IIIII'
+CMD_FORMAT = '<III'
+CMD_SIZE = struct.calcsize(CMD_FORMAT)
+
+CMD_COPY = 0
+CMD_ADD = 1
+CMD_INSERT = 2
+
+# Size of the blocks used for finding matches in the source image
+BLOCK_SIZE = 16
+# Shorter matches cost more as a command than as inserted data
+MIN_COPY_SIZE = 2 * CMD_SIZE
+
+
+def build_index(source: bytes) -> dict:
+    """
+    Map source blocks to their first offset, sampled at 4-byte alignment
+    """
+
+    index = {}
+    for offset in range(0, len(source) - BLOCK_SIZE + 1, 4):
+        index.setdefault(source[offset:offset + BLOCK_SIZE], offset)
+    return index
+
+
+def match_length(source: bytes, source_offset: int, target: bytes, target_offset: int) -> int:
+    length = 0
+    while (source_offset + length < len(source) and target_offset + length < len(target)
+           and source[source_offset + length] == target[target_offset + length]):
+        length += 1
+    return length
+
+
+def literal_command(source: bytes, source_offset: int, data: bytes) -> tuple:
+    """
+    Use an add command if the data is similar to the source at the same position
+    """
+
+    if source_offset + len(data) <= len(source):
+        aligned = source[source_offset:source_offset + len(data)]
+        equal = sum(1 for a, b in zip(aligned, data) if a == b)
+        if equal * 2 >= len(data):
+            diff = bytes((b - a) & 0xff for a, b in zip(aligned, data))
+            return (CMD_ADD, len(data), source_offset, diff)
+
+    return (CMD_INSERT, len(data), 0, data)
+
+
+def generate_commands(source: bytes, target: bytes) -> list:
+    index = build_index(source)
+    commands = []
+    literal = bytearray()
+    # Source position following the last command, used for add commands
+    source_cursor = 0
+    position = 0
+
+    def flush_literal():
+        nonlocal source_cursor
+        if literal:
+            commands.append(literal_command(source, source_cursor, bytes(literal)))
+            source_cursor += len(literal)
+            literal.clear()
+
+    while position < len(target):
+        best_offset = None
+        best_length = 0
+
+        candidates = [source_cursor + len(literal)]
+        block = target[position:position + BLOCK_SIZE]
+        if len(block) == BLOCK_SIZE and block in index:
+            candidates.append(index[block])
+
+        for offset in candidates:
+            length = match_length(source, offset, target, position)
+            if length > best_length:
+                best_offset, best_length = offset, length
+
+        if best_length >= MIN_COPY_SIZE:
+            flush_literal()
+            commands.append((CMD_COPY, best_length, best_offset, b''))
+            source_cursor = best_offset + best_length
+            position += best_length
+        else:
+            literal.append(target[position])
+            position += 1
+
+    flush_literal()
+    return commands
+
+
+def generate_patch(source_path: str, target_path: str, output_path: str) -> None:
+    with open(source_path, 'rb') as source_file:
+        source = source_file.read()
+    with open(target_path, 'rb') as target_file:
+        target = target_file.read()
+
+    commands = generate_commands(source, target)
+
+    with open(output_path, 'wb') as output_file:
+        output_file.write(struct.pack(HEADER_FORMAT, MAGIC, len(source), zlib.crc32(source),
+                                      len(target), zlib.crc32(target)))
+        for cmd_type, length, source_offset, data in commands:
+            output_file.write(struct.pack(CMD_FORMAT, cmd_type, length, source_offset))
+            output_file.write(data)
+
+        patch_size = output_file.tell()
+
+    print(f'{len(commands)} commands, patch size {patch_size} bytes, '
+          f'target size {len(target)} bytes')
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Delta patch tool for the delta MCUboot DFU target',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+
+    subcommands = parser.add_subparsers(dest='subcommand', title='valid subcommands')
+
+    create_parser = subcommands.add_parser(
+        'create', help='Create delta patch')
+    create_parser.add_argument(
+        'source_file', help='Path to the signed image running on the device')
+    create_parser.add_argument(
+        'target_file', help='Path to the new signed image')
+    create_parser.add_argument(
+        'output_file', help='Path to output patch file')
+
+    args = parser.parse_args()
+
+    if args.subcommand == 'create':
+        generate_patch(args.source_file, args.target_file, args.output_file)
+    else:
+        parser.print_help()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,295 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""Convert ETB trace snapshots into a statistical hot function profile.
+
+The ETM of the device runs in the branch broadcast mode, so the trace contains the target
+address of every taken branch. Each address is mapped to the function that contains it
+using the symbols of the ELF file, and the functions are sorted by the number of branch
+targets they contain.
+"""
+
+import argparse
+import bisect
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+FRAME_SIZE = 16
+DEFAULT_TRACE_ID = 0x10
+
+SNAPSHOT_RE = re.compile(r'ETB snapshot (\d+) \((\d+) words\)')
+WORDS_RE = re.compile(r'^\s*((?:[0-9a-fA-F]{8}\s+){7}[0-9a-fA-F]{8})\s*$')
+
+
+def snapshots_from_log(lines):
+    """Yield the snapshots printed by the etb_trace dump shell command as bytes."""
+    words = None
+    expected = 0
+
+    for line in lines:
+        # Strip the shell prompt and log prefixes
+        match = SNAPSHOT_RE.search(line)
+        if match:
+            if words:
+                yield b''.join(struct.pack('<I', w) for w in words)
+            words = []
+            expected = int(match.group(2))
+            continue
+
+        if words is None:
+            continue
+
+        match = WORDS_RE.match(line)
+        if match and len(words) < expected:
+            words.extend(int(w, 16) for w in match.group(1).split())
+
+    if words:
+        yield b''.join(struct.pack('<I', w) for w in words)
+
+
+def deformat(data, trace_id):
+    """Extract the bytes of a trace source from CoreSight formatter frames."""
+    out = bytearray()
+    cur_id = None
+
+    for pos in range(0, len(data) - FRAME_SIZE + 1, FRAME_SIZE):
+        frame = data[pos:pos + FRAME_SIZE]
+
+        # Full frame synchronization packets are not part of the trace
+        if frame[12:16] == b'\xff\xff\xff\x7f' or frame == bytes(FRAME_SIZE):
+            continue
+
+        aux = frame[15]
+        for i in range(8):
+            even = frame[2 * i]
+            odd = frame[2 * i + 1] if i < 7 else None
+            aux_bit = (aux >> i) & 1
+
+            if even & 1:
+                new_id = even >> 1
+                if aux_bit and odd is not None and cur_id == trace_id:
+                    # The next byte still belongs to the previous source
+                    out.append(odd)
+                    odd = None
+                cur_id = new_id
+            elif cur_id == trace_id:
+                out.append((even & 0xFE) | aux_bit)
+
+            if odd is not None and cur_id == trace_id:
+                out.append(odd)
+
+    return bytes(out)
+
+
+class EtmDecoder:
+    """Minimal ETMv4 instruction trace decoder for the address packets of Armv8-M."""
+
+    # Single byte packets: trace on, function return, exception return, events and atoms
+    SINGLE_BYTE = {0x04, 0x05, 0x07, 0x80} | set(range(0x71, 0x80)) | \
+        set(range(0xC0, 0xD5)) | set(range(0xD5, 0xD8)) | set(range(0xD8, 0xE0)) | \
+        set(range(0xE0, 0x100))
+
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.addr_stack = [0, 0, 0]
+        self.skip_next_addr = False
+
+    def _byte(self):
+        if self.pos >= len(self.data):
+            raise EOFError
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def _var_len(self, max_len=9):
+        for _ in range(max_len):
+            if not self._byte() & 0x80:
+                return
+
+    def _async(self):
+        """Skip to the end of an A-sync packet, returns False if it is not one."""
+        start = self.pos
+        zeros = 1
+        while self.pos < len(self.data) and self.data[self.pos] == 0x00:
+            zeros += 1
+            self.pos += 1
+        if self.pos < len(self.data) and zeros >= 11 and self.data[self.pos] == 0x80:
+            self.pos += 1
+            return True
+        self.pos = start
+        return False
+
+    def _trace_info(self):
+        plctl = self._byte()
+        # INFO, KEY, SPEC and CYCT sections, each present if the related bit is set
+        for bit in range(4):
+            if plctl & (1 << bit):
+                self._var_len()
+
+    def _push_addr(self, addr):
+        self.addr_stack = [addr] + self.addr_stack[:2]
+        if self.skip_next_addr:
+            # Preferred return address of an exception, not a branch target
+            self.skip_next_addr = False
+            return None
+        return addr
+
+    def resync(self):
+        """Move to the next A-sync packet."""
+        while self.pos < len(self.data):
+            if self.data[self.pos] == 0x00:
+                self.pos += 1
+                if self._async():
+                    return True
+            else:
+                self.pos += 1
+        return False
+
+    def addresses(self):
+        """Yield the decoded branch target addresses."""
+        if not self.resync():
+            return
+
+        try:
+            while True:
+                header = self._byte()
+                addr = None
+
+                if header == 0x00:
+                    if not self._async():
+                        self.resync()
+                elif header == 0x01:
+                    self._trace_info()
+                elif header in (0x02, 0x03):
+                    self._var_len()
+                    if header == 0x03:
+                        self._var_len(3)
+                elif header == 0x06:
+                    if self._byte() & 0x80:
+                        self._byte()
+                    self.skip_next_addr = True
+                elif header == 0x81:
+                    self._byte()
+                elif header in (0x90, 0x91, 0x92):
+                    addr = self._push_addr(self.addr_stack[header - 0x90])
+                elif header in (0x95, 0x96):
+                    shift = 2 if header == 0x95 else 1
+                    b0 = self._byte()
+                    low = (b0 & 0x7F) << shift
+                    mask = 0x7F << shift
+                    if b0 & 0x80:
+                        low |= self._byte() << (shift + 7)
+                        mask |= 0xFF << (shift + 7)
+                    addr = self._push_addr((self.addr_stack[0] & ~mask) | low)
+                elif header in (0x9A, 0x9B, 0x82, 0x83):
+                    is0 = header in (0x9A, 0x82)
+                    b = [self._byte() for _ in range(4)]
+                    if is0:
+                        value = ((b[0] & 0x7F) << 2) | (b[1] << 9) | (b[2] << 16) | \
+                            (b[3] << 24)
+                    else:
+                        value = ((b[0] & 0x7F) << 1) | (b[1] << 8) | (b[2] << 16) | \
+                            (b[3] << 24)
+                    if header in (0x82, 0x83):
+                        # Context information byte
+                        self._byte()
+                    addr = self._push_addr(value)
+                elif header in self.SINGLE_BYTE:
+                    pass
+                else:
+                    # Unsupported packet, the length is not known
+                    if not self.resync():
+                        return
+
+                if addr is not None:
+                    yield addr
+        except EOFError:
+            return
+
+
+class SymbolMap:
+    """Map addresses to function names using the symbols of an ELF file."""
+
+    def __init__(self, elf_path):
+        funcs = {}
+        with open(elf_path, 'rb') as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if not isinstance(section, SymbolTableSection):
+                    continue
+                for sym in section.iter_symbols():
+                    if sym['st_info']['type'] != 'STT_FUNC' or sym['st_size'] == 0:
+                        continue
+                    # Clear the Thumb bit
+                    funcs[sym['st_value'] & ~1] = (sym.name, sym['st_size'])
+
+        self.starts = sorted(funcs)
+        self.funcs = [funcs[start] for start in self.starts]
+
+    def lookup(self, addr):
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i < 0:
+            return None
+        name, size = self.funcs[i]
+        return name if addr < self.starts[i] + size else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="ETB trace hot function profile",
+                                     allow_abbrev=False)
+    parser.add_argument("elf", help="ELF file of the traced firmware (zephyr.elf)")
+    parser.add_argument("input", help="Shell log with the output of the etb_trace dump "
+                        "command, or a binary ETB dump with --binary")
+    parser.add_argument("--binary", action="store_true",
+                        help="Input is a binary dump of the ETB RAM in little-endian words")
+    parser.add_argument("--trace-id", type=lambda x: int(x, 0), default=DEFAULT_TRACE_ID,
+                        help="Trace ID of the ETM (default: 0x10)")
+    parser.add_argument("--top", type=int, default=30,
+                        help="Number of functions to print (default: 30)")
+    args = parser.parse_args()
+
+    if args.binary:
+        with open(args.input, 'rb') as f:
+            snapshots = [f.read()]
+    else:
+        with open(args.input, errors='replace') as f:
+            snapshots = list(snapshots_from_log(f))
+
+    if not snapshots:
+        print(f"No snapshots found in {args.input}")
+        sys.exit(1)
+
+    symbols = SymbolMap(args.elf)
+    counts = {}
+    total = 0
+    unknown = 0
+
+    for snapshot in snapshots:
+        for addr in EtmDecoder(deformat(snapshot, args.trace_id)).addresses():
+            name = symbols.lookup(addr)
+            total += 1
+            if name is None:
+                unknown += 1
+                continue
+            counts[name] = counts.get(name, 0) + 1
+
+    print(f"{len(snapshots)} snapshots, {total} branch targets, "
+          f"{unknown} outside of known functions")
+    if total == 0:
+        return
+
+    print(f"{'Samples':>10} {'Share':>8}  Function")
+    for name, count in sorted(counts.items(), key=lambda x: x[1], reverse=True)[:args.top]:
+        print(f"{count:>10} {100 * count / total:>7.2f}%  {name}")
+
+
+if __name__ == "__main__":
+    main()
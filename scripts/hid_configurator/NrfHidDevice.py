@@ -45,6 +45,7 @@ class ConfigStatus(IntEnum):
     WRITE_FAIL         = 11
     DISCONNECTED       = 12
     GET_PEERS_CACHE    = 13
+    GET_WINDOW_SIZE    = 14
     FAULT              = 99
 
 class NrfHidTransport:
@@ -69,7 +70,8 @@ class NrfHidTransport:
                         ConfigStatus.GET_BOARD_NAME,
                         ConfigStatus.INDEX_PEERS,
                         ConfigStatus.GET_PEER,
-                        ConfigStatus.GET_PEERS_CACHE):
+                        ConfigStatus.GET_PEERS_CACHE,
+                        ConfigStatus.GET_WINDOW_SIZE):
             assert event_id == 0
             assert event_data_len == 0
         elif status == ConfigStatus.FETCH:
@@ -117,9 +119,28 @@ class NrfHidTransport:
 
         return (rcpt, event_id, status, event_data)
 
+    @staticmethod
+    def exchange_feature_reports(dev, recipient, event_id, event_data_list,
+                                 poll_interval=POLL_INTERVAL_DEFAULT):
+        # Device queues the set requests and provides a single response for all of them.
+        for event_data in event_data_list[:-1]:
+            data = NrfHidTransport._create_feature_report(recipient, event_id,
+                                                          ConfigStatus.SET, event_data)
+            try:
+                dev.send_feature_report(data)
+            except Exception as e:
+                logging.debug(f'Send feature report problem: {e}')
+                return False
+
+        success, _ = NrfHidTransport.exchange_feature_report(dev, recipient, event_id,
+                                                             ConfigStatus.SET,
+                                                             event_data_list[-1],
+                                                             poll_interval)
+        return success
+
     @staticmethod
     def exchange_feature_report(dev, recipient, event_id, status, event_data,
-                                poll_interval=POLL_INTERVAL_DEFAULT):
+                                poll_interval=POLL_INTERVAL_DEFAULT, log_error=True):
         data = NrfHidTransport._create_feature_report(recipient, event_id, status, event_data)
 
         try:
@@ -166,7 +187,7 @@ class NrfHidTransport:
             success = True
             if rsp_event_data is not None:
                 fetched_data = rsp_event_data
-        else:
+        elif log_error:
             logging.warning(f'Error response code: {rsp_status.name}')
 
         return success, fetched_data
@@ -181,6 +202,9 @@ class NrfHidDevice:
         self.board_name = None
         self.hwid = None
 
+        # Requests forwarded by a dongle are queued by the dongle.
+        self.window_size = NrfHidDevice._read_window_size(dev)
+
         board_name, hwid = NrfHidDevice._read_device_info(dev, recipient)
 
         if (board_name is not None) and (hwid is not None):
@@ -373,6 +397,20 @@ class NrfHidDevice:
 
         return device_config
 
+    @staticmethod
+    def _read_window_size(dev):
+        # Firmware that does not support the request can handle one request at a time.
+        success, fetched_data = NrfHidTransport.exchange_feature_report(dev,
+                                                                        LOCAL_RECIPIENT,
+                                                                        0,
+                                                                        ConfigStatus.GET_WINDOW_SIZE,
+                                                                        None,
+                                                                        log_error=False)
+        if not success or not fetched_data:
+            return 1
+
+        return max(1, fetched_data[0])
+
     @staticmethod
     def _read_device_info(dev, recipient):
         success, fetched_data = NrfHidTransport.exchange_feature_report(dev,
@@ -519,6 +557,29 @@ class NrfHidDevice:
     def config_set(self, module_name, option_name, value, poll_interval=POLL_INTERVAL_DEFAULT):
         return self._config_operation(module_name, option_name, False, value, poll_interval)
 
+    def config_set_window(self, module_name, option_name, values,
+                          poll_interval=POLL_INTERVAL_DEFAULT):
+        """Set option to subsequent values, the device acknowledges only the last request.
+        Number of values must not exceed window size of the device.
+        """
+        assert 0 < len(values) <= self.window_size
+
+        if not self.initialized():
+            print("Device not found")
+            return False
+
+        try:
+            event_id = NrfHidDevice._get_event_id(module_name, option_name, self.dev_config)
+        except KeyError:
+            print(f"No module: {module_name} or option: {option_name}")
+            return False
+
+        return NrfHidTransport.exchange_feature_reports(self.dev_ptr, self.recipient, event_id,
+                                                        values, poll_interval)
+
+    def get_window_size(self):
+        return self.window_size
+
     def get_complete_module_name(self, name):
         """complete module name consist of module name + '/' + variant name."""
         for key in self.dev_config:
@@ -696,20 +696,31 @@ def send_chunks(dev, img_csum, img_file, img_length, offset, sync_buffer_size, p
         # Set current progress
         progress_callback(int(offset / img_length * 1000))
 
-        # Read data from the file
-        chunk_len = EVENT_DATA_LEN_MAX
-        if next_checkpoint - offset < chunk_len:
-            chunk_len = next_checkpoint - offset
-        chunk_data = img_file.read(chunk_len)
-        chunk_len = len(chunk_data)
-        if chunk_len == 0:
+        # Read data from the file, up to window size of the device chunks at once
+        chunks = []
+        chunks_len = 0
+        while len(chunks) < dev.get_window_size():
+            chunk_len = EVENT_DATA_LEN_MAX
+            if next_checkpoint - (offset + chunks_len) < chunk_len:
+                chunk_len = next_checkpoint - (offset + chunks_len)
+            if chunk_len == 0:
+                break
+            chunk_data = img_file.read(chunk_len)
+            if len(chunk_data) == 0:
+                break
+            chunks.append(chunk_data)
+            chunks_len += len(chunk_data)
+        if chunks_len == 0:
             break
 
         # Send data to the device
-        logging.debug(f'Send DFU request: offset {offset}, size {chunk_len}')
+        logging.debug(f'Send DFU request: offset {offset}, size {chunks_len}')
         dfu_module_name = dev.get_complete_module_name('dfu')
         if dfu_module_name:
-            success = dev.config_set(dfu_module_name , 'data', chunk_data)
+            if len(chunks) == 1:
+                success = dev.config_set(dfu_module_name , 'data', chunks[0])
+            else:
+                success = dev.config_set_window(dfu_module_name , 'data', chunks)
         else:
             print('Module DFU not found')
             return False, offset
@@ -718,7 +729,7 @@ def send_chunks(dev, img_csum, img_file, img_length, offset, sync_buffer_size, p
             break
 
         # Progress checkpoint
-        offset += chunk_len
+        offset += chunks_len
         if offset >= next_checkpoint:
             success = dfu_checkpoint(img_csum, img_length, offset)
             if not success: break
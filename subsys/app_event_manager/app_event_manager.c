@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
@@ -12,6 +13,8 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/reboot.h>
 
+#include "app_event_manager_mem_slab.h"
+
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
@@ -20,8 +23,60 @@ static void event_processor_fn(struct k_work *work);
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
 static K_WORK_DEFINE(event_processor, event_processor_fn);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE)
+enum eventq_prio {
+	EVENTQ_PRIO_HIGH,
+	EVENTQ_PRIO_NORMAL,
+
+	EVENTQ_PRIO_COUNT
+};
+
+/* Queues are ordered from the highest to the lowest priority. */
+static struct mpsc eventq[EVENTQ_PRIO_COUNT] = {
+	[EVENTQ_PRIO_HIGH] = MPSC_INIT(eventq[EVENTQ_PRIO_HIGH]),
+	[EVENTQ_PRIO_NORMAL] = MPSC_INIT(eventq[EVENTQ_PRIO_NORMAL]),
+};
+#else
 static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
 static struct k_spinlock lock;
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED)
+#define DEFERRED_PRIORITY	K_LOWEST_APPLICATION_THREAD_PRIO
+#define DEFERRED_MAX_DELAY	K_MSEC(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED_MAX_DELAY_MS)
+
+struct k_work_q _app_event_manager_deferred_workq;
+static K_THREAD_STACK_DEFINE(deferred_workq_stack,
+			     CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED_STACK_SIZE);
+
+/* Number of events pending delivery to the deferred listeners, protected by the deferred lock. */
+static size_t deferred_pending;
+static struct k_spinlock deferred_lock;
+
+static void deferred_timeout_fn(struct k_timer *timer);
+static K_TIMER_DEFINE(deferred_timer, deferred_timeout_fn, NULL);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+/* Coalescing policies and events waiting in the queue, indexed by the event type.
+ * Pending events are protected by the event queue lock.
+ */
+static const struct event_coalesce *coalesce_policy[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static struct app_event_header *coalesce_pending[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+struct event_type_stats {
+	atomic_t submitted;
+	atomic_t delivered;
+	atomic_t consumed;
+	atomic_t queued;
+	atomic_t max_queued;
+};
+
+static struct event_type_stats event_stats[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
 
 static bool log_is_event_displayed(const struct event_type *et)
 {
@@ -116,7 +171,13 @@ static void log_event_init(void)
 
 void * __weak app_event_manager_alloc(size_t size)
 {
-	void *event = k_malloc(size);
+	void *event;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_SLAB)) {
+		event = app_event_manager_mem_slab_alloc(size);
+	} else {
+		event = k_malloc(size);
+	}
 
 	if (unlikely(!event)) {
 		LOG_ERR("Application Event Manager OOM error\n");
@@ -134,73 +195,438 @@ void * __weak app_event_manager_alloc(size_t size)
 
 void __weak app_event_manager_free(void *addr)
 {
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_SLAB) &&
+	    app_event_manager_mem_slab_free(addr)) {
+		return;
+	}
+
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+static struct event_type_stats *stats_get(const struct event_type *et)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	return &event_stats[et - _event_type_list_start];
+}
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+static void stats_event_submitted(const struct event_type *et)
+{
+	atomic_inc(&stats_get(et)->submitted);
+}
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
+static void stats_event_queued(const struct event_type *et)
+{
+	struct event_type_stats *stats = stats_get(et);
+	atomic_val_t queued = atomic_inc(&stats->queued) + 1;
+	atomic_val_t max_queued = atomic_get(&stats->max_queued);
+
+	while ((queued > max_queued) &&
+	       !atomic_cas(&stats->max_queued, max_queued, queued)) {
+		max_queued = atomic_get(&stats->max_queued);
+	}
+}
+
+static void stats_event_dequeued(const struct event_type *et)
+{
+	atomic_dec(&stats_get(et)->queued);
+}
+
+static void stats_event_consumed(const struct event_type *et)
+{
+	atomic_inc(&stats_get(et)->consumed);
+}
+
+void app_event_manager_event_stats_get(const struct event_type *et,
+				       struct app_event_manager_event_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	const struct event_type_stats *es = stats_get(et);
+
+	stats->submitted = atomic_get(&es->submitted);
+	stats->delivered = atomic_get(&es->delivered);
+	stats->consumed = atomic_get(&es->consumed);
+	stats->queued = atomic_get(&es->queued);
+	stats->max_queued = atomic_get(&es->max_queued);
+}
+
+void app_event_manager_listener_stats_get(const struct event_listener *el,
+					  struct app_event_manager_listener_stats *stats)
+{
+	__ASSERT_NO_MSG(el && el->stats);
+
+	/* Listener statistics are updated only from the context notifying the listener.
+	 * The values may be slightly out of date, which is acceptable for diagnostics.
+	 */
+	stats->notified = el->stats->notified;
+	stats->exec_time_us = k_cyc_to_us_floor64(el->stats->exec_cycles);
+}
+
+void app_event_manager_stats_reset(void)
+{
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct event_type_stats *stats = stats_get(et);
+
+		atomic_clear(&stats->submitted);
+		atomic_clear(&stats->delivered);
+		atomic_clear(&stats->consumed);
+		atomic_set(&stats->max_queued, atomic_get(&stats->queued));
+	}
+
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		el->stats->notified = 0;
+		el->stats->exec_cycles = 0;
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_STATS */
+
+static bool listener_notify(const struct event_listener *el,
+			    const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	uint32_t start = k_cycle_get_32();
+	bool consumed = el->notification(aeh);
+
+	el->stats->exec_cycles += k_cycle_get_32() - start;
+	el->stats->notified++;
+	atomic_inc(&stats_get(aeh->type_id)->delivered);
+
+	return consumed;
+#else
+	return el->notification(aeh);
+#endif
+}
+
+static void event_release(struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ)
+	if (atomic_dec(&aeh->ref_cnt) != 1) {
 		return;
 	}
+#endif
 
-	sys_slist_merge_slist(&events, &eventq);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
 
-	k_spin_unlock(&lock, key);
+	app_event_manager_free(aeh);
+}
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED)
+static void deferred_timeout_fn(struct k_timer *timer)
+{
+	/* An event waits for too long, let the deferred listeners preempt other threads. */
+	k_thread_priority_set(k_work_queue_thread_get(&_app_event_manager_deferred_workq),
+			      CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED_BOOST_PRIORITY);
+}
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+static void deferred_queued(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&deferred_lock);
 
-		const struct event_type *et = aeh->type_id;
+	if (deferred_pending++ == 0) {
+		k_timer_start(&deferred_timer, DEFERRED_MAX_DELAY, K_NO_WAIT);
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+	k_spin_unlock(&deferred_lock, key);
+}
+
+static void deferred_delivered(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&deferred_lock);
+
+	__ASSERT_NO_MSG(deferred_pending > 0);
+
+	if (--deferred_pending == 0) {
+		/* Restored under the lock, so that a boost for a newly queued event is not lost. */
+		k_timer_stop(&deferred_timer);
+		k_thread_priority_set(k_current_get(), DEFERRED_PRIORITY);
+	}
+
+	k_spin_unlock(&deferred_lock, key);
+}
+
+static void listener_deferred_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "aem_deferred",
+	};
+
+	k_work_queue_start(&_app_event_manager_deferred_workq, deferred_workq_stack,
+			   K_THREAD_STACK_SIZEOF(deferred_workq_stack), DEFERRED_PRIORITY, &cfg);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ)
+static void listener_workq_fn(struct k_work *work)
+{
+	struct event_listener_workq *ctx = CONTAINER_OF(work, struct event_listener_workq, work);
+	const struct event_listener *el = ctx->listener;
+	struct app_event_header *aeh;
+
+	while (!k_msgq_get(ctx->msgq, &aeh, K_NO_WAIT)) {
+		log_event_progress(aeh->type_id, el);
+
+		bool consumed = listener_notify(el, aeh);
+
+		__ASSERT(!consumed, "Listener %s cannot consume events", el->name);
+		ARG_UNUSED(consumed);
+
+		event_release(aeh);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED)
+		if (ctx->workq == &_app_event_manager_deferred_workq) {
+			deferred_delivered();
 		}
+#endif
+	}
+}
 
-		log_event(aeh);
+static bool listener_workq_notify(const struct event_listener *el,
+				  struct app_event_header *aeh)
+{
+	struct event_listener_workq *ctx = el->workq_ctx;
 
-		bool consumed = false;
+	if (!ctx) {
+		return false;
+	}
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+	atomic_inc(&aeh->ref_cnt);
 
-			__ASSERT_NO_MSG(es != NULL);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED)
+	if (ctx->workq == &_app_event_manager_deferred_workq) {
+		deferred_queued();
+	}
+#endif
 
-			const struct event_listener *el = es->listener;
+	/* Wait for the listener to make room in the queue to keep the order of events. */
+	int err = k_msgq_put(ctx->msgq, &aeh, K_FOREVER);
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+	__ASSERT_NO_MSG(!err);
+	ARG_UNUSED(err);
 
-			log_event_progress(et, el);
+	k_work_submit_to_queue(ctx->workq, &ctx->work);
 
-			consumed = el->notification(aeh);
+	return true;
+}
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
+static void listener_workq_init(void)
+{
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		struct event_listener_workq *ctx = el->workq_ctx;
+
+		if (ctx) {
+			__ASSERT(ctx->workq != &k_sys_work_q,
+				 "Listener %s cannot use the system work queue", el->name);
+			ctx->listener = el;
+			k_work_init(&ctx->work, listener_workq_fn);
 		}
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ */
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
-			}
+static void process_event(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct event_type *et = aeh->type_id;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	stats_event_dequeued(et);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ)
+	/* Reference held by the event dispatcher. */
+	atomic_set(&aeh->ref_cnt, 1);
+#endif
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	log_event(aeh);
+
+	bool consumed = false;
+
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
+
+		__ASSERT_NO_MSG(es != NULL);
+
+		const struct event_listener *el = es->listener;
+
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ)
+		if (listener_workq_notify(el, aeh)) {
+			continue;
 		}
+#endif
+
+		log_event_progress(et, el);
+
+		consumed = listener_notify(el, aeh);
+
+		if (consumed) {
+			log_event_consumed(et);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+			stats_event_consumed(et);
+#endif
+		}
+	}
+
+	event_release(aeh);
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE)
+static struct app_event_header *eventq_get(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(eventq); i++) {
+		struct mpsc_node *node = mpsc_pop(&eventq[i]);
+
+		if (node) {
+			return CONTAINER_OF(node, struct app_event_header, mpsc_node);
+		}
+	}
+
+	return NULL;
+}
+
+static void event_processor_fn(struct k_work *work)
+{
+	struct app_event_header *aeh;
+
+	/* Events are taken one by one to make sure that a high priority event submitted
+	 * in the meantime is processed before the remaining normal priority events.
+	 * An event that is pushed concurrently and not yet visible is handled in the next
+	 * work run, because the producer resubmits the work after the push.
+	 */
+	while ((aeh = eventq_get()) != NULL) {
+		process_event(aeh);
+	}
+}
+
+void _event_submit(struct app_event_header *aeh)
+{
+	__ASSERT_NO_MSG(aeh);
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	enum eventq_prio prio =
+		app_event_get_type_flag(aeh->type_id, APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY) ?
+		EVENTQ_PRIO_HIGH : EVENTQ_PRIO_NORMAL;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	stats_event_submitted(aeh->type_id);
+	stats_event_queued(aeh->type_id);
+#endif
+
+	mpsc_push(&eventq[prio], &aeh->mpsc_node);
+
+	k_work_submit(&event_processor);
+}
+#else
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+static void event_coalesce_init(void)
+{
+	STRUCT_SECTION_FOREACH(event_coalesce, ec) {
+		APP_EVENT_ASSERT_ID(ec->type_id);
+
+		size_t idx = ec->type_id - _event_type_list_start;
+
+		__ASSERT_NO_MSG(!coalesce_policy[idx]);
+		coalesce_policy[idx] = ec;
+	}
+}
+
+/* Must be called with the event queue locked.
+ * Returns the event that is to be freed or NULL if the event must be appended to the queue.
+ */
+static struct app_event_header *event_coalesce(struct app_event_header *aeh)
+{
+	size_t idx = aeh->type_id - _event_type_list_start;
+	const struct event_coalesce *ec = coalesce_policy[idx];
+	struct app_event_header *queued = coalesce_pending[idx];
+
+	if (!ec) {
+		return NULL;
+	}
+
+	if (!queued) {
+		coalesce_pending[idx] = aeh;
+		return NULL;
+	}
+
+	switch (ec->policy) {
+	case APP_EVENT_COALESCE_REPLACE_LATEST:
+		memcpy((uint8_t *)queued + sizeof(*queued), (uint8_t *)aeh + sizeof(*aeh),
+		       ec->size - sizeof(*aeh));
+		return aeh;
+
+	case APP_EVENT_COALESCE_ACCUMULATE:
+		ec->merge(queued, aeh);
+		return aeh;
+
+	case APP_EVENT_COALESCE_DROP_OLDEST:
+	{
+		bool removed = sys_slist_find_and_remove(&eventq, &queued->node);
 
-		app_event_manager_free(aeh);
+		__ASSERT_NO_MSG(removed);
+		ARG_UNUSED(removed);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+		stats_event_dequeued(queued->type_id);
+#endif
+		coalesce_pending[idx] = aeh;
+		return queued;
+	}
+
+	default:
+		__ASSERT_NO_MSG(false);
+		return NULL;
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING */
+
+static void event_processor_fn(struct k_work *work)
+{
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+
+	/* Make current event list local. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (sys_slist_is_empty(&eventq)) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	sys_slist_merge_slist(&events, &eventq);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+	/* Events taken for processing can no longer be coalesced. */
+	memset(coalesce_pending, 0, sizeof(coalesce_pending));
+#endif
+
+	k_spin_unlock(&lock, key);
+
+	/* Traverse the list of events. */
+	sys_snode_t *node;
+	while (NULL != (node = sys_slist_get(&events))) {
+		struct app_event_header *aeh = CONTAINER_OF(node,
+						       struct app_event_header,
+						       node);
+
+		process_event(aeh);
 	}
 }
 
@@ -216,11 +642,38 @@ void _event_submit(struct app_event_header *aeh)
 			h->hook(aeh);
 		}
 	}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	stats_event_submitted(aeh->type_id);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+	struct app_event_header *coalesced = event_coalesce(aeh);
+
+	if (coalesced == aeh) {
+		/* The event was merged into the queued event that is already scheduled. */
+		k_spin_unlock(&lock, key);
+		app_event_manager_free(coalesced);
+		return;
+	}
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	stats_event_queued(aeh->type_id);
+#endif
+
 	sys_slist_append(&eventq, &aeh->node);
 	k_spin_unlock(&lock, key);
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+	if (coalesced) {
+		app_event_manager_free(coalesced);
+	}
+#endif
+
 	k_work_submit(&event_processor);
 }
+#endif /* CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE */
 
 int app_event_manager_init(void)
 {
@@ -231,6 +684,18 @@ int app_event_manager_init(void)
 
 	log_event_init();
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED)
+	listener_deferred_init();
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ)
+	listener_workq_init();
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+	event_coalesce_init();
+#endif
+
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
 			ret = h->hook();
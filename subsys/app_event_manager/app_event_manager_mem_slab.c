@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <app_event_manager.h>
+#include <zephyr/logging/log.h>
+
+#include "app_event_manager_mem_slab.h"
+
+LOG_MODULE_DECLARE(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
+
+#define MEM_SLAB_BLOCK_ALIGN	sizeof(void *)
+
+#define MEM_SLAB_CLASS_SIZE(cls) CONFIG_APP_EVENT_MANAGER_MEM_SLAB_##cls##_BLOCK_SIZE
+#define MEM_SLAB_CLASS_CNT(cls)	 CONFIG_APP_EVENT_MANAGER_MEM_SLAB_##cls##_BLOCK_COUNT
+
+#define MEM_SLAB_CLASS_BUF_DEFINE(cls)							\
+	BUILD_ASSERT((MEM_SLAB_CLASS_SIZE(cls) % MEM_SLAB_BLOCK_ALIGN) == 0,		\
+		     "Block size of " #cls " memory slab must be pointer aligned");	\
+	static char __aligned(MEM_SLAB_BLOCK_ALIGN)					\
+		mem_slab_buf_##cls[MEM_SLAB_CLASS_SIZE(cls) * MEM_SLAB_CLASS_CNT(cls)]
+
+#define MEM_SLAB_CLASS_INIT(cls)				\
+	{							\
+		.buf = mem_slab_buf_##cls,			\
+		.block_size = MEM_SLAB_CLASS_SIZE(cls),		\
+		.block_count = MEM_SLAB_CLASS_CNT(cls),		\
+	}
+
+BUILD_ASSERT(MEM_SLAB_CLASS_SIZE(SMALL) < MEM_SLAB_CLASS_SIZE(MEDIUM),
+	     "Memory slab block sizes must be in ascending order");
+BUILD_ASSERT(MEM_SLAB_CLASS_SIZE(MEDIUM) < MEM_SLAB_CLASS_SIZE(LARGE),
+	     "Memory slab block sizes must be in ascending order");
+
+struct mem_slab_class {
+	struct k_mem_slab slab;
+	char *buf;
+	size_t block_size;
+	uint32_t block_count;
+};
+
+MEM_SLAB_CLASS_BUF_DEFINE(SMALL);
+MEM_SLAB_CLASS_BUF_DEFINE(MEDIUM);
+MEM_SLAB_CLASS_BUF_DEFINE(LARGE);
+
+/* Classes are sorted by the block size in ascending order. */
+static struct mem_slab_class slab_classes[] = {
+	MEM_SLAB_CLASS_INIT(SMALL),
+	MEM_SLAB_CLASS_INIT(MEDIUM),
+	MEM_SLAB_CLASS_INIT(LARGE),
+};
+
+static atomic_t heap_alloc_cnt;
+
+static bool mem_slab_class_owns(const struct mem_slab_class *cls, const void *addr)
+{
+	const char *ptr = addr;
+
+	return (ptr >= cls->buf) && (ptr < (cls->buf + cls->block_size * cls->block_count));
+}
+
+void *app_event_manager_mem_slab_alloc(size_t size)
+{
+	void *block;
+
+	/* If the best fitting class is exhausted, a block from a larger class is used. */
+	for (size_t i = 0; i < ARRAY_SIZE(slab_classes); i++) {
+		struct mem_slab_class *cls = &slab_classes[i];
+
+		if ((cls->block_size >= size) &&
+		    !k_mem_slab_alloc(&cls->slab, &block, K_NO_WAIT)) {
+			return block;
+		}
+	}
+
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_SLAB_HEAP_FALLBACK)) {
+		return NULL;
+	}
+
+	block = k_malloc(size);
+	if (block) {
+		atomic_inc(&heap_alloc_cnt);
+	}
+
+	return block;
+}
+
+bool app_event_manager_mem_slab_free(void *addr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(slab_classes); i++) {
+		struct mem_slab_class *cls = &slab_classes[i];
+
+		if (mem_slab_class_owns(cls, addr)) {
+			k_mem_slab_free(&cls->slab, addr);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t app_event_manager_mem_slab_count(void)
+{
+	return ARRAY_SIZE(slab_classes);
+}
+
+int app_event_manager_mem_slab_stats_get(size_t idx, struct app_event_manager_mem_slab_stats *stats)
+{
+	if (idx >= ARRAY_SIZE(slab_classes)) {
+		return -EINVAL;
+	}
+
+	struct mem_slab_class *cls = &slab_classes[idx];
+
+	stats->block_size = cls->block_size;
+	stats->block_count = cls->block_count;
+	stats->used = k_mem_slab_num_used_get(&cls->slab);
+	stats->max_used = k_mem_slab_max_used_get(&cls->slab);
+
+	return 0;
+}
+
+uint32_t app_event_manager_mem_slab_heap_alloc_count(void)
+{
+	return atomic_get(&heap_alloc_cnt);
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROVIDE_EVENT_SIZE)
+static void event_size_check(void)
+{
+	const size_t max_block_size = slab_classes[ARRAY_SIZE(slab_classes) - 1].block_size;
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) {
+			continue;
+		}
+
+		if (et->struct_size > max_block_size) {
+			LOG_WRN("Event %s (%u bytes) does not fit any memory slab",
+				et->name, et->struct_size);
+		}
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_PROVIDE_EVENT_SIZE */
+
+static int mem_slab_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(slab_classes); i++) {
+		struct mem_slab_class *cls = &slab_classes[i];
+		int err = k_mem_slab_init(&cls->slab, cls->buf, cls->block_size,
+					  cls->block_count);
+
+		if (err) {
+			return err;
+		}
+	}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROVIDE_EVENT_SIZE)
+	event_size_check();
+#endif
+
+	return 0;
+}
+
+SYS_INIT(mem_slab_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _APP_EVENT_MANAGER_MEM_SLAB_H_
+#define _APP_EVENT_MANAGER_MEM_SLAB_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Allocate an event from the smallest fitting memory slab.
+ *
+ * Falls back to the heap if enabled in the configuration.
+ */
+void *app_event_manager_mem_slab_alloc(size_t size);
+
+/* Free an event allocated by app_event_manager_mem_slab_alloc.
+ *
+ * Returns false if the memory does not belong to any of the memory slabs.
+ */
+bool app_event_manager_mem_slab_free(void *addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _APP_EVENT_MANAGER_MEM_SLAB_H_ */
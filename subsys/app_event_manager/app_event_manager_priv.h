@@ -16,6 +16,9 @@
 #include <zephyr/types.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/logging/log.h>
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE)
+#include <zephyr/sys/mpsc_lockfree.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -187,13 +190,57 @@ extern "C" {
 
 
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+#define _APP_EVENT_LISTENER_STATS_DEFINE(lname) \
+	static struct event_listener_stats _CONCAT(__event_listener_stats_, lname)
+
+#define _APP_EVENT_LISTENER_STATS_INIT(lname) \
+	.stats = &_CONCAT(__event_listener_stats_, lname),
+#else
+#define _APP_EVENT_LISTENER_STATS_DEFINE(lname) \
+	struct _CONCAT(__event_listener_stats_unused_, lname)
+
+#define _APP_EVENT_LISTENER_STATS_INIT(lname)
+#endif /* CONFIG_APP_EVENT_MANAGER_STATS */
+
+
 /* Declarations and definitions - for more details refer to public API. */
 #define _APP_EVENT_LISTENER(lname, notification_fn)					\
+	_APP_EVENT_LISTENER_STATS_DEFINE(lname);					\
+	STRUCT_SECTION_ITERABLE(event_listener, _CONCAT(__event_listener_, lname)) = {	\
+		.name = STRINGIFY(lname),						\
+		.notification = (notification_fn),					\
+		_APP_EVENT_LISTENER_STATS_INIT(lname)					\
+	}
+
+#define _APP_EVENT_LISTENER_WORKQ(lname, notification_fn, work_q, queue_size)		\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ),		\
+		     "Enable APP_EVENT_MANAGER_LISTENER_WORKQ before usage");		\
+	K_MSGQ_DEFINE(_CONCAT(__event_listener_msgq_, lname),				\
+		      sizeof(struct app_event_header *), (queue_size),			\
+		      __alignof(struct app_event_header *));				\
+	static struct event_listener_workq _CONCAT(__event_listener_workq_, lname) = {	\
+		.workq = (work_q),							\
+		.msgq = &_CONCAT(__event_listener_msgq_, lname),			\
+	};										\
+	_APP_EVENT_LISTENER_STATS_DEFINE(lname);					\
 	STRUCT_SECTION_ITERABLE(event_listener, _CONCAT(__event_listener_, lname)) = {	\
 		.name = STRINGIFY(lname),						\
 		.notification = (notification_fn),					\
+		.workq_ctx = &_CONCAT(__event_listener_workq_, lname),			\
+		_APP_EVENT_LISTENER_STATS_INIT(lname)					\
 	}
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED)
+extern struct k_work_q _app_event_manager_deferred_workq;
+#endif
+
+#define _APP_EVENT_LISTENER_DEFERRED(lname, notification_fn, queue_size)		\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED),		\
+		     "Enable APP_EVENT_MANAGER_LISTENER_DEFERRED before usage");		\
+	_APP_EVENT_LISTENER_WORKQ(lname, notification_fn,				\
+				  &_app_event_manager_deferred_workq, queue_size)
+
 
 #define _APP_EVENT_TYPE_DECLARE_COMMON(ename)						\
 	extern Z_DECL_ALIGN(struct event_type) _CONCAT(__event_type_, ename);		\
@@ -225,11 +272,31 @@ extern "C" {
  * must be placed as the first field.
  */
 struct app_event_header {
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE)
+	union {
+		/** Linked list node used to chain events. */
+		sys_snode_t node;
+
+		/** Lock-free queue node used to chain events. */
+		struct mpsc_node mpsc_node;
+	};
+#else
 	/** Linked list node used to chain events. */
 	sys_snode_t node;
+#endif
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ)
+	/** Number of references held by the event dispatcher and pending listener deliveries. */
+	atomic_t ref_cnt;
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_TIMESTAMP)
+	/** Timestamp recorded by the event hooks. */
+	uint32_t timestamp;
+#endif
 };
 
 /** Function to log data from this event. */
@@ -354,6 +421,23 @@ extern struct app_event_manager_event_display_bm _app_event_manager_event_displa
 		     "Enable APP_EVENT_MANAGER_POSTPROCESS_HOOKS before usage"); \
 	_APP_EVENT_HOOK_REGISTER(event_postprocess_hook, hook_fn, prio)
 
+/* Event coalescing policy */
+#define _APP_EVENT_COALESCE(ename, coalesce_policy, merge_fn)				\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING),		\
+		     "Enable APP_EVENT_MANAGER_EVENT_COALESCING before usage");	\
+	BUILD_ASSERT(((coalesce_policy) != APP_EVENT_COALESCE_REPLACE_LATEST) ||	\
+		     !_CONCAT(ename, _HAS_DYNDATA),					\
+		     "Events with dynamic data cannot be replaced");			\
+	BUILD_ASSERT(((coalesce_policy) != APP_EVENT_COALESCE_ACCUMULATE) ||		\
+		     ((merge_fn) != NULL),						\
+		     "Accumulating events requires a merge function");		\
+	STRUCT_SECTION_ITERABLE(event_coalesce, _CONCAT(__event_coalesce_, ename)) = {	\
+		.type_id = _EVENT_ID(ename),						\
+		.policy = (coalesce_policy),						\
+		.merge = (merge_fn),							\
+		.size = sizeof(struct ename),						\
+	}
+
 /**
  * @brief Joining together event type flags.
  */
@@ -374,9 +458,36 @@ struct event_dyndata {
 };
 
 
+/** @brief Context of an event listener bound to a dedicated work queue.
+ */
+struct event_listener_workq {
+	/** Work queue used to notify the listener. */
+	struct k_work_q *workq;
+
+	/** Queue of events pending delivery to the listener. */
+	struct k_msgq *msgq;
+
+	/** Work notifying the listener about the pending events. */
+	struct k_work work;
+
+	/** Pointer to the listener. */
+	const struct event_listener *listener;
+};
+
+/** @brief Runtime statistics of an event listener.
+ */
+struct event_listener_stats {
+	/** Number of notifications. */
+	uint32_t notified;
+
+	/** Cumulative execution time of the notifications in hardware cycles. */
+	uint64_t exec_cycles;
+};
+
 /** @brief Event listener.
  *
- * All event listeners must be defined using @ref APP_EVENT_LISTENER.
+ * All event listeners must be defined using @ref APP_EVENT_LISTENER
+ * or @ref APP_EVENT_LISTENER_WORKQ.
  */
 struct event_listener {
 	/** Name of this listener. */
@@ -387,6 +498,18 @@ struct event_listener {
 	 * not propagated to further listeners, or false, otherwise.
 	 */
 	bool (*notification)(const struct app_event_header *aeh);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ)
+	/** Pointer to the work queue context or NULL if the listener is notified directly
+	 * by the event dispatcher.
+	 */
+	struct event_listener_workq *workq_ctx;
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	/** Pointer to the listener statistics. */
+	struct event_listener_stats *stats;
+#endif
 };
 
 
@@ -398,6 +521,35 @@ struct event_subscriber {
 };
 
 
+/** @brief Event coalescing policy.
+ */
+enum app_event_coalesce_policy {
+	/** Copy the data of the new event into the queued event. */
+	APP_EVENT_COALESCE_REPLACE_LATEST,
+
+	/** Merge the new event into the queued event using the merge function. */
+	APP_EVENT_COALESCE_ACCUMULATE,
+
+	/** Drop the queued event and append the new event at the end of the queue. */
+	APP_EVENT_COALESCE_DROP_OLDEST,
+};
+
+/** @brief Structure used to define event coalescing policy for an event type.
+ */
+struct event_coalesce {
+	/** Pointer to the event type object. */
+	const struct event_type *type_id;
+
+	/** Coalescing policy. */
+	enum app_event_coalesce_policy policy;
+
+	/** Function merging the new event into the queued event. */
+	void (*merge)(struct app_event_header *queued, const struct app_event_header *aeh);
+
+	/** Size of the event structure. */
+	size_t size;
+};
+
 /** @brief Structure used to register Application Event Manager initialization hook
  */
 struct app_event_manager_postinit_hook {
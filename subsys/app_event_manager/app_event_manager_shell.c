@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <zephyr/shell/shell.h>
 #include <app_event_manager.h>
 
@@ -81,6 +82,72 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_SLAB)
+static int show_mem_slabs(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event memory slabs:\n");
+
+	for (size_t i = 0; i < app_event_manager_mem_slab_count(); i++) {
+		struct app_event_manager_mem_slab_stats stats;
+		int err = app_event_manager_mem_slab_stats_get(i, &stats);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t%zu B: used %u/%u, max used %u\n",
+			      stats.block_size, stats.used, stats.block_count,
+			      stats.max_used);
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "Heap allocations: %u\n",
+		      app_event_manager_mem_slab_heap_alloc_count());
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_MEM_SLAB */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+static int show_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset")) {
+			shell_error(shell, "Invalid argument: %s", argv[1]);
+			return -EINVAL;
+		}
+
+		app_event_manager_stats_reset();
+		shell_fprintf(shell, SHELL_NORMAL, "Statistics cleared\n");
+		return 0;
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL,
+		      "Events (submitted/delivered/consumed, queued/max queued):\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_manager_event_stats stats;
+
+		app_event_manager_event_stats_get(et, &stats);
+		shell_fprintf(shell, SHELL_NORMAL, "|\t%s: %u/%u/%u, %u/%u\n",
+			      et->name, stats.submitted, stats.delivered, stats.consumed,
+			      stats.queued, stats.max_queued);
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "Listeners (notified, execution time):\n");
+
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		struct app_event_manager_listener_stats stats;
+
+		app_event_manager_listener_stats_get(el, &stats);
+		shell_fprintf(shell, SHELL_NORMAL, "|\t[L:%s] %u, %llu us\n",
+			      el->name, stats.notified, (unsigned long long)stats.exec_time_us);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_STATS */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +222,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_SLAB)
+	SHELL_CMD_ARG(show_mem_slabs, NULL, "Show event memory slab usage",
+		      show_mem_slabs, 0, 0),
+#endif
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	SHELL_CMD_ARG(stats, NULL, "Show event statistics.\n"
+		      "Usage: app_event_manager stats [reset]",
+		      show_stats, 1, 1),
+#endif
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
@@ -4,9 +4,12 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <app_event_manager.h>
 #include <app_event_manager_profiler_tracer.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
 
 LOG_MODULE_REGISTER(app_event_manager_profiler_tracer, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
@@ -17,6 +20,41 @@ extern struct nrf_profiler_info _nrf_profiler_info_list_end[];
 
 static uint16_t nrf_profiler_event_ids[IDS_COUNT];
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_EVENT_LATENCY)
+#define LATENCY_BUCKET_CNT CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_EVENT_LATENCY_BUCKET_CNT
+
+enum latency_type {
+	LATENCY_SUBMIT_TO_DISPATCH,
+	LATENCY_DISPATCH_TO_DONE,
+
+	LATENCY_TYPE_COUNT
+};
+
+/* Histograms indexed by the profiled event type. */
+static atomic_t latency_hist[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT][LATENCY_TYPE_COUNT]
+			    [LATENCY_BUCKET_CNT];
+
+static void latency_record(const struct app_event_header *aeh, enum latency_type type)
+{
+	const struct nrf_profiler_info *nrf_profiler_info = aeh->type_id->trace_data;
+	uint32_t now = nrf_profiler_timestamp_get();
+
+	if (nrf_profiler_info) {
+		size_t event_idx = nrf_profiler_info - _nrf_profiler_info_list_start;
+		uint32_t us = nrf_profiler_timestamp_to_us(now - aeh->timestamp);
+		size_t bucket = MIN(find_msb_set(us), LATENCY_BUCKET_CNT - 1);
+
+		__ASSERT_NO_MSG(event_idx < CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT);
+		atomic_inc(&latency_hist[event_idx][type][bucket]);
+	}
+
+	/* The header is owned by the Application Event Manager until the event is freed and the
+	 * timestamp field is reserved for the hooks, so it can be safely modified here.
+	 */
+	((struct app_event_header *)aeh)->timestamp = now;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_EVENT_LATENCY */
+
 /** @brief Trace event execution.
  *
  * @param aeh        Pointer to the application event header of the event that is
@@ -47,12 +85,18 @@ static void app_event_manager_trace_event_execution(const struct app_event_heade
 
 static void app_event_manager_trace_event_preprocess(const struct app_event_header *aeh)
 {
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_EVENT_LATENCY)
+	latency_record(aeh, LATENCY_SUBMIT_TO_DISPATCH);
+#endif
 	app_event_manager_trace_event_execution(aeh, true);
 }
 
 static void app_event_manager_trace_event_postprocess(const struct app_event_header *aeh)
 {
 	app_event_manager_trace_event_execution(aeh, false);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_EVENT_LATENCY)
+	latency_record(aeh, LATENCY_DISPATCH_TO_DONE);
+#endif
 }
 
 APP_EVENT_HOOK_PREPROCESS_REGISTER_FIRST(app_event_manager_trace_event_preprocess);
@@ -67,6 +111,11 @@ static void app_event_manager_trace_event_submission(const struct app_event_head
 {
 	const void *nrf_profiler_info = aeh->type_id->trace_data;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_EVENT_LATENCY)
+	/* See latency_record for details. */
+	((struct app_event_header *)aeh)->timestamp = nrf_profiler_timestamp_get();
+#endif
+
 	if (!nrf_profiler_info) {
 		return;
 	}
@@ -163,3 +212,72 @@ static int app_event_manager_trace_event_init(void)
 }
 
 APP_EVENT_MANAGER_HOOK_POSTINIT_REGISTER(app_event_manager_trace_event_init);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_EVENT_LATENCY) && \
+    IS_ENABLED(CONFIG_NRF_PROFILER_SHELL)
+static void latency_hist_print(const struct shell *shell, const char *label,
+			       const atomic_t *hist)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "|\t%s:", label);
+
+	for (size_t i = 0; i < LATENCY_BUCKET_CNT; i++) {
+		atomic_val_t cnt = atomic_get(&hist[i]);
+
+		if (cnt == 0) {
+			continue;
+		}
+
+		if (i == 0) {
+			shell_fprintf(shell, SHELL_NORMAL, " <1us:%ld", (long)cnt);
+		} else if (i == (LATENCY_BUCKET_CNT - 1)) {
+			shell_fprintf(shell, SHELL_NORMAL, " >=%luus:%ld",
+				      BIT(i - 1), (long)cnt);
+		} else {
+			shell_fprintf(shell, SHELL_NORMAL, " %lu-%luus:%ld",
+				      BIT(i - 1), BIT(i) - 1, (long)cnt);
+		}
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "\n");
+}
+
+static int show_latency(const struct shell *shell, size_t argc, char **argv)
+{
+	bool reset = (argc > 1) && !strcmp(argv[1], "reset");
+
+	if ((argc > 1) && !reset) {
+		shell_error(shell, "Invalid argument: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	STRUCT_SECTION_FOREACH(nrf_profiler_info, pi) {
+		size_t event_idx = pi - _nrf_profiler_info_list_start;
+
+		if (reset) {
+			for (size_t t = 0; t < LATENCY_TYPE_COUNT; t++) {
+				for (size_t i = 0; i < LATENCY_BUCKET_CNT; i++) {
+					atomic_clear(&latency_hist[event_idx][t][i]);
+				}
+			}
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL, "%s\n", pi->name);
+		latency_hist_print(shell, "submit->dispatch",
+				   latency_hist[event_idx][LATENCY_SUBMIT_TO_DISPATCH]);
+		latency_hist_print(shell, "dispatch->done",
+				   latency_hist[event_idx][LATENCY_DISPATCH_TO_DONE]);
+	}
+
+	if (reset) {
+		shell_fprintf(shell, SHELL_NORMAL, "Latency histograms cleared\n");
+	}
+
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((nrf_profiler), latency, NULL,
+		 "Show Application Event Manager event latency histograms.\n"
+		 "Usage: nrf_profiler latency [reset]",
+		 show_latency, 1, 1);
+#endif
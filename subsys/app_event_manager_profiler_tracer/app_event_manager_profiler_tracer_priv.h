@@ -63,6 +63,61 @@ extern "C" {
 			}
 
 
+
+/* Packed encoder helpers */
+#ifdef CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_EVENT_EXECUTION
+#define _PACKED_MEM_ADDRESS_SIZE sizeof(uint32_t)
+#else
+#define _PACKED_MEM_ADDRESS_SIZE 0
+#endif /* CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_EVENT_EXECUTION */
+
+#ifdef CONFIG_NRF_PROFILER
+#define _PACKED_BUF_LEN CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN
+#else
+#define _PACKED_BUF_LEN SIZE_MAX
+#endif /* CONFIG_NRF_PROFILER */
+
+/* Size of the encoded argument. Variable length arguments are given a size that never matches
+ * any structure field to fail the packed layout check.
+ */
+#define _PACKED_ARG_SIZE(type)								\
+	((((type) == NRF_PROFILER_ARG_U8) || ((type) == NRF_PROFILER_ARG_S8)) ? 1 :	\
+	 (((type) == NRF_PROFILER_ARG_U16) || ((type) == NRF_PROFILER_ARG_S16)) ? 2 :	\
+	 (((type) == NRF_PROFILER_ARG_U32) || ((type) == NRF_PROFILER_ARG_S32) ||	\
+	  ((type) == NRF_PROFILER_ARG_TIMESTAMP)) ? 4 : 0x10000)
+
+#define _PACKED_FIELD_DEFINE(field, ename) \
+	__typeof__(((struct ename *)0)->field) field;
+
+#define _PACKED_FIELD_INIT(field) \
+	.field = event->field
+
+#define _APP_EVENT_INFO_DEFINE_PACKED(ename, types, labels, fields)				\
+	struct _CONCAT(ename, _nrf_profiler_packed) {						\
+		FOR_EACH_FIXED_ARG(_PACKED_FIELD_DEFINE, (), ename, fields)			\
+	} __packed;										\
+	BUILD_ASSERT(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,				\
+		     "Packed encoding requires little-endian target");				\
+	BUILD_ASSERT(sizeof(struct _CONCAT(ename, _nrf_profiler_packed)) ==			\
+		     (FOR_EACH(_PACKED_ARG_SIZE, (+), types)),					\
+		     "Fields do not match profiled types or variable length type used");	\
+	BUILD_ASSERT(sizeof(uint8_t) + sizeof(uint32_t) + _PACKED_MEM_ADDRESS_SIZE +		\
+		     sizeof(struct _CONCAT(ename, _nrf_profiler_packed)) <= _PACKED_BUF_LEN,	\
+		     "Profiled event data does not fit in the Profiler event buffer");		\
+	static void _CONCAT(ename, _nrf_profiler_packed_encode)(struct log_event_buf *buf,	\
+			const struct app_event_header *aeh)					\
+	{											\
+		const struct ename *event = _CONCAT(cast_, ename)(aeh);			\
+		const struct _CONCAT(ename, _nrf_profiler_packed) data = {			\
+			FOR_EACH(_PACKED_FIELD_INIT, (,), fields)				\
+		};										\
+												\
+		nrf_profiler_log_encode_mem(buf, &data, sizeof(data));				\
+	}											\
+	_APP_EVENT_INFO_DEFINE(ename, ENCODE(types), ENCODE(labels),				\
+			       _CONCAT(ename, _nrf_profiler_packed_encode))
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -127,12 +127,37 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 	}
 
 	if (parameters->thread.stack == NULL || parameters->thread.stack_size == 0) {
-		return false;
+		/* A module without a thread is run by an audio module graph. */
+		if (!IS_ENABLED(CONFIG_AUDIO_MODULE_GRAPH) || parameters->thread.stack != NULL ||
+		    parameters->thread.stack_size != 0) {
+			return false;
+		}
 	}
 
 	return true;
 }
 
+#if defined(CONFIG_AUDIO_MODULE_SHARED_BUFFER)
+/**
+ * @brief Helper function to get the reference count of an output audio data buffer.
+ *
+ * @param handle  [in]  The handle of the module that owns the buffer.
+ * @param data    [in]  Pointer to the buffer taken from the module's audio data slab.
+ *
+ * @return Pointer to the reference count.
+ */
+static atomic_t *data_ref_cnt_get(struct audio_module_handle *handle, void const *const data)
+{
+	struct k_mem_slab *slab = handle->thread.data_slab;
+	size_t idx = ((char const *)data - slab->buffer) / slab->info.block_size;
+
+	__ASSERT(idx < ARRAY_SIZE(handle->data_ref_cnt), "Audio data not from module %s slab",
+		 handle->name);
+
+	return &handle->data_ref_cnt[idx];
+}
+#endif /* CONFIG_AUDIO_MODULE_SHARED_BUFFER */
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -143,9 +168,17 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 static void audio_data_release_cb(struct audio_module_handle_private *handle,
 				  struct audio_data const *const audio_data)
 {
-	int ret;
 	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
 
+#if defined(CONFIG_AUDIO_MODULE_SHARED_BUFFER)
+	if (atomic_dec(data_ref_cnt_get(hdl, audio_data->data)) == 1) {
+		LOG_DBG("Audio data has been consumed in module %s", hdl->name);
+
+		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
+	}
+#else
+	int ret;
+
 	ret = k_sem_take(&hdl->sem, K_NO_WAIT);
 	if (ret) {
 		LOG_ERR("Failed to take semaphore for data release callback function");
@@ -158,6 +191,7 @@ static void audio_data_release_cb(struct audio_module_handle_private *handle,
 		/* Audio data has been consumed by all modules so now can free the data memory. */
 		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
 	}
+#endif /* CONFIG_AUDIO_MODULE_SHARED_BUFFER */
 }
 
 /**
@@ -248,10 +282,12 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 
 		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
 
+#if !defined(CONFIG_AUDIO_MODULE_SHARED_BUFFER)
 		ret = k_sem_take(&handle->sem, K_NO_WAIT);
 		if (ret) {
 			LOG_ERR("Failed to take semaphore for TX FIFO put");
 		}
+#endif
 
 		return ret;
 	}
@@ -261,6 +297,88 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 	return 0;
 }
 
+#if defined(CONFIG_AUDIO_MODULE_SHARED_BUFFER)
+/**
+ * @brief Send the audio data item to all connected modules.
+ *
+ * @note The same audio data buffer is handed to all receivers. It is freed when the last of
+ *       them releases it.
+ *
+ * @param handle      [in/out]  The handle for this modules instance.
+ * @param audio_data  [in]      A pointer to the audio data.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int send_to_connected_modules(struct audio_module_handle *handle,
+				     struct audio_data const *const audio_data)
+{
+	int ret;
+	int err = 0;
+	struct audio_module_handle *handle_to;
+	atomic_t *ref_cnt = data_ref_cnt_get(handle, audio_data->data);
+
+	if (handle->dest_count == 0 && !(handle->use_tx_queue && handle->thread.msg_tx)) {
+		LOG_WRN("Nowhere to send the audio data from module %s so releasing it",
+			handle->name);
+	}
+
+	/* The sender holds a reference until the audio data has been handed to all the
+	 * receivers, so that the first receiver cannot free it too early.
+	 */
+	atomic_set(ref_cnt, 1);
+
+	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
+	if (ret) {
+		LOG_ERR("Failed to take MUTEX lock in time");
+		err = ret;
+		goto release;
+	}
+
+	/* Send to all internally connected modules. */
+	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+		atomic_inc(ref_cnt);
+
+		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
+		if (ret) {
+			atomic_dec(ref_cnt);
+
+			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
+				handle_to->name, handle->name, ret);
+			err = ret;
+		}
+	}
+
+	ret = k_mutex_unlock(&handle->dest_mutex);
+	if (ret) {
+		LOG_ERR("Failed to release MUTEX");
+		err = ret;
+	}
+
+	/* Send to this module's TX FIFO for extraction by an external
+	 * process with audio_module_rx().
+	 */
+	if (handle->use_tx_queue && handle->thread.msg_tx) {
+		atomic_inc(ref_cnt);
+
+		ret = tx_fifo_put(handle, audio_data);
+		if (ret) {
+			atomic_dec(ref_cnt);
+
+			LOG_ERR("Failed to send audio data on module %s TX message queue",
+				handle->name);
+			err = ret;
+		} else {
+			LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
+		}
+	}
+
+release:
+	/* Drop the sender's reference. */
+	audio_data_release_cb((struct audio_module_handle_private *)handle, audio_data);
+
+	return err;
+}
+#else
 /**
  * @brief Send the audio data item to all connected modules.
  *
@@ -342,6 +460,132 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 
 	return 0;
 }
+#endif /* CONFIG_AUDIO_MODULE_SHARED_BUFFER */
+
+/**
+ * @brief Get and process a new audio data item in an input module and send it to the next
+ *        module(s).
+ *
+ * @param handle  [in/out]  The handle for this modules instance.
+ */
+static void input_data_process(struct audio_module_handle *handle)
+{
+	int ret;
+	struct audio_data audio_data;
+	void *data = NULL;
+
+	/* Get a new output buffer.
+	 * Since this input module generates data within itself, the module itself
+	 * will control the data flow.
+	 */
+	ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
+	__ASSERT(ret == 0, "No free data for module %s, ret %d", handle->name, ret);
+
+	/* Configure new audio data. */
+	audio_data.data = data;
+	audio_data.data_size = handle->thread.data_size;
+
+	/* Process the input audio data */
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, NULL, &audio_data);
+	if (ret) {
+		k_mem_slab_free(handle->thread.data_slab, (void *)(data));
+
+		LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+		return;
+	}
+
+	LOG_DBG("Module %s received new audio data ", handle->name);
+
+	/* Send input audio data to next module(s). */
+	send_to_connected_modules(handle, &audio_data);
+}
+
+/**
+ * @brief Process a received audio data item in an output module.
+ *
+ * @param handle  [in/out]  The handle for this modules instance.
+ * @param msg_rx  [in/out]  The received message.
+ */
+static void output_data_process(struct audio_module_handle *handle,
+				struct audio_module_message *msg_rx)
+{
+	int ret;
+
+	LOG_DBG("Module %s new audio data received", handle->name);
+
+	/* Process the input audio data and output from the audio system. */
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, &msg_rx->audio_data, NULL);
+	if (ret) {
+		if (msg_rx->response_cb != NULL) {
+			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
+					    &msg_rx->audio_data);
+		}
+
+		LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+		return;
+	}
+
+	if (msg_rx->response_cb != NULL) {
+		msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
+				    &msg_rx->audio_data);
+	}
+
+	data_fifo_block_free(handle->thread.msg_rx, (void *)msg_rx);
+}
+
+/**
+ * @brief Process a received audio data item in a processing module and send the result to the
+ *        next module(s).
+ *
+ * @param handle  [in/out]  The handle for this modules instance.
+ * @param msg_rx  [in/out]  The received message.
+ */
+static void in_out_data_process(struct audio_module_handle *handle,
+				struct audio_module_message *msg_rx)
+{
+	int ret;
+	struct audio_data audio_data;
+	void *data = NULL;
+
+	/* Get a new output buffer. */
+	ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
+	__ASSERT(ret == 0, "No free data buffer for module %s, dropping input, ret %d",
+		 handle->name, ret);
+
+	/* Configure new audio audio_data. */
+	audio_data.data = data;
+	audio_data.data_size = handle->thread.data_size;
+
+	/* Process the input audio data into the output audio data. */
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, &msg_rx->audio_data, &audio_data);
+	if (ret) {
+		if (msg_rx->response_cb != NULL) {
+			msg_rx->response_cb(
+				(struct audio_module_handle_private *)(msg_rx->tx_handle),
+				&msg_rx->audio_data);
+		}
+
+		data_fifo_block_free(handle->thread.msg_rx, (void *)(msg_rx));
+
+		k_mem_slab_free(handle->thread.data_slab, (void *)(data));
+
+		LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+		return;
+	}
+
+	/* Send processed audio data to next module(s). */
+	send_to_connected_modules(handle, &audio_data);
+
+	if (msg_rx->response_cb != NULL) {
+		msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
+				    &msg_rx->audio_data);
+	}
+
+	data_fifo_block_free(handle->thread.msg_rx, (void *)msg_rx);
+}
 
 /**
  * @brief The thread that receives data from outside (e.g. the system and passes it into the audio
@@ -356,43 +600,13 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
  */
 static void module_thread_input(struct audio_module_handle *handle, void *p2, void *p3)
 {
-	int ret;
-	struct audio_data audio_data;
-	void *data;
-
 	__ASSERT(handle != NULL, "Module task has NULL handle");
 	__ASSERT(handle->description->functions->data_process != NULL,
 		 "Module task has NULL process function pointer");
 
 	/* Execute thread */
 	while (1) {
-		data = NULL;
-
-		/* Get a new output buffer.
-		 * Since this input module generates data within itself, the module itself
-		 * will control the data flow.
-		 */
-		ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
-		__ASSERT(ret == 0, "No free data for module %s, ret %d", handle->name, ret);
-
-		/* Configure new audio data. */
-		audio_data.data = data;
-		audio_data.data_size = handle->thread.data_size;
-
-		/* Process the input audio data */
-		ret = handle->description->functions->data_process(
-			(struct audio_module_handle_private *)handle, NULL, &audio_data);
-		if (ret) {
-			k_mem_slab_free(handle->thread.data_slab, (void *)(data));
-
-			LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
-			continue;
-		}
-
-		LOG_DBG("Module %s received new audio data ", handle->name);
-
-		/* Send input audio data to next module(s). */
-		send_to_connected_modules(handle, &audio_data);
+		input_data_process(handle);
 	}
 
 	CODE_UNREACHABLE;
@@ -434,28 +648,7 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 							&size, K_FOREVER);
 		__ASSERT(ret == 0, "Module %s error in getting last filled", handle->name);
 
-		LOG_DBG("Module %s new audio data received", handle->name);
-
-		/* Process the input audio data and output from the audio system. */
-		ret = handle->description->functions->data_process(
-			(struct audio_module_handle_private *)handle, &msg_rx->audio_data, NULL);
-		if (ret) {
-			if (msg_rx->response_cb != NULL) {
-				msg_rx->response_cb(
-					(struct audio_module_handle_private *)msg_rx->tx_handle,
-					&msg_rx->audio_data);
-			}
-
-			LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
-			continue;
-		}
-
-		if (msg_rx->response_cb != NULL) {
-			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
-					    &msg_rx->audio_data);
-		}
-
-		data_fifo_block_free(handle->thread.msg_rx, (void *)msg_rx);
+		output_data_process(handle, msg_rx);
 	}
 
 	CODE_UNREACHABLE;
@@ -475,8 +668,6 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 {
 	int ret;
 	struct audio_module_message *msg_rx;
-	struct audio_data audio_data;
-	void *data;
 	size_t size;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
@@ -485,8 +676,6 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 
 	/* Execute thread. */
 	while (1) {
-		data = NULL;
-
 		/* Get a new input message.
 		 * Since this input message is queued outside the module, this will then control the
 		 * data flow.
@@ -495,47 +684,194 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 							&size, K_FOREVER);
 		__ASSERT(ret == 0, "Module %s error in getting last filled %d", handle->name, ret);
 
-		/* Get a new output buffer. */
-		ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
-		__ASSERT(ret == 0, "No free data buffer for module %s, dropping input, ret %d",
-			 handle->name, ret);
+		in_out_data_process(handle, msg_rx);
+	}
+
+	CODE_UNREACHABLE;
+}
+
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Helper function to find a module in a list of modules.
+ *
+ * @param modules      [in]  The list of modules.
+ * @param modules_num  [in]  Number of modules in the list.
+ * @param handle       [in]  The handle of the module to find.
+ *
+ * @return Index of the module in the list, -ENOENT if not found.
+ */
+static int graph_module_find(struct audio_module_handle *const *modules, size_t modules_num,
+			     struct audio_module_handle const *const handle)
+{
+	for (size_t i = 0; i < modules_num; i++) {
+		if (modules[i] == handle) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
+/**
+ * @brief Collect the threadless modules reachable from the source and put them in
+ *        topological order.
+ *
+ * @param graph   [out]  Pointer to the graph.
+ * @param source  [in]   The handle of the first module of the graph.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int graph_build(struct audio_module_graph *graph, struct audio_module_handle *source)
+{
+	int ret;
+	int idx;
+	size_t modules_num = 0;
+	struct audio_module_handle *modules[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+	uint8_t in_degree[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX] = {0};
+	bool placed[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX] = {0};
+	struct audio_module_handle *handle_to;
 
-		/* Configure new audio audio_data. */
-		audio_data.data = data;
-		audio_data.data_size = handle->thread.data_size;
+	modules[modules_num++] = source;
 
-		/* Process the input audio data into the output audio data. */
-		ret = handle->description->functions->data_process(
-			(struct audio_module_handle_private *)handle, &msg_rx->audio_data,
-			&audio_data);
+	/* Collect the modules and count the connections into each of them. */
+	for (size_t i = 0; i < modules_num; i++) {
+		ret = k_mutex_lock(&modules[i]->dest_mutex, LOCK_TIMEOUT_US);
 		if (ret) {
-			if (msg_rx->response_cb != NULL) {
-				msg_rx->response_cb(
-					(struct audio_module_handle_private *)(msg_rx->tx_handle),
-					&msg_rx->audio_data);
+			LOG_ERR("Failed to take MUTEX lock in time");
+			return ret;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&modules[i]->handle_dest_list, handle_to, node) {
+			/* Modules with their own thread are fed through their RX FIFO. */
+			if (handle_to->thread_id != NULL) {
+				continue;
+			}
+
+			idx = graph_module_find(modules, modules_num, handle_to);
+			if (idx < 0) {
+				if (modules_num == ARRAY_SIZE(modules)) {
+					LOG_ERR("Too many modules in the graph of %s", source->name);
+					k_mutex_unlock(&modules[i]->dest_mutex);
+					return -ENOMEM;
+				}
+
+				idx = modules_num++;
+				modules[idx] = handle_to;
+			}
+
+			in_degree[idx]++;
+		}
+
+		k_mutex_unlock(&modules[i]->dest_mutex);
+	}
+
+	for (size_t i = 0; i < modules_num; i++) {
+		if (modules[i]->graph != NULL && modules[i]->graph != graph) {
+			LOG_ERR("Module %s is already in a graph", modules[i]->name);
+			return -EBUSY;
+		}
+
+		if (modules[i]->description->type != AUDIO_MODULE_TYPE_INPUT &&
+		    modules[i]->thread.msg_rx == NULL) {
+			LOG_ERR("Module %s has no RX FIFO", modules[i]->name);
+			return -EINVAL;
+		}
+	}
+
+	/* Place each module after all the modules sending audio data to it. */
+	graph->modules_num = 0;
+
+	while (graph->modules_num < modules_num) {
+		idx = -ELOOP;
+
+		for (size_t i = 0; i < modules_num; i++) {
+			if (!placed[i] && in_degree[i] == 0) {
+				idx = i;
+				break;
 			}
+		}
+
+		if (idx < 0) {
+			LOG_ERR("The graph of %s has a loop", source->name);
+			return idx;
+		}
+
+		placed[idx] = true;
+		graph->modules[graph->modules_num++] = modules[idx];
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&modules[idx]->handle_dest_list, handle_to, node) {
+			int dest = graph_module_find(modules, modules_num, handle_to);
+
+			if (dest >= 0) {
+				in_degree[dest]--;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Run all the modules of the graph once, in topological order.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ */
+static void graph_run(struct audio_module_graph *graph)
+{
+	int ret;
+	struct audio_module_handle *handle;
+	struct audio_module_message *msg_rx;
+	size_t size;
 
-			data_fifo_block_free(handle->thread.msg_rx, (void *)(msg_rx));
+	for (size_t i = 0; i < graph->modules_num; i++) {
+		handle = graph->modules[i];
 
-			k_mem_slab_free(handle->thread.data_slab, (void *)(data));
+		if (!state_running(handle->state)) {
+			continue;
+		}
 
-			LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+		if (handle->description->type == AUDIO_MODULE_TYPE_INPUT) {
+			input_data_process(handle);
 			continue;
 		}
 
-		/* Send processed audio data to next module(s). */
-		send_to_connected_modules(handle, &audio_data);
+		/* All the modules sending to this one have already run, so process everything
+		 * they have queued.
+		 */
+		while (1) {
+			ret = data_fifo_pointer_last_filled_get(handle->thread.msg_rx,
+								(void **)&msg_rx, &size, K_NO_WAIT);
+			if (ret) {
+				break;
+			}
 
-		if (msg_rx->response_cb != NULL) {
-			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
-					    &msg_rx->audio_data);
+			if (handle->description->type == AUDIO_MODULE_TYPE_OUTPUT) {
+				output_data_process(handle, msg_rx);
+			} else {
+				in_out_data_process(handle, msg_rx);
+			}
 		}
+	}
+}
+
+/**
+ * @brief The thread that runs the modules of a graph.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ */
+static void graph_thread(struct audio_module_graph *graph, void *p2, void *p3)
+{
+	__ASSERT(graph != NULL, "Graph task has NULL graph");
+
+	while (1) {
+		k_sem_take(&graph->trigger, K_FOREVER);
 
-		data_fifo_block_free(handle->thread.msg_rx, (void *)msg_rx);
+		graph_run(graph);
 	}
 
 	CODE_UNREACHABLE;
 }
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
 
 int audio_module_open(struct audio_module_parameters const *const parameters,
 		      struct audio_module_configuration const *const configuration,
@@ -577,6 +913,18 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	memcpy(&handle->thread, &parameters->thread,
 	       sizeof(struct audio_module_thread_configuration));
 
+#if defined(CONFIG_AUDIO_MODULE_SHARED_BUFFER)
+	if (handle->thread.data_slab != NULL &&
+	    handle->thread.data_slab->info.num_blocks > ARRAY_SIZE(handle->data_ref_cnt)) {
+		LOG_ERR("Too many audio data buffers for module %s, max %d", handle->name,
+			CONFIG_AUDIO_MODULE_SHARED_BUFFER_BLOCKS_MAX);
+
+		/* Clean up the handle. */
+		memset(handle, 0, sizeof(struct audio_module_handle));
+		return -EINVAL;
+	}
+#endif
+
 	if (handle->description->functions->open != NULL) {
 		ret = handle->description->functions->open(
 			(struct audio_module_handle_private *)handle, configuration);
@@ -639,6 +987,14 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	sys_slist_init(&handle->handle_dest_list);
 	k_mutex_init(&handle->dest_mutex);
 
+	if (handle->thread.stack == NULL) {
+		handle->state = AUDIO_MODULE_STATE_CONFIGURED;
+
+		LOG_DBG("Module %s has no thread and must be run in a graph", handle->name);
+
+		return 0;
+	}
+
 	handle->thread_id = k_thread_create(
 		&handle->thread_data, handle->thread.stack, handle->thread.stack_size, thread_entry,
 		(void *)handle, NULL, NULL, K_PRIO_PREEMPT(handle->thread.priority), 0, K_FOREVER);
@@ -676,6 +1032,13 @@ int audio_module_close(struct audio_module_handle *handle)
 		return -ECANCELED;
 	}
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+	if (handle->graph != NULL) {
+		LOG_ERR("Module %s is still in a graph", handle->name);
+		return -EBUSY;
+	}
+#endif
+
 	if (handle->description->functions->close != NULL) {
 		ret = handle->description->functions->close(
 			(struct audio_module_handle_private *)handle);
@@ -698,7 +1061,9 @@ int audio_module_close(struct audio_module_handle *handle)
 	 *       Test the semaphore and wait for it to be zero.
 	 */
 
-	k_thread_abort(handle->thread_id);
+	if (handle->thread_id != NULL) {
+		k_thread_abort(handle->thread_id);
+	}
 
 	/* Ensure module handle data is fully cleared. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
@@ -1199,6 +1564,85 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 	return ret;
 };
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+int audio_module_graph_init(struct audio_module_graph *graph, struct audio_module_handle *source,
+			    k_thread_stack_t *stack, size_t stack_size, int priority)
+{
+	int ret;
+
+	if (graph == NULL || source == NULL || stack == NULL || stack_size == 0) {
+		LOG_ERR("Invalid parameter for the graph initialization");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(source->state) || source->thread_id != NULL) {
+		LOG_ERR("Module %s is not open or has its own thread", source->name);
+		return -ECANCELED;
+	}
+
+	if (graph->thread_id != NULL) {
+		LOG_ERR("Graph is already initialized");
+		return -EALREADY;
+	}
+
+	memset(graph, 0, sizeof(struct audio_module_graph));
+
+	ret = graph_build(graph, source);
+	if (ret) {
+		return ret;
+	}
+
+	for (size_t i = 0; i < graph->modules_num; i++) {
+		graph->modules[i]->graph = graph;
+	}
+
+	k_sem_init(&graph->trigger, 0, K_SEM_MAX_LIMIT);
+
+	graph->thread_id = k_thread_create(&graph->thread_data, stack, stack_size,
+					   (k_thread_entry_t)graph_thread, (void *)graph, NULL,
+					   NULL, K_PRIO_PREEMPT(priority), 0, K_NO_WAIT);
+
+	ret = k_thread_name_set(graph->thread_id, source->name);
+	if (ret) {
+		LOG_WRN("Failed to set the name of the graph thread, ret %d", ret);
+	}
+
+	LOG_DBG("Graph of module %s started with %zu modules", source->name,
+		graph->modules_num);
+
+	return 0;
+}
+
+int audio_module_graph_uninit(struct audio_module_graph *graph)
+{
+	if (graph == NULL || graph->thread_id == NULL) {
+		LOG_ERR("Graph is not initialized");
+		return -EINVAL;
+	}
+
+	k_thread_abort(graph->thread_id);
+
+	for (size_t i = 0; i < graph->modules_num; i++) {
+		graph->modules[i]->graph = NULL;
+	}
+
+	memset(graph, 0, sizeof(struct audio_module_graph));
+
+	return 0;
+}
+
+int audio_module_graph_trigger(struct audio_module_graph *graph)
+{
+	if (graph == NULL || graph->thread_id == NULL) {
+		return -EINVAL;
+	}
+
+	k_sem_give(&graph->trigger);
+
+	return 0;
+}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 int audio_module_names_get(struct audio_module_handle const *const handle, char **base_name,
 			   char *instance_name)
 {
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/sys/crc.h>
 #include <bluetooth/adv_prov.h>
 
 #include <zephyr/logging/log.h>
@@ -11,9 +12,23 @@ LOG_MODULE_REGISTER(bt_le_adv_prov, CONFIG_BT_ADV_PROV_LOG_LEVEL);
 
 enum provider_set {
 	PROVIDER_SET_AD,
-	PROVIDER_SET_SD
+	PROVIDER_SET_SD,
+
+	PROVIDER_SET_COUNT
 };
 
+#if defined(CONFIG_BT_ADV_PROV_CHANGE_DETECTION)
+#if defined(CONFIG_BT_EXT_ADV)
+#define ADV_SET_CNT	CONFIG_BT_EXT_ADV_MAX_ADV_SET
+#else
+#define ADV_SET_CNT	1
+#endif
+
+static struct {
+	bool valid;
+	uint32_t crc;
+} last_data[PROVIDER_SET_COUNT][ADV_SET_CNT];
+#endif
 
 static void get_section_ptrs(enum provider_set set,
 			     const struct bt_le_adv_prov_provider **start,
@@ -75,6 +90,33 @@ static void update_common_feedback(struct bt_le_adv_prov_feedback *common_fb,
 	common_fb->grace_period_s = MAX(common_fb->grace_period_s, fb->grace_period_s);
 }
 
+static bool data_changed_check(enum provider_set set, const struct bt_data *d, size_t d_len,
+			       uint8_t adv_handle)
+{
+#if defined(CONFIG_BT_ADV_PROV_CHANGE_DETECTION)
+	uint32_t crc = 0;
+	bool changed;
+
+	for (size_t i = 0; i < d_len; i++) {
+		crc = crc32_ieee_update(crc, &d[i].type, sizeof(d[i].type));
+		crc = crc32_ieee_update(crc, &d[i].data_len, sizeof(d[i].data_len));
+		crc = crc32_ieee_update(crc, d[i].data, d[i].data_len);
+	}
+
+	if (adv_handle >= ADV_SET_CNT) {
+		return true;
+	}
+
+	changed = !last_data[set][adv_handle].valid || (last_data[set][adv_handle].crc != crc);
+	last_data[set][adv_handle].valid = true;
+	last_data[set][adv_handle].crc = crc;
+
+	return changed;
+#else
+	return true;
+#endif
+}
+
 static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *d_len,
 			      const struct bt_le_adv_prov_adv_state *state,
 			      struct bt_le_adv_prov_feedback *fb)
@@ -109,6 +151,7 @@ static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *
 
 	if (!err) {
 		*d_len = pos;
+		common_fb.data_changed = data_changed_check(set, d, pos, state->adv_handle);
 		memcpy(fb, &common_fb, sizeof(common_fb));
 	}
 
@@ -5,6 +5,7 @@
  */
 
 #include <bluetooth/conn_ctx.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(bt_conn_ctx, CONFIG_BT_CONN_CTX_LOG_LEVEL);
@@ -20,31 +21,30 @@ void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	int err = -ENOMEM;
-	struct bt_conn_ctx *ctx;
+	int err;
+	uint8_t i = bt_conn_index(conn);
+	struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
-
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		ctx = &ctx_lib->ctx[i];
-
-		if (!ctx->conn && !ctx->data) {
-			err = k_mem_slab_alloc(ctx_lib->mem_slab,
-					       &ctx->data,
-					       K_NO_WAIT);
-			if (!err) {
-				ctx->conn = conn;
-
-				LOG_DBG("The memory for the connection context "
-					"has been allocated, conn %p, index: %u",
-					(void *)conn, i);
+	__ASSERT_NO_MSG(i < bt_conn_ctx_count(ctx_lib));
 
-				return ctx->data;
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-			} else {
-				break;
-			}
+	if (!ctx->conn && !ctx->data) {
+		err = k_mem_slab_alloc(ctx_lib->mem_slab,
+				       &ctx->data,
+				       K_NO_WAIT);
+		if (!err) {
+			/* Publish the data before the connection for
+			 * bt_conn_ctx_lookup.
+			 */
+			barrier_dmem_fence_full();
+			ctx->conn = conn;
+
+			LOG_DBG("The memory for the connection context "
+				"has been allocated, conn %p, index: %u",
+				(void *)conn, i);
 
+			return ctx->data;
 		}
 	}
 
@@ -59,24 +59,25 @@ int bt_conn_ctx_free(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	uint8_t i = bt_conn_index(conn);
+	struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	__ASSERT_NO_MSG(i < bt_conn_ctx_count(ctx_lib));
 
-		if (ctx->conn == conn) {
-			bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
-			ctx->conn = NULL;
-			ctx->data = NULL;
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-			LOG_DBG("The context memory for the connection "
-				"has been released, conn %p index %u",
-				(void *)conn, i);
+	if (ctx->conn == conn) {
+		ctx->conn = NULL;
+		barrier_dmem_fence_full();
+		bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
 
-			k_mutex_unlock(ctx_lib->mutex);
+		LOG_DBG("The context memory for the connection "
+			"has been released, conn %p index %u",
+			(void *)conn, i);
 
-			return 0;
-		}
+		k_mutex_unlock(ctx_lib->mutex);
+
+		return 0;
 	}
 
 	LOG_WRN("There is no allocated memory for this connection");
@@ -95,9 +96,9 @@ void bt_conn_ctx_free_all(struct bt_conn_ctx_lib *ctx_lib)
 		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
 		if (ctx->data != NULL) {
-			k_mem_slab_free(ctx_lib->mem_slab, (void *)ctx->data);
 			ctx->conn = NULL;
-			ctx->data = NULL;
+			barrier_dmem_fence_full();
+			bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
 		}
 	}
 
@@ -111,16 +112,17 @@ void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	uint8_t i = bt_conn_index(conn);
+	struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	__ASSERT_NO_MSG(i < bt_conn_ctx_count(ctx_lib));
 
-		if (ctx->conn == conn) {
-			LOG_DBG("Memory block found for the connection");
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-			return ctx->data;
-		}
+	if (ctx->conn == conn) {
+		LOG_DBG("Memory block found for the connection");
+
+		return ctx->data;
 	}
 
 	LOG_WRN("No memory block for connection");
@@ -130,6 +132,26 @@ void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	return NULL;
 }
 
+void *bt_conn_ctx_lookup(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
+{
+	__ASSERT_NO_MSG(conn != NULL);
+	__ASSERT_NO_MSG(ctx_lib != NULL);
+
+	uint8_t i = bt_conn_index(conn);
+	struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+
+	__ASSERT_NO_MSG(i < bt_conn_ctx_count(ctx_lib));
+
+	if (ctx->conn != conn) {
+		return NULL;
+	}
+
+	/* Pairs with the barrier in bt_conn_ctx_alloc */
+	barrier_dmem_fence_full();
+
+	return ctx->data;
+}
+
 const struct bt_conn_ctx *bt_conn_ctx_get_by_id(struct bt_conn_ctx_lib *ctx_lib, uint8_t id)
 {
 	__ASSERT_NO_MSG(ctx_lib != NULL);
@@ -29,6 +29,8 @@
 #include <mpsl/mpsl_work.h>
 #include <mpsl/mpsl_lib.h>
 
+#include <bluetooth/nrf/hci_driver.h>
+
 #include "multithreading_lock.h"
 #include "hci_internal.h"
 #include "radio_nrf5_txp.h"
@@ -542,8 +544,73 @@ static int data_packet_process(const struct device *dev, uint8_t *hci_buf)
 	return 0;
 }
 
+#if defined(CONFIG_BT_CTLR_SDC_ISO_RX_DIRECT)
+static bt_ctlr_sdc_iso_rx_cb_t iso_rx_direct_cb;
+
+int bt_ctlr_sdc_iso_rx_cb_register(bt_ctlr_sdc_iso_rx_cb_t cb)
+{
+	if (cb && iso_rx_direct_cb) {
+		return -EALREADY;
+	}
+
+	iso_rx_direct_cb = cb;
+
+	return 0;
+}
+
+/* Pass a complete SDU to the direct receive callback.
+ * Returns true if the callback has consumed the SDU.
+ */
+static bool iso_rx_direct_process(const uint8_t *hci_buf)
+{
+	const struct bt_hci_iso_hdr *hdr = (const void *)hci_buf;
+	uint16_t handle = sys_le16_to_cpu(hdr->handle);
+	uint16_t len = bt_iso_hdr_len(sys_le16_to_cpu(hdr->len));
+	uint8_t flags = bt_iso_flags(handle);
+	const struct bt_hci_iso_sdu_hdr *sdu_hdr;
+	struct bt_ctlr_sdc_iso_rx_sdu sdu = {
+		.conn_handle = bt_iso_handle(handle),
+	};
+	size_t hdr_len;
+	uint16_t slen;
+
+	if (!iso_rx_direct_cb || (bt_iso_flags_pb(flags) != BT_ISO_SINGLE)) {
+		/* Fragmented SDUs are reassembled by the host */
+		return false;
+	}
+
+	hdr_len = sizeof(*sdu_hdr);
+	if (bt_iso_flags_ts(flags)) {
+		const struct bt_hci_iso_sdu_ts_hdr *ts_hdr = (const void *)&hci_buf[sizeof(*hdr)];
+
+		sdu.ts_valid = true;
+		sdu.timestamp = sys_le32_to_cpu(ts_hdr->ts);
+		hdr_len = sizeof(*ts_hdr);
+	}
+
+	if (len < hdr_len) {
+		return false;
+	}
+
+	sdu_hdr = (const void *)&hci_buf[sizeof(*hdr) + hdr_len - sizeof(*sdu_hdr)];
+	slen = sys_le16_to_cpu(sdu_hdr->slen);
+	sdu.seq_num = sys_le16_to_cpu(sdu_hdr->sn);
+	sdu.status = bt_iso_pkt_flags(slen);
+	sdu.data = &hci_buf[sizeof(*hdr) + hdr_len];
+	sdu.len = len - hdr_len;
+
+	return iso_rx_direct_cb(&sdu);
+}
+#endif /* CONFIG_BT_CTLR_SDC_ISO_RX_DIRECT */
+
 static int iso_data_packet_process(const struct device *dev, uint8_t *hci_buf)
 {
+#if defined(CONFIG_BT_CTLR_SDC_ISO_RX_DIRECT)
+	if (iso_rx_direct_process(hci_buf)) {
+		return 0;
+	}
+#endif /* CONFIG_BT_CTLR_SDC_ISO_RX_DIRECT */
+
 	struct net_buf *data_buf = bt_buf_get_rx(BT_BUF_ISO_IN, K_NO_WAIT);
 	struct bt_hci_iso_hdr *hdr = (void *)hci_buf;
 
@@ -570,6 +637,38 @@ static int iso_data_packet_process(const struct device *dev, uint8_t *hci_buf)
 	return 0;
 }
 
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+static atomic_t evt_discarded_cnt;
+static atomic_t adv_report_discarded_cnt;
+
+void bt_ctlr_sdc_rx_stats_get(struct bt_ctlr_sdc_rx_stats *stats)
+{
+	stats->evt_discarded = atomic_get(&evt_discarded_cnt);
+	stats->adv_report_discarded = atomic_get(&adv_report_discarded_cnt);
+}
+
+void bt_ctlr_sdc_rx_stats_reset(void)
+{
+	atomic_clear(&evt_discarded_cnt);
+	atomic_clear(&adv_report_discarded_cnt);
+}
+
+static void evt_discarded_count(const uint8_t *hci_buf)
+{
+	const struct bt_hci_evt_hdr *hdr = (const void *)hci_buf;
+
+	atomic_inc(&evt_discarded_cnt);
+	if (hdr->evt == BT_HCI_EVT_LE_META_EVENT) {
+		atomic_inc(&adv_report_discarded_cnt);
+	}
+}
+#else
+static void evt_discarded_count(const uint8_t *hci_buf)
+{
+	ARG_UNUSED(hci_buf);
+}
+#endif /* CONFIG_BT_CTLR_SDC_RX_STATS */
+
 static bool event_packet_is_discardable(const uint8_t *hci_buf)
 {
 	struct bt_hci_evt_hdr *hdr = (void *)hci_buf;
@@ -659,6 +758,7 @@ static int event_packet_process(const struct device *dev, uint8_t *hci_buf)
 	if (!evt_buf) {
 		if (discardable) {
 			LOG_DBG("Discarding event");
+			evt_discarded_count(hci_buf);
 			return 0;
 		}
 
@@ -716,21 +816,23 @@ void hci_driver_receive_process(void)
 	const struct device *dev = DEVICE_DT_GET(DT_DRV_INST(0));
 	int err;
 
-	if (rx_hci_msg.type == SDC_HCI_MSG_TYPE_NONE &&
-	    fetch_hci_msg(&rx_hci_msg.buf[0], &rx_hci_msg.type) != 0) {
-		return;
-	}
+	for (size_t i = 0; i < CONFIG_BT_CTLR_SDC_RX_BATCH_SIZE; i++) {
+		if (rx_hci_msg.type == SDC_HCI_MSG_TYPE_NONE &&
+		    fetch_hci_msg(&rx_hci_msg.buf[0], &rx_hci_msg.type) != 0) {
+			return;
+		}
 
-	err = process_hci_msg(dev, &rx_hci_msg.buf[0], rx_hci_msg.type);
-	if (err == -ENOBUFS) {
-		/* If we got -ENOBUFS, wait for the signal from the host. */
-		return;
-	} else if (err) {
-		LOG_ERR("Unknown error when processing hci message %d", err);
-		k_panic();
-	}
+		err = process_hci_msg(dev, &rx_hci_msg.buf[0], rx_hci_msg.type);
+		if (err == -ENOBUFS) {
+			/* If we got -ENOBUFS, wait for the signal from the host. */
+			return;
+		} else if (err) {
+			LOG_ERR("Unknown error when processing hci message %d", err);
+			k_panic();
+		}
 
-	rx_hci_msg.type = SDC_HCI_MSG_TYPE_NONE;
+		rx_hci_msg.type = SDC_HCI_MSG_TYPE_NONE;
+	}
 
 	/* Let other threads of same priority run in between. */
 	receive_signal_raise();
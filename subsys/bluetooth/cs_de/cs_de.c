@@ -14,6 +14,8 @@
 #include <dsp/transform_functions.h>
 #include <dsp/fast_math_functions.h>
 #include <dsp/statistics_functions.h>
+#include <dsp/basic_math_functions.h>
+#include <dsp/complex_math_functions.h>
 #include <arm_const_structs.h>
 #include <bluetooth/cs_de.h>
 
@@ -33,6 +35,7 @@ LOG_MODULE_REGISTER(cs_de, CONFIG_BT_CS_DE_LOG_LEVEL);
 	((CONFIG_BT_CS_DE_NFFT_SIZE + CS_DE_NUM_CHANNELS - 1) / (CS_DE_NUM_CHANNELS))
 
 static float m_iq_scratch_mem[2 * CONFIG_BT_CS_DE_NFFT_SIZE];
+static float m_conj_scratch_mem[2 * (CS_DE_NUM_CHANNELS - 1)];
 
 static cs_de_quality_t set_best_estimate(cs_de_dist_estimates_t *p_estimates_public)
 {
@@ -83,10 +86,12 @@ cs_de_quality_t cs_de_calc(cs_de_report_t *p_report)
 			continue;
 		}
 
-		memset(m_iq_scratch_mem, 0, sizeof(m_iq_scratch_mem));
-
-		/* Combine init and refl IQ values and store in scratch mem. */
+		/* Combine init and refl IQ values and store in scratch mem.
+		 * Only the zero padding after the combined IQ values needs to be cleared.
+		 */
 		cs_de_combined_iq_calculate(&p_report->iq_tones[ap], m_iq_scratch_mem);
+		memset(&m_iq_scratch_mem[2 * CS_DE_NUM_CHANNELS], 0,
+		       sizeof(m_iq_scratch_mem) - 2 * CS_DE_NUM_CHANNELS * sizeof(float));
 
 		p_report->distance_estimates[ap].phase_slope = cs_de_phase_slope(m_iq_scratch_mem);
 
@@ -119,12 +124,12 @@ float cs_de_phase_slope(float iq_tones_comb[CS_DE_NUM_CHANNELS * 2])
 	float sum_q = 0;
 	float dist = 0;
 
-	for (uint32_t n = 1; n < CS_DE_NUM_CHANNELS; n++) {
-		sum_i += (iq_tones_comb[2 * n] * iq_tones_comb[2 * (n - 1)] +
-			  iq_tones_comb[2 * n + 1] * iq_tones_comb[2 * (n - 1) + 1]);
-		sum_q += (-iq_tones_comb[2 * n] * iq_tones_comb[2 * (n - 1) + 1] +
-			  iq_tones_comb[2 * n + 1] * iq_tones_comb[2 * (n - 1)]);
-	}
+	/* The phase slope is the angle of the sum of the products of each tone and
+	 * the complex conjugate of the previous tone.
+	 */
+	arm_cmplx_conj_f32(iq_tones_comb, m_conj_scratch_mem, CS_DE_NUM_CHANNELS - 1);
+	arm_cmplx_dot_prod_f32(&iq_tones_comb[2], m_conj_scratch_mem, CS_DE_NUM_CHANNELS - 1,
+			       &sum_i, &sum_q);
 
 	dist = -(SPEED_OF_LIGHT_M_PER_S * atan2f(sum_q, sum_i)) / (4.0f * PI * CHANNEL_SPACING_HZ);
 
@@ -230,9 +235,7 @@ static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE
 	 */
 
 	/* Complex conjugate the input. */
-	for (uint32_t i = 0; i < CS_DE_NUM_CHANNELS; i++) {
-		iq_tones_comb[i * 2 + 1] = -iq_tones_comb[i * 2 + 1];
-	}
+	arm_cmplx_conj_f32(iq_tones_comb, iq_tones_comb, CS_DE_NUM_CHANNELS);
 
 	/* Perform the FFT. */
 	#if CONFIG_BT_CS_DE_NFFT_SIZE == 512
@@ -250,12 +253,12 @@ static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE
 	 * and scale by 1/CONFIG_BT_CS_DE_NFFT_SIZE.
 	 * Store output in iq_tones_comb[0:CONFIG_BT_CS_DE_NFFT_SIZE - 1]
 	 */
-	for (uint32_t n = 0; n < CONFIG_BT_CS_DE_NFFT_SIZE; n++) {
-		float realIn = iq_tones_comb[2 * n] / CONFIG_BT_CS_DE_NFFT_SIZE;
-		float imagIn = iq_tones_comb[(2 * n) + 1] / CONFIG_BT_CS_DE_NFFT_SIZE;
-
-		arm_sqrt_f32((realIn * realIn) + (imagIn * imagIn), &iq_tones_comb[n]);
-	}
+	/* The magnitude can be computed in place, as each output value is written after
+	 * the complex value at the same or a higher index is read.
+	 */
+	arm_cmplx_mag_f32(iq_tones_comb, iq_tones_comb, CONFIG_BT_CS_DE_NFFT_SIZE);
+	arm_scale_f32(iq_tones_comb, 1.0f / CONFIG_BT_CS_DE_NFFT_SIZE, iq_tones_comb,
+		      CONFIG_BT_CS_DE_NFFT_SIZE);
 }
 
 static uint32_t find_ifft_peak_index(float ifft_mag[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
@@ -169,6 +169,7 @@ static int fp_adv_payload_set(bool rpa_rotated, bool new_session)
 	uint8_t adv_handle;
 	struct bt_le_adv_prov_adv_state state = {0};
 	struct bt_le_adv_prov_feedback fb = {0};
+	bool data_changed;
 	size_t ad_len = bt_le_adv_prov_get_ad_prov_cnt();
 	size_t sd_len = bt_le_adv_prov_get_sd_prov_cnt();
 	struct bt_data ad[ad_len];
@@ -193,12 +194,22 @@ static int fp_adv_payload_set(bool rpa_rotated, bool new_session)
 		return err;
 	}
 
+	data_changed = fb.data_changed;
+
 	err = bt_le_adv_prov_get_sd(sd, &sd_len, &state, &fb);
 	if (err) {
 		LOG_ERR("Fast Pair Adv Manager: cannot get scan response data (err: %d)", err);
 		return err;
 	}
 
+	data_changed = data_changed || fb.data_changed;
+
+	/* The advertising set may have no data at the start of a new advertising session. */
+	if (!data_changed && !rpa_rotated && !new_session) {
+		LOG_DBG("Fast Pair Adv Manager: advertising data did not change");
+		return 0;
+	}
+
 	err = bt_le_ext_adv_set_data(fp_adv_set, ad, ad_len, sd, sd_len);
 	if (err) {
 		LOG_ERR("Fast Pair Adv Manager: bt_le_ext_adv_set_data returned error: %d", err);
@@ -60,7 +60,9 @@ struct ring_context {
 
 struct conn_context {
 	uint8_t random_nonce[BEACON_ACTIONS_RANDOM_NONCE_LEN];
+	uint8_t eik_hash[EPHEMERAL_IDENTITY_KEY_REQ_EIK_HASH_LEN];
 	bool is_challenge_valid;
+	bool is_eik_hash_valid;
 };
 
 static struct conn_context conn_contexts[CONFIG_BT_MAX_CONN];
@@ -75,12 +77,22 @@ static bool owner_account_key_check(const struct fp_account_key *account_key, vo
 	return (ret > 0) ? true : false;
 }
 
-static bool eik_hash_compare(const uint8_t *eik_hash, const uint8_t *random_nonce)
+static bool eik_hash_compare(const uint8_t *eik_hash, struct conn_context *conn_context)
 {
 	int err;
 	uint8_t eik_hash_local[FP_CRYPTO_SHA256_HASH_LEN];
 	uint8_t hash_input[FP_FHN_STATE_EIK_LEN + BEACON_ACTIONS_RANDOM_NONCE_LEN];
 
+	BUILD_ASSERT(DEACTIVATE_UTP_MODE_REQ_EIK_HASH_LEN == EPHEMERAL_IDENTITY_KEY_REQ_EIK_HASH_LEN);
+
+	/* The hash depends only on the EIK and the random nonce of the connection, so it is
+	 * reused until the nonce is regenerated or the EIK changes.
+	 */
+	if (conn_context->is_eik_hash_valid) {
+		return !memcmp(conn_context->eik_hash, eik_hash,
+			       EPHEMERAL_IDENTITY_KEY_REQ_EIK_HASH_LEN);
+	}
+
 	/* Calculate: (Ephemeral Identity Key || random_nonce) */
 	err = fp_fhn_state_eik_read(hash_input);
 	if (err) {
@@ -90,7 +102,7 @@ static bool eik_hash_compare(const uint8_t *eik_hash, const uint8_t *random_nonc
 		return false;
 	}
 	memcpy(hash_input + FP_FHN_STATE_EIK_LEN,
-	       random_nonce,
+	       conn_context->random_nonce,
 	       BEACON_ACTIONS_RANDOM_NONCE_LEN);
 
 	/* Generate local version of EIK Hash. */
@@ -101,9 +113,19 @@ static bool eik_hash_compare(const uint8_t *eik_hash, const uint8_t *random_nonc
 		return false;
 	}
 
+	memcpy(conn_context->eik_hash, eik_hash_local, sizeof(conn_context->eik_hash));
+	conn_context->is_eik_hash_valid = true;
+
 	return !memcmp(eik_hash_local, eik_hash, EPHEMERAL_IDENTITY_KEY_REQ_EIK_HASH_LEN);
 }
 
+static void eik_hash_cache_invalidate(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(conn_contexts); i++) {
+		conn_contexts[i].is_eik_hash_valid = false;
+	}
+}
+
 static const struct bt_gatt_attr *beacon_response_attr_get(void)
 {
 	static const struct bt_gatt_attr *beacon_actions_chrc_notify_attr;
@@ -431,12 +453,11 @@ static ssize_t ephemeral_identity_key_set_handle(struct bt_conn *conn,
 						EPHEMERAL_IDENTITY_KEY_SET_REQ_EIK_LEN);
 	if (provisioned) {
 		uint8_t *current_eik_hash;
-		uint8_t *random_nonce = conn_contexts[bt_conn_index(conn)].random_nonce;
 
 		current_eik_hash = net_buf_simple_pull_mem(
 			req_data_buf, EPHEMERAL_IDENTITY_KEY_REQ_EIK_HASH_LEN);
 
-		if (!eik_hash_compare(current_eik_hash, random_nonce)) {
+		if (!eik_hash_compare(current_eik_hash, &conn_contexts[bt_conn_index(conn)])) {
 			LOG_ERR("Beacon Actions: Ephemeral Identity Key Set request:"
 				" Current EIK hash does not match");
 
@@ -468,6 +489,7 @@ static ssize_t ephemeral_identity_key_set_handle(struct bt_conn *conn,
 	}
 
 	err = fp_fhn_state_eik_provision(new_eik);
+	eik_hash_cache_invalidate();
 	if (err) {
 		LOG_ERR("Beacon Actions: Ephemeral Identity Key Set request:"
 			" Beacon State provision failed: %d", err);
@@ -515,7 +537,6 @@ static ssize_t ephemeral_identity_key_clear_handle(struct bt_conn *conn,
 	struct fp_fhn_auth_data auth_data;
 	struct fp_account_key account_key;
 	uint8_t *current_eik_hash;
-	uint8_t *random_nonce;
 	const bool provisioned = bt_fast_pair_fhn_is_provisioned();
 	static const uint8_t req_data_len = EPHEMERAL_IDENTITY_KEY_CLEAR_REQ_PAYLOAD_LEN;
 	static const uint8_t rsp_data_len = EPHEMERAL_IDENTITY_KEY_CLEAR_RSP_PAYLOAD_LEN;
@@ -569,9 +590,8 @@ static ssize_t ephemeral_identity_key_clear_handle(struct bt_conn *conn,
 
 	current_eik_hash = net_buf_simple_pull_mem(
 		req_data_buf, EPHEMERAL_IDENTITY_KEY_REQ_EIK_HASH_LEN);
-	random_nonce = conn_contexts[bt_conn_index(conn)].random_nonce;
 
-	if (!eik_hash_compare(current_eik_hash, random_nonce)) {
+	if (!eik_hash_compare(current_eik_hash, &conn_contexts[bt_conn_index(conn)])) {
 		LOG_ERR("Beacon Actions: Ephemeral Identity Key Clear request:"
 			" Current EIK hash does not match");
 
@@ -579,6 +599,7 @@ static ssize_t ephemeral_identity_key_clear_handle(struct bt_conn *conn,
 	}
 
 	err = fp_fhn_state_eik_provision(NULL);
+	eik_hash_cache_invalidate();
 	if (err) {
 		LOG_ERR("Beacon Actions: Ephemeral Identity Key Clear request:"
 			" Beacon State unprovision failed: %d", err);
@@ -1096,7 +1117,7 @@ static ssize_t deactivate_utp_mode_handle(struct bt_conn *conn,
 	current_eik_hash = net_buf_simple_pull_mem(
 		req_data_buf, DEACTIVATE_UTP_MODE_REQ_EIK_HASH_LEN);
 
-	if (!eik_hash_compare(current_eik_hash, random_nonce)) {
+	if (!eik_hash_compare(current_eik_hash, &conn_contexts[bt_conn_index(conn)])) {
 		LOG_ERR("Beacon Actions: Deactivate Unwanted Tracking Protection mode request:"
 			" Current EIK hash does not match");
 
@@ -1503,6 +1524,8 @@ ssize_t fp_fhn_beacon_actions_read(struct bt_conn *conn,
 
 	conn_context = &conn_contexts[bt_conn_index(conn)];
 
+	conn_context->is_eik_hash_valid = false;
+
 	err = sys_csrand_get(conn_context->random_nonce, sizeof(conn_context->random_nonce));
 	if (err) {
 		LOG_ERR("Beacon Actions: failed to generate random nonce: err=%d", err);
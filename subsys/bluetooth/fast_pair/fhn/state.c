@@ -137,6 +137,22 @@ static uint8_t fhn_frame_hashed_flags_xor_operand;
 static uint8_t * const fhn_eid = (fhn_frame_payload + FHN_FRAME_EID_OFFSET);
 static uint32_t fhn_eid_clock_checkpoint;
 
+#if defined(CONFIG_BT_FAST_PAIR_FHN_EID_PRECOMPUTE)
+/* Second buffer for the EID-dependent part of the advertising payload. It holds
+ * the data for the next rotation period and is swapped into the payload on rotation.
+ */
+static struct {
+	bool valid;
+	uint32_t fhn_clock;
+	uint32_t generation;
+	uint8_t eid[FP_FHN_STATE_EID_LEN];
+	uint8_t hashed_flags_xor_operand;
+} eid_precomp;
+
+static void eid_precomp_work_handle(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(eid_precomp_work, eid_precomp_work_handle);
+#endif
+
 static bool utp_mode;
 static bool utp_mode_rpa_change_request;
 static uint8_t utp_mode_control_flags;
@@ -168,34 +184,16 @@ static void eid_seed_half_encode(struct net_buf_simple *buf,
 	net_buf_simple_add_be32(buf, fhn_clock);
 }
 
-static int eid_encode(void)
+static int eid_calculate(uint32_t fhn_clock, uint8_t *eid, uint8_t *hashed_flags_xor_operand)
 {
 	int err;
-	uint32_t fhn_clock;
 	uint8_t eik[FP_STORAGE_EIK_LEN];
 	uint8_t encrypted_eid_seed[FP_CRYPTO_AES256_BLOCK_LEN];
-	const uint8_t uninitialized_eid[FP_FHN_STATE_EID_LEN] = {};
 	uint8_t secp_mod_res[SECP_MOD_RES_LEN];
 	uint8_t mod_res_hash[FP_CRYPTO_SHA256_HASH_LEN];
 
 	NET_BUF_SIMPLE_DEFINE(eid_seed_buf, FHN_EID_SEED_LEN);
 
-	/* Prepare the FHN Clock value. */
-	fhn_clock = fp_fhn_clock_read();
-
-	/* Clear the K lowest bits in the clock value. */
-	fhn_clock &= ~BIT_MASK(FHN_EID_SEED_ROT_PERIOD_EXP);
-
-	/* Check if the EID seed or EIK has changed since the last call. */
-	if (memcmp(fhn_eid, uninitialized_eid, sizeof(uninitialized_eid)) != 0) {
-		if (fhn_clock == fhn_eid_clock_checkpoint) {
-			LOG_DBG("FHN State: EID does not require recalculation");
-
-			return 0;
-		}
-	}
-	fhn_eid_clock_checkpoint = fhn_clock;
-
 	/* Prepare the EID seed data. */
 	eid_seed_half_encode(&eid_seed_buf,
 			     FHN_EID_SEED_PADDING_TYPE_ONE,
@@ -231,7 +229,7 @@ static int eid_encode(void)
 
 	/* Calculate the EID as the x coordinate of a point on the elliptic curve. */
 	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_FHN_ECC_SECP160R1)) {
-		err = fp_crypto_ecc_secp160r1_calculate(fhn_eid,
+		err = fp_crypto_ecc_secp160r1_calculate(eid,
 							secp_mod_res,
 							encrypted_eid_seed,
 							sizeof(encrypted_eid_seed));
@@ -242,7 +240,7 @@ static int eid_encode(void)
 			return err;
 		}
 	} else if (IS_ENABLED(CONFIG_BT_FAST_PAIR_FHN_ECC_SECP256R1)) {
-		err = fp_crypto_ecc_secp256r1_calculate(fhn_eid,
+		err = fp_crypto_ecc_secp256r1_calculate(eid,
 							secp_mod_res,
 							encrypted_eid_seed,
 							sizeof(encrypted_eid_seed));
@@ -256,7 +254,7 @@ static int eid_encode(void)
 		__ASSERT(0, "ECC selection not supported");
 	}
 
-	LOG_HEXDUMP_DBG(fhn_eid, FP_FHN_STATE_EID_LEN, "EID:");
+	LOG_HEXDUMP_DBG(eid, FP_FHN_STATE_EID_LEN, "EID:");
 
 	/* Calculate the XOR operand for the Hashed Flags bitmask. */
 	err = fp_crypto_sha256(mod_res_hash, secp_mod_res, sizeof(secp_mod_res));
@@ -266,7 +264,132 @@ static int eid_encode(void)
 		return err;
 	}
 
-	fhn_frame_hashed_flags_xor_operand = mod_res_hash[sizeof(mod_res_hash) - 1];
+	*hashed_flags_xor_operand = mod_res_hash[sizeof(mod_res_hash) - 1];
+
+	return 0;
+}
+
+#if defined(CONFIG_BT_FAST_PAIR_FHN_EID_PRECOMPUTE)
+static void eid_precomp_work_handle(struct k_work *work)
+{
+	int err;
+	uint32_t fhn_clock;
+	uint32_t generation;
+	uint8_t eid[FP_FHN_STATE_EID_LEN];
+	uint8_t hashed_flags_xor_operand;
+
+	if (!bt_fast_pair_fhn_is_provisioned()) {
+		return;
+	}
+
+	fhn_clock = eid_precomp.fhn_clock;
+	generation = eid_precomp.generation;
+
+	err = eid_calculate(fhn_clock, eid, &hashed_flags_xor_operand);
+	if (err) {
+		/* The EID is calculated on rotation instead. */
+		LOG_WRN("FHN State: EID precomputation failed: %d", err);
+		return;
+	}
+
+	/* Drop the result if the EIK changed while the crypto operations were in progress. */
+	if (generation != eid_precomp.generation) {
+		LOG_DBG("FHN State: dropping outdated precomputed EID");
+		return;
+	}
+
+	memcpy(eid_precomp.eid, eid, sizeof(eid_precomp.eid));
+	eid_precomp.hashed_flags_xor_operand = hashed_flags_xor_operand;
+	eid_precomp.valid = true;
+
+	LOG_DBG("FHN State: precomputed EID for the FHN Clock value: %" PRIu32, fhn_clock);
+}
+
+static void eid_precomp_schedule(uint32_t fhn_clock)
+{
+	uint32_t now;
+	uint32_t delay = 0;
+	uint32_t next_fhn_clock = fhn_clock + BIT(FHN_EID_SEED_ROT_PERIOD_EXP);
+
+	if (eid_precomp.valid && (eid_precomp.fhn_clock == next_fhn_clock)) {
+		return;
+	}
+
+	eid_precomp.valid = false;
+	eid_precomp.fhn_clock = next_fhn_clock;
+	eid_precomp.generation++;
+
+	/* Start the calculation ahead of the next rotation period. */
+	now = fp_fhn_clock_read();
+	if ((next_fhn_clock - now) > CONFIG_BT_FAST_PAIR_FHN_EID_PRECOMPUTE_LEAD_TIME) {
+		delay = next_fhn_clock - now - CONFIG_BT_FAST_PAIR_FHN_EID_PRECOMPUTE_LEAD_TIME;
+	}
+
+	(void) k_work_reschedule(&eid_precomp_work, K_SECONDS(delay));
+}
+
+static bool eid_precomp_take(uint32_t fhn_clock)
+{
+	if (!eid_precomp.valid || (eid_precomp.fhn_clock != fhn_clock)) {
+		return false;
+	}
+
+	memcpy(fhn_eid, eid_precomp.eid, FP_FHN_STATE_EID_LEN);
+	fhn_frame_hashed_flags_xor_operand = eid_precomp.hashed_flags_xor_operand;
+	eid_precomp.valid = false;
+
+	LOG_DBG("FHN State: using precomputed EID");
+
+	return true;
+}
+#endif /* defined(CONFIG_BT_FAST_PAIR_FHN_EID_PRECOMPUTE) */
+
+static void eid_precomp_invalidate(void)
+{
+#if defined(CONFIG_BT_FAST_PAIR_FHN_EID_PRECOMPUTE)
+	(void) k_work_cancel_delayable(&eid_precomp_work);
+	eid_precomp.valid = false;
+	eid_precomp.generation++;
+#endif
+}
+
+static int eid_encode(void)
+{
+	int err;
+	uint32_t fhn_clock;
+	const uint8_t uninitialized_eid[FP_FHN_STATE_EID_LEN] = {};
+
+	/* Prepare the FHN Clock value. */
+	fhn_clock = fp_fhn_clock_read();
+
+	/* Clear the K lowest bits in the clock value. */
+	fhn_clock &= ~BIT_MASK(FHN_EID_SEED_ROT_PERIOD_EXP);
+
+	/* Check if the EID seed or EIK has changed since the last call. */
+	if (memcmp(fhn_eid, uninitialized_eid, sizeof(uninitialized_eid)) != 0) {
+		if (fhn_clock == fhn_eid_clock_checkpoint) {
+			LOG_DBG("FHN State: EID does not require recalculation");
+
+			return 0;
+		}
+	}
+	fhn_eid_clock_checkpoint = fhn_clock;
+
+#if defined(CONFIG_BT_FAST_PAIR_FHN_EID_PRECOMPUTE)
+	if (!eid_precomp_take(fhn_clock)) {
+		err = eid_calculate(fhn_clock, fhn_eid, &fhn_frame_hashed_flags_xor_operand);
+		if (err) {
+			return err;
+		}
+	}
+
+	eid_precomp_schedule(fhn_clock);
+#else
+	err = eid_calculate(fhn_clock, fhn_eid, &fhn_frame_hashed_flags_xor_operand);
+	if (err) {
+		return err;
+	}
+#endif
 
 	return 0;
 }
@@ -1007,6 +1130,7 @@ static int fhn_storage_unprovision(void)
 	}
 
 	memset(fhn_eid, 0, FP_FHN_STATE_EID_LEN);
+	eid_precomp_invalidate();
 
 	return 0;
 }
@@ -1052,6 +1176,7 @@ static int fhn_storage_provision(const uint8_t *eik)
 	}
 
 	memset(fhn_eid, 0, FP_FHN_STATE_EID_LEN);
+	eid_precomp_invalidate();
 
 	return 0;
 }
@@ -1326,6 +1451,9 @@ int fp_fhn_state_uninit(void)
 	/* Cancel the work for the provisioning_state_changed callback. */
 	(void) k_work_cancel(&fhn_post_init_work);
 
+	/* Cancel the EID precomputation. */
+	eid_precomp_invalidate();
+
 	LOG_DBG("FHN State: disabled");
 
 	return 0;
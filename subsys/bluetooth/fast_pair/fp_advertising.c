@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <string.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/random/random.h>
 #include <zephyr/bluetooth/bluetooth.h>
@@ -15,6 +16,7 @@ LOG_MODULE_DECLARE(fast_pair, CONFIG_BT_FAST_PAIR_LOG_LEVEL);
 #include <bluetooth/fast_pair/fast_pair.h>
 #include <bluetooth/fast_pair/uuid.h>
 #include "fp_battery.h"
+#include "fp_activation.h"
 #include "fp_common.h"
 #include "fp_crypto.h"
 #include "fp_registration_data.h"
@@ -25,6 +27,8 @@ LOG_MODULE_DECLARE(fast_pair, CONFIG_BT_FAST_PAIR_LOG_LEVEL);
 #define FIELD_LEN_TYPE_SIZE			sizeof(uint8_t)
 #define ENCODE_FIELD_LEN_TYPE(len, type)	(((len) << TYPE_BITS) | (type))
 
+#define AK_FILTER_MAX_SIZE			BIT_MASK(LEN_BITS)
+
 #define BATTERY_LEVEL_BITS			7
 #define FIELD_BATTERY_STATUS_LEVEL_SIZE		sizeof(uint8_t)
 #define ENCODE_FIELD_BATTERY_STATUS_LEVEL(charging, level) \
@@ -42,6 +46,21 @@ static const uint16_t fast_pair_uuid = BT_FAST_PAIR_UUID_FPS_VAL;
 static const uint8_t version_and_flags;
 static const uint8_t empty_account_key_list;
 
+#if defined(CONFIG_BT_FAST_PAIR_ADV_FILTER_PRECOMPUTE)
+static struct {
+	bool valid;
+	bool battery_info_present;
+	size_t account_key_cnt;
+	struct fp_account_key ak[CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX];
+	uint8_t battery_info[FP_CRYPTO_BATTERY_INFO_LEN];
+	uint16_t salt;
+	uint8_t ak_filter[AK_FILTER_MAX_SIZE];
+} precomp;
+
+static void precomp_work_handler(struct k_work *work);
+static K_WORK_DEFINE(precomp_work, precomp_work_handler);
+#endif
+
 static int check_adv_config(struct bt_fast_pair_adv_config fp_adv_config)
 {
 	if ((fp_adv_config.mode >= BT_FAST_PAIR_ADV_MODE_COUNT) || (fp_adv_config.mode < 0)) {
@@ -179,6 +198,117 @@ static void fp_adv_data_fill_battery_info(uint8_t *battery_info,
 	}
 }
 
+#if defined(CONFIG_BT_FAST_PAIR_ADV_FILTER_PRECOMPUTE)
+static void precomp_work_handler(struct k_work *work)
+{
+	int err;
+
+	/* The system workqueue thread is cooperative, so the payload cannot be filled while the
+	 * filter is computed.
+	 */
+	if (precomp.valid || (precomp.account_key_cnt == 0)) {
+		return;
+	}
+
+	err = sys_csrand_get(&precomp.salt, sizeof(precomp.salt));
+	if (err) {
+		LOG_WRN("Failed to generate Salt for precomputed filter (err %d)", err);
+		return;
+	}
+
+	err = fp_crypto_account_key_filter(precomp.ak_filter, precomp.ak, precomp.account_key_cnt,
+					   precomp.salt,
+					   precomp.battery_info_present ? precomp.battery_info : NULL);
+	if (err) {
+		LOG_WRN("Failed to precompute Account Key Filter (err %d)", err);
+		return;
+	}
+
+	precomp.valid = true;
+}
+
+static bool precomp_match(const struct fp_account_key *ak, size_t account_key_cnt,
+			  const uint8_t *battery_info)
+{
+	if (!precomp.valid || (precomp.account_key_cnt != account_key_cnt) ||
+	    (precomp.battery_info_present != (battery_info != NULL))) {
+		return false;
+	}
+
+	if (memcmp(precomp.ak, ak, account_key_cnt * sizeof(ak[0]))) {
+		return false;
+	}
+
+	return !battery_info ||
+	       !memcmp(precomp.battery_info, battery_info, sizeof(precomp.battery_info));
+}
+
+static void precomp_schedule(const struct fp_account_key *ak, size_t account_key_cnt,
+			     const uint8_t *battery_info)
+{
+	/* Salt must not be reused, so the filter for the next payload is always recomputed. */
+	precomp.valid = false;
+	precomp.account_key_cnt = account_key_cnt;
+	memcpy(precomp.ak, ak, account_key_cnt * sizeof(ak[0]));
+	precomp.battery_info_present = (battery_info != NULL);
+	if (battery_info) {
+		memcpy(precomp.battery_info, battery_info, sizeof(precomp.battery_info));
+	}
+
+	(void)k_work_submit(&precomp_work);
+}
+
+static int precomp_init(void)
+{
+	return 0;
+}
+
+static int precomp_uninit(void)
+{
+	(void)k_work_cancel(&precomp_work);
+	memset(&precomp, 0, sizeof(precomp));
+
+	return 0;
+}
+
+FP_ACTIVATION_MODULE_REGISTER(fp_advertising, FP_ACTIVATION_INIT_PRIORITY_DEFAULT, precomp_init,
+			      precomp_uninit);
+#endif /* defined(CONFIG_BT_FAST_PAIR_ADV_FILTER_PRECOMPUTE) */
+
+static int fp_adv_ak_filter_get(uint8_t *ak_filter, const struct fp_account_key *ak,
+				size_t account_key_cnt, const uint8_t *battery_info,
+				uint16_t *salt)
+{
+	int err;
+
+#if defined(CONFIG_BT_FAST_PAIR_ADV_FILTER_PRECOMPUTE)
+	if (precomp_match(ak, account_key_cnt, battery_info)) {
+		memcpy(ak_filter, precomp.ak_filter,
+		       fp_crypto_account_key_filter_size(account_key_cnt));
+		*salt = precomp.salt;
+		precomp_schedule(ak, account_key_cnt, battery_info);
+
+		return 0;
+	}
+#endif
+
+	err = sys_csrand_get(salt, sizeof(*salt));
+	if (err) {
+		return err;
+	}
+
+	err = fp_crypto_account_key_filter(ak_filter, ak, account_key_cnt, *salt, battery_info);
+	if (err) {
+		return err;
+	}
+
+#if defined(CONFIG_BT_FAST_PAIR_ADV_FILTER_PRECOMPUTE)
+	precomp_schedule(ak, account_key_cnt, battery_info);
+#endif
+
+	return 0;
+}
+
 static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t account_key_cnt,
 					     enum fp_field_type ak_filter_type,
 					     enum bt_fast_pair_adv_battery_mode adv_battery_mode)
@@ -210,11 +340,6 @@ static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t
 		uint16_t salt;
 		int err;
 
-		err = sys_csrand_get(&salt, sizeof(salt));
-		if (err) {
-			return err;
-		}
-
 		err = fp_storage_ak_get(ak, &account_key_get_cnt);
 		if (err) {
 			return err;
@@ -226,12 +351,12 @@ static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t
 
 		BUILD_ASSERT(sizeof(uint8_t) == FIELD_LEN_TYPE_SIZE);
 
-		__ASSERT_NO_MSG(ak_filter_size <= BIT_MASK(LEN_BITS));
+		__ASSERT_NO_MSG(ak_filter_size <= AK_FILTER_MAX_SIZE);
 		net_buf_simple_add_u8(buf, ENCODE_FIELD_LEN_TYPE(ak_filter_size, ak_filter_type));
 
-		err = fp_crypto_account_key_filter(net_buf_simple_add(buf, ak_filter_size), ak,
-						   account_key_cnt, salt,
-						   add_battery_info ? battery_info : NULL);
+		err = fp_adv_ak_filter_get(net_buf_simple_add(buf, ak_filter_size), ak,
+					   account_key_cnt, add_battery_info ? battery_info : NULL,
+					   &salt);
 		if (err) {
 			return err;
 		}
@@ -578,23 +578,35 @@ int fp_storage_ak_find(struct fp_account_key *account_key,
 		return -EINVAL;
 	}
 
+	/* Check the Account Keys starting from the most recently used one. A Seeker that
+	 * connects again is most likely to use it, so the key is usually found with
+	 * the first check.
+	 */
 	for (size_t i = 0; i < account_key_count; i++) {
-		if (account_key_check_cb(&account_key_list[i], context)) {
+		uint8_t id = account_key_order[i];
+		uint8_t idx = account_key_id_to_idx(id);
+
+		__ASSERT_NO_MSG(ACCOUNT_KEY_METADATA_FIELD_GET(account_key_metadata[idx], ID) == id);
+
+		if (account_key_check_cb(&account_key_list[idx], context)) {
 			int err;
 
-			ak_order_update_ram(ACCOUNT_KEY_METADATA_FIELD_GET(account_key_metadata[i],
-									   ID));
-			err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-						sizeof(account_key_order));
-			if (err) {
-				LOG_ERR("Unable to save new Account Key order in Settings. "
-					"Not propagating the error and keeping updated Account Key "
-					"order in RAM. After the Settings error the Account Key "
-					"order may change at reboot.");
+			/* The order does not change if the most recently used key is found. */
+			if (i > 0) {
+				ak_order_update_ram(id);
+				err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME,
+							account_key_order,
+							sizeof(account_key_order));
+				if (err) {
+					LOG_ERR("Unable to save new Account Key order in Settings. "
+						"Not propagating the error and keeping updated "
+						"Account Key order in RAM. After the Settings error "
+						"the Account Key order may change at reboot.");
+				}
 			}
 
 			if (account_key) {
-				*account_key = account_key_list[i];
+				*account_key = account_key_list[idx];
 			}
 
 			return 0;
@@ -10,11 +10,19 @@
 
 #include <bluetooth/gatt_dm.h>
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#include <zephyr/init.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/byteorder.h>
+#endif
+
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 
+#if !defined(CONFIG_BT_GATT_DM_ARENA)
 /* Available sizes: 128, 512, 2048... */
 #define CHUNK_DATA_SIZE (128 - sizeof(struct k_heap *) \
 		- sizeof(struct data_chunk_item *))
+#endif
 
 #define DATA_ALIGN 4U
 
@@ -44,9 +52,19 @@ SYS_INIT(gatt_dm_wq_init, POST_KERNEL, CONFIG_BT_GATT_DM_WORKQ_INIT_PRIO);
 enum {
 	STATE_ATTRS_LOCKED,
 	STATE_ATTRS_RELEASE_PENDING,
+	STATE_HASH_READ_PENDING,
 	STATE_NUM
 };
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#define CACHE_SETTINGS_NAME "bt_dm"
+/* "bt_dm/<address><type>/<UUID>" */
+#define CACHE_KEY_LEN (sizeof(CACHE_SETTINGS_NAME "/") + 2 * sizeof(bt_addr_t) + 1 + 1 + \
+		       2 * BT_UUID_SIZE_128)
+#define DB_HASH_SIZE 16
+#endif
+
+#if !defined(CONFIG_BT_GATT_DM_ARENA)
 /* One item in linked list containing dynamically allocated user data chunks */
 struct data_chunk_item {
 	/* Required by the sys_slist */
@@ -54,6 +72,7 @@ struct data_chunk_item {
 	/* User data storage */
 	uint8_t data[CHUNK_DATA_SIZE];
 };
+#endif
 
 /* The instance structure real declaration */
 struct bt_gatt_dm {
@@ -79,10 +98,17 @@ struct bt_gatt_dm {
 		struct bt_uuid_128 u128;
 	} svc_uuid;
 
+#if defined(CONFIG_BT_GATT_DM_ARENA)
+	/* Static storage for user data */
+	uint8_t arena[CONFIG_BT_GATT_DM_ARENA_SIZE] __aligned(DATA_ALIGN);
+	/* The used length of the arena */
+	size_t arena_len;
+#else
 	/* Single-linked list of allocated chunks for user data */
 	sys_slist_t chunk_list;
 	/* The used length of the current chunk */
 	size_t cur_chunk_len;
+#endif
 
 	/* The pointer to callback structure */
 	const struct bt_gatt_dm_cb *callback;
@@ -92,11 +118,62 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Parameters used to read the Database Hash of the peer. */
+	struct bt_gatt_read_params read_params;
+	/* Database Hash the cached or discovered attributes belong to. */
+	uint8_t db_hash[DB_HASH_SIZE];
+	/* Settings key of the cache entry. */
+	char cache_key[CACHE_KEY_LEN];
+	/* Attributes were loaded from the cache. */
+	bool cache_loaded;
+	/* Discovered attributes are to be saved to the cache. */
+	bool cache_save;
+#endif
 };
 
 /* Currently only one instance is supported */
 static struct bt_gatt_dm bt_gatt_dm_inst;
 
+#if defined(CONFIG_BT_GATT_DM_ARENA)
+/* Returns pointer to newly allocated space in a dm->arena */
+static void *user_data_alloc(struct bt_gatt_dm *dm,
+			     size_t len)
+{
+	uint8_t *user_data_loc;
+
+	/* Round up len to 32 bits to make sure that return pointers are always
+	 * correctly aligned.
+	 */
+	len = ROUND_UP(len, DATA_ALIGN);
+
+	if (dm->arena_len + len > sizeof(dm->arena)) {
+		return NULL;
+	}
+
+	user_data_loc = &dm->arena[dm->arena_len];
+	dm->arena_len += len;
+
+	return user_data_loc;
+}
+
+static void user_data_init(struct bt_gatt_dm *dm)
+{
+	dm->arena_len = 0;
+}
+
+static void svc_attr_memory_release(struct bt_gatt_dm *dm)
+{
+	LOG_DBG("Attr memory release");
+
+	/* Clear attributes */
+	dm->cur_attr_id = 0;
+
+	/* The arena is reused by the next discovery */
+	dm->arena_len = 0;
+}
+#else
 /* Returns pointer to newly allocated space in a dm->data_chunk */
 static void *user_data_alloc(struct bt_gatt_dm *dm,
 			     size_t len)
@@ -156,6 +233,13 @@ static void svc_attr_memory_release(struct bt_gatt_dm *dm)
 	dm->cur_chunk_len = 0;
 }
 
+static void user_data_init(struct bt_gatt_dm *dm)
+{
+	sys_slist_init(&dm->chunk_list);
+	dm->cur_chunk_len = 0;
+}
+#endif /* CONFIG_BT_GATT_DM_ARENA */
+
 /* Returns size of UUID structure with padding for memory alignment */
 static size_t get_uuid_size(const struct bt_uuid *uuid)
 {
@@ -268,9 +352,464 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+/* Cache entries hold the Database Hash, the number of attributes and then
+ * the attributes in handle order. Each attribute is stored as its handle,
+ * permissions and UUID, followed by the end handle and UUID of a service or
+ * the value handle, properties and UUID of a characteristic.
+ */
+struct cache_buf {
+	uint8_t *data;
+	size_t size;
+	size_t len;
+};
+
+static void cache_put(struct cache_buf *buf, const void *data, size_t len)
+{
+	if (buf->data && (buf->len + len <= buf->size)) {
+		memcpy(&buf->data[buf->len], data, len);
+	}
+
+	buf->len += len;
+}
+
+static bool cache_get(struct cache_buf *buf, void *data, size_t len)
+{
+	if (buf->len + len > buf->size) {
+		return false;
+	}
+
+	memcpy(data, &buf->data[buf->len], len);
+	buf->len += len;
+
+	return true;
+}
+
+static void cache_put_u16(struct cache_buf *buf, uint16_t val)
+{
+	uint8_t le[sizeof(val)];
+
+	sys_put_le16(val, le);
+	cache_put(buf, le, sizeof(le));
+}
+
+static bool cache_get_u16(struct cache_buf *buf, uint16_t *val)
+{
+	uint8_t le[sizeof(*val)];
+
+	if (!cache_get(buf, le, sizeof(le))) {
+		return false;
+	}
+
+	*val = sys_get_le16(le);
+
+	return true;
+}
+
+static size_t uuid_val_size(uint8_t type)
+{
+	switch (type) {
+	case BT_UUID_TYPE_16:
+		return BT_UUID_SIZE_16;
+	case BT_UUID_TYPE_32:
+		return BT_UUID_SIZE_32;
+	case BT_UUID_TYPE_128:
+		return BT_UUID_SIZE_128;
+	default:
+		return 0;
+	}
+}
+
+static void uuid_val_get(const struct bt_uuid *uuid, uint8_t *val)
+{
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, val);
+		break;
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, val);
+		break;
+	case BT_UUID_TYPE_128:
+		memcpy(val, BT_UUID_128(uuid)->val, BT_UUID_SIZE_128);
+		break;
+	default:
+		break;
+	}
+}
+
+static void cache_put_uuid(struct cache_buf *buf, const struct bt_uuid *uuid)
+{
+	uint8_t val[BT_UUID_SIZE_128];
+	size_t size = uuid_val_size(uuid->type);
+
+	uuid_val_get(uuid, val);
+	cache_put(buf, &uuid->type, sizeof(uuid->type));
+	cache_put(buf, val, size);
+}
+
+static bool cache_get_uuid(struct cache_buf *buf, struct bt_uuid_128 *uuid)
+{
+	uint8_t val[BT_UUID_SIZE_128];
+	uint8_t type;
+	size_t size;
+
+	if (!cache_get(buf, &type, sizeof(type))) {
+		return false;
+	}
+
+	size = uuid_val_size(type);
+
+	return size && cache_get(buf, val, size) &&
+	       bt_uuid_create(&uuid->uuid, val, size);
+}
+
+static void cache_encode(const struct bt_gatt_dm *dm, struct cache_buf *buf)
+{
+	cache_put(buf, dm->db_hash, sizeof(dm->db_hash));
+	cache_put(buf, &(uint8_t){dm->cur_attr_id}, sizeof(uint8_t));
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		const struct bt_gatt_dm_attr *attr = &dm->attrs[i];
+		const struct bt_gatt_service_val *service_val = bt_gatt_dm_attr_service_val(attr);
+		const struct bt_gatt_chrc *chrc = bt_gatt_dm_attr_chrc_val(attr);
+
+		cache_put_u16(buf, attr->handle);
+		cache_put(buf, &attr->perm, sizeof(attr->perm));
+		cache_put_uuid(buf, attr->uuid);
+
+		if (service_val) {
+			cache_put_u16(buf, service_val->end_handle);
+			cache_put_uuid(buf, service_val->uuid);
+		} else if (chrc) {
+			cache_put_u16(buf, chrc->value_handle);
+			cache_put(buf, &(uint8_t){chrc->properties}, sizeof(uint8_t));
+			cache_put_uuid(buf, chrc->uuid);
+		}
+	}
+}
+
+static int cache_decode(struct bt_gatt_dm *dm, struct cache_buf *buf)
+{
+	uint8_t cnt;
+
+	if (!cache_get(buf, dm->db_hash, sizeof(dm->db_hash)) ||
+	    !cache_get(buf, &cnt, sizeof(cnt)) || !cnt) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < cnt; i++) {
+		struct bt_uuid_128 uuid;
+		struct bt_uuid_128 val_uuid;
+		uint16_t val_handle;
+		uint8_t properties = 0;
+		uint8_t perm;
+		struct bt_gatt_attr attr = {
+			.uuid = &uuid.uuid,
+		};
+		struct bt_gatt_dm_attr *cur_attr;
+		bool service;
+		bool chrc;
+
+		if (!cache_get_u16(buf, &attr.handle) ||
+		    !cache_get(buf, &perm, sizeof(perm)) ||
+		    !cache_get_uuid(buf, &uuid)) {
+			return -EINVAL;
+		}
+
+		attr.perm = perm;
+
+		service = !bt_uuid_cmp(&uuid.uuid, BT_UUID_GATT_PRIMARY) ||
+			  !bt_uuid_cmp(&uuid.uuid, BT_UUID_GATT_SECONDARY);
+		chrc = !bt_uuid_cmp(&uuid.uuid, BT_UUID_GATT_CHRC);
+
+		if ((service || chrc) &&
+		    (!cache_get_u16(buf, &val_handle) ||
+		     (chrc && !cache_get(buf, &properties, sizeof(properties))) ||
+		     !cache_get_uuid(buf, &val_uuid))) {
+			return -EINVAL;
+		}
+
+		if (service != (i == 0)) {
+			return -EINVAL;
+		}
+
+		if (service) {
+			struct bt_gatt_service_val *service_val;
+
+			cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+			if (!cur_attr) {
+				return -ENOMEM;
+			}
+
+			service_val = bt_gatt_dm_attr_service_val(cur_attr);
+			service_val->end_handle = val_handle;
+			service_val->uuid = uuid_store(dm, &val_uuid.uuid);
+			if (!service_val->uuid) {
+				return -ENOMEM;
+			}
+
+			dm->discover_params.end_handle = val_handle;
+		} else if (chrc) {
+			struct bt_gatt_chrc *gatt_chrc;
+
+			cur_attr = attr_store(dm, &attr, sizeof(*gatt_chrc));
+			if (!cur_attr) {
+				return -ENOMEM;
+			}
+
+			gatt_chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+			gatt_chrc->value_handle = val_handle;
+			gatt_chrc->properties = properties;
+			gatt_chrc->uuid = uuid_store(dm, &val_uuid.uuid);
+			if (!gatt_chrc->uuid) {
+				return -ENOMEM;
+			}
+		} else if (!attr_store(dm, &attr, 0)) {
+			return -ENOMEM;
+		}
+	}
+
+	return (buf->len == buf->size) ? 0 : -EINVAL;
+}
+
+static int cache_key_prefix_get(char *key, size_t key_size, const bt_addr_le_t *addr)
+{
+	uint8_t val[sizeof(addr->a.val)];
+
+	sys_memcpy_swap(val, addr->a.val, sizeof(val));
+
+	return snprintk(key, key_size, CACHE_SETTINGS_NAME "/%02x%02x%02x%02x%02x%02x%u",
+			val[0], val[1], val[2], val[3], val[4], val[5], addr->type);
+}
+
+static int cache_key_get(struct bt_gatt_dm *dm)
+{
+	struct bt_conn_info info;
+	uint8_t val[BT_UUID_SIZE_128];
+	size_t size = uuid_val_size(dm->svc_uuid.uuid.type);
+	int len;
+
+	if (bt_conn_get_info(dm->conn, &info) || (info.type != BT_CONN_TYPE_LE)) {
+		return -EINVAL;
+	}
+
+	/* Only the database of bonded peers is guaranteed to stay the same
+	 * between connections when the Database Hash does.
+	 */
+	if (!bt_addr_le_is_bonded(info.id, info.le.dst)) {
+		return -ENOENT;
+	}
+
+	len = cache_key_prefix_get(dm->cache_key, sizeof(dm->cache_key), info.le.dst);
+	dm->cache_key[len++] = '/';
+
+	uuid_val_get(&dm->svc_uuid.uuid, val);
+	sys_mem_swap(val, size);
+	bin2hex(val, size, &dm->cache_key[len], sizeof(dm->cache_key) - len);
+
+	return 0;
+}
+
+struct cache_load_ctx {
+	struct bt_gatt_dm *dm;
+	int err;
+};
+
+static int cache_load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			 void *param)
+{
+	struct cache_load_ctx *ctx = param;
+	struct cache_buf buf = {
+		.size = len,
+	};
+
+	/* Only the exact key is of interest */
+	if (key) {
+		return 0;
+	}
+
+	buf.data = k_malloc(len);
+	if (!buf.data) {
+		ctx->err = -ENOMEM;
+		return 0;
+	}
+
+	if (read_cb(cb_arg, buf.data, len) == len) {
+		ctx->err = cache_decode(ctx->dm, &buf);
+	} else {
+		ctx->err = -EIO;
+	}
+
+	k_free(buf.data);
+
+	return 0;
+}
+
+static void cache_load(struct bt_gatt_dm *dm)
+{
+	struct cache_load_ctx ctx = {
+		.dm = dm,
+		.err = -ENOENT,
+	};
+
+	(void)settings_load_subtree_direct(dm->cache_key, cache_load_cb, &ctx);
+
+	dm->cache_loaded = !ctx.err;
+	if (ctx.err) {
+		LOG_DBG("No valid cache entry %s: %d", dm->cache_key, ctx.err);
+		svc_attr_memory_release(dm);
+	}
+}
+
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	struct cache_buf buf = {0};
+	int err;
+
+	/* Get the size first */
+	cache_encode(dm, &buf);
+
+	buf.size = buf.len;
+	buf.len = 0;
+	buf.data = k_malloc(buf.size);
+	if (!buf.data) {
+		LOG_WRN("No memory to cache the service");
+		return;
+	}
+
+	cache_encode(dm, &buf);
+
+	err = settings_save_one(dm->cache_key, buf.data, buf.len);
+	if (err) {
+		LOG_WRN("Failed to cache the service: %d", err);
+	} else {
+		LOG_DBG("Service cached as %s, %zu bytes", dm->cache_key, buf.len);
+	}
+
+	k_free(buf.data);
+}
+
+static void discovery_complete(struct bt_gatt_dm *dm);
+
+static uint8_t db_hash_read_cb(struct bt_conn *conn, uint8_t err,
+			       struct bt_gatt_read_params *params,
+			       const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm, read_params);
+
+	if (!atomic_test_and_clear_bit(dm->state_flags, STATE_HASH_READ_PENDING)) {
+		return BT_GATT_ITER_STOP;
+	}
+
+	if (!err && data && (length == sizeof(dm->db_hash))) {
+		if (dm->cache_loaded && !memcmp(dm->db_hash, data, length)) {
+			LOG_DBG("Database Hash unchanged, using cached service");
+			discovery_complete(dm);
+			return BT_GATT_ITER_STOP;
+		}
+
+		memcpy(dm->db_hash, data, length);
+		dm->cache_save = true;
+	} else {
+		LOG_DBG("Database Hash not available: %u", err);
+	}
+
+	/* Discover the service */
+	svc_attr_memory_release(dm);
+	dm->cache_loaded = false;
+	dm->discover_params.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	dm->discover_params.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
+
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+	k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
+#else
+	k_work_submit(&dm->discover_work);
+#endif
+
+	return BT_GATT_ITER_STOP;
+}
+
+/* Load the cached service and validate it by reading the Database Hash of the peer. */
+static int cache_start(struct bt_gatt_dm *dm)
+{
+	int err;
+
+	dm->cache_loaded = false;
+	dm->cache_save = false;
+
+	err = cache_key_get(dm);
+	if (err) {
+		return err;
+	}
+
+	cache_load(dm);
+
+	dm->read_params.func = db_hash_read_cb;
+	dm->read_params.handle_count = 0;
+	dm->read_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	dm->read_params.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	dm->read_params.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+
+	atomic_set_bit(dm->state_flags, STATE_HASH_READ_PENDING);
+
+	err = bt_gatt_read(dm->conn, &dm->read_params);
+	if (err) {
+		LOG_DBG("Database Hash read failed: %d", err);
+		atomic_clear_bit(dm->state_flags, STATE_HASH_READ_PENDING);
+		svc_attr_memory_release(dm);
+		dm->cache_loaded = false;
+	}
+
+	return err;
+}
+
+static int cache_delete_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			   void *param)
+{
+	char full_key[CACHE_KEY_LEN];
+
+	if (!key) {
+		return 0;
+	}
+
+	snprintk(full_key, sizeof(full_key), "%s/%s", (const char *)param, key);
+	(void)settings_delete(full_key);
+
+	return 0;
+}
+
+static void bond_deleted(uint8_t id, const bt_addr_le_t *peer)
+{
+	char prefix[CACHE_KEY_LEN];
+
+	ARG_UNUSED(id);
+
+	cache_key_prefix_get(prefix, sizeof(prefix), peer);
+	(void)settings_load_subtree_direct(prefix, cache_delete_cb, prefix);
+}
+
+static struct bt_conn_auth_info_cb cache_auth_info_cb = {
+	.bond_deleted = bond_deleted,
+};
+
+static int gatt_dm_cache_init(void)
+{
+	return bt_conn_auth_info_cb_register(&cache_auth_info_cb);
+}
+
+SYS_INIT(gatt_dm_cache_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->cache_save) {
+		dm->cache_save = false;
+		cache_store(dm);
+	}
+#endif
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -661,8 +1200,7 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->context = context;
 	dm->callback = cb;
 	dm->cur_attr_id = 0;
-	sys_slist_init(&dm->chunk_list);
-	dm->cur_chunk_len = 0;
+	user_data_init(dm);
 	dm->search_svc_by_uuid = (svc_uuid != NULL);
 
 	if (svc_uuid) {
@@ -679,6 +1217,12 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (svc_uuid && !cache_start(dm)) {
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -717,6 +1261,10 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	}
 
 	dm->context = context;
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Only the first instance of a service is cached */
+	dm->cache_save = false;
+#endif
 	dm->discover_params.start_handle = dm->discover_params.end_handle + 1;
 	dm->discover_params.end_handle = 0xffff;
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
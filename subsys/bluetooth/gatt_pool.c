@@ -411,6 +411,10 @@ void bt_gatt_pool_free(struct bt_gatt_pool *gp)
 		LOG_ERR("Gatt pool attributes is NULL");
 		return;
 	}
+	if (gp->prebuilt) {
+		/* Nothing was taken from the pools */
+		return;
+	}
 
 	for (size_t n = 0; n < gp->svc.attr_count; ++n) {
 		bt_gatt_pool_attr_free(&gp->svc.attrs[n]);
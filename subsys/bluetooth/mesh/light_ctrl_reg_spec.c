@@ -4,10 +4,140 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <bluetooth/mesh/light_ctrl_reg_spec.h>
 
 #define REG_INT CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_INTERVAL
 
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_SHARED_TICK)
+static sys_slist_t reg_list;
+
+static void reg_tick(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(reg_tick_work, reg_tick);
+#endif
+
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_FIXED_POINT)
+/* Number of fractional bits in the fixed-point regulator values. */
+#define FP_SHIFT 16
+#define FP_ONE   (1LL << FP_SHIFT)
+
+struct reg_terms {
+	int64_t i;
+	int64_t p;
+};
+
+/* The regulator inputs are floating-point values that rarely change, so they are converted
+ * only when their bit pattern differs from the last converted value.
+ */
+static int64_t fixed_get(struct bt_mesh_light_ctrl_reg_spec_fixed *fixed, float value)
+{
+	if (memcmp(&fixed->src, &value, sizeof(value))) {
+		fixed->src = value;
+		fixed->val = (int64_t)(value * (float)FP_ONE);
+	}
+
+	return fixed->val;
+}
+
+static int64_t fp_mul(int64_t a, int64_t b)
+{
+	return (a * b) / FP_ONE;
+}
+
+static int64_t target_get(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	struct bt_mesh_light_ctrl_reg *reg = &spec_reg->reg;
+	int64_t target = fixed_get(&spec_reg->fixed.target, reg->target);
+	int64_t prev_target;
+	int32_t elapsed;
+
+	if (reg->transition_time == 0) {
+		return target;
+	}
+
+	elapsed = k_uptime_get() - reg->transition_start;
+	if (elapsed >= reg->transition_time) {
+		reg->transition_time = 0;
+		return target;
+	}
+
+	prev_target = fixed_get(&spec_reg->fixed.prev_target, reg->prev_target);
+
+	return prev_target + ((elapsed * (target - prev_target)) / reg->transition_time);
+}
+
+static struct reg_terms reg_terms_calc(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	struct bt_mesh_light_ctrl_reg_cfg *cfg = &spec_reg->reg.cfg;
+	int64_t target = target_get(spec_reg);
+	int64_t error = target - fixed_get(&spec_reg->fixed.measured, spec_reg->reg.measured);
+	/* Accuracy should be in percent and both up and down: */
+	int64_t accuracy = fp_mul(fixed_get(&spec_reg->fixed.accuracy, cfg->accuracy), target) /
+			   (2 * 100);
+	int64_t input;
+	int64_t kp, ki;
+
+	if (error > accuracy) {
+		input = error - accuracy;
+	} else if (error < -accuracy) {
+		input = error + accuracy;
+	} else {
+		input = 0;
+	}
+
+	if (input >= 0) {
+		kp = fixed_get(&spec_reg->fixed.kp_up, cfg->kp.up);
+		ki = fixed_get(&spec_reg->fixed.ki_up, cfg->ki.up);
+	} else {
+		kp = fixed_get(&spec_reg->fixed.kp_down, cfg->kp.down);
+		ki = fixed_get(&spec_reg->fixed.ki_down, cfg->ki.down);
+	}
+
+	return (struct reg_terms){
+		.i = (fp_mul(input, ki) * REG_INT) / MSEC_PER_SEC,
+		.p = fp_mul(input, kp),
+	};
+}
+
+static void reg_update(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	struct reg_terms reg_terms;
+
+	reg_terms = reg_terms_calc(spec_reg);
+	spec_reg->i_fixed += reg_terms.i;
+
+	if (spec_reg->i_fixed >= 0) {
+		/* Drop the negative flag as soon as the internal sum becomes positive. */
+		spec_reg->neg = false;
+	}
+
+	if (!spec_reg->neg) {
+		spec_reg->i_fixed = CLAMP(spec_reg->i_fixed, 0, UINT16_MAX * FP_ONE);
+	}
+
+	spec_reg->reg.updated(&spec_reg->reg,
+			      (float)(spec_reg->i_fixed + reg_terms.p) * (1.0f / FP_ONE));
+}
+
+static void internal_sum_recover(struct bt_mesh_light_ctrl_reg_spec *spec_reg, uint16_t lightness)
+{
+	struct reg_terms reg_terms;
+
+	reg_terms = reg_terms_calc(spec_reg);
+
+	/* Recalculate the internal sum so that it is equal to the passed lightness level at the
+	 * next regulator step.
+	 */
+	spec_reg->i_fixed = lightness * FP_ONE - reg_terms.i;
+	/* Allow the internal sum to be negative until it becomes positive. */
+	spec_reg->neg = true;
+}
+
+static void internal_sum_reset(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	spec_reg->i_fixed = 0;
+}
+#else
 struct reg_terms {
 	float i;
 	float p;
@@ -44,20 +174,10 @@ static struct reg_terms reg_terms_calc(struct bt_mesh_light_ctrl_reg_spec *spec_
 	};
 }
 
-static void reg_step(struct k_work *work)
+static void reg_update(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct bt_mesh_light_ctrl_reg_spec *spec_reg = CONTAINER_OF(
-		dwork, struct bt_mesh_light_ctrl_reg_spec, timer);
 	struct reg_terms reg_terms;
 
-	if (!spec_reg->enabled) {
-		/* The regulator might be disabled asynchronously. */
-		return;
-	}
-
-	k_work_reschedule(&spec_reg->timer, K_MSEC(REG_INT));
-
 	reg_terms = reg_terms_calc(spec_reg);
 	spec_reg->i += reg_terms.i;
 
@@ -89,12 +209,84 @@ static void internal_sum_recover(struct bt_mesh_light_ctrl_reg_spec *spec_reg, u
 	spec_reg->neg = true;
 }
 
+static void internal_sum_reset(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	spec_reg->i = 0;
+}
+#endif /* defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_FIXED_POINT) */
+
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_SHARED_TICK)
+static void reg_tick(struct k_work *work)
+{
+	struct bt_mesh_light_ctrl_reg_spec *spec_reg, *tmp;
+
+	if (sys_slist_is_empty(&reg_list)) {
+		return;
+	}
+
+	k_work_reschedule(&reg_tick_work, K_MSEC(REG_INT));
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&reg_list, spec_reg, tmp, node) {
+		reg_update(spec_reg);
+	}
+}
+
+static void reg_schedule(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	if (sys_slist_find(&reg_list, &spec_reg->node, NULL)) {
+		return;
+	}
+
+	/* Regulators started while the tick is running join at its next step. */
+	if (sys_slist_is_empty(&reg_list)) {
+		k_work_schedule(&reg_tick_work, K_MSEC(REG_INT));
+	}
+
+	sys_slist_append(&reg_list, &spec_reg->node);
+}
+
+static void reg_unschedule(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	(void)sys_slist_find_and_remove(&reg_list, &spec_reg->node);
+
+	if (sys_slist_is_empty(&reg_list)) {
+		k_work_cancel_delayable(&reg_tick_work);
+	}
+}
+#else
+static void reg_step(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_mesh_light_ctrl_reg_spec *spec_reg = CONTAINER_OF(
+		dwork, struct bt_mesh_light_ctrl_reg_spec, timer);
+
+	if (!spec_reg->enabled) {
+		/* The regulator might be disabled asynchronously. */
+		return;
+	}
+
+	k_work_reschedule(&spec_reg->timer, K_MSEC(REG_INT));
+
+	reg_update(spec_reg);
+}
+
+static void reg_schedule(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	k_work_schedule(&spec_reg->timer, K_MSEC(REG_INT));
+}
+
+static void reg_unschedule(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
+{
+	k_work_cancel_delayable(&spec_reg->timer);
+}
+#endif /* defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_SHARED_TICK) */
+
 void bt_mesh_light_ctrl_reg_spec_start(struct bt_mesh_light_ctrl_reg *reg, uint16_t lightness)
 {
 	struct bt_mesh_light_ctrl_reg_spec *spec_reg = CONTAINER_OF(
 		reg, struct bt_mesh_light_ctrl_reg_spec, reg);
 	spec_reg->enabled = true;
-	k_work_schedule(&spec_reg->timer, K_MSEC(REG_INT));
+	reg_schedule(spec_reg);
 	internal_sum_recover(spec_reg, lightness);
 }
 
@@ -102,14 +294,18 @@ void bt_mesh_light_ctrl_reg_spec_stop(struct bt_mesh_light_ctrl_reg *reg)
 {
 	struct bt_mesh_light_ctrl_reg_spec *spec_reg = CONTAINER_OF(
 		reg, struct bt_mesh_light_ctrl_reg_spec, reg);
-	spec_reg->i = 0;
+	internal_sum_reset(spec_reg);
 	spec_reg->enabled = false;
-	k_work_cancel_delayable(&spec_reg->timer);
+	reg_unschedule(spec_reg);
 }
 
 void bt_mesh_light_ctrl_reg_spec_init(struct bt_mesh_light_ctrl_reg *reg)
 {
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_SHARED_TICK)
+	ARG_UNUSED(reg);
+#else
 	struct bt_mesh_light_ctrl_reg_spec *spec_reg = CONTAINER_OF(
 		reg, struct bt_mesh_light_ctrl_reg_spec, reg);
 	k_work_init_delayable(&spec_reg->timer, reg_step);
+#endif
 }
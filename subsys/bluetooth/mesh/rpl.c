@@ -22,9 +22,102 @@ static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+#if defined(CONFIG_BT_MESH_RPL_HASH_INDEX)
+/* Open addressing hash table of RPL slot indexes plus one, keyed by the source
+ * address. The table is more than twice the size of the RPL, so it always has
+ * empty buckets and the probe sequences stay short.
+ */
+#define RPL_INDEX_SIZE (2 * CONFIG_BT_MESH_CRPL + 1)
+
+BUILD_ASSERT(CONFIG_BT_MESH_CRPL < UINT16_MAX);
+
+static uint16_t rpl_index[RPL_INDEX_SIZE];
+/* The used RPL slots are always at the start of the list. */
+static uint16_t rpl_count;
+/* The index is rebuilt on the next lookup, for example after the RPL is loaded. */
+static bool rpl_index_valid;
+
+static uint16_t *rpl_index_bucket(uint16_t src)
+{
+	uint32_t i = ((uint32_t)src * 40503U) % RPL_INDEX_SIZE;
+
+	while (rpl_index[i] && replay_list[rpl_index[i] - 1].src != src) {
+		i = (i + 1) % RPL_INDEX_SIZE;
+	}
+
+	return &rpl_index[i];
+}
+
+static void rpl_index_rebuild(void)
+{
+	(void)memset(rpl_index, 0, sizeof(rpl_index));
+
+	for (rpl_count = 0; rpl_count < ARRAY_SIZE(replay_list); rpl_count++) {
+		if (!replay_list[rpl_count].src) {
+			break;
+		}
+
+		*rpl_index_bucket(replay_list[rpl_count].src) = rpl_count + 1;
+	}
+
+	rpl_index_valid = true;
+}
+
+static void rpl_index_update(struct bt_mesh_rpl *rpl, uint16_t old_src)
+{
+	uint16_t slot = rpl - replay_list;
+
+	if (!rpl_index_valid) {
+		return;
+	}
+
+	if (old_src) {
+		/* The slot was given out for another address, which is rare. */
+		rpl_index_rebuild();
+		return;
+	}
+
+	*rpl_index_bucket(rpl->src) = slot + 1;
+	rpl_count = MAX(rpl_count, slot + 1);
+}
+#endif /* CONFIG_BT_MESH_RPL_HASH_INDEX */
+
+/* Returns the RPL slot of the given address, the first empty slot if the
+ * address is not in the RPL, or NULL if the RPL is full.
+ */
+static struct bt_mesh_rpl *rpl_find(uint16_t src)
+{
+#if defined(CONFIG_BT_MESH_RPL_HASH_INDEX)
+	uint16_t *bucket;
+
+	if (!rpl_index_valid) {
+		rpl_index_rebuild();
+	}
+
+	bucket = rpl_index_bucket(src);
+	if (*bucket) {
+		return &replay_list[*bucket - 1];
+	}
+
+	return (rpl_count < ARRAY_SIZE(replay_list)) ? &replay_list[rpl_count] : NULL;
+#else
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		struct bt_mesh_rpl *rpl = &replay_list[i];
+
+		if (!rpl->src || rpl->src == src) {
+			return rpl;
+		}
+	}
+
+	return NULL;
+#endif /* CONFIG_BT_MESH_RPL_HASH_INDEX */
+}
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
+	uint16_t old_src = rpl->src;
+
 	/* If this is the first message on the new IV index, we should reset it
 	 * to zero to avoid invalid combinations of IV index and seg.
 	 */
@@ -35,6 +128,14 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
+
+#if defined(CONFIG_BT_MESH_RPL_HASH_INDEX)
+	if (old_src != rpl->src) {
+		rpl_index_update(rpl, old_src);
+	}
+#else
+	ARG_UNUSED(old_src);
+#endif /* CONFIG_BT_MESH_RPL_HASH_INDEX */
 }
 
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
@@ -45,7 +146,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match, bool bridge)
 {
-	int i;
+	struct bt_mesh_rpl *rpl;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,48 +158,49 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
-
-		/* Empty slot */
-		if (!rpl->src) {
-			if (match) {
-				*match = rpl;
-			} else {
-				bt_mesh_rpl_update(rpl, rx);
-			}
+	rpl = rpl_find(rx->ctx.addr);
+	if (!rpl) {
+		LOG_ERR("RPL is full!");
+		return true;
+	}
 
-			return false;
+	/* Empty slot */
+	if (!rpl->src) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+		return false;
+	}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
+	/* Existing slot for given address */
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
 
-				return false;
-			} else {
-				return true;
-			}
+	if ((!rx->old_iv && rpl->old_iv) ||
+	    rpl->seq < rx->seq) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
+
+		return false;
 	}
 
-	LOG_ERR("RPL is full!");
 	return true;
 }
 
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+
+#if defined(CONFIG_BT_MESH_RPL_HASH_INDEX)
+	rpl_index_valid = false;
+#endif /* CONFIG_BT_MESH_RPL_HASH_INDEX */
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +232,11 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+
+#if defined(CONFIG_BT_MESH_RPL_HASH_INDEX)
+	/* The remaining entries have been moved. */
+	rpl_index_valid = false;
+#endif /* CONFIG_BT_MESH_RPL_HASH_INDEX */
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
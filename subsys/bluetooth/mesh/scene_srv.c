@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/bluetooth/mesh/access.h>
 #include <bluetooth/mesh/models.h>
 #include <zephyr/sys/byteorder.h>
@@ -242,12 +243,15 @@ static int scene_register_status_send(const struct bt_mesh_model *model,
 	BT_MESH_MODEL_BUF_DEFINE(buf, BT_MESH_SCENE_OP_REGISTER_STATUS,
 				 BT_MESH_SCENE_MSG_MINLEN_REGISTER_STATUS +
 					 2 * CONFIG_BT_MESH_SCENES_MAX);
+	uint8_t *scenes;
+
 	bt_mesh_model_msg_init(&buf, BT_MESH_SCENE_OP_REGISTER_STATUS);
 	net_buf_simple_add_u8(&buf, status);
 	net_buf_simple_add_le16(&buf, current_scene(srv));
 
+	scenes = net_buf_simple_add(&buf, srv->count * sizeof(uint16_t));
 	for (int i = 0; i < srv->count; i++) {
-		net_buf_simple_add_le16(&buf, srv->all[i]);
+		sys_put_le16(srv->all[i], &scenes[i * sizeof(uint16_t)]);
 	}
 
 	return bt_mesh_msg_send(model, ctx, &buf);
@@ -343,6 +347,104 @@ static void page_recover(struct bt_mesh_scene_srv *srv, bool vnd,
 	}
 }
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+static struct bt_mesh_scene_cache_entry *cache_find(struct bt_mesh_scene_srv *srv,
+						    uint16_t scene)
+{
+	for (int i = 0; i < ARRAY_SIZE(srv->cache); i++) {
+		if (srv->cache[i].scene == scene) {
+			return &srv->cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/** Take a cache entry to fill with the data of the given scene.
+ *
+ *  If no entry is free, the entries are replaced in turn when @c evict is set.
+ */
+static struct bt_mesh_scene_cache_entry *cache_claim(struct bt_mesh_scene_srv *srv,
+						     uint16_t scene, bool evict)
+{
+	struct bt_mesh_scene_cache_entry *entry = cache_find(srv, scene);
+
+	if (!entry) {
+		entry = cache_find(srv, BT_MESH_SCENE_NONE);
+	}
+
+	if (!entry) {
+		if (!evict) {
+			return NULL;
+		}
+
+		entry = &srv->cache[srv->cache_next];
+		srv->cache_next = (srv->cache_next + 1) % ARRAY_SIZE(srv->cache);
+	}
+
+	entry->scene = scene;
+	entry->sig_len = 0;
+	entry->vnd_len = 0;
+	entry->overflow = false;
+
+	return entry;
+}
+
+static void cache_drop(struct bt_mesh_scene_srv *srv, uint16_t scene)
+{
+	struct bt_mesh_scene_cache_entry *entry = cache_find(srv, scene);
+
+	if (entry) {
+		entry->scene = BT_MESH_SCENE_NONE;
+	}
+}
+
+/** Add a page of scene data to a cache entry.
+ *
+ *  The SIG model data is kept in front of the vendor model data, as the pages
+ *  may come in any order when they are loaded from settings.
+ */
+static void cache_page_add(struct bt_mesh_scene_cache_entry *entry, bool vnd,
+			   const uint8_t buf[], size_t len)
+{
+	if (!entry || entry->overflow) {
+		return;
+	}
+
+	if (entry->sig_len + entry->vnd_len + len > sizeof(entry->data)) {
+		LOG_DBG("Scene 0x%x does not fit in the cache", entry->scene);
+		entry->overflow = true;
+		return;
+	}
+
+	if (vnd) {
+		memcpy(&entry->data[entry->sig_len + entry->vnd_len], buf, len);
+		entry->vnd_len += len;
+	} else {
+		memmove(&entry->data[entry->sig_len + len], &entry->data[entry->sig_len],
+			entry->vnd_len);
+		memcpy(&entry->data[entry->sig_len], buf, len);
+		entry->sig_len += len;
+	}
+}
+
+static bool cache_recall(struct bt_mesh_scene_srv *srv, uint16_t scene)
+{
+	const struct bt_mesh_scene_cache_entry *entry = cache_find(srv, scene);
+
+	if (!entry || entry->overflow) {
+		return false;
+	}
+
+	LOG_DBG("Recalling 0x%x from cache", scene);
+
+	page_recover(srv, false, entry->data, entry->sig_len);
+	page_recover(srv, true, &entry->data[entry->sig_len], entry->vnd_len);
+
+	return true;
+}
+#endif /* CONFIG_BT_MESH_SCENE_SRV_CACHE */
+
 static ssize_t entry_store(const struct bt_mesh_model *mod,
 			   const struct bt_mesh_scene_entry *entry, bool vnd,
 			   uint8_t buf[])
@@ -402,6 +504,10 @@ static void page_store(struct bt_mesh_scene_srv *srv, uint16_t scene,
 	if (err) {
 		LOG_ERR("Failed storing %s: %d", path, err);
 	}
+
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	cache_page_add(srv->cache_fill, vnd, buf, len);
+#endif
 }
 
 /** @brief Get the end of the Scene server's controlled elements.
@@ -544,9 +650,17 @@ static enum bt_mesh_scene_status scene_store(struct bt_mesh_scene_srv *srv,
 		srv->all[srv->count++] = scene;
 	}
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	srv->cache_fill = cache_claim(srv, scene, true);
+#endif
+
 	scene_store_mod(srv, scene, false);
 	scene_store_mod(srv, scene, true);
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	srv->cache_fill = NULL;
+#endif
+
 	srv->prev = scene;
 	srv->next = BT_MESH_SCENE_NONE;
 	/* We're checking srv->next in the handler, so failure to cancel is okay: */
@@ -561,6 +675,10 @@ static void scene_delete(struct bt_mesh_scene_srv *srv, uint16_t *scene)
 
 	LOG_DBG("0x%x", *scene);
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	cache_drop(srv, *scene);
+#endif
+
 	for (int i = 0; i < srv->sigpages; i++) {
 		scene_path(path, *scene, false, i);
 		(void)bt_mesh_model_data_store(srv->model, false, path, NULL, 0);
@@ -768,17 +886,34 @@ static int scene_srv_set(const struct bt_mesh_model *model, const char *path,
 	 * this callback again, but bt_mesh_is_provisioned() will be true.
 	 */
 	if (!bt_mesh_is_provisioned()) {
-		if (scene_find(srv, scene)) {
-			return 0;
+		if (!scene_find(srv, scene)) {
+			if (srv->count == ARRAY_SIZE(srv->all)) {
+				LOG_WRN("No room for scene 0x%x", scene);
+				return 0;
+			}
+
+			LOG_DBG("Recovered scene 0x%x", scene);
+			srv->all[srv->count++] = scene;
 		}
 
-		if (srv->count == ARRAY_SIZE(srv->all)) {
-			LOG_WRN("No room for scene 0x%x", scene);
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+		/* Only fill free entries, as several pages of a scene may be
+		 * loaded after pages of other scenes.
+		 */
+		struct bt_mesh_scene_cache_entry *entry = cache_find(srv, scene);
+
+		if (!entry) {
+			entry = cache_claim(srv, scene, false);
+		}
+
+		size = read_cb(cb_arg, &buf, sizeof(buf));
+		if (size < 0) {
+			cache_drop(srv, scene);
 			return 0;
 		}
 
-		LOG_DBG("Recovered scene 0x%x", scene);
-		srv->all[srv->count++] = scene;
+		cache_page_add(entry, vnd, buf, size);
+#endif
 		return 0;
 	}
 
@@ -790,6 +925,13 @@ static int scene_srv_set(const struct bt_mesh_model *model, const char *path,
 
 	LOG_DBG("0x%x: %s", scene, bt_hex(buf, size));
 	page_recover(srv, vnd, buf, size);
+
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	if (srv->cache_fill && srv->cache_fill->scene == scene) {
+		cache_page_add(srv->cache_fill, vnd, buf, size);
+	}
+#endif
+
 	return 0;
 }
 
@@ -808,6 +950,11 @@ static void scene_srv_reset(const struct bt_mesh_model *model)
 	(void)k_work_cancel_delayable(&srv->work);
 	srv->sigpages = 0;
 	srv->vndpages = 0;
+
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	memset(srv->cache, 0, sizeof(srv->cache));
+	srv->cache_next = 0;
+#endif
 }
 
 const struct bt_mesh_model_cb _bt_mesh_scene_srv_cb = {
@@ -914,12 +1061,29 @@ int bt_mesh_scene_srv_set(struct bt_mesh_scene_srv *srv, uint16_t scene,
 		(void)k_work_cancel_delayable(&srv->work);
 	}
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	if (cache_recall(srv, scene)) {
+		scene_recall_complete(srv);
+		return 0;
+	}
+
+	srv->cache_fill = cache_claim(srv, scene, true);
+#endif
+
 	sprintf(path, "bt/mesh/s/%x/data/%x",
 		(srv->model->rt->elem_idx << 8) | srv->model->rt->mod_idx, scene);
 
 	LOG_DBG("Loading %s", path);
 
 	err = settings_load_subtree(path);
+
+#if defined(CONFIG_BT_MESH_SCENE_SRV_CACHE)
+	srv->cache_fill = NULL;
+	if (err) {
+		cache_drop(srv, scene);
+	}
+#endif
+
 	if (!err) {
 		scene_recall_complete(srv);
 	}
@@ -563,7 +563,31 @@ bool bt_mesh_sensor_value_in_column(const struct bt_mesh_sensor_value *value,
 		return false;
 	}
 
-	/* Fall back to comparing end using float */
+	if (value->format->cb->to_micro && col->start.format->cb->to_micro &&
+	    col->width.format->cb->to_micro) {
+		/* Fall back to comparing end using fixed-point micro values */
+		int64_t width, start, val;
+		enum bt_mesh_sensor_value_status status;
+
+		status = bt_mesh_sensor_value_to_micro(&col->width, &width);
+		if (!bt_mesh_sensor_value_status_is_numeric(status)) {
+			return false;
+		}
+
+		status = bt_mesh_sensor_value_to_micro(&col->start, &start);
+		if (!bt_mesh_sensor_value_status_is_numeric(status)) {
+			return false;
+		}
+
+		status = bt_mesh_sensor_value_to_micro(value, &val);
+		if (!bt_mesh_sensor_value_status_is_numeric(status)) {
+			return false;
+		}
+
+		return val <= (start + width);
+	}
+
+	/* Fall back to comparing end using float for formats without a fixed-point representation */
 	float widthf, startf, valuef;
 	enum bt_mesh_sensor_value_status status;
 
@@ -662,10 +686,30 @@ int bt_mesh_sensor_value_compare(const struct bt_mesh_sensor_value *a,
 		return a->format->cb->compare(a, b);
 	}
 
-	/* Fall back to comparing floats. */
-	float a_float, b_float;
 	enum bt_mesh_sensor_value_status status;
 
+	if (a->format->cb->to_micro && b->format->cb->to_micro) {
+		/* Fall back to comparing fixed-point micro values. */
+		int64_t a_micro, b_micro;
+
+		status = bt_mesh_sensor_value_to_micro(a, &a_micro);
+		if (!bt_mesh_sensor_value_status_is_numeric(status)) {
+			return -1;
+		}
+
+		status = bt_mesh_sensor_value_to_micro(b, &b_micro);
+		if (!bt_mesh_sensor_value_status_is_numeric(status)) {
+			return -1;
+		}
+
+		return a_micro == b_micro ? 0 : (a_micro > b_micro ? 1 : -1);
+	}
+
+	/* Fall back to comparing floats for formats without a fixed-point
+	 * representation.
+	 */
+	float a_float, b_float;
+
 	status = bt_mesh_sensor_value_to_float(a, &a_float);
 	if (!bt_mesh_sensor_value_status_is_numeric(status)) {
 		return -1;
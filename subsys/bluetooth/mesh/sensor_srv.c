@@ -870,6 +870,95 @@ static uint16_t min_int_get(const struct bt_mesh_sensor *sensor,
 	return DIV_ROUND_UP(min_int, pub_int);
 }
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+static void batch_msg_add(struct bt_mesh_sensor_srv *srv,
+			  struct bt_mesh_sensor *s)
+{
+	struct net_buf_simple_state state;
+	int err;
+
+	s->state.batched = false;
+
+	net_buf_simple_save(srv->pub.msg, &state);
+	err = sensor_status_encode(srv->pub.msg, s, s->state.batch);
+	if (err) {
+		LOG_WRN("Batch sensor value encode for 0x%04x: %d", s->type->id, err);
+		net_buf_simple_restore(srv->pub.msg, &state);
+		return;
+	}
+
+	s->state.prev = s->state.batch[0];
+}
+
+static void batch_work_handler(struct k_work *work)
+{
+	struct bt_mesh_sensor_srv *srv = CONTAINER_OF(
+		k_work_delayable_from_work(work), struct bt_mesh_sensor_srv, batch_work);
+	struct bt_mesh_sensor *s;
+	int err;
+
+	bt_mesh_model_msg_init(srv->pub.msg, BT_MESH_SENSOR_OP_STATUS);
+
+	uint32_t original_len = srv->pub.msg->len;
+
+	/* The sensor list is sorted, so the values are encoded in the order
+	 * required for a message with multiple sensor values.
+	 */
+	SENSOR_FOR_EACH(&srv->sensors, s)
+	{
+		if (s->state.batched) {
+			batch_msg_add(srv, s);
+		}
+	}
+
+	if (srv->pub.msg->len == original_len) {
+		/* All values were sent with the periodic publication. */
+		return;
+	}
+
+	err = bt_mesh_model_publish(srv->model);
+	if (err) {
+		LOG_WRN("Batch publish: %d", err);
+	}
+}
+
+static int batch_add(struct bt_mesh_sensor_srv *srv,
+		     struct bt_mesh_sensor *sensor,
+		     const struct bt_mesh_sensor_value *value)
+{
+	NET_BUF_SIMPLE_DEFINE(buf, BT_MESH_SENSOR_STATUS_MAXLEN);
+	int err;
+
+	/* Encode the value once to report errors to the caller right away. */
+	err = sensor_status_encode(&buf, sensor, value);
+	if (err) {
+		return err;
+	}
+
+	if (!bt_mesh_is_provisioned()) {
+		return -EAGAIN;
+	}
+
+	if (srv->model->pub->addr == BT_MESH_ADDR_UNASSIGNED) {
+		return -EADDRNOTAVAIL;
+	}
+
+	memcpy(sensor->state.batch, value,
+	       sensor->type->channel_count * sizeof(sensor->state.batch[0]));
+	sensor->state.batched = true;
+
+	sensor_cadence_update(sensor, value);
+
+	/* The window starts with the first value, and is not extended by the
+	 * values added while it is running.
+	 */
+	k_work_schedule(&srv->batch_work,
+			K_MSEC(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH_WINDOW));
+
+	return 0;
+}
+#endif /* CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH */
+
 /** @brief Conditionally add a sensor value to a publication.
  *
  *  A sensor message will be added to the publication if its minimum interval
@@ -890,6 +979,15 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 	uint16_t delta = srv->seq - s->state.seq;
 	int err;
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+	if (s->state.batched) {
+		/* Align the pending batched publication with this one. */
+		batch_msg_add(srv, s);
+		s->state.seq = srv->seq;
+		return;
+	}
+#endif
+
 	if (delta < min_int) {
 		return;
 	}
@@ -1019,6 +1117,11 @@ static int sensor_srv_init(const struct bt_mesh_model *model)
 	srv->pub.fast_period = true;
 
 	srv->setup_pub.msg = &srv->setup_pub_buf;
+
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+	k_work_init_delayable(&srv->batch_work, batch_work_handler);
+#endif
+
 	net_buf_simple_init_with_data(&srv->pub_buf, srv->pub_data,
 				      sizeof(srv->pub_data));
 	net_buf_simple_init_with_data(&srv->setup_pub_buf, srv->setup_pub_data,
@@ -1034,12 +1137,19 @@ static void sensor_srv_reset(const struct bt_mesh_model *model)
 	net_buf_simple_reset(srv->pub.msg);
 	net_buf_simple_reset(srv->setup_pub.msg);
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+	(void)k_work_cancel_delayable(&srv->batch_work);
+#endif
+
 	for (int i = 0; i < srv->sensor_count; ++i) {
 		struct bt_mesh_sensor *s = srv->sensor_array[i];
 
 		s->state.pub_div = 0;
 		s->state.min_int = 0;
 		s->state.configured = false;
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+		s->state.batched = false;
+#endif
 		memset(&s->state.threshold, 0, sizeof(s->state.threshold));
 	}
 
@@ -1144,6 +1254,12 @@ int bt_mesh_sensor_srv_pub(struct bt_mesh_sensor_srv *srv,
 {
 	int err;
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_BATCH)
+	if (!ctx) {
+		return batch_add(srv, sensor, value);
+	}
+#endif
+
 	BT_MESH_MODEL_BUF_DEFINE(msg, BT_MESH_SENSOR_OP_STATUS,
 				 BT_MESH_SENSOR_STATUS_MAXLEN);
 	bt_mesh_model_msg_init(&msg, BT_MESH_SENSOR_OP_STATUS);
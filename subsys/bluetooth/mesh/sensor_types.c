@@ -6,6 +6,7 @@
 #include <math.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include "sensor.h"
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/toolchain.h>
@@ -344,8 +345,37 @@ static inline float div_scalar_f(float val, const struct scalar_repr *repr)
 	return repr->flags & DIVIDE ? val * repr->value : val / repr->value;
 }
 
+/* Percentage delta triggers have a resolution of 0.01 %. */
+#define PERCENTAGE_DELTA_SCALE 10000
+
 static bool percentage_delta_check(const struct bt_mesh_sensor_value *delta,
-				   float diff, float prev)
+				   uint64_t diff, int64_t prev)
+{
+	__ASSERT_NO_MSG(delta->format == &bt_mesh_sensor_format_percentage_delta_trigger);
+	if (diff == 0) {
+		return false;
+	}
+
+	if (prev == 0) {
+		/* All changes from zero are inf% and should trigger. */
+		return true;
+	}
+
+	int64_t delta_raw;
+
+	if (scalar_decode_raw(delta->format, delta->raw, &delta_raw) != 0) {
+		return false;
+	}
+
+	/* Compare diff / |prev| > delta_raw / 10000 without dividing. Raw
+	 * values are at most 32 bits wide and the delta is 16 bits wide, so
+	 * neither side overflows.
+	 */
+	return diff * PERCENTAGE_DELTA_SCALE > (uint64_t)delta_raw * (uint64_t)llabs(prev);
+}
+
+static bool percentage_delta_check_float(const struct bt_mesh_sensor_value *delta,
+					 float diff, float prev)
 {
 	__ASSERT_NO_MSG(delta->format == &bt_mesh_sensor_format_percentage_delta_trigger);
 	if (diff == 0.0f) {
@@ -363,9 +393,9 @@ static bool percentage_delta_check(const struct bt_mesh_sensor_value *delta,
 		return false;
 	}
 
-	float percentage_float = delta_raw / 10000.0f;
+	float percentage_float = delta_raw / (float)PERCENTAGE_DELTA_SCALE;
 
-	return (diff / prev) > (percentage_float);
+	return (diff / fabsf(prev)) > (percentage_float);
 }
 
 static bool scalar_unknown_raw(const struct bt_mesh_sensor_format *format,
@@ -879,7 +909,7 @@ static bool exp_1_1_delta_check(const struct bt_mesh_sensor_value *current,
 			diff = -diff;
 		}
 
-		return percentage_delta_check(delta, diff, prev_float);
+		return percentage_delta_check_float(delta, diff, prev_float);
 	}
 
 	return exp_1_1_ceil_abs_diff(prev_raw, curr_raw) > *(delta->raw);
@@ -1014,7 +1044,7 @@ static bool float32_delta_check(const struct bt_mesh_sensor_value *current,
 	}
 
 	if (delta->format == &bt_mesh_sensor_format_percentage_delta_trigger) {
-		return percentage_delta_check(delta, diff, prev_float);
+		return percentage_delta_check_float(delta, diff, prev_float);
 	}
 
 	float delta_float;
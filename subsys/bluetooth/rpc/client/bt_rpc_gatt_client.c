@@ -731,6 +731,51 @@ int bt_gatt_service_unregister(struct bt_gatt_service *svc)
 }
 #endif /* defined(CONFIG_BT_GATT_DYNAMIC_DB) */
 
+#if defined(CONFIG_BT_RPC_GATT_ASYNC)
+static K_SEM_DEFINE(gatt_async_credits, CONFIG_BT_RPC_GATT_ASYNC_CREDITS,
+		    CONFIG_BT_RPC_GATT_ASYNC_CREDITS);
+
+static void bt_rpc_gatt_credits_rpc_handler(const struct nrf_rpc_group *group,
+					    struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	uint32_t credits;
+
+	credits = nrf_rpc_decode_uint(ctx);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	while (credits--) {
+		k_sem_give(&gatt_async_credits);
+	}
+
+	return;
+decoding_error:
+	bt_rpc_report_decoding_error(BT_RPC_GATT_CREDITS_RPC_EVT);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_rpc_gatt_credits, BT_RPC_GATT_CREDITS_RPC_EVT,
+			 bt_rpc_gatt_credits_rpc_handler, NULL);
+
+/* Sends the encoded call as an event if a credit is available. Otherwise,
+ * sends it as a command, which also waits until the host catches up.
+ */
+static int gatt_async_send(uint8_t cmd, uint8_t evt, struct nrf_rpc_cbor_ctx *ctx)
+{
+	int result;
+
+	if (k_sem_take(&gatt_async_credits, K_NO_WAIT) == 0) {
+		nrf_rpc_cbor_evt_no_err(&bt_rpc_grp, evt, ctx);
+		return 0;
+	}
+
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, cmd, ctx, nrf_rpc_rsp_decode_i32, &result);
+
+	return result;
+}
+#endif /* defined(CONFIG_BT_RPC_GATT_ASYNC) */
+
 static size_t bt_gatt_notify_params_buf_size(const struct bt_gatt_notify_params *data)
 {
 	size_t buffer_size_max = 23;
@@ -787,8 +832,12 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	bt_rpc_encode_bt_conn(&ctx, conn);
 	bt_gatt_notify_params_enc(&ctx, params);
 
+#if defined(CONFIG_BT_RPC_GATT_ASYNC)
+	result = gatt_async_send(BT_GATT_NOTIFY_CB_RPC_CMD, BT_GATT_NOTIFY_CB_RPC_EVT, &ctx);
+#else
 	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_GATT_NOTIFY_CB_RPC_CMD,
 		&ctx, nrf_rpc_rsp_decode_i32, &result);
+#endif /* defined(CONFIG_BT_RPC_GATT_ASYNC) */
 
 	return result;
 }
@@ -1436,8 +1485,13 @@ int bt_gatt_write_without_response_cb(struct bt_conn *conn, uint16_t handle,
 	nrf_rpc_encode_callback(&ctx, func);
 	nrf_rpc_encode_uint(&ctx, (uintptr_t)user_data);
 
+#if defined(CONFIG_BT_RPC_GATT_ASYNC)
+	result = gatt_async_send(BT_GATT_WRITE_WITHOUT_RESPONSE_CB_RPC_CMD,
+				 BT_GATT_WRITE_WITHOUT_RESPONSE_CB_RPC_EVT, &ctx);
+#else
 	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_GATT_WRITE_WITHOUT_RESPONSE_CB_RPC_CMD,
 		&ctx, nrf_rpc_rsp_decode_i32, &result);
+#endif /* defined(CONFIG_BT_RPC_GATT_ASYNC) */
 
 	return result;
 }
@@ -1567,6 +1621,33 @@ int bt_rpc_gatt_subscribe_flag_get(struct bt_gatt_subscribe_params *params, uint
 	return bt_rpc_gatt_subscribe_flag_update(params, flags_bit, -1);
 }
 
+#if defined(CONFIG_BT_RPC_GATT_MIRROR)
+int bt_rpc_gatt_attr_value_mirror(const struct bt_gatt_attr *attr, const void *value,
+				  uint16_t len)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	int result;
+	size_t scratchpad_size = 0;
+	size_t buffer_size_max = 13;
+
+	if (value) {
+		buffer_size_max += len;
+		scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(len);
+	}
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+	nrf_rpc_encode_uint(&ctx, scratchpad_size);
+
+	bt_rpc_encode_gatt_attr(&ctx, attr);
+	nrf_rpc_encode_buffer(&ctx, value, len);
+
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_RPC_GATT_ATTR_VALUE_MIRROR_RPC_CMD,
+		&ctx, nrf_rpc_rsp_decode_i32, &result);
+
+	return result;
+}
+#endif /* defined(CONFIG_BT_RPC_GATT_MIRROR) */
+
 static void bt_gatt_subscribe_params_notify_rpc_handler(const struct nrf_rpc_group *group,
 							struct nrf_rpc_cbor_ctx *ctx,
 							void *handler_data)
@@ -205,8 +205,8 @@ static const CHECK_LIST_ENTRY_TYPE check_table[] = {
 		CONFIG_BT_GATT_CLIENT,
 		CONFIG_BT_RPC_INTERNAL_FUNCTIONS,
 		CONFIG_BT_DEVICE_APPEARANCE_DYNAMIC,
-		0,
-		0,
+		CONFIG_BT_RPC_GATT_ASYNC,
+		CONFIG_BT_RPC_GATT_MIRROR,
 		0,
 		0),
 	CHECK_UINT8(CONFIG_BT_MAX_CONN),
@@ -87,6 +87,17 @@ static struct net_buf_simple gatt_buffer = {.data = (uint8_t *)gatt_buffer_data,
 
 static struct remote_svc current_service;
 
+#if defined(CONFIG_BT_RPC_GATT_MIRROR)
+struct attr_mirror {
+	const struct bt_gatt_attr *attr;
+	uint16_t len;
+	uint8_t value[CONFIG_BT_RPC_GATT_MIRROR_VALUE_MAX];
+};
+
+static struct attr_mirror attr_mirrors[CONFIG_BT_RPC_GATT_MIRROR_COUNT];
+static struct k_spinlock attr_mirror_lock;
+#endif /* defined(CONFIG_BT_RPC_GATT_MIRROR) */
+
 static inline void *bt_rpc_gatt_add(struct net_buf_simple *buf, size_t size)
 {
 	return net_buf_simple_add(buf, WB_UP(size));
@@ -258,6 +269,92 @@ static void bt_normal_attr_read_rsp(const struct nrf_rpc_group *group, struct nr
 	nrf_rpc_decode_buffer(ctx, res->buf, (res->read_len > 0) ? res->read_len : 0);
 }
 
+#if defined(CONFIG_BT_RPC_GATT_MIRROR)
+static struct attr_mirror *attr_mirror_find(const struct bt_gatt_attr *attr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(attr_mirrors); i++) {
+		if (attr_mirrors[i].attr == attr) {
+			return &attr_mirrors[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int attr_mirror_set(const struct bt_gatt_attr *attr, const uint8_t *value, size_t len)
+{
+	struct attr_mirror *mirror;
+	k_spinlock_key_t key;
+
+	if (value && (len > CONFIG_BT_RPC_GATT_MIRROR_VALUE_MAX)) {
+		return -EMSGSIZE;
+	}
+
+	key = k_spin_lock(&attr_mirror_lock);
+
+	mirror = attr_mirror_find(attr);
+
+	if (!value) {
+		if (mirror) {
+			mirror->attr = NULL;
+		}
+	} else {
+		if (!mirror) {
+			mirror = attr_mirror_find(NULL);
+		}
+
+		if (mirror) {
+			memcpy(mirror->value, value, len);
+			mirror->len = len;
+			mirror->attr = attr;
+		}
+	}
+
+	k_spin_unlock(&attr_mirror_lock, key);
+
+	return (value && !mirror) ? -ENOMEM : 0;
+}
+
+static bool attr_mirror_read(const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+			     uint16_t offset, ssize_t *read_len)
+{
+	struct attr_mirror *mirror;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&attr_mirror_lock);
+
+	mirror = attr_mirror_find(attr);
+	if (mirror) {
+		if (offset > mirror->len) {
+			*read_len = BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+		} else {
+			*read_len = MIN(len, mirror->len - offset);
+			memcpy(buf, &mirror->value[offset], *read_len);
+		}
+	}
+
+	k_spin_unlock(&attr_mirror_lock, key);
+
+	return mirror != NULL;
+}
+
+static void attr_mirror_service_remove(const struct bt_gatt_service *svc)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&attr_mirror_lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(attr_mirrors); i++) {
+		if ((attr_mirrors[i].attr >= svc->attrs) &&
+		    (attr_mirrors[i].attr < &svc->attrs[svc->attr_count])) {
+			attr_mirrors[i].attr = NULL;
+		}
+	}
+
+	k_spin_unlock(&attr_mirror_lock, key);
+}
+#endif /* defined(CONFIG_BT_RPC_GATT_MIRROR) */
+
 static ssize_t bt_rpc_normal_attr_read(struct bt_conn *conn, const struct bt_gatt_attr *attr,
 				       void *buf, uint16_t len, uint16_t offset)
 {
@@ -266,6 +363,13 @@ static ssize_t bt_rpc_normal_attr_read(struct bt_conn *conn, const struct bt_gat
 	size_t buffer_size_max = 19;
 	size_t scratchpad_size = 0;
 	uint8_t read_buf[len];
+#if defined(CONFIG_BT_RPC_GATT_MIRROR)
+	ssize_t read_len;
+
+	if (attr_mirror_read(attr, buf, len, offset, &read_len)) {
+		return read_len;
+	}
+#endif /* defined(CONFIG_BT_RPC_GATT_MIRROR) */
 
 	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
 
@@ -730,6 +834,9 @@ static void bt_rpc_gatt_service_unregister_rpc_handler(const struct nrf_rpc_grou
 	}
 
 	if (!result) {
+#if defined(CONFIG_BT_RPC_GATT_MIRROR)
+		attr_mirror_service_remove(svc);
+#endif /* defined(CONFIG_BT_RPC_GATT_MIRROR) */
 		result = bt_rpc_gatt_remove_service(svc);
 	}
 
@@ -819,6 +926,54 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_cb, BT_GATT_NOTIFY_CB_RPC_CMD,
 			 bt_gatt_notify_cb_rpc_handler, NULL);
 
+#if defined(CONFIG_BT_RPC_GATT_ASYNC)
+/* Returns the credit of a pipelined call to the client. */
+static void gatt_async_credit_give(void)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t buffer_size_max = 5;
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+
+	nrf_rpc_encode_uint(&ctx, 1);
+
+	nrf_rpc_cbor_evt_no_err(&bt_rpc_grp, BT_RPC_GATT_CREDITS_RPC_EVT, &ctx);
+}
+
+static void bt_gatt_notify_cb_rpc_evt_handler(const struct nrf_rpc_group *group,
+					      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct bt_conn *conn;
+	struct bt_gatt_notify_params params;
+	int result;
+	struct nrf_rpc_scratchpad scratchpad;
+
+	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, ctx);
+
+	conn = bt_rpc_decode_bt_conn(ctx);
+	bt_gatt_notify_params_dec(&scratchpad, &params);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	result = bt_gatt_notify_cb(conn, &params);
+	if (result) {
+		LOG_WRN("Pipelined notification failed (err %d)", result);
+	}
+
+	gatt_async_credit_give();
+
+	return;
+decoding_error:
+	gatt_async_credit_give();
+	bt_rpc_report_decoding_error(BT_GATT_NOTIFY_CB_RPC_EVT);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_gatt_notify_cb_evt, BT_GATT_NOTIFY_CB_RPC_EVT,
+			 bt_gatt_notify_cb_rpc_evt_handler, NULL);
+#endif /* defined(CONFIG_BT_RPC_GATT_ASYNC) */
+
 static void bt_gatt_indicate_params_dec(struct nrf_rpc_scratchpad *scratchpad,
 					struct bt_gatt_indicate_params *data)
 {
@@ -1410,6 +1565,55 @@ NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_write_without_response_cb,
 			 BT_GATT_WRITE_WITHOUT_RESPONSE_CB_RPC_CMD,
 			 bt_gatt_write_without_response_cb_rpc_handler, NULL);
 
+#if defined(CONFIG_BT_RPC_GATT_ASYNC)
+static void bt_gatt_write_without_response_cb_rpc_evt_handler(const struct nrf_rpc_group *group,
+							      struct nrf_rpc_cbor_ctx *ctx,
+							      void *handler_data)
+{
+	struct bt_conn *conn;
+	uint16_t handle;
+	uint16_t length;
+	uint8_t *data;
+	bool sign;
+	bt_gatt_complete_func_t func;
+	void *user_data;
+	int result;
+	struct nrf_rpc_scratchpad scratchpad;
+
+	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, ctx);
+
+	conn = bt_rpc_decode_bt_conn(ctx);
+	handle = nrf_rpc_decode_uint(ctx);
+	length = nrf_rpc_decode_uint(ctx);
+	data = nrf_rpc_decode_buffer_into_scratchpad(&scratchpad, NULL);
+	sign = nrf_rpc_decode_bool(ctx);
+	func = (bt_gatt_complete_func_t)nrf_rpc_decode_callbackd(ctx,
+								 bt_gatt_complete_func_t_encoder);
+	user_data = (void *)nrf_rpc_decode_uint(ctx);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	result = bt_gatt_write_without_response_cb(conn, handle, data, length, sign, func,
+						   user_data);
+	if (result) {
+		LOG_WRN("Pipelined write without response failed (err %d)", result);
+	}
+
+	gatt_async_credit_give();
+
+	return;
+decoding_error:
+	gatt_async_credit_give();
+	bt_rpc_report_decoding_error(BT_GATT_WRITE_WITHOUT_RESPONSE_CB_RPC_EVT);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_gatt_write_without_response_cb_evt,
+			 BT_GATT_WRITE_WITHOUT_RESPONSE_CB_RPC_EVT,
+			 bt_gatt_write_without_response_cb_rpc_evt_handler, NULL);
+#endif /* defined(CONFIG_BT_RPC_GATT_ASYNC) */
+
 static struct bt_gatt_subscribe_container *get_subscribe_container(uintptr_t remote_pointer,
 								   bool *create)
 {
@@ -1716,6 +1920,44 @@ NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_subscribe_flag_update,
 			 BT_RPC_GATT_SUBSCRIBE_FLAG_UPDATE_RPC_CMD,
 			 bt_rpc_gatt_subscribe_flag_update_rpc_handler, NULL);
 
+#if defined(CONFIG_BT_RPC_GATT_MIRROR)
+static void bt_rpc_gatt_attr_value_mirror_rpc_handler(const struct nrf_rpc_group *group,
+						      struct nrf_rpc_cbor_ctx *ctx,
+						      void *handler_data)
+{
+	const struct bt_gatt_attr *attr;
+	uint8_t *value;
+	size_t len = 0;
+	int result;
+	struct nrf_rpc_scratchpad scratchpad;
+
+	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, ctx);
+
+	attr = bt_rpc_decode_gatt_attr(ctx);
+	value = nrf_rpc_decode_buffer_into_scratchpad(&scratchpad, &len);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	if (!attr || (attr->read != bt_rpc_normal_attr_read)) {
+		result = -EINVAL;
+	} else {
+		result = attr_mirror_set(attr, value, len);
+	}
+
+	nrf_rpc_rsp_send_int(group, result);
+
+	return;
+decoding_error:
+	bt_rpc_report_decoding_error(BT_RPC_GATT_ATTR_VALUE_MIRROR_RPC_CMD);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_attr_value_mirror,
+			 BT_RPC_GATT_ATTR_VALUE_MIRROR_RPC_CMD,
+			 bt_rpc_gatt_attr_value_mirror_rpc_handler, NULL);
+#endif /* defined(CONFIG_BT_RPC_GATT_MIRROR) */
+
 int bt_rpc_gatt_subscribe_flag_set(struct bt_gatt_subscribe_params *params, uint32_t flags_bit)
 {
 	atomic_set_bit(params->flags, flags_bit);
@@ -14,6 +14,11 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 
 #define BT_SCAN_UUID_128_SIZE 16
 
+/* Number of slots in the hash table of an address list. Slots hold the list
+ * index plus one, so that zero marks an empty slot.
+ */
+#define ADDR_HASH_SIZE(_cnt) (2 * (_cnt) + 1)
+
 #define MODE_CHECK (BT_SCAN_NAME_FILTER | BT_SCAN_ADDR_FILTER | \
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
@@ -89,8 +94,13 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+	/* Hash table of the addresses. */
+	uint16_t hash[ADDR_HASH_SIZE(CONFIG_BT_SCAN_ADDRESS_CNT)];
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
+
 	/* Address filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -225,6 +235,11 @@ struct conn_blocklist {
 	/* Array of the blocklist devices. */
 	bt_addr_le_t addr[CONFIG_BT_SCAN_BLOCKLIST_LEN];
 
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+	/* Hash table of the blocklist devices. */
+	uint16_t hash[ADDR_HASH_SIZE(CONFIG_BT_SCAN_BLOCKLIST_LEN)];
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
+
 	/* Blocklist device count. */
 	uint32_t count;
 };
@@ -280,6 +295,78 @@ static struct bt_scan {
 
 static sys_slist_t callback_list;
 
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+BUILD_ASSERT(CONFIG_BT_SCAN_ADDRESS_CNT < UINT16_MAX, "Too many address filters");
+#if CONFIG_BT_SCAN_BLOCKLIST
+BUILD_ASSERT(CONFIG_BT_SCAN_BLOCKLIST_LEN < UINT16_MAX, "Blocklist is too long");
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+
+/* FNV-1a hash of the address type and value. */
+static uint32_t addr_hash(const bt_addr_le_t *addr)
+{
+	uint32_t hash = 2166136261U;
+
+	hash = (hash ^ addr->type) * 16777619U;
+
+	for (size_t i = 0; i < sizeof(addr->a.val); i++) {
+		hash = (hash ^ addr->a.val[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static void addr_hash_add(uint16_t *hash, size_t hash_size,
+			  const bt_addr_le_t *list, uint16_t idx)
+{
+	size_t slot = addr_hash(&list[idx]) % hash_size;
+
+	/* The table has more slots than the list has entries,
+	 * so an empty slot is always found.
+	 */
+	while (hash[slot]) {
+		slot = (slot + 1) % hash_size;
+	}
+
+	hash[slot] = idx + 1;
+}
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
+
+/* Find an address in an address list, using its hash table if enabled.
+ * Returns the index of the address or -ENOENT if it is not on the list.
+ */
+static int addr_list_find(const bt_addr_le_t *list, size_t cnt,
+			  const uint16_t *hash, size_t hash_size,
+			  const bt_addr_le_t *addr)
+{
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+	ARG_UNUSED(cnt);
+
+	for (size_t slot = addr_hash(addr) % hash_size; hash[slot];
+	     slot = (slot + 1) % hash_size) {
+		if (bt_addr_le_cmp(&list[hash[slot] - 1], addr) == 0) {
+			return hash[slot] - 1;
+		}
+	}
+#else
+	ARG_UNUSED(hash);
+	ARG_UNUSED(hash_size);
+
+	for (size_t i = 0; i < cnt; i++) {
+		if (bt_addr_le_cmp(&list[i], addr) == 0) {
+			return i;
+		}
+	}
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
+
+	return -ENOENT;
+}
+
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+#define ADDR_LIST_HASH(_list) (_list).hash, ARRAY_SIZE((_list).hash)
+#else
+#define ADDR_LIST_HASH(_list) NULL, 0
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
+
 void bt_scan_cb_register(struct bt_scan_cb *cb)
 {
 	if (!cb) {
@@ -343,17 +430,12 @@ static void notify_connecting_error(struct bt_scan_device_info *device_info)
 #if CONFIG_BT_SCAN_BLOCKLIST
 static bool blocklist_device_check(const bt_addr_le_t *addr)
 {
-	bool blocklist_device = false;
+	bool blocklist_device;
 
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
-	for (size_t i = 0; i < bt_scan.blocklist.count; i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			blocklist_device = true;
-
-			break;
-		}
-	}
+	blocklist_device = addr_list_find(bt_scan.blocklist.addr, bt_scan.blocklist.count,
+					  ADDR_LIST_HASH(bt_scan.blocklist), addr) >= 0;
 
 	k_mutex_unlock(&scan_mutex);
 
@@ -522,19 +604,17 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
-	const bt_addr_le_t *addr =
-			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
-
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
+	const struct bt_scan_addr_filter *addr_filter = &bt_scan.scan_filters.addr;
+	int i = addr_list_find(addr_filter->target_addr, addr_filter->cnt,
+			       ADDR_LIST_HASH(*addr_filter), target_addr);
 
-			return true;
-		}
+	if (i < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.addr.addr = &addr_filter->target_addr[i];
+
+	return true;
 }
 
 static bool is_addr_filter_enabled(void)
@@ -561,7 +641,7 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	char addr[BT_ADDR_LE_STR_LEN];
 	bt_addr_le_t *addr_filter =
 			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	uint16_t counter = bt_scan.scan_filters.addr.cnt;
 
 	/* If no memory for filter. */
 	if (counter >= CONFIG_BT_SCAN_ADDRESS_CNT) {
@@ -569,15 +649,18 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
-			return 0;
-		}
+	if (addr_list_find(addr_filter, counter, ADDR_LIST_HASH(bt_scan.scan_filters.addr),
+			   target_addr) >= 0) {
+		return 0;
 	}
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
 
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+	addr_hash_add(ADDR_LIST_HASH(bt_scan.scan_filters.addr), addr_filter, counter);
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
+
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
 
@@ -1242,6 +1325,9 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+	memset(addr_filter->hash, 0, sizeof(addr_filter->hash));
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
@@ -1633,13 +1719,12 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if the device is already on the blocklist. */
-	for (size_t i = 0; i < ARRAY_SIZE(bt_scan.blocklist.addr); i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			LOG_DBG("Device %s is already on the blocklist",
-				addr_str);
+	if (addr_list_find(bt_scan.blocklist.addr, bt_scan.blocklist.count,
+			   ADDR_LIST_HASH(bt_scan.blocklist), addr) >= 0) {
+		LOG_DBG("Device %s is already on the blocklist",
+			addr_str);
 
-			goto out;
-		}
+		goto out;
 	}
 
 	if (bt_scan.blocklist.count >= ARRAY_SIZE(bt_scan.blocklist.addr)) {
@@ -1648,6 +1733,10 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 	} else {
 		bt_addr_le_copy(&bt_scan.blocklist.addr[bt_scan.blocklist.count],
 				addr);
+#if CONFIG_BT_SCAN_ADDRESS_HASH
+		addr_hash_add(ADDR_LIST_HASH(bt_scan.blocklist), bt_scan.blocklist.addr,
+			      bt_scan.blocklist.count);
+#endif /* CONFIG_BT_SCAN_ADDRESS_HASH */
 		bt_scan.blocklist.count++;
 		LOG_INF("Device %s added to the scanning blocklist", addr_str);
 	}
@@ -164,6 +164,17 @@ int bt_hids_connected(struct bt_hids *hids_obj, struct bt_conn *conn)
 	conn_data->sci_mode = BT_HIDS_SCI_MODE_NONE;
 #endif
 
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	/* Assign coalesced input report context. */
+	conn_data->inp_rep_coalesce_ctx = conn_data->feat_rep_ctx;
+	cnt = MIN(hids_obj->feat_rep_group.cnt, ARRAY_SIZE(hids_obj->feat_rep_group.reports));
+
+	for (size_t i = 0; i < cnt; i++) {
+		conn_data->inp_rep_coalesce_ctx +=
+		    hids_obj->feat_rep_group.reports[i].size;
+	}
+#endif
+
 	bt_conn_ctx_release(hids_obj->conn_ctx, (void *)conn_data);
 
 	return 0;
@@ -1565,6 +1576,188 @@ static int inp_rep_notify_all(struct bt_hids *hids_obj,
 	}
 }
 
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+static int32_t rel_field_get(const uint8_t *rep, uint8_t len,
+			     const struct bt_hids_rel_field *field)
+{
+	uint32_t val = 0;
+	size_t byte = field->offset / 8;
+
+	for (size_t i = 0; (i < 3) && (byte + i < len); i++) {
+		val |= (uint32_t)rep[byte + i] << (8 * i);
+	}
+
+	val >>= field->offset % 8;
+	val &= BIT_MASK(field->size);
+
+	/* Sign extend */
+	if (val & BIT(field->size - 1)) {
+		val |= ~BIT_MASK(field->size);
+	}
+
+	return (int32_t)val;
+}
+
+static void rel_field_set(uint8_t *rep, uint8_t len,
+			  const struct bt_hids_rel_field *field, int32_t val)
+{
+	const int32_t max = BIT(field->size - 1) - 1;
+	const int32_t min = -max - 1;
+	size_t byte = field->offset / 8;
+	uint32_t mask;
+	uint32_t bits;
+
+	val = CLAMP(val, min, max);
+
+	mask = BIT_MASK(field->size) << (field->offset % 8);
+	bits = ((uint32_t)val << (field->offset % 8)) & mask;
+
+	for (size_t i = 0; (i < 3) && (byte + i < len); i++) {
+		rep[byte + i] = (rep[byte + i] & ~(mask >> (8 * i))) | (bits >> (8 * i));
+	}
+}
+
+static uint8_t rel_field_byte_mask(const struct bt_hids_rel_field *field, size_t byte)
+{
+	size_t lo = MAX(field->offset, 8 * byte);
+	size_t hi = MIN(field->offset + field->size, 8 * (byte + 1));
+
+	if (lo >= hi) {
+		return 0;
+	}
+
+	return BIT_MASK(hi - lo) << (lo - 8 * byte);
+}
+
+static void inp_rep_coalesce(const struct bt_hids_inp_rep *hids_inp_rep,
+			     uint8_t *coalesced, uint8_t const *rep)
+{
+	for (size_t i = 0; i < hids_inp_rep->rel_field_cnt; i++) {
+		const struct bt_hids_rel_field *field = &hids_inp_rep->rel_fields[i];
+		int32_t sum;
+
+		sum = rel_field_get(coalesced, hids_inp_rep->size, field) +
+		      rel_field_get(rep, hids_inp_rep->size, field);
+		rel_field_set(coalesced, hids_inp_rep->size, field, sum);
+	}
+
+	/* The other fields take the latest value */
+	for (size_t byte = 0; byte < hids_inp_rep->size; byte++) {
+		uint8_t rel_mask = 0;
+
+		for (size_t i = 0; i < hids_inp_rep->rel_field_cnt; i++) {
+			rel_mask |= rel_field_byte_mask(&hids_inp_rep->rel_fields[i], byte);
+		}
+
+		coalesced[byte] = (coalesced[byte] & rel_mask) | (rep[byte] & ~rel_mask);
+	}
+}
+
+static void inp_rep_coalesce_sent(struct bt_conn *conn, void *user_data)
+{
+	struct bt_hids_inp_rep *hids_inp_rep = user_data;
+	struct bt_hids *hids_obj = CONTAINER_OF(hids_inp_rep - hids_inp_rep->idx,
+						struct bt_hids, inp_rep_group.reports[0]);
+	struct bt_hids_conn_data *conn_data;
+	bt_gatt_complete_func_t cb;
+	void *cb_user_data;
+	uint16_t rep_bit = BIT(hids_inp_rep->idx);
+
+	conn_data = bt_conn_ctx_get(hids_obj->conn_ctx, conn);
+	if (!conn_data) {
+		/* Disconnected */
+		return;
+	}
+
+	cb = conn_data->inp_rep_pending_cb[hids_inp_rep->idx];
+	cb_user_data = conn_data->inp_rep_pending_user_data[hids_inp_rep->idx];
+	conn_data->inp_rep_pending &= ~rep_bit;
+
+	if (conn_data->inp_rep_coalesced & rep_bit) {
+		struct bt_gatt_notify_params params = {
+			.attr = &hids_obj->gp.svc.attrs[hids_inp_rep->att_ind],
+			.data = conn_data->inp_rep_coalesce_ctx + hids_inp_rep->offset,
+			.len = hids_inp_rep->size,
+			.func = inp_rep_coalesce_sent,
+			.user_data = hids_inp_rep,
+		};
+		int err;
+
+		conn_data->inp_rep_pending_cb[hids_inp_rep->idx] =
+			conn_data->inp_rep_coalesced_cb[hids_inp_rep->idx];
+		conn_data->inp_rep_pending_user_data[hids_inp_rep->idx] =
+			conn_data->inp_rep_coalesced_user_data[hids_inp_rep->idx];
+
+		/* The data is copied, so the coalesced report can be reused */
+		err = bt_gatt_notify_cb(conn, &params);
+		if (err) {
+			/* Keep the report, it is sent together with the next one */
+			LOG_WRN("Failed to send coalesced report: %d", err);
+		} else {
+			conn_data->inp_rep_coalesced &= ~rep_bit;
+			conn_data->inp_rep_pending |= rep_bit;
+		}
+	}
+
+	bt_conn_ctx_release(hids_obj->conn_ctx, (void *)conn_data);
+
+	if (cb) {
+		cb(conn, cb_user_data);
+	}
+}
+
+static int inp_rep_coalesce_send(struct bt_hids *hids_obj,
+				 struct bt_hids_conn_data *conn_data,
+				 struct bt_conn *conn,
+				 struct bt_hids_inp_rep *hids_inp_rep,
+				 uint8_t const *rep,
+				 bt_gatt_complete_func_t cb, void *userdata)
+{
+	uint8_t *coalesced = conn_data->inp_rep_coalesce_ctx + hids_inp_rep->offset;
+	uint16_t rep_bit = BIT(hids_inp_rep->idx);
+	int err;
+
+	if (conn_data->inp_rep_pending & rep_bit) {
+		if (conn_data->inp_rep_coalesced & rep_bit) {
+			inp_rep_coalesce(hids_inp_rep, coalesced, rep);
+		} else {
+			memcpy(coalesced, rep, hids_inp_rep->size);
+			conn_data->inp_rep_coalesced |= rep_bit;
+		}
+
+		conn_data->inp_rep_coalesced_cb[hids_inp_rep->idx] = cb;
+		conn_data->inp_rep_coalesced_user_data[hids_inp_rep->idx] = userdata;
+
+		return 0;
+	}
+
+	struct bt_gatt_notify_params params = {
+		.attr = &hids_obj->gp.svc.attrs[hids_inp_rep->att_ind],
+		.data = rep,
+		.len = hids_inp_rep->size,
+		.func = inp_rep_coalesce_sent,
+		.user_data = hids_inp_rep,
+	};
+
+	if (conn_data->inp_rep_coalesced & rep_bit) {
+		/* A previous attempt to send the coalesced report failed */
+		inp_rep_coalesce(hids_inp_rep, coalesced, rep);
+		params.data = coalesced;
+	}
+
+	conn_data->inp_rep_pending_cb[hids_inp_rep->idx] = cb;
+	conn_data->inp_rep_pending_user_data[hids_inp_rep->idx] = userdata;
+
+	err = bt_gatt_notify_cb(conn, &params);
+	if (!err) {
+		conn_data->inp_rep_coalesced &= ~rep_bit;
+		conn_data->inp_rep_pending |= rep_bit;
+	}
+
+	return err;
+}
+#endif /* CONFIG_BT_HIDS_INP_REP_COALESCE */
+
 int bt_hids_inp_rep_send_userdata(struct bt_hids *hids_obj,
 				  struct bt_conn *conn, uint8_t rep_index,
 				  uint8_t const *rep, uint8_t len,
@@ -1600,6 +1793,17 @@ int bt_hids_inp_rep_send_userdata(struct bt_hids *hids_obj,
 
 	store_input_report(hids_inp_rep, rep_data, rep, len);
 
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	if (hids_inp_rep->rel_fields) {
+		int err = inp_rep_coalesce_send(hids_obj, conn_data, conn, hids_inp_rep,
+						rep, cb, userdata);
+
+		bt_conn_ctx_release(hids_obj->conn_ctx, (void *)conn_data);
+
+		return err;
+	}
+#endif
+
 	struct bt_gatt_notify_params params = {0};
 
 	params.attr = &hids_obj->gp.svc.attrs[hids_inp_rep->att_ind];
@@ -504,28 +504,34 @@ static int pm_read_start(struct bt_hogp *hogp)
 	return 0;
 }
 
-static uint8_t pm_read_process(struct bt_conn *conn, uint8_t err,
-			    struct bt_gatt_read_params *params,
-			    const void *data, uint16_t length)
+/**
+ * @brief Parse protocol mode value
+ *
+ * @param hogp   HOGP object.
+ * @param data   Pointer to the value.
+ * @param length The size of the value.
+ *
+ * @return 0 or negative error value.
+ */
+static int pm_parse(struct bt_hogp *hogp, const void *data, uint16_t length)
 {
-	struct bt_hogp *hogp;
-
-	hogp = CONTAINER_OF(params, struct bt_hogp, read_params);
-
-	if (err) {
-		LOG_ERR("PM read error");
-		hids_prep_error(hogp, err);
-		return BT_GATT_ITER_STOP;
-	}
 	if (length != 1 || !data) {
 		LOG_ERR("Unexpected PM size");
-		hids_prep_error(hogp, -ENOTSUP);
-		return BT_GATT_ITER_STOP;
+		return -ENOTSUP;
 	}
 
 	hogp->pm = (enum bt_hids_pm)((uint8_t *)data)[0];
 	LOG_DBG("Read PM success: %d", (int)hogp->pm);
+	return 0;
+}
 
+/**
+ * @brief Finish the preparation after the protocol mode is read
+ *
+ * @param hogp HOGP object.
+ */
+static void pm_read_done(struct bt_hogp *hogp)
+{
 #if defined(CONFIG_BT_HOGP_SCI)
 	if (hogp->handlers.sci_info != 0) {
 		int err;
@@ -535,13 +541,37 @@ static uint8_t pm_read_process(struct bt_conn *conn, uint8_t err,
 			hids_prep_error(hogp, err);
 		}
 
-		return BT_GATT_ITER_STOP;
+		return;
 	}
 
 	LOG_DBG("Device ready without SCI information characteristic");
 #endif
 
 	hids_mark_ready(hogp);
+}
+
+static uint8_t pm_read_process(struct bt_conn *conn, uint8_t err,
+			    struct bt_gatt_read_params *params,
+			    const void *data, uint16_t length)
+{
+	struct bt_hogp *hogp;
+	int ret;
+
+	hogp = CONTAINER_OF(params, struct bt_hogp, read_params);
+
+	if (err) {
+		LOG_ERR("PM read error");
+		hids_prep_error(hogp, err);
+		return BT_GATT_ITER_STOP;
+	}
+
+	ret = pm_parse(hogp, data, length);
+	if (ret) {
+		hids_prep_error(hogp, ret);
+		return BT_GATT_ITER_STOP;
+	}
+
+	pm_read_done(hogp);
 	return BT_GATT_ITER_STOP;
 }
 
@@ -603,15 +633,47 @@ static int repref_read_start(struct bt_hogp *hogp, size_t rep_idx)
 	return 0;
 }
 
+/**
+ * @brief Parse Report Reference value
+ *
+ * @param hogp    HOGP object.
+ * @param rep_idx Index in the report array.
+ * @param data    Pointer to the value.
+ * @param length  The size of the value.
+ *
+ * @return 0 or negative error value.
+ */
+static int repref_parse(struct bt_hogp *hogp, size_t rep_idx,
+			const void *data, uint16_t length)
+{
+	struct bt_hogp_rep_info *rep;
+	const uint8_t *bdata = data;
+
+	if (length != 2 || !data) {
+		LOG_ERR("Report (idx: %u) reference unexpected size (%u)",
+			rep_idx, length);
+		return -ENOTSUP;
+	}
+
+	rep = hogp->rep_info[rep_idx];
+	if ((uint8_t)rep->ref.type != bdata[1]) {
+		LOG_ERR("Unexpected report type (%u while expecting %u)",
+			bdata[1], rep->ref.type);
+		return -EINVAL;
+	}
+	rep->ref.id = bdata[0];
+	LOG_DBG("Report reference read (idx: %u, id: %u)",
+		rep_idx, rep->ref.id);
+	return 0;
+}
+
 static uint8_t repref_read_process(struct bt_conn *conn, uint8_t err,
 				struct bt_gatt_read_params *params,
 				const void *data, uint16_t length)
 {
 	int ret;
 	struct bt_hogp *hogp;
-	struct bt_hogp_rep_info *rep;
 	size_t rep_idx;
-	const uint8_t *bdata = data;
 
 	hogp = CONTAINER_OF(params, struct bt_hogp, read_params);
 
@@ -624,24 +686,12 @@ static uint8_t repref_read_process(struct bt_conn *conn, uint8_t err,
 		hids_prep_error(hogp, err);
 		return BT_GATT_ITER_STOP;
 	}
-	if (length != 2 || !data) {
-		LOG_ERR("Report (idx: %u) reference unexpected size (%u)",
-			rep_idx, length);
-		hids_prep_error(hogp, -ENOTSUP);
-		return BT_GATT_ITER_STOP;
-	}
 
-	rep = hogp->rep_info[rep_idx];
-	if ((uint8_t)rep->ref.type != bdata[1]) {
-		LOG_ERR("Unexpected report type (%u while expecting %u)",
-			bdata[1], rep->ref.type);
-		hids_prep_error(hogp, -EINVAL);
+	ret = repref_parse(hogp, rep_idx, data, length);
+	if (ret) {
+		hids_prep_error(hogp, ret);
 		return BT_GATT_ITER_STOP;
 	}
-	rep->ref.id = bdata[0];
-	LOG_DBG("Report reference read (idx: %u, id: %u)",
-		rep_idx, rep->ref.id);
-
 
 	/* Next */
 	ret = repref_read_start(hogp, rep_idx + 1);
@@ -694,24 +744,22 @@ static int hid_info_read_start(struct bt_hogp *hogp)
 	return 0;
 }
 
-static uint8_t hid_info_read_process(struct bt_conn *conn, uint8_t err,
-				   struct bt_gatt_read_params *params,
-				   const void *data, uint16_t length)
+/**
+ * @brief Parse HID information value
+ *
+ * @param hogp   HOGP object.
+ * @param data   Pointer to the value.
+ * @param length The size of the value.
+ *
+ * @return 0 or negative error value.
+ */
+static int hid_info_parse(struct bt_hogp *hogp, const void *data, uint16_t length)
 {
-	struct bt_hogp *hogp;
 	const uint8_t *bdata = data;
 
-	hogp = CONTAINER_OF(params, struct bt_hogp, read_params);
-
-	if (err) {
-		LOG_ERR("HID information read error");
-		hids_prep_error(hogp, err);
-		return BT_GATT_ITER_STOP;
-	}
 	if (length != 4 || !data) {
 		LOG_ERR("Unexpected HID information size: %u", length);
-		hids_prep_error(hogp, -ENOTSUP);
-		return BT_GATT_ITER_STOP;
+		return -ENOTSUP;
 	}
 
 	hogp->info_val.bcd_hid = sys_get_le16(&bdata[0]);
@@ -730,13 +778,260 @@ static uint8_t hid_info_read_process(struct bt_conn *conn, uint8_t err,
 	}
 #endif /* CONFIG_BT_HOGP_SCI */
 
-	err = repref_read_start(hogp, 0);
+	return 0;
+}
+
+static uint8_t hid_info_read_process(struct bt_conn *conn, uint8_t err,
+				   struct bt_gatt_read_params *params,
+				   const void *data, uint16_t length)
+{
+	struct bt_hogp *hogp;
+	int ret;
+
+	hogp = CONTAINER_OF(params, struct bt_hogp, read_params);
+
+	if (err) {
+		LOG_ERR("HID information read error");
+		hids_prep_error(hogp, err);
+		return BT_GATT_ITER_STOP;
+	}
+
+	ret = hid_info_parse(hogp, data, length);
+	if (!ret) {
+		ret = repref_read_start(hogp, 0);
+	}
+	if (ret) {
+		hids_prep_error(hogp, ret);
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+#if defined(CONFIG_BT_HOGP_READ_MULTIPLE)
+/**
+ * @brief Get the number of values read during the preparation
+ *
+ * The values are indexed in the reading order: HID information,
+ * Report References of all the reports and Protocol Mode, if present.
+ *
+ * @param hogp HOGP object.
+ *
+ * @return Number of values.
+ */
+static size_t prep_value_count(const struct bt_hogp *hogp)
+{
+	return 1 + hogp->rep_count + ((hogp->handlers.pm != 0) ? 1 : 0);
+}
+
+/**
+ * @brief Get the handle and the expected size of a preparation value
+ *
+ * @param hogp   HOGP object.
+ * @param idx    Value index, see @ref prep_value_count.
+ * @param handle Pointer to the variable where the handle is stored.
+ *
+ * @return Expected size of the value.
+ */
+static uint16_t prep_value_get(const struct bt_hogp *hogp, size_t idx,
+			       uint16_t *handle)
+{
+	if (idx == 0) {
+		*handle = hogp->handlers.info;
+		return 4;
+	} else if (idx <= hogp->rep_count) {
+		*handle = hogp->rep_info[idx - 1]->handlers.ref;
+		return 2;
+	}
+
+	*handle = hogp->handlers.pm;
+	return 1;
+}
+
+/**
+ * @brief Parse a preparation value
+ *
+ * @param hogp   HOGP object.
+ * @param idx    Value index, see @ref prep_value_count.
+ * @param data   Pointer to the value.
+ * @param length The size of the value.
+ *
+ * @return 0 or negative error value.
+ */
+static int prep_value_parse(struct bt_hogp *hogp, size_t idx,
+			    const void *data, uint16_t length)
+{
+	if (idx == 0) {
+		return hid_info_parse(hogp, data, length);
+	} else if (idx <= hogp->rep_count) {
+		return repref_parse(hogp, idx - 1, data, length);
+	}
+
+	return pm_parse(hogp, data, length);
+}
+
+/**
+ * @brief Report preparation error while processing a response value
+ *
+ * The remaining values of the response are ignored.
+ *
+ * @param hogp HOGP object.
+ * @param err  Error code.
+ */
+static void prep_read_mult_error(struct bt_hogp *hogp, int err)
+{
+	hogp->init_repref.read_failed = true;
+	hids_prep_error(hogp, err);
+}
+
+/**
+ * @brief Process the values read with Read Multiple Variable Length
+ *
+ * The function is called for every value in the response and then
+ * once more, with NULL data, when the response is processed.
+ *
+ * @param conn   Connection handler.
+ * @param err    Read ATT error code.
+ * @param params Notification parameters structure - the pointer
+ *               to the structure provided to read function.
+ * @param data   Pointer to the data buffer.
+ * @param length The size of the received data.
+ *
+ * @retval BT_GATT_ITER_STOP     Stop notification
+ * @retval BT_GATT_ITER_CONTINUE Continue notification
+ */
+static uint8_t prep_read_mult_process(struct bt_conn *conn, uint8_t err,
+				      struct bt_gatt_read_params *params,
+				      const void *data, uint16_t length);
+
+/**
+ * @brief Start reading the next preparation values
+ *
+ * Reads as many of the remaining values as fit into a single
+ * Read Multiple Variable Length response.
+ *
+ * @param hogp HOGP object.
+ *
+ * @return 0 or negative error value.
+ */
+static int prep_read_mult_start(struct bt_hogp *hogp)
+{
+	struct bt_gatt_read_params *params = &hogp->read_params;
+	size_t idx = hogp->init_repref.read_idx;
+	size_t count = prep_value_count(hogp);
+	size_t space = bt_gatt_get_mtu(hogp->conn) - 1;
+	size_t cnt = 0;
+	int err;
+
+	__ASSERT_NO_MSG(idx < count);
+
+	while ((idx + cnt < count) && (cnt < ARRAY_SIZE(hogp->read_handles))) {
+		/* Every value is preceded by its length in the response */
+		uint16_t size = sizeof(uint16_t) +
+				prep_value_get(hogp, idx + cnt, &hogp->read_handles[cnt]);
+
+		if ((cnt > 0) && (size > space)) {
+			break;
+		}
+		space -= MIN(size, space);
+		cnt++;
+	}
+
+	LOG_DBG("Read Multiple start (values: %u-%u)", idx, idx + cnt - 1);
+	hogp->init_repref.read_start = idx;
+	hogp->init_repref.read_end = idx + cnt;
+	params->func = prep_read_mult_process;
+	params->handle_count = cnt;
+	if (cnt == 1) {
+		params->single.handle = hogp->read_handles[0];
+		params->single.offset = 0;
+	} else {
+		params->multiple.handles = hogp->read_handles;
+		params->multiple.variable = true;
+	}
+	err = bt_gatt_read(hogp->conn, params);
 	if (err) {
+		LOG_ERR("Read Multiple error (err: %d)", err);
+		return err;
+	}
+	return 0;
+}
+
+static uint8_t prep_read_mult_process(struct bt_conn *conn, uint8_t err,
+				      struct bt_gatt_read_params *params,
+				      const void *data, uint16_t length)
+{
+	struct bt_hogp *hogp;
+	size_t idx;
+	uint16_t handle;
+	int ret;
+
+	hogp = CONTAINER_OF(params, struct bt_hogp, read_params);
+	idx = hogp->init_repref.read_idx;
+
+	if (err) {
+		if ((err == BT_ATT_ERR_NOT_SUPPORTED) && (idx == 0)) {
+			LOG_DBG("Read Multiple not supported, reading values one by one");
+			ret = hid_info_read_start(hogp);
+			if (ret) {
+				hids_prep_error(hogp, ret);
+			}
+			return BT_GATT_ITER_STOP;
+		}
+		LOG_ERR("Read Multiple error (err: %d)", err);
 		hids_prep_error(hogp, err);
+		return BT_GATT_ITER_STOP;
 	}
+	if (hogp->init_repref.read_failed) {
+		return BT_GATT_ITER_STOP;
+	}
+
+	if (data) {
+		if (idx >= hogp->init_repref.read_end) {
+			LOG_ERR("Unexpected value in Read Multiple response");
+			prep_read_mult_error(hogp, -ENOTSUP);
+			return BT_GATT_ITER_STOP;
+		}
+		if ((idx > hogp->init_repref.read_start) &&
+		    (length < prep_value_get(hogp, idx, &handle))) {
+			/* The response was truncated to the MTU of the bearer
+			 * used. Read this value again with the next request.
+			 */
+			hogp->init_repref.read_end = idx;
+			return BT_GATT_ITER_CONTINUE;
+		}
 
+		ret = prep_value_parse(hogp, idx, data, length);
+		if (ret) {
+			prep_read_mult_error(hogp, ret);
+			return BT_GATT_ITER_STOP;
+		}
+		hogp->init_repref.read_idx++;
+		return BT_GATT_ITER_CONTINUE;
+	}
+
+	/* The whole response is processed */
+	if (idx < hogp->init_repref.read_end) {
+		LOG_ERR("Missing values in Read Multiple response");
+		hids_prep_error(hogp, -ENOTSUP);
+		return BT_GATT_ITER_STOP;
+	}
+	if (idx < prep_value_count(hogp)) {
+		ret = prep_read_mult_start(hogp);
+		if (ret) {
+			hids_prep_error(hogp, ret);
+		}
+		return BT_GATT_ITER_STOP;
+	}
+
+	if (hogp->handlers.pm == 0) {
+		LOG_DBG("Device ready without boot protocol");
+		hids_mark_ready(hogp);
+	} else {
+		pm_read_done(hogp);
+	}
 	return BT_GATT_ITER_STOP;
 }
+#endif /* CONFIG_BT_HOGP_READ_MULTIPLE */
 
 /**
  * @brief Start anything that should be started after discovery
@@ -759,7 +1054,13 @@ static int post_discovery_start(struct bt_hogp *hogp)
 		return err;
 	}
 
+#if defined(CONFIG_BT_HOGP_READ_MULTIPLE)
+	hogp->init_repref.read_idx = 0;
+	hogp->init_repref.read_failed = false;
+	err = prep_read_mult_start(hogp);
+#else
 	err = hid_info_read_start(hogp);
+#endif
 	if (err) {
 		k_sem_give(&hogp->read_params_sem);
 		return err;
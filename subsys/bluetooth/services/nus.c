@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/bluetooth/conn.h>
 #include <zephyr/bluetooth/uuid.h>
 #include <zephyr/bluetooth/gatt.h>
@@ -111,3 +112,175 @@ int bt_nus_send(struct bt_conn *conn, const uint8_t *data, uint16_t len)
 		return -EINVAL;
 	}
 }
+
+#if defined(CONFIG_BT_NUS_STREAM)
+static void stream_complete(struct bt_nus_stream *stream)
+{
+	bt_nus_stream_done_cb_t done = stream->done;
+	struct bt_conn *conn = stream->conn;
+	int err = stream->err;
+
+	stream->conn = NULL;
+	atomic_clear_bit(&stream->flags, BT_NUS_STREAM_FLAG_ACTIVE);
+
+	LOG_DBG("Stream done, conn %p, err %d", (void *)conn, err);
+
+	/* The callback may start the next transfer on the stream */
+	if (done) {
+		done(stream, conn, err);
+	}
+
+	bt_conn_unref(conn);
+}
+
+static void stream_sent(struct bt_conn *conn, void *user_data)
+{
+	struct bt_nus_stream *stream = user_data;
+
+	ARG_UNUSED(conn);
+
+	/* Notifications are sent in the order in which they were queued */
+	stream->stats.bytes += stream->tx_len[stream->tx_head];
+	stream->stats.notifications++;
+	stream->tx_head = (stream->tx_head + 1) % ARRAY_SIZE(stream->tx_len);
+
+	atomic_dec(&stream->in_flight);
+
+	k_work_reschedule(&stream->work, K_NO_WAIT);
+}
+
+static void stream_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_nus_stream *stream = CONTAINER_OF(dwork, struct bt_nus_stream, work);
+	struct bt_gatt_notify_params params = {
+		.attr = &nus_svc.attrs[2],
+		.func = stream_sent,
+		.user_data = stream,
+	};
+	uint16_t mtu;
+	int err;
+
+	if (!atomic_test_bit(&stream->flags, BT_NUS_STREAM_FLAG_ACTIVE)) {
+		return;
+	}
+
+	if (atomic_test_bit(&stream->flags, BT_NUS_STREAM_FLAG_STOP) && !stream->err) {
+		stream->err = -ECANCELED;
+	}
+
+	mtu = bt_nus_get_mtu(stream->conn);
+
+	while (!stream->err && (stream->offset < stream->len) &&
+	       (atomic_get(&stream->in_flight) < CONFIG_BT_NUS_STREAM_TX_COUNT)) {
+		params.data = &stream->data[stream->offset];
+		params.len = MIN(mtu, stream->len - stream->offset);
+
+		/* The length must be in place before the notification can complete */
+		stream->tx_len[stream->tx_tail] = params.len;
+		atomic_inc(&stream->in_flight);
+
+		err = bt_gatt_notify_cb(stream->conn, &params);
+		if (err) {
+			atomic_dec(&stream->in_flight);
+
+			if (err != -ENOMEM) {
+				LOG_WRN("Stream notification failed: %d", err);
+				stream->err = err;
+				break;
+			}
+
+			/* Out of buffers, continue when a notification completes */
+			if (!atomic_get(&stream->in_flight)) {
+				k_work_reschedule(&stream->work, K_MSEC(1));
+			}
+
+			return;
+		}
+
+		if (!stream->stats.start_time) {
+			stream->stats.start_time = k_uptime_get();
+		}
+
+		stream->tx_tail = (stream->tx_tail + 1) % ARRAY_SIZE(stream->tx_len);
+		stream->offset += params.len;
+	}
+
+	if (((stream->offset == stream->len) || stream->err) &&
+	    !atomic_get(&stream->in_flight)) {
+		stream_complete(stream);
+	}
+}
+
+int bt_nus_stream_send(struct bt_nus_stream *stream, struct bt_conn *conn,
+		       const uint8_t *data, size_t len, bt_nus_stream_done_cb_t done)
+{
+	if (!stream || !conn || !data || !len) {
+		return -EINVAL;
+	}
+
+	if (!bt_gatt_is_subscribed(conn, &nus_svc.attrs[2], BT_GATT_CCC_NOTIFY)) {
+		return -EINVAL;
+	}
+
+	if (atomic_test_and_set_bit(&stream->flags, BT_NUS_STREAM_FLAG_ACTIVE)) {
+		return -EBUSY;
+	}
+
+	/* The work item is initialized on the first transfer */
+	if (!atomic_test_and_set_bit(&stream->flags, BT_NUS_STREAM_FLAG_INIT)) {
+		k_work_init_delayable(&stream->work, stream_work_handler);
+	}
+
+	atomic_clear_bit(&stream->flags, BT_NUS_STREAM_FLAG_STOP);
+	stream->conn = bt_conn_ref(conn);
+	stream->data = data;
+	stream->len = len;
+	stream->offset = 0;
+	stream->err = 0;
+	stream->done = done;
+
+	k_work_reschedule(&stream->work, K_NO_WAIT);
+
+	return 0;
+}
+
+int bt_nus_stream_stop(struct bt_nus_stream *stream)
+{
+	if (!stream) {
+		return -EINVAL;
+	}
+
+	if (!atomic_test_bit(&stream->flags, BT_NUS_STREAM_FLAG_ACTIVE)) {
+		return -EALREADY;
+	}
+
+	atomic_set_bit(&stream->flags, BT_NUS_STREAM_FLAG_STOP);
+	k_work_reschedule(&stream->work, K_NO_WAIT);
+
+	return 0;
+}
+
+uint32_t bt_nus_stream_throughput_get(const struct bt_nus_stream *stream)
+{
+	int64_t elapsed;
+
+	if (!stream || !stream->stats.start_time) {
+		return 0;
+	}
+
+	elapsed = k_uptime_get() - stream->stats.start_time;
+	if (elapsed <= 0) {
+		return 0;
+	}
+
+	return (uint32_t)((stream->stats.bytes * MSEC_PER_SEC) / elapsed);
+}
+
+void bt_nus_stream_stats_reset(struct bt_nus_stream *stream)
+{
+	if (stream) {
+		memset(&stream->stats, 0, sizeof(stream->stats));
+	}
+}
+#endif /* CONFIG_BT_NUS_STREAM */
@@ -51,6 +51,17 @@ static void notify_rd_overwritten(struct bt_conn *conn, uint16_t ranging_counter
 	}
 }
 
+static void notify_subevent_data_received(struct bt_conn *conn, uint16_t ranging_counter)
+{
+	struct bt_ras_rd_buffer_cb *cb;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&callback_list, cb, node) {
+		if (cb->subevent_data_received) {
+			cb->subevent_data_received(conn, ranging_counter);
+		}
+	}
+}
+
 static struct ras_rd_buffer *rd_buffer_get(struct bt_conn *conn, uint16_t ranging_counter,
 					   bool ready, bool busy)
 {
@@ -75,6 +86,7 @@ static void rd_buffer_init(struct bt_conn *conn, struct ras_rd_buffer *buf,
 	buf->acked = false;
 	buf->subevent_cursor = 0;
 	atomic_clear(&buf->refcount);
+	atomic_clear(&buf->streamable_len);
 }
 
 static void rd_buffer_free(struct ras_rd_buffer *buf)
@@ -90,6 +102,28 @@ static void rd_buffer_free(struct ras_rd_buffer *buf)
 	buf->refcount = 0;
 	buf->subevent_cursor = 0;
 	atomic_clear(&buf->refcount);
+	atomic_clear(&buf->streamable_len);
+}
+
+/* Drops the procedure that is being written to the buffer. */
+static void rd_buffer_drop(struct ras_rd_buffer *buf)
+{
+	uint16_t streamable_len = atomic_get(&buf->streamable_len);
+
+	if (IS_ENABLED(CONFIG_BT_RAS_RRSP_REALTIME_STREAMING) &&
+	    atomic_get(&buf->refcount) > 0 && streamable_len > 0) {
+		/* The procedure is being streamed, so end it after the complete subevents. */
+		LOG_WRN("Ending the stream of procedure %u early", buf->ranging_counter);
+
+		buf->subevent_cursor = streamable_len - sizeof(struct ras_ranging_header);
+		buf->ready = true;
+		buf->busy = false;
+		notify_subevent_data_received(buf->conn, buf->ranging_counter);
+
+		return;
+	}
+
+	rd_buffer_free(buf);
 }
 
 static struct ras_rd_buffer *rd_buffer_alloc(struct bt_conn *conn, uint16_t ranging_counter)
@@ -214,7 +248,7 @@ static void subevent_data_available(struct bt_conn *conn,
 			result->header.procedure_counter);
 
 		if (buf) {
-			rd_buffer_free(buf);
+			rd_buffer_drop(buf);
 		}
 
 		return;
@@ -252,7 +286,7 @@ static void subevent_data_available(struct bt_conn *conn,
 			buf->subevent_cursor, buffer_size);
 		drop_procedure_counter[conn_index] = buf->ranging_counter;
 
-		rd_buffer_free(buf);
+		rd_buffer_drop(buf);
 
 		return;
 	}
@@ -285,15 +319,19 @@ static void subevent_data_available(struct bt_conn *conn,
 	bool drop = (drop_procedure_counter[conn_index] == result->header.procedure_counter);
 
 	if (drop) {
-		rd_buffer_free(buf);
+		rd_buffer_drop(buf);
 		return;
 	}
 
+	atomic_set(&buf->streamable_len, sizeof(struct ras_ranging_header) + buf->subevent_cursor);
+
 	if (hdr->ranging_done_status == BT_CONN_LE_CS_PROCEDURE_COMPLETE ||
 	    hdr->ranging_done_status == BT_CONN_LE_CS_PROCEDURE_ABORTED) {
 		buf->ready = true;
 		buf->busy = false;
 		notify_new_rd_stored(conn, ranging_counter);
+	} else if (IS_ENABLED(CONFIG_BT_RAS_RRSP_REALTIME_STREAMING)) {
+		notify_subevent_data_received(conn, ranging_counter);
 	}
 }
 
@@ -338,6 +376,24 @@ struct ras_rd_buffer *bt_ras_rd_buffer_claim(struct bt_conn *conn, uint16_t rang
 	return NULL;
 }
 
+struct ras_rd_buffer *bt_ras_rd_buffer_stream_claim(struct bt_conn *conn,
+						    uint16_t ranging_counter)
+{
+	struct ras_rd_buffer *buf;
+
+	if (!IS_ENABLED(CONFIG_BT_RAS_RRSP_REALTIME_STREAMING)) {
+		return NULL;
+	}
+
+	buf = rd_buffer_get(conn, ranging_counter, false, true);
+	if (buf) {
+		atomic_inc(&buf->refcount);
+		return buf;
+	}
+
+	return NULL;
+}
+
 int bt_ras_rd_buffer_release(struct ras_rd_buffer *buf)
 {
 	if (!buf || atomic_get(&buf->refcount) == 0) {
@@ -356,8 +412,21 @@ int bt_ras_rd_buffer_release(struct ras_rd_buffer *buf)
 int bt_ras_rd_buffer_bytes_pull(struct ras_rd_buffer *buf, uint8_t *out_buf, uint16_t max_data_len,
 				uint16_t *read_cursor, bool *empty)
 {
+	*empty = false;
+
 	if (!buf->ready) {
-		return 0;
+		uint16_t streamable_len = atomic_get(&buf->streamable_len);
+
+		/* Send only full segments until the procedure is complete. */
+		if (!IS_ENABLED(CONFIG_BT_RAS_RRSP_REALTIME_STREAMING) ||
+		    streamable_len < (*read_cursor) + max_data_len) {
+			return 0;
+		}
+
+		memcpy(out_buf, &buf->procedure.buf[*read_cursor], max_data_len);
+		*read_cursor += max_data_len;
+
+		return max_data_len;
 	}
 
 	uint16_t buf_len = sizeof(struct ras_ranging_header) + buf->subevent_cursor;
@@ -384,7 +384,10 @@ static int rd_segment_send(struct bt_ras_rrsp *rrsp)
 	}
 
 	if (!last_seg) {
-		k_work_submit_to_queue(&rrsp_wq, &rrsp->send_data_work);
+		/* When streaming, wait for more subevent data if there was not enough. */
+		if (actual_data_len) {
+			k_work_submit_to_queue(&rrsp_wq, &rrsp->send_data_work);
+		}
 	} else {
 		LOG_DBG("All segments sent");
 
@@ -521,6 +524,10 @@ static void new_rd_handle(struct bt_conn *conn, uint16_t ranging_counter)
 					rrsp->segment_counter = 0;
 					rrsp->streaming = true;
 
+					k_work_submit_to_queue(&rrsp_wq, &rrsp->send_data_work);
+				} else if (rrsp->active_buf &&
+					   rrsp->active_buf->ranging_counter == ranging_counter) {
+					/* The procedure is already being streamed, send the rest. */
 					k_work_submit_to_queue(&rrsp_wq, &rrsp->send_data_work);
 				} else {
 					LOG_DBG("Dropped new ranging data.");
@@ -530,6 +537,37 @@ static void new_rd_handle(struct bt_conn *conn, uint16_t ranging_counter)
 	}
 }
 
+#if defined(CONFIG_BT_RAS_RRSP_REALTIME_STREAMING)
+static void subevent_data_handle(struct bt_conn *conn, uint16_t ranging_counter)
+{
+	struct bt_ras_rrsp *rrsp = rrsp_find(conn);
+	struct bt_gatt_attr *realtime_rd_attr =
+		bt_gatt_find_by_uuid(rrsp_svc.attrs, 0, BT_UUID_RAS_REALTIME_RD);
+
+	if (!rrsp || !bt_gatt_is_subscribed(conn, realtime_rd_attr,
+					    BT_GATT_CCC_NOTIFY | BT_GATT_CCC_INDICATE)) {
+		return;
+	}
+
+	if (!rrsp->streaming) {
+		/* Start sending the procedure before all its subevents are received. */
+		rrsp->active_buf = bt_ras_rd_buffer_stream_claim(conn, ranging_counter);
+		if (!rrsp->active_buf) {
+			return;
+		}
+
+		rrsp->active_buf_read_cursor = 0;
+		rrsp->segment_counter = 0;
+		rrsp->streaming = true;
+	} else if (!rrsp->active_buf || rrsp->active_buf->ranging_counter != ranging_counter) {
+		LOG_DBG("Dropped new subevent data.");
+		return;
+	}
+
+	k_work_submit_to_queue(&rrsp_wq, &rrsp->send_data_work);
+}
+#endif /* CONFIG_BT_RAS_RRSP_REALTIME_STREAMING */
+
 static void rd_overwritten_handle(struct bt_conn *conn, uint16_t ranging_counter)
 {
 	struct bt_ras_rrsp *rrsp = rrsp_find(conn);
@@ -547,6 +585,9 @@ static void rd_overwritten_handle(struct bt_conn *conn, uint16_t ranging_counter
 static struct bt_ras_rd_buffer_cb rd_buffer_callbacks = {
 	.new_ranging_data_received = new_rd_handle,
 	.ranging_data_overwritten = rd_overwritten_handle,
+#if defined(CONFIG_BT_RAS_RRSP_REALTIME_STREAMING)
+	.subevent_data_received = subevent_data_handle,
+#endif /* CONFIG_BT_RAS_RRSP_REALTIME_STREAMING */
 };
 
 static int ras_rrsp_init(void)
@@ -21,7 +21,9 @@
 
 LOG_MODULE_REGISTER(bt_throughput, CONFIG_BT_THROUGHPUT_LOG_LEVEL);
 
-static struct bt_throughput_metrics met;
+/* Metrics of the data received on each connection */
+static struct bt_throughput_metrics met[CONFIG_BT_MAX_CONN];
+static uint32_t clock_cycles[CONFIG_BT_MAX_CONN];
 static const struct bt_throughput_cb *callbacks;
 
 static uint8_t read_fn(struct bt_conn *conn, uint8_t err,
@@ -48,23 +50,20 @@ static ssize_t write_callback(struct bt_conn *conn,
 			      const struct bt_gatt_attr *attr, const void *buf,
 			      uint16_t len, uint16_t offset, uint8_t flags)
 {
-	static uint32_t clock_cycles;
-	static uint32_t kb;
-
+	uint8_t index = bt_conn_index(conn);
 	uint64_t delta;
 
-	struct bt_throughput_metrics *met_data = attr->user_data;
+	struct bt_throughput_metrics *met_data = &met[index];
 
-	delta = k_cycle_get_32() - clock_cycles;
+	delta = k_cycle_get_32() - clock_cycles[index];
 	delta = k_cyc_to_ns_floor64(delta);
 
 	if (len == 1) {
 		/* reset metrics */
-		kb = 0;
 		met_data->write_count = 0;
 		met_data->write_len = 0;
 		met_data->write_rate = 0;
-		clock_cycles = k_cycle_get_32();
+		clock_cycles[index] = k_cycle_get_32();
 	} else {
 		met_data->write_count++;
 		met_data->write_len += len;
@@ -85,7 +84,7 @@ static ssize_t read_callback(struct bt_conn *conn,
 			     const struct bt_gatt_attr *attr, void *buf,
 			     uint16_t len, uint16_t offset)
 {
-	const struct bt_throughput_metrics *metrics = attr->user_data;
+	const struct bt_throughput_metrics *metrics = &met[bt_conn_index(conn)];
 
 	len = MIN(sizeof(struct bt_throughput_metrics), len);
 
@@ -96,7 +95,7 @@ static ssize_t read_callback(struct bt_conn *conn,
 	LOG_DBG("Data send.");
 
 	return bt_gatt_attr_read(
-		conn, attr, buf, len, offset, attr->user_data, len);
+		conn, attr, buf, len, offset, metrics, len);
 }
 
 
@@ -105,7 +104,7 @@ BT_GATT_PRIMARY_SERVICE(BT_UUID_THROUGHPUT),
 	BT_GATT_CHARACTERISTIC(BT_UUID_THROUGHPUT_CHAR,
 		BT_GATT_CHRC_READ | BT_GATT_CHRC_WRITE_WITHOUT_RESP,
 		BT_GATT_PERM_READ | BT_GATT_PERM_WRITE,
-		read_callback, write_callback, &met),
+		read_callback, write_callback, NULL),
 );
 
 int bt_throughput_init(struct bt_throughput *throughput,
@@ -16,19 +16,10 @@ static void log_button_event(const struct app_event_header *aeh)
 			(event->pressed)?("pressed"):("released"));
 }
 
-static void profile_button_event(struct log_event_buf *buf,
-				 const struct app_event_header *aeh)
-{
-	const struct button_event *event = cast_button_event(aeh);
-
-	nrf_profiler_log_encode_uint16(buf, event->key_id);
-	nrf_profiler_log_encode_uint8(buf, (event->pressed)?(1):(0));
-}
-
-APP_EVENT_INFO_DEFINE(button_event,
+APP_EVENT_INFO_DEFINE_PACKED(button_event,
 		  ENCODE(NRF_PROFILER_ARG_U16, NRF_PROFILER_ARG_U8),
 		  ENCODE("button_id", "status"),
-		  profile_button_event);
+		  ENCODE(key_id, pressed));
 
 APP_EVENT_TYPE_DEFINE(button_event,
 		  log_button_event,
@@ -270,6 +270,7 @@ static int update_undirected_advertising(struct bt_le_adv_param *adv_param)
 
 	struct bt_le_adv_prov_adv_state adv_state;
 	struct bt_le_adv_prov_feedback fb;
+	bool data_changed;
 
 	if (req_new_adv_session) {
 		force_rpa_rotation(cur_identity);
@@ -290,6 +291,7 @@ static int update_undirected_advertising(struct bt_le_adv_param *adv_param)
 	}
 
 	req_grace_period_s = MAX(req_grace_period_s, fb.grace_period_s);
+	data_changed = fb.data_changed;
 
 	err = bt_le_adv_prov_get_sd(sd, &sd_len, &adv_state, &fb);
 	if (err) {
@@ -298,6 +300,7 @@ static int update_undirected_advertising(struct bt_le_adv_param *adv_param)
 	}
 
 	req_grace_period_s = MAX(req_grace_period_s, fb.grace_period_s);
+	data_changed = data_changed || fb.data_changed;
 
 	if (req_grace_period_s > 0) {
 		__ASSERT_NO_MSG(IS_ENABLED(CONFIG_CAF_BLE_ADV_GRACE_PERIOD) ||
@@ -319,6 +322,11 @@ static int update_undirected_advertising(struct bt_le_adv_param *adv_param)
 		__ASSERT_NO_MSG(!adv_state.new_adv_session);
 		__ASSERT_NO_MSG(!adv_state.rpa_rotated);
 
+		if (!data_changed) {
+			LOG_DBG("Advertising data did not change");
+			return 0;
+		}
+
 		return bt_le_adv_update_data(ad, ad_len, sd, sd_len);
 	}
 }
@@ -103,55 +103,88 @@ static uint32_t get_wakeup_mask(const struct gpio_pin *pins, size_t cnt)
 	return mask;
 }
 
-static int set_cols(uint32_t mask)
+static int set_col(size_t i, bool output, uint32_t val)
 {
-	for (size_t i = 0; i < ARRAY_SIZE(col); i++) {
-		uint32_t val = (mask & BIT(i)) ? (1) : (0);
-		int err;
+	int err;
 
-		if (val || !mask) {
-			if (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED)) {
-				val = !val;
-			}
+	if (output) {
+		if (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED)) {
+			val = !val;
+		}
 
-			err = gpio_pin_configure(get_gpio_dev(col[i].port),
-						 col[i].pin, GPIO_OUTPUT);
-			if (!err) {
-				err = gpio_pin_set_raw(get_gpio_dev(col[i].port),
-						       col[i].pin, val);
-			}
-		} else {
-			gpio_flags_t flags = GPIO_INPUT;
-			gpio_flags_t pull = (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED) ?
-					    (GPIO_PULL_UP) : (GPIO_PULL_DOWN));
+		err = gpio_pin_configure(get_gpio_dev(col[i].port), col[i].pin, GPIO_OUTPUT);
+		if (!err) {
+			err = gpio_pin_set_raw(get_gpio_dev(col[i].port), col[i].pin, val);
+		}
+	} else {
+		gpio_flags_t flags = GPIO_INPUT;
+		gpio_flags_t pull = (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED) ?
+				    (GPIO_PULL_UP) : (GPIO_PULL_DOWN));
 
-			/* The pull is necessary to ensure pin state and prevent unexpected
-			 * behaviour that could be triggered by accumulating charge.
-			 */
-			flags |= pull;
+		/* The pull is necessary to ensure pin state and prevent unexpected
+		 * behaviour that could be triggered by accumulating charge.
+		 */
+		flags |= pull;
 
-			err = gpio_pin_configure(get_gpio_dev(col[i].port), col[i].pin, flags);
-		}
+		err = gpio_pin_configure(get_gpio_dev(col[i].port), col[i].pin, flags);
+	}
+
+	if (err) {
+		LOG_ERR("Cannot set pin");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static int set_cols(uint32_t mask)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(col); i++) {
+		uint32_t val = (mask & BIT(i)) ? (1) : (0);
+		int err = set_col(i, (val || !mask), val);
 
 		if (err) {
-			LOG_ERR("Cannot set pin");
-			return -EFAULT;
+			return err;
 		}
 	}
 
 	return 0;
 }
 
+/* Move the strobe from the previous column to the next one. Only the two columns are
+ * reconfigured, the remaining ones are already set as inputs.
+ */
+static int strobe_col(size_t prev, size_t next)
+{
+	int err = set_col(prev, false, 0);
+
+	if (!err) {
+		err = set_col(next, true, 1);
+	}
+
+	return err;
+}
+
 static int get_rows(uint32_t *mask)
 {
+	/* Read every GPIO port only once per column. */
+	gpio_port_value_t port_val[ARRAY_SIZE(gpio_devs)];
+	uint32_t port_read = 0;
+
 	for (size_t i = 0; i < ARRAY_SIZE(row); i++) {
-		int val = gpio_pin_get_raw(get_gpio_dev(row[i].port), row[i].pin);
+		int idx = get_gpio_idx(row[i].port);
 
-		if (val < 0) {
-			LOG_ERR("Cannot get pin");
-			return -EFAULT;
+		if (!(port_read & BIT(idx))) {
+			if (gpio_port_get_raw(gpio_devs[idx].dev, &port_val[idx])) {
+				LOG_ERR("Cannot get port");
+				return -EFAULT;
+			}
+
+			port_read |= BIT(idx);
 		}
 
+		uint32_t val = (port_val[idx] & BIT(row[i].pin)) ? (1) : (0);
+
 		if (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED)) {
 			val = !val;
 		}
@@ -311,7 +344,7 @@ static void scan_fn(struct k_work *work)
 	memset(raw_state, 0, sizeof(raw_state));
 
 	for (size_t i = 0; i < COLUMNS; i++) {
-		int err = set_cols(BIT(i));
+		int err = (i == 0) ? set_cols(BIT(i)) : strobe_col(i - 1, i);
 
 		if (!err) {
 			err = get_rows(&raw_state[i]);
@@ -92,9 +92,26 @@ static void set_color(struct led *led, struct led_color *color)
 
 static void set_off(struct led *led)
 {
-	struct led_color nocolor = {0};
+	/* Keep the color in sync with the hardware state. */
+	memset(&led->color, 0, sizeof(led->color));
+	set_color(led, &led->color);
+}
+
+static void schedule_substep(struct led *led)
+{
+	const struct led_effect_step *effect_step = &led->effect->steps[led->effect_step];
+	int32_t next_delay = effect_step->substep_time;
+
+	/* Substeps do not change the color once the color of the step is reached.
+	 * Wait for all the remaining substeps at once instead of waking up for
+	 * every substep.
+	 */
+	if (!memcmp(&led->color, &effect_step->color, sizeof(led->color))) {
+		next_delay *= effect_step->substep_count - led->effect_substep;
+		led->effect_substep = effect_step->substep_count - 1;
+	}
 
-	set_color(led, &nocolor);
+	k_work_reschedule(&led->work, K_MSEC(next_delay));
 }
 
 static void work_handler(struct k_work *work)
@@ -107,13 +124,18 @@ static void work_handler(struct k_work *work)
 
 	__ASSERT_NO_MSG(effect_step->substep_count > 0);
 	int substeps_left = effect_step->substep_count - led->effect_substep;
+	bool changed = false;
 
 	for (size_t i = 0; i < ARRAY_SIZE(led->color.c); i++) {
 		int diff = (effect_step->color.c[i] - led->color.c[i]) /
 			substeps_left;
 		led->color.c[i] += diff;
+		changed = changed || (diff != 0);
+	}
+
+	if (changed) {
+		set_color(led, &led->color);
 	}
-	set_color(led, &led->color);
 
 	led->effect_substep++;
 	if (led->effect_substep == effect_step->substep_count) {
@@ -135,10 +157,7 @@ static void work_handler(struct k_work *work)
 	}
 
 	if (led->effect_step < led->effect->step_count) {
-		int32_t next_delay =
-			led->effect->steps[led->effect_step].substep_time;
-
-		k_work_reschedule(&led->work, K_MSEC(next_delay));
+		schedule_substep(led);
 	}
 }
 
@@ -157,10 +176,7 @@ static void led_update(struct led *led)
 	__ASSERT_NO_MSG(led->effect->steps);
 
 	if (led->effect->step_count > 0) {
-		int32_t next_delay =
-			led->effect->steps[led->effect_step].substep_time;
-
-		k_work_reschedule(&led->work, K_MSEC(next_delay));
+		schedule_substep(led);
 	} else {
 		LOG_WRN("LED effect with no effect");
 	}
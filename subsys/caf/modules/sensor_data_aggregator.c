@@ -11,6 +11,7 @@
 #include <caf/events/sensor_event.h>
 #include <caf/events/sensor_data_aggregator_event.h>
 #include <caf/sensor_manager.h>
+#include <caf/sensor_data_aggregator.h>
 
 #define MODULE sensor_data_aggregator
 #include <caf/events/module_state_event.h>
@@ -85,6 +86,23 @@ static struct aggregator aggregators[] = {
 	DT_INST_FOREACH_STATUS_OKAY(__DEFINE_AGGREGATOR)
 };
 
+/* Protects the buffers if samples are written directly by the sensor manager thread. */
+static K_MUTEX_DEFINE(agg_mutex);
+
+
+static void agg_lock(void)
+{
+	if (IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT)) {
+		k_mutex_lock(&agg_mutex, K_FOREVER);
+	}
+}
+
+static void agg_unlock(void)
+{
+	if (IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT)) {
+		k_mutex_unlock(&agg_mutex);
+	}
+}
 
 static struct aggregator_buffer *get_free_buffer(struct aggregator *agg)
 {
@@ -129,37 +147,91 @@ static void send_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 	APP_EVENT_SUBMIT(event);
 }
 
+static void sample_stored(struct aggregator *agg)
+{
+	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
+	struct aggregator_buffer *ab = agg->active_buf;
+
+	ab->sample_cnt++;
+
+	size_t used_bytes = ab->sample_cnt * chunk_bytes;
+
+	if ((agg->buf_len - used_bytes) < chunk_bytes) {
+		send_buffer(agg, ab);
+		agg->active_buf = get_free_buffer(agg);
+	}
+}
+
 static int enqueue_sample(struct aggregator *agg, struct sensor_event *event)
 {
 	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
 
-	if ((event->dyndata.size) != chunk_bytes) {
+	/* A single event may carry a batch of samples. */
+	if ((event->dyndata.size == 0) || ((event->dyndata.size % chunk_bytes) != 0)) {
 		return -EBADMSG;
 	}
-	if (!agg->active_buf) {
-		return -ENOMEM;
+
+	for (size_t offset = 0; offset < event->dyndata.size; offset += chunk_bytes) {
+		if (!agg->active_buf) {
+			return -ENOMEM;
+		}
+
+		struct aggregator_buffer *ab = agg->active_buf;
+		size_t pos_values = ab->sample_cnt * agg->values_in_sample;
+		size_t avail_bytes = agg->buf_len - pos_values * sizeof(struct sensor_value);
+
+		if (avail_bytes < chunk_bytes) {
+			__ASSERT_NO_MSG(false);
+			return -ENOMEM;
+		}
+		memcpy(&ab->samples[pos_values], &event->dyndata.data[offset], chunk_bytes);
+		sample_stored(agg);
 	}
 
+	return 0;
+}
+
+#ifdef CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT
+int sensor_data_aggregator_sample_claim(const char *sensor_descr, size_t value_cnt,
+					struct sensor_value **sample)
+{
+	struct aggregator *agg = get_aggregator(sensor_descr);
+
+	if (!agg) {
+		return -ENOENT;
+	}
+	if (value_cnt != agg->values_in_sample) {
+		return -EBADMSG;
+	}
+
+	agg_lock();
+
 	struct aggregator_buffer *ab = agg->active_buf;
-	size_t pos_values = ab->sample_cnt * agg->values_in_sample;
-	size_t avail_bytes = agg->buf_len - pos_values * sizeof(struct sensor_value);
 
-	if (avail_bytes < chunk_bytes) {
-		__ASSERT_NO_MSG(false);
+	if (!ab) {
+		agg_unlock();
 		return -ENOMEM;
 	}
-	memcpy(&ab->samples[pos_values], (uint8_t *)event->dyndata.data, chunk_bytes);
-	ab->sample_cnt++;
-	avail_bytes -= chunk_bytes;
 
-	if (avail_bytes < chunk_bytes) {
-		send_buffer(agg, ab);
-		agg->active_buf = get_free_buffer(agg);
-	}
+	*sample = &ab->samples[ab->sample_cnt * agg->values_in_sample];
 
 	return 0;
 }
 
+void sensor_data_aggregator_sample_commit(const char *sensor_descr, bool store)
+{
+	struct aggregator *agg = get_aggregator(sensor_descr);
+
+	__ASSERT_NO_MSG(agg && agg->active_buf);
+
+	if (store) {
+		sample_stored(agg);
+	}
+
+	agg_unlock();
+}
+#endif /* CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT */
+
 static bool event_handler(const struct app_event_header *aeh)
 {
 	if (is_sensor_event(aeh)) {
@@ -167,8 +239,11 @@ static bool event_handler(const struct app_event_header *aeh)
 		struct aggregator *agg = get_aggregator(event->descr);
 
 		if (agg) {
+			agg_lock();
 			int err = enqueue_sample(agg, event);
 
+			agg_unlock();
+
 			if (err) {
 				LOG_ERR("Error code: %d", err);
 			}
@@ -186,12 +261,14 @@ static bool event_handler(const struct app_event_header *aeh)
 
 		__ASSERT_NO_MSG(agg);
 
+		agg_lock();
 		for (size_t i = 0; i < agg->buf_count; i++) {
 			if (agg->agg_buffers[i].samples == event->samples) {
 				release_buffer(agg, &agg->agg_buffers[i]);
 				break;
 			}
 		}
+		agg_unlock();
 
 		return false;
 	}
@@ -201,11 +278,15 @@ static bool event_handler(const struct app_event_header *aeh)
 		struct aggregator *agg = get_aggregator(event->descr);
 
 		if (agg) {
+			agg_lock();
+
 			struct aggregator_buffer *ab = agg->active_buf;
 
 			agg->sensor_state = event->state;
 			send_buffer(agg, ab);
 			agg->active_buf = get_free_buffer(agg);
+
+			agg_unlock();
 		}
 
 		return false;
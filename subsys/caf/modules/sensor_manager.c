@@ -10,6 +10,7 @@
 
 #include <caf/events/sensor_event.h>
 #include <caf/sensor_manager.h>
+#include <caf/sensor_data_aggregator.h>
 
 #include CONFIG_CAF_SENSOR_MANAGER_DEF_PATH
 
@@ -31,6 +32,11 @@ struct sensor_data {
 	atomic_t state;
 	unsigned int sleep_cntd;
 	atomic_t event_cnt;
+#ifdef CONFIG_CAF_SENSOR_MANAGER_PPI_SEQ
+	struct ppi_seq_i2c_spi_batch batch;
+	atomic_t batch_ready;
+	atomic_t batch_dropped;
+#endif
 };
 
 static struct sensor_data sensor_data[ARRAY_SIZE(sensor_configs)];
@@ -105,6 +111,139 @@ static size_t get_sensor_data_cnt(const struct sm_sensor_config *sc)
 	return data_cnt;
 }
 
+/* Claim a sample in the aggregator buffer. Returns -ENOENT if the sample must be submitted
+ * in sensor_event.
+ */
+static int direct_sample_claim(const struct sm_sensor_config *sc, size_t data_cnt,
+			       struct sensor_value **data)
+{
+	if (!IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT)) {
+		return -ENOENT;
+	}
+
+	int err = sensor_data_aggregator_sample_claim(sc->event_descr, data_cnt, data);
+
+	if (err && (err != -ENOENT)) {
+		LOG_WRN("Aggregator cannot store sample of sensor %s (err %d)",
+			sc->dev->name, err);
+	}
+
+	return err;
+}
+
+static void direct_sample_commit(const struct sm_sensor_config *sc, bool store)
+{
+	if (IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_DIRECT)) {
+		sensor_data_aggregator_sample_commit(sc->event_descr, store);
+	}
+}
+
+#ifdef CONFIG_CAF_SENSOR_MANAGER_PPI_SEQ
+static bool is_ppi_seq_sensor(const struct sm_sensor_config *sc)
+{
+	return sc->ppi_seq != NULL;
+}
+
+static void ppi_seq_batch_handler(const struct device *dev, struct ppi_seq_i2c_spi_batch *batch,
+				  bool last, void *user_data)
+{
+	struct sensor_data *sd = user_data;
+
+	/* Previous batch is still processed by the thread. */
+	if (atomic_get(&sd->batch_ready)) {
+		atomic_inc(&sd->batch_dropped);
+		return;
+	}
+
+	sd->batch = *batch;
+	atomic_set(&sd->batch_ready, true);
+	k_sem_give(&can_sample);
+}
+
+static int ppi_seq_start(const struct sm_sensor_config *sc, struct sensor_data *sd)
+{
+	struct ppi_seq_i2c_spi_job job = *sc->ppi_seq->job;
+
+	job.repeat = UINT32_MAX;
+	job.cb = ppi_seq_batch_handler;
+	job.user_data = sd;
+
+	atomic_set(&sd->batch_ready, false);
+
+	return ppi_seq_i2c_spi_start(sc->dev, sd->sampling_period * USEC_PER_MSEC, &job);
+}
+
+static int ppi_seq_stop(const struct sm_sensor_config *sc)
+{
+	return ppi_seq_i2c_spi_stop(sc->dev, true);
+}
+
+static void ppi_seq_process(const struct sm_sensor_config *sc, struct sensor_data *sd)
+{
+	if (!atomic_get(&sd->batch_ready)) {
+		return;
+	}
+
+	size_t data_cnt = get_sensor_data_cnt(sc);
+	uint8_t batch_cnt = sd->batch.batch_cnt;
+	struct sensor_value data[batch_cnt * data_cnt];
+	bool direct = false;
+	int err = 0;
+
+	for (uint8_t i = 0; !err && (i < batch_cnt); i++) {
+		struct sensor_value *sample = &data[i * data_cnt];
+		int direct_err = direct_sample_claim(sc, data_cnt, &sample);
+
+		err = sc->ppi_seq->decode(&sd->batch, i, sample);
+
+		if (!direct_err) {
+			direct_sample_commit(sc, !err);
+		}
+		direct = direct || (direct_err != -ENOENT);
+	}
+
+	atomic_set(&sd->batch_ready, false);
+
+	atomic_val_t dropped = atomic_set(&sd->batch_dropped, 0);
+
+	if (dropped > 0) {
+		LOG_WRN("%ld batch dropped", dropped);
+	}
+
+	if (err) {
+		LOG_ERR("Sensor batch decoding error (err %d)", err);
+		(void)ppi_seq_stop(sc);
+		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+	} else if (direct) {
+		/* Samples were written directly to the aggregator buffer. */
+	} else if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
+		send_sensor_event(sc->event_descr, data, ARRAY_SIZE(data), &sd->event_cnt);
+	} else {
+		LOG_WRN("Did not send event due to too many active events on sensor: %s",
+			sc->dev->name);
+	}
+}
+#else
+static bool is_ppi_seq_sensor(const struct sm_sensor_config *sc)
+{
+	return false;
+}
+
+static int ppi_seq_start(const struct sm_sensor_config *sc, struct sensor_data *sd)
+{
+	return -ENOTSUP;
+}
+
+static int ppi_seq_stop(const struct sm_sensor_config *sc)
+{
+	return -ENOTSUP;
+}
+
+static void ppi_seq_process(const struct sm_sensor_config *sc, struct sensor_data *sd)
+{
+}
+#endif /* CONFIG_CAF_SENSOR_MANAGER_PPI_SEQ */
+
 static void reset_sensor_sleep_cnt(const struct sm_sensor_config *sc,
 				   struct sensor_data *sd)
 {
@@ -219,10 +358,17 @@ static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config
 {
 	size_t data_idx = 0;
 	size_t data_cnt = get_sensor_data_cnt(sc);
-	struct sensor_value data[data_cnt];
+	struct sensor_value sample[data_cnt];
+	struct sensor_value *data = sample;
+	int direct_err = -ENOENT;
 
 	int err = sensor_sample_fetch(sc->dev);
 
+	if (!err) {
+		/* Values are read directly into the aggregator buffer if possible. */
+		direct_err = direct_sample_claim(sc, data_cnt, &data);
+	}
+
 	for (size_t i = 0; !err && (i < sc->chan_cnt); i++) {
 		const struct caf_sampled_channel *sampled_chan = &sc->chans[i];
 
@@ -231,23 +377,33 @@ static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config
 	}
 
 	if (err) {
+		if (!direct_err) {
+			direct_sample_commit(sc, false);
+		}
+
 		LOG_ERR("Sensor sampling error (err %d)", err);
 		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
 	} else {
-		if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
-			send_sensor_event(sc->event_descr, data, ARRAY_SIZE(data),
-					  &sd->event_cnt);
+		bool sleep = false;
+
+		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
+			process_sensor_activity(sc, sd, data);
+			sleep = !is_sensor_active(sd);
+		}
+
+		if (!direct_err) {
+			direct_sample_commit(sc, true);
+		} else if (direct_err != -ENOENT) {
+			/* Sample dropped, the aggregator has no free buffer. */
+		} else if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
+			send_sensor_event(sc->event_descr, data, data_cnt, &sd->event_cnt);
 		} else {
 			LOG_WRN("Did not send event due to too many active events on sensor: %s",
 				sc->dev->name);
 		}
 
-		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
-			process_sensor_activity(sc, sd, data);
-			if (!is_sensor_active(sd)) {
-				enter_sleep(sc, sd);
-			}
-
+		if (sleep) {
+			enter_sleep(sc, sd);
 		}
 	}
 }
@@ -263,6 +419,19 @@ static size_t sample_sensors(int64_t *next_timeout)
 		struct sensor_data *sd = &sensor_data[i];
 		const struct sm_sensor_config *sc = &sensor_configs[i];
 
+		if (is_ppi_seq_sensor(sc)) {
+			/* Sampling is timed by the hardware sequencer. */
+			if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
+				ppi_seq_process(sc, sd);
+			}
+
+			if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
+				alive_sensors++;
+			}
+
+			continue;
+		}
+
 		if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
 			if (sd->sample_timeout <= cur_uptime) {
 				sample_sensor(sd, sc);
@@ -390,6 +559,25 @@ static size_t sensor_init(void)
 		sd->sampling_period = sc->sampling_period_ms;
 		sd->sample_timeout = cur_uptime + sc->sampling_period_ms;
 
+		if (is_ppi_seq_sensor(sc)) {
+			int err = sc->trigger ? -ENOTSUP : 0;
+
+			if (!err) {
+				update_sensor_state(sc, sd, SENSOR_STATE_ACTIVE);
+				err = ppi_seq_start(sc, sd);
+			}
+
+			if (err) {
+				update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				LOG_ERR("%s sensor cannot start sequencer (err %d)",
+					sc->dev->name, err);
+				continue;
+			}
+
+			alive_sensors++;
+			continue;
+		}
+
 		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
 			int err = sensor_trigger_init(sc, sd);
 
@@ -446,7 +634,19 @@ static bool handle_power_down_event(const struct app_event_header *aeh)
 
 		/* Locking the scheduler to prevent concurrent access to sensor state. */
 		k_sched_lock();
-		if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
+		if (is_ppi_seq_sensor(sc)) {
+			if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
+				int ret = ppi_seq_stop(sc);
+
+				if (ret) {
+					LOG_ERR("Sensor %s sequencer cannot be stopped (%d)",
+						sc->dev->name, ret);
+					update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				} else {
+					update_sensor_state(sc, sd, SENSOR_STATE_SLEEP);
+				}
+			}
+		} else if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
 			if (sc->trigger) {
 				enter_sleep(sc, sd);
 			} else if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
@@ -480,7 +680,19 @@ static bool handle_wake_up_event(const struct app_event_header *aeh)
 
 		/* Locking the scheduler to prevent concurrent access to sensor state. */
 		k_sched_lock();
-		if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
+		if (is_ppi_seq_sensor(sc)) {
+			if (atomic_get(&sd->state) == SENSOR_STATE_SLEEP) {
+				update_sensor_state(sc, sd, SENSOR_STATE_ACTIVE);
+
+				int ret = ppi_seq_start(sc, sd);
+
+				if (ret) {
+					LOG_ERR("Sensor %s sequencer cannot be started (%d)",
+						sc->dev->name, ret);
+					update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				}
+			}
+		} else if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
 			int ret = 0;
 
 			if (sc->trigger) {
@@ -536,7 +748,25 @@ static bool handle_set_sensor_period_event(const struct app_event_header *aeh)
 
 			sd->sampling_period = event->sampling_period;
 			sd->sample_timeout = k_uptime_get() + event->sampling_period;
-			if (sd->state == SENSOR_STATE_ACTIVE) {
+
+			if (is_ppi_seq_sensor(sc)) {
+				/* Restart the sequencer with the new period. */
+				k_sched_lock();
+				if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
+					int err = ppi_seq_stop(sc);
+
+					if (!err) {
+						err = ppi_seq_start(sc, sd);
+					}
+
+					if (err) {
+						LOG_ERR("Sensor %s sequencer cannot be restarted (%d)",
+							sc->dev->name, err);
+						update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+					}
+				}
+				k_sched_unlock();
+			} else if (sd->state == SENSOR_STATE_ACTIVE) {
 				k_sem_give(&can_sample);
 			}
 
@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
+#include <string.h>
 #include <debug/cpu_load.h>
 #include <zephyr/shell/shell.h>
 #include <helpers/nrfx_gppi.h>
@@ -13,6 +14,12 @@
 #include <hal/nrf_power.h>
 #include <debug/ppi_trace.h>
 #include <zephyr/logging/log.h>
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN
+#include <cmsis_core.h>
+#endif
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN_PROFILER
+#include <nrf_profiler.h>
+#endif
 
 LOG_MODULE_REGISTER(cpu_load, CONFIG_NRF_CPU_LOAD_LOG_LEVEL);
 
@@ -35,6 +42,296 @@ static bool ready;
 static struct k_work_delayable cpu_load_log;
 static uint32_t cycle_ref;
 
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN
+/* Maximum number of nested interrupts that are accounted separately. */
+#define IRQ_NESTING_MAX 8
+
+struct thread_slot {
+	const struct k_thread *thread;
+	uint32_t cyc;
+};
+
+/* The active time is split between threads and interrupt lines at every context switch
+ * and interrupt entry and exit, using system clock cycles as the total measurement does.
+ */
+static struct thread_slot thread_slots[CONFIG_NRF_CPU_LOAD_BREAKDOWN_THREADS];
+static struct thread_slot *thread_current;
+/* Cycles of threads that did not fit in the slots. */
+static uint32_t thread_other_cyc;
+static uint32_t irq_cyc[CONFIG_NUM_IRQS];
+/* Cycles of exceptions, for example SysTick or PendSV. */
+static uint32_t exc_cyc;
+static int16_t irq_stack[IRQ_NESTING_MAX];
+static uint8_t irq_depth;
+static uint32_t stamp;
+
+static void breakdown_account(void)
+{
+	uint32_t now = k_cycle_get_32();
+	uint32_t delta = now - stamp;
+
+	stamp = now;
+
+	if (irq_depth > 0) {
+		int16_t irq = irq_stack[MIN(irq_depth, IRQ_NESTING_MAX) - 1];
+
+		if (irq >= 0) {
+			irq_cyc[irq] += delta;
+		} else {
+			exc_cyc += delta;
+		}
+	} else if (thread_current != NULL) {
+		thread_current->cyc += delta;
+	} else {
+		thread_other_cyc += delta;
+	}
+}
+
+static struct thread_slot *thread_slot_get(const struct k_thread *thread)
+{
+	struct thread_slot *free_slot = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(thread_slots); i++) {
+		if (thread_slots[i].thread == thread) {
+			return &thread_slots[i];
+		}
+
+		if ((free_slot == NULL) && (thread_slots[i].thread == NULL)) {
+			free_slot = &thread_slots[i];
+		}
+	}
+
+	if (free_slot != NULL) {
+		free_slot->thread = thread;
+		free_slot->cyc = 0;
+	}
+
+	return free_slot;
+}
+
+void sys_trace_thread_switched_in_user(void)
+{
+	unsigned int key = irq_lock();
+
+	breakdown_account();
+	thread_current = thread_slot_get(k_current_get());
+
+	irq_unlock(key);
+}
+
+void sys_trace_thread_switched_out_user(void)
+{
+	unsigned int key = irq_lock();
+
+	breakdown_account();
+	thread_current = NULL;
+
+	irq_unlock(key);
+}
+
+void sys_trace_isr_enter_user(void)
+{
+	unsigned int key = irq_lock();
+	int irq = (int)__get_IPSR() - 16;
+
+	breakdown_account();
+
+	if (irq_depth < IRQ_NESTING_MAX) {
+		irq_stack[irq_depth] = (irq < CONFIG_NUM_IRQS) ? irq : -1;
+	}
+	irq_depth++;
+
+	irq_unlock(key);
+}
+
+void sys_trace_isr_exit_user(void)
+{
+	unsigned int key = irq_lock();
+
+	breakdown_account();
+
+	if (irq_depth > 0) {
+		irq_depth--;
+	}
+
+	irq_unlock(key);
+}
+
+static void breakdown_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	for (size_t i = 0; i < ARRAY_SIZE(thread_slots); i++) {
+		thread_slots[i].cyc = 0;
+	}
+	thread_other_cyc = 0;
+	exc_cyc = 0;
+	memset(irq_cyc, 0, sizeof(irq_cyc));
+	stamp = k_cycle_get_32();
+
+	irq_unlock(key);
+}
+
+static int cyc_to_load(uint32_t cyc)
+{
+	uint32_t total_cyc = k_cycle_get_32() - cycle_ref;
+
+	return (total_cyc > 0) ? (int)(((uint64_t)cyc * 100000) / total_cyc) : 0;
+}
+
+int cpu_load_thread_get(const struct k_thread *thread)
+{
+	uint32_t cyc = 0;
+	bool found = false;
+	unsigned int key;
+
+	if (!ready) {
+		return -ENODEV;
+	}
+
+	key = irq_lock();
+
+	/* Account the running context, so that the current thread is up to date. */
+	breakdown_account();
+
+	for (size_t i = 0; i < ARRAY_SIZE(thread_slots); i++) {
+		if (thread_slots[i].thread == thread) {
+			cyc = thread_slots[i].cyc;
+			found = true;
+			break;
+		}
+	}
+
+	irq_unlock(key);
+
+	return found ? cyc_to_load(cyc) : -ENOENT;
+}
+
+int cpu_load_irq_get(unsigned int irq)
+{
+	uint32_t cyc;
+	unsigned int key;
+
+	if (!ready) {
+		return -ENODEV;
+	}
+
+	if (irq >= CONFIG_NUM_IRQS) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	breakdown_account();
+	cyc = irq_cyc[irq];
+	irq_unlock(key);
+
+	return cyc_to_load(cyc);
+}
+
+static int cpu_load_other_get(uint32_t *other_cyc)
+{
+	uint32_t cyc;
+	unsigned int key = irq_lock();
+
+	breakdown_account();
+	cyc = *other_cyc;
+	irq_unlock(key);
+
+	return cyc_to_load(cyc);
+}
+
+static const char *thread_name_get(struct k_thread *thread)
+{
+	const char *name = k_thread_name_get(thread);
+
+	return ((name != NULL) && (name[0] != '\0')) ? name : "unknown";
+}
+#endif /* CONFIG_NRF_CPU_LOAD_BREAKDOWN */
+
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN_PROFILER
+static struct k_work_delayable profiler_work;
+static uint16_t profiler_load_id;
+static uint16_t profiler_thread_id;
+static uint16_t profiler_irq_id;
+
+static void profiler_thread_send(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	struct log_event_buf buf;
+	int load = cpu_load_thread_get(thread);
+
+	if (load < 0) {
+		return;
+	}
+
+	nrf_profiler_log_start(&buf);
+	nrf_profiler_log_encode_string(&buf, thread_name_get(thread));
+	nrf_profiler_log_encode_uint32(&buf, load);
+	nrf_profiler_log_send(&buf, profiler_thread_id);
+}
+
+static void profiler_work_fn(struct k_work *item)
+{
+	struct log_event_buf buf;
+	int load = cpu_load_get();
+
+	if (load < 0) {
+		return;
+	}
+
+	if (is_profiling_enabled(profiler_load_id)) {
+		nrf_profiler_log_start(&buf);
+		nrf_profiler_log_encode_uint32(&buf, load);
+		nrf_profiler_log_send(&buf, profiler_load_id);
+	}
+
+	if (is_profiling_enabled(profiler_thread_id)) {
+		k_thread_foreach_unlocked(profiler_thread_send, NULL);
+	}
+
+	if (is_profiling_enabled(profiler_irq_id)) {
+		for (unsigned int irq = 0; irq < CONFIG_NUM_IRQS; irq++) {
+			load = cpu_load_irq_get(irq);
+			if (load <= 0) {
+				continue;
+			}
+
+			nrf_profiler_log_start(&buf);
+			nrf_profiler_log_encode_uint16(&buf, irq);
+			nrf_profiler_log_encode_uint32(&buf, load);
+			nrf_profiler_log_send(&buf, profiler_irq_id);
+		}
+	}
+
+	cpu_load_reset();
+	k_work_schedule(&profiler_work, K_MSEC(CONFIG_NRF_CPU_LOAD_BREAKDOWN_PROFILER_INTERVAL));
+}
+
+static int profiler_init(void)
+{
+	static const char * const load_labels[] = {"load"};
+	static const enum nrf_profiler_arg load_types[] = {NRF_PROFILER_ARG_U32};
+	static const char * const thread_labels[] = {"thread", "load"};
+	static const enum nrf_profiler_arg thread_types[] = {NRF_PROFILER_ARG_STRING,
+							     NRF_PROFILER_ARG_U32};
+	static const char * const irq_labels[] = {"irq", "load"};
+	static const enum nrf_profiler_arg irq_types[] = {NRF_PROFILER_ARG_U16,
+							  NRF_PROFILER_ARG_U32};
+
+	profiler_load_id = nrf_profiler_register_event_type("cpu_load", load_labels,
+							    load_types, ARRAY_SIZE(load_labels));
+	profiler_thread_id = nrf_profiler_register_event_type("cpu_load_thread", thread_labels,
+							      thread_types,
+							      ARRAY_SIZE(thread_labels));
+	profiler_irq_id = nrf_profiler_register_event_type("cpu_load_irq", irq_labels,
+							   irq_types, ARRAY_SIZE(irq_labels));
+
+	k_work_init_delayable(&profiler_work, profiler_work_fn);
+	return k_work_schedule(&profiler_work,
+			       K_MSEC(CONFIG_NRF_CPU_LOAD_BREAKDOWN_PROFILER_INTERVAL));
+}
+#endif /* CONFIG_NRF_CPU_LOAD_BREAKDOWN_PROFILER */
+
 static void cpu_load_log_fn(struct k_work *item)
 {
 	int load = cpu_load_get();
@@ -148,6 +445,15 @@ int cpu_load_init_internal(void)
 		}
 	}
 
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN_PROFILER
+	if (ret == 0) {
+		ret = profiler_init();
+		if (ret >= 0) {
+			ret = 0;
+		}
+	}
+#endif
+
 	ready = true;
 
 	return ret;
@@ -162,6 +468,10 @@ void cpu_load_reset(void)
 {
 	nrfx_timer_clear(&timer);
 	cycle_ref = k_cycle_get_32();
+
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN
+	breakdown_reset();
+#endif
 }
 
 static uint32_t sleep_ticks_to_us(uint32_t ticks)
@@ -220,6 +530,78 @@ static int cmd_cpu_load_get(const struct shell *shell, size_t argc, char **argv)
 	return 0;
 }
 
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN
+struct top_entry {
+	struct k_thread *thread;
+	int load;
+};
+
+struct top_ctx {
+	struct top_entry entries[CONFIG_NRF_CPU_LOAD_BREAKDOWN_THREADS];
+	size_t cnt;
+};
+
+static void top_thread_add(const struct k_thread *cthread, void *user_data)
+{
+	struct top_ctx *ctx = user_data;
+	struct k_thread *thread = (struct k_thread *)cthread;
+	int load = cpu_load_thread_get(thread);
+	size_t i;
+
+	if ((load < 0) || (ctx->cnt == ARRAY_SIZE(ctx->entries))) {
+		return;
+	}
+
+	/* Keep the entries sorted by descending load. */
+	for (i = ctx->cnt; (i > 0) && (ctx->entries[i - 1].load < load); i--) {
+		ctx->entries[i] = ctx->entries[i - 1];
+	}
+
+	ctx->entries[i].thread = thread;
+	ctx->entries[i].load = load;
+	ctx->cnt++;
+}
+
+static int cmd_cpu_load_top(const struct shell *shell, size_t argc, char **argv)
+{
+	static struct top_ctx ctx;
+	int load;
+
+	load = cpu_load_get();
+	if (load < 0) {
+		shell_error(shell, "Not initialized.");
+		return 0;
+	}
+
+	shell_print(shell, "CPU load:%d,%03d%%", load / 1000, load % 1000);
+
+	ctx.cnt = 0;
+	k_thread_foreach_unlocked(top_thread_add, &ctx);
+
+	shell_print(shell, "%-32s %10s", "Thread", "Load");
+	for (size_t i = 0; i < ctx.cnt; i++) {
+		load = ctx.entries[i].load;
+		shell_print(shell, "%-32s %6d,%03d%%", thread_name_get(ctx.entries[i].thread),
+			    load / 1000, load % 1000);
+	}
+
+	shell_print(shell, "%-32s %10s", "IRQ", "Load");
+	for (unsigned int irq = 0; irq < CONFIG_NUM_IRQS; irq++) {
+		load = cpu_load_irq_get(irq);
+		if (load > 0) {
+			shell_print(shell, "%-32u %6d,%03d%%", irq, load / 1000, load % 1000);
+		}
+	}
+
+	load = cpu_load_other_get(&exc_cyc);
+	shell_print(shell, "%-32s %6d,%03d%%", "Exceptions", load / 1000, load % 1000);
+	load = cpu_load_other_get(&thread_other_cyc);
+	shell_print(shell, "%-32s %6d,%03d%%", "Untracked threads", load / 1000, load % 1000);
+
+	return 0;
+}
+#endif /* CONFIG_NRF_CPU_LOAD_BREAKDOWN */
+
 static int cmd_cpu_load_reset(const struct shell *shell,
 				size_t argc, char **argv)
 {
@@ -236,6 +618,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmd_cpu_load,
 			cmd_cpu_load_reset, 1, 0),
 	SHELL_CMD_ARG(init, NULL, "Init",
 			cmd_cpu_load_reset, 1, 0),
+#ifdef CONFIG_NRF_CPU_LOAD_BREAKDOWN
+	SHELL_CMD_ARG(top, NULL, "Get load of threads and interrupts",
+			cmd_cpu_load_top, 1, 0),
+#endif
 	SHELL_SUBCMD_SET_END
 );
 
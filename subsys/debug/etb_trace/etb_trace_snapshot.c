@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/shell/shell.h>
+#include <debug/etb_trace.h>
+
+#include "etb_trace_private.h"
+
+#define SNAPSHOT_WORDS (ETB_BUFFER_SIZE / sizeof(uint32_t))
+#define SNAPSHOT_COUNT CONFIG_ETB_TRACE_SNAPSHOT_COUNT
+
+/* Snapshots of the ETB RAM, each one the ETB content at the time of the snapshot starting
+ * from the oldest word. The oldest snapshot is overwritten when the ring is full.
+ */
+static uint32_t snapshots[SNAPSHOT_COUNT][SNAPSHOT_WORDS];
+static uint8_t snapshot_head;
+static uint8_t snapshot_cnt;
+static uint32_t snapshot_seq;
+static struct k_spinlock lock;
+
+static void snapshot_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(snapshot_work, snapshot_work_fn);
+
+void etb_trace_snapshot_take(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t *buf = snapshots[(snapshot_head + snapshot_cnt) % SNAPSHOT_COUNT];
+
+	if (snapshot_cnt == SNAPSHOT_COUNT) {
+		snapshot_head = (snapshot_head + 1) % SNAPSHOT_COUNT;
+	} else {
+		snapshot_cnt++;
+	}
+
+	/* Tracing is stopped for the read, so that the ETB is flushed and the content is
+	 * not overwritten while it is read. The trace restarts with a synchronization
+	 * sequence, so every snapshot can be decoded on its own.
+	 */
+	etb_trace_stop();
+	(void)etb_data_get(buf, SNAPSHOT_WORDS);
+	etb_trace_start();
+
+	snapshot_seq++;
+
+	k_spin_unlock(&lock, key);
+}
+
+int etb_trace_snapshot_get(uint32_t *buf, size_t buf_size, uint32_t *seq)
+{
+	k_spinlock_key_t key;
+	size_t len;
+
+	if (buf == NULL || buf_size == 0) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (snapshot_cnt == 0) {
+		k_spin_unlock(&lock, key);
+		return -ENODATA;
+	}
+
+	len = MIN(buf_size, SNAPSHOT_WORDS);
+	memcpy(buf, snapshots[snapshot_head], len * sizeof(uint32_t));
+
+	if (seq != NULL) {
+		*seq = snapshot_seq - snapshot_cnt;
+	}
+
+	snapshot_head = (snapshot_head + 1) % SNAPSHOT_COUNT;
+	snapshot_cnt--;
+
+	k_spin_unlock(&lock, key);
+
+	return len;
+}
+
+static void snapshot_work_fn(struct k_work *work)
+{
+	etb_trace_snapshot_take();
+
+	(void)k_work_schedule(&snapshot_work, K_MSEC(CONFIG_ETB_TRACE_SNAPSHOT_INTERVAL_MS));
+}
+
+static int snapshot_init(void)
+{
+	if (CONFIG_ETB_TRACE_SNAPSHOT_INTERVAL_MS > 0) {
+		(void)k_work_schedule(&snapshot_work,
+				      K_MSEC(CONFIG_ETB_TRACE_SNAPSHOT_INTERVAL_MS));
+	}
+
+	return 0;
+}
+
+SYS_INIT(snapshot_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#if defined(CONFIG_ETB_TRACE_SNAPSHOT_SHELL)
+/* Words printed per line. The format is parsed by scripts/etb_trace/etb_hot_functions.py. */
+#define DUMP_WORDS_PER_LINE 8
+
+static int cmd_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	static uint32_t buf[SNAPSHOT_WORDS];
+	uint32_t seq;
+	int len;
+	int cnt = 0;
+
+	while ((len = etb_trace_snapshot_get(buf, ARRAY_SIZE(buf), &seq)) > 0) {
+		shell_print(sh, "ETB snapshot %u (%d words)", seq, len);
+
+		for (int i = 0; i < len; i += DUMP_WORDS_PER_LINE) {
+			shell_print(sh, "%08x %08x %08x %08x %08x %08x %08x %08x",
+				    buf[i], buf[i + 1], buf[i + 2], buf[i + 3],
+				    buf[i + 4], buf[i + 5], buf[i + 6], buf[i + 7]);
+		}
+
+		cnt++;
+	}
+
+	shell_print(sh, "%d snapshots dumped", cnt);
+
+	return 0;
+}
+
+static int cmd_take(const struct shell *sh, size_t argc, char **argv)
+{
+	etb_trace_snapshot_take();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_etb_trace,
+	SHELL_CMD_ARG(take, NULL, "Take a snapshot of the ETB", cmd_take, 1, 0),
+	SHELL_CMD_ARG(dump, NULL, "Print and release the stored snapshots", cmd_dump, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(etb_trace, &sub_etb_trace, "ETB trace snapshots", NULL);
+#endif /* defined(CONFIG_ETB_TRACE_SNAPSHOT_SHELL) */
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <helpers/nrfx_gppi.h>
+#include <nrfx_timer.h>
+
+#include <debug/ppi_trace.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(ppi_trace, CONFIG_PPI_TRACE_LOG_LEVEL);
+
+#define TIMER_INSTANCE	CONFIG_PPI_TRACE_LATENCY_TIMER_INSTANCE
+#define BUCKET_NS	CONFIG_PPI_TRACE_LATENCY_BUCKET_NS
+#define BUCKET_COUNT	CONFIG_PPI_TRACE_LATENCY_BUCKET_COUNT
+
+BUILD_ASSERT(2 * CONFIG_PPI_TRACE_LATENCY_CNT <= NRF_TIMER_CC_CHANNEL_COUNT(TIMER_INSTANCE),
+	     "Not enough TIMER capture channels for the event pairs");
+
+struct latency_meas {
+	const char *name;
+	bool sw_stop;
+	uint32_t last_stop;
+	uint32_t cnt;
+	uint32_t min_ns;
+	uint32_t max_ns;
+	uint64_t sum_ns;
+	uint32_t hist[BUCKET_COUNT];
+};
+
+static nrfx_timer_t timer = NRFX_TIMER_INSTANCE(NRF_TIMER_INST_GET(TIMER_INSTANCE));
+static uint32_t timer_freq;
+static bool timer_ready;
+static struct latency_meas meas[CONFIG_PPI_TRACE_LATENCY_CNT];
+static atomic_t meas_cnt;
+static struct k_spinlock lock;
+
+static void poll_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(poll_work, poll_work_fn);
+
+static nrf_timer_cc_channel_t start_cc(const struct latency_meas *m)
+{
+	return (nrf_timer_cc_channel_t)(2 * (m - meas));
+}
+
+static nrf_timer_cc_channel_t stop_cc(const struct latency_meas *m)
+{
+	return (nrf_timer_cc_channel_t)(2 * (m - meas) + 1);
+}
+
+static void meas_reset(struct latency_meas *m)
+{
+	m->cnt = 0;
+	m->min_ns = UINT32_MAX;
+	m->max_ns = 0;
+	m->sum_ns = 0;
+	memset(m->hist, 0, sizeof(m->hist));
+}
+
+static void sample_add(struct latency_meas *m, uint32_t start, uint32_t stop)
+{
+	uint32_t ticks = stop - start;
+	uint64_t latency_ns = ((uint64_t)ticks * NSEC_PER_SEC) / timer_freq;
+
+	/* A start event captured after the stop event belongs to the next pair. */
+	if (latency_ns > (uint64_t)CONFIG_PPI_TRACE_LATENCY_TIMEOUT_US * NSEC_PER_USEC) {
+		return;
+	}
+
+	m->cnt++;
+	m->min_ns = MIN(m->min_ns, (uint32_t)latency_ns);
+	m->max_ns = MAX(m->max_ns, (uint32_t)latency_ns);
+	m->sum_ns += latency_ns;
+	m->hist[MIN(latency_ns / BUCKET_NS, BUCKET_COUNT - 1)]++;
+}
+
+static void poll_work_fn(struct k_work *work)
+{
+	size_t cnt = MIN(atomic_get(&meas_cnt), CONFIG_PPI_TRACE_LATENCY_CNT);
+
+	for (size_t i = 0; i < cnt; i++) {
+		struct latency_meas *m = &meas[i];
+
+		if (m->sw_stop) {
+			continue;
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		uint32_t stop = nrfx_timer_capture_get(&timer, stop_cc(m));
+		uint32_t start = nrfx_timer_capture_get(&timer, start_cc(m));
+
+		/* Skip the capture if the stop event occurred while the registers were read. */
+		if ((stop != m->last_stop) && (stop == nrfx_timer_capture_get(&timer, stop_cc(m)))) {
+			m->last_stop = stop;
+			sample_add(m, start, stop);
+		}
+
+		k_spin_unlock(&lock, key);
+	}
+
+	(void)k_work_reschedule(&poll_work, K_MSEC(CONFIG_PPI_TRACE_LATENCY_POLL_INTERVAL_MS));
+}
+
+static int timer_init(void)
+{
+	uint32_t base_frequency = NRF_TIMER_BASE_FREQUENCY_GET(timer.p_reg);
+	nrfx_timer_config_t config = NRFX_TIMER_DEFAULT_CONFIG(base_frequency);
+	int err;
+
+	config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+	err = nrfx_timer_init(&timer, &config, NULL);
+	if (err != 0) {
+		LOG_ERR("Failed to initialize TIMER.");
+		return -EBUSY;
+	}
+
+	timer_freq = base_frequency;
+	nrfx_timer_enable(&timer);
+
+	return 0;
+}
+
+static int conn_setup(uint32_t evt, uint32_t tep)
+{
+	nrfx_gppi_handle_t handle;
+
+	if (nrfx_gppi_conn_alloc(evt, tep, &handle) < 0) {
+		LOG_ERR("Failed to allocate GPPI channel.");
+		return -ENOMEM;
+	}
+
+	nrfx_gppi_conn_enable(handle);
+
+	return 0;
+}
+
+void *ppi_trace_latency_config(const char *name, uint32_t start_evt, uint32_t stop_evt)
+{
+	uint32_t idx = atomic_inc(&meas_cnt);
+	struct latency_meas *m;
+
+	/* All slots taken. */
+	if (idx >= CONFIG_PPI_TRACE_LATENCY_CNT) {
+		return NULL;
+	}
+
+	if (!timer_ready) {
+		if (timer_init() < 0) {
+			return NULL;
+		}
+		timer_ready = true;
+	}
+
+	m = &meas[idx];
+	m->name = name;
+	m->sw_stop = (stop_evt == 0);
+	m->last_stop = nrfx_timer_capture_get(&timer, stop_cc(m));
+	meas_reset(m);
+
+	if (conn_setup(start_evt, nrfx_timer_task_address_get(&timer,
+				nrf_timer_capture_task_get(start_cc(m)))) < 0) {
+		return NULL;
+	}
+
+	if (!m->sw_stop) {
+		if (conn_setup(stop_evt, nrfx_timer_task_address_get(&timer,
+					nrf_timer_capture_task_get(stop_cc(m)))) < 0) {
+			return NULL;
+		}
+
+		(void)k_work_schedule(&poll_work,
+				      K_MSEC(CONFIG_PPI_TRACE_LATENCY_POLL_INTERVAL_MS));
+	}
+
+	return m;
+}
+
+void ppi_trace_latency_stop(void *handle)
+{
+	struct latency_meas *m = handle;
+
+	__ASSERT_NO_MSG(m->sw_stop);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t stop = nrfx_timer_capture(&timer, stop_cc(m));
+
+	sample_add(m, nrfx_timer_capture_get(&timer, start_cc(m)), stop);
+	k_spin_unlock(&lock, key);
+}
+
+static uint32_t percentile_get(const struct latency_meas *m, uint8_t percentile)
+{
+	/* Rank of the sample, rounded up. */
+	uint32_t rank = DIV_ROUND_UP((uint64_t)m->cnt * percentile, 100);
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < BUCKET_COUNT - 1; i++) {
+		sum += m->hist[i];
+
+		if (sum >= rank) {
+			/* Report the upper bound of the bucket. */
+			return MIN((i + 1) * BUCKET_NS, m->max_ns);
+		}
+	}
+
+	return m->max_ns;
+}
+
+void ppi_trace_latency_stats_get(void *handle, struct ppi_trace_latency_stats *stats)
+{
+	const struct latency_meas *m = handle;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(stats, 0, sizeof(*stats));
+	stats->name = m->name;
+	stats->cnt = m->cnt;
+
+	if (m->cnt > 0) {
+		stats->min_ns = m->min_ns;
+		stats->max_ns = m->max_ns;
+		stats->avg_ns = m->sum_ns / m->cnt;
+		stats->p50_ns = percentile_get(m, 50);
+		stats->p90_ns = percentile_get(m, 90);
+		stats->p99_ns = percentile_get(m, 99);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void ppi_trace_latency_reset(void *handle)
+{
+	struct latency_meas *m = handle;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	meas_reset(m);
+	k_spin_unlock(&lock, key);
+}
+
+#if defined(CONFIG_PPI_TRACE_LATENCY_SHELL)
+static int cmd_latency_show(const struct shell *sh, size_t argc, char **argv)
+{
+	size_t cnt = MIN(atomic_get(&meas_cnt), CONFIG_PPI_TRACE_LATENCY_CNT);
+	struct ppi_trace_latency_stats stats;
+
+	if (cnt == 0) {
+		shell_print(sh, "No event pairs configured");
+		return 0;
+	}
+
+	shell_print(sh, "%-16s %10s %10s %10s %10s %10s %10s %10s", "Name", "Count",
+		    "Min [ns]", "Avg [ns]", "P50 [ns]", "P90 [ns]", "P99 [ns]", "Max [ns]");
+
+	for (size_t i = 0; i < cnt; i++) {
+		ppi_trace_latency_stats_get(&meas[i], &stats);
+		shell_print(sh, "%-16s %10u %10u %10u %10u %10u %10u %10u",
+			    stats.name ? stats.name : "", stats.cnt, stats.min_ns, stats.avg_ns,
+			    stats.p50_ns, stats.p90_ns, stats.p99_ns, stats.max_ns);
+	}
+
+	return 0;
+}
+
+static int cmd_latency_hist(const struct shell *sh, size_t argc, char **argv)
+{
+	size_t cnt = MIN(atomic_get(&meas_cnt), CONFIG_PPI_TRACE_LATENCY_CNT);
+
+	for (size_t i = 0; i < cnt; i++) {
+		const struct latency_meas *m = &meas[i];
+		uint32_t hist[BUCKET_COUNT];
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		memcpy(hist, m->hist, sizeof(hist));
+		k_spin_unlock(&lock, key);
+
+		shell_print(sh, "%s:", m->name ? m->name : "");
+		for (size_t j = 0; j < BUCKET_COUNT; j++) {
+			if (hist[j] == 0) {
+				continue;
+			}
+
+			if (j == BUCKET_COUNT - 1) {
+				shell_print(sh, "  >= %u ns: %u", j * BUCKET_NS, hist[j]);
+			} else {
+				shell_print(sh, "  < %u ns: %u", (j + 1) * BUCKET_NS, hist[j]);
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_latency_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	size_t cnt = MIN(atomic_get(&meas_cnt), CONFIG_PPI_TRACE_LATENCY_CNT);
+
+	for (size_t i = 0; i < cnt; i++) {
+		ppi_trace_latency_reset(&meas[i]);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_latency,
+	SHELL_CMD_ARG(show, NULL, "Show latency statistics", cmd_latency_show, 1, 0),
+	SHELL_CMD_ARG(hist, NULL, "Show latency histograms", cmd_latency_hist, 1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset latency statistics", cmd_latency_reset, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_ppi_trace,
+	SHELL_CMD(latency, &sub_latency, "Hardware event latency measurement", NULL),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(ppi_trace, &sub_ppi_trace, "PPI trace commands", NULL);
+#endif /* defined(CONFIG_PPI_TRACE_LATENCY_SHELL) */
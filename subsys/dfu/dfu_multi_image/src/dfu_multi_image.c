@@ -5,6 +5,7 @@
  */
 
 #include <dfu/dfu_multi_image.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
@@ -163,6 +164,246 @@ static int save_image_finished(uint8_t image_no)
 
 #endif
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+
+enum pipeline_op_type {
+	PIPELINE_OP_OPEN,
+	PIPELINE_OP_WRITE,
+	PIPELINE_OP_CLOSE,
+	PIPELINE_OP_SYNC,
+};
+
+struct pipeline_op {
+	enum pipeline_op_type type;
+	const struct dfu_image_writer *writer;
+	/* Image size for open, data size for write */
+	size_t size;
+	uint8_t *buf;
+	bool success;
+};
+
+struct pipeline_ctx {
+	/* Buffer being filled with the data of the current image */
+	const struct dfu_image_writer *writer;
+	uint8_t *buf;
+	size_t len;
+
+	/* First error reported by the pipeline thread */
+	atomic_t err;
+};
+
+BUILD_ASSERT(CONFIG_DFU_MULTI_IMAGE_PIPELINE_BUF_SIZE % 4 == 0,
+	     "Pipeline buffer size must be a multiple of 4");
+
+K_MEM_SLAB_DEFINE_STATIC(pipeline_slab, CONFIG_DFU_MULTI_IMAGE_PIPELINE_BUF_SIZE,
+			 CONFIG_DFU_MULTI_IMAGE_PIPELINE_BUF_COUNT, 4);
+K_MSGQ_DEFINE(pipeline_msgq, sizeof(struct pipeline_op),
+	      CONFIG_DFU_MULTI_IMAGE_PIPELINE_BUF_COUNT + 2, 4);
+static K_SEM_DEFINE(pipeline_sync_sem, 0, 1);
+
+static struct pipeline_ctx pipeline;
+
+static void pipeline_thread(void *p1, void *p2, void *p3)
+{
+	struct pipeline_op op;
+	const struct dfu_image_writer *opened = NULL;
+	int err;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_msgq_get(&pipeline_msgq, &op, K_FOREVER);
+
+		if (op.type == PIPELINE_OP_SYNC) {
+			/* The caller finishes the current image itself */
+			opened = NULL;
+			k_sem_give(&pipeline_sync_sem);
+			continue;
+		}
+
+		err = 0;
+
+		/* After an error, drop everything until the pipeline is flushed */
+		if (atomic_get(&pipeline.err) == 0) {
+			switch (op.type) {
+			case PIPELINE_OP_OPEN:
+				err = op.writer->open(op.writer->image_id, op.size);
+				if (!err) {
+					opened = op.writer;
+				}
+				break;
+			case PIPELINE_OP_WRITE:
+				err = op.writer->write(op.buf, op.size);
+				break;
+			case PIPELINE_OP_CLOSE:
+				opened = NULL;
+				err = op.writer->close(op.success);
+				break;
+			default:
+				break;
+			}
+		}
+
+		if (op.type == PIPELINE_OP_WRITE) {
+			k_mem_slab_free(&pipeline_slab, op.buf);
+		}
+
+		if (err) {
+			LOG_ERR("Writing image %d failed (err %d)", op.writer->image_id, err);
+
+			if (opened != NULL) {
+				(void)opened->close(false);
+				opened = NULL;
+			}
+
+			atomic_set(&pipeline.err, err);
+		}
+	}
+}
+
+K_THREAD_DEFINE(dfu_multi_image_pipeline, CONFIG_DFU_MULTI_IMAGE_PIPELINE_STACK_SIZE,
+		pipeline_thread, NULL, NULL, NULL, CONFIG_DFU_MULTI_IMAGE_PIPELINE_THREAD_PRIO,
+		0, 0);
+
+static void pipeline_submit(const struct pipeline_op *op)
+{
+	/* Blocks until the pipeline thread catches up */
+	(void)k_msgq_put(&pipeline_msgq, op, K_FOREVER);
+}
+
+static void pipeline_buf_submit(bool write)
+{
+	if (pipeline.buf == NULL) {
+		return;
+	}
+
+	if (write) {
+		struct pipeline_op op = {
+			.type = PIPELINE_OP_WRITE,
+			.writer = pipeline.writer,
+			.size = pipeline.len,
+			.buf = pipeline.buf,
+		};
+
+		pipeline_submit(&op);
+	} else {
+		k_mem_slab_free(&pipeline_slab, pipeline.buf);
+	}
+
+	pipeline.buf = NULL;
+	pipeline.len = 0;
+}
+
+/* Wait for the pipeline thread to process all queued data */
+static int pipeline_flush(bool write)
+{
+	struct pipeline_op op = {
+		.type = PIPELINE_OP_SYNC,
+	};
+
+	pipeline_buf_submit(write);
+	pipeline_submit(&op);
+	(void)k_sem_take(&pipeline_sync_sem, K_FOREVER);
+
+	return (int)atomic_get(&pipeline.err);
+}
+
+static void pipeline_reset(void)
+{
+	(void)pipeline_flush(false);
+	atomic_clear(&pipeline.err);
+	pipeline.writer = NULL;
+}
+
+static int image_open(const struct dfu_image_writer *writer, size_t image_size)
+{
+	struct pipeline_op op = {
+		.type = PIPELINE_OP_OPEN,
+		.writer = writer,
+		.size = image_size,
+	};
+	int err = (int)atomic_get(&pipeline.err);
+
+	if (err) {
+		return err;
+	}
+
+	pipeline.writer = writer;
+	pipeline_submit(&op);
+
+	return 0;
+}
+
+static int image_write(const struct dfu_image_writer *writer, const uint8_t *chunk,
+		       size_t chunk_size)
+{
+	int err = (int)atomic_get(&pipeline.err);
+
+	if (err) {
+		return err;
+	}
+
+	while (chunk_size > 0) {
+		size_t len;
+
+		if (pipeline.buf == NULL) {
+			err = k_mem_slab_alloc(&pipeline_slab, (void **)&pipeline.buf, K_FOREVER);
+			if (err) {
+				return err;
+			}
+		}
+
+		len = MIN(chunk_size, CONFIG_DFU_MULTI_IMAGE_PIPELINE_BUF_SIZE - pipeline.len);
+		memcpy(pipeline.buf + pipeline.len, chunk, len);
+		pipeline.len += len;
+		chunk += len;
+		chunk_size -= len;
+
+		if (pipeline.len == CONFIG_DFU_MULTI_IMAGE_PIPELINE_BUF_SIZE) {
+			pipeline_buf_submit(true);
+		}
+	}
+
+	return 0;
+}
+
+static int image_close(const struct dfu_image_writer *writer, bool success)
+{
+	struct pipeline_op op = {
+		.type = PIPELINE_OP_CLOSE,
+		.writer = writer,
+		.success = success,
+	};
+
+	pipeline_buf_submit(success);
+	pipeline_submit(&op);
+	pipeline.writer = NULL;
+
+	return (int)atomic_get(&pipeline.err);
+}
+
+#else
+
+static int image_open(const struct dfu_image_writer *writer, size_t image_size)
+{
+	return writer->open(writer->image_id, image_size);
+}
+
+static int image_write(const struct dfu_image_writer *writer, const uint8_t *chunk,
+		       size_t chunk_size)
+{
+	return writer->write(chunk, chunk_size);
+}
+
+static int image_close(const struct dfu_image_writer *writer, bool success)
+{
+	return writer->close(success);
+}
+
+#endif /* CONFIG_DFU_MULTI_IMAGE_PIPELINE */
+
 static const struct dfu_image_writer *current_image_writer(void)
 {
 	if (ctx.cur_image_no >= 0 && (size_t)ctx.cur_image_no < ctx.header.image_count) {
@@ -223,20 +464,19 @@ static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 		}
 
 		if (!err && ctx.cur_item_offset == 0 && !ctx.cur_item_opened) {
-			err = writer->open(writer->image_id,
-					   ctx.header.images[ctx.cur_image_no].size);
+			err = image_open(writer, ctx.header.images[ctx.cur_image_no].size);
 			ctx.cur_item_opened = true;
 		}
 
 		if (!err) {
-			err = writer->write(chunk, chunk_size);
+			err = image_write(writer, chunk, chunk_size);
 		}
 
 		if (!err && ctx.cur_item_offset + chunk_size == ctx.cur_item_size) {
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
 			save_image_finished((uint8_t) ctx.cur_image_no);
 #endif
-			err = writer->close(true);
+			err = image_close(writer, true);
 			ctx.cur_item_opened = false;
 		}
 	}
@@ -457,6 +697,11 @@ int dfu_multi_image_init(uint8_t *buffer, size_t buffer_size)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	/* Queued data refers to the writers of the previous package */
+	pipeline_reset();
+#endif
+
 	memset(&ctx, 0, sizeof(ctx));
 	ctx.buffer = buffer;
 	ctx.buffer_size = buffer_size;
@@ -550,6 +795,14 @@ int dfu_multi_image_done(bool success)
 	const struct dfu_image_writer *writer = current_image_writer();
 	int err = 0;
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	err = pipeline_flush(success);
+	if (err) {
+		/* The failed writer has already been closed */
+		return err;
+	}
+#endif /* CONFIG_DFU_MULTI_IMAGE_PIPELINE */
+
 	/* Close any active writer if such exists */
 	if (writer != NULL) {
 		err = writer->close(success);
@@ -574,6 +827,10 @@ int dfu_multi_image_reset(void)
 	int err = 0;
 	const struct dfu_image_writer *writer = current_image_writer();
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	pipeline_reset();
+#endif
+
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
 	settings_subsys_init();
 	err = settings_clear();
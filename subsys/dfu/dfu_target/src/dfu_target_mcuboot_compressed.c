@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <nrf_compress/implementation.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_mcuboot_compressed.h>
+
+LOG_MODULE_REGISTER(dfu_target_mcuboot_compressed, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+#define HEADER_SIZE sizeof(struct dfu_target_mcuboot_compressed_header)
+
+static struct nrf_compress_implementation *lzma;
+static struct nrf_compress_implementation *arm_thumb;
+
+static uint8_t header_buf[HEADER_SIZE];
+static size_t header_bytes;
+static uint32_t image_size;
+
+/* Compressed data waiting for the decompressor, at most decompress_bytes_needed() bytes. */
+static uint8_t input_buf[CONFIG_NRF_COMPRESS_CHUNK_SIZE];
+static size_t input_bytes;
+
+/* Compressed bytes received, including the header. */
+static size_t bytes_received;
+/* Decompressed bytes written to the secondary slot. */
+static size_t bytes_written;
+
+static int curr_img_num;
+static bool mcuboot_initialized;
+
+bool dfu_target_mcuboot_compressed_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC;
+}
+
+static void decompressor_deinit(void)
+{
+	if (lzma != NULL) {
+		(void)lzma->deinit(NULL);
+		lzma = NULL;
+	}
+
+	if (arm_thumb != NULL) {
+		(void)arm_thumb->deinit(NULL);
+		arm_thumb = NULL;
+	}
+}
+
+static void state_reset(void)
+{
+	decompressor_deinit();
+
+	header_bytes = 0;
+	image_size = 0;
+	input_bytes = 0;
+	bytes_received = 0;
+	bytes_written = 0;
+}
+
+static int image_write(const uint8_t *buf, size_t len)
+{
+	int err;
+
+	if (len > image_size - bytes_written) {
+		LOG_ERR("Decompressed data exceeds image size %u", image_size);
+		return -EINVAL;
+	}
+
+	err = dfu_target_mcuboot_write(buf, len);
+	if (err) {
+		return err;
+	}
+
+	bytes_written += len;
+
+	return 0;
+}
+
+static int output_write(const uint8_t *buf, size_t len, bool last_part)
+{
+	int err;
+	size_t pos = 0;
+
+	if (arm_thumb == NULL) {
+		return len > 0 ? image_write(buf, len) : 0;
+	}
+
+	if (len == 0) {
+		if (!last_part) {
+			return 0;
+		}
+
+		/* Flush the bytes held back by the filter */
+		buf = input_buf;
+	}
+
+	do {
+		size_t chunk = MIN(len - pos, CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+		uint32_t offset;
+		uint8_t *output;
+		size_t output_size;
+
+		err = arm_thumb->decompress(NULL, &buf[pos], chunk, last_part && pos + chunk == len,
+					    &offset, &output, &output_size);
+		if (err) {
+			LOG_ERR("ARM thumb filter failed, err %d", err);
+			return err;
+		}
+
+		if (output_size > 0) {
+			err = image_write(output, output_size);
+			if (err) {
+				return err;
+			}
+		}
+
+		pos += offset;
+	} while (pos < len);
+
+	return 0;
+}
+
+static int input_decompress(bool last_part)
+{
+	int err;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+
+	err = lzma->decompress(NULL, input_buf, input_bytes, last_part, &offset, &output,
+			       &output_size);
+	if (err) {
+		LOG_ERR("Decompression failed, err %d", err);
+		return err;
+	}
+
+	if (offset == 0 || offset > input_bytes) {
+		LOG_ERR("Decompression made no progress");
+		return -EINVAL;
+	}
+
+	input_bytes -= offset;
+	memmove(input_buf, &input_buf[offset], input_bytes);
+
+	return output_write(output, output_size, last_part && input_bytes == 0);
+}
+
+static int header_parse(void)
+{
+	int err;
+	size_t offset;
+	struct dfu_target_mcuboot_compressed_header *header =
+		(struct dfu_target_mcuboot_compressed_header *)header_buf;
+	uint32_t flags = sys_le32_to_cpu(header->flags);
+
+	image_size = sys_le32_to_cpu(header->image_size);
+
+	if (sys_le32_to_cpu(header->magic) != DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC) {
+		LOG_ERR("Invalid compressed image magic");
+		return -EINVAL;
+	}
+
+	if (flags & ~DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_ARM_THUMB) {
+		LOG_ERR("Unsupported compressed image flags 0x%x", flags);
+		return -ENOTSUP;
+	}
+
+	lzma = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	if (lzma == NULL) {
+		LOG_ERR("LZMA decompression not available");
+		return -ENOTSUP;
+	}
+
+	err = lzma->init(NULL, image_size);
+	if (err) {
+		LOG_ERR("Failed to initialize LZMA decompression, err %d", err);
+		lzma = NULL;
+		return err;
+	}
+
+	if (flags & DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_ARM_THUMB) {
+		arm_thumb = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_ARM_THUMB);
+		if (arm_thumb == NULL) {
+			LOG_ERR("ARM thumb filter not available");
+			return -ENOTSUP;
+		}
+
+		err = arm_thumb->init(NULL, image_size);
+		if (err) {
+			LOG_ERR("Failed to initialize ARM thumb filter, err %d", err);
+			arm_thumb = NULL;
+			return err;
+		}
+	}
+
+	err = dfu_target_mcuboot_init(image_size, curr_img_num, NULL);
+	if (err) {
+		return err;
+	}
+
+	/* The decompression always starts from the beginning of the image,
+	 * drop any progress stored by an earlier upgrade.
+	 */
+	err = dfu_target_mcuboot_offset_get(&offset);
+	if (err == 0 && offset > 0) {
+		LOG_INF("Discarding stored progress of %zu bytes", offset);
+
+		err = dfu_target_mcuboot_reset();
+		if (err) {
+			return err;
+		}
+
+		err = dfu_target_mcuboot_init(image_size, curr_img_num, NULL);
+	}
+
+	if (err) {
+		return err;
+	}
+
+	mcuboot_initialized = true;
+
+	LOG_INF("Compressed image of %u bytes%s", image_size,
+		arm_thumb != NULL ? ", ARM thumb filter" : "");
+
+	return 0;
+}
+
+int dfu_target_mcuboot_compressed_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	ARG_UNUSED(cb);
+
+	if (file_size != 0 && file_size <= HEADER_SIZE) {
+		LOG_ERR("Compressed file too small, %zu bytes", file_size);
+		return -EINVAL;
+	}
+
+	if (mcuboot_initialized) {
+		(void)dfu_target_mcuboot_done(false);
+		mcuboot_initialized = false;
+	}
+
+	state_reset();
+	curr_img_num = img_num;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_compressed_offset_get(size_t *out)
+{
+	*out = bytes_received;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_compressed_write(const void *const buf, size_t len)
+{
+	int err;
+	const uint8_t *data = buf;
+	size_t pos = 0;
+
+	if (header_bytes < HEADER_SIZE) {
+		size_t chunk = MIN(HEADER_SIZE - header_bytes, len);
+
+		memcpy(&header_buf[header_bytes], data, chunk);
+		header_bytes += chunk;
+		bytes_received += chunk;
+		pos += chunk;
+
+		if (header_bytes < HEADER_SIZE) {
+			return 0;
+		}
+
+		err = header_parse();
+		if (err) {
+			state_reset();
+			return err;
+		}
+	}
+
+	while (pos < len) {
+		size_t needed = lzma->decompress_bytes_needed(NULL);
+		size_t chunk;
+
+		if (needed == 0 || needed > sizeof(input_buf)) {
+			return -EINVAL;
+		}
+
+		/* Keep the last input until more data is received or the
+		 * download is done, so that the final part is known.
+		 */
+		if (input_bytes >= needed) {
+			err = input_decompress(false);
+			if (err) {
+				return err;
+			}
+
+			continue;
+		}
+
+		chunk = MIN(needed - input_bytes, len - pos);
+		memcpy(&input_buf[input_bytes], &data[pos], chunk);
+		input_bytes += chunk;
+		bytes_received += chunk;
+		pos += chunk;
+	}
+
+	return 0;
+}
+
+int dfu_target_mcuboot_compressed_done(bool successful)
+{
+	int err = 0;
+
+	if (!mcuboot_initialized) {
+		state_reset();
+		return successful ? -EINVAL : 0;
+	}
+
+	if (successful) {
+		while (input_bytes > 0 && err == 0) {
+			err = input_decompress(true);
+		}
+
+		if (err == 0 && bytes_written != image_size) {
+			LOG_ERR("Decompressed %zu bytes, expected %u", bytes_written, image_size);
+			err = -EINVAL;
+		}
+	}
+
+	if (err) {
+		(void)dfu_target_mcuboot_done(false);
+	} else {
+		err = dfu_target_mcuboot_done(successful);
+	}
+
+	mcuboot_initialized = false;
+	state_reset();
+
+	return err;
+}
+
+int dfu_target_mcuboot_compressed_schedule_update(int img_num)
+{
+	return dfu_target_mcuboot_schedule_update(img_num);
+}
+
+int dfu_target_mcuboot_compressed_reset(void)
+{
+	mcuboot_initialized = false;
+	state_reset();
+
+	return dfu_target_mcuboot_reset();
+}
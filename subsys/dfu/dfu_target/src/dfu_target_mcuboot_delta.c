@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/storage/flash_map.h>
+#ifdef CONFIG_PARTITION_MANAGER_ENABLED
+#include <pm_config.h>
+#endif
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_mcuboot_delta.h>
+
+LOG_MODULE_REGISTER(dfu_target_mcuboot_delta, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+#define HEADER_SIZE sizeof(struct dfu_target_mcuboot_delta_header)
+#define CMD_SIZE sizeof(struct dfu_target_mcuboot_delta_cmd)
+
+#ifdef CONFIG_PARTITION_MANAGER_ENABLED
+static const uint8_t primary_id[] = {
+	PM_MCUBOOT_PRIMARY_ID,
+#ifdef PM_MCUBOOT_PRIMARY_1_ID
+	PM_MCUBOOT_PRIMARY_1_ID,
+#endif
+};
+#else
+static const uint8_t primary_id[] = {
+	PARTITION_ID(slot0_partition),
+#if PARTITION_EXISTS(slot2_partition)
+	PARTITION_ID(slot2_partition),
+#endif
+};
+#endif
+
+enum delta_state {
+	DELTA_STATE_HEADER,
+	DELTA_STATE_CMD,
+	DELTA_STATE_DATA,
+};
+
+static enum delta_state state;
+static struct dfu_target_mcuboot_delta_header header;
+static struct dfu_target_mcuboot_delta_cmd cmd;
+/* Bytes of the header or command received so far. */
+static size_t parse_bytes;
+
+/* Bytes left and source position of the current command. */
+static uint32_t cmd_remaining;
+static uint32_t cmd_source_offset;
+
+/* Source image data, and the output of add commands. */
+static uint8_t work_buf[CONFIG_DFU_TARGET_MCUBOOT_DELTA_BUF_SIZE];
+
+static const struct flash_area *source_fa;
+
+/* Patch bytes received. */
+static size_t bytes_received;
+/* Bytes written to the secondary slot, and their CRC. */
+static size_t bytes_written;
+static uint32_t target_crc;
+
+static int curr_img_num;
+static bool mcuboot_initialized;
+
+bool dfu_target_mcuboot_delta_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == DFU_TARGET_MCUBOOT_DELTA_MAGIC;
+}
+
+static void state_reset(void)
+{
+	if (source_fa != NULL) {
+		flash_area_close(source_fa);
+		source_fa = NULL;
+	}
+
+	state = DELTA_STATE_HEADER;
+	parse_bytes = 0;
+	cmd_remaining = 0;
+	bytes_received = 0;
+	bytes_written = 0;
+	target_crc = 0;
+}
+
+static int image_write(const uint8_t *buf, size_t len)
+{
+	int err;
+
+	err = dfu_target_mcuboot_write(buf, len);
+	if (err) {
+		return err;
+	}
+
+	target_crc = crc32_ieee_update(target_crc, buf, len);
+	bytes_written += len;
+
+	return 0;
+}
+
+static int source_read(uint32_t offset, uint8_t *buf, size_t len)
+{
+	int err = flash_area_read(source_fa, offset, buf, len);
+
+	if (err) {
+		LOG_ERR("Failed to read source image, err %d", err);
+	}
+
+	return err;
+}
+
+static int source_verify(void)
+{
+	int err;
+	uint32_t crc = 0;
+
+	for (uint32_t offset = 0; offset < header.source_size; offset += sizeof(work_buf)) {
+		size_t len = MIN(sizeof(work_buf), header.source_size - offset);
+
+		err = source_read(offset, work_buf, len);
+		if (err) {
+			return err;
+		}
+
+		crc = crc32_ieee_update(crc, work_buf, len);
+	}
+
+	if (crc != header.source_crc) {
+		LOG_ERR("Patch does not apply to the image in the primary slot");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int header_parse(void)
+{
+	int err;
+	size_t offset;
+
+	header.magic = sys_le32_to_cpu(header.magic);
+	header.source_size = sys_le32_to_cpu(header.source_size);
+	header.source_crc = sys_le32_to_cpu(header.source_crc);
+	header.target_size = sys_le32_to_cpu(header.target_size);
+	header.target_crc = sys_le32_to_cpu(header.target_crc);
+
+	if (header.magic != DFU_TARGET_MCUBOOT_DELTA_MAGIC) {
+		LOG_ERR("Invalid delta patch magic");
+		return -EINVAL;
+	}
+
+	if (curr_img_num < 0 || curr_img_num >= ARRAY_SIZE(primary_id)) {
+		LOG_ERR("Delta update not supported for image %d", curr_img_num);
+		return -ENOTSUP;
+	}
+
+	err = flash_area_open(primary_id[curr_img_num], &source_fa);
+	if (err) {
+		LOG_ERR("Failed to open primary slot, err %d", err);
+		source_fa = NULL;
+		return err;
+	}
+
+	if (header.source_size > source_fa->fa_size) {
+		LOG_ERR("Source image too big for the primary slot %u", header.source_size);
+		return -EINVAL;
+	}
+
+	err = source_verify();
+	if (err) {
+		return err;
+	}
+
+	err = dfu_target_mcuboot_init(header.target_size, curr_img_num, NULL);
+	if (err) {
+		return err;
+	}
+
+	/* The patch is always applied from the beginning,
+	 * drop any progress stored by an earlier upgrade.
+	 */
+	err = dfu_target_mcuboot_offset_get(&offset);
+	if (err == 0 && offset > 0) {
+		LOG_INF("Discarding stored progress of %zu bytes", offset);
+
+		err = dfu_target_mcuboot_reset();
+		if (err) {
+			return err;
+		}
+
+		err = dfu_target_mcuboot_init(header.target_size, curr_img_num, NULL);
+	}
+
+	if (err) {
+		return err;
+	}
+
+	mcuboot_initialized = true;
+
+	LOG_INF("Delta patch from %u to %u bytes", header.source_size, header.target_size);
+
+	return 0;
+}
+
+static int copy_run(void)
+{
+	int err;
+
+	while (cmd_remaining > 0) {
+		size_t len = MIN(sizeof(work_buf), cmd_remaining);
+
+		err = source_read(cmd_source_offset, work_buf, len);
+		if (err) {
+			return err;
+		}
+
+		err = image_write(work_buf, len);
+		if (err) {
+			return err;
+		}
+
+		cmd_source_offset += len;
+		cmd_remaining -= len;
+	}
+
+	return 0;
+}
+
+static int cmd_parse(void)
+{
+	cmd.type = sys_le32_to_cpu(cmd.type);
+	cmd.length = sys_le32_to_cpu(cmd.length);
+	cmd.source_offset = sys_le32_to_cpu(cmd.source_offset);
+
+	if (cmd.length == 0 || cmd.length > header.target_size - bytes_written) {
+		LOG_ERR("Invalid delta command length %u", cmd.length);
+		return -EINVAL;
+	}
+
+	if (cmd.type != DFU_TARGET_MCUBOOT_DELTA_CMD_INSERT &&
+	    (cmd.source_offset > header.source_size ||
+	     cmd.length > header.source_size - cmd.source_offset)) {
+		LOG_ERR("Invalid delta command source offset %u", cmd.source_offset);
+		return -EINVAL;
+	}
+
+	cmd_remaining = cmd.length;
+	cmd_source_offset = cmd.source_offset;
+
+	switch (cmd.type) {
+	case DFU_TARGET_MCUBOOT_DELTA_CMD_COPY:
+		return copy_run();
+	case DFU_TARGET_MCUBOOT_DELTA_CMD_ADD:
+	case DFU_TARGET_MCUBOOT_DELTA_CMD_INSERT:
+		state = DELTA_STATE_DATA;
+		return 0;
+	default:
+		LOG_ERR("Unknown delta command %u", cmd.type);
+		return -EINVAL;
+	}
+}
+
+static int data_apply(const uint8_t *data, size_t len)
+{
+	int err;
+
+	if (cmd.type == DFU_TARGET_MCUBOOT_DELTA_CMD_INSERT) {
+		return image_write(data, len);
+	}
+
+	err = source_read(cmd_source_offset, work_buf, len);
+	if (err) {
+		return err;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		work_buf[i] += data[i];
+	}
+
+	return image_write(work_buf, len);
+}
+
+int dfu_target_mcuboot_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	ARG_UNUSED(cb);
+
+	if (file_size != 0 && file_size < HEADER_SIZE) {
+		LOG_ERR("Delta patch too small, %zu bytes", file_size);
+		return -EINVAL;
+	}
+
+	if (mcuboot_initialized) {
+		(void)dfu_target_mcuboot_done(false);
+		mcuboot_initialized = false;
+	}
+
+	state_reset();
+	curr_img_num = img_num;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_delta_offset_get(size_t *out)
+{
+	*out = bytes_received;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_delta_write(const void *const buf, size_t len)
+{
+	int err = 0;
+	const uint8_t *data = buf;
+	size_t pos = 0;
+
+	while (pos < len && err == 0) {
+		size_t chunk;
+
+		switch (state) {
+		case DELTA_STATE_HEADER:
+			chunk = MIN(HEADER_SIZE - parse_bytes, len - pos);
+			memcpy((uint8_t *)&header + parse_bytes, &data[pos], chunk);
+			parse_bytes += chunk;
+
+			if (parse_bytes == HEADER_SIZE) {
+				parse_bytes = 0;
+				state = DELTA_STATE_CMD;
+				err = header_parse();
+			}
+			break;
+		case DELTA_STATE_CMD:
+			chunk = MIN(CMD_SIZE - parse_bytes, len - pos);
+			memcpy((uint8_t *)&cmd + parse_bytes, &data[pos], chunk);
+			parse_bytes += chunk;
+
+			if (parse_bytes == CMD_SIZE) {
+				parse_bytes = 0;
+				err = cmd_parse();
+			}
+			break;
+		case DELTA_STATE_DATA:
+			chunk = MIN(MIN(cmd_remaining, len - pos), sizeof(work_buf));
+
+			err = data_apply(&data[pos], chunk);
+
+			cmd_source_offset += chunk;
+			cmd_remaining -= chunk;
+			if (cmd_remaining == 0) {
+				state = DELTA_STATE_CMD;
+			}
+			break;
+		default:
+			err = -EINVAL;
+			chunk = 0;
+			break;
+		}
+
+		bytes_received += chunk;
+		pos += chunk;
+	}
+
+	if (err) {
+		/* The patch state is lost, start over on the next write */
+		if (mcuboot_initialized) {
+			(void)dfu_target_mcuboot_done(false);
+			mcuboot_initialized = false;
+		}
+
+		state_reset();
+	}
+
+	return err;
+}
+
+int dfu_target_mcuboot_delta_done(bool successful)
+{
+	int err = 0;
+
+	if (!mcuboot_initialized) {
+		state_reset();
+		return successful ? -EINVAL : 0;
+	}
+
+	if (successful) {
+		if (state != DELTA_STATE_CMD || parse_bytes != 0 ||
+		    bytes_written != header.target_size) {
+			LOG_ERR("Incomplete delta patch, %zu of %u bytes", bytes_written,
+				header.target_size);
+			err = -EINVAL;
+		} else if (target_crc != header.target_crc) {
+			LOG_ERR("Patched image CRC mismatch");
+			err = -EINVAL;
+		}
+	}
+
+	if (err) {
+		(void)dfu_target_mcuboot_done(false);
+	} else {
+		err = dfu_target_mcuboot_done(successful);
+	}
+
+	mcuboot_initialized = false;
+	state_reset();
+
+	return err;
+}
+
+int dfu_target_mcuboot_delta_schedule_update(int img_num)
+{
+	return dfu_target_mcuboot_schedule_update(img_num);
+}
+
+int dfu_target_mcuboot_delta_reset(void)
+{
+	mcuboot_initialized = false;
+	state_reset();
+
+	return dfu_target_mcuboot_reset();
+}
@@ -6,6 +6,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/drivers/flash.h>
 #include <zephyr/storage/stream_flash.h>
 #include <stdio.h>
 #include <dfu/dfu_target_stream.h>
@@ -18,21 +19,41 @@
 
 LOG_MODULE_REGISTER(dfu_target_stream, CONFIG_DFU_TARGET_LOG_LEVEL);
 
+#if defined(CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD)
+#define ERASE_AHEAD_PAGES CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+#else
+#define ERASE_AHEAD_PAGES 0
+#endif
+
 static struct stream_flash_ctx stream;
 static const char *current_id;
 
+#if ERASE_AHEAD_PAGES > 0
+/* Serializes stream access between the writer and the erase-ahead work. */
+static K_MUTEX_DEFINE(stream_mutex);
+
+static void erase_ahead_work_fn(struct k_work *work);
+static K_WORK_DEFINE(erase_ahead_work, erase_ahead_work_fn);
+
+#define STREAM_LOCK() k_mutex_lock(&stream_mutex, K_FOREVER)
+#define STREAM_UNLOCK() k_mutex_unlock(&stream_mutex)
+#else
+#define STREAM_LOCK()
+#define STREAM_UNLOCK()
+#endif /* ERASE_AHEAD_PAGES > 0 */
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 
 static char current_name_key[32];
 
-/**
- * @brief Store the information stored in the stream_flash instance so that it
- *        can be restored from flash in case of a power failure, reboot etc.
- */
-static int store_progress(void)
+#if CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL > 0
+/* Progress last stored by store_progress_interval(). */
+static size_t stored_progress;
+#endif
+
+static int save_progress(size_t bytes_written)
 {
 	int err;
-	size_t bytes_written = stream_flash_bytes_written(&stream);
 
 	err = settings_save_one(current_name_key, &bytes_written,
 				sizeof(bytes_written));
@@ -45,6 +66,44 @@ static int store_progress(void)
 	return 0;
 }
 
+/**
+ * @brief Store the information stored in the stream_flash instance so that it
+ *        can be restored from flash in case of a power failure, reboot etc.
+ */
+static int store_progress(void)
+{
+	return save_progress(stream_flash_bytes_written(&stream));
+}
+
+/**
+ * @brief Store the progress when the bytes written have passed the next
+ *        interval boundary.
+ *
+ * The stored progress is rounded down to the interval, so that the page being
+ * written is erased and written again if the stream is resumed.
+ */
+static int store_progress_interval(void)
+{
+#if CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL > 0
+	int err;
+	size_t progress = ROUND_DOWN(stream_flash_bytes_written(&stream),
+				     CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL);
+
+	if (progress <= stored_progress) {
+		return 0;
+	}
+
+	err = save_progress(progress);
+	if (err == 0) {
+		stored_progress = progress;
+	}
+
+	return err;
+#else
+	return store_progress();
+#endif
+}
+
 /**
  * @brief Function used by settings_load() to restore the stream_flash ctx.
  *	  See the Zephyr documentation of the settings subsystem for more
@@ -98,6 +157,58 @@ SETTINGS_STATIC_HANDLER_DEFINE(dfu_target, MODULE, NULL, settings_set,
 
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#if ERASE_AHEAD_PAGES > 0
+/**
+ * @brief Erase the pages following the write position, so that the erase is
+ *        not done in the write path when the stream buffer is flushed.
+ */
+static void erase_ahead_work_fn(struct k_work *work)
+{
+	int err;
+	struct flash_pages_info page;
+	size_t position;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		STREAM_LOCK();
+
+		if (current_id == NULL || stream.erased_up_to >= stream.available) {
+			break;
+		}
+
+		err = flash_get_page_info_by_offs(stream.fdev,
+						  stream.offset + stream.erased_up_to,
+						  &page);
+		if (err) {
+			LOG_ERR("Error %d while getting page info", err);
+			break;
+		}
+
+		position = stream_flash_bytes_written(&stream) + stream_flash_bytes_buffered(&stream);
+		if (stream.erased_up_to >= position + ERASE_AHEAD_PAGES * page.size) {
+			break;
+		}
+
+		LOG_DBG("Erasing ahead page at offset 0x%08lx", (long)page.start_offset);
+
+		err = flash_erase(stream.fdev, page.start_offset, page.size);
+		if (err) {
+			/* Stream write will try to erase the page again */
+			LOG_WRN("Erase ahead failed (err %d)", err);
+			break;
+		}
+
+		stream.erased_up_to = page.start_offset + page.size - stream.offset;
+
+		/* Let the writer in between pages */
+		STREAM_UNLOCK();
+	}
+
+	STREAM_UNLOCK();
+}
+#endif /* ERASE_AHEAD_PAGES > 0 */
+
 struct stream_flash_ctx *dfu_target_stream_get_stream(void)
 {
 	return &stream;
@@ -116,10 +227,15 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 		return -EINVAL;
 	}
 
+	STREAM_LOCK();
+
 	current_id = init->id;
 
 	err = stream_flash_init(&stream, init->fdev, init->buf, init->len,
 				init->offset, init->size, NULL);
+
+	STREAM_UNLOCK();
+
 	if (err) {
 		LOG_ERR("stream_flash_init failed (err %d)", err);
 		return err;
@@ -140,13 +256,23 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 		return err;
 	}
 
+	STREAM_LOCK();
 	err = settings_load_subtree(MODULE);
+#if CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL > 0
+	stored_progress = stream_flash_bytes_written(&stream);
+#endif
+	STREAM_UNLOCK();
+
 	if (err) {
 		LOG_ERR("settings_load failed (err %d)", err);
 		return err;
 	}
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#if ERASE_AHEAD_PAGES > 0
+	k_work_submit(&erase_ahead_work);
+#endif
+
 	return 0;
 }
 
@@ -174,6 +300,8 @@ int dfu_target_stream_bytes_buffered_get(size_t *out)
 
 int dfu_target_stream_write(const uint8_t *buf, size_t len)
 {
+	STREAM_LOCK();
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS
 	/**
 	 * Flush immediately.
@@ -192,12 +320,13 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 #endif
 
 	if (err != 0) {
+		STREAM_UNLOCK();
 		LOG_ERR("stream_flash_buffered_write error %d", err);
 		return err;
 	}
 
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
-	err = store_progress();
+	err = store_progress_interval();
 	if (err != 0) {
 		/* Failing to store progress is not a critical error you'll just
 		 * be left to download a bit more if you fail and resume.
@@ -206,6 +335,12 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 	}
 #endif
 
+	STREAM_UNLOCK();
+
+#if ERASE_AHEAD_PAGES > 0
+	k_work_submit(&erase_ahead_work);
+#endif
+
 	return err;
 }
 
@@ -213,6 +348,8 @@ int dfu_target_stream_done(bool successful)
 {
 	int err = 0;
 
+	STREAM_LOCK();
+
 	if (successful) {
 		err = stream_flash_buffered_write(&stream, NULL, 0, true);
 		if (err != 0) {
@@ -240,6 +377,8 @@ int dfu_target_stream_done(bool successful)
 
 	current_id = NULL;
 
+	STREAM_UNLOCK();
+
 	return err;
 }
 
@@ -247,8 +386,13 @@ int dfu_target_stream_reset(void)
 {
 	int err = 0;
 
+	STREAM_LOCK();
+
 	stream.buf_bytes = 0;
 	stream.bytes_written = 0;
+#if CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL > 0
+	stored_progress = 0;
+#endif
 
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 	err = settings_delete(current_name_key);
@@ -260,6 +404,7 @@ int dfu_target_stream_reset(void)
 	/* No flash device specified, nothing to erase. */
 	if (stream.fdev == NULL) {
 		current_id = NULL;
+		STREAM_UNLOCK();
 		return 0;
 	}
 
@@ -269,5 +414,7 @@ int dfu_target_stream_reset(void)
 	err = stream_flash_flatten_page(&stream, stream.offset);
 	current_id = NULL;
 
+	STREAM_UNLOCK();
+
 	return err;
 }
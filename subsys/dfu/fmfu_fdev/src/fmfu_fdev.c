@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 #include <zephyr/logging/log.h>
 #include <dfu/fmfu_fdev.h>
@@ -19,6 +20,141 @@ LOG_MODULE_REGISTER(fmfu_fdev, CONFIG_FMFU_FDEV_LOG_LEVEL);
 
 static uint8_t meta_buf[MAX_META_LEN];
 
+/* Reads consecutive chunks of a flash device region. With read-ahead, a thread reads the
+ * next chunk into the other half of the buffer while the current chunk is processed.
+ */
+struct chunk_reader {
+	const struct device *fdev;
+	size_t offset;
+	size_t end;
+	uint8_t *buf;
+	size_t chunk_len;
+#if defined(CONFIG_FMFU_FDEV_READ_AHEAD)
+	struct k_sem filled;
+	struct k_sem free;
+	size_t len[2];
+	int err[2];
+	uint8_t idx;
+	bool held;
+	bool stop;
+#endif
+};
+
+#if defined(CONFIG_FMFU_FDEV_READ_AHEAD)
+static K_THREAD_STACK_DEFINE(read_ahead_stack, CONFIG_FMFU_FDEV_READ_AHEAD_STACK_SIZE);
+static struct k_thread read_ahead_thread_data;
+
+static void read_ahead_thread(void *p1, void *p2, void *p3)
+{
+	struct chunk_reader *reader = p1;
+	size_t offset = reader->offset;
+	uint8_t idx = 0;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (offset < reader->end) {
+		size_t len = MIN(reader->chunk_len, reader->end - offset);
+
+		k_sem_take(&reader->free, K_FOREVER);
+		if (reader->stop) {
+			return;
+		}
+
+		reader->err[idx] = flash_read(reader->fdev, offset,
+					      &reader->buf[idx * reader->chunk_len], len);
+		reader->len[idx] = len;
+		k_sem_give(&reader->filled);
+
+		if (reader->err[idx] != 0) {
+			return;
+		}
+
+		offset += len;
+		idx ^= 1;
+	}
+}
+#endif
+
+static int chunk_reader_start(struct chunk_reader *reader, const struct device *fdev,
+			      size_t offset, size_t len, uint8_t *buf, size_t buf_len)
+{
+	reader->fdev = fdev;
+	reader->offset = offset;
+	reader->end = offset + len;
+	reader->buf = buf;
+
+#if defined(CONFIG_FMFU_FDEV_READ_AHEAD)
+	/* Each half of the buffer holds one chunk. */
+	reader->chunk_len = ROUND_DOWN(buf_len / 2, sizeof(uint32_t));
+	if (reader->chunk_len == 0) {
+		return -EINVAL;
+	}
+
+	reader->idx = 0;
+	reader->held = false;
+	reader->stop = false;
+	k_sem_init(&reader->filled, 0, 2);
+	k_sem_init(&reader->free, 2, 2);
+
+	k_thread_create(&read_ahead_thread_data, read_ahead_stack,
+			K_THREAD_STACK_SIZEOF(read_ahead_stack), read_ahead_thread, reader, NULL,
+			NULL, k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+	k_thread_name_set(&read_ahead_thread_data, "fmfu_read_ahead");
+#else
+	reader->chunk_len = buf_len;
+#endif
+
+	return 0;
+}
+
+/* Gets the next chunk. The chunk stays valid until the next call. */
+static int chunk_reader_next(struct chunk_reader *reader, uint8_t **chunk, size_t *chunk_len)
+{
+	int err;
+
+	if (reader->offset >= reader->end) {
+		return -ENODATA;
+	}
+
+#if defined(CONFIG_FMFU_FDEV_READ_AHEAD)
+	if (reader->held) {
+		/* The previous chunk has been processed, its buffer can be refilled. */
+		k_sem_give(&reader->free);
+		reader->idx ^= 1;
+	}
+
+	k_sem_take(&reader->filled, K_FOREVER);
+	reader->held = true;
+
+	err = reader->err[reader->idx];
+	*chunk = &reader->buf[reader->idx * reader->chunk_len];
+	*chunk_len = reader->len[reader->idx];
+#else
+	*chunk_len = MIN(reader->chunk_len, reader->end - reader->offset);
+	*chunk = reader->buf;
+
+	err = flash_read(reader->fdev, reader->offset, reader->buf, *chunk_len);
+#endif
+	if (err != 0) {
+		LOG_ERR("flash_read failed: %d", err);
+		return err;
+	}
+
+	reader->offset += *chunk_len;
+
+	return 0;
+}
+
+static void chunk_reader_stop(struct chunk_reader *reader)
+{
+#if defined(CONFIG_FMFU_FDEV_READ_AHEAD)
+	reader->stop = true;
+	k_sem_give(&reader->free);
+	k_thread_join(&read_ahead_thread_data, K_FOREVER);
+#endif
+}
+
 static int get_hash_from_flash(const struct device *fdev, size_t offset, size_t data_len,
 			       uint8_t hash[static 32], uint8_t *buffer, size_t buffer_len)
 {
@@ -26,7 +162,9 @@ static int get_hash_from_flash(const struct device *fdev, size_t offset, size_t
 	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
 	psa_status_t status;
 	size_t hash_len;
-	size_t end = offset + data_len;
+	struct chunk_reader reader;
+	uint8_t *chunk;
+	size_t chunk_len;
 	BUILD_ASSERT(PSA_SUCCESS == 0);
 
 	status = psa_hash_setup(&operation, PSA_ALG_SHA_256);
@@ -34,22 +172,26 @@ static int get_hash_from_flash(const struct device *fdev, size_t offset, size_t
 		return status;
 	}
 
-	for (size_t tmp_offs = offset; tmp_offs < end; tmp_offs += buffer_len) {
-		size_t part_len = MIN(buffer_len, (end - tmp_offs));
-
-		err = flash_read(fdev, tmp_offs, buffer, part_len);
-		if (err != 0) {
-			psa_hash_abort(&operation);
-			return err;
-		}
+	err = chunk_reader_start(&reader, fdev, offset, data_len, buffer, buffer_len);
+	if (err != 0) {
+		psa_hash_abort(&operation);
+		return err;
+	}
 
-		status = psa_hash_update(&operation, buffer, part_len);
+	while ((err = chunk_reader_next(&reader, &chunk, &chunk_len)) == 0) {
+		status = psa_hash_update(&operation, chunk, chunk_len);
 		if (status != PSA_SUCCESS) {
-			psa_hash_abort(&operation);
-			return status;
+			break;
 		}
 	}
 
+	chunk_reader_stop(&reader);
+
+	if (err != -ENODATA || status != PSA_SUCCESS) {
+		psa_hash_abort(&operation);
+		return (status != PSA_SUCCESS) ? status : err;
+	}
+
 	status = psa_hash_finish(&operation, hash, 32, &hash_len);
 	if (status != PSA_SUCCESS) {
 		psa_hash_abort(&operation);
@@ -83,31 +225,35 @@ static int load_segment(const struct device *fdev, size_t seg_size, uint32_t seg
 {
 	int err;
 	uint32_t read_addr = seg_offset;
-	size_t bytes_left = seg_size;
+	struct chunk_reader reader;
+	uint8_t *chunk;
+	size_t read_len;
 
-	while (bytes_left) {
-		uint32_t read_len = MIN(buf_len, bytes_left);
-
-		err = flash_read(fdev, read_addr, buf, read_len);
-		if (err != 0) {
-			LOG_ERR("flash_read failed: %d", err);
-			return err;
-		}
+	err = chunk_reader_start(&reader, fdev, seg_offset, seg_size, buf, buf_len);
+	if (err != 0) {
+		return err;
+	}
 
-		err = write_chunk(buf, read_len, seg_target_addr, is_bootloader);
+	while ((err = chunk_reader_next(&reader, &chunk, &read_len)) == 0) {
+		err = write_chunk(chunk, read_len, seg_target_addr, is_bootloader);
 		if (err != 0) {
 			LOG_ERR("write_chunk failed: %d", err);
-			return err;
+			break;
 		}
 
-		LOG_DBG("Wrote chunk: offset 0x%x target addr 0x%x size 0x%x", read_addr,
+		LOG_DBG("Wrote chunk: offset 0x%x target addr 0x%x size 0x%zx", read_addr,
 			seg_target_addr, read_len);
 
 		seg_target_addr += read_len;
-		bytes_left -= read_len;
 		read_addr += read_len;
 	}
 
+	chunk_reader_stop(&reader);
+
+	if (err != -ENODATA) {
+		return err;
+	}
+
 	if (is_bootloader) {
 		/* We need to explicitly call _apply() once all chunks of the
 		 * bootloader has been written.
@@ -55,6 +55,15 @@ LOG_MODULE_REGISTER(nrf_dm, CONFIG_DM_MODULE_LOG_LEVEL);
 #define DM_TIMESLOT_OVERHEAD_US      420
 #define DM_REFLECTOR_OVERHEAD_US     2000
 
+#if defined(CONFIG_DM_TIMESLOT_BATCH)
+#define DM_BATCH_SIZE                CONFIG_DM_TIMESLOT_BATCH_SIZE
+#else
+#define DM_BATCH_SIZE                1
+#endif
+
+/* Weight of a new interval in the average measurement interval, as a power of two. */
+#define DM_PEER_RATE_AVG_SHIFT       3
+
 static K_MUTEX_DEFINE(ranging_mtx);
 static K_TIMER_DEFINE(timer, NULL, NULL);
 
@@ -91,6 +100,10 @@ struct {
 
 struct {
 	struct timeslot_request curr_req;
+	/* Requests executed in the current timeslot, starting with curr_req. */
+	struct timeslot_request batch[DM_BATCH_SIZE];
+	nrf_dm_status_t batch_status[DM_BATCH_SIZE];
+	uint8_t batch_len;
 	atomic_val_t state;
 	uint32_t last_start;
 } static timeslot_ctx = {
@@ -115,6 +128,25 @@ static mpsl_timeslot_request_t timeslot_request_normal = {
 struct dm_result result;
 static mpsl_timeslot_signal_return_param_t signal_callback_return_param;
 
+#if DM_BATCH_SIZE > 1
+/* The reports of a batch are saved in the timeslot, as each ranging overwrites the data of
+ * the previous one.
+ */
+static nrf_dm_report_t batch_reports[DM_BATCH_SIZE];
+#endif
+
+#if defined(CONFIG_DM_PEER_RATE)
+struct peer_rate {
+	bt_addr_le_t bt_addr;
+	/* Uptime of the last successful measurement, in milliseconds. */
+	uint32_t last_ms;
+	/* Average interval between two successful measurements, in milliseconds. */
+	uint32_t interval_avg_ms;
+};
+
+static struct peer_rate peer_rates[CONFIG_DM_PEER_RATE_PEERS];
+#endif
+
 static void dm_config_get(struct dm_request *dm_req, nrf_dm_config_t *dm_config)
 {
 	*dm_config = NRF_DM_DEFAULT_CONFIG;
@@ -172,14 +204,33 @@ static mpsl_timeslot_signal_return_param_t *mpsl_timeslot_callback(
 			return p_ret_val;
 		}
 
-		dm_config_get(&timeslot_ctx.curr_req.dm_req, &dm_config);
-		nrf_dm_status = nrf_dm_configure(&dm_config);
+		for (size_t i = 0; i < timeslot_ctx.batch_len; i++) {
+			struct timeslot_request *req = &timeslot_ctx.batch[i];
 
-		if (nrf_dm_status == NRF_DM_STATUS_SUCCESS) {
-			nrf_dm_status = nrf_dm_proc_execute(timeslot_ctx.curr_req.window_length_us);
-		}
+			if (i > 0) {
+				/* Wait for the start of the ranging agreed with the peer. */
+				uint32_t offset = time_distance_get(timeslot_ctx.batch[0].start_time,
+								    req->start_time);
+				uint32_t elapsed = time_distance_get(timeslot_ctx.last_start,
+								     time_now());
+
+				if (offset > elapsed) {
+					k_busy_wait(TICKS_TO_US(offset - elapsed));
+				}
+			}
+
+			dm_config_get(&req->dm_req, &dm_config);
+			nrf_dm_status = nrf_dm_configure(&dm_config);
 
-		dm_context.nrf_dm_status = nrf_dm_status;
+			if (nrf_dm_status == NRF_DM_STATUS_SUCCESS) {
+				nrf_dm_status = nrf_dm_proc_execute(req->window_length_us);
+			}
+
+			timeslot_ctx.batch_status[i] = nrf_dm_status;
+#if DM_BATCH_SIZE > 1
+			nrf_dm_populate_report(&batch_reports[i]);
+#endif
+		}
 
 		dm_io_clear(DM_IO_RANGING);
 
@@ -319,6 +370,36 @@ static int timeslot_request(uint32_t distance_from_last)
 	return err;
 }
 
+/* Add the requests batched with curr_req, and extend the timeslot to cover them. */
+static void batch_build(void)
+{
+	struct timeslot_request *first = &timeslot_ctx.curr_req;
+	struct timeslot_request *req;
+
+	timeslot_ctx.batch[0] = *first;
+	timeslot_ctx.batch_len = 1;
+
+	while (timeslot_ctx.batch_len < DM_BATCH_SIZE) {
+		uint32_t length_us;
+
+		req = timeslot_queue_peek();
+		if (!req || req->batch_pos == 0) {
+			break;
+		}
+
+		length_us = TICKS_TO_US(time_distance_get(first->start_time, req->start_time)) +
+			    req->timeslot_length_us;
+		if (length_us > MPSL_TIMESLOT_LENGTH_MAX_US) {
+			break;
+		}
+
+		timeslot_ctx.batch[timeslot_ctx.batch_len++] = *req;
+		timeslot_queue_remove_first();
+
+		first->timeslot_length_us = length_us;
+	}
+}
+
 static void dm_start_ranging(void)
 {
 	struct timeslot_request *req;
@@ -348,8 +429,10 @@ static void dm_start_ranging(void)
 
 	memcpy(&timeslot_ctx.curr_req, req, sizeof(timeslot_ctx.curr_req));
 	timeslot_queue_remove_first();
+	batch_build();
 
-	uint32_t distance = time_distance_get(timeslot_ctx.last_start, req->start_time);
+	uint32_t distance = time_distance_get(timeslot_ctx.last_start,
+					      timeslot_ctx.curr_req.start_time);
 
 	atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_PENDING);
 	err = timeslot_request(TICKS_TO_US(distance));
@@ -360,7 +443,7 @@ out:
 	k_mutex_unlock(&ranging_mtx);
 }
 
-static void dm_reschedule(void)
+static void dm_reschedule(uint32_t ref_tick)
 {
 	uint32_t timeslot_len_us;
 	uint32_t window_len_us;
@@ -373,7 +456,7 @@ static void dm_reschedule(void)
 			timeslot_len_us = timeslot_ctx.curr_req.timeslot_length_us;
 
 			err = timeslot_queue_append(&timeslot_ctx.curr_req.dm_req,
-					   time_now(), window_len_us, timeslot_len_us);
+					   ref_tick, window_len_us, timeslot_len_us);
 			if (err) {
 				LOG_DBG("Timeslot allocator failed (err %d)", err);
 			}
@@ -382,14 +465,61 @@ static void dm_reschedule(void)
 	}
 }
 
-static void calculation(void)
+static void report_get(size_t idx, nrf_dm_report_t *report)
+{
+#if DM_BATCH_SIZE > 1
+	memcpy(report, &batch_reports[idx], sizeof(*report));
+#else
+	ARG_UNUSED(idx);
+	nrf_dm_populate_report(report);
+#endif
+}
+
+static void peer_rate_update(const bt_addr_le_t *bt_addr)
+{
+#if defined(CONFIG_DM_PEER_RATE)
+	uint32_t now = k_uptime_get_32();
+	struct peer_rate *peer = &peer_rates[0];
+
+	/* Find the peer, or replace the peer that was measured least recently. */
+	for (size_t i = 0; i < ARRAY_SIZE(peer_rates); i++) {
+		if (bt_addr_le_eq(&peer_rates[i].bt_addr, bt_addr)) {
+			peer = &peer_rates[i];
+			break;
+		}
+
+		if ((now - peer_rates[i].last_ms) > (now - peer->last_ms)) {
+			peer = &peer_rates[i];
+		}
+	}
+
+	if (!bt_addr_le_eq(&peer->bt_addr, bt_addr)) {
+		bt_addr_le_copy(&peer->bt_addr, bt_addr);
+		peer->interval_avg_ms = 0;
+	} else if (peer->interval_avg_ms == 0) {
+		peer->interval_avg_ms = MAX(now - peer->last_ms, 1);
+	} else {
+		int32_t diff = (int32_t)(now - peer->last_ms) - (int32_t)peer->interval_avg_ms;
+
+		peer->interval_avg_ms = MAX((int32_t)peer->interval_avg_ms +
+					    diff / (1 << DM_PEER_RATE_AVG_SHIFT), 1);
+	}
+
+	peer->last_ms = now;
+	result.rate_mhz = peer->interval_avg_ms ? 1000000 / peer->interval_avg_ms : 0;
+#else
+	ARG_UNUSED(bt_addr);
+#endif
+}
+
+static void calculation(size_t idx)
 {
 	if (IS_ENABLED(CONFIG_DM_MODULE_RPC_HOST)) {
 		struct dm_rpc_process_data *data;
 
 		data = dm_rpc_get_buffer(sizeof(*data));
 		if (data) {
-			nrf_dm_populate_report(&data->report);
+			report_get(idx, &data->report);
 			bt_addr_le_copy(&data->bt_addr, &timeslot_ctx.curr_req.dm_req.bt_addr);
 			dm_rpc_calc_and_process(data, sizeof(*data));
 		}
@@ -397,7 +527,7 @@ static void calculation(void)
 		static nrf_dm_report_t report;
 		float high_precision_estimate = 0;
 
-		nrf_dm_populate_report(&report);
+		report_get(idx, &report);
 		nrf_dm_calc(&report);
 
 #ifdef CONFIG_DM_HIGH_PRECISION_CALC
@@ -406,12 +536,35 @@ static void calculation(void)
 		}
 #endif
 		process_data(&report, high_precision_estimate);
+		peer_rate_update(&result.bt_addr);
 		if (dm_context.cb->data_ready != NULL) {
 			dm_context.cb->data_ready(&result);
 		}
 	}
 }
 
+static void batch_process(void)
+{
+	uint32_t now = time_now();
+
+	for (size_t i = 0; i < timeslot_ctx.batch_len; i++) {
+		struct timeslot_request *req = &timeslot_ctx.batch[i];
+		/* Keep the spacing of the batch when rescheduling. */
+		uint32_t ref_tick = (now + time_distance_get(timeslot_ctx.batch[0].start_time,
+							     req->start_time)) % RTC_COUNTER_MAX;
+
+		memcpy(&timeslot_ctx.curr_req, req, sizeof(timeslot_ctx.curr_req));
+		dm_context.nrf_dm_status = timeslot_ctx.batch_status[i];
+
+		dm_reschedule(ref_tick);
+		if (dm_context.nrf_dm_status == NRF_DM_STATUS_SUCCESS) {
+			calculation(i);
+		} else {
+			LOG_DBG("Ranging failed (nrf_dm status: %d)", dm_context.nrf_dm_status);
+		}
+	}
+}
+
 static void dm_thread(void)
 {
 	int err;
@@ -432,13 +585,7 @@ static void dm_thread(void)
 				dm_start_ranging();
 				break;
 			case TIMESLOT_NORMAL_END:
-				dm_reschedule();
-				if (dm_context.nrf_dm_status == NRF_DM_STATUS_SUCCESS) {
-					calculation();
-				} else {
-					LOG_DBG("Ranging failed (nrf_dm status: %d)",
-									  dm_context.nrf_dm_status);
-				}
+				batch_process();
 
 				atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_IDLE);
 				dm_start_ranging();
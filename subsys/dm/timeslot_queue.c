@@ -14,6 +14,11 @@
 #define MIN_TIME_BETWEEN_TIMESLOTS_US    CONFIG_DM_MIN_TIME_BETWEEN_TIMESLOTS_US
 #define RANGING_OFFSET_US                CONFIG_DM_RANGING_OFFSET_US
 
+#if defined(CONFIG_DM_TIMESLOT_BATCH)
+#define BATCH_SIZE                       CONFIG_DM_TIMESLOT_BATCH_SIZE
+#define BATCH_GAP_US                     CONFIG_DM_TIMESLOT_BATCH_GAP_US
+#endif
+
 static K_MUTEX_DEFINE(list_mtx);
 static sys_slist_t timeslot_list = SYS_SLIST_STATIC_INIT(&timeslot_list);
 
@@ -68,6 +73,7 @@ int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 	uint32_t start_time;
 	uint32_t delay;
 	size_t list_size;
+	uint8_t batch_pos = 0;
 	struct timeslot_entry *last, *item;
 
 	delay = req->start_delay_us + RANGING_OFFSET_US;
@@ -96,7 +102,21 @@ int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 		if (start_time < last->timeslot_req.start_time +
 					 US_TO_RTC_TICKS(last->timeslot_req.timeslot_length_us +
 							 MIN_TIME_BETWEEN_TIMESLOTS_US)) {
+#if defined(CONFIG_DM_TIMESLOT_BATCH)
+			/* Execute the ranging in the timeslot of the last one, right after
+			 * its ranging window.
+			 */
+			if (start_time < last->timeslot_req.start_time +
+						 US_TO_RTC_TICKS(last->timeslot_req.window_length_us +
+								 BATCH_GAP_US) ||
+			    last->timeslot_req.batch_pos + 1 >= BATCH_SIZE) {
+				return -EBUSY;
+			}
+
+			batch_pos = last->timeslot_req.batch_pos + 1;
+#else
 			return -EBUSY;
+#endif
 		}
 	}
 
@@ -108,6 +128,7 @@ int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 	item->timeslot_req.start_time = start_time;
 	item->timeslot_req.timeslot_length_us = timeslot_len_us;
 	item->timeslot_req.window_length_us = window_len_us;
+	item->timeslot_req.batch_pos = batch_pos;
 	req->rng_seed++;
 
 	memcpy(&item->timeslot_req.dm_req, req, sizeof(item->timeslot_req.dm_req));
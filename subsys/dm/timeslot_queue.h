@@ -27,6 +27,11 @@ struct timeslot_request {
 
 	/* Ranging window length */
 	uint32_t window_length_us;
+
+	/* Position in a batch of rangings executed in one timeslot,
+	 * 0 if the request starts a new timeslot.
+	 */
+	uint8_t batch_pos;
 };
 
 /** @brief Append an element to the end of a queue.
@@ -39,6 +44,9 @@ struct timeslot_request {
  *  @retval -ENOMEM when the tiemslot queue is full or a memory allocation error.
  *  @retval -EAGAIN when a single peer has a maximum number of timeslots scheduled.
  *  @retval -EBUSY when the timeslot cannot be scheduled due to time restrictions.
+ *
+ *  With CONFIG_DM_TIMESLOT_BATCH, a request that starts too early for a timeslot
+ *  of its own is added to the batch of the last request in the queue.
  */
 int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 			  uint32_t window_len, uint32_t timeslot_len);
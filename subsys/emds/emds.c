@@ -211,6 +211,67 @@ static int emds_entries_size(size_t *size)
 	return entries;
 }
 
+#if defined(CONFIG_EMDS_DELTA_STORE)
+#define DELTA_BLOCK_SIZE CONFIG_EMDS_DELTA_BLOCK_SIZE
+
+/* CRC of every block of the entries, as currently stored in the persistent memory. */
+static uint32_t block_crc[CONFIG_EMDS_DELTA_BLOCKS_MAX];
+/* Number of delta snapshots between the freshest snapshot and the full snapshot it builds on. */
+static uint32_t freshest_depth;
+/* All entries are stored with their current length in the full snapshot. */
+static bool base_complete;
+/* The allocated snapshot is a delta snapshot. */
+static bool allocated_delta;
+
+typedef void (*entry_cb_t)(struct emds_entry *entry, size_t block, void *user_data);
+
+/* Iterates over the entries in the same order on every call, passing the index of the first
+ * block of each entry. Returns the total number of blocks.
+ */
+static size_t entries_foreach(entry_cb_t cb, void *user_data)
+{
+	size_t block = 0;
+
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		if (cb) {
+			cb(ch, block, user_data);
+		}
+
+		block += DIV_ROUND_UP(ch->len, DELTA_BLOCK_SIZE);
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		if (cb) {
+			cb(&ch->entry, block, user_data);
+		}
+
+		block += DIV_ROUND_UP(ch->entry.len, DELTA_BLOCK_SIZE);
+	}
+
+	return block;
+}
+
+static void entry_delta_size(struct emds_entry *entry, size_t block, void *user_data)
+{
+	size_t *size = user_data;
+
+	/* In the worst case, every block needs its own delta record. */
+	*size += entry->len +
+		 DIV_ROUND_UP(entry->len, DELTA_BLOCK_SIZE) * sizeof(struct emds_delta_entry);
+}
+
+static size_t delta_size_max(void)
+{
+	size_t size = 0;
+
+	(void)entries_foreach(entry_delta_size, &size);
+
+	return size;
+}
+#endif /* CONFIG_EMDS_DELTA_STORE */
+
 int emds_store_size_get(size_t *store_size)
 {
 	if (emds_state == EMDS_STATE_NOT_INITIALIZED) {
@@ -239,9 +300,17 @@ int emds_store_time_get(uint32_t *store_time)
 		return rc;
 	}
 
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	/* The changed blocks are found by calculating the CRC of all data at store time. */
+	chunk_handling = DIV_ROUND_UP(store_size, CHUNK_SIZE);
+	store_size = MAX(store_size, delta_size_max());
+#else
+	chunk_handling = 0;
+#endif
+
 	words = DIV_ROUND_UP(store_size, 4);
 	words += DIV_ROUND_UP(sizeof(struct emds_snapshot_metadata), 4);
-	chunk_handling = DIV_ROUND_UP(store_size, CHUNK_SIZE);
+	chunk_handling += DIV_ROUND_UP(store_size, CHUNK_SIZE);
 
 	*store_time = words * CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US;
 	*store_time += chunk_handling * CONFIG_EMDS_CHUNK_PREPARATION_TIME_US;
@@ -249,35 +318,33 @@ int emds_store_time_get(uint32_t *store_time)
 	return 0;
 }
 
-static uint8_t *emds_entry_memory_get(struct emds_data_entry *entry)
+static struct emds_entry *emds_entry_get(uint16_t id)
 {
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		if (ch->id == entry->id) {
-			entry->length = MIN(ch->len, entry->length);
-			return ch->data;
+		if (ch->id == id) {
+			return ch;
 		}
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		if (ch->entry.id == entry->id) {
-			entry->length = MIN(ch->entry.len, entry->length);
-			return ch->entry.data;
+		if (ch->entry.id == id) {
+			return &ch->entry;
 		}
 	}
 
-	LOG_WRN("Entry with ID %u not found", entry->id);
+	LOG_WRN("Entry with ID %u not found", id);
 	return NULL;
 }
 
-static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_metadata *metadata)
+static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_metadata *metadata,
+			  int *complete_entries)
 {
 	struct emds_data_entry entry;
+	struct emds_entry *ch;
 	off_t data_off = metadata->data_instance_off;
 	int32_t data_len = metadata->data_instance_len;
-	int32_t flash_entry_data_len;
-	uint8_t *data_buf;
 	int rc;
 
 	while (data_len > 0) {
@@ -289,25 +356,131 @@ static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_meta
 
 		data_off += sizeof(entry);
 		data_len -= sizeof(entry);
-		flash_entry_data_len = entry.length;
 
-		data_buf = emds_entry_memory_get(&entry);
+		ch = emds_entry_get(entry.id);
 
-		if (data_buf) {
-			rc = flash_area_read(fa, data_off, data_buf, entry.length);
+		if (ch) {
+			rc = flash_area_read(fa, data_off, ch->data, MIN(ch->len, entry.length));
 			if (rc) {
 				LOG_ERR("Failed to read data for entry ID %u: %d", entry.id, rc);
 				return -EIO;
 			}
+
+			if (complete_entries && ch->len == entry.length) {
+				(*complete_entries)++;
+			}
+		}
+
+		data_off += entry.length;
+		data_len -= entry.length;
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_EMDS_DELTA_STORE)
+static void entry_crc_from_ram(struct emds_entry *entry, size_t block, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	for (size_t off = 0; off < entry->len; off += DELTA_BLOCK_SIZE, block++) {
+		block_crc[block] = crc32_k_4_2_update(0, entry->data + off,
+						      MIN(DELTA_BLOCK_SIZE, entry->len - off));
+	}
+}
+
+static int emds_read_delta(const struct flash_area *fa, struct emds_snapshot_metadata *metadata)
+{
+	struct emds_delta_entry record;
+	struct emds_entry *ch;
+	off_t data_off = metadata->data_instance_off;
+	int32_t data_len = metadata->reserved[1];
+	int rc;
+
+	while (data_len > 0) {
+		rc = flash_area_read(fa, data_off, &record, sizeof(record));
+		if (rc) {
+			LOG_ERR("Failed to read delta record: %d", rc);
+			return -EIO;
+		}
+
+		data_off += sizeof(record);
+		data_len -= sizeof(record);
+
+		ch = emds_entry_get(record.id);
+
+		if (ch && record.offset < ch->len) {
+			rc = flash_area_read(fa, data_off, ch->data + record.offset,
+					     MIN(record.length, ch->len - record.offset));
+			if (rc) {
+				LOG_ERR("Failed to read delta for entry ID %u: %d", record.id, rc);
+				return -EIO;
+			}
 		}
 
-		data_off += flash_entry_data_len;
-		data_len -= flash_entry_data_len;
+		data_off += record.length;
+		data_len -= record.length;
 	}
 
 	return 0;
 }
 
+static int emds_read_snapshot_chain(void)
+{
+	const struct emds_partition *p = &partition[freshest_snapshot.partition_index];
+	struct emds_snapshot_metadata metadata = freshest_snapshot.metadata;
+	off_t metadata_off = freshest_snapshot.metadata_off;
+	uint32_t depth = 0;
+	size_t entries_size;
+	int complete_entries = 0;
+	int rc;
+
+	/* Delta snapshots are allocated right after the snapshot they build on, so the metadata
+	 * of the full snapshot at the start of the chain follows the freshest metadata.
+	 */
+	while (emds_snapshot_is_delta(&metadata)) {
+		metadata_off += sizeof(metadata);
+		depth++;
+
+		rc = emds_flash_snapshot_get(p, metadata_off, &metadata);
+		if (rc || metadata.fresh_cnt != freshest_snapshot.metadata.fresh_cnt - depth) {
+			LOG_ERR("Broken delta snapshot chain at depth %u", depth);
+			return -EIO;
+		}
+	}
+
+	rc = emds_read_data(p->fa, &metadata, &complete_entries);
+	if (rc) {
+		return rc;
+	}
+
+	for (uint32_t i = depth; i > 0; i--) {
+		metadata_off -= sizeof(metadata);
+
+		rc = emds_flash_snapshot_get(p, metadata_off, &metadata);
+		if (rc) {
+			return -EIO;
+		}
+
+		rc = emds_read_delta(p->fa, &metadata);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	LOG_DBG("Loaded full snapshot and %u delta snapshots", depth);
+
+	freshest_depth = depth;
+	base_complete = (complete_entries == emds_entries_size(&entries_size));
+
+	if (entries_foreach(NULL, NULL) <= CONFIG_EMDS_DELTA_BLOCKS_MAX) {
+		(void)entries_foreach(entry_crc_from_ram, NULL);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_EMDS_DELTA_STORE */
+
 int emds_load(void)
 {
 	struct emds_snapshot_candidate candidate = {0};
@@ -330,6 +503,11 @@ int emds_load(void)
 
 	emds_state = EMDS_STATE_SYNCHRONIZED;
 
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	freshest_depth = 0;
+	base_complete = false;
+#endif
+
 	if (freshest_snapshot.metadata.fresh_cnt == 0) {
 		LOG_WRN("No valid snapshot found in any partition");
 		return -ENOENT;
@@ -338,8 +516,210 @@ int emds_load(void)
 	LOG_DBG("Found freshest snapshot in partition %d with fresh_cnt %u",
 		freshest_snapshot.partition_index, freshest_snapshot.metadata.fresh_cnt);
 
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	return emds_read_snapshot_chain();
+#else
 	return emds_read_data(partition[freshest_snapshot.partition_index].fa,
-			      &freshest_snapshot.metadata);
+			      &freshest_snapshot.metadata, NULL);
+#endif
+}
+
+#if defined(CONFIG_EMDS_DELTA_STORE)
+struct compact_stream {
+	const struct emds_partition *partition;
+	off_t data_off;
+	size_t wp;
+	uint32_t crc;
+	int rc;
+	uint8_t chunk[CHUNK_SIZE];
+};
+
+static void compact_fflush(struct compact_stream *stream)
+{
+	const struct flash_parameters *fp = stream->partition->fp;
+	size_t len = ROUND_UP(stream->wp, fp->write_block_size);
+
+	if (stream->wp == 0 || stream->rc) {
+		return;
+	}
+
+	stream->crc = crc32_k_4_2_update(stream->crc, stream->chunk, stream->wp);
+	/* Only the last chunk can be shorter than the write block. */
+	memset(&stream->chunk[stream->wp], fp->erase_value, len - stream->wp);
+	stream->rc = flash_area_write(stream->partition->fa, stream->data_off, stream->chunk, len);
+	stream->data_off += stream->wp;
+	stream->wp = 0;
+}
+
+static void compact_write(struct compact_stream *stream, const uint8_t *data, size_t len)
+{
+	size_t size;
+
+	while (len > 0) {
+		size = MIN(CHUNK_SIZE - stream->wp, len);
+		memcpy(&stream->chunk[stream->wp], data, size);
+		stream->wp += size;
+		data += size;
+		len -= size;
+
+		if (stream->wp == CHUNK_SIZE) {
+			compact_fflush(stream);
+		}
+	}
+}
+
+static void entry_compact(struct emds_entry *entry, size_t block, void *user_data)
+{
+	struct compact_stream *stream = user_data;
+	struct emds_data_entry data_entry = {
+		.id = entry->id,
+		.length = entry->len,
+	};
+
+	ARG_UNUSED(block);
+
+	compact_write(stream, (const uint8_t *)&data_entry, sizeof(data_entry));
+	compact_write(stream, entry->data, entry->len);
+}
+
+struct crc_read_ctx {
+	const struct emds_partition *partition;
+	off_t data_off;
+	int rc;
+};
+
+static void entry_crc_from_flash(struct emds_entry *entry, size_t block, void *user_data)
+{
+	struct crc_read_ctx *ctx = user_data;
+	uint8_t buf[DELTA_BLOCK_SIZE];
+	size_t len;
+
+	ctx->data_off += sizeof(struct emds_data_entry);
+
+	for (size_t off = 0; off < entry->len && !ctx->rc; off += DELTA_BLOCK_SIZE, block++) {
+		len = MIN(DELTA_BLOCK_SIZE, entry->len - off);
+		ctx->rc = flash_area_read(ctx->partition->fa, ctx->data_off + off, buf, len);
+		block_crc[block] = crc32_k_4_2_update(0, buf, len);
+	}
+
+	ctx->data_off += entry->len;
+}
+
+/* Writes the current data as a full snapshot in the area of the given snapshot, and takes the
+ * block CRCs from what was written.
+ */
+static int snapshot_compact(const struct emds_partition *p,
+			    struct emds_snapshot_candidate *snapshot)
+{
+	struct compact_stream stream = {
+		.partition = p,
+		.data_off = snapshot->metadata.data_instance_off,
+	};
+	struct crc_read_ctx ctx = {
+		.partition = p,
+		.data_off = snapshot->metadata.data_instance_off,
+	};
+
+	(void)entries_foreach(entry_compact, &stream);
+	compact_fflush(&stream);
+	if (stream.rc) {
+		return stream.rc;
+	}
+
+	snapshot->metadata.snapshot_crc = stream.crc;
+	stream.rc = flash_area_write(p->fa, snapshot->metadata_off, &snapshot->metadata,
+				     sizeof(snapshot->metadata));
+	if (stream.rc) {
+		return stream.rc;
+	}
+
+	(void)entries_foreach(entry_crc_from_flash, &ctx);
+
+	return ctx.rc;
+}
+
+static void snapshot_len_set(struct emds_snapshot_candidate *snapshot, size_t len)
+{
+	snapshot->metadata.data_instance_len = len;
+	snapshot->metadata.metadata_crc =
+		crc32_k_4_2_update(0, (const unsigned char *)&snapshot->metadata,
+				   offsetof(struct emds_snapshot_metadata, metadata_crc));
+}
+
+static int delta_prepare(int idx, bool follows_freshest, size_t data_size)
+{
+	struct emds_snapshot_candidate compacted;
+	size_t full_size;
+	int rc;
+
+	allocated_delta = false;
+	allocated_snapshot.metadata.reserved[0] = 0;
+	allocated_snapshot.metadata.reserved[1] = 0;
+	(void)emds_store_size_get(&full_size);
+
+	/* Nothing is stored yet, or the entries do not fit the block table: the snapshot is a full
+	 * one, and its area is cut down to the full size.
+	 */
+	if (freshest_snapshot.metadata.fresh_cnt == 0 ||
+	    entries_foreach(NULL, NULL) > CONFIG_EMDS_DELTA_BLOCKS_MAX ||
+	    CHUNK_SIZE % partition[idx].fp->write_block_size) {
+		snapshot_len_set(&allocated_snapshot, full_size);
+		return 0;
+	}
+
+	if (follows_freshest && base_complete && freshest_depth < CONFIG_EMDS_DELTA_CHAIN_MAX) {
+		allocated_delta = true;
+		return 0;
+	}
+
+	/* The chain cannot grow further. Write the current data as a full snapshot in the
+	 * allocated area now, and allocate the delta snapshot right after it, so that the store
+	 * at power failure stays short.
+	 */
+	compacted = allocated_snapshot;
+	snapshot_len_set(&compacted, full_size);
+
+	allocated_snapshot.metadata.fresh_cnt = compacted.metadata.fresh_cnt + 1;
+	rc = emds_flash_allocate_snapshot(&partition[idx], &compacted, &allocated_snapshot,
+					  data_size);
+	if (rc) {
+		LOG_WRN("No space to compact snapshots, storing a full snapshot");
+		allocated_snapshot = compacted;
+		return 0;
+	}
+
+	LOG_DBG("Compacting snapshots into fresh_cnt %u", compacted.metadata.fresh_cnt);
+
+	rc = snapshot_compact(&partition[idx], &compacted);
+	if (rc) {
+		LOG_ERR("Failed to compact snapshots: %d", rc);
+		return rc;
+	}
+
+	freshest_snapshot = compacted;
+	freshest_depth = 0;
+	base_complete = true;
+	allocated_delta = true;
+
+	return 0;
+}
+#endif /* CONFIG_EMDS_DELTA_STORE */
+
+static int snapshot_allocated(int idx, bool follows_freshest, size_t data_size)
+{
+	allocated_snapshot.partition_index = idx;
+
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	int rc = delta_prepare(idx, follows_freshest, data_size);
+
+	if (rc) {
+		return rc;
+	}
+#endif
+
+	emds_state = EMDS_STATE_READY;
+
+	return 0;
 }
 
 int emds_prepare(void)
@@ -354,8 +734,23 @@ int emds_prepare(void)
 		return -ECANCELED;
 	}
 
+#if defined(CONFIG_EMDS_SNAPSHOT_INDEX)
+	if (freshest_snapshot.metadata.fresh_cnt > 0) {
+		rc = emds_flash_index_update(&partition[freshest_snapshot.partition_index],
+					     &freshest_snapshot);
+		if (rc && rc != -ENOSPC) {
+			LOG_WRN("Failed to update snapshot index: %d", rc);
+		}
+
+		rc = 0;
+	}
+#endif
+
 	/* Returned status is not checked since initialization state is checked above */
 	(void)emds_store_size_get(&data_size);
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	data_size = MAX(data_size, delta_size_max());
+#endif
 
 	allocated_snapshot.metadata.fresh_cnt = freshest_snapshot.metadata.fresh_cnt + 1;
 
@@ -366,9 +761,7 @@ int emds_prepare(void)
 						  &freshest_snapshot, &allocated_snapshot,
 						  data_size);
 		if (rc == 0) {
-			allocated_snapshot.partition_index = freshest_partition_idx;
-			emds_state = EMDS_STATE_READY;
-			return 0;
+			return snapshot_allocated(freshest_partition_idx, true, data_size);
 		}
 		rc = 0;
 	}
@@ -387,9 +780,7 @@ int emds_prepare(void)
 			rc = emds_flash_allocate_snapshot(&partition[idx], NULL,
 							  &allocated_snapshot, data_size);
 			if (rc == 0) {
-				allocated_snapshot.partition_index = idx;
-				emds_state = EMDS_STATE_READY;
-				return 0;
+				return snapshot_allocated(idx, false, data_size);
 			}
 		}
 
@@ -455,6 +846,58 @@ static void stream_fflush(const struct emds_partition *partition, off_t *data_of
 	}
 }
 
+#if defined(CONFIG_EMDS_DELTA_STORE)
+struct delta_stream {
+	const struct emds_partition *partition;
+	off_t *data_off;
+	uint8_t *out;
+	size_t *wp;
+};
+
+static void delta_record_to_stream(struct delta_stream *stream, struct emds_entry *entry,
+				   size_t offset, size_t len)
+{
+	struct emds_delta_entry record = {
+		.id = entry->id,
+		.offset = offset,
+		.length = len,
+	};
+
+	LOG_DBG("Storing entry ID %u, offset %zu, length %zu", entry->id, offset, len);
+	data_to_stream(stream->partition, stream->data_off, (uint8_t *)&record, stream->out,
+		       stream->wp, sizeof(record));
+	data_to_stream(stream->partition, stream->data_off, entry->data + offset, stream->out,
+		       stream->wp, len);
+}
+
+static void entry_delta_to_stream(struct emds_entry *entry, size_t block, void *user_data)
+{
+	struct delta_stream *stream = user_data;
+	size_t run_off = 0;
+	bool run = false;
+	bool changed;
+
+	/* Adjacent changed blocks are stored as one record. */
+	for (size_t off = 0; off < entry->len; off += DELTA_BLOCK_SIZE, block++) {
+		changed = crc32_k_4_2_update(0, entry->data + off,
+					     MIN(DELTA_BLOCK_SIZE, entry->len - off)) !=
+			  block_crc[block];
+
+		if (changed && !run) {
+			run_off = off;
+			run = true;
+		} else if (!changed && run) {
+			delta_record_to_stream(stream, entry, run_off, off - run_off);
+			run = false;
+		}
+	}
+
+	if (run) {
+		delta_record_to_stream(stream, entry, run_off, entry->len - run_off);
+	}
+}
+#endif /* CONFIG_EMDS_DELTA_STORE */
+
 int emds_store(void)
 {
 	uint32_t store_key;
@@ -485,18 +928,52 @@ int emds_store(void)
 				      offsetof(struct emds_snapshot_metadata, snapshot_crc));
 	}
 
-	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
-	}
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	if (allocated_delta) {
+		struct delta_stream stream = {
+			.partition = &partition[idx],
+			.data_off = &data_off,
+			.out = data_chunk,
+			.wp = &wp,
+		};
+
+		(void)entries_foreach(entry_delta_to_stream, &stream);
+	} else
+#endif
+	{
+		STRUCT_SECTION_FOREACH(emds_entry, ch) {
+			entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
+		}
 
-	struct emds_dynamic_entry *ch;
+		struct emds_dynamic_entry *ch;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
+		SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+			entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
+		}
 	}
 
 	stream_fflush(&partition[idx], &data_off, data_chunk, &wp);
 
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	if (allocated_delta) {
+		allocated_snapshot.metadata.reserved[0] = EMDS_SNAPSHOT_DELTA_MARKER;
+		allocated_snapshot.metadata.reserved[1] =
+			data_off - allocated_snapshot.metadata.data_instance_off;
+		allocated_snapshot.metadata.snapshot_crc = crc32_k_4_2_update(
+			allocated_snapshot.metadata.snapshot_crc,
+			(const unsigned char *)allocated_snapshot.metadata.reserved,
+			sizeof(allocated_snapshot.metadata.reserved));
+
+		if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
+			emds_flash_write_data(&partition[idx],
+					      allocated_snapshot.metadata_off +
+						      offsetof(struct emds_snapshot_metadata, reserved),
+					      allocated_snapshot.metadata.reserved,
+					      sizeof(allocated_snapshot.metadata.reserved));
+		}
+	}
+#endif
+
 	if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
 		LOG_DBG("Writing snapshot crc on offset: 0x%4lx, crc : 0x%4x",
 			 allocated_snapshot.metadata_off +
@@ -513,7 +990,9 @@ int emds_store(void)
 			 allocated_snapshot.metadata.snapshot_crc);
 		emds_flash_write_data(&partition[idx], allocated_snapshot.metadata_off,
 				      &allocated_snapshot.metadata,
-				      offsetof(struct emds_snapshot_metadata, reserved));
+				      IS_ENABLED(CONFIG_EMDS_DELTA_STORE)
+					      ? sizeof(struct emds_snapshot_metadata)
+					      : offsetof(struct emds_snapshot_metadata, reserved));
 	}
 
 unlock_and_exit:
@@ -541,6 +1020,11 @@ int emds_clear(void)
 	emds_state = EMDS_STATE_INITIALIZED;
 	memset(&freshest_snapshot, 0, sizeof(freshest_snapshot));
 	memset(&allocated_snapshot, 0, sizeof(allocated_snapshot));
+#if defined(CONFIG_EMDS_DELTA_STORE)
+	freshest_depth = 0;
+	base_complete = false;
+	allocated_delta = false;
+#endif
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
 		rc = emds_flash_erase_partition(&partition[i]);
 		if (rc) {
@@ -22,6 +22,8 @@ LOG_MODULE_REGISTER(emds_flash, CONFIG_EMDS_LOG_LEVEL);
 #define SOC_NV_FLASH_NODE             DT_INST(0, soc_nv_flash)
 /* "EMDS" in ASCII */
 #define EMDS_SNAPSHOT_METADATA_MARKER 0x4D444553
+/* "EIDX" in ASCII */
+#define EMDS_SNAPSHOT_INDEX_MARKER    0x58444945
 
 static void cand_list_init(sys_slist_t *cand_list, struct emds_snapshot_candidate *cand_buf)
 {
@@ -79,6 +81,14 @@ static bool cand_snapshot_crc_check(const struct emds_partition *partition,
 	off_t data_off = metadata->data_instance_off;
 	int rc;
 
+	if (emds_snapshot_is_delta(metadata)) {
+		if (metadata->reserved[1] > data_length) {
+			return false;
+		}
+
+		data_length = metadata->reserved[1];
+	}
+
 	while (data_length > 0) {
 		chunk_size = MIN(data_length, sizeof(data_chunk));
 		rc = flash_area_read(fa, data_off, data_chunk, chunk_size);
@@ -92,6 +102,11 @@ static bool cand_snapshot_crc_check(const struct emds_partition *partition,
 		data_length -= chunk_size;
 	}
 
+	if (emds_snapshot_is_delta(metadata)) {
+		crc = crc32_k_4_2_update(crc, (const unsigned char *)metadata->reserved,
+					 sizeof(metadata->reserved));
+	}
+
 	return crc == metadata->snapshot_crc;
 }
 
@@ -120,6 +135,12 @@ int emds_flash_init(struct emds_partition *partition)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_EMDS_SNAPSHOT_INDEX) &&
+	    sizeof(struct emds_snapshot_index) % partition->fp->write_block_size) {
+		LOG_ERR("Snapshot index is not aligned to write block size");
+		return -EINVAL;
+	}
+
 	if (flash_params_get_erase_cap(partition->fp) & FLASH_ERASE_C_EXPLICIT) {
 		struct flash_pages_info info;
 		int rc;
@@ -145,15 +166,14 @@ int emds_flash_init(struct emds_partition *partition)
 	return 0;
 }
 
-int emds_flash_scan_partition(const struct emds_partition *partition,
-			      struct emds_snapshot_candidate *candidate)
+static int partition_scan(const struct emds_partition *partition, off_t read_off,
+			  struct emds_snapshot_candidate *candidate)
 {
 	struct emds_snapshot_metadata cache = {0};
 	struct emds_snapshot_candidate cand_buf[CONFIG_EMDS_MAX_CANDIDATES] = {0};
 	sys_slist_t cand_list;
 	sys_snode_t *cand_node;
 	const struct flash_area *fa = partition->fa;
-	off_t read_off = fa->fa_size - sizeof(cache);
 	int failures = 0;
 	uint32_t crc;
 	int rc;
@@ -213,6 +233,192 @@ int emds_flash_scan_partition(const struct emds_partition *partition,
 	return 0;
 }
 
+#if defined(CONFIG_EMDS_SNAPSHOT_INDEX)
+static off_t index_slot_off(const struct emds_partition *partition, int slot)
+{
+	return emds_flash_metadata_end(partition) + slot * sizeof(struct emds_snapshot_index);
+}
+
+static uint32_t index_crc(const struct emds_snapshot_index *index)
+{
+	return crc32_k_4_2_update(0, (const unsigned char *)index,
+				  offsetof(struct emds_snapshot_index, crc));
+}
+
+/* Finds the valid index record with the biggest fresh_cnt value. */
+static int index_find(const struct emds_partition *partition, struct emds_snapshot_index *index,
+		      int *index_slot)
+{
+	struct emds_snapshot_index cache;
+	int rc;
+
+	*index_slot = -1;
+
+	for (int slot = 0; slot < CONFIG_EMDS_SNAPSHOT_INDEX_SLOTS; slot++) {
+		rc = flash_area_read(partition->fa, index_slot_off(partition, slot), &cache,
+				     sizeof(cache));
+		if (rc) {
+			LOG_ERR("Failed to read snapshot index: %d", rc);
+			return -EIO;
+		}
+
+		if (cache.marker != EMDS_SNAPSHOT_INDEX_MARKER || cache.crc != index_crc(&cache)) {
+			continue;
+		}
+
+		if (*index_slot < 0 || cache.fresh_cnt > index->fresh_cnt) {
+			*index = cache;
+			*index_slot = slot;
+		}
+	}
+
+	return *index_slot < 0 ? -ENOENT : 0;
+}
+
+static int index_slot_free_find(const struct emds_partition *partition, int *free_slot)
+{
+	uint8_t cmp[sizeof(struct emds_snapshot_index)];
+	uint8_t cache[sizeof(struct emds_snapshot_index)];
+	int rc;
+
+	memset(cmp, partition->fp->erase_value, sizeof(cmp));
+
+	for (int slot = 0; slot < CONFIG_EMDS_SNAPSHOT_INDEX_SLOTS; slot++) {
+		rc = flash_area_read(partition->fa, index_slot_off(partition, slot), cache,
+				     sizeof(cache));
+		if (rc) {
+			LOG_ERR("Failed to read snapshot index: %d", rc);
+			return -EIO;
+		}
+
+		if (!memcmp(cmp, cache, sizeof(cache))) {
+			*free_slot = slot;
+			return 0;
+		}
+	}
+
+	return -ENOSPC;
+}
+
+int emds_flash_index_update(const struct emds_partition *partition,
+			    const struct emds_snapshot_candidate *snapshot)
+{
+	struct emds_snapshot_index index = {
+		.marker = EMDS_SNAPSHOT_INDEX_MARKER,
+		.fresh_cnt = snapshot->metadata.fresh_cnt,
+		.metadata_off = snapshot->metadata_off,
+	};
+	struct emds_snapshot_index current;
+	int slot;
+	int rc;
+
+	rc = index_find(partition, &current, &slot);
+	if (rc == 0 && current.fresh_cnt == index.fresh_cnt &&
+	    current.metadata_off == index.metadata_off) {
+		return 0;
+	} else if (rc && rc != -ENOENT) {
+		return rc;
+	}
+
+	if (flash_params_get_erase_cap(partition->fp) & FLASH_ERASE_C_EXPLICIT) {
+		rc = index_slot_free_find(partition, &slot);
+		if (rc) {
+			return rc;
+		}
+	} else {
+		/* Records are written in turn, so that a torn write never hits the valid one. */
+		slot = (slot + 1) % CONFIG_EMDS_SNAPSHOT_INDEX_SLOTS;
+	}
+
+	index.crc = index_crc(&index);
+
+	LOG_DBG("Indexing snapshot with fresh_cnt %u in slot %d", index.fresh_cnt, slot);
+
+	rc = flash_area_write(partition->fa, index_slot_off(partition, slot), &index,
+			      sizeof(index));
+	if (rc) {
+		LOG_ERR("Failed to write snapshot index: %d", rc);
+		return -EIO;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_EMDS_SNAPSHOT_INDEX */
+
+int emds_flash_scan_partition(const struct emds_partition *partition,
+			      struct emds_snapshot_candidate *candidate)
+{
+#if defined(CONFIG_EMDS_SNAPSHOT_INDEX)
+	struct emds_snapshot_candidate cand = {0};
+	struct emds_snapshot_index index;
+	off_t metadata_end = emds_flash_metadata_end(partition);
+	off_t index_off;
+	int slot;
+	int rc;
+
+	if (index_find(partition, &index, &slot) == 0) {
+		index_off = index.metadata_off;
+	} else {
+		index_off = metadata_end;
+	}
+
+	/* The indexed offset must be a metadata slot. */
+	if (index_off < metadata_end &&
+	    (metadata_end - index_off) % sizeof(struct emds_snapshot_metadata) == 0) {
+		rc = partition_scan(partition, index_off, &cand);
+		if (rc) {
+			return rc;
+		}
+
+		/* Snapshots stored after the index was written are found further on. If
+		 * neither these nor the indexed snapshot are valid, the index cannot be
+		 * trusted.
+		 */
+		if (cand.metadata.fresh_cnt >= index.fresh_cnt) {
+			*candidate = cand;
+			return 0;
+		}
+
+		LOG_WRN("Snapshot index is not valid, scanning the whole partition");
+	}
+#endif
+
+	return partition_scan(partition,
+			      emds_flash_metadata_end(partition) -
+				      sizeof(struct emds_snapshot_metadata),
+			      candidate);
+}
+
+int emds_flash_snapshot_get(const struct emds_partition *partition, off_t metadata_off,
+			    struct emds_snapshot_metadata *metadata)
+{
+	uint32_t crc;
+	int rc;
+
+	if (metadata_off < 0 ||
+	    metadata_off + (off_t)sizeof(*metadata) > emds_flash_metadata_end(partition)) {
+		return -EINVAL;
+	}
+
+	rc = flash_area_read(partition->fa, metadata_off, metadata, sizeof(*metadata));
+	if (rc) {
+		LOG_ERR("Failed to read snapshot metadata: %d", rc);
+		return -EIO;
+	}
+
+	if (metadata->marker != EMDS_SNAPSHOT_METADATA_MARKER) {
+		return -EINVAL;
+	}
+
+	crc = crc32_k_4_2_update(0, (const unsigned char *)metadata,
+				 offsetof(struct emds_snapshot_metadata, metadata_crc));
+	if (crc != metadata->metadata_crc) {
+		return -EINVAL;
+	}
+
+	return cand_snapshot_crc_check(partition, metadata) ? 0 : -EINVAL;
+}
+
 int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 				 const struct emds_snapshot_candidate *freshest_snapshot,
 				 struct emds_snapshot_candidate *allocated_snapshot,
@@ -220,7 +426,8 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 {
 	const struct flash_area *fa = partition->fa;
 	const struct flash_parameters *fp = partition->fp;
-	off_t metadata_off = freshest_snapshot ? freshest_snapshot->metadata_off : fa->fa_size;
+	off_t metadata_off = freshest_snapshot ? freshest_snapshot->metadata_off
+					       : emds_flash_metadata_end(partition);
 	off_t data_off = freshest_snapshot
 				 ? ROUND_UP(freshest_snapshot->metadata.data_instance_off +
 						    freshest_snapshot->metadata.data_instance_len,
@@ -233,7 +440,7 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 
 	if (aligned_data_size +
 		    ROUND_UP(sizeof(struct emds_snapshot_metadata), fp->write_block_size) >
-	    fa->fa_size) {
+	    emds_flash_metadata_end(partition)) {
 		LOG_ERR("Invalid data size: %zu", data_size);
 		return -EINVAL;
 	}
@@ -9,6 +9,7 @@
 
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -55,6 +56,26 @@ struct emds_data_entry {
 	uint8_t data[];
 } __packed;
 
+/**
+ * @brief Emergency data storage delta record structure
+ *
+ * A delta snapshot consists of delta records that hold the changed part of an entry.
+ *
+ * @param id Unique data identifier.
+ * @param offset Offset of the data within the entry.
+ * @param length Data length.
+ * @param data Zero length array for data reference.
+ */
+struct emds_delta_entry {
+	uint16_t id;
+	uint16_t offset;
+	uint16_t length;
+	uint8_t data[];
+} __packed;
+
+/* "DLTA" in ASCII */
+#define EMDS_SNAPSHOT_DELTA_MARKER 0x444C5441
+
 /**
  * @brief Emergency data storage metadata structure
  *
@@ -72,6 +93,9 @@ struct emds_data_entry {
  * @param data_instance_len The data instance area length.
  * @param metadata_crc The metadata structure CRC.
  * @param snapshot_crc The snapshot area CRC.
+ * @param reserved Reserved. In a delta snapshot, the first word is
+ *                 @ref EMDS_SNAPSHOT_DELTA_MARKER and the second word is the length of
+ *                 the written data. Both words are then covered by the snapshot CRC.
  */
 struct emds_snapshot_metadata {
 	uint32_t marker;
@@ -83,6 +107,47 @@ struct emds_snapshot_metadata {
 	uint32_t reserved[2];
 } __packed;
 
+/**
+ * @brief Check if a snapshot is a delta snapshot.
+ *
+ * @param metadata The snapshot metadata.
+ *
+ * @return true if the snapshot only holds the data changed since the previous snapshot.
+ */
+static inline bool emds_snapshot_is_delta(const struct emds_snapshot_metadata *metadata)
+{
+	return IS_ENABLED(CONFIG_EMDS_DELTA_STORE) &&
+	       metadata->reserved[0] == EMDS_SNAPSHOT_DELTA_MARKER;
+}
+
+/**
+ * @brief Emergency data storage snapshot index structure
+ *
+ * Index records are stored in the area at the end of the partition. They point to the
+ * freshest snapshot known when the record was written, so that scanning can start there
+ * instead of at the end of the partition.
+ *
+ * @param marker The index marker.
+ * @param fresh_cnt The freshness counter of the indexed snapshot.
+ * @param metadata_off Offset of the indexed snapshot metadata within the partition.
+ * @param crc The index record CRC.
+ */
+struct emds_snapshot_index {
+	uint32_t marker;
+	uint32_t fresh_cnt;
+	uint32_t metadata_off;
+	uint32_t crc;
+} __packed;
+
+#if defined(CONFIG_EMDS_SNAPSHOT_INDEX)
+/** Size of the index area at the end of the partition. */
+#define EMDS_SNAPSHOT_INDEX_AREA_SIZE                                                              \
+	ROUND_UP(CONFIG_EMDS_SNAPSHOT_INDEX_SLOTS * sizeof(struct emds_snapshot_index),            \
+		 sizeof(struct emds_snapshot_metadata))
+#else
+#define EMDS_SNAPSHOT_INDEX_AREA_SIZE 0
+#endif
+
 /**
  * @brief Emergency data storage snapshot candidate structure
  *
@@ -102,6 +167,21 @@ struct emds_snapshot_candidate {
 	struct emds_snapshot_metadata metadata;
 };
 
+/**
+ * @brief Get the end of the metadata area of the partition.
+ *
+ * Snapshot metadata is allocated from the end of the metadata area towards the start of
+ * the partition. The index area, if any, follows the metadata area.
+ *
+ * @param partition Pointer to the emergency data storage partition structure.
+ *
+ * @return Offset of the end of the metadata area within the partition.
+ */
+static inline off_t emds_flash_metadata_end(const struct emds_partition *partition)
+{
+	return partition->fa->fa_size - EMDS_SNAPSHOT_INDEX_AREA_SIZE;
+}
+
 /**
  * @brief Initialize the emergency data storage flash partition.
  *
@@ -129,6 +209,36 @@ int emds_flash_init(struct emds_partition *partition);
 int emds_flash_scan_partition(const struct emds_partition *partition,
 			      struct emds_snapshot_candidate *candidate);
 
+/**
+ * @brief Read and validate the snapshot with the metadata at the given offset.
+ *
+ * @param partition Pointer to the emergency data storage partition structure.
+ * @param metadata_off Offset of the metadata within the partition.
+ * @param metadata Pointer to the structure that will be filled with the snapshot metadata.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the metadata or the snapshot data is not valid.
+ * @retval -EIO if an error occurs during reading.
+ */
+int emds_flash_snapshot_get(const struct emds_partition *partition, off_t metadata_off,
+			    struct emds_snapshot_metadata *metadata);
+
+/**
+ * @brief Point the snapshot index of the partition to the given snapshot.
+ *
+ * The next scan of the partition starts at the indexed snapshot, and falls back to
+ * scanning the whole partition if no valid snapshot is found from there.
+ *
+ * @param partition Pointer to the emergency data storage partition structure.
+ * @param snapshot Pointer to the snapshot candidate structure to index.
+ *
+ * @retval 0 on success, or if the index already points to the snapshot.
+ * @retval -ENOSPC if the memory has explicit erase and all index slots are used.
+ * @retval -EIO if an error occurs during reading or writing.
+ */
+int emds_flash_index_update(const struct emds_partition *partition,
+			    const struct emds_snapshot_candidate *snapshot);
+
 /** * @brief Allocate a new snapshot in the emergency data storage partition.
  *
  * This function allocates a new snapshot in the specified partition based on the
@@ -279,10 +279,55 @@ static uint8_t tx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 static uint8_t rx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 				 sizeof(struct esb_radio_pdu)];
 
-/* Random access buffer variables for ACK payload handling */
+/* Random access buffer variables for ACK payload handling, also used for
+ * the per-pipe TX queues in PTX mode.
+ */
 struct payload_wrap ack_pl_wrap[CONFIG_ESB_TX_FIFO_SIZE];
 struct payload_wrap *ack_pl_wrap_pipe[CONFIG_ESB_PIPE_COUNT];
 
+/* Number of payloads queued on each pipe. */
+static atomic_t tx_pipe_count[CONFIG_ESB_PIPE_COUNT];
+
+#if defined(CONFIG_ESB_TX_PIPE_QUEUES)
+/* Pipe of the payload that is transmitted next in PTX mode. */
+static uint8_t tx_pipe;
+#endif
+
+#if defined(CONFIG_ESB_CHANNEL_HOPPING)
+/* Hopping channel with its packet error rate tracker. */
+struct hop_channel {
+	uint8_t channel;
+	bool blocked;
+	uint32_t blocked_until; /* Uptime in milliseconds. */
+	uint32_t attempts;
+	uint32_t errors;
+};
+
+static struct {
+	struct hop_channel channels[CONFIG_ESB_HOP_CHANNELS_MAX];
+	uint8_t count;
+	uint8_t current;
+	/* The current channel has been excluded from the channel map. */
+	bool pending;
+	/* Uptime of the last packet received by the PRX, in milliseconds. */
+	uint32_t last_rx;
+} hop;
+#endif
+
+#if defined(CONFIG_ESB_PIPE_STATS)
+struct pipe_stats {
+	uint32_t tx_success;
+	uint32_t tx_failed;
+	uint32_t retransmits;
+	uint32_t latency_max_us;
+	uint64_t latency_sum_us;
+};
+
+static struct pipe_stats pipe_stats[CONFIG_ESB_PIPE_COUNT];
+/* Cycle count at which each TX payload was written. */
+static uint32_t tx_queued_at[CONFIG_ESB_TX_FIFO_SIZE];
+#endif
+
 /* Run time variables */
 static uint8_t pids[CONFIG_ESB_PIPE_COUNT];
 static struct pipe_info rx_pipe_info[CONFIG_ESB_PIPE_COUNT];
@@ -1188,6 +1233,14 @@ static void reset_fifos(void)
 	tx_fifo.front = 0;
 	atomic_clear(&tx_fifo.count);
 
+	for (size_t i = 0; i < CONFIG_ESB_PIPE_COUNT; i++) {
+		atomic_clear(&tx_pipe_count[i]);
+	}
+
+#if defined(CONFIG_ESB_TX_PIPE_QUEUES)
+	tx_pipe = 0;
+#endif
+
 	rx_fifo.back = 0;
 	rx_fifo.front = 0;
 	atomic_clear(&rx_fifo.count);
@@ -1219,15 +1272,212 @@ static void initialize_fifos(void)
 	}
 }
 
+/* Index of a TX payload in the payload storage. The entries of tx_fifo.payload
+ * point to the storage in index order.
+ */
+static inline size_t tx_payload_idx(const struct esb_payload *payload)
+{
+	return payload - tx_fifo.payload[0];
+}
+
+static void pipe_stats_queued(const struct esb_payload *payload)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	tx_queued_at[tx_payload_idx(payload)] = k_cycle_get_32();
+#endif
+}
+
+static void pipe_stats_tx_done(const struct esb_payload *payload, uint32_t retransmits)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	struct pipe_stats *stats = &pipe_stats[payload->pipe];
+	uint32_t latency_us =
+		k_cyc_to_us_floor32(k_cycle_get_32() - tx_queued_at[tx_payload_idx(payload)]);
+
+	stats->tx_success++;
+	stats->retransmits += retransmits;
+	stats->latency_sum_us += latency_us;
+	stats->latency_max_us = MAX(stats->latency_max_us, latency_us);
+#endif
+}
+
+static void pipe_stats_tx_failed(uint8_t pipe, uint32_t retransmits)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	pipe_stats[pipe].tx_failed++;
+	pipe_stats[pipe].retransmits += retransmits;
+#endif
+}
+
+static void pipe_stats_retransmit(uint8_t pipe)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	pipe_stats[pipe].retransmits++;
+#endif
+}
+
+#if defined(CONFIG_ESB_TX_PIPE_QUEUES)
+static void tx_pipe_next(void)
+{
+	for (size_t i = 0; i < CONFIG_ESB_PIPE_COUNT; i++) {
+#if defined(CONFIG_ESB_TX_PIPE_SCHED_PRIO)
+		uint8_t pipe = i;
+#else
+		uint8_t pipe = (tx_pipe + 1 + i) % CONFIG_ESB_PIPE_COUNT;
+#endif
+
+		if (ack_pl_wrap_pipe[pipe] != NULL) {
+			tx_pipe = pipe;
+			return;
+		}
+	}
+}
+#endif
+
+#if defined(CONFIG_ESB_CHANNEL_HOPPING)
+static void hop_next(void)
+{
+	uint32_t now = k_uptime_get_32();
+
+	for (size_t i = 1; i <= hop.count; i++) {
+		uint8_t idx = (hop.current + i) % hop.count;
+		struct hop_channel *ch = &hop.channels[idx];
+
+		if (ch->blocked && (int32_t)(now - ch->blocked_until) >= 0) {
+			ch->blocked = false;
+		}
+
+		if (!ch->blocked) {
+			hop.current = idx;
+			esb_addr.rf_channel = ch->channel;
+			break;
+		}
+	}
+
+	hop.pending = false;
+}
+
+/* Add packets to the error rate tracker of the current channel.
+ *
+ * @return true if the current channel was excluded from the channel map.
+ */
+static bool hop_record(uint32_t attempts, uint32_t errors)
+{
+	struct hop_channel *ch = &hop.channels[hop.current];
+	size_t in_map = 0;
+
+	ch->attempts += attempts;
+	ch->errors += errors;
+
+	if (ch->attempts < CONFIG_ESB_HOP_PER_WINDOW) {
+		return false;
+	}
+
+	for (size_t i = 0; i < hop.count; i++) {
+		in_map += !hop.channels[i].blocked;
+	}
+
+	/* The last channel of the map is never excluded. */
+	if (in_map > 1 &&
+	    ch->errors * 100 >= (uint64_t)CONFIG_ESB_HOP_PER_THRESHOLD * ch->attempts) {
+		ch->blocked = true;
+		ch->blocked_until = k_uptime_get_32() + CONFIG_ESB_HOP_BLOCK_TIME_MS;
+	}
+
+	ch->attempts = 0;
+	ch->errors = 0;
+
+	return ch->blocked;
+}
+#endif /* defined(CONFIG_ESB_CHANNEL_HOPPING) */
+
+static void hop_on_tx(uint32_t attempts, bool success)
+{
+#if defined(CONFIG_ESB_CHANNEL_HOPPING)
+	if (hop.count < 2) {
+		return;
+	}
+
+	if (hop_record(attempts, success ? attempts - 1 : attempts) || !success) {
+		hop_next();
+	}
+#endif
+}
+
+static void hop_on_rx(bool success)
+{
+#if defined(CONFIG_ESB_CHANNEL_HOPPING)
+	if (hop.count < 2) {
+		return;
+	}
+
+	if (success) {
+		hop.last_rx = k_uptime_get_32();
+	}
+
+	if (hop_record(1, success ? 0 : 1)) {
+		hop.pending = true;
+	}
+#endif
+}
+
+/* Check if the PRX should move to the next channel. The channel is set up
+ * when listening is started in the next timeslot.
+ */
+static bool hop_prx_due(void)
+{
+#if defined(CONFIG_ESB_CHANNEL_HOPPING)
+	uint32_t now = k_uptime_get_32();
+
+	if (hop.count < 2 ||
+	    (!hop.pending && (now - hop.last_rx) < CONFIG_ESB_HOP_PRX_DWELL_MS)) {
+		return false;
+	}
+
+	hop_next();
+	hop.last_rx = now;
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+/* Payload to be transmitted next in PTX mode. The TX FIFO must not be empty. */
+static struct esb_payload *tx_fifo_first(void)
+{
+#if defined(CONFIG_ESB_TX_PIPE_QUEUES)
+	return ack_pl_wrap_pipe[tx_pipe]->p_payload;
+#else
+	return tx_fifo.payload[tx_fifo.front];
+#endif
+}
+
 static void tx_fifo_remove_first(void)
 {
 	if (atomic_get(&tx_fifo.count) == 0) {
 		return;
 	}
 
+#if defined(CONFIG_ESB_TX_PIPE_QUEUES)
+	struct payload_wrap *first = ack_pl_wrap_pipe[tx_pipe];
+
+	if (first == NULL) {
+		return;
+	}
+
+	atomic_dec(&tx_pipe_count[tx_pipe]);
+	ack_pl_wrap_pipe[tx_pipe] = first->p_next;
+	first->in_use = false;
+
+	tx_pipe_next();
+#else
+	atomic_dec(&tx_pipe_count[tx_fifo.payload[tx_fifo.front]->pipe]);
+
 	if (++tx_fifo.front >= CONFIG_ESB_TX_FIFO_SIZE) {
 		tx_fifo.front = 0;
 	}
+#endif
 
 	atomic_dec(&tx_fifo.count);
 }
@@ -1409,7 +1659,7 @@ static void start_tx_transaction(void)
 	bool is_tx_idle = false;
 	struct esb_radio_pdu *pdu = (struct esb_radio_pdu *)tx_payload_buffer;
 	/* Prepare the payload */
-	current_payload = tx_fifo.payload[tx_fifo.front];
+	current_payload = tx_fifo_first();
 
 	switch (esb_cfg.protocol) {
 	case ESB_PROTOCOL_ESB:
@@ -1549,6 +1799,7 @@ static void on_timer_compare1_tx_noack(void)
 
 	last_tx_attempts = 1;
 	atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
+	pipe_stats_tx_done(current_payload, 0);
 	tx_fifo_remove_first();
 
 	if (atomic_get(&tx_fifo.count) == 0) {
@@ -1567,6 +1818,7 @@ static void on_radio_disabled_tx_noack(void)
 
 	last_tx_attempts = 1;
 	atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
+	pipe_stats_tx_done(current_payload, 0);
 	tx_fifo_remove_first();
 
 	if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT)) {
@@ -1587,7 +1839,7 @@ static void on_radio_disabled_tx_noack(void)
 			esb_state = ESB_STATE_IDLE;
 			ts_next_action = TS_NEXT_ACTION_IDLE;
 		} else {
-			update_ts_duration_params_for_tx(tx_fifo.payload[tx_fifo.front]->length);
+			update_ts_duration_params_for_tx(tx_fifo_first()->length);
 			ts_request_earliest.params.earliest.length_us =
 				ts_duration_params.tx_rx_sequence;
 
@@ -1802,6 +2054,8 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 		atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
 		last_tx_attempts = esb_cfg.retransmit_count - retransmits_remaining + 1;
 
+		pipe_stats_tx_done(current_payload, last_tx_attempts - 1);
+		hop_on_tx(last_tx_attempts, true);
 		tx_fifo_remove_first();
 
 		if ((esb_cfg.protocol != ESB_PROTOCOL_ESB) && (rx_pdu->type.dpl_pdu.length > 0)) {
@@ -1830,7 +2084,7 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 
 			if (start_next_tx) {
 				update_ts_duration_params_for_tx(
-					tx_fifo.payload[tx_fifo.front]->length);
+					tx_fifo_first()->length);
 				ts_request_earliest.params.earliest.length_us =
 					ts_duration_params.tx_rx_sequence;
 
@@ -1855,6 +2109,8 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 
 		last_tx_attempts = esb_cfg.retransmit_count + 1;
 		atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_FAILED);
+		pipe_stats_tx_failed(current_payload->pipe, esb_cfg.retransmit_count);
+		hop_on_tx(last_tx_attempts, false);
 
 		esb_state = ESB_STATE_IDLE;
 		errata_216_off();
@@ -2017,8 +2273,11 @@ static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_
 		/* Pipe stays in ACK with payload until TX FIFO is empty */
 		/* Do not report TX success on first ack payload or retransmit */
 		if (pipe_info->ack_payload == true && !retransmit_payload) {
+			pipe_stats_tx_done(current_payload, 0);
+
 			ack_pl_wrap_pipe[pipe]->in_use = false;
 			ack_pl_wrap_pipe[pipe] = ack_pl_wrap_pipe[pipe]->p_next;
+			atomic_dec(&tx_pipe_count[pipe]);
 			atomic_dec(&tx_fifo.count);
 			if (atomic_get(&tx_fifo.count) > 0 && ack_pl_wrap_pipe[pipe] != NULL) {
 				current_payload = ack_pl_wrap_pipe[pipe]->p_payload;
@@ -2029,6 +2288,9 @@ static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_
 			/* ACK payloads also require TX_DS */
 			/* (page 40 of the 'nRF24LE1_Product_Specification_rev1_6.pdf') */
 			atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
+		} else if (pipe_info->ack_payload == true) {
+			/* The PTX did not receive the ACK, the same payload is sent again. */
+			pipe_stats_retransmit(pipe);
 		}
 
 		if (current_payload != 0) {
@@ -2058,6 +2320,7 @@ static void on_radio_disabled_rx(void)
 	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_payload_buffer;
 
 	if (!nrf_radio_crc_status_check(NRF_RADIO)) {
+		hop_on_rx(false);
 		clear_events_restart_rx();
 		return;
 	}
@@ -2078,6 +2341,9 @@ static void on_radio_disabled_rx(void)
 	pipe_info->pid = rx_pdu->type.dpl_pdu.pid;
 	pipe_info->crc = nrf_radio_rxcrc_get(NRF_RADIO);
 
+	/* A retransmitted packet means that the PTX did not receive the ACK. */
+	hop_on_rx(!retransmit_payload);
+
 	/* Check if an ack should be sent */
 	if ((esb_cfg.selective_auto_ack == false) || rx_pdu->type.dpl_pdu.ack) {
 		esb_fem_for_tx_ack();
@@ -2581,6 +2847,22 @@ static struct payload_wrap *find_free_payload_cont(void)
 	return 0;
 }
 
+static void pipe_queue_append(struct payload_wrap *wrap, uint8_t pipe)
+{
+	if (ack_pl_wrap_pipe[pipe] == NULL) {
+		ack_pl_wrap_pipe[pipe] = wrap;
+	} else {
+		struct payload_wrap *pl = ack_pl_wrap_pipe[pipe];
+
+		while (pl->p_next != NULL) {
+			pl = (struct payload_wrap *)pl->p_next;
+		}
+		pl->p_next = (struct payload_wrap *)wrap;
+	}
+
+	atomic_inc(&tx_pipe_count[pipe]);
+}
+
 static int schedule_tx_transaction(void)
 {
 	if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT)) {
@@ -2588,7 +2870,7 @@ static int schedule_tx_transaction(void)
 	} else {
 		int err;
 
-		update_ts_duration_params_for_tx(tx_fifo.payload[tx_fifo.front]->length);
+		update_ts_duration_params_for_tx(tx_fifo_first()->length);
 
 		ts_next_action = TS_NEXT_ACTION_TX;
 		ts_request_earliest.params.earliest.length_us = ts_duration_params.tx_rx_sequence;
@@ -2636,23 +2918,59 @@ int esb_write_payload(const struct esb_payload *payload)
 		return -EINVAL;
 	}
 
+	if (CONFIG_ESB_TX_PIPE_QUEUE_LIMIT > 0 &&
+	    atomic_get(&tx_pipe_count[payload->pipe]) >= CONFIG_ESB_TX_PIPE_QUEUE_LIMIT) {
+		return -ENOMEM;
+	}
+
 	if (esb_cfg.mode == ESB_MODE_PTX) {
 		if (esb_cfg.protocol == ESB_PROTOCOL_ESB &&
 		    esb_cfg.payload_length != payload->length) {
 			return -EINVAL;
 		}
 
+#if defined(CONFIG_ESB_TX_PIPE_QUEUES)
+		struct payload_wrap *new_payload = find_free_payload_cont();
+
+		new_payload->in_use = true;
+		new_payload->p_next = NULL;
+		memcpy(new_payload->p_payload, payload, sizeof(struct esb_payload));
+
+		pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
+		new_payload->p_payload->pid = pids[payload->pipe];
+		pipe_stats_queued(new_payload->p_payload);
+
+		/* see note about irq_disable below */
+		if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT) ||
+		    (esb_state != ESB_STATE_IDLE && esb_state != ESB_STATE_WAIT_MPSL)) {
+			irq_disable(ESB_RADIO_IRQ_NUMBER);
+		}
+
+		if (atomic_get(&tx_fifo.count) == 0) {
+			tx_pipe = payload->pipe;
+		}
+
+		pipe_queue_append(new_payload, payload->pipe);
+		atomic_inc(&tx_fifo.count);
+
+		if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT) ||
+		    (esb_state != ESB_STATE_IDLE && esb_state != ESB_STATE_WAIT_MPSL)) {
+			irq_enable(ESB_RADIO_IRQ_NUMBER);
+		}
+#else
 		memcpy(tx_fifo.payload[tx_fifo.back], payload, sizeof(struct esb_payload));
 
 		pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
 		tx_fifo.payload[tx_fifo.back]->pid = pids[payload->pipe];
+		pipe_stats_queued(tx_fifo.payload[tx_fifo.back]);
 
 		if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
 			tx_fifo.back = 0;
 		}
 
-
+		atomic_inc(&tx_pipe_count[payload->pipe]);
 		atomic_inc(&tx_fifo.count);
+#endif
 	} else {
 		if (esb_cfg.protocol == ESB_PROTOCOL_ESB) {
 			return -EPERM;
@@ -2664,6 +2982,7 @@ int esb_write_payload(const struct esb_payload *payload)
 			new_ack_payload->in_use = true;
 			new_ack_payload->p_next = NULL;
 			memcpy(new_ack_payload->p_payload, payload, sizeof(struct esb_payload));
+			pipe_stats_queued(new_ack_payload->p_payload);
 
 			/* If system usage is high, other interrupts can postpone re-enabling of
 			 * RADIO IRQ, and therefore handling of the interrupt. This can result in
@@ -2676,17 +2995,7 @@ int esb_write_payload(const struct esb_payload *payload)
 				irq_disable(ESB_RADIO_IRQ_NUMBER);
 			}
 
-			if (ack_pl_wrap_pipe[payload->pipe] == NULL) {
-				ack_pl_wrap_pipe[payload->pipe] = new_ack_payload;
-			} else {
-				struct payload_wrap *pl = ack_pl_wrap_pipe[payload->pipe];
-
-				while (pl->p_next != NULL) {
-					pl = (struct payload_wrap *)pl->p_next;
-				}
-				pl->p_next = (struct payload_wrap *)new_ack_payload;
-			}
-
+			pipe_queue_append(new_ack_payload, payload->pipe);
 			atomic_inc(&tx_fifo.count);
 
 			if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT) ||
@@ -2758,6 +3067,10 @@ int esb_start_rx(void)
 		return -EPERM;
 	}
 
+#if defined(CONFIG_ESB_CHANNEL_HOPPING)
+	hop.last_rx = k_uptime_get_32();
+#endif
+
 	if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT)) {
 		start_rx_listening();
 	} else {
@@ -2813,8 +3126,13 @@ int esb_flush_tx(void)
 
 	for (size_t i = 0; i < CONFIG_ESB_PIPE_COUNT; i++) {
 		ack_pl_wrap_pipe[i] = NULL;
+		atomic_clear(&tx_pipe_count[i]);
 	}
 
+#if defined(CONFIG_ESB_TX_PIPE_QUEUES)
+	tx_pipe = 0;
+#endif
+
 	return 0;
 }
 
@@ -3011,6 +3329,54 @@ int esb_get_rf_channel(uint32_t *channel)
 	return 0;
 }
 
+#if defined(CONFIG_ESB_CHANNEL_HOPPING)
+int esb_set_hop_channels(const uint8_t *channels, uint8_t count)
+{
+	if (esb_state != ESB_STATE_IDLE) {
+		return -EBUSY;
+	}
+	if (count > CONFIG_ESB_HOP_CHANNELS_MAX || (count > 0 && channels == NULL)) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (channels[i] > 100) {
+			return -EINVAL;
+		}
+	}
+
+	memset(&hop, 0, sizeof(hop));
+
+	for (size_t i = 0; i < count; i++) {
+		hop.channels[i].channel = channels[i];
+	}
+
+	hop.count = count;
+
+	if (count > 0) {
+		esb_addr.rf_channel = channels[0];
+	}
+
+	return 0;
+}
+
+uint32_t esb_hop_channel_map_get(void)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t map = 0;
+
+	for (size_t i = 0; i < hop.count; i++) {
+		const struct hop_channel *ch = &hop.channels[i];
+
+		if (!ch->blocked || (int32_t)(now - ch->blocked_until) >= 0) {
+			map |= BIT(i);
+		}
+	}
+
+	return map;
+}
+#endif /* defined(CONFIG_ESB_CHANNEL_HOPPING) */
+
 int esb_set_tx_power(int8_t tx_output_power)
 {
 	if (esb_state != ESB_STATE_IDLE) {
@@ -3078,6 +3444,39 @@ int esb_reuse_pid(uint8_t pipe)
 	return 0;
 }
 
+#if defined(CONFIG_ESB_PIPE_STATS)
+int esb_pipe_stats_get(uint8_t pipe, struct esb_pipe_stats *stats)
+{
+	struct pipe_stats snapshot;
+	unsigned int key;
+
+	if (pipe >= CONFIG_ESB_PIPE_COUNT || stats == NULL) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	snapshot = pipe_stats[pipe];
+	irq_unlock(key);
+
+	stats->tx_success = snapshot.tx_success;
+	stats->tx_failed = snapshot.tx_failed;
+	stats->retransmits = snapshot.retransmits;
+	stats->latency_max_us = snapshot.latency_max_us;
+	stats->latency_avg_us =
+		snapshot.tx_success ? (uint32_t)(snapshot.latency_sum_us / snapshot.tx_success) : 0;
+
+	return 0;
+}
+
+void esb_pipe_stats_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	memset(pipe_stats, 0, sizeof(pipe_stats));
+	irq_unlock(key);
+}
+#endif /* defined(CONFIG_ESB_PIPE_STATS) */
+
 static mpsl_timeslot_signal_return_param_t *ts_start_action(void)
 {
 	nrf_radio_mode_set(NRF_RADIO, (nrf_radio_mode_t)esb_cfg.bitrate);
@@ -3227,7 +3626,7 @@ static mpsl_timeslot_signal_return_param_t *ts_extend_succeeded_action(void)
 		const uint16_t max_extends = 2000;
 
 		ts_duration_params.extend_count++;
-		if (ts_duration_params.extend_count >= max_extends) {
+		if (ts_duration_params.extend_count >= max_extends || hop_prx_due()) {
 			ts_next_action = TS_NEXT_ACTION_RX_NO_EXTEND;
 		}
 		break;
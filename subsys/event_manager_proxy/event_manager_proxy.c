@@ -16,6 +16,14 @@ LOG_MODULE_REGISTER(event_manager_proxy, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 #define EMP_BIND_TIMEOUT K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BIND_TIMEOUT_MS)
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+#define EMP_BATCH_FLUSH_TIMEOUT K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BATCH_FLUSH_TIMEOUT_MS)
+#define EMP_BATCH_BUF_SIZE ROUND_UP(CONFIG_EVENT_MANAGER_PROXY_BATCH_BUF_SIZE, sizeof(uint32_t))
+#endif
+
+/** @brief Flag set in the start command if the core can receive batched events. */
+#define EMP_START_FLAG_BATCHING BIT(0)
+
 /* Helpers - allow linker to get information about these structure sizes. */
 static struct event_type _emp_event_type_size_check
 	__used __attribute__((__section__("event_manager_proxy_event_type_size")));
@@ -42,6 +50,27 @@ struct emp_cmd {
 	enum emp_cmd_code code;
 };
 
+/**
+ * @brief The command structure used to start the event transmission.
+ *
+ * The flags field is not sent by older versions of the proxy.
+ */
+struct emp_cmd_start {
+	enum emp_cmd_code code;
+	uint32_t flags;
+};
+
+/**
+ * @brief The header of an event packed in a batch.
+ *
+ * The event data is padded to a multiple of four bytes, so that every record is aligned.
+ */
+struct emp_batch_record {
+	uint16_t len;
+	uint16_t reserved;
+	uint32_t data[];
+};
+
 /**
  * @brief The command structure used to subscribe.
  */
@@ -59,6 +88,13 @@ struct emp_ipc_data {
 	bool started;
 	struct k_event bound;
 	const struct event_type **event_type_map;
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+	bool batching;
+	struct k_mutex batch_lock;
+	struct k_work_delayable batch_flush;
+	size_t batch_len;
+	uint32_t batch_buf[EMP_BATCH_BUF_SIZE / sizeof(uint32_t)];
+#endif
 };
 
 
@@ -159,6 +195,28 @@ static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size
 	_event_submit(event);
 }
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+static void handle_remote_batch(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	const uint8_t *pos = data;
+	const uint8_t *end = pos + len;
+
+	while (pos < end) {
+		const struct emp_batch_record *record = (const struct emp_batch_record *)pos;
+		size_t left = end - pos;
+
+		if ((left < sizeof(*record)) || (left - sizeof(*record) < record->len)) {
+			LOG_ERR("Malformed event batch");
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+
+		handle_remote_event(ipc, record->data, record->len);
+		pos += sizeof(*record) + ROUND_UP(record->len, sizeof(uint32_t));
+	}
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCHING */
+
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
 	if (ipc->started) {
@@ -197,8 +255,17 @@ static void handle_remote_command_start(struct emp_ipc_data *ipc, const void *da
 		return;
 	}
 
+	const struct emp_cmd_start *cmd = data;
+
 	ipc->started = true;
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+	ipc->batching = (len >= sizeof(*cmd)) && (cmd->flags & EMP_START_FLAG_BATCHING);
+	LOG_DBG("Batching on ipc %zu %s", ipc2idx(ipc), ipc->batching ? "enabled" : "disabled");
+#else
+	ARG_UNUSED(cmd);
+#endif
+
 	LOG_DBG("Event transmission on ipc %d started", ipc2idx(ipc));
 
 	/* Check if all remote cores started. */
@@ -256,6 +323,12 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+		if (ipc->batching) {
+			handle_remote_batch(ipc, data, len);
+			return;
+		}
+#endif
 		handle_remote_event(ipc, data, len);
 	} else {
 		handle_remote_command(ipc, data, len);
@@ -274,24 +347,12 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
-static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+static int send_data_to_remote(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
 	int ret;
 
-	if (remote_ev == NULL) {
-		return 0;
-	}
-
-	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
-
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
-
 	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
+		ret = ipc_service_send(&ipc->ept, data, len);
 		if (ret >= 0) {
 			break;
 		}
@@ -306,6 +367,113 @@ static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event
 	return ret;
 }
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+/**
+ * @brief Send the pending batch of events.
+ *
+ * The batch lock must be taken by the caller.
+ *
+ * @param ipc Element of the @ref emp_ipc_data array.
+ *
+ * @return See @ref send_data_to_remote.
+ */
+static int batch_flush(struct emp_ipc_data *ipc)
+{
+	int ret = 0;
+
+	if (ipc->batch_len > 0) {
+		ret = send_data_to_remote(ipc, ipc->batch_buf, ipc->batch_len);
+		ipc->batch_len = 0;
+	}
+
+	return ret;
+}
+
+static void batch_flush_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct emp_ipc_data *ipc = CONTAINER_OF(dwork, struct emp_ipc_data, batch_flush);
+
+	k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+	(void)batch_flush(ipc);
+	k_mutex_unlock(&ipc->batch_lock);
+}
+
+static void batch_record_put(void *dst, const struct app_event_header *eh, size_t size,
+			     const struct event_type *remote_ev)
+{
+	struct emp_batch_record *record = dst;
+	struct app_event_header *remote_eh = (struct app_event_header *)record->data;
+
+	__ASSERT_NO_MSG(size <= UINT16_MAX);
+
+	record->len = size;
+	record->reserved = 0;
+	memcpy(remote_eh, eh, size);
+	remote_eh->type_id = remote_ev;
+}
+
+static int batch_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+				 const struct event_type *remote_ev)
+{
+	size_t size = app_event_manager_event_size(eh);
+	size_t record_size = sizeof(struct emp_batch_record) + ROUND_UP(size, sizeof(uint32_t));
+	int ret = 0;
+
+	__ASSERT_NO_MSG(!k_is_in_isr());
+
+	k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+
+	if (ipc->batch_len + record_size > sizeof(ipc->batch_buf)) {
+		ret = batch_flush(ipc);
+	}
+
+	if (ret < 0) {
+		/* Error already reported. */
+	} else if (record_size > sizeof(ipc->batch_buf)) {
+		/* The event does not fit in the batch buffer, send it in a batch of its own. */
+		uint32_t buffer[record_size / sizeof(uint32_t)];
+
+		batch_record_put(buffer, eh, size, remote_ev);
+		ret = send_data_to_remote(ipc, buffer, sizeof(buffer));
+	} else {
+		batch_record_put((uint8_t *)ipc->batch_buf + ipc->batch_len, eh, size, remote_ev);
+		ipc->batch_len += record_size;
+
+		/* No effect if already scheduled, the timeout is counted from the first event. */
+		(void)k_work_schedule(&ipc->batch_flush, EMP_BATCH_FLUSH_TIMEOUT);
+	}
+
+	k_mutex_unlock(&ipc->batch_lock);
+
+	return ret;
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCHING */
+
+static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+
+	if (remote_ev == NULL) {
+		return 0;
+	}
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+	if (ipc->batching) {
+		return batch_event_to_remote(ipc, eh, remote_ev);
+	}
+#endif
+
+	size_t size = app_event_manager_event_size(eh);
+	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
+	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+
+	memcpy(buffer, eh, sizeof(buffer));
+	remote_eh->type_id = remote_ev;
+
+	return send_data_to_remote(ipc, buffer, sizeof(buffer));
+}
+
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
 {
 	int ret = 0;
@@ -356,6 +524,13 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 
 	k_event_init(&ipc->bound);
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+	ipc->batching = false;
+	ipc->batch_len = 0;
+	k_mutex_init(&ipc->batch_lock);
+	k_work_init_delayable(&ipc->batch_flush, batch_flush_fn);
+#endif
+
 	ret = ipc_service_register_endpoint(instance, &ipc->ept, &ipc->ept_cfg);
 	if (ret) {
 		LOG_ERR("Error registering endpoint in ipc service (%d)", ret);
@@ -428,7 +603,11 @@ int event_manager_proxy_subscribe(const struct device *instance,
 
 static int send_start_command_to_remote(struct emp_ipc_data *ipc)
 {
-	const struct emp_cmd cmd = {.code = EMP_CMD_START};
+	const struct emp_cmd_start cmd = {
+		.code = EMP_CMD_START,
+		.flags = IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING) ?
+			 EMP_START_FLAG_BATCHING : 0,
+	};
 
 	__ASSERT_NO_MSG(ipc);
 
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include <nrf_gzll.h>
+#include <gzll_host_sched.h>
+
+struct pipe_state {
+	struct gzll_host_sched_stats stats;
+	int64_t rssi_sum;
+	/* Uptime of the last received packet, in milliseconds. */
+	uint32_t last_rx;
+	/* Packets and CRC failures of the current error rate measurement. */
+	uint16_t win_packets;
+	uint16_t win_failures;
+	uint8_t prio;
+};
+
+static struct pipe_state pipes[NRF_GZLL_CONST_PIPE_COUNT];
+static uint8_t last_serviced;
+
+static void per_window_update(struct pipe_state *ps)
+{
+	uint32_t total = ps->win_packets + ps->win_failures;
+	uint32_t bucket;
+
+	if (total < CONFIG_GAZELL_HOST_SCHED_PER_WINDOW) {
+		return;
+	}
+
+	bucket = MIN(ps->win_failures * GZLL_HOST_SCHED_PER_BUCKETS / total,
+		     GZLL_HOST_SCHED_PER_BUCKETS - 1);
+	ps->stats.per_hist[bucket]++;
+
+	ps->win_packets = 0;
+	ps->win_failures = 0;
+}
+
+static void interval_add(struct pipe_state *ps, uint32_t interval_ms)
+{
+	size_t bucket;
+
+	for (bucket = 0; bucket < CONFIG_GAZELL_HOST_SCHED_INTERVAL_BUCKETS - 1; bucket++) {
+		if (interval_ms < BIT(bucket)) {
+			break;
+		}
+	}
+
+	ps->stats.interval_hist[bucket]++;
+	ps->stats.interval_max_ms = MAX(ps->stats.interval_max_ms, interval_ms);
+}
+
+static void crc_failure(uint32_t pipe, uint8_t rf_channel)
+{
+	ARG_UNUSED(rf_channel);
+
+	if (pipe >= NRF_GZLL_CONST_PIPE_COUNT) {
+		return;
+	}
+
+	pipes[pipe].stats.crc_failures++;
+	pipes[pipe].win_failures++;
+	per_window_update(&pipes[pipe]);
+}
+
+bool gzll_host_sched_init(void)
+{
+	gzll_host_sched_stats_reset();
+
+	return nrf_gzll_crc_failure_callback_register(crc_failure);
+}
+
+int gzll_host_sched_prio_set(uint8_t pipe, uint8_t prio)
+{
+	if (pipe >= NRF_GZLL_CONST_PIPE_COUNT) {
+		return -EINVAL;
+	}
+
+	pipes[pipe].prio = prio;
+
+	return 0;
+}
+
+void gzll_host_sched_rx(uint32_t pipe, nrf_gzll_host_rx_info_t rx_info)
+{
+	struct pipe_state *ps;
+	uint32_t now = k_uptime_get_32();
+
+	if (pipe >= NRF_GZLL_CONST_PIPE_COUNT) {
+		return;
+	}
+
+	ps = &pipes[pipe];
+
+	if (ps->stats.packets > 0) {
+		interval_add(ps, now - ps->last_rx);
+	}
+
+	ps->last_rx = now;
+	ps->stats.packets++;
+	ps->rssi_sum += rx_info.rssi;
+	ps->stats.rssi_avg = ps->rssi_sum / (int64_t)ps->stats.packets;
+
+	ps->win_packets++;
+	per_window_update(ps);
+}
+
+int gzll_host_sched_next(void)
+{
+	int next = -ENODATA;
+
+	/* Start after the last serviced pipe, so that pipes of equal priority
+	 * are serviced in turn.
+	 */
+	for (size_t i = 1; i <= NRF_GZLL_CONST_PIPE_COUNT; i++) {
+		uint8_t pipe = (last_serviced + i) % NRF_GZLL_CONST_PIPE_COUNT;
+
+		if (nrf_gzll_get_rx_fifo_packet_count(pipe) == 0) {
+			continue;
+		}
+
+		if (next < 0 || pipes[pipe].prio < pipes[next].prio) {
+			next = pipe;
+		}
+	}
+
+	if (next >= 0) {
+		last_serviced = next;
+	}
+
+	return next;
+}
+
+int gzll_host_sched_stats_get(uint8_t pipe, struct gzll_host_sched_stats *stats)
+{
+	unsigned int key;
+
+	if (pipe >= NRF_GZLL_CONST_PIPE_COUNT || stats == NULL) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	*stats = pipes[pipe].stats;
+	irq_unlock(key);
+
+	return 0;
+}
+
+void gzll_host_sched_stats_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	for (size_t i = 0; i < NRF_GZLL_CONST_PIPE_COUNT; i++) {
+		memset(&pipes[i].stats, 0, sizeof(pipes[i].stats));
+		pipes[i].rssi_sum = 0;
+		pipes[i].win_packets = 0;
+		pipes[i].win_failures = 0;
+	}
+
+	irq_unlock(key);
+}
+
+#if defined(CONFIG_GAZELL_HOST_SCHED_SHELL)
+static void stats_print(const struct shell *sh, uint8_t pipe,
+			const struct gzll_host_sched_stats *stats)
+{
+	uint32_t total = stats->packets + stats->crc_failures;
+
+	shell_print(sh, "Pipe %u: prio %u, %u packets, %u CRC failures (%u%%)", pipe,
+		    pipes[pipe].prio, stats->packets, stats->crc_failures,
+		    total ? stats->crc_failures * 100 / total : 0);
+	shell_print(sh, "  RSSI avg %d dBm, interval max %u ms", stats->rssi_avg,
+		    stats->interval_max_ms);
+
+	shell_fprintf(sh, SHELL_NORMAL, "  Interval:");
+	for (size_t i = 0; i < CONFIG_GAZELL_HOST_SCHED_INTERVAL_BUCKETS; i++) {
+		if (i < CONFIG_GAZELL_HOST_SCHED_INTERVAL_BUCKETS - 1) {
+			shell_fprintf(sh, SHELL_NORMAL, " <%lums:%u", BIT(i),
+				      stats->interval_hist[i]);
+		} else {
+			shell_fprintf(sh, SHELL_NORMAL, " more:%u", stats->interval_hist[i]);
+		}
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "\n  PER:");
+	for (size_t i = 0; i < GZLL_HOST_SCHED_PER_BUCKETS; i++) {
+		shell_fprintf(sh, SHELL_NORMAL, " %zu%%:%u", i * 100 / GZLL_HOST_SCHED_PER_BUCKETS,
+			      stats->per_hist[i]);
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+}
+
+static int cmd_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct gzll_host_sched_stats stats;
+
+	for (uint8_t pipe = 0; pipe < NRF_GZLL_CONST_PIPE_COUNT; pipe++) {
+		(void)gzll_host_sched_stats_get(pipe, &stats);
+
+		if (stats.packets == 0 && stats.crc_failures == 0) {
+			continue;
+		}
+
+		stats_print(sh, pipe, &stats);
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char *argv[])
+{
+	gzll_host_sched_stats_reset();
+
+	return 0;
+}
+
+static int cmd_prio(const struct shell *sh, size_t argc, char *argv[])
+{
+	unsigned long pipe = strtoul(argv[1], NULL, 0);
+	unsigned long prio = strtoul(argv[2], NULL, 0);
+
+	if (prio > UINT8_MAX || gzll_host_sched_prio_set(MIN(pipe, UINT8_MAX), prio)) {
+		shell_error(sh, "Invalid pipe or priority");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(gzll_host_cmds,
+	SHELL_CMD_ARG(stats, NULL, "Print the statistics of the pipes", cmd_stats, 1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset the statistics of the pipes", cmd_reset, 1, 0),
+	SHELL_CMD_ARG(prio, NULL, "Set the priority of a pipe <pipe> <prio>", cmd_prio, 3, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(gzll_host, &gzll_host_cmds, "Gazell Host scheduler commands", NULL);
+#endif /* defined(CONFIG_GAZELL_HOST_SCHED_SHELL) */
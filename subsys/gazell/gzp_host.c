@@ -11,6 +11,9 @@
 #include <zephyr/settings/settings.h>
 #include <nrf_gzll.h>
 #include <gzp.h>
+#if defined(CONFIG_GAZELL_HOST_SCHED)
+#include <gzll_host_sched.h>
+#endif
 #include "gzp_internal.h"
 
 #include <zephyr/logging/log.h>
@@ -862,4 +865,8 @@ void nrf_gzll_host_rx_data_ready(uint32_t pipe, nrf_gzll_host_rx_info_t rx_info)
 	if (pipe == GZP_PAIRING_PIPE) {
 		prev_gzp_rx_info = rx_info;
 	}
+
+#if defined(CONFIG_GAZELL_HOST_SCHED)
+	gzll_host_sched_rx(pipe, rx_info);
+#endif
 }
@@ -106,6 +106,26 @@ static uint32_t log_format = LOG_OUTPUT_TEXT;
 static enum log_rpc_level stream_level = LOG_RPC_LEVEL_NONE;
 static log_timestamp_t log_timestamp_delta;
 
+#if CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0
+static uint8_t stream_batch_buf[CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE];
+/* Encoder state, one backup for the byte string, and the constant state. */
+static zcbor_state_t stream_batch_zs[3];
+#endif
+
+#ifdef CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT
+/* One streamed log message costs MSEC_PER_SEC tokens. */
+#define STREAM_TOKENS_PER_MSG MSEC_PER_SEC
+#define STREAM_TOKENS_MAX (CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT_BURST * STREAM_TOKENS_PER_MSG)
+
+struct stream_rate_limit {
+	uint32_t tokens;
+	uint32_t last_update_ms;
+	uint32_t dropped;
+};
+
+static struct stream_rate_limit stream_rate_limits[CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT_SOURCES];
+#endif
+
 #ifdef CONFIG_LOG_BACKEND_RPC_HISTORY
 static enum log_rpc_level history_level = LOG_RPC_LEVEL_NONE;
 static uint8_t history_threshold;
@@ -481,7 +501,35 @@ static size_t format_message_to_buf(struct log_msg *msg, uint32_t flags, uint8_t
 	return output_ctx.total_len;
 }
 
-static void stream_message(struct log_msg *msg)
+#if CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0 || defined(CONFIG_LOG_BACKEND_RPC_HISTORY)
+/*
+ * Encodes the log level and the formatted log message into the remaining space of the encoder
+ * buffer. Formats the message only once, and rolls the encoder state back if it does not fit.
+ */
+static bool encode_message(zcbor_state_t *zs, struct log_msg *msg, uint32_t flags)
+{
+	zcbor_state_t start_state = zs[0];
+	size_t length;
+	size_t max_length;
+	bool fits = false;
+
+	if (zcbor_uint32_put(zs, log_msg_get_level(msg)) && zcbor_bstr_start_encode(zs)) {
+		max_length = zs[0].payload_end - zs[0].payload_mut;
+		length = format_message_to_buf(msg, flags, zs[0].payload_mut, max_length);
+		zs[0].payload_mut += MIN(length, max_length);
+		fits = zcbor_bstr_end_encode(zs, NULL) && (length <= max_length);
+	}
+
+	if (!fits) {
+		zs[0] = start_state;
+		(void)zcbor_pop_error(zs);
+	}
+
+	return fits;
+}
+#endif
+
+static void stream_message_send(struct log_msg *msg)
 {
 	const uint32_t flags = common_output_flags | LOG_OUTPUT_FLAG_CRLF_NONE;
 
@@ -506,23 +554,175 @@ static void stream_message(struct log_msg *msg)
 	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG, &ctx);
 }
 
-static const char *log_msg_source_name_get(struct log_msg *msg)
+#if CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0
+
+static void stream_batch_reset(void)
+{
+	zcbor_new_encode_state(stream_batch_zs, ARRAY_SIZE(stream_batch_zs), stream_batch_buf,
+			       sizeof(stream_batch_buf), 0);
+}
+
+static void stream_batch_flush(void)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t length = stream_batch_zs[0].payload_mut - stream_batch_buf;
+
+	if (length == 0) {
+		return;
+	}
+
+	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, length);
+	memcpy(ctx.zs[0].payload_mut, stream_batch_buf, length);
+	ctx.zs[0].payload_mut += length;
+	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG, &ctx);
+
+	stream_batch_reset();
+}
+
+#endif /* CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0 */
+
+static int log_msg_local_source_id_get(struct log_msg *msg)
 {
 	void *source;
-	uint32_t source_id;
 
 	if (log_msg_get_domain(msg) != Z_LOG_LOCAL_DOMAIN_ID) {
-		return NULL;
+		return -ENOENT;
 	}
 
 	source = (void *)log_msg_get_source(msg);
 
 	if (source == NULL) {
-		return NULL;
+		return -ENOENT;
+	}
+
+	return IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? log_dynamic_source_id(source)
+							: log_const_source_id(source);
+}
+
+#ifdef CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT
+
+static void stream_text(enum log_rpc_level level, const char *text, size_t length)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+#if CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0
+	zcbor_state_t *zs = stream_batch_zs;
+
+	if (zs[0].payload_end - zs[0].payload_mut < 6 + length) {
+		stream_batch_flush();
 	}
 
-	source_id = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? log_dynamic_source_id(source)
-							     : log_const_source_id(source);
+	if (zs[0].payload_end - zs[0].payload_mut >= 6 + length) {
+		zcbor_uint32_put(zs, level);
+		zcbor_bstr_encode_ptr(zs, text, length);
+		return;
+	}
+#endif
+
+	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, 6 + length);
+	nrf_rpc_encode_uint(&ctx, level);
+	nrf_rpc_encode_buffer(&ctx, text, length);
+	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG, &ctx);
+}
+
+static void stream_rate_limit_init(void)
+{
+	uint32_t now = k_uptime_get_32();
+
+	for (size_t i = 0; i < ARRAY_SIZE(stream_rate_limits); i++) {
+		stream_rate_limits[i].tokens = STREAM_TOKENS_MAX;
+		stream_rate_limits[i].last_update_ms = now;
+		stream_rate_limits[i].dropped = 0;
+	}
+}
+
+/*
+ * Takes a token from the bucket of the message source. Sources are assigned to the buckets
+ * by their source ID, so sources that share a bucket also share its rate and dropped counter.
+ */
+static bool stream_rate_limit_take(struct log_msg *msg)
+{
+	int source_id = log_msg_local_source_id_get(msg);
+	struct stream_rate_limit *limit;
+	uint32_t now = k_uptime_get_32();
+	uint64_t tokens;
+	char notice[40];
+	int length;
+
+	limit = &stream_rate_limits[MAX(source_id, 0) % ARRAY_SIZE(stream_rate_limits)];
+
+	tokens = limit->tokens + (uint64_t)(now - limit->last_update_ms) *
+				 CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT_RATE;
+	limit->tokens = MIN(tokens, STREAM_TOKENS_MAX);
+	limit->last_update_ms = now;
+
+	if (limit->tokens < STREAM_TOKENS_PER_MSG) {
+		limit->dropped++;
+		return false;
+	}
+
+	limit->tokens -= STREAM_TOKENS_PER_MSG;
+
+	if (limit->dropped > 0) {
+		/* Report the dropped messages right before the next message of the source. */
+		length = snprintk(notice, sizeof(notice), "--- %u messages dropped ---",
+				  limit->dropped);
+		stream_text(LOG_RPC_LEVEL_WRN, notice, MIN((size_t)length, sizeof(notice) - 1));
+		limit->dropped = 0;
+	}
+
+	return true;
+}
+
+#endif /* CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT */
+
+static void stream_message(struct log_msg *msg)
+{
+	enum log_rpc_level level = (enum log_rpc_level)log_msg_get_level(msg);
+
+	/* Error messages are never rate limited nor delayed by batching. */
+	if (level == LOG_RPC_LEVEL_ERR) {
+#if CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0
+		stream_batch_flush();
+#endif
+		stream_message_send(msg);
+		return;
+	}
+
+#ifdef CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT
+	if (!stream_rate_limit_take(msg)) {
+		return;
+	}
+#endif
+
+#if CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0
+	const uint32_t flags = common_output_flags | LOG_OUTPUT_FLAG_CRLF_NONE;
+
+	if (!encode_message(stream_batch_zs, msg, flags)) {
+		stream_batch_flush();
+
+		if (!encode_message(stream_batch_zs, msg, flags)) {
+			/* The message is larger than the batch buffer. */
+			stream_message_send(msg);
+		}
+	}
+
+	/* Send the batch when the logging subsystem has no more messages to process. */
+	if (!log_data_pending()) {
+		stream_batch_flush();
+	}
+#else
+	stream_message_send(msg);
+#endif
+}
+
+static const char *log_msg_source_name_get(struct log_msg *msg)
+{
+	int source_id = log_msg_local_source_id_get(msg);
+
+	if (source_id < 0) {
+		return NULL;
+	}
 
 	return TYPE_SECTION_START(log_const)[source_id].name;
 }
@@ -614,6 +814,12 @@ static void init(struct log_backend const *const backend)
 {
 	ARG_UNUSED(backend);
 
+#if CONFIG_LOG_BACKEND_RPC_STREAM_BATCH_SIZE > 0
+	stream_batch_reset();
+#endif
+#ifdef CONFIG_LOG_BACKEND_RPC_STREAM_RATE_LIMIT
+	stream_rate_limit_init();
+#endif
 #ifdef CONFIG_LOG_BACKEND_RPC_HISTORY
 	log_rpc_history_init();
 	k_work_queue_init(&history_transfer_workq);
@@ -707,9 +913,6 @@ static void history_transfer_task(struct k_work *work)
 
 	struct nrf_rpc_cbor_ctx ctx;
 	bool any_msg_consumed = false;
-	struct log_msg *msg;
-	size_t length;
-	size_t max_length;
 
 	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, CONFIG_LOG_BACKEND_RPC_HISTORY_UPLOAD_CHUNK_SIZE);
 
@@ -732,25 +935,11 @@ static void history_transfer_task(struct k_work *work)
 			break;
 		}
 
-		msg = &history_cur_msg->log;
-		length = 6 + format_message_to_buf(msg, flags, NULL, 0);
-		max_length = ctx.zs[0].payload_end - ctx.zs[0].payload_mut;
-
 		/* Check if there is enough buffer space to fit in the current message. */
-		if (length > max_length) {
+		if (!encode_message(ctx.zs, &history_cur_msg->log, flags)) {
 			break;
 		}
 
-		nrf_rpc_encode_uint(&ctx, log_msg_get_level(msg));
-
-		if (zcbor_bstr_start_encode(ctx.zs)) {
-			max_length = ctx.zs[0].payload_end - ctx.zs[0].payload_mut;
-			length = format_message_to_buf(msg, flags, ctx.zs[0].payload_mut,
-						       max_length);
-			ctx.zs[0].payload_mut += MIN(length, max_length);
-			zcbor_bstr_end_encode(ctx.zs, NULL);
-		}
-
 		log_rpc_history_free(history_cur_msg);
 		history_cur_msg = NULL;
 		any_msg_consumed = true;
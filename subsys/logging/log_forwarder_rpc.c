@@ -35,10 +35,15 @@ static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rp
 	const char *message;
 	size_t message_size;
 
-	level = nrf_rpc_decode_uint(ctx);
-	message = nrf_rpc_decode_buffer_ptr_and_size(ctx, &message_size);
+	/* The event may contain a batch of log messages. */
+	do {
+		level = nrf_rpc_decode_uint(ctx);
+		message = nrf_rpc_decode_buffer_ptr_and_size(ctx, &message_size);
+
+		if (!message) {
+			break;
+		}
 
-	if (message) {
 		switch (level) {
 		case LOG_RPC_LEVEL_ERR:
 			LOG_ERR("%.*s", message_size, message);
@@ -55,7 +60,7 @@ static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rp
 		default:
 			break;
 		}
-	}
+	} while (nrf_rpc_decode_valid(ctx) && ctx->zs[0].payload < ctx->zs[0].payload_end);
 
 	if (!nrf_rpc_decoding_done_and_check(&log_rpc_group, ctx)) {
 		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &log_rpc_group, LOG_RPC_EVT_MSG,
@@ -168,6 +168,11 @@ LOG_MODULE_REGISTER(mcumgr_img_grp, CONFIG_MCUMGR_GRP_IMG_LOG_LEVEL);
 
 struct img_mgmt_state g_img_mgmt_state;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_UPLOAD_RATE
+/* Uptime of the first chunk of the current upload, in milliseconds. */
+static int64_t upload_start_ms;
+#endif
+
 #ifdef CONFIG_MCUMGR_GRP_IMG_MUTEX
 static K_MUTEX_DEFINE(img_mgmt_mutex);
 #endif
@@ -871,6 +876,16 @@ img_mgmt_upload_good_rsp(struct smp_streamer *ctxt)
 	ok = ok && zcbor_tstr_put_lit(zse, "off")		&&
 		   zcbor_size_put(zse, g_img_mgmt_state.off);
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_UPLOAD_RATE
+	int64_t elapsed_ms = k_uptime_get() - upload_start_ms;
+
+	if (ok && g_img_mgmt_state.off > 0 && elapsed_ms > 0) {
+		ok = zcbor_tstr_put_lit(zse, "rate")		&&
+		     zcbor_uint32_put(zse, (uint64_t)g_img_mgmt_state.off * MSEC_PER_SEC /
+					   elapsed_ms);
+	}
+#endif
+
 	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
 }
 
@@ -1035,6 +1050,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 		g_img_mgmt_state.off = 0;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_UPLOAD_RATE
+		upload_start_ms = k_uptime_get();
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
 					   &err_group);
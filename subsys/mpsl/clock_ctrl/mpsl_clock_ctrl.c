@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/clock_control.h>
 #include <zephyr/drivers/clock_control/nrf_clock_control.h>
@@ -14,6 +15,7 @@
 #endif /* CONFIG_CLOCK_CONTROL_NRF */
 
 #include <mpsl_clock.h>
+#include <mpsl/mpsl_clock_ctrl_stats.h>
 #include "mpsl_clock_ctrl.h"
 #include "nrf_errno.h"
 
@@ -179,23 +181,87 @@ static int32_t m_lfclk_wait(void)
 	return err;
 }
 
-#if defined(CONFIG_CLOCK_CONTROL_NRF)
+static void m_hfclk_driver_request(void);
+static void m_hfclk_driver_release(void);
+
+/* Set if HFCLK is requested from the clock driver. The HFCLK may stay requested after the last
+ * release during the keep-alive window.
+ */
+static bool m_hfclk_on;
+
+#if defined(CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS)
+static struct mpsl_clock_ctrl_hfclk_stats m_hfclk_stats;
+static int64_t m_hfclk_on_ticks;
+static int64_t m_hfclk_on_time_ticks;
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS */
+
+static void m_hfclk_on_set(bool on)
+{
+#if defined(CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS)
+	if (on) {
+		m_hfclk_stats.ramps++;
+		m_hfclk_on_ticks = k_uptime_ticks();
+	} else {
+		m_hfclk_on_time_ticks += k_uptime_ticks() - m_hfclk_on_ticks;
+	}
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS */
+
+	if (on) {
+		m_hfclk_driver_request();
+	} else {
+		m_hfclk_driver_release();
+	}
+
+	m_hfclk_on = on;
+}
+
+#if CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0
+static void m_hfclk_keep_alive_expired(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	unsigned int key = irq_lock();
+
+	/* HFCLK could be requested again before the keep-alive timer was stopped. */
+	if ((atomic_get(&m_hfclk_refcnt) == (atomic_val_t)0) && m_hfclk_on) {
+		m_hfclk_on_set(false);
+	}
+
+	irq_unlock(key);
+}
+
+static K_TIMER_DEFINE(m_hfclk_keep_alive_timer, m_hfclk_keep_alive_expired, NULL);
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0 */
 
 static void m_hfclk_request(void)
 {
-	/* The z_nrf_clock_bt_ctlr_hf_request doesn't count references to HFCLK,
+	/* The clock driver API used by MPSL doesn't count references to HFCLK,
 	 * it is caller responsibility handle requests and releases counting.
 	 */
 	if (atomic_inc(&m_hfclk_refcnt) > (atomic_val_t)0) {
 		return;
 	}
 
-	z_nrf_clock_bt_ctlr_hf_request();
+	unsigned int key = irq_lock();
+
+#if CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0
+	k_timer_stop(&m_hfclk_keep_alive_timer);
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0 */
+
+#if defined(CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS)
+	m_hfclk_stats.requests++;
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS */
+
+	if (!m_hfclk_on) {
+		m_hfclk_on_set(true);
+	}
+
+	irq_unlock(key);
 }
 
 static void m_hfclk_release(void)
 {
-	/* The z_nrf_clock_bt_ctlr_hf_request doesn't count references to HFCLK,
+	/* The clock driver API used by MPSL doesn't count references to HFCLK,
 	 * it is caller responsibility to not release the clock if there is
 	 * other request pending.
 	 */
@@ -208,6 +274,74 @@ static void m_hfclk_release(void)
 		return;
 	}
 
+#if CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0
+	/* Keep HFCLK running for a while. A radio event that follows shortly does not need
+	 * to wait for the HFXO ramp-up.
+	 */
+	k_timer_start(&m_hfclk_keep_alive_timer,
+		      K_USEC(CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US), K_NO_WAIT);
+#else
+	unsigned int key = irq_lock();
+
+	m_hfclk_on_set(false);
+
+	irq_unlock(key);
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0 */
+}
+
+static void m_hfclk_keep_alive_flush(void)
+{
+#if CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0
+	unsigned int key = irq_lock();
+
+	k_timer_stop(&m_hfclk_keep_alive_timer);
+
+	if ((atomic_get(&m_hfclk_refcnt) == (atomic_val_t)0) && m_hfclk_on) {
+		m_hfclk_on_set(false);
+	}
+
+	irq_unlock(key);
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_KEEP_ALIVE_US > 0 */
+}
+
+#if defined(CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS)
+void mpsl_clock_ctrl_hfclk_stats_get(struct mpsl_clock_ctrl_hfclk_stats *stats)
+{
+	unsigned int key = irq_lock();
+	int64_t on_time_ticks = m_hfclk_on_time_ticks;
+
+	if (m_hfclk_on) {
+		on_time_ticks += k_uptime_ticks() - m_hfclk_on_ticks;
+	}
+
+	*stats = m_hfclk_stats;
+
+	irq_unlock(key);
+
+	stats->on_time_us = k_ticks_to_us_floor64(on_time_ticks);
+}
+
+void mpsl_clock_ctrl_hfclk_stats_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	memset(&m_hfclk_stats, 0, sizeof(m_hfclk_stats));
+	m_hfclk_on_time_ticks = 0;
+	m_hfclk_on_ticks = k_uptime_ticks();
+
+	irq_unlock(key);
+}
+#endif /* CONFIG_MPSL_EXT_CLK_CTRL_HFCLK_STATS */
+
+#if defined(CONFIG_CLOCK_CONTROL_NRF)
+
+static void m_hfclk_driver_request(void)
+{
+	z_nrf_clock_bt_ctlr_hf_request();
+}
+
+static void m_hfclk_driver_release(void)
+{
 	z_nrf_clock_bt_ctlr_hf_release();
 }
 
@@ -407,26 +541,13 @@ static int32_t m_lfclk_release(void)
 	return 0;
 }
 
-static void m_hfclk_request(void)
+static void m_hfclk_driver_request(void)
 {
-	if (atomic_inc(&m_hfclk_refcnt) > (atomic_val_t)0) {
-		return;
-	}
-
 	nrf_clock_control_hfxo_request();
 }
 
-static void m_hfclk_release(void)
+static void m_hfclk_driver_release(void)
 {
-	if (atomic_get(&m_hfclk_refcnt) < (atomic_val_t)1) {
-		LOG_WRN("Mismatch between HFCLK request/release");
-		return;
-	}
-
-	if (atomic_dec(&m_hfclk_refcnt) > (atomic_val_t)1) {
-		return;
-	}
-
 	nrf_clock_control_hfxo_release();
 }
 
@@ -613,6 +734,9 @@ int32_t mpsl_clock_ctrl_uninit(void)
 	}
 #endif /* CONFIG_MPSL_EXT_CLK_CTRL_NVM_CLOCK_REQUEST */
 
+	/* Do not keep HFCLK running after MPSL is uninitialized. */
+	m_hfclk_keep_alive_flush();
+
 #if defined(CONFIG_MPSL_EXT_CLK_CTRL_LFCLK_REQ_TIMEOUT_ALLOW)
 	/* Reset the LFCLK timeout to allow for regular re-initialization of the MPSL.*/
 	atomic_set(&m_lfclk_req_timeout, (atomic_val_t) false);
@@ -14,6 +14,7 @@
 #include <soc_secure.h>
 #else
 #include <mpsl_cx_abstract_interface.h>
+#include "../mpsl_cx_stats_internal.h"
 #endif
 
 #include <stddef.h>
@@ -119,18 +120,24 @@ static void gpiote_irq_handler(const struct device *gpiob, struct gpio_callback
 	if (callback) {
 		mpsl_cx_op_map_t granted_ops = granted_ops_map_get();
 
+		mpsl_cx_stats_granted(granted_ops);
 		callback(granted_ops);
 	}
 }
 
 static int32_t request(const mpsl_cx_request_t *req_params)
 {
-	ARG_UNUSED(req_params);
+	if (IS_ENABLED(CONFIG_MPSL_CX_STATS) && (req_params != NULL)) {
+		mpsl_cx_stats_request(req_params->ops, granted_ops_map_get());
+	}
+
 	return 0;
 }
 
 static int32_t release(void)
 {
+	mpsl_cx_stats_release();
+
 	return 0;
 }
 
@@ -14,6 +14,7 @@
 
 #if !defined(CONFIG_MPSL_CX_PIN_FORWARDER)
 #include <mpsl_cx_abstract_interface.h>
+#include "../mpsl_cx_stats_internal.h"
 #else
 #include <string.h>
 #include <soc_secure.h>
@@ -150,6 +151,8 @@ static void gpiote_irq_handler(const struct device *gpiob, struct gpio_callback
 			granted_ops = granted_ops_map(false);
 		}
 
+		mpsl_cx_stats_granted(granted_ops);
+
 		if (granted_ops != last_notified) {
 			last_notified = granted_ops;
 			callback_copy(granted_ops);
@@ -203,6 +206,15 @@ static int32_t request(const mpsl_cx_request_t *req_params)
 #endif
 #endif
 
+	if (IS_ENABLED(CONFIG_MPSL_CX_STATS)) {
+		mpsl_cx_op_map_t granted_ops;
+
+		if (granted_ops_get(&granted_ops) != 0) {
+			granted_ops = granted_ops_map(false);
+		}
+		mpsl_cx_stats_request(req_params->ops, granted_ops);
+	}
+
 	return 0;
 }
 
@@ -245,6 +257,8 @@ static int32_t release(void)
 #endif
 #endif
 
+	mpsl_cx_stats_release();
+
 	return 0;
 }
 
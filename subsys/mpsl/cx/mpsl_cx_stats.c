@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ *   This file implements the Coexistence interface statistics.
+ *
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include <mpsl/mpsl_cx_stats.h>
+#include "mpsl_cx_stats_internal.h"
+
+struct op_counters {
+	uint32_t requests;
+	uint32_t grants;
+	uint32_t denials;
+	uint32_t latency_max_us;
+	uint64_t latency_sum_us;
+};
+
+static const mpsl_cx_op_map_t op_bits[MPSL_CX_STATS_OP_COUNT] = {
+	[MPSL_CX_STATS_OP_IDLE_LISTEN] = MPSL_CX_OP_IDLE_LISTEN,
+	[MPSL_CX_STATS_OP_RX]          = MPSL_CX_OP_RX,
+	[MPSL_CX_STATS_OP_TX]          = MPSL_CX_OP_TX,
+};
+
+static struct op_counters counters[MPSL_CX_STATS_OP_COUNT];
+/* Requested radio operations that are not granted yet. */
+static mpsl_cx_op_map_t pending_ops;
+static uint32_t request_cycles;
+
+static void ops_requested(mpsl_cx_op_map_t ops)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(op_bits); i++) {
+		if (ops & op_bits[i]) {
+			counters[i].requests++;
+		}
+	}
+}
+
+static void ops_granted(mpsl_cx_op_map_t ops, uint32_t latency_us)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(op_bits); i++) {
+		if (ops & op_bits[i]) {
+			counters[i].grants++;
+			counters[i].latency_sum_us += latency_us;
+			counters[i].latency_max_us = MAX(counters[i].latency_max_us, latency_us);
+		}
+	}
+}
+
+static void ops_denied(mpsl_cx_op_map_t ops)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(op_bits); i++) {
+		if (ops & op_bits[i]) {
+			counters[i].denials++;
+		}
+	}
+}
+
+void mpsl_cx_stats_request(mpsl_cx_op_map_t ops, mpsl_cx_op_map_t granted_ops)
+{
+	/* Pending operations that are no longer requested were never granted. Pending
+	 * operations that are requested again are still waiting for the grant.
+	 */
+	ops_denied(pending_ops & ~ops);
+	pending_ops &= ops;
+
+	if (pending_ops == 0) {
+		request_cycles = k_cycle_get_32();
+	}
+
+	ops_requested(ops & ~pending_ops);
+	ops_granted(ops & granted_ops & ~pending_ops, 0);
+	pending_ops |= ops & ~granted_ops;
+
+	/* Pending operations requested again may be granted already. */
+	mpsl_cx_stats_granted(granted_ops);
+}
+
+void mpsl_cx_stats_granted(mpsl_cx_op_map_t granted_ops)
+{
+	mpsl_cx_op_map_t ops = pending_ops & granted_ops;
+
+	if (ops == 0) {
+		return;
+	}
+
+	ops_granted(ops, k_cyc_to_us_floor32(k_cycle_get_32() - request_cycles));
+	pending_ops &= ~ops;
+}
+
+void mpsl_cx_stats_release(void)
+{
+	ops_denied(pending_ops);
+	pending_ops = 0;
+}
+
+void mpsl_cx_stats_get(struct mpsl_cx_stats *stats)
+{
+	unsigned int key = irq_lock();
+
+	for (size_t i = 0; i < ARRAY_SIZE(counters); i++) {
+		const struct op_counters *c = &counters[i];
+
+		stats->ops[i].requests = c->requests;
+		stats->ops[i].grants = c->grants;
+		stats->ops[i].denials = c->denials;
+		stats->ops[i].latency_max_us = c->latency_max_us;
+		stats->ops[i].latency_avg_us = (c->grants > 0) ? (c->latency_sum_us / c->grants) : 0;
+	}
+
+	irq_unlock(key);
+}
+
+void mpsl_cx_stats_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	memset(counters, 0, sizeof(counters));
+	pending_ops = 0;
+
+	irq_unlock(key);
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ *   This file defines the hooks used by the Coexistence interfaces to gather statistics.
+ *
+ */
+
+#ifndef MPSL_CX_STATS_INTERNAL__
+#define MPSL_CX_STATS_INTERNAL__
+
+#include <protocol/mpsl_cx_protocol_api.h>
+
+#if defined(CONFIG_MPSL_CX_STATS)
+/**
+ * @brief Records a request for radio operations.
+ *
+ * @param ops         Requested radio operations.
+ * @param granted_ops Radio operations granted at the time of the request.
+ */
+void mpsl_cx_stats_request(mpsl_cx_op_map_t ops, mpsl_cx_op_map_t granted_ops);
+
+/**
+ * @brief Records a change of granted radio operations.
+ *
+ * @param granted_ops Currently granted radio operations.
+ */
+void mpsl_cx_stats_granted(mpsl_cx_op_map_t granted_ops);
+
+/**
+ * @brief Records the release of the request.
+ */
+void mpsl_cx_stats_release(void);
+#else
+static inline void mpsl_cx_stats_request(mpsl_cx_op_map_t ops, mpsl_cx_op_map_t granted_ops)
+{
+	(void)ops;
+	(void)granted_ops;
+}
+
+static inline void mpsl_cx_stats_granted(mpsl_cx_op_map_t granted_ops)
+{
+	(void)granted_ops;
+}
+
+static inline void mpsl_cx_stats_release(void)
+{
+}
+#endif
+
+#endif /* MPSL_CX_STATS_INTERNAL__ */
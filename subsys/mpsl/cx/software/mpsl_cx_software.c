@@ -13,6 +13,7 @@
 #include <mpsl/mpsl_cx_software.h>
 
 #include <mpsl_cx_abstract_interface.h>
+#include "../mpsl_cx_stats_internal.h"
 
 #include <zephyr/init.h>
 #include <zephyr/sys/atomic.h>
@@ -28,13 +29,18 @@ static K_TIMER_DEFINE(granted_ops_reset_timer, granted_ops_reset, NULL);
 
 static int32_t request(const mpsl_cx_request_t *req_params)
 {
-	ARG_UNUSED(req_params);
+	if (IS_ENABLED(CONFIG_MPSL_CX_STATS) && (req_params != NULL)) {
+		mpsl_cx_stats_request(req_params->ops,
+				      (mpsl_cx_op_map_t)atomic_get(&granted_ops));
+	}
 
 	return 0;
 }
 
 static int32_t release(void)
 {
+	mpsl_cx_stats_release();
+
 	return 0;
 }
 
@@ -87,6 +93,7 @@ int mpsl_cx_software_set_granted_ops(mpsl_cx_op_map_t ops, k_timeout_t timeout)
 	k_timer_stop(&granted_ops_reset_timer);
 
 	previous_ops = (mpsl_cx_op_map_t)atomic_set(&granted_ops, ops);
+	mpsl_cx_stats_granted(ops);
 
 	if (change_callback != NULL && ops != previous_ops) {
 		change_callback(ops);
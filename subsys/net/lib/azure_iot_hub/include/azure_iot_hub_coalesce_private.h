@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef AZURE_IOT_HUB_COALESCE_PRIVATE__
+#define AZURE_IOT_HUB_COALESCE_PRIVATE__
+
+#include <stddef.h>
+#include <net/azure_iot_hub.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* This file contains private APIs for telemetry batching and reported property coalescing.
+ * The public interface is found in include/net/azure_iot_hub.h
+ */
+
+/* Publish a message to Azure IoT Hub without coalescing it. Implemented in azure_iot_hub.c. */
+int iot_hub_msg_publish(const struct azure_iot_hub_msg *const msg);
+
+/* Merge the JSON object in patch into the JSON object in base and store the result in out.
+ * Members of the patch replace members with the same key in the base. If both values are
+ * JSON objects, they are merged recursively. The base may be empty.
+ *
+ * Returns 0 on success, -EBADMSG if the base or the patch is not a valid JSON object and
+ * -ENOMEM if the result does not fit in the output buffer.
+ */
+int coalesce_json_merge(const char *base, size_t base_len, const char *patch, size_t patch_len,
+			char *out, size_t out_size, size_t *out_len);
+
+/* Add a telemetry message without properties to the current batch. */
+int coalesce_telemetry_add(const struct azure_iot_hub_msg *const msg);
+
+/* Send the current telemetry batch, if any. */
+int coalesce_telemetry_flush(void);
+
+/* Merge a reported property patch into the pending patch. */
+int coalesce_twin_reported_add(const struct azure_iot_hub_msg *const msg);
+
+/* Send the pending telemetry batch and reported property patch. */
+int coalesce_flush(void);
+
+/* Send data that was retained while the connection to Azure IoT Hub was down. */
+void coalesce_connected(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AZURE_IOT_HUB_COALESCE_PRIVATE__ */
@@ -16,6 +16,8 @@
 
 #include <net/mqtt_helper.h>
 
+#include "azure_iot_hub_coalesce_private.h"
+
 #if defined(CONFIG_AZURE_FOTA)
 #include <net/azure_fota.h>
 #endif
@@ -523,6 +525,10 @@ AZ_HUB_STATIC void on_suback(uint16_t message_id, int result)
 	    IS_ENABLED(CONFIG_AZURE_FOTA)) {
 		device_twin_request();
 	}
+
+#if defined(CONFIG_AZURE_IOT_HUB_COALESCE)
+	coalesce_connected();
+#endif
 }
 
 static void on_pingresp(void)
@@ -918,16 +924,12 @@ exit:
 	return err;
 }
 
-int azure_iot_hub_send(const struct azure_iot_hub_msg *const msg)
+int iot_hub_msg_publish(const struct azure_iot_hub_msg *const msg)
 {
 	int err;
 	ssize_t topic_len;
 	char topic[CONFIG_AZURE_IOT_HUB_TOPIC_MAX_LEN + 1];
 
-	if (msg == NULL) {
-		return -EINVAL;
-	}
-
 	struct mqtt_publish_param param = {
 		.message.payload.data = msg->payload.ptr,
 		.message.payload.len = msg->payload.size,
@@ -1061,6 +1063,58 @@ int azure_iot_hub_send(const struct azure_iot_hub_msg *const msg)
 	return mqtt_helper_publish(&param);
 }
 
+int azure_iot_hub_send(const struct azure_iot_hub_msg *const msg)
+{
+	if (msg == NULL) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH)
+	if (msg->topic.type == AZURE_IOT_HUB_TOPIC_EVENT) {
+		if (!iot_hub_state_verify(STATE_CONNECTED)) {
+			LOG_WRN("Azure IoT Hub is not connected");
+			return -ENOTCONN;
+		}
+
+		if (msg->topic.property_count == 0) {
+			return coalesce_telemetry_add(msg);
+		}
+
+		/* Messages with properties are sent on their own, after the current batch to
+		 * preserve the order of the telemetry.
+		 */
+		(void)coalesce_telemetry_flush();
+	}
+#endif
+
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE)
+	if (msg->topic.type == AZURE_IOT_HUB_TOPIC_TWIN_REPORTED) {
+		if (!iot_hub_state_verify(STATE_CONNECTED)) {
+			LOG_WRN("Azure IoT Hub is not connected");
+			return -ENOTCONN;
+		}
+
+		return coalesce_twin_reported_add(msg);
+	}
+#endif
+
+	return iot_hub_msg_publish(msg);
+}
+
+int azure_iot_hub_flush(void)
+{
+#if defined(CONFIG_AZURE_IOT_HUB_COALESCE)
+	if (!iot_hub_state_verify(STATE_CONNECTED)) {
+		LOG_WRN("Azure IoT Hub is not connected");
+		return -ENOTCONN;
+	}
+
+	return coalesce_flush();
+#else
+	return 0;
+#endif
+}
+
 int azure_iot_hub_disconnect(void)
 {
 	int err;
@@ -1070,6 +1124,11 @@ int azure_iot_hub_disconnect(void)
 		return -ENOTCONN;
 	}
 
+#if defined(CONFIG_AZURE_IOT_HUB_COALESCE)
+	/* Send pending data before the connection is closed. */
+	(void)coalesce_flush();
+#endif
+
 	iot_hub_state_set(STATE_DISCONNECTING);
 
 	err = mqtt_helper_disconnect();
@@ -0,0 +1,646 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <net/azure_iot_hub.h>
+
+#include "azure_iot_hub_coalesce_private.h"
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(azure_iot_hub, CONFIG_AZURE_IOT_HUB_LOG_LEVEL);
+
+/* Maximum nesting level of JSON objects that are merged. */
+#define JSON_DEPTH_MAX		8
+
+/* Maximum length of the request ID of a coalesced reported property patch. */
+#define REQUEST_ID_MAX_LEN	20
+
+struct json_member {
+	/* The key, including the quotation marks. */
+	const char *key;
+	size_t key_len;
+	const char *value;
+	size_t value_len;
+};
+
+struct json_out {
+	char *buf;
+	size_t size;
+	size_t len;
+};
+
+#if defined(CONFIG_AZURE_IOT_HUB_COALESCE)
+static K_MUTEX_DEFINE(coalesce_lock);
+#endif
+
+#if defined(CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH)
+/* The batch is a JSON array of the telemetry payloads. The closing bracket is added when the
+ * batch is sent, one byte is reserved for it.
+ */
+static char batch_buf[CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH_BUF_SIZE];
+static size_t batch_len;
+static enum mqtt_qos batch_qos;
+
+static void batch_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_work, batch_work_fn);
+#endif /* CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH */
+
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE)
+static char patch_buf[CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE_BUF_SIZE];
+static char patch_merge_buf[CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE_BUF_SIZE];
+static size_t patch_len;
+static enum mqtt_qos patch_qos;
+static char patch_request_id[REQUEST_ID_MAX_LEN];
+static size_t patch_request_id_len;
+
+static void patch_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(patch_work, patch_work_fn);
+#endif /* CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE */
+
+static bool json_is_ws(char c)
+{
+	return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+static const char *json_ws_skip(const char *pos, const char *end)
+{
+	while ((pos < end) && json_is_ws(*pos)) {
+		pos++;
+	}
+
+	return pos;
+}
+
+/* Returns a pointer to the first character after the JSON value starting at pos, or NULL if
+ * the value is not terminated. Only the structure of the value is verified, not its content.
+ */
+static const char *json_value_skip(const char *pos, const char *end)
+{
+	const char *start = pos;
+	bool in_string = false;
+	int depth = 0;
+
+	for (; pos < end; pos++) {
+		if (in_string) {
+			if (*pos == '\\') {
+				pos++;
+			} else if (*pos == '"') {
+				in_string = false;
+
+				if (depth == 0) {
+					return pos + 1;
+				}
+			}
+
+			continue;
+		}
+
+		switch (*pos) {
+		case '"':
+			in_string = true;
+			break;
+		case '{':
+		case '[':
+			depth++;
+			break;
+		case '}':
+		case ']':
+			if (depth == 0) {
+				/* End of the enclosing object. */
+				return (pos == start) ? NULL : pos;
+			}
+
+			if (--depth == 0) {
+				return pos + 1;
+			}
+
+			break;
+		case ',':
+			if (depth == 0) {
+				return (pos == start) ? NULL : pos;
+			}
+
+			break;
+		default:
+			if ((depth == 0) && json_is_ws(*pos)) {
+				return (pos == start) ? NULL : pos;
+			}
+
+			break;
+		}
+	}
+
+	return ((depth == 0) && !in_string && (pos != start)) ? pos : NULL;
+}
+
+/* Get the next member of a JSON object. The position must point after the opening brace or
+ * after the previous member.
+ *
+ * Returns 1 if a member was found, 0 at the end of the object and -EBADMSG if the object is
+ * malformed.
+ */
+static int json_member_next(const char **pos, const char *end, struct json_member *member,
+			    bool first)
+{
+	const char *p = json_ws_skip(*pos, end);
+
+	if ((p < end) && (*p == '}')) {
+		*pos = p + 1;
+		return 0;
+	}
+
+	if (!first) {
+		if ((p >= end) || (*p != ',')) {
+			return -EBADMSG;
+		}
+
+		p = json_ws_skip(p + 1, end);
+	}
+
+	if ((p >= end) || (*p != '"')) {
+		return -EBADMSG;
+	}
+
+	member->key = p;
+
+	p = json_value_skip(p, end);
+	if (p == NULL) {
+		return -EBADMSG;
+	}
+
+	member->key_len = p - member->key;
+
+	p = json_ws_skip(p, end);
+	if ((p >= end) || (*p != ':')) {
+		return -EBADMSG;
+	}
+
+	member->value = json_ws_skip(p + 1, end);
+
+	p = json_value_skip(member->value, end);
+	if (p == NULL) {
+		return -EBADMSG;
+	}
+
+	member->value_len = p - member->value;
+	*pos = p;
+
+	return 1;
+}
+
+static bool json_is_object(const char *value, size_t value_len)
+{
+	return (value_len >= 2) && (value[0] == '{');
+}
+
+/* Find the member with the given key in a JSON object.
+ * Returns 1 if found, 0 if not found and -EBADMSG if the object is malformed.
+ */
+static int json_member_find(const char *obj, size_t obj_len, const struct json_member *key,
+			    struct json_member *member)
+{
+	const char *pos = obj + 1;
+	const char *end = obj + obj_len;
+	bool first = true;
+	int ret;
+
+	while ((ret = json_member_next(&pos, end, member, first)) == 1) {
+		if ((member->key_len == key->key_len) &&
+		    (memcmp(member->key, key->key, key->key_len) == 0)) {
+			return 1;
+		}
+
+		first = false;
+	}
+
+	return ret;
+}
+
+static int json_out_append(struct json_out *out, const char *data, size_t len)
+{
+	if ((out->size - out->len) < len) {
+		return -ENOMEM;
+	}
+
+	memcpy(&out->buf[out->len], data, len);
+	out->len += len;
+
+	return 0;
+}
+
+static int json_out_member_append(struct json_out *out, const struct json_member *member,
+				  bool first)
+{
+	int err;
+
+	if (!first) {
+		err = json_out_append(out, ",", 1);
+		if (err) {
+			return err;
+		}
+	}
+
+	err = json_out_append(out, member->key, member->key_len);
+	if (err) {
+		return err;
+	}
+
+	return json_out_append(out, ":", 1);
+}
+
+static int json_object_merge(const char *base, size_t base_len, const char *patch,
+			     size_t patch_len, struct json_out *out, int depth)
+{
+	struct json_member member;
+	struct json_member other;
+	const char *pos;
+	bool first_in = true;
+	bool first_out = true;
+	int found;
+	int ret;
+
+	if (depth > JSON_DEPTH_MAX) {
+		return -EBADMSG;
+	}
+
+	ret = json_out_append(out, "{", 1);
+	if (ret) {
+		return ret;
+	}
+
+	/* Members of the base, replaced by or merged with the members of the patch. */
+	pos = base + 1;
+
+	while ((ret = json_member_next(&pos, base + base_len, &member, first_in)) == 1) {
+		first_in = false;
+
+		found = json_member_find(patch, patch_len, &member, &other);
+		if (found < 0) {
+			return found;
+		}
+
+		ret = json_out_member_append(out, &member, first_out);
+		if (ret) {
+			return ret;
+		}
+
+		first_out = false;
+
+		if (found && json_is_object(member.value, member.value_len) &&
+		    json_is_object(other.value, other.value_len)) {
+			ret = json_object_merge(member.value, member.value_len,
+						other.value, other.value_len, out, depth + 1);
+		} else if (found) {
+			ret = json_out_append(out, other.value, other.value_len);
+		} else {
+			ret = json_out_append(out, member.value, member.value_len);
+		}
+
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Members that are only present in the patch. */
+	pos = patch + 1;
+	first_in = true;
+
+	while ((ret = json_member_next(&pos, patch + patch_len, &member, first_in)) == 1) {
+		first_in = false;
+
+		ret = json_member_find(base, base_len, &member, &other);
+		if (ret < 0) {
+			return ret;
+		} else if (ret == 1) {
+			continue;
+		}
+
+		ret = json_out_member_append(out, &member, first_out);
+		if (ret) {
+			return ret;
+		}
+
+		first_out = false;
+
+		ret = json_out_append(out, member.value, member.value_len);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	return json_out_append(out, "}", 1);
+}
+
+/* Strip surrounding whitespace and verify that the span holds exactly one JSON object. */
+static int json_object_trim(const char **obj, size_t *obj_len)
+{
+	const char *end = *obj + *obj_len;
+	const char *start = json_ws_skip(*obj, end);
+	const char *value_end;
+
+	if ((start >= end) || (*start != '{')) {
+		return -EBADMSG;
+	}
+
+	value_end = json_value_skip(start, end);
+	if ((value_end == NULL) || (json_ws_skip(value_end, end) != end)) {
+		return -EBADMSG;
+	}
+
+	*obj = start;
+	*obj_len = value_end - start;
+
+	return 0;
+}
+
+int coalesce_json_merge(const char *base, size_t base_len, const char *patch, size_t patch_len,
+			char *out, size_t out_size, size_t *out_len)
+{
+	int err;
+	struct json_out json_out = {
+		.buf = out,
+		.size = out_size,
+	};
+
+	if ((patch == NULL) || (out == NULL) || (out_len == NULL)) {
+		return -EINVAL;
+	}
+
+	if ((base == NULL) || (base_len == 0)) {
+		base = "{}";
+		base_len = 2;
+	}
+
+	err = json_object_trim(&base, &base_len);
+	if (err) {
+		return err;
+	}
+
+	err = json_object_trim(&patch, &patch_len);
+	if (err) {
+		return err;
+	}
+
+	err = json_object_merge(base, base_len, patch, patch_len, &json_out, 0);
+	if (err) {
+		return err;
+	}
+
+	*out_len = json_out.len;
+
+	return 0;
+}
+
+#if defined(CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH)
+/* Must be called with coalesce_lock held. The batch is retained if the library is not
+ * connected, and dropped on any other error.
+ */
+static int batch_send(void)
+{
+	int err;
+	struct azure_iot_hub_msg msg = {
+		.topic.type = AZURE_IOT_HUB_TOPIC_EVENT,
+		.payload.ptr = batch_buf,
+		.qos = batch_qos,
+	};
+
+	if (batch_len == 0) {
+		return 0;
+	}
+
+	batch_buf[batch_len] = ']';
+	msg.payload.size = batch_len + 1;
+
+	err = iot_hub_msg_publish(&msg);
+	if (err == -ENOTCONN) {
+		LOG_DBG("Not connected, telemetry batch retained");
+		return err;
+	} else if (err) {
+		LOG_ERR("Failed to send telemetry batch, error: %d", err);
+	} else {
+		LOG_DBG("Telemetry batch sent, %zu bytes", msg.payload.size);
+	}
+
+	batch_len = 0;
+	batch_qos = MQTT_QOS_0_AT_MOST_ONCE;
+
+	(void)k_work_cancel_delayable(&batch_work);
+
+	return err;
+}
+
+static void batch_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&coalesce_lock, K_FOREVER);
+	(void)batch_send();
+	k_mutex_unlock(&coalesce_lock);
+}
+
+int coalesce_telemetry_add(const struct azure_iot_hub_msg *const msg)
+{
+	int err = 0;
+	/* Separator and the reserved closing bracket. */
+	size_t needed = msg->payload.size + 2;
+
+	if (needed > sizeof(batch_buf)) {
+		/* Too large to be batched, send it on its own after the current batch. */
+		err = coalesce_telemetry_flush();
+		if (err) {
+			return err;
+		}
+
+		return iot_hub_msg_publish(msg);
+	}
+
+	k_mutex_lock(&coalesce_lock, K_FOREVER);
+
+	if ((batch_len + needed) > sizeof(batch_buf)) {
+		err = batch_send();
+		if (err) {
+			goto exit;
+		}
+	}
+
+	batch_buf[batch_len] = (batch_len == 0) ? '[' : ',';
+	batch_len++;
+
+	memcpy(&batch_buf[batch_len], msg->payload.ptr, msg->payload.size);
+	batch_len += msg->payload.size;
+
+	batch_qos = MAX(batch_qos, msg->qos);
+
+	/* The window starts with the first message in the batch. */
+	(void)k_work_schedule(&batch_work, K_MSEC(CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH_WINDOW_MS));
+
+exit:
+	k_mutex_unlock(&coalesce_lock);
+
+	return err;
+}
+
+int coalesce_telemetry_flush(void)
+{
+	int err;
+
+	k_mutex_lock(&coalesce_lock, K_FOREVER);
+	err = batch_send();
+	k_mutex_unlock(&coalesce_lock);
+
+	return err;
+}
+#endif /* CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH */
+
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE)
+/* Must be called with coalesce_lock held. The patch is retained if the library is not
+ * connected, and dropped on any other error.
+ */
+static int patch_send(void)
+{
+	int err;
+	struct azure_iot_hub_msg msg = {
+		.topic.type = AZURE_IOT_HUB_TOPIC_TWIN_REPORTED,
+		.payload.ptr = patch_buf,
+		.payload.size = patch_len,
+		.request_id.ptr = patch_request_id,
+		.request_id.size = patch_request_id_len,
+		.qos = patch_qos,
+	};
+
+	if (patch_len == 0) {
+		return 0;
+	}
+
+	err = iot_hub_msg_publish(&msg);
+	if (err == -ENOTCONN) {
+		LOG_DBG("Not connected, reported property patch retained");
+		return err;
+	} else if (err) {
+		LOG_ERR("Failed to send reported property patch, error: %d", err);
+	} else {
+		LOG_DBG("Reported property patch sent, %zu bytes", patch_len);
+	}
+
+	patch_len = 0;
+	patch_request_id_len = 0;
+	patch_qos = MQTT_QOS_0_AT_MOST_ONCE;
+
+	(void)k_work_cancel_delayable(&patch_work);
+
+	return err;
+}
+
+static void patch_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&coalesce_lock, K_FOREVER);
+	(void)patch_send();
+	k_mutex_unlock(&coalesce_lock);
+}
+
+int coalesce_twin_reported_add(const struct azure_iot_hub_msg *const msg)
+{
+	int err;
+	size_t len;
+
+	if (msg->request_id.size > sizeof(patch_request_id)) {
+		LOG_ERR("Request ID too long to be coalesced");
+		return -EMSGSIZE;
+	}
+
+	k_mutex_lock(&coalesce_lock, K_FOREVER);
+
+	err = coalesce_json_merge(patch_buf, patch_len, msg->payload.ptr, msg->payload.size,
+				  patch_merge_buf, sizeof(patch_merge_buf), &len);
+	if (err == -ENOMEM) {
+		/* The merged patch does not fit, send the pending one and start over. */
+		err = patch_send();
+		if (err) {
+			goto exit;
+		}
+
+		err = coalesce_json_merge(NULL, 0, msg->payload.ptr, msg->payload.size,
+					  patch_merge_buf, sizeof(patch_merge_buf), &len);
+	}
+
+	if (err) {
+		LOG_ERR("Failed to coalesce reported property patch, error: %d", err);
+		goto exit;
+	}
+
+	memcpy(patch_buf, patch_merge_buf, len);
+	patch_len = len;
+
+	/* The request ID of the last update is used for the coalesced patch. */
+	memcpy(patch_request_id, msg->request_id.ptr, msg->request_id.size);
+	patch_request_id_len = msg->request_id.size;
+
+	patch_qos = MAX(patch_qos, msg->qos);
+
+	/* The window starts with the first patch that is merged. */
+	(void)k_work_schedule(&patch_work,
+			      K_MSEC(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE_WINDOW_MS));
+
+exit:
+	k_mutex_unlock(&coalesce_lock);
+
+	return err;
+}
+#endif /* CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE */
+
+#if defined(CONFIG_AZURE_IOT_HUB_COALESCE)
+int coalesce_flush(void)
+{
+	int err = 0;
+
+	k_mutex_lock(&coalesce_lock, K_FOREVER);
+
+#if defined(CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH)
+	err = batch_send();
+#endif
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE)
+	int patch_err = patch_send();
+
+	err = err ? err : patch_err;
+#endif
+
+	k_mutex_unlock(&coalesce_lock);
+
+	return err;
+}
+
+void coalesce_connected(void)
+{
+	k_mutex_lock(&coalesce_lock, K_FOREVER);
+
+#if defined(CONFIG_AZURE_IOT_HUB_TELEMETRY_BATCH)
+	if (batch_len > 0) {
+		(void)k_work_reschedule(&batch_work, K_NO_WAIT);
+	}
+#endif
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_COALESCE)
+	if (patch_len > 0) {
+		(void)k_work_reschedule(&patch_work, K_NO_WAIT);
+	}
+#endif
+
+	k_mutex_unlock(&coalesce_lock);
+}
+#endif /* CONFIG_AZURE_IOT_HUB_COALESCE */
@@ -14,7 +14,10 @@ LOG_MODULE_REGISTER(coap_utils, CONFIG_COAP_UTILS_LOG_LEVEL);
 #define MAX_COAP_MSG_LEN 256
 #define COAP_VER 1
 #define COAP_TOKEN_LEN 8
-#define COAP_MAX_REPLIES 1
+#define COAP_MAX_REPLIES CONFIG_COAP_UTILS_MAX_REPLIES
+#define COAP_MAX_PENDINGS CONFIG_COAP_UTILS_MAX_PENDINGS
+#define COAP_OBSERVE_REGISTER 0
+#define COAP_OBSERVE_DEREGISTER 1
 #define COAP_POOL_SLEEP 500
 #define COAP_OPEN_SOCKET_SLEEP 200
 #if defined(CONFIG_NRF_MODEM_LIB)
@@ -26,9 +29,20 @@ LOG_MODULE_REGISTER(coap_utils, CONFIG_COAP_UTILS_LOG_LEVEL);
 const static int nfds = 1;
 static struct zsock_pollfd fds;
 static struct coap_reply replies[COAP_MAX_REPLIES];
+/* Observation registrations are kept in their reply slots after a response. */
+static bool reply_observe[COAP_MAX_REPLIES];
+static uint8_t reply_next;
+static struct coap_pending pendings[COAP_MAX_PENDINGS];
+static uint8_t pending_bufs[COAP_MAX_PENDINGS][MAX_COAP_MSG_LEN];
 static int proto_family;
 static struct sockaddr *bind_addr;
 
+/* Protects the reply and pending tables. */
+static K_MUTEX_DEFINE(coap_lock);
+
+static void retransmit_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(retransmit_work, retransmit_work_handler);
+
 static K_THREAD_STACK_DEFINE(receive_stack_area, COAP_RECEIVE_STACK_SIZE);
 static struct k_thread receive_thread_data;
 
@@ -60,6 +74,80 @@ static void coap_close_socket(int socket)
 	(void)zsock_close(socket);
 }
 
+static void coap_reply_release(struct coap_reply *reply)
+{
+	reply_observe[reply - replies] = false;
+	coap_reply_clear(reply);
+}
+
+static void coap_send_ack(const struct coap_packet *request, const struct sockaddr *addr)
+{
+	struct coap_packet ack;
+	uint8_t buf[COAP_TOKEN_LEN + 4];
+	int ret;
+
+	ret = coap_ack_init(&ack, request, buf, sizeof(buf), COAP_CODE_EMPTY);
+	if (ret < 0) {
+		LOG_ERR("Failed to init CoAP ACK");
+		return;
+	}
+
+	if (zsock_sendto(fds.fd, ack.data, ack.offset, 0, addr, sizeof(*addr)) < 0) {
+		LOG_ERR("Failed to send CoAP ACK: %d", errno);
+	}
+}
+
+static void coap_ack_received(const struct coap_packet *response)
+{
+	struct coap_pending *pending;
+
+	pending = coap_pending_received(response, pendings, COAP_MAX_PENDINGS);
+	if (!pending) {
+		return;
+	}
+
+	coap_pending_clear(pending);
+	k_work_reschedule(&retransmit_work, K_NO_WAIT);
+}
+
+static void retransmit_work_handler(struct k_work *work)
+{
+	struct coap_pending *pending;
+	int32_t remaining;
+
+	k_mutex_lock(&coap_lock, K_FOREVER);
+
+	while ((pending = coap_pending_next_to_expire(pendings, COAP_MAX_PENDINGS))) {
+		remaining = pending->t0 + pending->timeout - k_uptime_get_32();
+		if (remaining > 0) {
+			k_work_reschedule(&retransmit_work, K_MSEC(remaining));
+			break;
+		}
+
+		if (!coap_pending_cycle(pending)) {
+			LOG_WRN("No acknowledgment for CoAP message %u", pending->id);
+
+			for (size_t i = 0; i < COAP_MAX_REPLIES; i++) {
+				if (replies[i].reply && (replies[i].id == pending->id)) {
+					coap_reply_release(&replies[i]);
+				}
+			}
+
+			coap_pending_clear(pending);
+			continue;
+		}
+
+		LOG_DBG("Retransmitting CoAP message %u", pending->id);
+
+		if (zsock_sendto(fds.fd, pending->data, pending->len, 0, &pending->addr,
+				 sizeof(pending->addr)) < 0) {
+			LOG_ERR("Retransmission failed: %d", errno);
+		}
+	}
+
+	k_mutex_unlock(&coap_lock);
+}
+
 static void coap_receive(void)
 {
 	static uint8_t buf[MAX_COAP_MSG_LEN + 1];
@@ -128,31 +216,50 @@ static void coap_receive(void)
 			continue;
 		}
 
+		k_mutex_lock(&coap_lock, K_FOREVER);
+
+		coap_ack_received(&response);
+
+		if (coap_header_get_type(&response) == COAP_TYPE_CON) {
+			coap_send_ack(&response, &from_addr);
+		}
+
 		reply = coap_response_received(&response, &from_addr, replies,
 					       COAP_MAX_REPLIES);
-		if (reply) {
+		if (reply && !reply_observe[reply - replies]) {
 			coap_reply_clear(reply);
 		}
+
+		k_mutex_unlock(&coap_lock);
 	}
 }
 
 static int coap_init_request(enum coap_method method,
-			     enum coap_msgtype msg_type,
-			     const char *const *uri_path_options, uint8_t *payload,
-			     uint16_t payload_size, struct coap_packet *request,
-			     uint8_t *buf)
+			     enum coap_msgtype msg_type, const uint8_t *token,
+			     int observe, const char *const *uri_path_options,
+			     uint8_t *payload, uint16_t payload_size,
+			     struct coap_packet *request, uint8_t *buf)
 {
 	const char *const *opt;
 	int ret;
 
 	ret = coap_packet_init(request, buf, MAX_COAP_MSG_LEN, COAP_VER,
-			       msg_type, COAP_TOKEN_LEN, coap_next_token(),
+			       msg_type, COAP_TOKEN_LEN,
+			       token ? token : coap_next_token(),
 			       method, coap_next_id());
 	if (ret < 0) {
 		LOG_ERR("Failed to init CoAP message");
 		goto end;
 	}
 
+	if (observe >= 0) {
+		ret = coap_append_option_int(request, COAP_OPTION_OBSERVE, observe);
+		if (ret < 0) {
+			LOG_ERR("Unable to add observe option to request");
+			goto end;
+		}
+	}
+
 	for (opt = uri_path_options; opt && *opt; opt++) {
 		ret = coap_packet_append_option(request, COAP_OPTION_URI_PATH,
 						*(const uint8_t *const *)opt, strlen(*opt));
@@ -189,15 +296,92 @@ static int coap_send_message(const struct sockaddr *addr,
 }
 
 static void coap_set_response_callback(struct coap_packet *request,
-				       coap_reply_t reply_cb)
+				       coap_reply_t reply_cb, bool observe)
 {
-	struct coap_reply *reply;
+	struct coap_reply *reply = NULL;
+
+	for (size_t i = 0; i < COAP_MAX_REPLIES; i++) {
+		if (!replies[i].reply) {
+			reply = &replies[i];
+			break;
+		}
+	}
 
-	reply = &replies[0];
+	if (!reply) {
+		/* All slots are in use, drop the oldest registered response callback. */
+		reply = &replies[reply_next];
+		reply_next = (reply_next + 1) % COAP_MAX_REPLIES;
+		LOG_DBG("Dropping response callback for CoAP message %u", reply->id);
+	}
 
-	coap_reply_clear(reply);
+	coap_reply_release(reply);
 	coap_reply_init(reply, request);
 	reply->reply = reply_cb;
+	reply_observe[reply - replies] = observe;
+}
+
+static struct coap_pending *coap_pending_alloc(void)
+{
+	for (size_t i = 0; i < COAP_MAX_PENDINGS; i++) {
+		if (pendings[i].timeout == 0) {
+			return &pendings[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int coap_send_con(enum coap_method method, const struct sockaddr *addr,
+			 const uint8_t *token, int observe,
+			 const char *const *uri_path_options, uint8_t *payload,
+			 uint16_t payload_size, coap_reply_t reply_cb)
+{
+	int ret;
+	struct coap_packet request;
+	struct coap_pending *pending;
+
+	k_mutex_lock(&coap_lock, K_FOREVER);
+
+	pending = coap_pending_alloc();
+	if (!pending) {
+		LOG_ERR("No free slot for confirmable request");
+		ret = -ENOMEM;
+		goto end;
+	}
+
+	ret = coap_init_request(method, COAP_TYPE_CON, token, observe,
+				uri_path_options, payload, payload_size,
+				&request, pending_bufs[pending - pendings]);
+	if (ret < 0) {
+		goto end;
+	}
+
+	ret = coap_pending_init(pending, &request, addr, NULL);
+	if (ret < 0) {
+		LOG_ERR("Failed to init pending request");
+		goto end;
+	}
+
+	ret = coap_send_message(addr, &request);
+	if (ret < 0) {
+		LOG_ERR("Transmission failed: %d", errno);
+		coap_pending_clear(pending);
+		goto end;
+	}
+
+	(void)coap_pending_cycle(pending);
+
+	/* The receive thread waits for the lock, so the response cannot be missed here. */
+	if (reply_cb != NULL) {
+		coap_set_response_callback(&request, reply_cb, observe == COAP_OBSERVE_REGISTER);
+	}
+
+	k_work_reschedule(&retransmit_work, K_NO_WAIT);
+
+end:
+	k_mutex_unlock(&coap_lock);
+
+	return ret;
 }
 
 void coap_init(int ip_family, struct sockaddr *addr)
@@ -230,16 +414,21 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 	struct coap_packet request;
 	uint8_t buf[MAX_COAP_MSG_LEN];
 
-	ret = coap_init_request(method, COAP_TYPE_NON_CON, uri_path_options,
-				payload, payload_size, &request, buf);
+	ret = coap_init_request(method, COAP_TYPE_NON_CON, NULL, -1,
+				uri_path_options, payload, payload_size,
+				&request, buf);
 	if (ret < 0) {
 		goto end;
 	}
 
+	k_mutex_lock(&coap_lock, K_FOREVER);
+
 	if (reply_cb != NULL) {
-		coap_set_response_callback(&request, reply_cb);
+		coap_set_response_callback(&request, reply_cb, false);
 	}
 
+	k_mutex_unlock(&coap_lock);
+
 	ret = coap_send_message(addr, &request);
 	if (ret < 0) {
 		LOG_ERR("Transmission failed: %d", errno);
@@ -249,3 +438,52 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 end:
 	return ret;
 }
+
+int coap_send_con_request(enum coap_method method, const struct sockaddr *addr,
+			  const char *const *uri_path_options, uint8_t *payload,
+			  uint16_t payload_size, coap_reply_t reply_cb)
+{
+	return coap_send_con(method, addr, NULL, -1, uri_path_options, payload,
+			     payload_size, reply_cb);
+}
+
+int coap_observe(const struct sockaddr *addr,
+		 const char *const *uri_path_options, coap_reply_t reply_cb)
+{
+	if (reply_cb == NULL) {
+		return -EINVAL;
+	}
+
+	return coap_send_con(COAP_METHOD_GET, addr, NULL, COAP_OBSERVE_REGISTER,
+			     uri_path_options, NULL, 0, reply_cb);
+}
+
+int coap_observe_cancel(const struct sockaddr *addr,
+			const char *const *uri_path_options, coap_reply_t reply_cb)
+{
+	uint8_t token[COAP_TOKEN_LEN];
+	struct coap_reply *reply = NULL;
+
+	k_mutex_lock(&coap_lock, K_FOREVER);
+
+	for (size_t i = 0; i < COAP_MAX_REPLIES; i++) {
+		if (reply_observe[i] && (replies[i].reply == reply_cb)) {
+			reply = &replies[i];
+			break;
+		}
+	}
+
+	if (!reply) {
+		k_mutex_unlock(&coap_lock);
+		return -ENOENT;
+	}
+
+	/* Deregister using the token of the registration request. */
+	memcpy(token, reply->token, sizeof(token));
+	coap_reply_release(reply);
+
+	k_mutex_unlock(&coap_lock);
+
+	return coap_send_con(COAP_METHOD_GET, addr, token, COAP_OBSERVE_DEREGISTER,
+			     uri_path_options, NULL, 0, NULL);
+}
@@ -0,0 +1,812 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/sys_getopt.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/ethernet.h> /* just for ETH_P_ALL */
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_event.h>
+
+#include <net/dect/dect_net_l2.h>
+#include <net/dect/dect_net_l2_mgmt.h>
+
+/* Benchmark traffic is sent as raw DLC data between two devices. Every packet starts with
+ * the header below, the rest of the packet is padding up to the requested packet size.
+ */
+#define PERF_MAGIC 0x44505246 /* "DPRF" */
+
+enum perf_pkt_type {
+	/* Data that is only counted by the sink. */
+	PERF_PKT_DATA,
+	/* Data that is counted and echoed back by the sink for round trip time. */
+	PERF_PKT_ECHO_REQ,
+	PERF_PKT_ECHO_RESP,
+	/* End of the measurement, the sink responds with a report. */
+	PERF_PKT_END,
+	PERF_PKT_REPORT,
+};
+
+struct perf_hdr {
+	uint32_t magic;
+	uint8_t type;
+	uint8_t reserved[3];
+	uint32_t seq;
+	/* Source timestamp in microseconds, echoed back as such. */
+	uint32_t timestamp_us;
+} __packed;
+
+struct perf_report {
+	uint32_t rx_packets;
+	uint32_t rx_bytes;
+	uint32_t lost_packets;
+	uint32_t duration_us;
+} __packed;
+
+#define PERF_HDR_LEN	    sizeof(struct perf_hdr)
+#define PERF_REPORT_LEN	    (PERF_HDR_LEN + sizeof(struct perf_report))
+#define PERF_POLL_TIMEOUT_MS 1000
+#define PERF_END_RETRIES    3
+#define PERF_NBR_INFO_TIMEOUT K_SECONDS(2)
+
+#define RTT_BUCKET_MS	 CONFIG_DECT_L2_SHELL_PERF_RTT_BUCKET_MS
+#define RTT_BUCKET_COUNT CONFIG_DECT_L2_SHELL_PERF_RTT_BUCKET_COUNT
+
+/* Percentiles of the round trip time that are reported. */
+static const uint8_t percentiles[] = {50, 90, 99};
+
+struct perf_client_params {
+	uint32_t target_long_rd_id;
+	uint32_t duration_s;
+	uint32_t interval_ms;
+	uint16_t pkt_len;
+	uint16_t echo_every;
+	int mcs;
+};
+
+struct perf_nbr_stats {
+	bool valid;
+	uint16_t num_tx_attempts;
+	uint16_t num_lbt_failures;
+	uint16_t num_harq_ack;
+	uint16_t num_harq_nack;
+	uint16_t num_arq_retx;
+};
+
+static struct {
+	const struct shell *shell;
+	struct net_if *iface;
+
+	/* Sink */
+	int server_sockfd;
+	bool server_active;
+	uint32_t server_src_long_rd_id;
+	uint32_t server_rx_packets;
+	uint32_t server_rx_bytes;
+	uint32_t server_max_seq;
+	uint32_t server_first_rx_us;
+	uint32_t server_last_rx_us;
+
+	/* Source */
+	bool client_running;
+	atomic_t client_abort;
+	struct perf_client_params client_params;
+	uint32_t rtt_hist[RTT_BUCKET_COUNT];
+	uint32_t rtt_max_ms;
+	uint32_t rtt_cnt;
+
+	/* Neighbor info requested by the source */
+	uint32_t nbr_info_target;
+	struct perf_nbr_stats nbr_info;
+} perf = {
+	.server_sockfd = -1,
+};
+
+static uint8_t server_buf[DECT_MTU];
+static uint8_t client_buf[DECT_MTU];
+static uint8_t client_rx_buf[DECT_MTU];
+
+K_SEM_DEFINE(perf_server_sem, 0, 1);
+K_SEM_DEFINE(perf_client_sem, 0, 1);
+K_SEM_DEFINE(perf_nbr_info_sem, 0, 1);
+
+static struct net_mgmt_event_callback perf_mgmt_cb;
+
+static uint32_t perf_now_us(void)
+{
+	return k_cyc_to_us_floor32(k_cycle_get_32());
+}
+
+static int perf_socket_open(int *sockfd, struct sockaddr_ll *sa)
+{
+	int ret;
+
+	if (perf.iface == NULL) {
+		perf.iface = net_if_get_by_index(net_if_get_by_name(CONFIG_DECT_MDM_DEVICE_NAME));
+		if (perf.iface == NULL) {
+			return -ENODEV;
+		}
+	}
+
+	/* Using SOCK_DGRAM instead of SOCK_RAW because dst address is
+	 * passed down in a stack (in zephyr net_context.c)
+	 */
+	*sockfd = zsock_socket(AF_PACKET, SOCK_DGRAM, htons(ETH_P_ALL));
+	if (*sockfd < 0) {
+		return -errno;
+	}
+
+	memset(sa, 0, sizeof(*sa));
+	sa->sll_family = AF_PACKET;
+	sa->sll_ifindex = net_if_get_by_iface(perf.iface);
+
+	ret = zsock_bind(*sockfd, (struct sockaddr *)sa, sizeof(struct sockaddr_ll));
+	if (ret < 0) {
+		ret = -errno;
+		zsock_close(*sockfd);
+		*sockfd = -1;
+		return ret;
+	}
+
+	return 0;
+}
+
+static void perf_addr_set(struct sockaddr_ll *sa, uint32_t long_rd_id)
+{
+	uint32_t addr = htonl(long_rd_id);
+
+	memcpy(&sa->sll_addr, &addr, sizeof(addr));
+	sa->sll_halen = sizeof(addr);
+}
+
+static void perf_hdr_write(uint8_t *buf, enum perf_pkt_type type, uint32_t seq,
+			   uint32_t timestamp_us)
+{
+	struct perf_hdr *hdr = (struct perf_hdr *)buf;
+
+	sys_put_be32(PERF_MAGIC, (uint8_t *)&hdr->magic);
+	hdr->type = type;
+	memset(hdr->reserved, 0, sizeof(hdr->reserved));
+	sys_put_be32(seq, (uint8_t *)&hdr->seq);
+	sys_put_be32(timestamp_us, (uint8_t *)&hdr->timestamp_us);
+}
+
+static bool perf_hdr_read(const uint8_t *buf, int len, enum perf_pkt_type *type, uint32_t *seq,
+			  uint32_t *timestamp_us)
+{
+	const struct perf_hdr *hdr = (const struct perf_hdr *)buf;
+
+	if (len < (int)PERF_HDR_LEN || sys_get_be32((const uint8_t *)&hdr->magic) != PERF_MAGIC) {
+		return false;
+	}
+
+	*type = hdr->type;
+	*seq = sys_get_be32((const uint8_t *)&hdr->seq);
+	*timestamp_us = sys_get_be32((const uint8_t *)&hdr->timestamp_us);
+
+	return true;
+}
+
+/* Sink */
+
+static void perf_server_reset(uint32_t src_long_rd_id, uint32_t now_us)
+{
+	perf.server_active = true;
+	perf.server_src_long_rd_id = src_long_rd_id;
+	perf.server_rx_packets = 0;
+	perf.server_rx_bytes = 0;
+	perf.server_max_seq = 0;
+	perf.server_first_rx_us = now_us;
+	perf.server_last_rx_us = now_us;
+}
+
+static void perf_server_report_send(struct sockaddr_ll *src, uint32_t seq)
+{
+	struct perf_report *report = (struct perf_report *)&server_buf[PERF_HDR_LEN];
+	uint32_t expected = perf.server_active ? perf.server_max_seq + 1 : 0;
+	uint32_t lost = (expected > perf.server_rx_packets) ?
+			(expected - perf.server_rx_packets) : 0;
+	uint32_t duration_us = perf.server_last_rx_us - perf.server_first_rx_us;
+
+	perf_hdr_write(server_buf, PERF_PKT_REPORT, seq, 0);
+	sys_put_be32(perf.server_rx_packets, (uint8_t *)&report->rx_packets);
+	sys_put_be32(perf.server_rx_bytes, (uint8_t *)&report->rx_bytes);
+	sys_put_be32(lost, (uint8_t *)&report->lost_packets);
+	sys_put_be32(duration_us, (uint8_t *)&report->duration_us);
+
+	if (zsock_sendto(perf.server_sockfd, server_buf, PERF_REPORT_LEN, 0,
+			 (const struct sockaddr *)src, sizeof(struct sockaddr_ll)) < 0) {
+		printk("perf: unable to send report: %d\n", errno);
+	}
+
+	if (perf.server_active) {
+		shell_print(perf.shell,
+			    "perf: sink done, src long RD ID %u: %u packets, %u bytes, "
+			    "%u lost, %u ms",
+			    perf.server_src_long_rd_id, perf.server_rx_packets,
+			    perf.server_rx_bytes, lost, duration_us / USEC_PER_MSEC);
+		perf.server_active = false;
+	}
+}
+
+static void perf_server_pkt_handle(struct sockaddr_ll *src, int len)
+{
+	enum perf_pkt_type type;
+	uint32_t seq;
+	uint32_t timestamp_us;
+	uint32_t now_us = perf_now_us();
+	uint32_t src_long_rd_id = ntohl(*(uint32_t *)&src->sll_addr);
+
+	if (!perf_hdr_read(server_buf, len, &type, &seq, &timestamp_us)) {
+		return;
+	}
+
+	switch (type) {
+	case PERF_PKT_DATA:
+	case PERF_PKT_ECHO_REQ:
+		/* A new measurement starts from sequence number zero or from another source. */
+		if (!perf.server_active || seq == 0 ||
+		    src_long_rd_id != perf.server_src_long_rd_id) {
+			perf_server_reset(src_long_rd_id, now_us);
+		}
+
+		perf.server_rx_packets++;
+		perf.server_rx_bytes += len;
+		perf.server_max_seq = MAX(perf.server_max_seq, seq);
+		perf.server_last_rx_us = now_us;
+
+		if (type == PERF_PKT_ECHO_REQ) {
+			/* Echo the header only, so that the return path is not loaded. */
+			perf_hdr_write(server_buf, PERF_PKT_ECHO_RESP, seq, timestamp_us);
+			(void)zsock_sendto(perf.server_sockfd, server_buf, PERF_HDR_LEN, 0,
+					   (const struct sockaddr *)src,
+					   sizeof(struct sockaddr_ll));
+		}
+		break;
+	case PERF_PKT_END:
+		if (perf.server_active && src_long_rd_id != perf.server_src_long_rd_id) {
+			break;
+		}
+		perf_server_report_send(src, seq);
+		break;
+	default:
+		/* Responses are for the source */
+		break;
+	}
+}
+
+static void perf_server_thread_fn(void)
+{
+	struct zsock_pollfd fds[1];
+	struct sockaddr_ll src;
+	socklen_t fromlen;
+	int ret;
+
+	while (true) {
+		if (perf.server_sockfd < 0) {
+			/* Wait for the sink to be started */
+			k_sem_take(&perf_server_sem, K_FOREVER);
+			continue;
+		}
+
+		fds[0].fd = perf.server_sockfd;
+		fds[0].events = ZSOCK_POLLIN;
+		fds[0].revents = 0;
+
+		ret = zsock_poll(fds, 1, PERF_POLL_TIMEOUT_MS);
+		if (ret <= 0) {
+			continue;
+		}
+
+		fromlen = sizeof(src);
+		ret = zsock_recvfrom(perf.server_sockfd, server_buf, sizeof(server_buf), 0,
+				     (struct sockaddr *)&src, &fromlen);
+		if (ret < 0) {
+			continue;
+		}
+
+		perf_server_pkt_handle(&src, ret);
+	}
+}
+
+K_THREAD_DEFINE(dect_shell_perf_server_thread, CONFIG_DECT_L2_SHELL_PERF_THREAD_STACK_SIZE,
+		perf_server_thread_fn, NULL, NULL, NULL, 5, 0, 0);
+
+/* Source */
+
+static void perf_rtt_add(uint32_t timestamp_us)
+{
+	uint32_t rtt_ms = (perf_now_us() - timestamp_us) / USEC_PER_MSEC;
+
+	perf.rtt_hist[MIN(rtt_ms / RTT_BUCKET_MS, RTT_BUCKET_COUNT - 1)]++;
+	perf.rtt_max_ms = MAX(perf.rtt_max_ms, rtt_ms);
+	perf.rtt_cnt++;
+}
+
+static uint32_t perf_rtt_percentile_get(uint8_t percentile)
+{
+	/* Rank of the sample, rounded up. */
+	uint32_t rank = DIV_ROUND_UP((uint64_t)perf.rtt_cnt * percentile, 100);
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < RTT_BUCKET_COUNT - 1; i++) {
+		sum += perf.rtt_hist[i];
+
+		if (sum >= rank) {
+			/* Report the upper bound of the bucket. */
+			return MIN((i + 1) * RTT_BUCKET_MS, perf.rtt_max_ms);
+		}
+	}
+
+	return perf.rtt_max_ms;
+}
+
+/* Handles the responses received by the source. Returns true if the report was received. */
+static bool perf_client_rx(int sockfd, int timeout_ms, struct perf_report *report)
+{
+	struct zsock_pollfd fds[1];
+	enum perf_pkt_type type;
+	uint32_t seq;
+	uint32_t timestamp_us;
+	int len;
+
+	fds[0].fd = sockfd;
+	fds[0].events = ZSOCK_POLLIN;
+
+	while (true) {
+		fds[0].revents = 0;
+		if (zsock_poll(fds, 1, timeout_ms) <= 0) {
+			return false;
+		}
+
+		len = zsock_recv(sockfd, client_rx_buf, sizeof(client_rx_buf), ZSOCK_MSG_DONTWAIT);
+		if (len < 0 || !perf_hdr_read(client_rx_buf, len, &type, &seq, &timestamp_us)) {
+			continue;
+		}
+
+		if (type == PERF_PKT_ECHO_RESP) {
+			perf_rtt_add(timestamp_us);
+		} else if (type == PERF_PKT_REPORT && len >= (int)PERF_REPORT_LEN) {
+			const struct perf_report *rx =
+				(const struct perf_report *)&client_rx_buf[PERF_HDR_LEN];
+
+			report->rx_packets = sys_get_be32((const uint8_t *)&rx->rx_packets);
+			report->rx_bytes = sys_get_be32((const uint8_t *)&rx->rx_bytes);
+			report->lost_packets = sys_get_be32((const uint8_t *)&rx->lost_packets);
+			report->duration_us = sys_get_be32((const uint8_t *)&rx->duration_us);
+			return true;
+		}
+	}
+}
+
+static void perf_mgmt_event_handler(struct net_mgmt_event_callback *cb, uint64_t mgmt_event,
+				    struct net_if *iface)
+{
+	const struct dect_neighbor_info_evt *evt = (const struct dect_neighbor_info_evt *)cb->info;
+
+	if (mgmt_event != NET_EVENT_DECT_NEIGHBOR_INFO || evt == NULL ||
+	    evt->long_rd_id != perf.nbr_info_target) {
+		return;
+	}
+
+	perf.nbr_info.valid = (evt->status == DECT_STATUS_OK);
+	if (perf.nbr_info.valid) {
+		perf.nbr_info.num_tx_attempts = evt->status_info.num_tx_attempts;
+		perf.nbr_info.num_lbt_failures = evt->status_info.num_lbt_failures;
+		perf.nbr_info.num_harq_ack = evt->status_info.num_harq_ack;
+		perf.nbr_info.num_harq_nack = evt->status_info.num_harq_nack;
+		perf.nbr_info.num_arq_retx = evt->status_info.num_arq_retx;
+	}
+
+	k_sem_give(&perf_nbr_info_sem);
+}
+
+static void perf_nbr_stats_get(uint32_t long_rd_id, struct perf_nbr_stats *stats)
+{
+	struct dect_neighbor_info_req_params params = {
+		.long_rd_id = long_rd_id,
+	};
+
+	k_sem_reset(&perf_nbr_info_sem);
+	perf.nbr_info.valid = false;
+	perf.nbr_info_target = long_rd_id;
+
+	if (net_mgmt(NET_REQUEST_DECT_NEIGHBOR_INFO, perf.iface, &params, sizeof(params)) ||
+	    k_sem_take(&perf_nbr_info_sem, PERF_NBR_INFO_TIMEOUT)) {
+		stats->valid = false;
+		return;
+	}
+
+	*stats = perf.nbr_info;
+}
+
+static int perf_mcs_set(int mcs, int *old_mcs)
+{
+	struct dect_settings settings;
+	int ret;
+
+	ret = net_mgmt(NET_REQUEST_DECT_SETTINGS_READ, perf.iface, &settings, sizeof(settings));
+	if (ret) {
+		return ret;
+	}
+
+	if (old_mcs != NULL) {
+		*old_mcs = settings.tx.max_mcs;
+	}
+
+	settings.cmd_params.reset_to_driver_defaults = false;
+	settings.cmd_params.write_scope_bitmap = DECT_SETTINGS_WRITE_SCOPE_TX;
+	settings.tx.max_mcs = mcs;
+
+	return net_mgmt(NET_REQUEST_DECT_SETTINGS_WRITE, perf.iface, &settings, sizeof(settings));
+}
+
+static void perf_client_results_print(uint32_t tx_packets, uint32_t tx_failures,
+				      const struct perf_report *report,
+				      const struct perf_nbr_stats *before,
+				      const struct perf_nbr_stats *after)
+{
+	const struct shell *sh = perf.shell;
+
+	shell_print(sh, "perf: results to long RD ID %u, packet size %u bytes:",
+		    perf.client_params.target_long_rd_id, perf.client_params.pkt_len);
+	shell_print(sh, "  Sent packets...................%u (%u send failures)", tx_packets,
+		    tx_failures);
+
+	if (report != NULL) {
+		uint32_t kbps = report->duration_us ?
+			(uint32_t)((uint64_t)report->rx_bytes * 8 * USEC_PER_MSEC /
+				   report->duration_us) : 0;
+		uint32_t expected = report->rx_packets + report->lost_packets;
+
+		shell_print(sh, "  Received packets...............%u (%u lost, %u%%)",
+			    report->rx_packets, report->lost_packets,
+			    expected ? report->lost_packets * 100 / expected : 0);
+		shell_print(sh, "  Goodput........................%u kbps (%u bytes in %u ms)", kbps,
+			    report->rx_bytes, report->duration_us / USEC_PER_MSEC);
+	} else {
+		shell_warn(sh, "  No report received from the sink");
+	}
+
+	if (perf.rtt_cnt > 0) {
+		shell_print(sh, "  Round trip time................p%u %u ms, p%u %u ms, p%u %u ms, "
+			    "max %u ms (%u samples)",
+			    percentiles[0], perf_rtt_percentile_get(percentiles[0]),
+			    percentiles[1], perf_rtt_percentile_get(percentiles[1]),
+			    percentiles[2], perf_rtt_percentile_get(percentiles[2]),
+			    perf.rtt_max_ms, perf.rtt_cnt);
+	}
+
+	if (before->valid && after->valid) {
+		/* The modem counters are 16-bit and wrap around. */
+		uint16_t tx_attempts = after->num_tx_attempts - before->num_tx_attempts;
+		uint16_t lbt_failures = after->num_lbt_failures - before->num_lbt_failures;
+		uint16_t harq_ack = after->num_harq_ack - before->num_harq_ack;
+		uint16_t harq_nack = after->num_harq_nack - before->num_harq_nack;
+		uint16_t arq_retx = after->num_arq_retx - before->num_arq_retx;
+
+		shell_print(sh, "  HARQ...........................%u ACKs, %u NACKs (%u%%)", harq_ack,
+			    harq_nack,
+			    (harq_ack + harq_nack) ? harq_nack * 100 / (harq_ack + harq_nack) : 0);
+		shell_print(sh, "  ARQ retransmissions............%u", arq_retx);
+		shell_print(sh, "  Scheduled TX attempts..........%u, %u LBT failures (%u%%)",
+			    tx_attempts, lbt_failures,
+			    tx_attempts ? lbt_failures * 100 / tx_attempts : 0);
+		shell_print(sh, "  TX attempts per sent packet....%u.%02u",
+			    tx_packets ? tx_attempts / tx_packets : 0,
+			    tx_packets ? (tx_attempts * 100 / tx_packets) % 100 : 0);
+	} else {
+		shell_warn(sh, "  Neighbor statistics not available");
+	}
+}
+
+static void perf_client_run(void)
+{
+	const struct perf_client_params *params = &perf.client_params;
+	struct perf_nbr_stats nbr_before;
+	struct perf_nbr_stats nbr_after;
+	struct perf_report report;
+	struct sockaddr_ll dst;
+	bool report_received = false;
+	uint32_t tx_packets = 0;
+	uint32_t tx_failures = 0;
+	uint32_t seq = 0;
+	int old_mcs = -1;
+	int64_t end_time;
+	int sockfd;
+	int ret;
+
+	ret = perf_socket_open(&sockfd, &dst);
+	if (ret) {
+		shell_error(perf.shell, "perf: cannot open socket: %d", ret);
+		return;
+	}
+	perf_addr_set(&dst, params->target_long_rd_id);
+
+	if (params->mcs >= 0) {
+		ret = perf_mcs_set(params->mcs, &old_mcs);
+		if (ret) {
+			shell_error(perf.shell, "perf: cannot set MCS %d: %d", params->mcs, ret);
+			goto close;
+		}
+	}
+
+	memset(perf.rtt_hist, 0, sizeof(perf.rtt_hist));
+	perf.rtt_max_ms = 0;
+	perf.rtt_cnt = 0;
+
+	perf_nbr_stats_get(params->target_long_rd_id, &nbr_before);
+
+	/* Fill the padding once, only the header changes between packets. */
+	for (size_t i = PERF_HDR_LEN; i < params->pkt_len; i++) {
+		client_buf[i] = (uint8_t)i;
+	}
+
+	shell_print(perf.shell, "perf: sending to long RD ID %u for %u s",
+		    params->target_long_rd_id, params->duration_s);
+
+	end_time = k_uptime_get() + params->duration_s * MSEC_PER_SEC;
+	while (k_uptime_get() < end_time && !atomic_get(&perf.client_abort)) {
+		bool echo = (params->echo_every > 0) && ((seq % params->echo_every) == 0);
+
+		perf_hdr_write(client_buf, echo ? PERF_PKT_ECHO_REQ : PERF_PKT_DATA, seq,
+			       perf_now_us());
+
+		ret = zsock_sendto(sockfd, client_buf, params->pkt_len, 0,
+				   (const struct sockaddr *)&dst, sizeof(dst));
+		if (ret < 0) {
+			/* TX buffers exhausted, back off for a while. */
+			tx_failures++;
+			k_sleep(K_MSEC(1));
+		} else {
+			tx_packets++;
+			seq++;
+		}
+
+		/* Collect the echoes without blocking the source */
+		(void)perf_client_rx(sockfd, 0, &report);
+
+		if (params->interval_ms > 0) {
+			k_sleep(K_MSEC(params->interval_ms));
+		}
+	}
+
+	for (int i = 0; i < PERF_END_RETRIES && !report_received; i++) {
+		perf_hdr_write(client_buf, PERF_PKT_END, seq, perf_now_us());
+		(void)zsock_sendto(sockfd, client_buf, PERF_HDR_LEN, 0,
+				   (const struct sockaddr *)&dst, sizeof(dst));
+		report_received = perf_client_rx(sockfd, 2 * PERF_POLL_TIMEOUT_MS, &report);
+	}
+
+	perf_nbr_stats_get(params->target_long_rd_id, &nbr_after);
+
+	perf_client_results_print(tx_packets, tx_failures, report_received ? &report : NULL,
+				  &nbr_before, &nbr_after);
+
+	if (old_mcs >= 0) {
+		(void)perf_mcs_set(old_mcs, NULL);
+	}
+
+close:
+	zsock_close(sockfd);
+}
+
+static void perf_client_thread_fn(void)
+{
+	while (true) {
+		k_sem_take(&perf_client_sem, K_FOREVER);
+
+		perf_client_run();
+		perf.client_running = false;
+	}
+}
+
+K_THREAD_DEFINE(dect_shell_perf_client_thread, CONFIG_DECT_L2_SHELL_PERF_THREAD_STACK_SIZE,
+		perf_client_thread_fn, NULL, NULL, NULL, 5, 0, 0);
+
+/* Shell commands */
+
+static const char dect_shell_perf_client_usage_str[] =
+	"Usage: dect perf client <options>\n\n"
+	"Options:\n"
+	"  -t  --target <int>          Target long RD ID of the sink.\n"
+	"  -l  --length <int>          Packet size in bytes. Default: DECT_MTU.\n"
+	"  -d  --duration <secs>       Duration of the measurement. Default: 10.\n"
+	"  -m  --mcs <int>             Max MCS used during the measurement [0, 4].\n"
+	"                              Default: as in settings.\n"
+	"  -i  --interval <msecs>      Interval between packets. Default: 0 (as fast as\n"
+	"                              possible).\n"
+	"  -e  --echo_every <int>      Request an echo for the round trip time for every\n"
+	"                              nth packet. 0 to disable. Default: 10.\n";
+
+static struct sys_getopt_option long_options_perf_client[] = {
+	{"target", sys_getopt_required_argument, 0, 't'},
+	{"length", sys_getopt_required_argument, 0, 'l'},
+	{"duration", sys_getopt_required_argument, 0, 'd'},
+	{"mcs", sys_getopt_required_argument, 0, 'm'},
+	{"interval", sys_getopt_required_argument, 0, 'i'},
+	{"echo_every", sys_getopt_required_argument, 0, 'e'},
+	{0, 0, 0, 0}
+};
+
+static int dect_shell_perf_server_cmd(const struct shell *shell, size_t argc, char **argv)
+{
+	struct sockaddr_ll sa;
+	int ret;
+
+	perf.shell = shell;
+
+	if (!strcmp(argv[1], "stop")) {
+		if (perf.server_sockfd >= 0) {
+			zsock_close(perf.server_sockfd);
+			perf.server_sockfd = -1;
+		}
+		perf.server_active = false;
+		k_sem_reset(&perf_server_sem);
+		shell_print(shell, "perf: sink stopped");
+		return 0;
+	}
+
+	if (strcmp(argv[1], "start")) {
+		shell_print(shell, "Usage: dect perf server start | stop");
+		return -EINVAL;
+	}
+
+	if (perf.server_sockfd >= 0) {
+		shell_error(shell, "perf: sink already started");
+		return -EALREADY;
+	}
+
+	ret = perf_socket_open(&perf.server_sockfd, &sa);
+	if (ret) {
+		shell_error(shell, "perf: cannot open socket: %d", ret);
+		return ret;
+	}
+
+	perf.server_active = false;
+	shell_print(shell, "perf: sink started");
+	k_sem_give(&perf_server_sem);
+
+	return 0;
+}
+
+static int dect_shell_perf_client_cmd(const struct shell *shell, size_t argc, char **argv)
+{
+	struct perf_client_params params = {
+		.duration_s = 10,
+		.pkt_len = DECT_MTU,
+		.echo_every = 10,
+		.mcs = -1,
+	};
+	int long_index = 0;
+	int opt;
+	int ret = 0;
+
+	perf.shell = shell;
+
+	if (perf.client_running) {
+		shell_error(shell, "perf: measurement already running");
+		return -EBUSY;
+	}
+
+	sys_getopt_init();
+
+	while ((opt = sys_getopt_long(argc, argv, "t:l:d:m:i:e:h", long_options_perf_client,
+				      &long_index)) != -1) {
+		unsigned long value = 0;
+
+		if (opt != 'h' && opt != '?') {
+			value = shell_strtoul(sys_getopt_optarg, 10, &ret);
+			if (ret) {
+				shell_error(shell, "Invalid value: %s", sys_getopt_optarg);
+				return -EINVAL;
+			}
+		}
+
+		switch (opt) {
+		case 't':
+			params.target_long_rd_id = value;
+			break;
+		case 'l':
+			if (value < PERF_HDR_LEN || value > DECT_MTU) {
+				shell_error(shell, "Packet size range: %zu-%d", PERF_HDR_LEN,
+					    DECT_MTU);
+				return -EINVAL;
+			}
+			params.pkt_len = value;
+			break;
+		case 'd':
+			params.duration_s = value;
+			break;
+		case 'm':
+			if (value > 4) {
+				shell_error(shell, "Give decent value (range: 0-4)");
+				return -EINVAL;
+			}
+			params.mcs = value;
+			break;
+		case 'i':
+			params.interval_ms = value;
+			break;
+		case 'e':
+			params.echo_every = MIN(value, UINT16_MAX);
+			break;
+		case 'h':
+			goto show_usage;
+		case '?':
+		default:
+			shell_error(shell, "Unknown option (%s). See usage:",
+				    argv[sys_getopt_optind - 1]);
+			goto show_usage;
+		}
+	}
+
+	if (params.target_long_rd_id == 0 || params.duration_s == 0) {
+		shell_error(shell, "Target long RD ID and duration need to be given. See usage:");
+		goto show_usage;
+	}
+
+	perf.client_params = params;
+	perf.client_running = true;
+	atomic_set(&perf.client_abort, 0);
+	k_sem_give(&perf_client_sem);
+
+	return 0;
+
+show_usage:
+	shell_print(shell, "%s", dect_shell_perf_client_usage_str);
+	return 0;
+}
+
+static int dect_shell_perf_stop_cmd(const struct shell *shell, size_t argc, char **argv)
+{
+	if (!perf.client_running) {
+		shell_print(shell, "perf: no measurement running");
+		return 0;
+	}
+
+	atomic_set(&perf.client_abort, 1);
+	shell_print(shell, "perf: stopping measurement");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(dect_perf_commands,
+	SHELL_CMD_ARG(server, NULL,
+		      "Start or stop the sink of the measurement traffic.\n"
+		      " Usage: dect perf server start | stop",
+		      dect_shell_perf_server_cmd, 2, 0),
+	SHELL_CMD_ARG(client, NULL,
+		      "Send measurement traffic to the sink and print the results.\n"
+		      "[-h, --help] : Print out the help for the client command.\n",
+		      dect_shell_perf_client_cmd, 1, 12),
+	SHELL_CMD_ARG(stop, NULL,
+		      "Stop the running measurement.\n"
+		      " Usage: dect perf stop",
+		      dect_shell_perf_stop_cmd, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((dect), perf, &dect_perf_commands,
+		 "Measure DLC throughput and latency between two devices.\n"
+		 " Usage: dect perf server | client | stop",
+		 NULL, 2, 0);
+
+static int dect_shell_perf_init(void)
+{
+	net_mgmt_init_event_callback(&perf_mgmt_cb, perf_mgmt_event_handler,
+				     NET_EVENT_DECT_NEIGHBOR_INFO);
+	net_mgmt_add_event_callback(&perf_mgmt_cb);
+
+	return 0;
+}
+
+SYS_INIT(dect_shell_perf_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -35,6 +35,19 @@ LOG_MODULE_DECLARE(downloader, CONFIG_DOWNLOADER_LOG_LEVEL);
 #define COAP "coap://"
 #define COAPS "coaps://"
 
+#define COAP_WINDOW_SIZE CONFIG_DOWNLOADER_TRANSPORT_COAP_WINDOW_SIZE
+
+/* Room for the CoAP header and options of a response, in addition to the payload. */
+#define COAP_RESPONSE_OVERHEAD 64
+
+/** Block request in flight. */
+struct coap_block_req {
+	/** CoAP pending object. */
+	struct coap_pending pending;
+	/** Offset of the requested block. */
+	size_t offset;
+};
+
 struct transport_params_coap {
 	/** Flag whether config is set */
 	bool cfg_set;
@@ -44,8 +57,10 @@ struct transport_params_coap {
 	bool initialized;
 	/** CoAP block context. */
 	struct coap_block_context block_ctx;
-	/** CoAP pending object. */
-	struct coap_pending pending;
+	/** Block requests in flight, in block order. The first one is for the expected block. */
+	struct coap_block_req req[COAP_WINDOW_SIZE];
+	/** Number of block requests in flight. */
+	uint8_t req_count;
 
 	struct {
 		/** Socket descriptor. */
@@ -72,7 +87,7 @@ struct transport_params_coap {
 
 BUILD_ASSERT(CONFIG_DOWNLOADER_TRANSPORT_PARAMS_SIZE >= sizeof(struct transport_params_coap));
 
-static int coap_request_send(struct downloader *dl);
+static int coap_request_send(struct downloader *dl, struct coap_block_req *req);
 
 static int coap_get_current_from_response_pkt(const struct coap_packet *cpkt)
 {
@@ -91,18 +106,74 @@ static bool has_pending(struct downloader *dl)
 	struct transport_params_coap *coap;
 
 	coap = (struct transport_params_coap *)dl->transport_internal;
-	return coap->pending.timeout > 0;
+	return coap->req_count > 0 && coap->req[0].pending.timeout > 0;
+}
+
+static int32_t coap_req_timeout_left(const struct coap_block_req *req)
+{
+	return req->pending.t0 + req->pending.timeout - k_uptime_get_32();
+}
+
+/* Request in flight whose retransmission timeout expires first. */
+static struct coap_block_req *coap_req_next_timeout(struct transport_params_coap *coap)
+{
+	struct coap_block_req *next = &coap->req[0];
+
+	for (int i = 1; i < coap->req_count; i++) {
+		if (coap_req_timeout_left(&coap->req[i]) < coap_req_timeout_left(next)) {
+			next = &coap->req[i];
+		}
+	}
+
+	return next;
+}
+
+static struct coap_block_req *coap_req_find(struct transport_params_coap *coap, uint16_t id)
+{
+	for (int i = 0; i < coap->req_count; i++) {
+		if (coap->req[i].pending.id == id) {
+			return &coap->req[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Remove the request for the expected block, once its response is processed. */
+static void coap_req_head_remove(struct transport_params_coap *coap)
+{
+	coap->req_count--;
+	memmove(&coap->req[0], &coap->req[1], coap->req_count * sizeof(coap->req[0]));
 }
 
 int coap_block_init(struct downloader *dl, size_t from)
 {
 	struct transport_params_coap *coap;
+	enum coap_block_size block_size;
 
 	coap = (struct transport_params_coap *)dl->transport_internal;
 
-	coap_block_transfer_init(&coap->block_ctx, coap->cfg.block_size, 0);
+	/* Use the largest block size up to the configured one, for which a response fits the
+	 * buffer. The server can negotiate a smaller block size in its first response.
+	 */
+	block_size = coap->cfg.block_size;
+	while (block_size > COAP_BLOCK_16 &&
+	       coap_block_size_to_bytes(block_size) + COAP_RESPONSE_OVERHEAD > dl->cfg.buf_size) {
+		block_size--;
+	}
+
+	if (block_size != coap->cfg.block_size) {
+		LOG_WRN("Buffer too small for block size, using %d bytes",
+			coap_block_size_to_bytes(block_size));
+	}
+
+	coap_block_transfer_init(&coap->block_ctx, block_size, 0);
 	coap->block_ctx.current = from;
-	coap_pending_clear(&coap->pending);
+
+	for (int i = 0; i < coap->req_count; i++) {
+		coap_pending_clear(&coap->req[i].pending);
+	}
+	coap->req_count = 0;
 
 	coap->initialized = true;
 	return 0;
@@ -111,6 +182,7 @@ int coap_block_init(struct downloader *dl, size_t from)
 static int coap_get_recv_timeout(struct downloader *dl, uint32_t *timeout)
 {
 	int timeo;
+	struct coap_block_req *req;
 	struct transport_params_coap *coap;
 
 	coap = (struct transport_params_coap *)dl->transport_internal;
@@ -121,8 +193,14 @@ static int coap_get_recv_timeout(struct downloader *dl, uint32_t *timeout)
 	 * blocks, the time that is used for sending request must be substracted next time
 	 * recv() is called.
 	 */
-	timeo = coap->pending.t0 + coap->pending.timeout - k_uptime_get_32();
+	req = coap_req_next_timeout(coap);
+	timeo = coap_req_timeout_left(req);
 	if (timeo < 0) {
+		if (req != &coap->req[0]) {
+			/* Retransmit the look-ahead request before receiving */
+			return -EAGAIN;
+		}
+
 		/* All time is spent when sending request and time this
 		 * method is called, there is no time left for receiving;
 		 * skip over recv() and initiate retransmission on next
@@ -135,23 +213,20 @@ static int coap_get_recv_timeout(struct downloader *dl, uint32_t *timeout)
 	return 0;
 }
 
-int coap_initiate_retransmission(struct downloader *dl)
+static int coap_req_retransmit(struct downloader *dl, struct coap_block_req *req)
 {
-	struct transport_params_coap *coap;
 	int ret;
 
-	coap = (struct transport_params_coap *)dl->transport_internal;
-
-	if (coap->pending.timeout == 0) {
+	if (req->pending.timeout == 0) {
 		return -EINVAL;
 	}
 
-	if (!coap_pending_cycle(&coap->pending)) {
+	if (!coap_pending_cycle(&req->pending)) {
 		LOG_ERR("CoAP max-retransmissions exceeded");
 		return -1;
 	}
 
-	ret = coap_request_send(dl);
+	ret = coap_request_send(dl, req);
 	if (ret) {
 		LOG_DBG("coap_request_send failed, err %d", ret);
 		return -ECONNRESET;
@@ -160,6 +235,80 @@ int coap_initiate_retransmission(struct downloader *dl)
 	return 0;
 }
 
+int coap_initiate_retransmission(struct downloader *dl)
+{
+	struct transport_params_coap *coap;
+	struct coap_block_req *next;
+	int ret;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	if (coap->req_count == 0) {
+		return -EINVAL;
+	}
+
+	next = coap_req_next_timeout(coap);
+
+	ret = coap_req_retransmit(dl, next);
+	if (ret) {
+		return ret;
+	}
+
+	/* Requests sent in the same window are likely to have timed out as well */
+	for (int i = 0; i < coap->req_count; i++) {
+		if (&coap->req[i] == next || coap_req_timeout_left(&coap->req[i]) > 0) {
+			continue;
+		}
+
+		ret = coap_req_retransmit(dl, &coap->req[i]);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/* Request the expected block, and the blocks after it up to the window size
+ * when the size of the file is known.
+ */
+static int coap_window_fill(struct downloader *dl)
+{
+	int err;
+	size_t offset;
+	struct coap_block_req *req;
+	struct transport_params_coap *coap;
+
+	coap = (struct transport_params_coap *)dl->transport_internal;
+
+	while (coap->req_count < COAP_WINDOW_SIZE) {
+		if (coap->req_count == 0) {
+			offset = coap->block_ctx.current;
+		} else {
+			offset = coap->req[coap->req_count - 1].offset +
+				 coap_block_size_to_bytes(coap->block_ctx.block_size);
+
+			if (dl->file_size == 0 || offset >= dl->file_size) {
+				break;
+			}
+		}
+
+		req = &coap->req[coap->req_count];
+		*req = (struct coap_block_req){
+			.offset = offset,
+		};
+
+		err = coap_request_send(dl, req);
+		if (err) {
+			return err;
+		}
+
+		coap->req_count++;
+	}
+
+	return 0;
+}
+
 static int coap_block_update(struct downloader *dl, struct coap_packet *pkt, size_t *blk_off,
 			     bool *more)
 {
@@ -214,6 +363,8 @@ static int coap_parse(struct downloader *dl, size_t len)
 	uint16_t payload_len;
 	const uint8_t *payload;
 	struct coap_packet response;
+	struct coap_block_req *req;
+	enum coap_block_size block_size;
 	bool more;
 	struct transport_params_coap *coap;
 
@@ -229,12 +380,23 @@ static int coap_parse(struct downloader *dl, size_t len)
 		return -EBADMSG;
 	}
 
-	if (coap_header_get_id(&response) != coap->pending.id) {
-		LOG_ERR("Response is not pending");
-		return -EBADMSG;
+	req = coap_req_find(coap, coap_header_get_id(&response));
+	if (!req) {
+		/* Duplicate, or response to a request that is no longer in flight */
+		LOG_WRN("Response is not pending, ignoring");
+		return 1;
+	}
+
+	if (req != &coap->req[0]) {
+		/* Blocks are delivered in order, the look-ahead block is requested again
+		 * when its retransmission timeout expires.
+		 */
+		LOG_DBG("Block %d received before block %d, ignoring", req->offset,
+			coap->block_ctx.current);
+		return 1;
 	}
 
-	coap_pending_clear(&coap->pending);
+	coap_pending_clear(&req->pending);
 
 	if (coap_header_get_type(&response) != COAP_TYPE_ACK) {
 		LOG_ERR("Response must be of coap type ACK");
@@ -247,17 +409,32 @@ static int coap_parse(struct downloader *dl, size_t len)
 		return -EBADMSG;
 	}
 
+	block_size = coap->block_ctx.block_size;
+
 	err = coap_block_update(dl, &response, &blk_off, &more);
 	if (err) {
 		return -EBADMSG;
 	}
 
+	if (coap->block_ctx.block_size != block_size) {
+		LOG_INF("Server negotiated block size %d bytes",
+			coap_block_size_to_bytes(coap->block_ctx.block_size));
+
+		/* The look-ahead blocks were requested with the previous block size */
+		for (int i = 1; i < coap->req_count; i++) {
+			coap_pending_clear(&coap->req[i].pending);
+		}
+		coap->req_count = 1;
+	}
+
 	payload = coap_packet_get_payload(&response, &payload_len);
 	if (!payload) {
 		LOG_WRN("No CoAP payload!");
 		return -EBADMSG;
 	}
 
+	coap_req_head_remove(coap);
+
 	/* Accumulate buffer offset */
 	dl->progress += payload_len;
 	dl->buf_offset = 0;
@@ -273,7 +450,7 @@ static int coap_parse(struct downloader *dl, size_t len)
 	return 0;
 }
 
-static int coap_request_send(struct downloader *dl)
+static int coap_request_send(struct downloader *dl, struct coap_block_req *req)
 {
 	int err;
 	uint16_t id;
@@ -281,12 +458,14 @@ static int coap_request_send(struct downloader *dl)
 	char *path_elem;
 	char *path_elem_saveptr;
 	struct coap_packet request;
+	struct coap_block_context block_ctx;
 	struct transport_params_coap *coap;
 
 	coap = (struct transport_params_coap *)dl->transport_internal;
 
-	if (has_pending(dl)) {
-		id = coap->pending.id;
+	if (req->pending.timeout > 0) {
+		/* Retransmission */
+		id = req->pending.id;
 	} else {
 		id = coap_next_id();
 	}
@@ -311,13 +490,16 @@ static int coap_request_send(struct downloader *dl)
 		}
 	} while ((path_elem = strtok_r(NULL, COAP_PATH_ELEM_DELIM, &path_elem_saveptr)));
 
-	err = coap_append_block2_option(&request, &coap->block_ctx);
+	block_ctx = coap->block_ctx;
+	block_ctx.current = req->offset;
+
+	err = coap_append_block2_option(&request, &block_ctx);
 	if (err) {
 		LOG_ERR("Unable to add block2 option");
 		return err;
 	}
 
-	err = coap_append_size2_option(&request, &coap->block_ctx);
+	err = coap_append_size2_option(&request, &block_ctx);
 	if (err) {
 		LOG_ERR("Unable to add size2 option");
 		return err;
@@ -332,21 +514,21 @@ static int coap_request_send(struct downloader *dl)
 		}
 	}
 
-	if (!has_pending(dl)) {
+	if (req->pending.timeout == 0) {
 		struct coap_transmission_parameters params = coap_get_transmission_parameters();
 
 		params.max_retransmission = coap->cfg.max_retransmission;
-		err = coap_pending_init(&coap->pending, &request, &coap->sock.remote_addr, &params);
+		err = coap_pending_init(&req->pending, &request, &coap->sock.remote_addr, &params);
 		if (err < 0) {
 			return -EINVAL;
 		}
 
-		coap_pending_cycle(&coap->pending);
+		coap_pending_cycle(&req->pending);
 	}
 
-	LOG_DBG("CoAP next block: %d", coap->block_ctx.current);
+	LOG_DBG("CoAP next block: %d", req->offset);
 
-	err = dl_socket_send_timeout_set(coap->sock.fd, coap->pending.timeout);
+	err = dl_socket_send_timeout_set(coap->sock.fd, req->pending.timeout);
 	if (err) {
 		return err;
 	}
@@ -508,7 +690,7 @@ static int dl_coap_download(struct downloader *dl)
 	if (coap->new_data_req) {
 		/* Request next fragment */
 		dl->buf_offset = 0;
-		ret = coap_request_send(dl);
+		ret = coap_window_fill(dl);
 		if (ret) {
 			LOG_DBG("data_req failed, err %d", ret);
 			/** Attempt reconnection. */
@@ -536,7 +718,10 @@ static int dl_coap_download(struct downloader *dl)
 		(void *)(dl->cfg.buf + dl->buf_offset));
 
 	ret = coap_get_recv_timeout(dl, &timeout);
-	if (ret) {
+	if (ret == -EAGAIN) {
+		coap->retransmission_req = true;
+		return 0;
+	} else if (ret) {
 		LOG_DBG("CoAP timeout");
 		return -ETIMEDOUT;
 	}
@@ -565,6 +750,9 @@ static int dl_coap_download(struct downloader *dl)
 		/* Request data again */
 		coap->retransmission_req = true;
 		return 0;
+	} else if (ret > 0) {
+		/* Response ignored, keep receiving */
+		return 0;
 	}
 
 	if (dl->progress == dl->file_size) {
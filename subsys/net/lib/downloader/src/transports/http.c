@@ -80,6 +80,12 @@ struct transport_params_http {
 	bool ranged;
 	/** Ranged progress */
 	size_t ranged_progress;
+	/** Offset of the next range request */
+	size_t request_offset;
+	/** Range requests sent, whose response has not been fully received */
+	uint8_t requests_pending;
+	/** The buffer holds the start of the next pipelined response */
+	bool buffered;
 	/** HTTP header */
 	struct {
 		/** Header length */
@@ -154,8 +160,6 @@ static int http_get_request_send(struct downloader *dl)
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
-	http->header.has_end = false;
-
 	/* nRF91 series has a limitation of decoding ~2k of data at once when using TLS */
 	tls_force_range = (http->sock.proto == NET_IPPROTO_TLS_1_2 &&
 			   !dl->host_cfg.set_native_tls && IS_ENABLED(CONFIG_SOC_SERIES_NRF91));
@@ -169,7 +173,7 @@ static int http_get_request_send(struct downloader *dl)
 	}
 
 	if (dl->host_cfg.range_override) {
-		off = dl->progress + dl->host_cfg.range_override - 1;
+		off = http->request_offset + dl->host_cfg.range_override - 1;
 
 		if (dl->file_size) {
 			/* Don't request bytes past the end of file */
@@ -177,9 +181,10 @@ static int http_get_request_send(struct downloader *dl)
 		}
 
 		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_RANGE, dl->file,
-			       dl->hostname, dl->progress, off);
+			       dl->hostname, http->request_offset, off);
 		http->ranged = true;
-		http->ranged_progress = 0;
+		http->request_offset = off + 1;
+		http->requests_pending++;
 		LOG_DBG("Range request up to %d bytes", dl->host_cfg.range_override);
 		goto send;
 	} else if (dl->progress) {
@@ -213,6 +218,47 @@ send:
 	return 0;
 }
 
+/* Send range requests ahead of the response being received, up to the pipeline depth.
+ * The responses are received in the order of the requests over the same connection.
+ */
+static int http_range_requests_send(struct downloader *dl)
+{
+	int err;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	while (http->requests_pending < CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH &&
+	       http->request_offset < dl->file_size) {
+		err = http_get_request_send(dl);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+/* Length of the ranged response being received. */
+static size_t http_fragment_len(struct downloader *dl)
+{
+	size_t fragment_start;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	fragment_start = dl->progress - http->ranged_progress;
+
+	return MIN(dl->host_cfg.range_override, dl->file_size - fragment_start);
+}
+
+static void http_response_reset(struct transport_params_http *http)
+{
+	http->header.has_end = false;
+	http->header.status_code = 0;
+	http->ranged_progress = 0;
+}
+
 /* Returns:
  * Number of bytes parsed on success.
  * Negative errno on error.
@@ -609,6 +655,9 @@ static int dl_http_close(struct downloader *dl)
 static int dl_http_download(struct downloader *dl)
 {
 	int ret, recv_len, data_len, expected_len;
+	size_t fragment_left;
+	size_t next_len = 0;
+	bool closed;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
@@ -616,6 +665,10 @@ static int dl_http_download(struct downloader *dl)
 	if (http->new_data_req) {
 		/* Request next fragment */
 		dl->buf_offset = 0;
+		http->buffered = false;
+		http->requests_pending = 0;
+		http->request_offset = dl->progress;
+		http_response_reset(http);
 		ret = http_get_request_send(dl);
 		if (ret) {
 			LOG_DBG("data_req failed, err %d", ret);
@@ -626,13 +679,31 @@ static int dl_http_download(struct downloader *dl)
 		http->new_data_req = false;
 	}
 
+	if (http->ranged && dl->buf_offset == 0) {
+		/* The buffer is free to hold the requests */
+		ret = http_range_requests_send(dl);
+		if (ret) {
+			LOG_DBG("data_req failed, err %d", ret);
+			/** Attempt reconnection. */
+			return -ECONNRESET;
+		}
+	}
+
 	__ASSERT(dl->buf_offset < dl->cfg.buf_size, "Buffer overflow");
 
-	LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
-		(void *)(dl->cfg.buf + dl->buf_offset));
+	if (http->buffered) {
+		/* Parse the pipelined response received along with the previous one */
+		http->buffered = false;
+		recv_len = 0;
+		closed = false;
+	} else {
+		LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
+			(void *)(dl->cfg.buf + dl->buf_offset));
 
-	recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
-			     dl->cfg.buf_size - dl->buf_offset);
+		recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
+					  dl->cfg.buf_size - dl->buf_offset);
+		closed = (recv_len == 0);
+	}
 
 	if (recv_len < 0) {
 		if (recv_len == -EMSGSIZE && dl->host_cfg.range_override) {
@@ -662,11 +733,22 @@ static int dl_http_download(struct downloader *dl)
 
 	expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, dl->file_size - dl->progress);
 
+	if (http->ranged && data_len) {
+		fragment_left = http_fragment_len(dl) - http->ranged_progress;
+		expected_len = MIN(expected_len, fragment_left);
+
+		if (data_len > fragment_left) {
+			/* The rest of the data belongs to the next pipelined response */
+			next_len = data_len - fragment_left;
+			data_len = fragment_left;
+		}
+	}
+
 	if (data_len < expected_len) {
 		/* Wait for more data after the HTTP headers,
 		 * so we don't end up forwarding too small chunks to FOTA library.
 		 */
-		return recv_len > 0 ? 0 : -ECONNRESET; /* Fail if closed while expecting more */
+		return closed ? -ECONNRESET : 0; /* Fail if closed while expecting more */
 	}
 
 	/* Accumulate progress */
@@ -676,11 +758,12 @@ static int dl_http_download(struct downloader *dl)
 	}
 	if (http->ranged) {
 		http->ranged_progress += data_len;
-		if (http->ranged_progress < dl->host_cfg.range_override) {
-			/* Ranged query: read until a full fragment is received */
-		} else {
-			/* Ranged query: request next fragment */
-			http->new_data_req = true;
+		if (http->ranged_progress >= http_fragment_len(dl)) {
+			/* Ranged query: full fragment received, the next one is already requested
+			 * or is requested before receiving.
+			 */
+			http->requests_pending--;
+			http_response_reset(http);
 		}
 	}
 	if (dl->progress == dl->file_size) {
@@ -690,11 +773,19 @@ static int dl_http_download(struct downloader *dl)
 	}
 	dl->buf_offset = 0;
 
+	if (next_len && http->requests_pending && !dl->complete) {
+		memmove(dl->cfg.buf, dl->cfg.buf + data_len, next_len);
+		dl->buf_offset = next_len;
+		http->buffered = true;
+	} else if (next_len) {
+		LOG_WRN("Dropping %d bytes received past the requested range", next_len);
+	}
+
 	if (dl->complete) {
 		return 0;
 	}
 	/* Continue reading, unless connection is closed */
-	return recv_len > 0 ? 0 : -ECONNRESET;
+	return closed ? -ECONNRESET : 0;
 }
 
 static const struct dl_transport dl_transport_http = {
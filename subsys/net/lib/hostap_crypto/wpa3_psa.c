@@ -35,6 +35,7 @@
 #define WPA3_PSA_SAE_COMMIT_PSA_LEN  96
 #define WPA3_PSA_SAE_GROUP_19        19
 #define WPA3_PSA_MAX_PT_PASSWORD_MAP 8
+#define WPA3_PSA_PT_CACHE_SIZE       CONFIG_HOSTAP_CRYPTO_WPA3_PSA_PT_CACHE_SIZE
 
 /* Password storage for PT-based operations */
 struct wpa3_psa_pt_password {
@@ -48,6 +49,21 @@ struct wpa3_psa_pt_password {
 static struct wpa3_psa_pt_password pt_password_map[WPA3_PSA_MAX_PT_PASSWORD_MAP];
 static int pt_password_map_count;
 
+#if WPA3_PSA_PT_CACHE_SIZE > 0
+/* H2E PT keys derived for earlier connections, reused when roaming between APs of an SSID */
+struct wpa3_psa_pt_cache_entry {
+	psa_key_id_t key;
+	psa_algorithm_t pake_alg;
+	int group;
+	u8 ssid[32];
+	size_t ssid_len;
+	u8 password_hash[SHA256_MAC_LEN];
+};
+
+static struct wpa3_psa_pt_cache_entry pt_cache[WPA3_PSA_PT_CACHE_SIZE];
+static int pt_cache_next;
+#endif
+
 /* Setup operation parameters */
 struct wpa3_psa_setup_params {
 	const u8 *addr1;
@@ -66,6 +82,7 @@ struct wpa3_psa_operation {
 	psa_pake_operation_t pake_op;
 	psa_pake_cipher_suite_t cipher_suite;
 	psa_key_id_t password_key;
+	bool password_key_cached; /* password_key is owned by the PT cache */
 	enum sae_state state;
 	u8 own_addr[ETH_ALEN];
 	u8 peer_addr[ETH_ALEN];
@@ -103,6 +120,7 @@ static int wpa3_psa_process_confirm(struct wpa3_psa_operation *op, const u8 *con
 				    size_t confirm_len);
 static int wpa3_psa_derive_keys(struct wpa3_psa_operation *op);
 static void wpa3_psa_cleanup_operation(struct wpa3_psa_operation *op);
+static void wpa3_psa_release_password_key(struct wpa3_psa_operation *op);
 static struct sae_pt *wpa3_psa_derive_pt_group(int group, const u8 *ssid, size_t ssid_len,
 					       const u8 *password, size_t password_len,
 					       const char *identifier);
@@ -828,6 +846,11 @@ void sae_deinit_pt(struct sae_pt *pt)
 		}
 	}
 
+#if WPA3_PSA_PT_CACHE_SIZE > 0
+	/* The network configuration changed, the cached PT keys may be outdated */
+	wpa3_psa_pt_cache_flush();
+#endif
+
 	/* Free PT structure */
 	os_free(pt);
 }
@@ -1082,6 +1105,107 @@ static struct sae_pt *wpa3_psa_derive_pt_group(int group, const u8 *ssid, size_t
 	return pt;
 }
 
+#if WPA3_PSA_PT_CACHE_SIZE > 0
+static int wpa3_psa_pt_cache_hash_password(const struct wpa3_psa_setup_params *params,
+					   u8 *hash)
+{
+	size_t hash_len;
+	psa_status_t status;
+
+	status = psa_hash_compute(PSA_ALG_SHA_256, params->password, params->password_len, hash,
+				  SHA256_MAC_LEN, &hash_len);
+
+	return status == PSA_SUCCESS ? 0 : -1;
+}
+
+/**
+ * wpa3_psa_pt_cache_get - Look up a PT key derived for the same network
+ * @params: Setup parameters
+ * @pake_alg: PAKE algorithm the PT key is used with
+ * @key: Cached PT key
+ *
+ * Returns: 0 if a PT key was found, -1 otherwise
+ */
+static int wpa3_psa_pt_cache_get(const struct wpa3_psa_setup_params *params,
+				 psa_algorithm_t pake_alg, psa_key_id_t *key)
+{
+	u8 password_hash[SHA256_MAC_LEN];
+	int res = -1;
+	int i;
+
+	if (wpa3_psa_pt_cache_hash_password(params, password_hash) < 0) {
+		return -1;
+	}
+
+	for (i = 0; i < WPA3_PSA_PT_CACHE_SIZE; i++) {
+		struct wpa3_psa_pt_cache_entry *entry = &pt_cache[i];
+
+		if (entry->key != PSA_KEY_ID_NULL && entry->pake_alg == pake_alg &&
+		    entry->group == params->group && entry->ssid_len == params->ssid_len &&
+		    os_memcmp(entry->ssid, params->ssid, params->ssid_len) == 0 &&
+		    os_memcmp_const(entry->password_hash, password_hash,
+				    SHA256_MAC_LEN) == 0) {
+			*key = entry->key;
+			res = 0;
+			break;
+		}
+	}
+
+	forced_memzero(password_hash, sizeof(password_hash));
+	return res;
+}
+
+/**
+ * wpa3_psa_pt_cache_add - Store a derived PT key, replacing the oldest entry
+ * @params: Setup parameters
+ * @pake_alg: PAKE algorithm the PT key is used with
+ * @key: PT key, owned by the cache on success
+ *
+ * Returns: 0 on success, -1 on failure
+ */
+static int wpa3_psa_pt_cache_add(const struct wpa3_psa_setup_params *params,
+				 psa_algorithm_t pake_alg, psa_key_id_t key)
+{
+	struct wpa3_psa_pt_cache_entry *entry = &pt_cache[pt_cache_next];
+	u8 password_hash[SHA256_MAC_LEN];
+
+	if (params->ssid_len > sizeof(entry->ssid) ||
+	    wpa3_psa_pt_cache_hash_password(params, password_hash) < 0) {
+		return -1;
+	}
+
+	if (entry->key != PSA_KEY_ID_NULL) {
+		psa_destroy_key(entry->key);
+	}
+
+	entry->key = key;
+	entry->pake_alg = pake_alg;
+	entry->group = params->group;
+	os_memcpy(entry->ssid, params->ssid, params->ssid_len);
+	entry->ssid_len = params->ssid_len;
+	os_memcpy(entry->password_hash, password_hash, SHA256_MAC_LEN);
+	forced_memzero(password_hash, sizeof(password_hash));
+
+	pt_cache_next = (pt_cache_next + 1) % WPA3_PSA_PT_CACHE_SIZE;
+	return 0;
+}
+
+/* Destroy all cached PT keys */
+static void wpa3_psa_pt_cache_flush(void)
+{
+	int i;
+
+	for (i = 0; i < WPA3_PSA_PT_CACHE_SIZE; i++) {
+		if (pt_cache[i].key != PSA_KEY_ID_NULL) {
+			psa_destroy_key(pt_cache[i].key);
+		}
+	}
+
+	forced_memzero(pt_cache, sizeof(pt_cache));
+	pt_cache_next = 0;
+}
+#endif /* WPA3_PSA_PT_CACHE_SIZE > 0 */
+
 /**
  * wpa3_psa_setup_operation - Setup PSA operation
  * @op: PSA operation structure
@@ -1172,6 +1296,13 @@ static int wpa3_psa_setup_operation(struct wpa3_psa_operation *op,
 
 	/* For H2E, derive PT from password and use PT as key */
 	/* For HnP, use raw password as key */
+#if WPA3_PSA_PT_CACHE_SIZE > 0
+	if (params->h2e && params->ssid_len > 0 &&
+	    wpa3_psa_pt_cache_get(params, pake_alg, &op->password_key) == 0) {
+		op->password_key_cached = true;
+		wpa_printf(MSG_DEBUG, "WPA3-PSA: H2E mode - using cached PT key");
+	} else
+#endif
 	if (params->h2e) {
 		psa_key_derivation_operation_t kdf = PSA_KEY_DERIVATION_OPERATION_INIT;
 		psa_key_attributes_t pw_attr = PSA_KEY_ATTRIBUTES_INIT;
@@ -1254,6 +1385,12 @@ static int wpa3_psa_setup_operation(struct wpa3_psa_operation *op,
 			return -1;
 		}
 		wpa_printf(MSG_DEBUG, "WPA3-PSA: PT key derived successfully for H2E");
+
+#if WPA3_PSA_PT_CACHE_SIZE > 0
+		if (wpa3_psa_pt_cache_add(params, pake_alg, op->password_key) == 0) {
+			op->password_key_cached = true;
+		}
+#endif
 	} else {
 		/* For HnP, use raw password */
 		psa_set_key_type(&attributes, PSA_KEY_TYPE_PASSWORD);
@@ -1291,7 +1428,7 @@ static int wpa3_psa_setup_operation(struct wpa3_psa_operation *op,
 			wpa_printf(MSG_ERROR,
 				   "WPA3-PSA: Key policy does not permit PAKE (set key algorithm).");
 		}
-		psa_destroy_key(op->password_key);
+		wpa3_psa_release_password_key(op);
 		return -1;
 	}
 
@@ -1303,7 +1440,7 @@ static int wpa3_psa_setup_operation(struct wpa3_psa_operation *op,
 	status = psa_pake_set_user(&op->pake_op, op->own_addr, ETH_ALEN);
 	if (status != PSA_SUCCESS) {
 		wpa_printf(MSG_ERROR, "WPA3-PSA: Failed to set user: %d", status);
-		psa_destroy_key(op->password_key);
+		wpa3_psa_release_password_key(op);
 		return -1;
 	}
 
@@ -1314,7 +1451,7 @@ static int wpa3_psa_setup_operation(struct wpa3_psa_operation *op,
 	status = psa_pake_set_peer(&op->pake_op, op->peer_addr, ETH_ALEN);
 	if (status != PSA_SUCCESS) {
 		wpa_printf(MSG_ERROR, "WPA3-PSA: Failed to set peer: %d", status);
-		psa_destroy_key(op->password_key);
+		wpa3_psa_release_password_key(op);
 		return -1;
 	}
 
@@ -1631,6 +1768,19 @@ cleanup:
 	return ret;
 }
 
+/**
+ * wpa3_psa_release_password_key - Destroy the password key unless the PT cache owns it
+ */
+static void wpa3_psa_release_password_key(struct wpa3_psa_operation *op)
+{
+	if (op->password_key != PSA_KEY_ID_NULL && !op->password_key_cached) {
+		psa_destroy_key(op->password_key);
+	}
+
+	op->password_key = PSA_KEY_ID_NULL;
+	op->password_key_cached = false;
+}
+
 /**
  * wpa3_psa_cleanup_operation - Clean up PSA operation resources
  */
@@ -1644,10 +1794,7 @@ static void wpa3_psa_cleanup_operation(struct wpa3_psa_operation *op)
 	psa_pake_abort(&op->pake_op);
 
 	/* Destroy password key if it exists */
-	if (op->password_key != PSA_KEY_ID_NULL) {
-		psa_destroy_key(op->password_key);
-		op->password_key = PSA_KEY_ID_NULL;
-	}
+	wpa3_psa_release_password_key(op);
 
 	/* Clear sensitive data */
 	os_memset(op->password, 0, sizeof(op->password));
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+#include <zephyr/kernel.h>
+#include <net/icalendar_parser.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(icalendar_parser, CONFIG_ICAL_PARSER_LOG_LEVEL);
+
+#define BEGIN_STR "BEGIN:"
+#define END_STR "END:"
+
+struct component_desc {
+	const char *name;
+	enum ical_parser_evt_id id;
+	enum ical_parser_error_id error;
+};
+
+struct property_desc {
+	const char *name;
+	/* Date and time properties may have parameters, such as TZID. */
+	bool params;
+	size_t offset;
+	size_t max_len;
+	enum ical_parser_error_id error;
+};
+
+static const struct component_desc components[] = {
+	{ "VEVENT", ICAL_EVT_VEVENT, ICAL_ERROR_NONE },
+	{ "VTODO", ICAL_EVT_VTODO, ICAL_ERROR_COM_NOT_SUPPORTED },
+	{ "VJOURNAL", ICAL_EVT_VJOURNAL, ICAL_ERROR_COM_NOT_SUPPORTED },
+	{ "VFREEBUSY", ICAL_EVT_VFREEBUSY, ICAL_ERROR_COM_NOT_SUPPORTED },
+	{ "VTIMEZONE", ICAL_EVT_VTIMEZONE, ICAL_ERROR_COM_NOT_SUPPORTED },
+};
+
+static const struct property_desc properties[] = {
+	{ "SUMMARY", false, offsetof(struct ical_component, summary),
+	  CONFIG_ICAL_PARSER_SUMMARY_SIZE, ICAL_ERROR_SUMMARY },
+	{ "LOCATION", false, offsetof(struct ical_component, location),
+	  CONFIG_ICAL_PARSER_LOCATION_SIZE, ICAL_ERROR_LOCATION },
+	{ "DESCRIPTION", false, offsetof(struct ical_component, description),
+	  CONFIG_ICAL_PARSER_DESCRIPTION_SIZE, ICAL_ERROR_DESCRIPTION },
+	{ "DTSTART", true, offsetof(struct ical_component, dtstart),
+	  CONFIG_ICAL_PARSER_DTSTART_SIZE, ICAL_ERROR_DTSTART },
+	{ "DTEND", true, offsetof(struct ical_component, dtend),
+	  CONFIG_ICAL_PARSER_DTEND_SIZE, ICAL_ERROR_DTEND },
+};
+
+static bool line_starts_with(const struct ical_stream_parser *parser, const char *str)
+{
+	return !strncmp(parser->line, str, strlen(str));
+}
+
+static void component_begin(struct ical_stream_parser *parser, const char *name)
+{
+	memset(&parser->evt, 0, sizeof(parser->evt));
+	parser->in_component = true;
+	parser->skip = true;
+	parser->depth = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(components); i++) {
+		if (!strcmp(name, components[i].name)) {
+			parser->evt.id = components[i].id;
+			parser->evt.error = components[i].error;
+			parser->skip = false;
+			return;
+		}
+	}
+
+	LOG_DBG("Skipping unknown component %s", name);
+}
+
+static void component_end(struct ical_stream_parser *parser)
+{
+	parser->in_component = false;
+
+	if (parser->skip) {
+		return;
+	}
+
+	if (parser->callback(&parser->evt)) {
+		LOG_DBG("Parsing stopped by the application");
+		parser->stopped = true;
+	}
+}
+
+static enum ical_parser_error_id property_value_get(const struct ical_stream_parser *parser,
+						    const struct property_desc *prop,
+						    size_t name_len)
+{
+	const char *value;
+	size_t value_len;
+
+	if (parser->line[name_len] == ':') {
+		value = parser->line + name_len + 1;
+	} else if (prop->params) {
+		value = strchr(parser->line + name_len, ':');
+		if (value == NULL) {
+			/* Property wrong format - no value. */
+			LOG_ERR("%s wrong format - no value.", prop->name);
+			return prop->error;
+		}
+		value++;
+	} else {
+		/* Does not support property parameter. */
+		LOG_ERR("%s param not supported.", prop->name);
+		return prop->error;
+	}
+
+	value_len = parser->line_len - (value - parser->line);
+	if (parser->line_overflow || (value_len > prop->max_len)) {
+		/* Property value overflow. */
+		LOG_ERR("%s value overflow.", prop->name);
+		return prop->error;
+	}
+
+	char *dst = (char *)&parser->evt.ical_com + prop->offset;
+
+	memcpy(dst, value, value_len);
+	dst[value_len] = '\0';
+
+	return ICAL_ERROR_NONE;
+}
+
+static void property_parse(struct ical_stream_parser *parser)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(properties); i++) {
+		const struct property_desc *prop = &properties[i];
+		size_t name_len = strlen(prop->name);
+
+		if ((parser->line_len > name_len) &&
+		    !strncasecmp(parser->line, prop->name, name_len) &&
+		    ((parser->line[name_len] == ':') || (parser->line[name_len] == ';'))) {
+			parser->evt.error = property_value_get(parser, prop, name_len);
+			return;
+		}
+	}
+}
+
+static void line_process(struct ical_stream_parser *parser)
+{
+	parser->line[parser->line_len] = '\0';
+
+	/* Reference: RFC 5545 3.4 iCalendar Object */
+	if (!parser->in_calendar) {
+		if (!strcmp(parser->line, "BEGIN:VCALENDAR")) {
+			LOG_DBG("Found a calendar stream");
+			parser->in_calendar = true;
+		}
+		return;
+	}
+
+	if (!parser->in_component) {
+		/* Calendar properties, such as PRODID and VERSION, are not used. */
+		if (line_starts_with(parser, BEGIN_STR)) {
+			component_begin(parser, parser->line + strlen(BEGIN_STR));
+		} else if (!strcmp(parser->line, "END:VCALENDAR")) {
+			parser->in_calendar = false;
+		}
+		return;
+	}
+
+	if (line_starts_with(parser, BEGIN_STR)) {
+		/* Subcomponents, such as VALARM, are not parsed. */
+		parser->depth++;
+	} else if (line_starts_with(parser, END_STR)) {
+		if (parser->depth > 0) {
+			parser->depth--;
+		} else {
+			component_end(parser);
+		}
+	} else if ((parser->depth == 0) && !parser->skip &&
+		   (parser->evt.id == ICAL_EVT_VEVENT) &&
+		   (parser->evt.error == ICAL_ERROR_NONE)) {
+		property_parse(parser);
+	}
+}
+
+static void line_end(struct ical_stream_parser *parser)
+{
+	if ((parser->line_len > 0) || parser->line_overflow) {
+		line_process(parser);
+	}
+
+	parser->line_len = 0;
+	parser->line_overflow = false;
+	parser->line_end = false;
+}
+
+int ical_stream_parser_feed(struct ical_stream_parser *parser, const char *data, size_t len)
+{
+	if ((parser == NULL) || ((data == NULL) && (len > 0))) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; (i < len) && !parser->stopped; i++) {
+		char c = data[i];
+
+		if (parser->line_end) {
+			/* Long content line is split into multiple lines, each
+			 * continuation starting with a white space.
+			 * Reference: RFC 5545 3.1 Content Lines
+			 */
+			if ((c == ' ') || (c == '\t')) {
+				parser->line_end = false;
+				continue;
+			}
+
+			line_end(parser);
+			if (parser->stopped) {
+				break;
+			}
+		}
+
+		if (c == '\r') {
+			continue;
+		}
+
+		if (c == '\n') {
+			parser->line_end = true;
+			continue;
+		}
+
+		if (parser->line_len < CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE) {
+			parser->line[parser->line_len++] = c;
+		} else {
+			parser->line_overflow = true;
+		}
+	}
+
+	return parser->stopped ? -ECANCELED : 0;
+}
+
+int ical_stream_parser_finish(struct ical_stream_parser *parser)
+{
+	if (parser == NULL) {
+		return -EINVAL;
+	}
+
+	if (!parser->stopped) {
+		line_end(parser);
+	}
+
+	return parser->stopped ? -ECANCELED : 0;
+}
+
+int ical_stream_parser_init(struct ical_stream_parser *parser,
+			    icalendar_parser_callback_t callback)
+{
+	if (parser == NULL || callback == NULL) {
+		return -EINVAL;
+	}
+
+	memset(parser, 0, sizeof(*parser));
+	parser->callback = callback;
+
+	return 0;
+}
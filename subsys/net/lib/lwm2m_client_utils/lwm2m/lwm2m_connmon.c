@@ -111,6 +111,19 @@ static void modem_data_update(struct k_work *work)
 	lwm2m_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_LAC),
 		      modem_param.network.area_code.value);
 #endif
+
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH)
+	lwm2m_utils_send_batch_add(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
+				   CONNMON_CELLID));
+	lwm2m_utils_send_batch_add(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
+				   CONNMON_SMNC));
+	lwm2m_utils_send_batch_add(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
+				   CONNMON_SMCC));
+#if defined(CONNMON_LAC)
+	lwm2m_utils_send_batch_add(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
+				   CONNMON_LAC));
+#endif
+#endif /* CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH */
 }
 
 /**@brief Callback handler for LTE RSRP data. */
@@ -137,6 +150,11 @@ static void modem_signal_update(struct k_work *work)
 
 	lwm2m_set_s16(&LWM2M_OBJ(4, 0, 2), modem_rsrp);
 	timestamp_prev = k_uptime_get_32();
+
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH)
+	lwm2m_utils_send_batch_add(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
+				   CONNMON_RADIO_SIGNAL_STRENGTH));
+#endif
 }
 
 static void lwm2m_update_connmon_cell(void)
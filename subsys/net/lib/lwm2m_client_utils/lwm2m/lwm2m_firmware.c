@@ -138,6 +138,20 @@ static int fota_event_download_start(uint16_t obj_inst_id)
 	return firmware_fota_event_cb(&event);
 }
 
+static int fota_event_download_progress(uint16_t obj_inst_id, uint8_t percent)
+{
+	struct lwm2m_fota_event event;
+
+	if (!firmware_fota_event_cb) {
+		return 0;
+	}
+
+	event.id = LWM2M_FOTA_DOWNLOAD_PROGRESS;
+	event.download_progress.obj_inst_id = obj_inst_id;
+	event.download_progress.percent = percent;
+	return firmware_fota_event_cb(&event);
+}
+
 static int fota_event_download_ready(uint16_t obj_inst_id)
 {
 	struct lwm2m_fota_event event;
@@ -814,6 +828,7 @@ static int firmware_block_received_cb(uint16_t obj_inst_id, uint16_t res_id, uin
 		if (curent_percent > percent_downloaded) {
 			percent_downloaded = curent_percent;
 			LOG_INF("Downloaded %d%%", percent_downloaded);
+			fota_event_download_progress(obj_inst_id, percent_downloaded);
 		}
 	} else {
 		current_bytes = bytes_downloaded + data_len;
@@ -910,6 +925,13 @@ static void fota_download_callback(const struct fota_download_evt *evt)
 			LOG_INF("FOTA download started, target %d", dfu_image_type);
 			target_image_type_store(ongoing_obj_id, dfu_image_type);
 		}
+
+		/* The event is sent for every fragment, report only the percent steps. */
+		if (evt->progress > percent_downloaded) {
+			percent_downloaded = evt->progress;
+			LOG_INF("Downloaded %d%%", percent_downloaded);
+			fota_event_download_progress(ongoing_obj_id, percent_downloaded);
+		}
 		return;
 	default:
 		return;
@@ -985,6 +1007,7 @@ static void lwm2m_start_download_image(uint8_t *data, uint16_t obj_instance)
 	char *package_uri = (char *)data;
 
 	ongoing_obj_id = obj_instance;
+	percent_downloaded = 0;
 	/* Clear stored Image type */
 	target_image_type_store(obj_instance, DFU_TARGET_IMAGE_TYPE_NONE);
 	ret = init_start_download(package_uri, obj_instance);
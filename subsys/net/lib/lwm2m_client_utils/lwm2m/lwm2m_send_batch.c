@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/lwm2m.h>
+#include <net/lwm2m_client_utils.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lwm2m_send_batch, CONFIG_LWM2M_CLIENT_UTILS_LOG_LEVEL);
+
+#define SERVER_DEFAULT_PMIN_ID 2
+#define SERVER_DEFAULT_PMAX_ID 3
+
+static struct lwm2m_obj_path paths[CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH_PATHS_MAX];
+static uint8_t path_count;
+static K_MUTEX_DEFINE(batch_lock);
+
+static void batch_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_work, batch_work_fn);
+
+static bool path_equal(const struct lwm2m_obj_path *a, const struct lwm2m_obj_path *b)
+{
+	return (a->level == b->level) && (a->obj_id == b->obj_id) &&
+	       (a->obj_inst_id == b->obj_inst_id) && (a->res_id == b->res_id) &&
+	       (a->res_inst_id == b->res_inst_id);
+}
+
+/* The window is kept within the default notification periods of the server, so that the
+ * batched values are not sent more often than observations would be, nor held longer.
+ */
+static uint32_t window_get(void)
+{
+	uint32_t window = CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH_WINDOW;
+	uint32_t pmin = 0;
+	uint32_t pmax = 0;
+
+	if (!lwm2m_get_u32(&LWM2M_OBJ(LWM2M_OBJECT_SERVER_ID, 0, SERVER_DEFAULT_PMIN_ID),
+			   &pmin)) {
+		window = MAX(window, pmin);
+	}
+
+	if (!lwm2m_get_u32(&LWM2M_OBJ(LWM2M_OBJECT_SERVER_ID, 0, SERVER_DEFAULT_PMAX_ID),
+			   &pmax) && (pmax > 0)) {
+		window = MIN(window, pmax);
+	}
+
+	return window;
+}
+
+static int batch_send(void)
+{
+	struct lwm2m_ctx *ctx = lwm2m_rd_client_ctx();
+	int ret;
+
+	if (path_count == 0) {
+		return 0;
+	}
+
+	if (ctx == NULL) {
+		LOG_DBG("No LwM2M context, %u paths kept", path_count);
+		return -ENOTCONN;
+	}
+
+	ret = lwm2m_send_cb(ctx, paths, path_count, NULL);
+	if (ret) {
+		LOG_ERR("Failed to send %u paths, error: %d", path_count, ret);
+		return ret;
+	}
+
+	LOG_DBG("Sent %u paths", path_count);
+	path_count = 0;
+
+	return 0;
+}
+
+static void batch_work_fn(struct k_work *work)
+{
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	/* If the send fails, the paths are kept and sent with the next batch. */
+	(void)batch_send();
+
+	k_mutex_unlock(&batch_lock);
+}
+
+int lwm2m_utils_send_batch_add(const struct lwm2m_obj_path *path)
+{
+	int ret = 0;
+
+	if (path == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	for (size_t i = 0; i < path_count; i++) {
+		if (path_equal(&paths[i], path)) {
+			/* The latest value is read from the engine when the batch is sent. */
+			goto schedule;
+		}
+	}
+
+	if (path_count == ARRAY_SIZE(paths)) {
+		ret = batch_send();
+		if (ret) {
+			goto exit;
+		}
+	}
+
+	paths[path_count++] = *path;
+
+schedule:
+	if (path_count == ARRAY_SIZE(paths)) {
+		(void)k_work_reschedule(&batch_work, K_NO_WAIT);
+	} else if (!k_work_delayable_is_pending(&batch_work)) {
+		(void)k_work_schedule(&batch_work, K_SECONDS(window_get()));
+	}
+
+exit:
+	k_mutex_unlock(&batch_lock);
+	return ret;
+}
+
+int lwm2m_utils_send_batch_flush(void)
+{
+	int ret;
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	ret = batch_send();
+	if (path_count == 0) {
+		(void)k_work_cancel_delayable(&batch_work);
+	}
+
+	k_mutex_unlock(&batch_lock);
+	return ret;
+}
@@ -37,6 +37,64 @@ MQTT_HELPER_STATIC K_SEM_DEFINE(connection_poll_sem, 0, 1);
 static struct mqtt_helper_cfg current_cfg;
 MQTT_HELPER_STATIC enum mqtt_state mqtt_state = MQTT_STATE_UNINIT;
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0
+/* Message IDs of the QoS 1 publications awaiting a PUBACK, 0 marks a free slot. */
+static uint16_t inflight_ids[CONFIG_MQTT_HELPER_PUBLISH_WINDOW];
+static struct k_spinlock inflight_lock;
+
+static bool inflight_add(uint16_t message_id)
+{
+	k_spinlock_key_t key = k_spin_lock(&inflight_lock);
+	bool added = false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(inflight_ids); i++) {
+		if (inflight_ids[i] == 0) {
+			inflight_ids[i] = message_id;
+			added = true;
+			break;
+		}
+	}
+
+	k_spin_unlock(&inflight_lock, key);
+
+	return added;
+}
+
+/* Returns true if the window was full before the message was removed. */
+static bool inflight_remove(uint16_t message_id)
+{
+	k_spinlock_key_t key = k_spin_lock(&inflight_lock);
+	size_t used = 0;
+	bool removed = false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(inflight_ids); i++) {
+		if (inflight_ids[i] == 0) {
+			continue;
+		}
+
+		used++;
+
+		if (!removed && (inflight_ids[i] == message_id)) {
+			inflight_ids[i] = 0;
+			removed = true;
+		}
+	}
+
+	k_spin_unlock(&inflight_lock, key);
+
+	return removed && (used == ARRAY_SIZE(inflight_ids));
+}
+
+static void inflight_clear(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&inflight_lock);
+
+	memset(inflight_ids, 0, sizeof(inflight_ids));
+
+	k_spin_unlock(&inflight_lock, key);
+}
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0 */
+
 static const char *state_name_get(enum mqtt_state state)
 {
 	switch (state) {
@@ -251,6 +309,37 @@ static int publish_get_payload(struct mqtt_client *const mqtt_client, size_t len
 	return mqtt_readall_publish_payload(mqtt_client, payload_buf, length);
 }
 
+static int publish_get_payload_chunked(struct mqtt_client *const mqtt_client,
+				       struct mqtt_helper_buf topic, size_t length)
+{
+	int ret;
+	size_t offset = 0;
+	struct mqtt_helper_buf chunk = {
+		.ptr = payload_buf,
+	};
+
+	do {
+		chunk.size = MIN(length - offset, sizeof(payload_buf));
+
+		if (chunk.size > 0) {
+			ret = mqtt_read_publish_payload_blocking(mqtt_client, payload_buf,
+								 chunk.size);
+			if (ret < 0) {
+				return ret;
+			} else if (ret == 0) {
+				return -EIO;
+			}
+
+			chunk.size = ret;
+		}
+
+		current_cfg.cb.on_publish_chunk(topic, chunk, offset, length);
+		offset += chunk.size;
+	} while (offset < length);
+
+	return 0;
+}
+
 static void send_ack(struct mqtt_client *const mqtt_client, uint16_t message_id)
 {
 	int err;
@@ -279,6 +368,20 @@ MQTT_HELPER_STATIC void on_publish(const struct mqtt_evt *mqtt_evt)
 		.ptr = payload_buf,
 	};
 
+	if (current_cfg.cb.on_publish_chunk) {
+		err = publish_get_payload_chunked(&mqtt_client, topic, p->message.payload.len);
+		if (err) {
+			LOG_ERR("publish_get_payload_chunked, error: %d", err);
+			return;
+		}
+
+		if (p->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+			send_ack(&mqtt_client, p->message_id);
+		}
+
+		return;
+	}
+
 	err = publish_get_payload(&mqtt_client, p->message.payload.len);
 	if (err) {
 		LOG_ERR("publish_get_payload, error: %d", err);
@@ -332,6 +435,10 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 
 		mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0
+		inflight_clear();
+#endif
+
 		if (current_cfg.cb.on_disconnect) {
 			current_cfg.cb.on_disconnect(mqtt_evt->result);
 		}
@@ -351,6 +458,13 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 			current_cfg.cb.on_puback(mqtt_evt->param.puback.message_id,
 						 mqtt_evt->result);
 		}
+
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0
+		if (inflight_remove(mqtt_evt->param.puback.message_id) &&
+		    current_cfg.cb.on_publish_window_available) {
+			current_cfg.cb.on_publish_window_available();
+		}
+#endif
 		break;
 	case MQTT_EVT_SUBACK:
 		LOG_DBG("MQTT_EVT_SUBACK: id = %d result = %d",
@@ -540,7 +654,8 @@ static int client_connect(struct mqtt_helper_conn_params *conn_params)
 	tls_cfg->peer_verify = ZSOCK_TLS_PEER_VERIFY_REQUIRED;
 	tls_cfg->cipher_count = 0;
 	tls_cfg->cipher_list = NULL; /* Use default */
-	tls_cfg->session_cache = ZSOCK_TLS_SESSION_CACHE_DISABLED;
+	tls_cfg->session_cache = IS_ENABLED(CONFIG_MQTT_HELPER_TLS_SESSION_CACHE) ?
+				 ZSOCK_TLS_SESSION_CACHE_ENABLED : ZSOCK_TLS_SESSION_CACHE_DISABLED;
 	tls_cfg->hostname = conn_params->hostname.ptr;
 	tls_cfg->set_native_tls = IS_ENABLED(CONFIG_MQTT_HELPER_NATIVE_TLS);
 
@@ -610,6 +725,10 @@ int mqtt_helper_init(struct mqtt_helper_cfg *cfg)
 
 	mqtt_client_init(&mqtt_client);
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0
+	inflight_clear();
+#endif
+
 	mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
 	return 0;
@@ -662,6 +781,10 @@ int mqtt_helper_disconnect(void)
 		LOG_ERR("Failed to send disconnection request, treating as disconnected");
 		mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0
+		inflight_clear();
+#endif
+
 		if (current_cfg.cb.on_disconnect) {
 			current_cfg.cb.on_disconnect(err);
 		}
@@ -720,7 +843,27 @@ int mqtt_helper_publish(const struct mqtt_publish_param *param)
 		return -EOPNOTSUPP;
 	}
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0
+	int err;
+
+	if (param->message.topic.qos != MQTT_QOS_1_AT_LEAST_ONCE) {
+		return mqtt_publish(&mqtt_client, param);
+	}
+
+	if (!inflight_add(param->message_id)) {
+		LOG_DBG("Publish window full, message ID: %d", param->message_id);
+		return -EAGAIN;
+	}
+
+	err = mqtt_publish(&mqtt_client, param);
+	if (err) {
+		(void)inflight_remove(param->message_id);
+	}
+
+	return err;
+#else
 	return mqtt_publish(&mqtt_client, param);
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_WINDOW > 0 */
 }
 
 uint16_t mqtt_helper_msg_id_get(void)
@@ -304,9 +304,10 @@ int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable)
 		return -EINVAL;
 	}
 
-	/* Only support sending of the CoAP CBOR or JSON type or a pre-encoded CBOR buffer. */
+	/* Only support sending of the CoAP CBOR or JSON types or a pre-encoded CBOR buffer. */
 	if ((obj->type != NRF_CLOUD_OBJ_TYPE_COAP_CBOR) &&
 	    (obj->type != NRF_CLOUD_OBJ_TYPE_JSON) &&
+	    (obj->type != NRF_CLOUD_OBJ_TYPE_JSON_STREAM) &&
 	    (obj->enc_src != NRF_CLOUD_ENC_SRC_PRE_ENCODED)) {
 		return -ENOTSUP;
 	}
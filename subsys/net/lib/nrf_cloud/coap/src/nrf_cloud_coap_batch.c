@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <date_time.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_coap.h>
+#include <cJSON.h>
+#if defined(CONFIG_NRF_CLOUD_COAP_BATCH_FLUSH_ON_RRC_CONNECTED)
+#include <modem/lte_lc.h>
+#endif
+#include "nrf_cloud_codec_internal.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(nrf_cloud_coap_batch, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
+
+/* The batch is stored as the JSON array sent to the bulk resource.
+ * The opening bracket or a separator precedes every message, and room is kept
+ * for the closing bracket and the terminator.
+ */
+#define BATCH_OVERHEAD 3
+
+static char batch_buf[CONFIG_NRF_CLOUD_COAP_BATCH_BUF_SIZE];
+static size_t batch_len;
+static size_t batch_cnt;
+
+static K_MUTEX_DEFINE(batch_mutex);
+
+static K_THREAD_STACK_DEFINE(batch_stack, CONFIG_NRF_CLOUD_COAP_BATCH_STACK_SIZE);
+static struct k_work_q batch_work_q;
+static bool initialized;
+
+static void flush_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(flush_work, flush_work_fn);
+
+static int batch_send(void)
+{
+	int err;
+
+	if (!batch_cnt) {
+		return 0;
+	}
+
+	batch_buf[batch_len] = ']';
+	batch_buf[batch_len + 1] = '\0';
+
+	err = nrf_cloud_coap_json_message_send(batch_buf, true,
+					       IS_ENABLED(CONFIG_NRF_CLOUD_COAP_BATCH_CONFIRMABLE));
+	if (err < 0) {
+		/* Keep the messages so that they are sent with the next flush */
+		LOG_ERR("Failed to send %zu batched messages: %d", batch_cnt, err);
+		return err;
+	} else if (err) {
+		/* Sending the batch again would be rejected as well */
+		LOG_ERR("%zu batched messages rejected by the cloud: %d", batch_cnt, err);
+	} else {
+		LOG_DBG("Sent %zu batched messages, %zu bytes", batch_cnt, batch_len + 1);
+	}
+
+	batch_len = 0;
+	batch_cnt = 0;
+	(void)k_work_cancel_delayable(&flush_work);
+
+	return err;
+}
+
+static void flush_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+
+	if (batch_send() < 0) {
+		/* Retry when the next period expires */
+		k_work_reschedule_for_queue(&batch_work_q, &flush_work,
+					    K_SECONDS(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE));
+	}
+
+	k_mutex_unlock(&batch_mutex);
+}
+
+#if defined(CONFIG_NRF_CLOUD_COAP_BATCH_FLUSH_ON_RRC_CONNECTED)
+static void lte_handler(const struct lte_lc_evt *const evt)
+{
+	/* The radio is already on, send the batch without waiting for it to fill up */
+	if ((evt->type == LTE_LC_EVT_RRC_UPDATE) &&
+	    (evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED) && batch_cnt) {
+		k_work_reschedule_for_queue(&batch_work_q, &flush_work, K_NO_WAIT);
+	}
+}
+#endif
+
+static void batch_init(void)
+{
+	if (initialized) {
+		return;
+	}
+
+	k_work_queue_init(&batch_work_q);
+	k_work_queue_start(&batch_work_q, batch_stack, K_THREAD_STACK_SIZEOF(batch_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+	k_thread_name_set(&batch_work_q.thread, "nrf_cloud_coap_batch");
+
+#if defined(CONFIG_NRF_CLOUD_COAP_BATCH_FLUSH_ON_RRC_CONNECTED)
+	lte_lc_register_handler(lte_handler);
+#endif
+
+	initialized = true;
+}
+
+typedef int (*batch_encode_t)(const void *const msg, char *const buf, size_t *const len);
+
+static int sensor_encode(const void *const msg, char *const buf, size_t *const len)
+{
+	return nrf_cloud_msg_json_buf_encode(msg, buf, len);
+}
+
+static int json_encode(const void *const msg, char *const buf, size_t *const len)
+{
+	/* cJSON needs a few more bytes than the printed size */
+	if (!cJSON_PrintPreallocated((cJSON *)msg, buf, *len, false)) {
+		return -E2BIG;
+	}
+
+	*len = strlen(buf);
+
+	return 0;
+}
+
+static int batch_add(batch_encode_t encode, const void *const msg)
+{
+	size_t len;
+	int err;
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+
+	batch_init();
+
+	for (int attempt = 0; attempt < 2; attempt++) {
+		len = sizeof(batch_buf) - batch_len - BATCH_OVERHEAD;
+
+		err = encode(msg, &batch_buf[batch_len + 1], &len);
+		if (err != -E2BIG) {
+			break;
+		}
+
+		/* Make room by sending the batch; a message that does not fit
+		 * into an empty batch can not be batched.
+		 */
+		if (!batch_cnt) {
+			break;
+		}
+
+		err = batch_send();
+		if (err < 0) {
+			break;
+		}
+	}
+
+	if (err) {
+		k_mutex_unlock(&batch_mutex);
+		return err;
+	}
+
+	batch_buf[batch_len] = batch_cnt ? ',' : '[';
+	batch_len += len + 1;
+	batch_cnt++;
+
+	if (batch_cnt == 1) {
+		k_work_reschedule_for_queue(&batch_work_q, &flush_work,
+					    K_SECONDS(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE));
+	}
+
+	k_mutex_unlock(&batch_mutex);
+
+	return 0;
+}
+
+int nrf_cloud_coap_sensor_batch_add(const char *app_id, double value, int64_t ts_ms)
+{
+	if (!app_id) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = (char *)app_id,
+		.type = NRF_CLOUD_DATA_TYPE_DOUBLE,
+		.double_val = value,
+		.ts = ts_ms,
+	};
+
+	/* The message is sent later, so the timestamp must be taken now */
+	if ((msg.ts == NRF_CLOUD_NO_TIMESTAMP) && date_time_now(&msg.ts)) {
+		LOG_WRN("Batched message has no timestamp");
+		msg.ts = NRF_CLOUD_NO_TIMESTAMP;
+	}
+
+	return batch_add(sensor_encode, &msg);
+}
+
+int nrf_cloud_coap_obj_batch_add(struct nrf_cloud_obj *const obj)
+{
+	if (!obj) {
+		return -EINVAL;
+	}
+
+	switch (obj->type) {
+	case NRF_CLOUD_OBJ_TYPE_JSON:
+		if (!obj->json) {
+			return -ENOENT;
+		}
+
+		if (nrf_cloud_obj_bulk_check(obj)) {
+			return -ENOTSUP;
+		}
+
+		return batch_add(json_encode, obj->json);
+	case NRF_CLOUD_OBJ_TYPE_COAP_CBOR:
+		if (!obj->coap_cbor) {
+			return -ENOENT;
+		}
+
+		return batch_add(sensor_encode, obj->coap_cbor);
+	default:
+		break;
+	}
+
+	return -ENOTSUP;
+}
+
+int nrf_cloud_coap_batch_flush(void)
+{
+	int err;
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	err = batch_send();
+	k_mutex_unlock(&batch_mutex);
+
+	return err;
+}
+
+size_t nrf_cloud_coap_batch_count(void)
+{
+	return batch_cnt;
+}
@@ -65,6 +65,51 @@ int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *input,
 int nrf_cloud_encode_message(const char *app_id, double value, const char *str_val,
 			     const char *topic, int64_t ts, struct nrf_cloud_data *output);
 
+/** @brief Encode a device message as JSON into the provided buffer without allocating memory.
+ *  On input, len is the size of the buffer. On success, len is the length of the
+ *  null-terminated message. If the buffer is too small, -E2BIG is returned and len is
+ *  the length of the message, so the buffer can be NULL to get the required size.
+ */
+int nrf_cloud_msg_json_buf_encode(const struct nrf_cloud_obj_coap_cbor *const msg,
+				  char *const buf, size_t *const len);
+
+/** @brief Start the root object of a JSON stream. If app_id is not NULL, the
+ *  appId and, if not NULL, the messageType members are added.
+ */
+int nrf_cloud_json_stream_init(struct nrf_cloud_obj_json_stream *const stream,
+			       const char *const app_id, const char *const msg_type);
+
+/** @brief Reset a JSON stream to the uninitialized state. */
+void nrf_cloud_json_stream_free(struct nrf_cloud_obj_json_stream *const stream);
+
+/** @brief Functions to write members to a JSON stream; see the corresponding
+ *  nrf_cloud_obj_*_add functions.
+ */
+int nrf_cloud_json_stream_num_add(struct nrf_cloud_obj_json_stream *const stream,
+				  const char *const key, const double val, const bool data_child);
+int nrf_cloud_json_stream_str_add(struct nrf_cloud_obj_json_stream *const stream,
+				  const char *const key, const char *const val,
+				  const bool data_child);
+int nrf_cloud_json_stream_bool_add(struct nrf_cloud_obj_json_stream *const stream,
+				   const char *const key, const bool val, const bool data_child);
+int nrf_cloud_json_stream_null_add(struct nrf_cloud_obj_json_stream *const stream,
+				   const char *const key, const bool data_child);
+int nrf_cloud_json_stream_int_array_add(struct nrf_cloud_obj_json_stream *const stream,
+					const char *const key, const uint32_t ints[],
+					const uint32_t ints_cnt, const bool data_child);
+int nrf_cloud_json_stream_str_array_add(struct nrf_cloud_obj_json_stream *const stream,
+					const char *const key, const char *const strs[],
+					const uint32_t strs_cnt, const bool data_child);
+int nrf_cloud_json_stream_object_begin(struct nrf_cloud_obj_json_stream *const stream,
+				       const char *const key, const bool data_child);
+int nrf_cloud_json_stream_object_end(struct nrf_cloud_obj_json_stream *const stream);
+
+/** @brief Close all open objects of a JSON stream and terminate the output,
+ *  which is then pointed to by output.
+ */
+int nrf_cloud_json_stream_end(struct nrf_cloud_obj_json_stream *const stream,
+			      struct nrf_cloud_data *const output);
+
 /** @brief Encode the sensor data to be sent to the device shadow. */
 int nrf_cloud_shadow_data_encode(const struct nrf_cloud_sensor_data *sensor,
 				 struct nrf_cloud_data *output);
@@ -38,6 +38,15 @@ struct gps_location {
 	int64_t gps_sec;
 };
 
+/* Storage block of each prediction, in time order, for the prediction set
+ * starting at the given GPS day and time of day.
+ */
+struct npgps_prediction_index {
+	uint16_t gps_day;
+	uint32_t gps_time_of_day;
+	int8_t block[NUM_PREDICTIONS];
+};
+
 struct nrf_cloud_pgps_header;
 
 typedef int (*npgps_buffer_handler_t)(uint8_t *buf, size_t len);
@@ -53,6 +62,8 @@ int npgps_save_header(struct nrf_cloud_pgps_header *header);
 const struct nrf_cloud_pgps_header *npgps_get_saved_header(void);
 const struct gps_location *npgps_get_saved_location(void);
 int npgps_settings_init(void);
+int npgps_save_index(const struct npgps_prediction_index *idx);
+const struct npgps_prediction_index *npgps_get_saved_index(void);
 
 /* time functions */
 int64_t npgps_gps_day_time_to_sec(uint16_t gps_day, uint32_t gps_time_of_day);
@@ -51,6 +51,38 @@ static atomic_t request_in_progress;
 static int64_t last_request_timestamp;
 #endif
 
+#if defined(CONFIG_NRF_CLOUD_AGNSS_CACHE)
+#define CACHE_GPS_SV_CNT	32
+#define CACHE_QZSS_SV_CNT	10
+#define QZSS_SV_ID_BASE		193
+
+#define CACHE_EPHE_VALIDITY_MS	((int64_t)CONFIG_NRF_CLOUD_AGNSS_CACHE_EPHE_VALIDITY * 60 * \
+				 MSEC_PER_SEC)
+#define CACHE_ALM_VALIDITY_MS	((int64_t)CONFIG_NRF_CLOUD_AGNSS_CACHE_ALM_VALIDITY * 60 * 60 * \
+				 MSEC_PER_SEC)
+#define CACHE_MARGIN_MS		((int64_t)CONFIG_NRF_CLOUD_AGNSS_CACHE_EXPIRY_MARGIN * 60 * \
+				 MSEC_PER_SEC)
+
+/* A timestamp of zero denotes an empty entry. */
+struct cache_ephe {
+	int64_t timestamp;
+	struct nrf_modem_gnss_agnss_gps_data_ephemeris data;
+};
+
+struct cache_alm {
+	int64_t timestamp;
+	struct nrf_modem_gnss_agnss_gps_data_almanac data;
+};
+
+static struct {
+	struct cache_ephe gps_ephe[CACHE_GPS_SV_CNT];
+	struct cache_ephe qzss_ephe[CACHE_QZSS_SV_CNT];
+	struct cache_alm gps_alm[CACHE_GPS_SV_CNT];
+	struct cache_alm qzss_alm[CACHE_QZSS_SV_CNT];
+} cache;
+static K_MUTEX_DEFINE(cache_lock);
+#endif
+
 void agnss_print_enable(bool enable)
 {
 	agnss_print_enabled = enable;
@@ -84,6 +116,140 @@ static int send_to_modem(void *data, size_t data_len, uint16_t type)
 	return nrf_modem_gnss_agnss_write(data, data_len, type);
 }
 
+#if defined(CONFIG_NRF_CLOUD_AGNSS_CACHE)
+static void cache_ephe_store(const struct nrf_modem_gnss_agnss_gps_data_ephemeris *ephe)
+{
+	struct cache_ephe *entry = NULL;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	if ((ephe->sv_id >= 1) && (ephe->sv_id <= CACHE_GPS_SV_CNT)) {
+		entry = &cache.gps_ephe[ephe->sv_id - 1];
+	} else if ((ephe->sv_id >= QZSS_SV_ID_BASE) &&
+		   (ephe->sv_id < QZSS_SV_ID_BASE + CACHE_QZSS_SV_CNT)) {
+		entry = &cache.qzss_ephe[ephe->sv_id - QZSS_SV_ID_BASE];
+	}
+
+	if (entry) {
+		entry->data = *ephe;
+		/* Zero is reserved for empty entries. */
+		entry->timestamp = MAX(k_uptime_get(), 1);
+	}
+	k_mutex_unlock(&cache_lock);
+}
+
+static void cache_alm_store(const struct nrf_modem_gnss_agnss_gps_data_almanac *alm)
+{
+	struct cache_alm *entry = NULL;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	if ((alm->sv_id >= 1) && (alm->sv_id <= CACHE_GPS_SV_CNT)) {
+		entry = &cache.gps_alm[alm->sv_id - 1];
+	} else if ((alm->sv_id >= QZSS_SV_ID_BASE) &&
+		   (alm->sv_id < QZSS_SV_ID_BASE + CACHE_QZSS_SV_CNT)) {
+		entry = &cache.qzss_alm[alm->sv_id - QZSS_SV_ID_BASE];
+	}
+
+	if (entry) {
+		entry->data = *alm;
+		entry->timestamp = MAX(k_uptime_get(), 1);
+	}
+	k_mutex_unlock(&cache_lock);
+}
+
+static bool cache_entry_usable(int64_t timestamp, int64_t validity_ms, int64_t now)
+{
+	return (timestamp != 0) && ((now - timestamp) + CACHE_MARGIN_MS < validity_ms);
+}
+
+static uint64_t cache_ephe_inject(uint64_t mask, const struct cache_ephe *entries, size_t cnt,
+				  int64_t now)
+{
+	for (size_t i = 0; i < cnt; i++) {
+		if (!(mask & BIT64(i)) ||
+		    !cache_entry_usable(entries[i].timestamp, CACHE_EPHE_VALIDITY_MS, now)) {
+			continue;
+		}
+
+		if (!send_to_modem((void *)&entries[i].data, sizeof(entries[i].data),
+				   NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES)) {
+			mask &= ~BIT64(i);
+		}
+	}
+
+	return mask;
+}
+
+static uint64_t cache_alm_inject(uint64_t mask, const struct cache_alm *entries, size_t cnt,
+				 int64_t now)
+{
+	for (size_t i = 0; i < cnt; i++) {
+		if (!(mask & BIT64(i)) ||
+		    !cache_entry_usable(entries[i].timestamp, CACHE_ALM_VALIDITY_MS, now)) {
+			continue;
+		}
+
+		if (!send_to_modem((void *)&entries[i].data, sizeof(entries[i].data),
+				   NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC)) {
+			mask &= ~BIT64(i);
+		}
+	}
+
+	return mask;
+}
+
+bool nrf_cloud_agnss_cache_apply(struct nrf_modem_gnss_agnss_data_frame *request)
+{
+	int64_t now = k_uptime_get();
+	bool data_needed = (request->data_flags != 0);
+	uint64_t ephe_mask;
+	uint64_t alm_mask;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < request->system_count; i++) {
+		ephe_mask = request->system[i].sv_mask_ephe;
+		alm_mask = request->system[i].sv_mask_alm;
+
+		if (request->system[i].system_id == NRF_MODEM_GNSS_SYSTEM_GPS) {
+			ephe_mask = cache_ephe_inject(ephe_mask, cache.gps_ephe,
+						      CACHE_GPS_SV_CNT, now);
+			alm_mask = cache_alm_inject(alm_mask, cache.gps_alm, CACHE_GPS_SV_CNT, now);
+		} else if (request->system[i].system_id == NRF_MODEM_GNSS_SYSTEM_QZSS) {
+			ephe_mask = cache_ephe_inject(ephe_mask, cache.qzss_ephe,
+						      CACHE_QZSS_SV_CNT, now);
+			alm_mask = cache_alm_inject(alm_mask, cache.qzss_alm, CACHE_QZSS_SV_CNT,
+						    now);
+		}
+
+		if ((ephe_mask != request->system[i].sv_mask_ephe) ||
+		    (alm_mask != request->system[i].sv_mask_alm)) {
+			LOG_DBG("A-GNSS system %u injected from cache, ephe: 0x%llx, alm: 0x%llx",
+				request->system[i].system_id,
+				request->system[i].sv_mask_ephe & ~ephe_mask,
+				request->system[i].sv_mask_alm & ~alm_mask);
+		}
+
+		request->system[i].sv_mask_ephe = ephe_mask;
+		request->system[i].sv_mask_alm = alm_mask;
+		data_needed = data_needed || (ephe_mask != 0) || (alm_mask != 0);
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return data_needed;
+}
+
+void nrf_cloud_agnss_cache_clear(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	memset(&cache, 0, sizeof(cache));
+	k_mutex_unlock(&cache_lock);
+}
+#else
+static void cache_ephe_store(const struct nrf_modem_gnss_agnss_gps_data_ephemeris *ephe) {}
+static void cache_alm_store(const struct nrf_modem_gnss_agnss_gps_data_almanac *alm) {}
+#endif /* defined(CONFIG_NRF_CLOUD_AGNSS_CACHE) */
+
 static void copy_gps_utc(struct nrf_modem_gnss_agnss_gps_data_utc *dst,
 			 struct nrf_cloud_agnss_element *src)
 {
@@ -359,6 +525,7 @@ static int agnss_send_to_modem(struct nrf_cloud_agnss_element *agnss_data)
 		}
 
 		copy_ephemeris(&ephemeris, agnss_data);
+		cache_ephe_store(&ephemeris);
 		LOG_DBG("A-GNSS type: %s EPHEMERIDES %d",
 			(agnss_data->type == NRF_CLOUD_AGNSS_GPS_EPHEMERIDES) ? "GPS" : "QZSS",
 			agnss_data->ephemeris->sv_id);
@@ -379,6 +546,7 @@ static int agnss_send_to_modem(struct nrf_cloud_agnss_element *agnss_data)
 		}
 
 		copy_almanac(&almanac, agnss_data);
+		cache_alm_store(&almanac);
 		LOG_DBG("A-GNSS type: %s ALMANAC %d",
 			(agnss_data->type == NRF_CLOUD_AGNSS_GPS_ALMANAC) ? "GPS" : "QZSS",
 			agnss_data->almanac->sv_id);
@@ -245,6 +245,13 @@ int nrf_cloud_obj_msg_init(struct nrf_cloud_obj *const obj, const char *const ap
 
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -EINVAL;
+		}
+
+		return nrf_cloud_json_stream_init(obj->json_stream, app_id, msg_type);
+	}
 	default:
 		break;
 	}
@@ -267,6 +274,13 @@ int nrf_cloud_obj_init(struct nrf_cloud_obj *const obj)
 		obj->json = cJSON_CreateObject();
 		return obj->json ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -EINVAL;
+		}
+
+		return nrf_cloud_json_stream_init(obj->json_stream, NULL, NULL);
+	}
 	default:
 		break;
 	}
@@ -350,6 +364,13 @@ int nrf_cloud_obj_cloud_encoded_free(struct nrf_cloud_obj *const obj)
 		obj->enc_src = NRF_CLOUD_ENC_SRC_NONE;
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		/* The encoded data is in the stream's buffer */
+		obj->encoded_data.ptr = NULL;
+		obj->encoded_data.len = 0;
+		obj->enc_src = NRF_CLOUD_ENC_SRC_NONE;
+		return 0;
+	}
 	default:
 		break;
 	}
@@ -393,6 +414,12 @@ int nrf_cloud_obj_free(struct nrf_cloud_obj *const obj)
 		}
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (obj->json_stream) {
+			nrf_cloud_json_stream_free(obj->json_stream);
+		}
+		return 0;
+	}
 	default:
 		break;
 	}
@@ -455,6 +482,14 @@ int nrf_cloud_obj_ts_add(struct nrf_cloud_obj *const obj, const int64_t time_ms)
 		obj->coap_cbor->ts = time_ms;
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_num_add(obj->json_stream, NRF_CLOUD_MSG_TIMESTAMP_KEY,
+						     time_ms, false);
+	}
 	default:
 		break;
 	}
@@ -545,6 +580,13 @@ int nrf_cloud_obj_num_add(struct nrf_cloud_obj *const obj, const char *const key
 
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_num_add(obj->json_stream, key, val, data_child);
+	}
 	default:
 		break;
 	}
@@ -594,6 +636,17 @@ int nrf_cloud_obj_str_add(struct nrf_cloud_obj *const obj, const char *const key
 
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!key) {
+			return -EINVAL;
+		}
+
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_str_add(obj->json_stream, key, val, data_child);
+	}
 	default:
 		break;
 	}
@@ -616,6 +669,13 @@ int nrf_cloud_obj_bool_add(struct nrf_cloud_obj *const obj, const char *const ke
 		return cJSON_AddBoolToObjectCS(dest_json_get(obj, data_child), key, val) ? 0
 											 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_bool_add(obj->json_stream, key, val, data_child);
+	}
 	default:
 		break;
 	}
@@ -637,6 +697,13 @@ int nrf_cloud_obj_null_add(struct nrf_cloud_obj *const obj, const char *const ke
 		}
 		return cJSON_AddNullToObjectCS(dest_json_get(obj, data_child), key) ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_null_add(obj->json_stream, key, data_child);
+	}
 	default:
 		break;
 	}
@@ -672,6 +739,49 @@ int nrf_cloud_obj_object_add(struct nrf_cloud_obj *const obj, const char *const
 	return -ENOTSUP;
 }
 
+int nrf_cloud_obj_object_begin(struct nrf_cloud_obj *const obj, const char *const key,
+			       const bool data_child)
+{
+	if (!obj || !key) {
+		return -EINVAL;
+	}
+
+	switch (obj->type) {
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_object_begin(obj->json_stream, key, data_child);
+	}
+	default:
+		break;
+	}
+
+	return -ENOTSUP;
+}
+
+int nrf_cloud_obj_object_end(struct nrf_cloud_obj *const obj)
+{
+	if (!obj) {
+		return -EINVAL;
+	}
+
+	switch (obj->type) {
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_object_end(obj->json_stream);
+	}
+	default:
+		break;
+	}
+
+	return -ENOTSUP;
+}
+
 int nrf_cloud_obj_int_array_add(struct nrf_cloud_obj *const obj, const char *const key,
 				const uint32_t ints[], const uint32_t ints_cnt,
 				const bool data_child)
@@ -688,6 +798,14 @@ int nrf_cloud_obj_int_array_add(struct nrf_cloud_obj *const obj, const char *con
 			       ? 0
 			       : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		return nrf_cloud_json_stream_int_array_add(obj->json_stream, key, ints, ints_cnt,
+							   data_child);
+	}
 	default:
 		break;
 	}
@@ -714,6 +832,10 @@ int nrf_cloud_obj_str_array_add(struct nrf_cloud_obj *const obj, const char *con
 			       ? 0
 			       : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		return nrf_cloud_json_stream_str_array_add(obj->json_stream, key, strs, strs_cnt,
+							   data_child);
+	}
 	default:
 		break;
 	}
@@ -767,9 +889,53 @@ int nrf_cloud_obj_cloud_encode(struct nrf_cloud_obj *const obj)
 
 		return ret;
 #else
-		return -ENOSYS;
+		if (!obj->coap_cbor) {
+			return -ENOENT;
+		}
+
+		int ret;
+		size_t len = 0;
+
+		/* Get the required size, then encode the message with a single allocation */
+		ret = nrf_cloud_msg_json_buf_encode(obj->coap_cbor, NULL, &len);
+		if (ret != -E2BIG) {
+			return ret ? ret : -EINVAL;
+		}
+
+		obj->encoded_data.len = len + 1;
+		obj->encoded_data.ptr = nrf_cloud_malloc(obj->encoded_data.len);
+
+		if (obj->encoded_data.ptr == NULL) {
+			return -ENOMEM;
+		}
+
+		obj->enc_src = NRF_CLOUD_ENC_SRC_CLOUD_ENCODED;
+
+		ret = nrf_cloud_msg_json_buf_encode(obj->coap_cbor, (char *)obj->encoded_data.ptr,
+						    &obj->encoded_data.len);
+
+		if (ret) {
+			nrf_cloud_obj_cloud_encoded_free(obj);
+		}
+
+		return ret;
 #endif
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_STREAM: {
+		if (!obj->json_stream) {
+			return -ENOENT;
+		}
+
+		int ret = nrf_cloud_json_stream_end(obj->json_stream, &obj->encoded_data);
+
+		if (ret) {
+			return ret;
+		}
+
+		obj->enc_src = NRF_CLOUD_ENC_SRC_CLOUD_ENCODED;
+
+		return 0;
+	}
 	default:
 		break;
 	}
@@ -777,6 +943,61 @@ int nrf_cloud_obj_cloud_encode(struct nrf_cloud_obj *const obj)
 	return -ENOTSUP;
 }
 
+int nrf_cloud_obj_cloud_buf_encode(struct nrf_cloud_obj *const obj, char *const buf,
+				   size_t *const len)
+{
+	if (!obj || !buf || !len || !*len) {
+		return -EINVAL;
+	}
+
+	if (obj->enc_src != NRF_CLOUD_ENC_SRC_NONE) {
+		return -EACCES;
+	}
+
+	int ret;
+
+	switch (obj->type) {
+	case NRF_CLOUD_OBJ_TYPE_JSON: {
+		if (!obj->json) {
+			return -ENOENT;
+		}
+
+		/* cJSON needs a few more bytes than the printed size */
+		if (!cJSON_PrintPreallocated(obj->json, buf, *len, false)) {
+			return -E2BIG;
+		}
+
+		*len = strlen(buf);
+		ret = 0;
+		break;
+	}
+	case NRF_CLOUD_OBJ_TYPE_COAP_CBOR: {
+		if (!obj->coap_cbor) {
+			return -ENOENT;
+		}
+#if defined(CONFIG_NRF_CLOUD_COAP)
+		ret = coap_codec_message_encode(obj->coap_cbor, (uint8_t *)buf, len,
+						COAP_CONTENT_FORMAT_APP_CBOR);
+#else
+		ret = nrf_cloud_msg_json_buf_encode(obj->coap_cbor, buf, len);
+#endif
+		break;
+	}
+	default:
+		return -ENOTSUP;
+	}
+
+	if (ret) {
+		return ret;
+	}
+
+	obj->encoded_data.ptr = buf;
+	obj->encoded_data.len = *len;
+	obj->enc_src = NRF_CLOUD_ENC_SRC_PRE_ENCODED;
+
+	return 0;
+}
+
 int nrf_cloud_obj_gnss_msg_create(struct nrf_cloud_obj *const obj,
 				  const struct nrf_cloud_gnss_data *const gnss)
 {
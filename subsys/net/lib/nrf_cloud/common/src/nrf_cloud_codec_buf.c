@@ -0,0 +1,474 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <zephyr/sys/util.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_defs.h>
+#include <net/nrf_cloud_codec.h>
+#include "nrf_cloud_codec_internal.h"
+
+/* Longest number printed with "%1.17g", including the terminator */
+#define NUM_STR_SIZE 26
+
+/* Nesting levels are tracked in the members bitmask of the stream */
+#define STREAM_DEPTH_MAX 31
+
+/* The output length keeps counting past the end of the buffer so that
+ * the required size can be reported.
+ */
+static void put_char(struct nrf_cloud_obj_json_stream *const out, const char c)
+{
+	if (out->len < out->size) {
+		out->buf[out->len] = c;
+	}
+
+	out->len++;
+}
+
+static void put_raw(struct nrf_cloud_obj_json_stream *const out, const char *str)
+{
+	while (*str) {
+		put_char(out, *str++);
+	}
+}
+
+static void put_str(struct nrf_cloud_obj_json_stream *const out, const char *str)
+{
+	put_char(out, '"');
+
+	for (; *str; str++) {
+		const unsigned char c = *str;
+		char esc[7];
+
+		switch (c) {
+		case '"':
+			put_raw(out, "\\\"");
+			break;
+		case '\\':
+			put_raw(out, "\\\\");
+			break;
+		case '\b':
+			put_raw(out, "\\b");
+			break;
+		case '\f':
+			put_raw(out, "\\f");
+			break;
+		case '\n':
+			put_raw(out, "\\n");
+			break;
+		case '\r':
+			put_raw(out, "\\r");
+			break;
+		case '\t':
+			put_raw(out, "\\t");
+			break;
+		default:
+			if (c < 0x20) {
+				snprintf(esc, sizeof(esc), "\\u%04x", c);
+				put_raw(out, esc);
+			} else {
+				put_char(out, c);
+			}
+			break;
+		}
+	}
+
+	put_char(out, '"');
+}
+
+/* Print numbers the same way as cJSON does */
+static void put_num(struct nrf_cloud_obj_json_stream *const out, const double val)
+{
+	char num[NUM_STR_SIZE];
+
+	if (isnan(val) || isinf(val)) {
+		put_raw(out, "null");
+		return;
+	}
+
+	if ((val == floor(val)) && (fabs(val) < 1e15)) {
+		snprintf(num, sizeof(num), "%lld", (long long)val);
+	} else {
+		snprintf(num, sizeof(num), "%1.15g", val);
+
+		if (strtod(num, NULL) != val) {
+			snprintf(num, sizeof(num), "%1.17g", val);
+		}
+	}
+
+	put_raw(out, num);
+}
+
+static void put_key(struct nrf_cloud_obj_json_stream *const out, const char *const key,
+		    const bool first)
+{
+	if (!first) {
+		put_char(out, ',');
+	}
+
+	put_str(out, key);
+	put_char(out, ':');
+}
+
+static void put_pvt(struct nrf_cloud_obj_json_stream *const out,
+		    const struct nrf_cloud_gnss_pvt *const pvt)
+{
+	put_char(out, '{');
+	put_key(out, NRF_CLOUD_JSON_GNSS_PVT_KEY_LON, true);
+	put_num(out, pvt->lon);
+	put_key(out, NRF_CLOUD_JSON_GNSS_PVT_KEY_LAT, false);
+	put_num(out, pvt->lat);
+	put_key(out, NRF_CLOUD_JSON_GNSS_PVT_KEY_ACCURACY, false);
+	put_num(out, pvt->accuracy);
+
+	if (pvt->has_alt) {
+		put_key(out, NRF_CLOUD_JSON_GNSS_PVT_KEY_ALTITUDE, false);
+		put_num(out, pvt->alt);
+	}
+
+	if (pvt->has_speed) {
+		put_key(out, NRF_CLOUD_JSON_GNSS_PVT_KEY_SPEED, false);
+		put_num(out, pvt->speed);
+	}
+
+	if (pvt->has_heading) {
+		put_key(out, NRF_CLOUD_JSON_GNSS_PVT_KEY_HEADING, false);
+		put_num(out, pvt->heading);
+	}
+
+	put_char(out, '}');
+}
+
+int nrf_cloud_msg_json_buf_encode(const struct nrf_cloud_obj_coap_cbor *const msg,
+				  char *const buf, size_t *const len)
+{
+	if (!msg || !msg->app_id || !len || (!buf && *len)) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_obj_json_stream out = {
+		.buf = buf,
+		.size = *len,
+	};
+
+	put_char(&out, '{');
+	put_key(&out, NRF_CLOUD_JSON_APPID_KEY, true);
+	put_str(&out, msg->app_id);
+	put_key(&out, NRF_CLOUD_JSON_MSG_TYPE_KEY, false);
+	put_str(&out, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+
+	if (msg->ts != NRF_CLOUD_NO_TIMESTAMP) {
+		put_key(&out, NRF_CLOUD_MSG_TIMESTAMP_KEY, false);
+		put_num(&out, (double)msg->ts);
+	}
+
+	put_key(&out, NRF_CLOUD_JSON_DATA_KEY, false);
+
+	switch (msg->type) {
+	case NRF_CLOUD_DATA_TYPE_STR:
+		if (!msg->str_val) {
+			return -EINVAL;
+		}
+		put_str(&out, msg->str_val);
+		break;
+	case NRF_CLOUD_DATA_TYPE_PVT:
+		if (!msg->pvt) {
+			return -EINVAL;
+		}
+		put_pvt(&out, msg->pvt);
+		break;
+	case NRF_CLOUD_DATA_TYPE_INT:
+		put_num(&out, msg->int_val);
+		break;
+	case NRF_CLOUD_DATA_TYPE_DOUBLE:
+		put_num(&out, msg->double_val);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	put_char(&out, '}');
+
+	/* Report the required size, excluding the terminator, if the buffer is too small */
+	if (out.len >= out.size) {
+		*len = out.len;
+		return -E2BIG;
+	}
+
+	buf[out.len] = '\0';
+	*len = out.len;
+
+	return 0;
+}
+
+static int stream_object_open(struct nrf_cloud_obj_json_stream *const stream)
+{
+	if (stream->depth >= STREAM_DEPTH_MAX) {
+		return -E2BIG;
+	}
+
+	put_char(stream, '{');
+	stream->depth++;
+	stream->members &= ~BIT(stream->depth);
+
+	return 0;
+}
+
+static void stream_object_close(struct nrf_cloud_obj_json_stream *const stream)
+{
+	put_char(stream, '}');
+	stream->depth--;
+}
+
+static void stream_key_put(struct nrf_cloud_obj_json_stream *const stream, const char *const key)
+{
+	put_key(stream, key, !(stream->members & BIT(stream->depth)));
+	stream->members |= BIT(stream->depth);
+}
+
+/* Room must be left to close the open objects and terminate the output */
+static int stream_check(const struct nrf_cloud_obj_json_stream *const stream)
+{
+	return (stream->len + stream->depth < stream->size) ? 0 : -ENOMEM;
+}
+
+/* Write the key of a new member, opening or closing the "data" object as needed */
+static int stream_member_begin(struct nrf_cloud_obj_json_stream *const stream,
+			       const char *const key, const bool data_child)
+{
+	const uint8_t level = stream->data_depth ? stream->data_depth : 1;
+	int err;
+
+	if (!stream->depth) {
+		return -ENOENT;
+	}
+
+	err = stream_check(stream);
+	if (err) {
+		return err;
+	}
+
+	/* Members of nested objects ignore data_child */
+	if (stream->depth == level) {
+		if (data_child && !stream->data_depth) {
+			if (stream->data_closed) {
+				return -EPERM;
+			}
+
+			stream_key_put(stream, NRF_CLOUD_JSON_DATA_KEY);
+			err = stream_object_open(stream);
+			if (err) {
+				return err;
+			}
+
+			stream->data_depth = stream->depth;
+		} else if (!data_child && stream->data_depth) {
+			stream_object_close(stream);
+			stream->data_depth = 0;
+			stream->data_closed = true;
+		}
+	}
+
+	stream_key_put(stream, key);
+
+	return 0;
+}
+
+int nrf_cloud_json_stream_init(struct nrf_cloud_obj_json_stream *const stream,
+			       const char *const app_id, const char *const msg_type)
+{
+	if (!stream->buf || !stream->size) {
+		return -EINVAL;
+	}
+
+	if (stream->depth) {
+		return -ENOTEMPTY;
+	}
+
+	stream->len = 0;
+	stream->members = 0;
+	stream->data_depth = 0;
+	stream->data_closed = false;
+
+	(void)stream_object_open(stream);
+
+	if (app_id) {
+		stream_key_put(stream, NRF_CLOUD_JSON_APPID_KEY);
+		put_str(stream, app_id);
+	}
+
+	if (app_id && msg_type) {
+		stream_key_put(stream, NRF_CLOUD_JSON_MSG_TYPE_KEY);
+		put_str(stream, msg_type);
+	}
+
+	return stream_check(stream);
+}
+
+void nrf_cloud_json_stream_free(struct nrf_cloud_obj_json_stream *const stream)
+{
+	stream->len = 0;
+	stream->depth = 0;
+}
+
+int nrf_cloud_json_stream_num_add(struct nrf_cloud_obj_json_stream *const stream,
+				  const char *const key, const double val, const bool data_child)
+{
+	int err = stream_member_begin(stream, key, data_child);
+
+	if (err) {
+		return err;
+	}
+
+	put_num(stream, val);
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_str_add(struct nrf_cloud_obj_json_stream *const stream,
+				  const char *const key, const char *const val,
+				  const bool data_child)
+{
+	int err = stream_member_begin(stream, key, data_child);
+
+	if (err) {
+		return err;
+	}
+
+	put_str(stream, val);
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_bool_add(struct nrf_cloud_obj_json_stream *const stream,
+				   const char *const key, const bool val, const bool data_child)
+{
+	int err = stream_member_begin(stream, key, data_child);
+
+	if (err) {
+		return err;
+	}
+
+	put_raw(stream, val ? "true" : "false");
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_null_add(struct nrf_cloud_obj_json_stream *const stream,
+				   const char *const key, const bool data_child)
+{
+	int err = stream_member_begin(stream, key, data_child);
+
+	if (err) {
+		return err;
+	}
+
+	put_raw(stream, "null");
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_int_array_add(struct nrf_cloud_obj_json_stream *const stream,
+					const char *const key, const uint32_t ints[],
+					const uint32_t ints_cnt, const bool data_child)
+{
+	int err = stream_member_begin(stream, key, data_child);
+
+	if (err) {
+		return err;
+	}
+
+	put_char(stream, '[');
+	for (uint32_t i = 0; i < ints_cnt; i++) {
+		if (i) {
+			put_char(stream, ',');
+		}
+		put_num(stream, (int)ints[i]);
+	}
+	put_char(stream, ']');
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_str_array_add(struct nrf_cloud_obj_json_stream *const stream,
+					const char *const key, const char *const strs[],
+					const uint32_t strs_cnt, const bool data_child)
+{
+	int err = stream_member_begin(stream, key, data_child);
+
+	if (err) {
+		return err;
+	}
+
+	put_char(stream, '[');
+	for (uint32_t i = 0; i < strs_cnt; i++) {
+		if (i) {
+			put_char(stream, ',');
+		}
+		put_str(stream, strs[i]);
+	}
+	put_char(stream, ']');
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_object_begin(struct nrf_cloud_obj_json_stream *const stream,
+				       const char *const key, const bool data_child)
+{
+	int err = stream_member_begin(stream, key, data_child);
+
+	if (err) {
+		return err;
+	}
+
+	err = stream_object_open(stream);
+	if (err) {
+		return err;
+	}
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_object_end(struct nrf_cloud_obj_json_stream *const stream)
+{
+	const uint8_t level = stream->data_depth ? stream->data_depth : 1;
+
+	if (stream->depth <= level) {
+		return -ENOENT;
+	}
+
+	stream_object_close(stream);
+
+	return stream_check(stream);
+}
+
+int nrf_cloud_json_stream_end(struct nrf_cloud_obj_json_stream *const stream,
+			      struct nrf_cloud_data *const output)
+{
+	if (!stream->depth) {
+		return -ENOENT;
+	}
+
+	while (stream->depth) {
+		stream_object_close(stream);
+	}
+
+	if (stream->len >= stream->size) {
+		return -ENOMEM;
+	}
+
+	stream->buf[stream->len] = '\0';
+
+	output->ptr = stream->buf;
+	output->len = stream->len;
+
+	return 0;
+}
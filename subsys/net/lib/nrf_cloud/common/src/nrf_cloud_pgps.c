@@ -192,6 +192,66 @@ static struct nrf_cloud_pgps_prediction *get_prediction_slot(int slot, off_t *fl
 	return get_cached_prediction(off);
 }
 
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)
+/* Store the block of each prediction so the catalog does not need to be
+ * rebuilt from flash at the next boot.
+ */
+static void save_prediction_index(bool valid)
+{
+	struct npgps_prediction_index idx = {0};
+
+	if (valid) {
+		idx.gps_day = index.header.gps_day;
+		idx.gps_time_of_day = index.header.gps_time_of_day;
+	}
+
+	for (int pnum = 0; pnum < NUM_PREDICTIONS; pnum++) {
+		idx.block[pnum] = (valid && index.predictions[pnum]) ? get_prediction_block(pnum)
+								     : NO_BLOCK;
+	}
+
+	if (npgps_save_index(&idx)) {
+		LOG_WRN("Failed to save prediction index");
+	}
+}
+
+/* Restore the catalog of predictions from the saved index, if it belongs to the
+ * stored prediction set. Predictions are not read; each one is validated when it
+ * is selected by nrf_cloud_pgps_find_prediction().
+ */
+static bool load_prediction_index(void)
+{
+	const struct npgps_prediction_index *idx = npgps_get_saved_index();
+	bool used[NUM_PREDICTIONS] = {0};
+
+	if ((idx->gps_day != index.header.gps_day) ||
+	    (idx->gps_time_of_day != index.header.gps_time_of_day)) {
+		LOG_DBG("No prediction index for stored predictions");
+		return false;
+	}
+
+	for (int pnum = 0; pnum < index.header.prediction_count; pnum++) {
+		int block = idx->block[pnum];
+
+		if (block == NO_BLOCK) {
+			index.predictions[pnum] = NULL;
+			continue;
+		}
+
+		if ((block < 0) || (block >= NUM_BLOCKS) || used[block]) {
+			LOG_WRN("Prediction index is corrupted");
+			memset(index.predictions, 0, sizeof(index.predictions));
+			return false;
+		}
+
+		used[block] = true;
+		index.predictions[pnum] = npgps_block_to_pointer(block);
+	}
+
+	return true;
+}
+#endif /* CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX */
+
 static int determine_prediction_num(struct nrf_cloud_pgps_header *header,
 				    struct nrf_cloud_pgps_prediction *p)
 {
@@ -306,6 +366,7 @@ static int validate_stored_predictions(uint16_t *first_bad_day, uint32_t *first_
 	int64_t start_gps_sec = index.start_sec;
 	off_t off;
 	int64_t gps_sec;
+	bool indexed = false;
 
 	/* reset catalog of predictions */
 	discard_prediction_buffer();
@@ -315,8 +376,12 @@ static int validate_stored_predictions(uint16_t *first_bad_day, uint32_t *first_
 
 	npgps_reset_block_pool();
 
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)
+	indexed = load_prediction_index();
+#endif
+
 	/* build catalog of predictions by block */
-	for (i = 0; i < count; i++) {
+	for (i = 0; !indexed && (i < count); i++) {
 		pred = (struct nrf_cloud_pgps_prediction *)get_prediction_slot(i, &off);
 		if (pred == NULL) {
 			LOG_ERR("Prediction at idx:%d not accessible", i);
@@ -344,7 +409,14 @@ static int validate_stored_predictions(uint16_t *first_bad_day, uint32_t *first_
 		gps_sec = start_gps_sec + pnum * period_min * SEC_PER_MIN;
 		npgps_gps_sec_to_day_time(gps_sec, &gps_day, &gps_time_of_day);
 
-		pred = get_prediction(pnum);
+		if (indexed && index.predictions[pnum]) {
+			/* validated when selected */
+			i = get_prediction_block(pnum);
+			npgps_mark_block_used(i, true);
+			continue;
+		}
+
+		pred = indexed ? NULL : get_prediction(pnum);
 		if (pred == NULL) {
 			LOG_WRN("Prediction num:%u missing", pnum);
 			/* request partial data; download interrupted? */
@@ -663,8 +735,21 @@ int nrf_cloud_pgps_find_prediction(struct nrf_cloud_pgps_prediction **prediction
 	index.cur_pnum = pnum;
 	*prediction = get_prediction(pnum);
 	if (*prediction) {
-		err = validate_prediction(*prediction, cur_gps_day, cur_gps_time_of_day, period_min,
-					  false, margin);
+		if (IS_ENABLED(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)) {
+			uint16_t pred_day;
+			uint32_t pred_time;
+
+			/* Predictions restored from the index have not been read yet */
+			get_prediction_day_time(pnum, NULL, &pred_day, &pred_time);
+			err = validate_prediction(*prediction, pred_day, pred_time, period_min,
+						  true, false);
+		} else {
+			err = 0;
+		}
+		if (!err) {
+			err = validate_prediction(*prediction, cur_gps_day, cur_gps_time_of_day,
+						  period_min, false, margin);
+		}
 		if (!err) {
 			start_expiration_timer(pnum, cur_gps_sec);
 			return pnum;
@@ -1495,6 +1580,9 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 				}
 
 				LOG_INF("All P-GPS data received. Done.");
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)
+				save_prediction_index(true);
+#endif
 				state = PGPS_READY;
 				if (evt_handler) {
 					struct nrf_cloud_pgps_event evt = {.type = PGPS_EVT_READY,
@@ -1570,6 +1658,11 @@ int nrf_cloud_pgps_begin_update(void)
 	}
 	state = PGPS_LOADING;
 
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)
+	/* Blocks are about to be rewritten */
+	save_prediction_index(false);
+#endif
+
 	if (!index.partial_request) {
 		index.header.prediction_count = NUM_PREDICTIONS;
 		index.header.prediction_period_min = PREDICTION_PERIOD;
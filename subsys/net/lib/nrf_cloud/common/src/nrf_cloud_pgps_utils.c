@@ -29,6 +29,8 @@ LOG_MODULE_DECLARE(nrf_cloud_pgps, CONFIG_NRF_CLOUD_GPS_LOG_LEVEL);
 #define SETTINGS_FULL_LOCATION	  SETTINGS_NAME "/" SETTINGS_KEY_LOCATION
 #define SETTINGS_KEY_LEAP_SEC	  "g2u_leap_sec"
 #define SETTINGS_FULL_LEAP_SEC	  SETTINGS_NAME "/" SETTINGS_KEY_LEAP_SEC
+#define SETTINGS_KEY_PRED_INDEX	  "pred_index"
+#define SETTINGS_FULL_PRED_INDEX  SETTINGS_NAME "/" SETTINGS_KEY_PRED_INDEX
 
 struct block_pool {
 	int first_free;
@@ -44,6 +46,9 @@ static int num_blocks;
 static int gps_leap_seconds = GPS_TO_UTC_LEAP_SECONDS;
 static struct gps_location saved_location;
 static struct nrf_cloud_pgps_header saved_header;
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)
+static struct npgps_prediction_index saved_index;
+#endif
 
 static K_SEM_DEFINE(dl_active, 1, 1);
 
@@ -97,6 +102,16 @@ static int settings_set(const char *key, size_t len_rd, settings_read_cb read_cb
 			return 0;
 		}
 	}
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)
+	if (!strncmp(key, SETTINGS_KEY_PRED_INDEX, strlen(SETTINGS_KEY_PRED_INDEX)) &&
+	    (len_rd == sizeof(saved_index))) {
+		if (read_cb(cb_arg, (void *)&saved_index, len_rd) == len_rd) {
+			LOG_DBG("Read prediction index: day:%u, time:%u", saved_index.gps_day,
+				saved_index.gps_time_of_day);
+			return 0;
+		}
+	}
+#endif
 	return -ENOTSUP;
 }
 
@@ -132,6 +147,20 @@ const struct nrf_cloud_pgps_header *npgps_get_saved_header(void)
 	return &saved_header;
 }
 
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREDICTION_INDEX)
+int npgps_save_index(const struct npgps_prediction_index *idx)
+{
+	LOG_DBG("Saving prediction index");
+	memcpy(&saved_index, idx, sizeof(saved_index));
+	return settings_save_one(SETTINGS_FULL_PRED_INDEX, &saved_index, sizeof(saved_index));
+}
+
+const struct npgps_prediction_index *npgps_get_saved_index(void)
+{
+	return &saved_index;
+}
+#endif
+
 /* @TODO: consider rate-limiting these updates to reduce Flash wear */
 static int save_location(void)
 {
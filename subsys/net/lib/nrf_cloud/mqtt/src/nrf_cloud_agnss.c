@@ -53,9 +53,6 @@ int nrf_cloud_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *reques
 	__ASSERT(request->system[0].system_id == NRF_MODEM_GNSS_SYSTEM_GPS,
 		 "GPS data need not found");
 
-	if (nfsm_get_current_state() != STATE_DC_CONNECTED) {
-		return -EACCES;
-	}
 	if (!request) {
 		return -EINVAL;
 	}
@@ -65,6 +62,18 @@ int nrf_cloud_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *reques
 	/* Copy the request so that the ephemeris mask can be modified if necessary */
 	struct nrf_modem_gnss_agnss_data_frame req = *request;
 
+#if defined(CONFIG_NRF_CLOUD_AGNSS_CACHE)
+	/* Cached data is injected even if the cloud connection is not established. */
+	if (!nrf_cloud_agnss_cache_apply(&req)) {
+		LOG_DBG("All requested A-GNSS data injected from cache");
+		return 0;
+	}
+#endif
+
+	if (nfsm_get_current_state() != STATE_DC_CONNECTED) {
+		return -EACCES;
+	}
+
 	nrf_cloud_agnss_set_request_in_progress(0);
 
 #if defined(CONFIG_NRF_CLOUD_AGNSS_FILTERED)
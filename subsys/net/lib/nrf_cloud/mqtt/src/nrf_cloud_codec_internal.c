@@ -60,37 +60,35 @@ int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *sensor,
 	__ASSERT_NO_MSG(output != NULL);
 	__ASSERT_NO_MSG(sensor_type_str != NULL);
 
-	cJSON *root_obj = cJSON_CreateObject();
-
-	if (root_obj == NULL) {
-		return -ENOMEM;
-	}
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = (char *)sensor_type_str,
+		.type = NRF_CLOUD_DATA_TYPE_STR,
+		.str_val = (char *)sensor->data.ptr,
+		.ts = sensor->ts_ms,
+	};
+	size_t len = 0;
+	char *buffer;
 
-	ret = !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str);
-	ret += !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
-	ret += !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-					  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
-	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
-		ret += !cJSON_AddNumberToObjectCS(root_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY,
-						  sensor->ts_ms);
+	/* Get the required size, then encode the message with a single allocation */
+	ret = nrf_cloud_msg_json_buf_encode(&msg, NULL, &len);
+	if (ret != -E2BIG) {
+		return ret ? ret : -EINVAL;
 	}
 
-	if (ret != 0) {
-		cJSON_Delete(root_obj);
+	len++;
+	buffer = nrf_cloud_malloc(len);
+	if (buffer == NULL) {
 		return -ENOMEM;
 	}
 
-	char *buffer;
-
-	buffer = cJSON_PrintUnformatted(root_obj);
-	cJSON_Delete(root_obj);
-
-	if (buffer == NULL) {
-		return -ENOMEM;
+	ret = nrf_cloud_msg_json_buf_encode(&msg, buffer, &len);
+	if (ret) {
+		nrf_cloud_free(buffer);
+		return ret;
 	}
 
 	output->ptr = buffer;
-	output->len = strlen(buffer);
+	output->len = len;
 
 	return 0;
 }
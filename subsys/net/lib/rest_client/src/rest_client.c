@@ -5,6 +5,7 @@
  */
 
 #include <string.h>
+#include <strings.h>
 #include <zephyr/kernel.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -22,6 +23,25 @@
 LOG_MODULE_REGISTER(rest_client, CONFIG_REST_CLIENT_LOG_LEVEL);
 
 #define HTTP_PROTOCOL "HTTP/1.1"
+#define HTTP_PROTOCOL_1_0 "HTTP/1.0"
+
+#if defined(CONFIG_REST_CLIENT_CONN_POOL)
+struct rest_client_pool_conn {
+	bool in_use;
+	int fd;
+	char host[CONFIG_REST_CLIENT_CONN_POOL_HOST_MAX_LEN + 1];
+	uint16_t port;
+	int sec_tag;
+	int tls_peer_verify;
+	int64_t idle_since;
+};
+
+static struct rest_client_pool_conn pool[CONFIG_REST_CLIENT_CONN_POOL_SIZE];
+static K_MUTEX_DEFINE(pool_lock);
+
+static void rest_client_pool_idle_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(pool_idle_work, rest_client_pool_idle_work_fn);
+#endif /* defined(CONFIG_REST_CLIENT_CONN_POOL) */
 
 static int rest_client_http_response_cb(struct http_response *rsp,
 					enum http_final_call final_data,
@@ -144,15 +164,20 @@ static int rest_client_sckt_tls_setup(int fd, const char *const tls_hostname,
 	return 0;
 }
 
-static int rest_client_sckt_timeouts_set(int fd, int32_t timeout_ms)
+/* Timeouts of a reused socket are always set, as they may have been set by a previous request. */
+static int rest_client_sckt_timeouts_set(int fd, int32_t timeout_ms, bool reused)
 {
 	int err;
 	struct timeval timeout = { 0 };
+	bool timeout_enabled = (timeout_ms != SYS_FOREVER_MS && timeout_ms > 0);
+
+	if (timeout_enabled || reused) {
+		if (timeout_enabled) {
+			/* Send TO also affects TCP connect */
+			timeout.tv_sec = timeout_ms / MSEC_PER_SEC;
+			timeout.tv_usec = (timeout_ms % MSEC_PER_SEC) * USEC_PER_MSEC;
+		}
 
-	if (timeout_ms != SYS_FOREVER_MS && timeout_ms > 0) {
-		/* Send TO also affects TCP connect */
-		timeout.tv_sec = timeout_ms / MSEC_PER_SEC;
-		timeout.tv_usec = (timeout_ms % MSEC_PER_SEC) * USEC_PER_MSEC;
 		err = zsock_setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout,
 				       sizeof(timeout));
 		if (err) {
@@ -243,7 +268,7 @@ static int rest_client_sckt_connect(int *const fd,
 		}
 	}
 
-	ret = rest_client_sckt_timeouts_set(*fd, *timeout_ms - time_used);
+	ret = rest_client_sckt_timeouts_set(*fd, *timeout_ms - time_used, false);
 	if (ret) {
 		LOG_ERR("Failed to set socket timeouts, error: %d", errno);
 		ret = -EINVAL;
@@ -289,6 +314,194 @@ clean_up:
 	return ret;
 }
 
+#if defined(CONFIG_REST_CLIENT_CONN_POOL)
+static void rest_client_pool_conn_close(struct rest_client_pool_conn *conn)
+{
+	if (zsock_close(conn->fd)) {
+		LOG_WRN("Failed to close pooled socket, error: %d", errno);
+	} else {
+		LOG_DBG("Pooled socket with id: %d was closed", conn->fd);
+	}
+
+	conn->in_use = false;
+}
+
+static void rest_client_pool_idle_work_fn(struct k_work *work)
+{
+	int64_t timeout_ms = CONFIG_REST_CLIENT_CONN_POOL_IDLE_TIMEOUT * MSEC_PER_SEC;
+	int64_t now = k_uptime_get();
+	int64_t next = INT64_MAX;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (!pool[i].in_use) {
+			continue;
+		}
+
+		if ((now - pool[i].idle_since) >= timeout_ms) {
+			rest_client_pool_conn_close(&pool[i]);
+		} else {
+			next = MIN(next, pool[i].idle_since + timeout_ms);
+		}
+	}
+
+	if (next != INT64_MAX) {
+		(void)k_work_reschedule(&pool_idle_work, K_MSEC(next - now));
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
+
+static bool rest_client_pool_conn_match(const struct rest_client_pool_conn *conn,
+					const struct rest_client_req_context *req_ctx)
+{
+	return conn->in_use && (conn->port == req_ctx->port) &&
+	       (conn->sec_tag == req_ctx->sec_tag) &&
+	       (conn->tls_peer_verify == req_ctx->tls_peer_verify) &&
+	       !strcmp(conn->host, req_ctx->host);
+}
+
+/* Returns the socket of an idle connection to the requested server, or -1 if there is none.
+ * The connection is removed from the pool while it is used by the request.
+ */
+static int rest_client_pool_take(const struct rest_client_req_context *req_ctx)
+{
+	int fd = -1;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (rest_client_pool_conn_match(&pool[i], req_ctx)) {
+			pool[i].in_use = false;
+			fd = pool[i].fd;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&pool_lock);
+
+	if (fd > -1) {
+		LOG_DBG("Reusing pooled socket with id: %d", fd);
+	}
+
+	return fd;
+}
+
+static void rest_client_pool_put(const struct rest_client_req_context *req_ctx)
+{
+	struct rest_client_pool_conn *conn = NULL;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (!pool[i].in_use) {
+			conn = &pool[i];
+			break;
+		}
+
+		if (!conn || (pool[i].idle_since < conn->idle_since)) {
+			conn = &pool[i];
+		}
+	}
+
+	if (conn->in_use) {
+		/* Pool is full, replace the connection that has been idle for the longest time. */
+		rest_client_pool_conn_close(conn);
+	}
+
+	conn->in_use = true;
+	conn->fd = req_ctx->connect_socket;
+	strcpy(conn->host, req_ctx->host);
+	conn->port = req_ctx->port;
+	conn->sec_tag = req_ctx->sec_tag;
+	conn->tls_peer_verify = req_ctx->tls_peer_verify;
+	conn->idle_since = k_uptime_get();
+
+	if (!k_work_delayable_is_pending(&pool_idle_work)) {
+		(void)k_work_schedule(&pool_idle_work,
+				      K_SECONDS(CONFIG_REST_CLIENT_CONN_POOL_IDLE_TIMEOUT));
+	}
+
+	k_mutex_unlock(&pool_lock);
+
+	LOG_DBG("Socket with id: %d was put in the connection pool", req_ctx->connect_socket);
+}
+
+/* Checks a block of header lines for the "Connection: close" header. */
+static bool rest_client_conn_close_hdr_find(const char *hdr, size_t len)
+{
+	static const char name[] = "Connection:";
+	static const char close_val[] = "close";
+	const char *end = hdr + len;
+	const char *line = hdr;
+
+	while (line < end) {
+		const char *eol = memchr(line, '\n', end - line);
+		const char *line_end = eol ? eol : end;
+
+		if (((line_end - line) >= (sizeof(name) - 1)) &&
+		    !strncasecmp(line, name, sizeof(name) - 1)) {
+			const char *val = line + sizeof(name) - 1;
+
+			while ((val < line_end) && (*val == ' ')) {
+				val++;
+			}
+
+			if (((line_end - val) >= (sizeof(close_val) - 1)) &&
+			    !strncasecmp(val, close_val, sizeof(close_val) - 1)) {
+				return true;
+			}
+		}
+
+		line = line_end + 1;
+	}
+
+	return false;
+}
+
+/* A connection is pooled only if both sides allow a persistent connection. */
+static bool rest_client_conn_reusable(const struct rest_client_req_context *req_ctx,
+				      const struct rest_client_resp_context *resp_ctx)
+{
+	size_t hdr_len;
+
+	if (strlen(req_ctx->host) > CONFIG_REST_CLIENT_CONN_POOL_HOST_MAX_LEN) {
+		return false;
+	}
+
+	for (const char **field = req_ctx->header_fields; field && *field; field++) {
+		if (rest_client_conn_close_hdr_find(*field, strlen(*field))) {
+			return false;
+		}
+	}
+
+	if (!strncmp(req_ctx->resp_buff, HTTP_PROTOCOL_1_0, sizeof(HTTP_PROTOCOL_1_0) - 1)) {
+		return false;
+	}
+
+	hdr_len = resp_ctx->response ? (resp_ctx->response - req_ctx->resp_buff) :
+				       resp_ctx->total_response_len;
+
+	return !rest_client_conn_close_hdr_find(req_ctx->resp_buff, hdr_len);
+}
+
+void rest_client_conn_pool_flush(void)
+{
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (pool[i].in_use) {
+			rest_client_pool_conn_close(&pool[i]);
+		}
+	}
+
+	(void)k_work_cancel_delayable(&pool_idle_work);
+
+	k_mutex_unlock(&pool_lock);
+}
+#endif /* defined(CONFIG_REST_CLIENT_CONN_POOL) */
+
 static void rest_client_close_connection(struct rest_client_req_context *const req_ctx,
 					 struct rest_client_resp_context *const resp_ctx)
 {
@@ -397,6 +610,10 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
 
 	struct http_request http_req;
 	int ret;
+#if defined(CONFIG_REST_CLIENT_CONN_POOL)
+	bool pool_conn;
+	bool reused = false;
+#endif
 
 	rest_client_init_request(req_ctx, &http_req);
 
@@ -419,7 +636,31 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
 		}
 	}
 
+#if defined(CONFIG_REST_CLIENT_CONN_POOL)
+	/* Only the connections that are opened and closed by the library are pooled. */
+	pool_conn = (req_ctx->connect_socket < 0) && !req_ctx->keep_alive;
+	if (pool_conn) {
+		req_ctx->connect_socket = rest_client_pool_take(req_ctx);
+		reused = (req_ctx->connect_socket > -1);
+		if (reused && rest_client_sckt_timeouts_set(req_ctx->connect_socket,
+							    req_ctx->timeout_ms, true)) {
+			(void)zsock_close(req_ctx->connect_socket);
+			req_ctx->connect_socket = REST_CLIENT_SCKT_CONNECT;
+			reused = false;
+		}
+	}
+
+	ret = rest_client_do_api_call(&http_req, req_ctx, resp_ctx);
+	if (ret && reused && (resp_ctx->total_response_len == 0)) {
+		/* The server may have closed the idle connection, try a new one. */
+		LOG_DBG("Pooled connection failed, err %d, reconnecting", ret);
+		(void)zsock_close(req_ctx->connect_socket);
+		req_ctx->connect_socket = REST_CLIENT_SCKT_CONNECT;
+		ret = rest_client_do_api_call(&http_req, req_ctx, resp_ctx);
+	}
+#else
 	ret = rest_client_do_api_call(&http_req, req_ctx, resp_ctx);
+#endif
 	if (ret) {
 		LOG_ERR("rest_client_do_api_call() failed, err %d", ret);
 		goto clean_up;
@@ -437,6 +678,13 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
 	LOG_DBG("API call response len: http status: %d, %u bytes", resp_ctx->http_status_code,
 		resp_ctx->response_len);
 
+#if defined(CONFIG_REST_CLIENT_CONN_POOL)
+	if (pool_conn && rest_client_conn_reusable(req_ctx, resp_ctx)) {
+		rest_client_pool_put(req_ctx);
+		req_ctx->connect_socket = REST_CLIENT_SCKT_CONNECT;
+	}
+#endif
+
 clean_up:
 	if (req_ctx->connect_socket != REST_CLIENT_SCKT_CONNECT) {
 		/* Socket was not closed yet: */
@@ -6,6 +6,7 @@
 
 #include <zephyr/kernel.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <zephyr/smf.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_ctrl.h>
@@ -38,6 +39,18 @@ LOG_MODULE_REGISTER(softap_wifi_provision, CONFIG_SOFTAP_WIFI_PROVISION_LOG_LEVE
 #define RESPONSE_404 "HTTP/1.1 404 Not Found\r\n"
 #define RESPONSE_405 "HTTP/1.1 405 Method Not Allowed\r\n"
 
+/* Space reserved for the headers of the pre-encoded scan results response. */
+#define SCAN_RESPONSE_HEADERS_SIZE 256
+
+/* Smallest change in signal strength, in dBm, that triggers re-encoding of the scan results. */
+#define SCAN_RSSI_CHANGE_MIN 5
+
+/* Number of re-scans of its channel that a network can be missing from before it is removed. */
+#define SCAN_RECORD_MISSED_MAX 3
+
+/* Channels covered by the background re-scans. */
+#define RESCAN_CHANNEL_MAX 13
+
 /* Zephyr NET management events that this module subscribes to. */
 #define NET_MGMT_WIFI (NET_EVENT_WIFI_AP_ENABLE_RESULT		| \
 		       NET_EVENT_WIFI_AP_DISABLE_RESULT		| \
@@ -51,7 +64,15 @@ LOG_MODULE_REGISTER(softap_wifi_provision, CONFIG_SOFTAP_WIFI_PROVISION_LOG_LEVE
 static struct net_mgmt_event_callback net_l2_mgmt_cb;
 static ScanResults scan = ScanResults_init_zero;
 static uint8_t scan_result_buffer[CONFIG_SOFTAP_WIFI_PROVISION_SCAN_RESULT_BUFFER_SIZE];
-static size_t scan_result_buffer_len;
+/* Set when the cached scan results differ from the encoded ones. */
+static bool scan_changed;
+/* Protects the cached scan results, that are updated from the NET management thread. */
+static K_MUTEX_DEFINE(scan_lock);
+/* HTTP response to the scan results request, encoded only when the scan results change. */
+static char scan_response[SCAN_RESPONSE_HEADERS_SIZE +
+			  CONFIG_SOFTAP_WIFI_PROVISION_SCAN_RESULT_BUFFER_SIZE];
+static size_t scan_response_len;
+static K_MUTEX_DEFINE(scan_response_lock);
 static const struct smf_state state[];
 static struct http_parser_settings parser_settings;
 static char linkaddr_string[sizeof("xxxxxxxxxxxx")];
@@ -66,6 +87,27 @@ static bool credentials_stored;
 /* Local reference to the library callers handler, used to send events to the application. */
 static softap_wifi_provision_evt_handler_t handler_cb;
 
+#if defined(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN)
+BUILD_ASSERT(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN_CHANNELS <= CONFIG_WIFI_MGMT_SCAN_CHAN_MAX_MANUAL,
+	     "More channels per re-scan than supported by Wi-Fi management");
+
+/* Channels of the ongoing re-scan, unused entries are 0. All channels for the initial scan. */
+static uint8_t rescan_channels[CONFIG_SOFTAP_WIFI_PROVISION_RESCAN_CHANNELS];
+static uint8_t rescan_channel_next = 1;
+/* Per cached network, whether it was seen in the ongoing scan and how many re-scans of its
+ * channel it has been missing from.
+ */
+static bool scan_seen[ARRAY_SIZE(scan.results)];
+static uint8_t scan_missed[ARRAY_SIZE(scan.results)];
+/* Set while a client request is processed, re-scans are postponed until it is completed. */
+static atomic_t request_active;
+
+static void rescan_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(rescan_work, rescan_work_fn);
+#endif /* CONFIG_SOFTAP_WIFI_PROVISION_RESCAN */
+
+static int scan_response_update(void);
+
 /* Calculate the size of the mDNS SD TXT record.
  * Per RFC6763, TXT Record entries are structured into key-value pairs where each entry is preceded
  * by the total total size of the respective entry.
@@ -181,51 +223,93 @@ static void new_event(enum module_event event)
 	}
 }
 
+/* Fill a scan record from a scan result.
+ *
+ * @retval true if the record has changed.
+ */
+static bool scan_record_fill(ScanRecord *record, const struct wifi_scan_result *entry)
+{
+	ScanRecord prev = *record;
+
+	record->has_wifi = true;
+
+	/* SSID */
+	size_t ssid_len = MIN(entry->ssid_length, sizeof(record->wifi.ssid.bytes));
+
+	memcpy(record->wifi.ssid.bytes, entry->ssid, ssid_len);
+	record->wifi.ssid.size = ssid_len;
+
+	/* BSSID */
+	size_t bssid_len = MIN(entry->mac_length, sizeof(record->wifi.bssid.bytes));
+
+	memcpy(record->wifi.bssid.bytes, entry->mac, bssid_len);
+	record->wifi.bssid.size = bssid_len;
+
+	/* Band */
+	record->wifi.has_band = true;
+	record->wifi.band =
+		(entry->band == WIFI_FREQ_BAND_2_4_GHZ) ? Band_BAND_2_4_GHZ :
+		(entry->band == WIFI_FREQ_BAND_5_GHZ) ? Band_BAND_5_GHZ :
+		Band_BAND_ANY;
+
+	/* Channel */
+	record->wifi.channel = entry->channel;
+
+	/* Auth mode - defaults to AuthMode_WPA_WPA2_PSK. */
+	record->wifi.has_auth = true;
+	record->wifi.auth =
+		(entry->security == WIFI_SECURITY_TYPE_NONE) ? AuthMode_OPEN :
+		(entry->security == WIFI_SECURITY_TYPE_PSK) ? AuthMode_WPA_WPA2_PSK :
+		(entry->security == WIFI_SECURITY_TYPE_PSK_SHA256) ? AuthMode_WPA2_PSK :
+		(entry->security == WIFI_SECURITY_TYPE_SAE) ? AuthMode_WPA3_PSK :
+		AuthMode_WPA_WPA2_PSK;
+
+	/* Signal strength, small variations are ignored to not re-encode the results after
+	 * every scan.
+	 */
+	if (!prev.has_rssi || (abs(prev.rssi - entry->rssi) >= SCAN_RSSI_CHANGE_MIN)) {
+		record->has_rssi = true;
+		record->rssi = entry->rssi;
+	}
+
+	return memcmp(&prev, record, sizeof(prev)) != 0;
+}
+
 static void wifi_scan_result_handle(struct net_mgmt_event_callback *cb)
 {
 	const struct wifi_scan_result *entry = (const struct wifi_scan_result *)cb->info;
+	size_t i;
 
-	if (scan.results_count < ARRAY_SIZE(scan.results)) {
-
-		scan.results[scan.results_count].has_wifi = true;
-
-		/* SSID */
-		size_t ssid_len = MIN(entry->ssid_length,
-				      sizeof(scan.results[scan.results_count].wifi.ssid.bytes));
-		memcpy(scan.results[scan.results_count].wifi.ssid.bytes, entry->ssid, ssid_len);
-		scan.results[scan.results_count].wifi.ssid.size = ssid_len;
-
-		/* BSSID */
-		size_t bssid_len = MIN(entry->mac_length,
-				       sizeof(scan.results[scan.results_count].wifi.bssid.bytes));
-		memcpy(scan.results[scan.results_count].wifi.bssid.bytes, entry->mac, bssid_len);
-		scan.results[scan.results_count].wifi.bssid.size = bssid_len;
-
-		/* Band */
-		scan.results[scan.results_count].wifi.has_band = true;
-		scan.results[scan.results_count].wifi.band =
-			(entry->band == WIFI_FREQ_BAND_2_4_GHZ) ? Band_BAND_2_4_GHZ :
-			(entry->band == WIFI_FREQ_BAND_5_GHZ) ? Band_BAND_5_GHZ :
-			Band_BAND_ANY;
-
-		/* Channel */
-		scan.results[scan.results_count].wifi.channel = entry->channel;
-
-		/* Auth mode - defaults to AuthMode_WPA_WPA2_PSK. */
-		scan.results[scan.results_count].wifi.has_auth = true;
-		scan.results[scan.results_count].wifi.auth =
-			(entry->security == WIFI_SECURITY_TYPE_NONE) ? AuthMode_OPEN :
-			(entry->security == WIFI_SECURITY_TYPE_PSK) ? AuthMode_WPA_WPA2_PSK :
-			(entry->security == WIFI_SECURITY_TYPE_PSK_SHA256) ? AuthMode_WPA2_PSK :
-			(entry->security == WIFI_SECURITY_TYPE_SAE) ? AuthMode_WPA3_PSK :
-			AuthMode_WPA_WPA2_PSK;
-
-		/* Signal strength */
-		scan.results[scan.results_count].has_rssi = true;
-		scan.results[scan.results_count].rssi = entry->rssi;
+	k_mutex_lock(&scan_lock, K_FOREVER);
 
+	/* Networks are identified by BSSID, so that re-scans update the cached results. */
+	for (i = 0; i < scan.results_count; i++) {
+		if ((scan.results[i].wifi.bssid.size == entry->mac_length) &&
+		    (memcmp(scan.results[i].wifi.bssid.bytes, entry->mac, entry->mac_length) == 0)) {
+			break;
+		}
+	}
+
+	if (i == scan.results_count) {
+		if (scan.results_count == ARRAY_SIZE(scan.results)) {
+			k_mutex_unlock(&scan_lock);
+			return;
+		}
+
+		memset(&scan.results[i], 0, sizeof(scan.results[i]));
 		scan.results_count++;
 	}
+
+	if (scan_record_fill(&scan.results[i], entry)) {
+		scan_changed = true;
+	}
+
+#if defined(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN)
+	scan_seen[i] = true;
+	scan_missed[i] = 0;
+#endif
+
+	k_mutex_unlock(&scan_lock);
 }
 
 static void dhcp_server_start(void)
@@ -342,6 +426,117 @@ static int wifi_scan(void)
 	return 0;
 }
 
+#if defined(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN)
+static bool rescan_channel_covered(uint8_t channel)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(rescan_channels); i++) {
+		if (rescan_channels[i] == channel) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Remove the networks that have been missing from too many re-scans of their channel.
+ *
+ * @retval true if the cached scan results have changed since they were last encoded.
+ */
+static bool rescan_age(void)
+{
+	size_t i = 0;
+	size_t remaining;
+	bool changed;
+
+	k_mutex_lock(&scan_lock, K_FOREVER);
+
+	while (i < scan.results_count) {
+		if (scan_seen[i] || !rescan_channel_covered(scan.results[i].wifi.channel) ||
+		    (++scan_missed[i] < SCAN_RECORD_MISSED_MAX)) {
+			i++;
+			continue;
+		}
+
+		LOG_DBG("Network %.*s no longer found", scan.results[i].wifi.ssid.size,
+			scan.results[i].wifi.ssid.bytes);
+
+		scan.results_count--;
+		remaining = scan.results_count - i;
+
+		memmove(&scan.results[i], &scan.results[i + 1], remaining * sizeof(scan.results[0]));
+		memmove(&scan_seen[i], &scan_seen[i + 1], remaining * sizeof(scan_seen[0]));
+		memmove(&scan_missed[i], &scan_missed[i + 1], remaining * sizeof(scan_missed[0]));
+
+		scan_changed = true;
+	}
+
+	changed = scan_changed;
+
+	k_mutex_unlock(&scan_lock);
+
+	return changed;
+}
+
+/* Scan the next few channels, so that the access point is off its channel only briefly. */
+static void rescan_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	int ret;
+	struct net_if *iface = net_if_get_first_wifi();
+	struct wifi_scan_params params = {
+		.bands = BIT(WIFI_FREQ_BAND_2_4_GHZ),
+	};
+
+	if (atomic_get(&request_active)) {
+		/* Do not scan while a client is being served. */
+		k_work_reschedule(&rescan_work, K_SECONDS(1));
+		return;
+	}
+
+	k_mutex_lock(&scan_lock, K_FOREVER);
+
+	memset(scan_seen, 0, sizeof(scan_seen));
+
+	for (size_t i = 0; i < ARRAY_SIZE(rescan_channels); i++) {
+		rescan_channels[i] = rescan_channel_next;
+		params.band_chan[i].band = WIFI_FREQ_BAND_2_4_GHZ;
+		params.band_chan[i].channel = rescan_channel_next;
+
+		rescan_channel_next = (rescan_channel_next % RESCAN_CHANNEL_MAX) + 1;
+	}
+
+	k_mutex_unlock(&scan_lock);
+
+	LOG_DBG("Re-scanning from channel %d", rescan_channels[0]);
+
+	ret = net_mgmt(NET_REQUEST_WIFI_SCAN, iface, &params, sizeof(params));
+	if (ret) {
+		LOG_WRN("Failed to start Wi-Fi re-scan, error: %d", ret);
+
+		memset(rescan_channels, 0, sizeof(rescan_channels));
+		k_work_reschedule(&rescan_work,
+				  K_SECONDS(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN_INTERVAL));
+	}
+}
+
+static void rescan_done(void)
+{
+	int ret;
+
+	if (rescan_age()) {
+		LOG_DBG("Scan results changed, updating response");
+
+		ret = scan_response_update();
+		if (ret) {
+			LOG_ERR("scan_response_update, error: %d", ret);
+		}
+	}
+
+	k_work_reschedule(&rescan_work, K_SECONDS(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN_INTERVAL));
+}
+#endif /* CONFIG_SOFTAP_WIFI_PROVISION_RESCAN */
+
 static int ap_enable(void)
 {
 	int ret;
@@ -653,20 +848,16 @@ static void unprovisioned_exit(void *o)
 
 	LOG_DBG("Scanning for Wi-Fi networks completed, preparing protobuf payload");
 
-	/* If we have received all scan results, copy them to a buffer and
-	 * notify the application.
+	/* If we have received all scan results, encode the response to the scan results
+	 * request, so that it is ready when the client connects.
 	 */
-	pb_ostream_t stream = pb_ostream_from_buffer(scan_result_buffer,
-						     sizeof(scan_result_buffer));
-	if (!pb_encode(&stream, ScanResults_fields, &scan)) {
-		LOG_ERR("Encoding scan results failed");
+	int ret = scan_response_update();
+
+	if (ret) {
+		LOG_ERR("scan_response_update, error: %d", ret);
 		notify_app(SOFTAP_WIFI_PROVISION_EVT_FATAL_ERROR);
 		return;
 	}
-
-	LOG_DBG("Protobuf payload prepared, scan results encoded, size: %d", stream.bytes_written);
-
-	scan_result_buffer_len = stream.bytes_written;
 }
 
 /* Scan for available Wi-Fi networks when we enter the provisioning state. */
@@ -696,6 +887,14 @@ static enum smf_state_result provisioning_run(void *o)
 	if (user_object->event_next == EVENT_AP_ENABLE) {
 		/* Start DHCP server */
 		dhcp_server_start();
+
+#if defined(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN)
+		/* Keep the scan results up to date while waiting for the client. */
+		k_work_schedule(&rescan_work,
+				K_SECONDS(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN_INTERVAL));
+	} else if (user_object->event_next == EVENT_SCAN_DONE) {
+		rescan_done();
+#endif /* CONFIG_SOFTAP_WIFI_PROVISION_RESCAN */
 	} else if (user_object->event_next == EVENT_CREDENTIALS_RECEIVED) {
 		smf_set_state(SMF_CTX(&state_object), &state[STATE_PROVISIONED]);
 	} else if (user_object->event_next == EVENT_RESET) {
@@ -717,6 +916,10 @@ static void provisioning_exit(void *o)
 
 	LOG_DBG("Credentials received, cleaning up...");
 
+#if defined(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN)
+	k_work_cancel_delayable(&rescan_work);
+#endif
+
 	/* Sleep before stopping the DHCPv4 server and exiting AP mode to allow time
 	 * for ongoing TCP sessions to gracefully close. This minimizes the risk of
 	 * connection errors and data loss during the teardown process.
@@ -878,6 +1081,56 @@ static int append_cors_headers_and_crlf(char *response, size_t len, size_t *curr
 	return 0;
 }
 
+/* Encode the cached scan results and the HTTP response to the scan results request. */
+static int scan_response_update(void)
+{
+	int ret;
+	bool encoded;
+	size_t len;
+	pb_ostream_t stream = pb_ostream_from_buffer(scan_result_buffer,
+						     sizeof(scan_result_buffer));
+
+	k_mutex_lock(&scan_lock, K_FOREVER);
+
+	encoded = pb_encode(&stream, ScanResults_fields, &scan);
+	scan_changed = false;
+
+	k_mutex_unlock(&scan_lock);
+
+	if (!encoded) {
+		LOG_ERR("Encoding scan results failed");
+		return -ENOMEM;
+	}
+
+	LOG_DBG("Protobuf payload prepared, scan results encoded, size: %d", stream.bytes_written);
+
+	k_mutex_lock(&scan_response_lock, K_FOREVER);
+
+	ret = snprintk(scan_response, SCAN_RESPONSE_HEADERS_SIZE,
+		       "%sContent-Type: application/x-protobuf\r\nContent-Length: %d\r\n",
+		       RESPONSE_200, stream.bytes_written);
+	if ((ret < 0) || (ret >= SCAN_RESPONSE_HEADERS_SIZE)) {
+		LOG_ERR("snprintk, error: %d", ret);
+		ret = -ENOMEM;
+		goto unlock;
+	}
+
+	len = ret;
+	ret = append_cors_headers_and_crlf(scan_response, SCAN_RESPONSE_HEADERS_SIZE, &len);
+	if (ret) {
+		LOG_ERR("append_cors_headers_and_crlf, error: %d", ret);
+		goto unlock;
+	}
+
+	memcpy(scan_response + len, scan_result_buffer, stream.bytes_written);
+	scan_response_len = len + stream.bytes_written;
+
+unlock:
+	k_mutex_unlock(&scan_response_lock);
+
+	return ret;
+}
+
 int method_verify(enum http_method method, enum http_method method_expected,
 		  char *response, size_t len, int socket)
 {
@@ -944,7 +1197,7 @@ static int http_request_handle(struct http_req *request, char *response, size_t
 
 	if ((strlen(request->url) == sizeof("/prov/networks") - 1) &&
 	    (strncmp(request->url, "/prov/networks", strlen(request->url)) == 0)) {
-		/* Wi-Fi scan requested, return the cached scan results. */
+		/* Wi-Fi scan requested, return the pre-encoded scan results. */
 
 		ret = method_verify(request->method, HTTP_GET, response, len, socket);
 		if (ret == -ENOTSUP) {
@@ -955,32 +1208,13 @@ static int http_request_handle(struct http_req *request, char *response, size_t
 			return ret;
 		}
 
-		ret = snprintk(response, len,
-			"%sContent-Type: application/x-protobuf\r\nContent-Length: %d\r\n",
-			RESPONSE_200, scan_result_buffer_len);
-		if ((ret < 0) || (ret >= len)) {
-			LOG_DBG("snprintk, error: %d", ret);
-			return ret;
-		}
-
-		current_len = ret;
-		ret = append_cors_headers_and_crlf(response, len, &current_len);
-		if (ret) {
-			LOG_ERR("append_cors_headers_and_crlf, error: %d", ret);
-			return ret;
-		}
-
-		/* Send headers */
-		ret = send_response(request, response, current_len, socket);
-		if (ret) {
-			LOG_ERR("send_response (headers), error: %d", ret);
-			return ret;
-		}
+		/* Send headers and payload */
+		k_mutex_lock(&scan_response_lock, K_FOREVER);
+		ret = send_response(request, scan_response, scan_response_len, socket);
+		k_mutex_unlock(&scan_response_lock);
 
-		/* Send payload */
-		ret = send_response(request, scan_result_buffer, scan_result_buffer_len, socket);
 		if (ret) {
-			LOG_ERR("send_response (payload), error: %d", ret);
+			LOG_ERR("send_response, error: %d", ret);
 			return ret;
 		}
 
@@ -1075,6 +1309,10 @@ static int process_tcp(sa_family_t family)
 	net_addr_ntop(client_addr.sin6_family, &client_addr.sin6_addr, addr_str, sizeof(addr_str));
 	LOG_DBG("[%d] Connection from %s accepted", accepted, addr_str);
 
+#if defined(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN)
+	atomic_set(&request_active, 1);
+#endif
+
 	http_parser_init(&request.parser, HTTP_REQUEST);
 
 	while (true) {
@@ -1112,6 +1350,10 @@ socket_close:
 	LOG_DBG("Closing listening socket: %d", accepted);
 	(void)close(accepted);
 
+#if defined(CONFIG_SOFTAP_WIFI_PROVISION_RESCAN)
+	atomic_set(&request_active, 0);
+#endif
+
 	return ret;
 }
 
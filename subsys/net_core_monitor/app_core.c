@@ -28,6 +28,7 @@ static K_WORK_DELAYABLE_DEFINE(ncm_work, ncm_work_handler);
 static int ncm_net_status_check(uint32_t * const reset_reas)
 {
 	uint32_t gpmem;
+	uint32_t reas;
 	uint16_t cnt;
 	static uint16_t prv_cnt;
 
@@ -35,15 +36,17 @@ static int ncm_net_status_check(uint32_t * const reset_reas)
 	cnt = (uint16_t)((gpmem & CNT_MSK) >> CNT_POS);
 
 	if (gpmem & (FLAGS_RESET << FLAGS_POS)) {
+		/* Read the reason for the reset before clearing the reset flag.
+		 * Afterwards, the network core can write its load to the same memory cell.
+		 */
+		reas = nrfx_ipc_gpmem_get(IPC_MEM_REAS_IDX);
+		nrfx_ipc_gpmem_set(IPC_MEM_REAS_IDX, 0);
+
 		gpmem &= ~(FLAGS_RESET << FLAGS_POS);
 		nrfx_ipc_gpmem_set(IPC_MEM_CNT_IDX, gpmem);
 
-		/* Read the reason for the reset. */
-		gpmem = nrfx_ipc_gpmem_get(IPC_MEM_REAS_IDX);
-		nrfx_ipc_gpmem_set(IPC_MEM_REAS_IDX, 0);
-
 		if (reset_reas) {
-			*reset_reas = gpmem;
+			*reset_reas = reas;
 		}
 
 		prv_cnt = 0;
@@ -76,6 +79,25 @@ static void ncm_work_handler(struct k_work *work)
 	k_work_reschedule(&ncm_work, K_MSEC(NET_CORE_CHECK_INTERVAL_MSEC));
 }
 
+#if defined(CONFIG_NCM_NET_CORE_LOAD)
+int ncm_net_core_load_get(void)
+{
+	uint32_t gpmem;
+
+	if (nrfx_ipc_gpmem_get(IPC_MEM_CNT_IDX) & (FLAGS_RESET << FLAGS_POS)) {
+		return -ENODATA;
+	}
+
+	gpmem = nrfx_ipc_gpmem_get(IPC_MEM_LOAD_IDX);
+
+	if (!(gpmem & LOAD_VALID)) {
+		return -ENODATA;
+	}
+
+	return (gpmem & LOAD_MSK) >> LOAD_POS;
+}
+#endif
+
 __weak void ncm_net_core_event_handler(enum ncm_event_type event, uint32_t reset_reas)
 {
 	switch (event) {
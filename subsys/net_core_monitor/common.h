@@ -21,6 +21,14 @@ extern "C" {
 #define IPC_MEM_CNT_IDX  0      /** Index of the memory cell that stores the counter. */
 #define IPC_MEM_REAS_IDX 1      /** Index of the memory cell that stores the reset reason. */
 
+/* The reset reason memory cell stores the network core load after the application core
+ * has acknowledged the reset by clearing the reset flag.
+ */
+#define IPC_MEM_LOAD_IDX IPC_MEM_REAS_IDX
+#define LOAD_POS     (0UL)                  /* Position of Load field. */
+#define LOAD_MSK     (0xFF << LOAD_POS)     /* Bit mask of Load field. */
+#define LOAD_VALID   BIT(31)                /* Load field is valid. */
+
 #ifdef __cplusplus
 }
 #endif
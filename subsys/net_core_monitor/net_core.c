@@ -25,6 +25,37 @@ LOG_MODULE_REGISTER(net_core_monitor, CONFIG_NET_CORE_MONITOR_LOG_LEVEL);
 static void ncm_work_handler(struct k_work *work);
 static K_WORK_DELAYABLE_DEFINE(ncm_work, ncm_work_handler);
 
+#if defined(CONFIG_NCM_NET_CORE_LOAD)
+static void ncm_load_update(uint32_t gpmem)
+{
+	static uint64_t prv_execution_cycles;
+	static uint64_t prv_total_cycles;
+	k_thread_runtime_stats_t stats;
+	uint64_t execution_cycles;
+	uint32_t load = 0;
+
+	if (k_thread_runtime_stats_all_get(&stats)) {
+		return;
+	}
+
+	/* The execution cycles include the idle thread, the total cycles do not. */
+	execution_cycles = stats.execution_cycles - prv_execution_cycles;
+	if (execution_cycles > 0) {
+		load = (stats.total_cycles - prv_total_cycles) * 100 / execution_cycles;
+	}
+
+	prv_execution_cycles = stats.execution_cycles;
+	prv_total_cycles = stats.total_cycles;
+
+	/* The memory cell holds the reset reason until the application core reads it. */
+	if (gpmem & (FLAGS_RESET << FLAGS_POS)) {
+		return;
+	}
+
+	APP_IPC_GPMEM[IPC_MEM_LOAD_IDX] = LOAD_VALID | ((MIN(load, 100) << LOAD_POS) & LOAD_MSK);
+}
+#endif
+
 static void ncm_work_handler(struct k_work *work)
 {
 	static uint16_t live_cnt = CNT_INIT_VAL;
@@ -34,6 +65,10 @@ static void ncm_work_handler(struct k_work *work)
 	gpmem = (gpmem & (~CNT_MSK)) | (live_cnt << CNT_POS);
 	APP_IPC_GPMEM[IPC_MEM_CNT_IDX] = gpmem;
 
+#if defined(CONFIG_NCM_NET_CORE_LOAD)
+	ncm_load_update(gpmem);
+#endif
+
 	k_work_reschedule(&ncm_work, K_MSEC(CONFIG_NCM_FEEDING_INTERVAL_MSEC));
 }
 
@@ -7,6 +7,9 @@
 #include <zephyr/sys/ring_buffer.h>
 #include <nfc_platform.h>
 #include "platform_internal.h"
+#if defined(CONFIG_NFC_T4T_FAST_READ)
+#include <nfc/t4t/fast_read.h>
+#endif
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_DECLARE(nfc_platform, CONFIG_NFC_PLATFORM_LOG_LEVEL);
@@ -232,6 +235,13 @@ void nfc_platform_cb_request(const void *ctx,
 	uint32_t size;
 	uint32_t exp_size;
 
+#if defined(CONFIG_NFC_T4T_FAST_READ)
+	/* Reads of the precomputed NDEF File are answered without leaving the interrupt. */
+	if (data && (data_len > 0) && nfc_t4t_fast_read_handle(data, data_len)) {
+		return;
+	}
+#endif
+
 	header.ctx_size = ctx_len;
 	header.flags = copy_data ? NFC_HDR_FLAG_COPY : 0;
 	header.data_size = data_len;
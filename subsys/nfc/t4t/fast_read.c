@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <nfc_t4t_lib.h>
+#include <nfc/t4t/apdu.h>
+#include <nfc/t4t/ndef_file.h>
+#include <nfc/t4t/fast_read.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(nfc_t4t_fast_read, CONFIG_NFC_T4T_FAST_READ_LOG_LEVEL);
+
+#define C_APDU_HEADER_SIZE 4
+#define C_APDU_LC_OFFSET 4
+#define C_APDU_DATA_OFFSET 5
+#define C_APDU_P1_P2_OFFSET 2
+#define RAPDU_STATUS_SIZE 2
+#define RAPDU_STATUS_WRONG_PARAMS 0x6B00
+
+#define NDEF_APP_AID {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01}
+#define FILE_ID_SIZE 2
+#define CC_FILE_ID 0xE103
+#define NDEF_FILE_ID 0xE104
+
+#define CC_FILE_SIZE 0x0F
+#define CC_MAPPING_VERSION 0x20
+#define CC_MAX_C_APDU_SIZE 0x00FF
+#define CC_NDEF_FILE_CONTROL_TLV 0x04
+#define CC_NDEF_FILE_CONTROL_TLV_LEN 0x06
+#define CC_READ_ACCESS_GRANTED 0x00
+#define CC_WRITE_ACCESS_DENIED 0xFF
+
+/* Offset field of READ BINARY is 15 bits long. */
+#define NDEF_FILE_MAX_SIZE 0x7FFF
+
+#define MAX_LE CONFIG_NFC_T4T_FAST_READ_MAX_LE
+
+enum selected_item {
+	SELECTED_NONE,
+	SELECTED_APP,
+	SELECTED_CC_FILE,
+	SELECTED_NDEF_FILE
+};
+
+static const uint8_t ndef_app_aid[] = NDEF_APP_AID;
+
+static const uint8_t *ndef_file;
+static uint16_t ndef_file_size;
+static uint8_t cc_file[CC_FILE_SIZE];
+static enum selected_item selected;
+
+/* The R-APDU is assembled in place, so that it is sent with a single copy. */
+static uint8_t rapdu[MAX_LE + RAPDU_STATUS_SIZE];
+
+static void cc_file_build(uint16_t max_ndef_size)
+{
+	uint8_t *p = cc_file;
+
+	sys_put_be16(CC_FILE_SIZE, p);
+	p += sizeof(uint16_t);
+	*p++ = CC_MAPPING_VERSION;
+	sys_put_be16(MAX_LE, p);
+	p += sizeof(uint16_t);
+	sys_put_be16(CC_MAX_C_APDU_SIZE, p);
+	p += sizeof(uint16_t);
+	*p++ = CC_NDEF_FILE_CONTROL_TLV;
+	*p++ = CC_NDEF_FILE_CONTROL_TLV_LEN;
+	sys_put_be16(NDEF_FILE_ID, p);
+	p += sizeof(uint16_t);
+	sys_put_be16(max_ndef_size, p);
+	p += sizeof(uint16_t);
+	*p++ = CC_READ_ACCESS_GRANTED;
+	*p++ = CC_WRITE_ACCESS_DENIED;
+
+	__ASSERT_NO_MSG(p == &cc_file[CC_FILE_SIZE]);
+}
+
+static bool rapdu_send(size_t data_len, uint16_t status)
+{
+	int err;
+
+	sys_put_be16(status, &rapdu[data_len]);
+
+	err = nfc_t4t_response_pdu_send(rapdu, data_len + RAPDU_STATUS_SIZE);
+	if (err) {
+		LOG_DBG("Failed to send R-APDU, err %d", err);
+	}
+
+	return true;
+}
+
+static bool select_handle(const uint8_t *apdu, size_t len)
+{
+	uint16_t p1_p2 = sys_get_be16(&apdu[C_APDU_P1_P2_OFFSET]);
+	uint8_t lc;
+
+	if (len <= C_APDU_LC_OFFSET) {
+		return false;
+	}
+
+	lc = apdu[C_APDU_LC_OFFSET];
+	if (len < (C_APDU_DATA_OFFSET + lc)) {
+		return false;
+	}
+
+	if (p1_p2 == NFC_T4T_APDU_SELECT_BY_NAME) {
+		if ((lc == sizeof(ndef_app_aid)) &&
+		    (memcmp(&apdu[C_APDU_DATA_OFFSET], ndef_app_aid, lc) == 0)) {
+			selected = SELECTED_APP;
+			return rapdu_send(0, NFC_T4T_APDU_RAPDU_STATUS_CMD_COMPLETED);
+		}
+
+		/* Other applications are handled by the application callback. */
+		selected = SELECTED_NONE;
+		return false;
+	}
+
+	if ((p1_p2 != NFC_T4T_APDU_SELECT_BY_FILE_ID) || (selected == SELECTED_NONE)) {
+		return false;
+	}
+
+	if (lc == FILE_ID_SIZE) {
+		switch (sys_get_be16(&apdu[C_APDU_DATA_OFFSET])) {
+		case CC_FILE_ID:
+			selected = SELECTED_CC_FILE;
+			return rapdu_send(0, NFC_T4T_APDU_RAPDU_STATUS_CMD_COMPLETED);
+		case NDEF_FILE_ID:
+			selected = SELECTED_NDEF_FILE;
+			return rapdu_send(0, NFC_T4T_APDU_RAPDU_STATUS_CMD_COMPLETED);
+		default:
+			break;
+		}
+	}
+
+	selected = SELECTED_APP;
+	return rapdu_send(0, NFC_T4T_APDU_RAPDU_STATUS_SEL_ITEM_NOT_FOUND);
+}
+
+static bool read_handle(const uint8_t *apdu, size_t len)
+{
+	uint16_t offset = sys_get_be16(&apdu[C_APDU_P1_P2_OFFSET]);
+	const uint8_t *file;
+	size_t file_size;
+	size_t le;
+
+	if (selected == SELECTED_CC_FILE) {
+		file = cc_file;
+		file_size = sizeof(cc_file);
+	} else if (selected == SELECTED_NDEF_FILE) {
+		file = ndef_file;
+		file_size = ndef_file_size;
+	} else {
+		return false;
+	}
+
+	/* Zero Le field means the maximum response length. */
+	le = ((len > C_APDU_LC_OFFSET) && (apdu[C_APDU_LC_OFFSET] != 0)) ?
+	     apdu[C_APDU_LC_OFFSET] : MAX_LE;
+	le = MIN(le, MAX_LE);
+
+	if (offset > file_size) {
+		return rapdu_send(0, RAPDU_STATUS_WRONG_PARAMS);
+	}
+
+	le = MIN(le, file_size - offset);
+	memcpy(rapdu, &file[offset], le);
+
+	return rapdu_send(le, NFC_T4T_APDU_RAPDU_STATUS_CMD_COMPLETED);
+}
+
+int nfc_t4t_fast_read_ndef_set(const uint8_t *file, size_t size)
+{
+	unsigned int key;
+
+	if (file && ((size < NFC_NDEF_FILE_NLEN_FIELD_SIZE) || (size > NDEF_FILE_MAX_SIZE))) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	ndef_file = file;
+	ndef_file_size = file ? size : 0;
+	if (file) {
+		cc_file_build(ndef_file_size);
+	}
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+bool nfc_t4t_fast_read_handle(const uint8_t *apdu, size_t len)
+{
+	if (!ndef_file || !apdu || (len < C_APDU_HEADER_SIZE) ||
+	    (apdu[0] != NFC_T4T_APDU_CLASS_BYTE_NO_SECURE_MSG)) {
+		return false;
+	}
+
+	switch (apdu[1]) {
+	case NFC_T4T_APDU_COMM_INS_SELECT:
+		return select_handle(apdu, len);
+	case NFC_T4T_APDU_COMM_INS_READ:
+		return read_handle(apdu, len);
+	default:
+		return false;
+	}
+}
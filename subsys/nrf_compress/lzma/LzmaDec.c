@@ -78,7 +78,7 @@
 		i -= limit;                                                                        \
 	}
 
-/* #define Z7_LZMA_SIZE_OPT */
+/* Z7_LZMA_SIZE_OPT is defined by CONFIG_NRF_COMPRESS_LZMA_OPTIMIZATION_SIZE. */
 
 #ifdef Z7_LZMA_SIZE_OPT
 #define TREE_6_DECODE(probs, i) TREE_DECODE(probs, (1 << 6), i)
@@ -94,15 +94,16 @@ static int disable_event_profiling(const struct shell *shell, size_t argc,
 	return 0;
 }
 
-SHELL_STATIC_SUBCMD_SET_CREATE(sub_nrf_profiler,
-	SHELL_CMD_ARG(list, NULL, "Display list of events",
-			display_registered_events, 0, 0),
-	SHELL_CMD_ARG(enable, NULL, "Enable profiling of event with given ID",
-			enable_event_profiling, 1,
-			sizeof(_nrf_profiler_event_enabled_bm) * 8),
-	SHELL_CMD_ARG(disable, NULL, "Disable profiling of event with given ID",
-			disable_event_profiling, 1,
-			sizeof(_nrf_profiler_event_enabled_bm) * 8),
-	SHELL_SUBCMD_SET_END
-);
+/* Other modules can extend the command set using SHELL_SUBCMD_ADD((nrf_profiler), ...). */
+SHELL_SUBCMD_SET_CREATE(sub_nrf_profiler, (nrf_profiler));
+
+SHELL_SUBCMD_ADD((nrf_profiler), list, NULL, "Display list of events",
+		 display_registered_events, 0, 0);
+SHELL_SUBCMD_ADD((nrf_profiler), enable, NULL, "Enable profiling of event with given ID",
+		 enable_event_profiling, 1,
+		 sizeof(_nrf_profiler_event_enabled_bm) * 8);
+SHELL_SUBCMD_ADD((nrf_profiler), disable, NULL, "Disable profiling of event with given ID",
+		 disable_event_profiling, 1,
+		 sizeof(_nrf_profiler_event_enabled_bm) * 8);
+
 SHELL_CMD_REGISTER(nrf_profiler, &sub_nrf_profiler, "Profiler commands", NULL);
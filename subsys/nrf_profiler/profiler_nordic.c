@@ -9,6 +9,8 @@
 #include <zephyr/sys/time_units.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/timing/timing.h>
 #include <zephyr/kernel.h>
 #include <SEGGER_RTT.h>
 #include <nrf_profiler.h>
@@ -58,6 +60,22 @@ static uint8_t buffer_commands[CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE];
 
 static k_tid_t protocol_thread_id;
 
+#if IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_BATCHING)
+#define THREAD_SLEEP_TIME K_MSEC(CONFIG_NRF_PROFILER_NORDIC_BATCHING_FLUSH_INTERVAL_MS)
+
+struct event_ring {
+	struct ring_buf rb;
+	struct k_spinlock lock;
+	uint32_t dropped_cnt;
+	uint8_t buf[CONFIG_NRF_PROFILER_NORDIC_BATCHING_BUFFER_SIZE];
+};
+
+static struct event_ring event_rings[CONFIG_MP_MAX_NUM_CPUS];
+static uint16_t dropped_events_event_id;
+#else
+#define THREAD_SLEEP_TIME K_MSEC(500)
+#endif
+
 static K_THREAD_STACK_DEFINE(nrf_profiler_nordic_stack,
 			     CONFIG_NRF_PROFILER_NORDIC_STACK_SIZE);
 static struct k_thread nrf_profiler_nordic_thread;
@@ -126,6 +144,29 @@ static int send_system_description(void)
 	return err;
 }
 
+static uint32_t timestamp_freq_get(void)
+{
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_TIMESTAMP_TIMING)) {
+		return (uint32_t)timing_freq_get();
+	}
+
+	return sys_clock_hw_cycles_per_sec();
+}
+
+uint32_t nrf_profiler_timestamp_get(void)
+{
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_TIMESTAMP_TIMING)) {
+		return (uint32_t)timing_counter_get();
+	}
+
+	return k_cycle_get_32();
+}
+
+uint32_t nrf_profiler_timestamp_to_us(uint32_t ticks)
+{
+	return (uint32_t)(((uint64_t)ticks * USEC_PER_SEC) / timestamp_freq_get());
+}
+
 static int send_system_configuration(void)
 {
 	char sys_clock_buf[13];
@@ -133,12 +174,13 @@ static int send_system_configuration(void)
 	int err;
 	static const char * const sys_config_start = "<sys_config_start>\n";
 	static const char * const sys_config_stop = "<sys_config_stop>\n";
+	/* Host tools use this parameter to convert the event timestamps. */
 	static const char * const sys_clock_param_name = "sys_clock_hw_cycles_per_sec";
 
 	temp_val = snprintf(sys_clock_buf,
 						sizeof(sys_clock_buf),
 						",%" PRIu32 "\n",
-						sys_clock_hw_cycles_per_sec());
+						timestamp_freq_get());
 	if ((temp_val < 0) || ((size_t)temp_val >= sizeof(sys_clock_buf))) {
 		return -ENOMEM;
 	}
@@ -163,6 +205,84 @@ static int send_system_configuration(void)
 	return err;
 }
 
+static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id);
+
+#if IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_BATCHING)
+static void event_rings_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(event_rings); i++) {
+		ring_buf_init(&event_rings[i].rb, sizeof(event_rings[i].buf), event_rings[i].buf);
+	}
+}
+
+static void event_ring_put(const struct log_event_buf *buf)
+{
+	size_t data_len = buf->payload - buf->payload_start;
+	unsigned int irq_key = arch_irq_lock();
+	/* Interrupts are locked, so the thread cannot migrate to another CPU. */
+	struct event_ring *ring = &event_rings[arch_curr_cpu()->id];
+	k_spinlock_key_t key = k_spin_lock(&ring->lock);
+
+	/* Events are never split, so that the host can always parse the stream. */
+	if (ring_buf_space_get(&ring->rb) >= data_len) {
+		uint32_t written = ring_buf_put(&ring->rb, buf->payload_start, data_len);
+
+		__ASSERT_NO_MSG(written == data_len);
+		ARG_UNUSED(written);
+	} else {
+		ring->dropped_cnt++;
+	}
+
+	k_spin_unlock(&ring->lock, key);
+	arch_irq_unlock(irq_key);
+}
+
+static void event_ring_flush(struct event_ring *ring)
+{
+	k_spinlock_key_t key = k_spin_lock(&ring->lock);
+
+	while (!ring_buf_is_empty(&ring->rb)) {
+		uint8_t *data;
+		uint32_t avail = SEGGER_RTT_GetAvailWriteSpace(
+					CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA);
+		uint32_t len = ring_buf_get_claim(&ring->rb, &data, avail);
+
+		if (len == 0) {
+			/* Host has not read the data yet. Continue on next flush. */
+			break;
+		}
+
+		len = SEGGER_RTT_WriteNoLock(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+					     data, len);
+
+		int err = ring_buf_get_finish(&ring->rb, len);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+	}
+
+	if ((ring->dropped_cnt > 0) && ring_buf_is_empty(&ring->rb)) {
+		struct log_event_buf buf;
+
+		nrf_profiler_log_start(&buf);
+		nrf_profiler_log_encode_uint32(&buf, ring->dropped_cnt);
+
+		if (nrf_profiler_RTT_send(&buf, (uint8_t)dropped_events_event_id)) {
+			ring->dropped_cnt = 0;
+		}
+	}
+
+	k_spin_unlock(&ring->lock, key);
+}
+
+static void event_rings_flush(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(event_rings); i++) {
+		event_ring_flush(&event_rings[i]);
+	}
+}
+#endif /* CONFIG_NRF_PROFILER_NORDIC_BATCHING */
+
 static void nrf_profiler_nordic_thread_fn(void)
 {
 	int ret_err;
@@ -196,7 +316,12 @@ static void nrf_profiler_nordic_thread_fn(void)
 				break;
 			}
 		}
-		k_sleep(K_MSEC(500));
+
+#if IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_BATCHING)
+		event_rings_flush();
+#endif
+
+		k_sleep(THREAD_SLEEP_TIME);
 	}
 	k_sem_give(&nrf_profiler_sem);
 }
@@ -223,6 +348,15 @@ int nrf_profiler_init(void)
 
 	int ret;
 
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_TIMESTAMP_TIMING)) {
+		timing_init();
+		timing_start();
+	}
+
+#if IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_BATCHING)
+	event_rings_init();
+#endif
+
 	ret = SEGGER_RTT_ConfigUpBuffer(
 		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
 		"Nordic nrf_profiler data",
@@ -258,6 +392,17 @@ int nrf_profiler_init(void)
 	fatal_error_event_id = nrf_profiler_register_event_type("_nrf_profiler_fatal_error_event_",
 							    NULL, NULL, 0);
 
+#if IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_BATCHING)
+	static const char * const dropped_events_labels[] = {"count"};
+	static const enum nrf_profiler_arg dropped_events_types[] = {NRF_PROFILER_ARG_U32};
+
+	/* Registering dropped events event */
+	dropped_events_event_id = nrf_profiler_register_event_type(
+					"_nrf_profiler_dropped_events_",
+					dropped_events_labels, dropped_events_types,
+					ARRAY_SIZE(dropped_events_labels));
+#endif
+
 	k_sched_unlock();
 	return 0;
 }
@@ -330,7 +475,7 @@ void nrf_profiler_log_start(struct log_event_buf *buf)
 {
 	/* Adding one to pointer to make space for event type ID */
 	buf->payload = buf->payload_start + sizeof(uint8_t);
-	nrf_profiler_log_encode_uint32(buf, k_cycle_get_32());
+	nrf_profiler_log_encode_uint32(buf, nrf_profiler_timestamp_get());
 }
 
 void nrf_profiler_log_encode_uint32(struct log_event_buf *buf, uint32_t data)
@@ -391,6 +536,14 @@ void nrf_profiler_log_encode_string(struct log_event_buf *buf, const char *strin
 	buf->payload += string_len;
 }
 
+void nrf_profiler_log_encode_mem(struct log_event_buf *buf, const void *data, size_t len)
+{
+	__ASSERT_NO_MSG(buf->payload - buf->payload_start + len
+			 <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN);
+	memcpy(buf->payload, data, len);
+	buf->payload += len;
+}
+
 void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 				  const void *mem_address)
 {
@@ -429,11 +582,16 @@ void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 	if (atomic_get(&nrf_profiler_state) == STATE_ACTIVE) {
 		uint8_t type_id = event_type_id & UINT8_MAX;
 
+#if IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_BATCHING)
+		buf->payload_start[0] = type_id;
+		event_ring_put(buf);
+#else
 		k_spinlock_key_t key = k_spin_lock(&lock);
 
 		if (!nrf_profiler_RTT_send(buf, type_id)) {
 			nrf_profiler_fatal_error();
 		}
 		k_spin_unlock(&lock, key);
+#endif
 	}
 }
@@ -156,10 +156,8 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	return 0;
 }
 
-static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+static int ept_ready_wait(struct nrf_rpc_ipc *ipc_config)
 {
-	int err;
-	struct nrf_rpc_ipc *ipc_config = transport->ctx;
 	struct nrf_rpc_ipc_endpoint *endpoint = &ipc_config->endpoint;
 
 	switch (ipc_config->state) {
@@ -181,18 +179,42 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		return -NRF_EPIPE;
 	}
 
+	return 0;
+}
+
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+{
+	int err;
+	struct nrf_rpc_ipc *ipc_config = transport->ctx;
+	struct nrf_rpc_ipc_endpoint *endpoint = &ipc_config->endpoint;
+
+	err = ept_ready_wait(ipc_config);
+	if (err) {
+		return err;
+	}
+
 	LOG_DBG("Sending %u bytes", length);
 	DUMP_LIMITED_DBG(data, length, "Data: ");
 
+#if defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY)
+	err = ipc_service_send_nocopy(&endpoint->ept, data, length);
+	if (err < 0) {
+		LOG_ERR("ipc_service_send_nocopy returned err: %d", err);
+		ipc_service_drop_tx_buffer(&endpoint->ept, data);
+	}
+#else
 	err = ipc_service_send(&endpoint->ept, data, length);
 	if (err < 0) {
 		LOG_ERR("ipc_service_send returned err: %d", err);
-	} else if (err > 0) {
-		LOG_DBG("Sent %u bytes", err);
-		err = 0;
 	}
 
 	k_free((void *)data);
+#endif /* defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY) */
+
+	if (err > 0) {
+		LOG_DBG("Sent %u bytes", err);
+		err = 0;
+	}
 
 	return translate_error(err);
 }
@@ -201,17 +223,37 @@ static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 {
 	void *data = NULL;
 	struct nrf_rpc_ipc *ipc_config = transport->ctx;
+#if defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY)
+	struct nrf_rpc_ipc_endpoint *endpoint = &ipc_config->endpoint;
+	uint32_t len = *size;
+	int err;
+#endif /* defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY) */
 
 	if (ipc_config->state == NRF_RPC_IPC_STATE_UNINITIALIZED) {
 		LOG_ERR("nRF RPC transport is not initialized");
 		goto error;
 	}
 
+#if defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY)
+	/* The buffer is taken from the shared memory of the endpoint, so
+	 * the endpoint must be bound first.
+	 */
+	if (ept_ready_wait(ipc_config)) {
+		goto error;
+	}
+
+	err = ipc_service_get_tx_buffer(&endpoint->ept, &data, &len, K_FOREVER);
+	if (err) {
+		LOG_ERR("Failed to get Tx buffer of %u bytes: %d", *size, err);
+		goto error;
+	}
+#else
 	data = k_malloc(*size);
 	if (!data) {
 		LOG_ERR("Failed to allocate Tx buffer.");
 		goto error;
 	}
+#endif /* defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY) */
 
 	return data;
 
@@ -231,7 +273,11 @@ static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
 		return;
 	}
 
+#if defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY)
+	ipc_service_drop_tx_buffer(&ipc_config->endpoint.ept, buf);
+#else
 	k_free(buf);
+#endif /* defined(CONFIG_NRF_RPC_IPC_SERVICE_NOCOPY) */
 }
 
 const struct nrf_rpc_tr_api nrf_rpc_ipc_service_api = {
@@ -104,6 +104,39 @@ void nrf_rpc_encode_buffer(struct nrf_rpc_cbor_ctx *ctx, const void *data, size_
 	}
 }
 
+void *nrf_rpc_encode_buffer_zero_copy(struct nrf_rpc_cbor_ctx *ctx, size_t size)
+{
+	size_t header_size;
+	uint8_t *data;
+
+	if (is_encoder_invalid(ctx)) {
+		return NULL;
+	}
+
+	/* Size of the CBOR byte string header for the given length. */
+	if (size < 24) {
+		header_size = 1;
+	} else if (size <= UINT8_MAX) {
+		header_size = 2;
+	} else if (size <= UINT16_MAX) {
+		header_size = 3;
+	} else {
+		header_size = 5;
+	}
+
+	/* Encode the string in place. As the source is where the content
+	 * would be copied to, zcbor only writes the header and the caller
+	 * fills in the content afterwards.
+	 */
+	data = ctx->zs->payload_mut + header_size;
+
+	if (!zcbor_bstr_encode_ptr(ctx->zs, data, size)) {
+		return NULL;
+	}
+
+	return data;
+}
+
 void nrf_rpc_encode_callback(struct nrf_rpc_cbor_ctx *ctx, void *callback)
 {
 	int slot;
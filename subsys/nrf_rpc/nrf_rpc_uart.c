@@ -18,6 +18,22 @@
 LOG_MODULE_REGISTER(nrf_rpc_uart, CONFIG_NRF_RPC_TR_LOG_LEVEL);
 
 #define CRC_SIZE sizeof(uint16_t)
+#define SEQ_SIZE sizeof(uint8_t)
+
+/* The sequence number byte holds a 7-bit sequence number and the sync flag.
+ * A frame with the sync flag set restarts the sequence at the receiver.
+ */
+#define SEQ_MASK 0x7fu
+#define SEQ_SYNC BIT(7)
+
+/* Size of the chunk of encoded frame bytes passed to the UART at once. */
+#define TX_CHUNK_SIZE 32
+
+#if defined(CONFIG_NRF_RPC_UART_RELIABLE) && (CONFIG_NRF_RPC_UART_WINDOW_SIZE > 1)
+#define SLIDING_WINDOW 1
+#else
+#define SLIDING_WINDOW 0
+#endif
 
 enum {
 	HDLC_CHAR_ESCAPE = 0x7d,
@@ -54,6 +70,38 @@ struct hdlc_decode_ctx {
 	uint16_t capacity;
 };
 
+enum hdlc_encode_state {
+	/* Output the opening delimiter. */
+	HDLC_ENCODE_START,
+	/* Output the escaped bytes of the frame parts. */
+	HDLC_ENCODE_BODY,
+	/* Output the closing delimiter. */
+	HDLC_ENCODE_END,
+	/* The whole frame has been output. */
+	HDLC_ENCODE_DONE,
+};
+
+struct hdlc_encode_ctx {
+	enum hdlc_encode_state state;
+	/* Frame parts: the packet and the trailer with the checksum. */
+	const uint8_t *part[2];
+	size_t part_len[2];
+	/* The part and the position in it that is encoded next. */
+	uint8_t part_idx;
+	size_t pos;
+	/* The escape octet was output and the escaped byte is pending. */
+	bool escaped;
+};
+
+#if SLIDING_WINDOW
+struct tx_window_entry {
+	const uint8_t *data;
+	size_t len;
+	uint16_t crc;
+	bool sync;
+};
+#endif /* SLIDING_WINDOW */
+
 struct nrf_rpc_uart {
 	const struct device *uart;
 	nrf_rpc_tr_receive_handler_t receive_callback;
@@ -84,10 +132,79 @@ struct nrf_rpc_uart {
 	struct k_mutex ack_tx_lock;
 	struct trx_flips flips;
 
+#if SLIDING_WINDOW
+	/* Frames sent but not acknowledged yet, starting at tx_window_head */
+	struct tx_window_entry tx_window[CONFIG_NRF_RPC_UART_WINDOW_SIZE];
+	uint8_t tx_window_head;
+	/* Sequence number of the oldest unacknowledged frame */
+	uint8_t tx_seq_base;
+	/* Sequence number of the next new frame */
+	uint8_t tx_seq_next;
+	/* Next sequence number expected by the peer, updated by the UART ISR */
+	atomic_t tx_seq_acked;
+	uint8_t tx_attempts;
+	int64_t tx_time;
+	/* The next new frame restarts the sequence at the peer */
+	bool tx_sync;
+	/* Retransmits the frames when no more frames are sent */
+	struct k_work_delayable retx_work;
+
+	/* Next sequence number expected from the peer */
+	uint8_t rx_seq_expected;
+	bool rx_seq_any;
+#endif /* SLIDING_WINDOW */
+
+	/* HDLC frame encoding state */
+	struct hdlc_encode_ctx tx_ctx;
+#if defined(CONFIG_NRF_RPC_UART_TX_IRQ)
+	uint8_t tx_chunk[TX_CHUNK_SIZE];
+	size_t tx_chunk_len;
+	size_t tx_chunk_pos;
+	struct k_sem tx_done_sem;
+#endif /* defined(CONFIG_NRF_RPC_UART_TX_IRQ) */
+
 	/* TX lock */
 	struct k_mutex tx_lock;
 };
 
+#if defined(CONFIG_NRF_RPC_UART_CRC_TABLE)
+/* CRC16_CCITT lookup table for the reflected polynomial 0x8408. */
+static const uint16_t crc_table[256] = {
+	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+	0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
+	0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
+	0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
+	0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+	0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
+	0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
+	0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
+	0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
+	0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
+	0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
+	0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
+	0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+	0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
+	0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
+	0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+	0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
+	0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
+	0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+	0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+	0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+	0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
+	0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+	0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
+	0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
+	0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
+	0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
+	0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
+	0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
+	0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
+	0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
+};
+#endif /* defined(CONFIG_NRF_RPC_UART_CRC_TABLE) */
+
 static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt, ...)
 {
 	if (IS_ENABLED(CONFIG_NRF_RPC_TR_LOG_LEVEL_DBG)) {
@@ -102,7 +219,132 @@ static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt,
 	}
 }
 
-static void send_byte(const struct device *dev, uint8_t byte);
+static uint16_t crc_calc(uint16_t seed, const uint8_t *data, size_t len)
+{
+#if defined(CONFIG_NRF_RPC_UART_CRC_TABLE)
+	for (size_t i = 0; i < len; i++) {
+		seed = (seed >> 8) ^ crc_table[(seed ^ data[i]) & 0xff];
+	}
+
+	return seed;
+#else
+	return crc16_ccitt(seed, data, len);
+#endif /* defined(CONFIG_NRF_RPC_UART_CRC_TABLE) */
+}
+
+static size_t hdlc_encode(struct hdlc_encode_ctx *ctx, uint8_t *out, size_t size)
+{
+	size_t len = 0;
+	uint8_t byte;
+
+	while (len < size) {
+		switch (ctx->state) {
+		case HDLC_ENCODE_START:
+			out[len++] = HDLC_CHAR_DELIMITER;
+			ctx->state = HDLC_ENCODE_BODY;
+			break;
+		case HDLC_ENCODE_BODY:
+			if (ctx->part_idx >= ARRAY_SIZE(ctx->part)) {
+				ctx->state = HDLC_ENCODE_END;
+				break;
+			}
+
+			if (ctx->pos >= ctx->part_len[ctx->part_idx]) {
+				ctx->part_idx++;
+				ctx->pos = 0;
+				break;
+			}
+
+			byte = ctx->part[ctx->part_idx][ctx->pos];
+
+			if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
+				if (!ctx->escaped) {
+					out[len++] = HDLC_CHAR_ESCAPE;
+					ctx->escaped = true;
+					break;
+				}
+
+				byte ^= 0x20;
+				ctx->escaped = false;
+			}
+
+			out[len++] = byte;
+			ctx->pos++;
+			break;
+		case HDLC_ENCODE_END:
+			out[len++] = HDLC_CHAR_DELIMITER;
+			ctx->state = HDLC_ENCODE_DONE;
+			break;
+		case HDLC_ENCODE_DONE:
+			return len;
+		}
+	}
+
+	return len;
+}
+
+#if defined(CONFIG_NRF_RPC_UART_TX_IRQ)
+static void tx_irq_process(struct nrf_rpc_uart *uart_tr)
+{
+	int len;
+
+	if (uart_tr->tx_chunk_pos >= uart_tr->tx_chunk_len) {
+		uart_tr->tx_chunk_len = hdlc_encode(&uart_tr->tx_ctx, uart_tr->tx_chunk,
+						    sizeof(uart_tr->tx_chunk));
+		uart_tr->tx_chunk_pos = 0;
+	}
+
+	if (uart_tr->tx_chunk_len == 0) {
+		/* The previous transfer is done and there is nothing more to send. */
+		uart_irq_tx_disable(uart_tr->uart);
+		k_sem_give(&uart_tr->tx_done_sem);
+		return;
+	}
+
+	len = uart_fifo_fill(uart_tr->uart, &uart_tr->tx_chunk[uart_tr->tx_chunk_pos],
+			     uart_tr->tx_chunk_len - uart_tr->tx_chunk_pos);
+	if (len > 0) {
+		uart_tr->tx_chunk_pos += len;
+	}
+}
+#endif /* defined(CONFIG_NRF_RPC_UART_TX_IRQ) */
+
+/* Sends a frame that consists of the data followed by the trailer.
+ * The caller must ensure that only one frame is sent at a time.
+ */
+static void frame_tx(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len,
+		     const uint8_t *trailer, size_t trailer_len)
+{
+	struct hdlc_encode_ctx *ctx = &uart_tr->tx_ctx;
+
+	ctx->state = HDLC_ENCODE_START;
+	ctx->part[0] = data;
+	ctx->part_len[0] = len;
+	ctx->part[1] = trailer;
+	ctx->part_len[1] = trailer_len;
+	ctx->part_idx = 0;
+	ctx->pos = 0;
+	ctx->escaped = false;
+
+#if defined(CONFIG_NRF_RPC_UART_TX_IRQ)
+	uart_tr->tx_chunk_len = 0;
+	uart_tr->tx_chunk_pos = 0;
+
+	uart_irq_tx_enable(uart_tr->uart);
+	k_sem_take(&uart_tr->tx_done_sem, K_FOREVER);
+#else
+	uint8_t chunk[TX_CHUNK_SIZE];
+	size_t chunk_len;
+
+	do {
+		chunk_len = hdlc_encode(ctx, chunk, sizeof(chunk));
+
+		for (size_t i = 0; i < chunk_len; i++) {
+			uart_poll_out(uart_tr->uart, chunk[i]);
+		}
+	} while (chunk_len > 0);
+#endif /* defined(CONFIG_NRF_RPC_UART_TX_IRQ) */
+}
 
 static void ack_rx(struct nrf_rpc_uart *uart_tr)
 {
@@ -111,6 +353,17 @@ static void ack_rx(struct nrf_rpc_uart *uart_tr)
 		return;
 	}
 
+#if SLIDING_WINDOW
+	/* The ack carries the next sequence number expected by the peer and its inverse. */
+	if (uart_tr->rx_ack[1] != (uint8_t)~uart_tr->rx_ack[0]) {
+		log_hexdump_dbg(uart_tr->rx_ack, uart_tr->rx_ack_ctx.len, ">>> RX invalid ack");
+		return;
+	}
+
+	LOG_DBG(">>> RX ack %u", uart_tr->rx_ack[0]);
+
+	atomic_set(&uart_tr->tx_seq_acked, uart_tr->rx_ack[0]);
+#else
 	uint16_t rx_ack = sys_get_le16(uart_tr->rx_ack);
 
 	LOG_DBG(">>> RX ack %04x", rx_ack);
@@ -119,6 +372,7 @@ static void ack_rx(struct nrf_rpc_uart *uart_tr)
 		LOG_WRN("Received ack %04x but expected %04x", rx_ack, uart_tr->ack_payload);
 		return;
 	}
+#endif /* SLIDING_WINDOW */
 
 	k_sem_give(&uart_tr->ack_sem);
 }
@@ -135,12 +389,7 @@ static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
 	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
 	LOG_DBG("<<< TX ack %04x", ack_pld);
 
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-	send_byte(uart_tr->uart, ack[0]);
-	send_byte(uart_tr->uart, ack[1]);
-
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+	frame_tx(uart_tr, NULL, 0, ack, sizeof(ack));
 
 	k_mutex_unlock(&uart_tr->ack_tx_lock);
 }
@@ -183,13 +432,47 @@ static bool rx_flip_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 
 static bool crc_compare(uint16_t rx_crc, uint16_t calc_crc)
 {
-	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) && !SLIDING_WINDOW) {
 		return (rx_crc & 0x7fffu) == (calc_crc & 0x7fffu);
 	}
 
 	return rx_crc == calc_crc;
 }
 
+#if SLIDING_WINDOW
+/* Strips the sequence number from the received packet and acknowledges it.
+ * Returns true if the packet is the next one expected from the peer.
+ */
+static bool rx_seq_check(struct nrf_rpc_uart *uart_tr)
+{
+	uint8_t seq;
+	bool sync;
+	bool expected;
+
+	uart_tr->rx_pkt_ctx.len -= SEQ_SIZE;
+	seq = uart_tr->rx_pkt[uart_tr->rx_pkt_ctx.len] & SEQ_MASK;
+	sync = uart_tr->rx_pkt[uart_tr->rx_pkt_ctx.len] & SEQ_SYNC;
+
+	/* The first packet and packets with the sync flag synchronize the sequence
+	 * numbers with the peer, unless the packet is a retransmission of the last one.
+	 */
+	expected = uart_tr->rx_seq_any || (seq == uart_tr->rx_seq_expected) ||
+		   (sync && (seq != ((uart_tr->rx_seq_expected - 1) & SEQ_MASK)));
+
+	if (expected) {
+		uart_tr->rx_seq_any = false;
+		uart_tr->rx_seq_expected = (seq + 1) & SEQ_MASK;
+	} else {
+		LOG_WRN("Unexpected packet %u, expected %u", seq, uart_tr->rx_seq_expected);
+	}
+
+	/* Acknowledge all in-order packets, also when a duplicate was received. */
+	ack_tx(uart_tr, uart_tr->rx_seq_expected | ((uint8_t)~uart_tr->rx_seq_expected << 8));
+
+	return expected;
+}
+#endif /* SLIDING_WINDOW */
+
 static void hdlc_decode_byte(struct hdlc_decode_ctx *ctx, uint8_t *out, uint8_t in)
 {
 	switch (ctx->state) {
@@ -255,8 +538,7 @@ static void work_handler(struct k_work *work)
 
 			uart_tr->rx_pkt_ctx.len -= CRC_SIZE;
 			crc_received = sys_get_le16(uart_tr->rx_pkt + uart_tr->rx_pkt_ctx.len);
-			crc_calculated =
-				crc16_ccitt(0xffff, uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len);
+			crc_calculated = crc_calc(0xffff, uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len);
 
 			log_hexdump_dbg(uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len,
 					">>> RX packet %04x", crc_received);
@@ -267,15 +549,21 @@ static void work_handler(struct k_work *work)
 				continue;
 			}
 
+#if SLIDING_WINDOW
+			if (!rx_seq_check(uart_tr)) {
+				continue;
+			}
+#else
 			ack_tx(uart_tr, crc_received);
 
 			if (rx_flip_check(uart_tr, crc_received)) {
 				LOG_WRN("Duplicate packet %04x", crc_received);
-			} else {
-				uart_tr->receive_callback(uart_tr->transport, uart_tr->rx_pkt,
-							  uart_tr->rx_pkt_ctx.len,
-							  uart_tr->receive_ctx);
+				continue;
 			}
+#endif /* SLIDING_WINDOW */
+
+			uart_tr->receive_callback(uart_tr->transport, uart_tr->rx_pkt,
+						  uart_tr->rx_pkt_ctx.len, uart_tr->receive_ctx);
 		}
 
 		ret = ring_buf_get_finish(&uart_tr->rx_ringbuf, len);
@@ -303,7 +591,17 @@ static void serial_cb(const struct device *uart, void *user_data)
 	uint8_t *rx_buffer;
 	bool new_data = false;
 
-	while (uart_irq_update(uart) && uart_irq_rx_ready(uart)) {
+	while (uart_irq_update(uart) && uart_irq_is_pending(uart)) {
+#if defined(CONFIG_NRF_RPC_UART_TX_IRQ)
+		if (uart_irq_tx_ready(uart)) {
+			tx_irq_process(uart_tr);
+		}
+#endif /* defined(CONFIG_NRF_RPC_UART_TX_IRQ) */
+
+		if (!uart_irq_rx_ready(uart)) {
+			continue;
+		}
+
 		rx_len = ring_buf_put_claim(&uart_tr->rx_ringbuf, &rx_buffer,
 					    uart_tr->rx_ringbuf.size);
 		if (rx_len > 0) {
@@ -332,6 +630,124 @@ static void serial_cb(const struct device *uart, void *user_data)
 	}
 }
 
+#if SLIDING_WINDOW
+static uint8_t tx_window_count(const struct nrf_rpc_uart *uart_tr)
+{
+	return (uart_tr->tx_seq_next - uart_tr->tx_seq_base) & SEQ_MASK;
+}
+
+static struct tx_window_entry *tx_window_entry_get(struct nrf_rpc_uart *uart_tr, uint8_t offset)
+{
+	return &uart_tr->tx_window[(uart_tr->tx_window_head + offset) %
+				   CONFIG_NRF_RPC_UART_WINDOW_SIZE];
+}
+
+static void tx_window_frame_tx(struct nrf_rpc_uart *uart_tr, uint8_t offset)
+{
+	struct tx_window_entry *entry = tx_window_entry_get(uart_tr, offset);
+	uint8_t trailer[SEQ_SIZE + CRC_SIZE];
+
+	trailer[0] = (uart_tr->tx_seq_base + offset) & SEQ_MASK;
+	if (entry->sync) {
+		trailer[0] |= SEQ_SYNC;
+	}
+	sys_put_le16(entry->crc, &trailer[SEQ_SIZE]);
+
+	log_hexdump_dbg(entry->data, entry->len, "<<< TX packet %u", trailer[0]);
+
+	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
+	frame_tx(uart_tr, entry->data, entry->len, trailer, sizeof(trailer));
+	k_mutex_unlock(&uart_tr->ack_tx_lock);
+
+	uart_tr->tx_time = k_uptime_get();
+}
+
+/* Releases the frames acknowledged by the peer. */
+static void tx_window_reclaim(struct nrf_rpc_uart *uart_tr)
+{
+	uint8_t acked = (uint8_t)atomic_get(&uart_tr->tx_seq_acked);
+	struct tx_window_entry *entry;
+
+	if (((acked - uart_tr->tx_seq_base) & SEQ_MASK) > tx_window_count(uart_tr)) {
+		/* Stale ack, or the peer is not synchronized with us. */
+		return;
+	}
+
+	while (uart_tr->tx_seq_base != acked) {
+		entry = tx_window_entry_get(uart_tr, 0);
+		k_free((void *)entry->data);
+		entry->data = NULL;
+
+		uart_tr->tx_window_head = (uart_tr->tx_window_head + 1) %
+					  CONFIG_NRF_RPC_UART_WINDOW_SIZE;
+		uart_tr->tx_seq_base = (uart_tr->tx_seq_base + 1) & SEQ_MASK;
+		uart_tr->tx_attempts = 0;
+	}
+}
+
+/* Handles a missing ack by retransmitting all unacknowledged frames, or by
+ * dropping them when the number of attempts is exceeded.
+ */
+static int tx_window_timeout(struct nrf_rpc_uart *uart_tr)
+{
+	uint8_t count;
+
+	tx_window_reclaim(uart_tr);
+
+	count = tx_window_count(uart_tr);
+	if (count == 0) {
+		return 0;
+	}
+
+	if (++uart_tr->tx_attempts >= CONFIG_NRF_RPC_UART_TX_ATTEMPTS) {
+		LOG_ERR("No ack for %u packets, dropping them", count);
+
+		atomic_set(&uart_tr->tx_seq_acked, uart_tr->tx_seq_next);
+		tx_window_reclaim(uart_tr);
+
+		/* The peer still expects the dropped frames, so restart the sequence. */
+		uart_tr->tx_sync = true;
+
+		return -EPROTO;
+	}
+
+	LOG_WRN("Ack timeout, retransmitting %u packets", count);
+
+	for (uint8_t i = 0; i < count; i++) {
+		tx_window_frame_tx(uart_tr, i);
+	}
+
+	return 0;
+}
+
+static void retx_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(dwork, struct nrf_rpc_uart, retx_work);
+	int64_t elapsed;
+
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	tx_window_reclaim(uart_tr);
+
+	if (tx_window_count(uart_tr) > 0) {
+		elapsed = k_uptime_get() - uart_tr->tx_time;
+
+		if (elapsed >= CONFIG_NRF_RPC_UART_ACK_WAITING_TIME) {
+			(void)tx_window_timeout(uart_tr);
+			elapsed = 0;
+		}
+
+		if (tx_window_count(uart_tr) > 0) {
+			k_work_reschedule(&uart_tr->retx_work,
+					  K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME - elapsed));
+		}
+	}
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+}
+#endif /* SLIDING_WINDOW */
+
 static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t receive_cb,
 		void *context)
 {
@@ -380,6 +796,16 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		uart_tr->flips.rx_flip_any = 1;
 	}
 
+#if SLIDING_WINDOW
+	k_work_init_delayable(&uart_tr->retx_work, retx_work_handler);
+	uart_tr->rx_seq_any = true;
+	uart_tr->tx_sync = true;
+#endif /* SLIDING_WINDOW */
+
+#if defined(CONFIG_NRF_RPC_UART_TX_IRQ)
+	k_sem_init(&uart_tr->tx_done_sem, 0, 1);
+#endif /* defined(CONFIG_NRF_RPC_UART_TX_IRQ) */
+
 	k_work_queue_init(&uart_tr->rx_workq);
 	k_work_queue_start(&uart_tr->rx_workq, uart_tr->rx_workq_stack,
 			   K_THREAD_STACK_SIZEOF(uart_tr->rx_workq_stack), K_PRIO_PREEMPT(0),
@@ -398,16 +824,54 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	return 0;
 }
 
-static void send_byte(const struct device *dev, uint8_t byte)
+#if SLIDING_WINDOW
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
-	if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
-		uart_poll_out(dev, HDLC_CHAR_ESCAPE);
-		byte ^= 0x20;
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+	struct tx_window_entry *entry;
+	uint8_t seq;
+	int err = 0;
+
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	/* Wait for a free slot in the window. */
+	tx_window_reclaim(uart_tr);
+
+	while (tx_window_count(uart_tr) >= CONFIG_NRF_RPC_UART_WINDOW_SIZE) {
+		if (k_sem_take(&uart_tr->ack_sem, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME))) {
+			err = tx_window_timeout(uart_tr);
+			if (err) {
+				k_free((void *)data);
+				goto out;
+			}
+		} else {
+			tx_window_reclaim(uart_tr);
+		}
 	}
 
-	uart_poll_out(dev, byte);
-}
+	seq = uart_tr->tx_seq_next;
+	if (uart_tr->tx_sync) {
+		seq |= SEQ_SYNC;
+		uart_tr->tx_sync = false;
+	}
+
+	entry = tx_window_entry_get(uart_tr, tx_window_count(uart_tr));
+	entry->data = data;
+	entry->len = length;
+	entry->crc = crc_calc(crc_calc(0xffff, data, length), &seq, SEQ_SIZE);
+	entry->sync = seq & SEQ_SYNC;
 
+	uart_tr->tx_seq_next = (uart_tr->tx_seq_next + 1) & SEQ_MASK;
+	tx_window_frame_tx(uart_tr, tx_window_count(uart_tr) - 1);
+
+	k_work_reschedule(&uart_tr->retx_work, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+
+out:
+	k_mutex_unlock(&uart_tr->tx_lock);
+
+	return err;
+}
+#else
 static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
 	uint8_t crc[2];
@@ -417,9 +881,10 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 
 	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
 
-	crc_val = crc16_ccitt(0xffff, data, length);
+	crc_val = crc_calc(0xffff, data, length);
 	crc_val = tx_flip(uart_tr, crc_val);
 	log_hexdump_dbg(data, length, "<<< TX packet %04x", crc_val);
+	sys_put_le16(crc_val, crc);
 
 #if CONFIG_NRF_RPC_UART_RELIABLE
 	int attempts = 0;
@@ -433,17 +898,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		k_sem_reset(&uart_tr->ack_sem);
 #endif /* CONFIG_NRF_RPC_UART_RELIABLE */
 
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-		for (size_t i = 0; i < length; i++) {
-			send_byte(uart_tr->uart, data[i]);
-		}
-
-		sys_put_le16(crc_val, crc);
-		send_byte(uart_tr->uart, crc[0]);
-		send_byte(uart_tr->uart, crc[1]);
-
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+		frame_tx(uart_tr, data, length, crc, sizeof(crc));
 
 #if CONFIG_NRF_RPC_UART_RELIABLE
 		k_mutex_unlock(&uart_tr->ack_tx_lock);
@@ -463,6 +918,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 
 	return acked ? 0 : -EPROTO;
 }
+#endif /* SLIDING_WINDOW */
 
 static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 {
@@ -250,6 +250,7 @@ psa_status_t psa_hash_compute(
 
 static psa_status_t get_enc_key(mbedtls_svc_key_id_t key_id,
 				     psa_algorithm_t alg,
+				     psa_key_usage_t usage,
 				     psa_core_lite_key_slot_t **key_slot)
 {
 	if (!VERIFY_ALG_CTR(alg) ||
@@ -257,7 +258,7 @@ static psa_status_t get_enc_key(mbedtls_svc_key_id_t key_id,
 		return PSA_ERROR_NOT_SUPPORTED;
 	}
 
-	return psa_core_lite_get_key_slot(&key_id, key_slot);
+	return psa_core_lite_get_key_slot_for_use(key_id, alg, usage, key_slot);
 }
 
 psa_status_t psa_cipher_encrypt_setup(
@@ -270,7 +271,7 @@ psa_status_t psa_cipher_encrypt_setup(
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
-	status = get_enc_key(key, alg, &key_slot);
+	status = get_enc_key(key, alg, PSA_KEY_USAGE_ENCRYPT, &key_slot);
 	if (status != PSA_SUCCESS) {
 		clear_all_volatile_keys();
 		return status;
@@ -298,7 +299,7 @@ psa_status_t psa_cipher_decrypt_setup(
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
-	status = get_enc_key(key, alg, &key_slot);
+	status = get_enc_key(key, alg, PSA_KEY_USAGE_DECRYPT, &key_slot);
 	if (status != PSA_SUCCESS) {
 		clear_all_volatile_keys();
 		return status;
@@ -929,7 +930,8 @@ static inline psa_status_t get_mac_key(mbedtls_svc_key_id_t key_id,
 		return PSA_ERROR_NOT_SUPPORTED;
 	}
 
-	return psa_core_lite_get_key_slot(&key_id, key_slot);
+	return psa_core_lite_get_key_slot_for_use(key_id, alg, PSA_KEY_USAGE_VERIFY_MESSAGE,
+						  key_slot);
 }
 
 psa_status_t psa_mac_verify(mbedtls_svc_key_id_t key,
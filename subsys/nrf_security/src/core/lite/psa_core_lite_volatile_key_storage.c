@@ -7,6 +7,7 @@
 #include "psa_core_lite_volatile_key_storage.h"
 #include <psa/crypto.h>
 #include <nrf_security_mem_helpers.h>
+#include <string.h>
 
 #define PSA_CORE_LITE_TRUE	0xA5FFA5FF
 #define PSA_CORE_LITE_FALSE	0u
@@ -19,6 +20,57 @@ typedef struct {
 static
 psa_core_lite_key_slot_entry_t g_key_slots[CONFIG_PSA_CORE_LITE_MAX_VOLATILE_KEYS_COUNT] = {};
 
+#if CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE
+typedef struct {
+	psa_core_lite_key_slot_entry_t *slot_entry;
+	psa_algorithm_t alg;
+	psa_key_usage_t usage;
+} psa_core_lite_key_slot_cache_entry_t;
+
+/* Key slots with a validated policy, the most recently used one first */
+static psa_core_lite_key_slot_cache_entry_t
+	g_key_slot_cache[CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE_ENTRIES] = {};
+
+static bool key_slot_cache_get(psa_core_lite_key_slot_entry_t *slot_entry,
+			       psa_algorithm_t alg, psa_key_usage_t usage)
+{
+	psa_core_lite_key_slot_cache_entry_t hit;
+
+	for (size_t cntr = 0; cntr < CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE_ENTRIES; cntr++) {
+		if (g_key_slot_cache[cntr].slot_entry == slot_entry &&
+		    g_key_slot_cache[cntr].alg == alg &&
+		    (g_key_slot_cache[cntr].usage & usage) == usage) {
+			hit = g_key_slot_cache[cntr];
+			memmove(&g_key_slot_cache[1], &g_key_slot_cache[0],
+				cntr * sizeof(g_key_slot_cache[0]));
+			g_key_slot_cache[0] = hit;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void key_slot_cache_add(psa_core_lite_key_slot_entry_t *slot_entry,
+			       psa_algorithm_t alg, psa_key_usage_t usage)
+{
+	memmove(&g_key_slot_cache[1], &g_key_slot_cache[0],
+		(CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE_ENTRIES - 1) * sizeof(g_key_slot_cache[0]));
+	g_key_slot_cache[0].slot_entry = slot_entry;
+	g_key_slot_cache[0].alg = alg;
+	g_key_slot_cache[0].usage = usage;
+}
+
+static void key_slot_cache_remove(psa_core_lite_key_slot_entry_t *slot_entry)
+{
+	for (size_t cntr = 0; cntr < CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE_ENTRIES; cntr++) {
+		if (slot_entry == NULL || g_key_slot_cache[cntr].slot_entry == slot_entry) {
+			safe_memzero(&g_key_slot_cache[cntr], sizeof(g_key_slot_cache[cntr]));
+		}
+	}
+}
+#endif /* CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE */
+
 void psa_core_lite_free_key_slot(mbedtls_svc_key_id_t key_id)
 {
 	psa_core_lite_key_slot_entry_t *slot_entry;
@@ -28,6 +80,9 @@ void psa_core_lite_free_key_slot(mbedtls_svc_key_id_t key_id)
 	}
 
 	slot_entry = &g_key_slots[key_id - PSA_CORE_LITE_KEY_ID_MIN];
+#if CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE
+	key_slot_cache_remove(slot_entry);
+#endif
 	safe_memzero(&slot_entry->slot, sizeof(psa_core_lite_key_slot_t));
 	slot_entry->occupied = PSA_CORE_LITE_FALSE;
 }
@@ -66,7 +121,50 @@ psa_status_t psa_core_lite_get_key_slot(mbedtls_svc_key_id_t *key_id,
 	return PSA_ERROR_INSUFFICIENT_MEMORY;
 }
 
+psa_status_t psa_core_lite_get_key_slot_for_use(mbedtls_svc_key_id_t key_id,
+						psa_algorithm_t alg,
+						psa_key_usage_t usage,
+						psa_core_lite_key_slot_t **slot)
+{
+	psa_core_lite_key_slot_entry_t *slot_entry;
+	psa_key_attributes_t *attributes;
+
+	/* Note: it is assumed that key_id has already been verified for volatile key */
+	if (key_id == PSA_CORE_LITE_KEY_ID_NULL || slot == NULL) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	slot_entry = &g_key_slots[key_id - PSA_CORE_LITE_KEY_ID_MIN];
+
+#if CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE
+	if (key_slot_cache_get(slot_entry, alg, usage)) {
+		*slot = &slot_entry->slot;
+		return PSA_SUCCESS;
+	}
+#endif
+
+	if (slot_entry->occupied == PSA_CORE_LITE_FALSE) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	attributes = &slot_entry->slot.key_attributes;
+	if ((psa_get_key_usage_flags(attributes) & usage) != usage ||
+	    psa_get_key_algorithm(attributes) != alg) {
+		return PSA_ERROR_NOT_PERMITTED;
+	}
+
+#if CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE
+	key_slot_cache_add(slot_entry, alg, usage);
+#endif
+
+	*slot = &slot_entry->slot;
+	return PSA_SUCCESS;
+}
+
 void psa_core_lite_free_all_key_slots(void)
 {
+#if CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE
+	key_slot_cache_remove(NULL);
+#endif
 	safe_memzero(g_key_slots, sizeof(g_key_slots));
 }
@@ -49,6 +49,29 @@ static inline bool psa_core_lite_key_id_is_volatile(mbedtls_svc_key_id_t key_id)
 psa_status_t psa_core_lite_get_key_slot(mbedtls_svc_key_id_t *key_id,
 					psa_core_lite_key_slot_t **slot);
 
+/**
+ * @brief Returns a pointer to a previously allocated volatile key slot after
+ *	  checking that the key policy permits the requested use.
+ *
+ * @note With CONFIG_PSA_CORE_LITE_KEY_SLOT_CACHE, the most recently validated
+ *	 combinations of slot, algorithm and usage are cached, and repeated
+ *	 requests for them skip the policy check.
+ *
+ * @param[in] key_id	Key id corresponding to the slot.
+ * @param[in] alg	Algorithm the key is used with.
+ * @param[in] usage	Usage flags required for the operation.
+ * @param[out] slot	A pointer to the volatile key slot.
+ *
+ * @retval PSA_SUCCESS
+ * @retval PSA_ERROR_INVALID_ARGUMENT
+ * @retval PSA_ERROR_DOES_NOT_EXIST
+ * @retval PSA_ERROR_NOT_PERMITTED
+ */
+psa_status_t psa_core_lite_get_key_slot_for_use(mbedtls_svc_key_id_t key_id,
+						psa_algorithm_t alg,
+						psa_key_usage_t usage,
+						psa_core_lite_key_slot_t **slot);
+
 /**
  * @brief Clears key slot that has been allocated for the specified key id.
  *
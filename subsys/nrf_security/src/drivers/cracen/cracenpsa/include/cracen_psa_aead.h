@@ -205,6 +205,73 @@ psa_status_t cracen_aead_verify(cracen_aead_operation_t *operation, uint8_t *pla
  */
 psa_status_t cracen_aead_abort(cracen_aead_operation_t *operation);
 
+/** @brief Message of an AEAD batch. */
+struct cracen_aead_batch_item {
+	/** Nonce or IV. */
+	const uint8_t *nonce;
+	/** Length of the nonce in bytes. */
+	size_t nonce_length;
+	/** Additional Authenticated Data (AAD). */
+	const uint8_t *additional_data;
+	/** Length of the Additional Authenticated Data (AAD) in bytes. */
+	size_t additional_data_length;
+	/** Plaintext to encrypt, or ciphertext and tag to decrypt. */
+	const uint8_t *input;
+	/** Length of the input in bytes. */
+	size_t input_length;
+	/** Buffer to store the ciphertext and tag, or the plaintext. */
+	uint8_t *output;
+	/** Size of the output buffer in bytes. */
+	size_t output_size;
+	/** Length of the generated output in bytes, set by the driver. */
+	size_t output_length;
+	/** Status of the message, set by the driver. */
+	psa_status_t status;
+};
+
+/** @brief Encrypt and authenticate several messages with the same key using AEAD.
+ *
+ * The key is loaded once and CRACEN stays reserved until all messages are processed,
+ * which is faster than calling @ref cracen_aead_encrypt for every message when
+ * the messages are small. A failure of one message does not stop the processing
+ * of the others. The status of every message is stored in the message.
+ *
+ * @param[in] attributes      Key attributes.
+ * @param[in] key_buffer      Key material buffer.
+ * @param[in] key_buffer_size Size of the key buffer in bytes.
+ * @param[in] alg             AEAD algorithm.
+ * @param[in,out] items       Messages to encrypt.
+ * @param[in] item_count      Number of messages.
+ *
+ * @retval PSA_SUCCESS             All messages were encrypted.
+ * @retval PSA_ERROR_NOT_SUPPORTED The algorithm is not supported.
+ * @return The status of the first message that failed otherwise.
+ */
+psa_status_t cracen_aead_encrypt_batch(const psa_key_attributes_t *attributes,
+				       const uint8_t *key_buffer, size_t key_buffer_size,
+				       psa_algorithm_t alg, struct cracen_aead_batch_item *items,
+				       size_t item_count);
+
+/** @brief Authenticate and decrypt several messages with the same key using AEAD.
+ *
+ * See @ref cracen_aead_encrypt_batch.
+ *
+ * @param[in] attributes      Key attributes.
+ * @param[in] key_buffer      Key material buffer.
+ * @param[in] key_buffer_size Size of the key buffer in bytes.
+ * @param[in] alg             AEAD algorithm.
+ * @param[in,out] items       Messages to decrypt, with the tag appended to the ciphertext.
+ * @param[in] item_count      Number of messages.
+ *
+ * @retval PSA_SUCCESS             All messages were decrypted and their tags are valid.
+ * @retval PSA_ERROR_NOT_SUPPORTED The algorithm is not supported.
+ * @return The status of the first message that failed otherwise.
+ */
+psa_status_t cracen_aead_decrypt_batch(const psa_key_attributes_t *attributes,
+				       const uint8_t *key_buffer, size_t key_buffer_size,
+				       psa_algorithm_t alg, struct cracen_aead_batch_item *items,
+				       size_t item_count);
+
 /** @} */
 
 #endif /* CRACEN_PSA_AEAD_H */
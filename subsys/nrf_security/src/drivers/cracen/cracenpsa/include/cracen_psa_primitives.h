@@ -119,6 +119,13 @@
 #define CRACEN_TLS12_PRF_MAX_LABEL_SIZE 128
 #define CRACEN_TLS12_PRF_MAX_SEED_SIZE	128
 
+/* Number of blocks buffered by multi-part hash operations. */
+#if defined(CONFIG_CRACEN_HASH_BUFFER_BLOCKS)
+#define CRACEN_HASH_BUFFER_BLOCKS CONFIG_CRACEN_HASH_BUFFER_BLOCKS
+#else
+#define CRACEN_HASH_BUFFER_BLOCKS 1
+#endif
+
 /** PRNG key size.
  *
  * Key size to get 256 bits of security.
@@ -266,12 +273,13 @@ struct cracen_hash_operation_s {
 	struct sxhash sx_ctx;
 
 	/* The driver can perform a processing round after getting a multiple of the block size.
-	 * Therefore, the driver must know how much data is left to fill the next block.
+	 * Therefore, the driver must know how much data is left to fill the input buffer,
+	 * which holds CRACEN_HASH_BUFFER_BLOCKS blocks.
 	 */
 	size_t bytes_left_for_next_block;
 
-	/* Buffer for input data to fill up the next block. */
-	uint8_t input_buffer[SX_HASH_MAX_ENABLED_BLOCK_SIZE];
+	/* Buffer for input data to fill up the next blocks. */
+	uint8_t input_buffer[SX_HASH_MAX_ENABLED_BLOCK_SIZE * CRACEN_HASH_BUFFER_BLOCKS];
 
 	/* Flag indicating saved state exists that needs to be resumed */
 	bool has_saved_state;
@@ -832,37 +832,35 @@ static psa_status_t feed_singlepart_ccm_aad(cracen_aead_operation_t *operation,
 	return status;
 }
 
-psa_status_t cracen_aead_encrypt(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
-				 size_t key_buffer_size, psa_algorithm_t alg, const uint8_t *nonce,
-				 size_t nonce_length, const uint8_t *additional_data,
-				 size_t additional_data_length, const uint8_t *plaintext,
-				 size_t plaintext_length, uint8_t *ciphertext,
-				 size_t ciphertext_size, size_t *ciphertext_length)
+static psa_status_t feed_singlepart_aad(cracen_aead_operation_t *operation,
+					const uint8_t *additional_data,
+					size_t additional_data_length)
 {
-#if defined(PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS) && defined(PSA_NEED_CRACEN_CCM_AES)
-	/* Route AES-CCM to software implementation due to HW having smaller max CTR size */
-	if (alg == PSA_ALG_CCM) {
-		return cracen_sw_aes_ccm_encrypt(
-			attributes, key_buffer, key_buffer_size, alg, nonce, nonce_length,
-			additional_data, additional_data_length, plaintext, plaintext_length,
-			ciphertext, ciphertext_size, ciphertext_length);
+	if (IS_ENABLED(PSA_NEED_CRACEN_CCM_AES) && operation->alg == PSA_ALG_CCM) {
+		/* CCM has a header which is prepended to the additional data. */
+		return feed_singlepart_ccm_aad(operation, additional_data, additional_data_length);
 	}
-#endif
 
-	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-	cracen_aead_operation_t operation = {0};
+	return cracen_feed_data_to_hw(operation, additional_data, additional_data_length, NULL,
+				      true);
+}
+
+/* Encrypt a message with an operation that has been set up. */
+static psa_status_t encrypt_singlepart(cracen_aead_operation_t *operation, const uint8_t *nonce,
+				       size_t nonce_length, const uint8_t *additional_data,
+				       size_t additional_data_length, const uint8_t *plaintext,
+				       size_t plaintext_length, uint8_t *ciphertext,
+				       size_t ciphertext_size, size_t *ciphertext_length)
+{
+	psa_status_t status;
 	size_t tag_length = 0;
 
 	if (ciphertext_size < plaintext_length) {
-		return PSA_ERROR_BUFFER_TOO_SMALL;
-	}
-
-	status = setup(&operation, CRACEN_ENCRYPT, attributes, key_buffer, key_buffer_size, alg);
-	if (status != PSA_SUCCESS) {
+		status = PSA_ERROR_BUFFER_TOO_SMALL;
 		goto error_exit;
 	}
 
-	status = set_lengths(&operation, additional_data_length, plaintext_length);
+	status = set_lengths(operation, additional_data_length, plaintext_length);
 	if (status != PSA_SUCCESS) {
 		goto error_exit;
 	}
@@ -871,29 +869,22 @@ psa_status_t cracen_aead_encrypt(const psa_key_attributes_t *attributes, const u
 	 * HW context switching (process_on_hw()) in single-part operations.
 	 */
 
-	status = set_nonce(&operation, nonce, nonce_length);
+	status = set_nonce(operation, nonce, nonce_length);
 	if (status != PSA_SUCCESS) {
 		goto error_exit;
 	}
 
-	if (IS_ENABLED(PSA_NEED_CRACEN_CCM_AES) && operation.alg == PSA_ALG_CCM) {
-		/* CCM has a header which is prepended to the additional data. */
-		status = feed_singlepart_ccm_aad(&operation, additional_data,
-						 additional_data_length);
-	} else {
-		status = cracen_feed_data_to_hw(&operation, additional_data, additional_data_length,
-						NULL, true);
-	}
+	status = feed_singlepart_aad(operation, additional_data, additional_data_length);
 	if (status != PSA_SUCCESS) {
 		goto error_exit;
 	}
 
-	status = cracen_feed_data_to_hw(&operation, plaintext, plaintext_length, ciphertext, false);
+	status = cracen_feed_data_to_hw(operation, plaintext, plaintext_length, ciphertext, false);
 	if (status != PSA_SUCCESS) {
 		goto error_exit;
 	}
 
-	status = finalize_aead_encryption(&operation, &ciphertext[plaintext_length],
+	status = finalize_aead_encryption(operation, &ciphertext[plaintext_length],
 					  ciphertext_size - plaintext_length, &tag_length);
 	if (status != PSA_SUCCESS) {
 		goto error_exit;
@@ -904,10 +895,95 @@ psa_status_t cracen_aead_encrypt(const psa_key_attributes_t *attributes, const u
 
 error_exit:
 	*ciphertext_length = 0;
-	cracen_aead_abort(&operation);
+	cracen_aead_abort(operation);
+	return status;
+}
+
+/* Decrypt a message with an operation that has been set up. */
+static psa_status_t decrypt_singlepart(cracen_aead_operation_t *operation, const uint8_t *nonce,
+				       size_t nonce_length, const uint8_t *additional_data,
+				       size_t additional_data_length, const uint8_t *ciphertext,
+				       size_t ciphertext_length, uint8_t *plaintext,
+				       size_t plaintext_size, size_t *plaintext_length)
+{
+	psa_status_t status;
+
+	*plaintext_length = ciphertext_length - operation->tag_size;
+
+	if (plaintext_size < *plaintext_length) {
+		status = PSA_ERROR_BUFFER_TOO_SMALL;
+		goto error_exit;
+	}
+
+	status = set_lengths(operation, additional_data_length, *plaintext_length);
+	if (status != PSA_SUCCESS) {
+		goto error_exit;
+	}
+
+	/* Do not call the cracen_aead_update*() functions to avoid using
+	 * HW context switching (process_on_hw()) in single-part operations.
+	 */
+
+	status = set_nonce(operation, nonce, nonce_length);
+	if (status != PSA_SUCCESS) {
+		goto error_exit;
+	}
+
+	status = feed_singlepart_aad(operation, additional_data, additional_data_length);
+	if (status != PSA_SUCCESS) {
+		goto error_exit;
+	}
+
+	status = cracen_feed_data_to_hw(operation, ciphertext, *plaintext_length, plaintext, false);
+	if (status != PSA_SUCCESS) {
+		goto error_exit;
+	}
+
+	status = finalize_aead_decryption(operation, &ciphertext[*plaintext_length]);
+	if (status != PSA_SUCCESS) {
+		goto error_exit;
+	}
+
+	return PSA_SUCCESS;
+
+error_exit:
+	*plaintext_length = 0;
+	cracen_aead_abort(operation);
 	return status;
 }
 
+psa_status_t cracen_aead_encrypt(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
+				 size_t key_buffer_size, psa_algorithm_t alg, const uint8_t *nonce,
+				 size_t nonce_length, const uint8_t *additional_data,
+				 size_t additional_data_length, const uint8_t *plaintext,
+				 size_t plaintext_length, uint8_t *ciphertext,
+				 size_t ciphertext_size, size_t *ciphertext_length)
+{
+#if defined(PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS) && defined(PSA_NEED_CRACEN_CCM_AES)
+	/* Route AES-CCM to software implementation due to HW having smaller max CTR size */
+	if (alg == PSA_ALG_CCM) {
+		return cracen_sw_aes_ccm_encrypt(
+			attributes, key_buffer, key_buffer_size, alg, nonce, nonce_length,
+			additional_data, additional_data_length, plaintext, plaintext_length,
+			ciphertext, ciphertext_size, ciphertext_length);
+	}
+#endif
+
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	cracen_aead_operation_t operation = {0};
+
+	status = setup(&operation, CRACEN_ENCRYPT, attributes, key_buffer, key_buffer_size, alg);
+	if (status != PSA_SUCCESS) {
+		*ciphertext_length = 0;
+		cracen_aead_abort(&operation);
+		return status;
+	}
+
+	return encrypt_singlepart(&operation, nonce, nonce_length, additional_data,
+				  additional_data_length, plaintext, plaintext_length, ciphertext,
+				  ciphertext_size, ciphertext_length);
+}
+
 psa_status_t cracen_aead_decrypt(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
 				 size_t key_buffer_size, psa_algorithm_t alg, const uint8_t *nonce,
 				 size_t nonce_length, const uint8_t *additional_data,
@@ -930,57 +1006,109 @@ psa_status_t cracen_aead_decrypt(const psa_key_attributes_t *attributes, const u
 
 	status = setup(&operation, CRACEN_DECRYPT, attributes, key_buffer, key_buffer_size, alg);
 	if (status != PSA_SUCCESS) {
-		goto error_exit;
+		*plaintext_length = 0;
+		cracen_aead_abort(&operation);
+		return status;
 	}
 
-	*plaintext_length = ciphertext_length - operation.tag_size;
+	return decrypt_singlepart(&operation, nonce, nonce_length, additional_data,
+				  additional_data_length, ciphertext, ciphertext_length, plaintext,
+				  plaintext_size, plaintext_length);
+}
 
-	if (plaintext_size < *plaintext_length) {
-		status = PSA_ERROR_BUFFER_TOO_SMALL;
-		goto error_exit;
-	}
+static psa_status_t run_batch(enum cipher_operation dir, const psa_key_attributes_t *attributes,
+			      const uint8_t *key_buffer, size_t key_buffer_size,
+			      psa_algorithm_t alg, struct cracen_aead_batch_item *items,
+			      size_t item_count)
+{
+	psa_status_t status;
+	psa_status_t first_error = PSA_SUCCESS;
+	cracen_aead_operation_t base = {0};
+	cracen_aead_operation_t operation;
+	int sx_status;
 
-	status = set_lengths(&operation, additional_data_length, *plaintext_length);
-	if (status != PSA_SUCCESS) {
-		goto error_exit;
+	if (items == NULL && item_count > 0) {
+		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
-	/* Do not call the cracen_aead_update*() functions to avoid using
-	 * HW context switching (process_on_hw()) in single-part operations.
+	/* The key is copied and loaded once for the whole batch. The key
+	 * reference of every item points to the key buffer of the base operation.
 	 */
-
-	status = set_nonce(&operation, nonce, nonce_length);
+	status = setup(&base, dir, attributes, key_buffer, key_buffer_size, alg);
 	if (status != PSA_SUCCESS) {
-		goto error_exit;
+		safe_memzero(&base, sizeof(base));
+		return status;
 	}
 
-	if (IS_ENABLED(PSA_NEED_CRACEN_CCM_AES) && operation.alg == PSA_ALG_CCM) {
-		/* CCM has a header which is prepended to the additional data. */
-		status = feed_singlepart_ccm_aad(&operation, additional_data,
-						 additional_data_length);
-	} else {
-		status = cracen_feed_data_to_hw(&operation, additional_data, additional_data_length,
-						NULL, true);
-	}
-	if (status != PSA_SUCCESS) {
-		goto error_exit;
+	/* Keep CRACEN powered and reserved between the items. The reservation
+	 * of every item nests into this one and still loads its own
+	 * countermeasures mask.
+	 */
+	sx_status = sx_hw_reserve(NULL, SX_HW_RESERVE_DEFAULT);
+	if (sx_status != SX_OK) {
+		safe_memzero(&base, sizeof(base));
+		return silex_statuscodes_to_psa(sx_status);
 	}
 
-	status =
-		cracen_feed_data_to_hw(&operation, ciphertext, *plaintext_length, plaintext, false);
-	if (status != PSA_SUCCESS) {
-		goto error_exit;
+	for (size_t i = 0; i < item_count; i++) {
+		struct cracen_aead_batch_item *item = &items[i];
+
+		operation = base;
+
+		if (dir == CRACEN_ENCRYPT) {
+			status = encrypt_singlepart(&operation, item->nonce, item->nonce_length,
+						    item->additional_data,
+						    item->additional_data_length, item->input,
+						    item->input_length, item->output,
+						    item->output_size, &item->output_length);
+		} else {
+			status = decrypt_singlepart(&operation, item->nonce, item->nonce_length,
+						    item->additional_data,
+						    item->additional_data_length, item->input,
+						    item->input_length, item->output,
+						    item->output_size, &item->output_length);
+		}
+
+		item->status = status;
+		if (status != PSA_SUCCESS && first_error == PSA_SUCCESS) {
+			first_error = status;
+		}
 	}
 
-	status = finalize_aead_decryption(&operation, &ciphertext[*plaintext_length]);
-	if (status != PSA_SUCCESS) {
-		goto error_exit;
+	sx_hw_release(NULL);
+
+	safe_memzero(&operation, sizeof(operation));
+	safe_memzero(&base, sizeof(base));
+
+	return first_error;
+}
+
+psa_status_t cracen_aead_encrypt_batch(const psa_key_attributes_t *attributes,
+				       const uint8_t *key_buffer, size_t key_buffer_size,
+				       psa_algorithm_t alg, struct cracen_aead_batch_item *items,
+				       size_t item_count)
+{
+#if defined(PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS) && defined(PSA_NEED_CRACEN_CCM_AES)
+	if (alg == PSA_ALG_CCM) {
+		return PSA_ERROR_NOT_SUPPORTED;
 	}
+#endif
 
-	return PSA_SUCCESS;
+	return run_batch(CRACEN_ENCRYPT, attributes, key_buffer, key_buffer_size, alg, items,
+			 item_count);
+}
 
-error_exit:
-	*plaintext_length = 0;
-	cracen_aead_abort(&operation);
-	return status;
+psa_status_t cracen_aead_decrypt_batch(const psa_key_attributes_t *attributes,
+				       const uint8_t *key_buffer, size_t key_buffer_size,
+				       psa_algorithm_t alg, struct cracen_aead_batch_item *items,
+				       size_t item_count)
+{
+#if defined(PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS) && defined(PSA_NEED_CRACEN_CCM_AES)
+	if (alg == PSA_ALG_CCM) {
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+#endif
+
+	return run_batch(CRACEN_DECRYPT, attributes, key_buffer, key_buffer_size, alg, items,
+			 item_count);
 }
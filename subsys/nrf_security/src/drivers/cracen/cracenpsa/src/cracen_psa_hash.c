@@ -44,6 +44,12 @@ psa_status_t cracen_hash_compute(psa_algorithm_t alg, const uint8_t *input, size
 	return silex_statuscodes_to_psa(cracen_hash_input(input, input_length, sx_hash_algo, hash));
 }
 
+/* Size of the part of the input buffer used by the algorithm of the operation. */
+static size_t input_buffer_size(const cracen_hash_operation_t *operation)
+{
+	return sx_hash_get_alg_blocksz(operation->sx_hash_algo) * CRACEN_HASH_BUFFER_BLOCKS;
+}
+
 psa_status_t cracen_hash_setup(cracen_hash_operation_t *operation, psa_algorithm_t alg)
 {
 	int status;
@@ -54,7 +60,7 @@ psa_status_t cracen_hash_setup(cracen_hash_operation_t *operation, psa_algorithm
 	}
 	operation->has_saved_state = false;
 
-	operation->bytes_left_for_next_block = sx_hash_get_alg_blocksz(operation->sx_hash_algo);
+	operation->bytes_left_for_next_block = input_buffer_size(operation);
 
 	return silex_statuscodes_to_psa(status);
 }
@@ -81,6 +87,7 @@ psa_status_t cracen_hash_update(cracen_hash_operation_t *operation, const uint8_
 {
 	int sx_status;
 	size_t block_sz;
+	size_t buffer_sz;
 	size_t input_chunk_length = 0;
 	size_t remaining_bytes = 0;
 
@@ -95,15 +102,18 @@ psa_status_t cracen_hash_update(cracen_hash_operation_t *operation, const uint8_
 	__ASSERT_NO_MSG(input != NULL);
 
 	block_sz = sx_hash_get_alg_blocksz(operation->sx_hash_algo);
+	buffer_sz = input_buffer_size(operation);
 	if (input_length < operation->bytes_left_for_next_block) {
 		/* sx_hash_feed doesn't buffer the input data until sx_hash_wait
-		 * is called so a local buffer is used.
+		 * is called so a local buffer is used. The hardware is only used
+		 * once the buffer is full, so that the state of the hash is not
+		 * resumed and saved for every small update.
 		 */
-		size_t offset = block_sz - operation->bytes_left_for_next_block;
+		size_t offset = buffer_sz - operation->bytes_left_for_next_block;
 		memcpy(operation->input_buffer + offset, input, input_length);
 		operation->bytes_left_for_next_block -= input_length;
 
-		/* can't fill a full block so nothing more to do here */
+		/* can't fill the buffer so nothing more to do here */
 		return PSA_SUCCESS;
 	}
 
@@ -119,14 +129,14 @@ psa_status_t cracen_hash_update(cracen_hash_operation_t *operation, const uint8_
 
 	/* Feed the data that are currently in the input buffer to the driver. */
 	sx_status = sx_hash_feed(&operation->sx_ctx, operation->input_buffer,
-				 block_sz - operation->bytes_left_for_next_block);
+				 buffer_sz - operation->bytes_left_for_next_block);
 	if (sx_status != SX_OK) {
 		goto exit;
 	}
 
 	/* Add as many full blocks as possible by adding as many input bytes as
 	 * needed to get to be block aligned. The block size is not guaranteed to be
-	 * power of two.
+	 * power of two. The buffer size is a multiple of the block size.
 	 */
 	input_chunk_length = input_length - ((input_length - operation->bytes_left_for_next_block) %
 					     block_sz);
@@ -151,7 +161,7 @@ psa_status_t cracen_hash_update(cracen_hash_operation_t *operation, const uint8_
 	/* As we just passed the last block reset the remaining size and clean
 	 * input buffer
 	 */
-	operation->bytes_left_for_next_block = block_sz;
+	operation->bytes_left_for_next_block = buffer_sz;
 	safe_memzero(operation->input_buffer, sizeof(operation->input_buffer));
 
 	/* Copy the remaining bytes to the local input buffer */
@@ -169,7 +179,6 @@ psa_status_t cracen_hash_finish(cracen_hash_operation_t *operation, uint8_t *has
 				size_t *hash_length)
 {
 	int sx_status;
-	size_t block_sz;
 
 	__ASSERT_NO_MSG(hash_length != NULL);
 
@@ -187,9 +196,8 @@ psa_status_t cracen_hash_finish(cracen_hash_operation_t *operation, uint8_t *has
 		goto exit;
 	}
 
-	block_sz = sx_hash_get_alg_blocksz(operation->sx_hash_algo);
 	sx_status = sx_hash_feed(&operation->sx_ctx, operation->input_buffer,
-				 block_sz - operation->bytes_left_for_next_block);
+				 input_buffer_size(operation) - operation->bytes_left_for_next_block);
 	if (sx_status != SX_OK) {
 		goto exit;
 	}
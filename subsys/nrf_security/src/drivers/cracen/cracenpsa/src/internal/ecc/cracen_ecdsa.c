@@ -36,6 +36,8 @@
 #include <cracen/common.h>
 #include <sxsymcrypt/internal.h>
 #include <cracen/cracen_hmac.h>
+#include <nrf_security_mem_helpers.h>
+#include <nrf_security_mutexes.h>
 
 #define DETERMINISTIC_HMAC_STEPS 6
 #define MAX_ECDSA_ATTEMPTS	 255
@@ -558,8 +560,57 @@ int cracen_ecdsa_verify_message(const uint8_t *pubkey, const struct sxhashalg *h
 	return cracen_ecdsa_verify_digest(pubkey, digest, digestsz, curve, signature);
 }
 
-int cracen_ecdsa_verify_digest(const uint8_t *pubkey, const uint8_t *digest, const size_t digestsz,
-			       const struct sx_pk_ecurve *curve, const uint8_t *signature)
+#if defined(CONFIG_CRACEN_ECDSA_VERIFY_CACHE)
+/* Tags of the last successfully verified signatures. A tag is the SHA-256 hash of the curve
+ * parameters, the public key, the digest and the signature.
+ */
+static uint8_t verify_cache[CONFIG_CRACEN_ECDSA_VERIFY_CACHE_ENTRIES][SX_HASH_DIGESTSZ_SHA2_256];
+static size_t verify_cache_count;
+static size_t verify_cache_next;
+
+NRF_SECURITY_MUTEX_DEFINE(cracen_ecdsa_verify_cache_mutex);
+
+static int verify_cache_tag(const uint8_t *pubkey, const uint8_t *digest, size_t digestsz,
+			    const struct sx_pk_ecurve *curve, const uint8_t *signature,
+			    uint8_t *tag)
+{
+	size_t opsz = sx_pk_curve_opsize(curve);
+	const uint8_t *inputs[] = {curve->params, pubkey, digest, signature};
+	const size_t input_lengths[] = {curve->params_total_sz, 2 * opsz, digestsz, 2 * opsz};
+
+	return cracen_hash_all_inputs(inputs, input_lengths, ARRAY_SIZE(inputs),
+				      &sxhashalg_sha2_256, tag);
+}
+
+static bool verify_cache_find(const uint8_t *tag)
+{
+	bool found = false;
+
+	nrf_security_mutex_lock(cracen_ecdsa_verify_cache_mutex);
+	for (size_t i = 0; i < verify_cache_count; i++) {
+		if (constant_memcmp(verify_cache[i], tag, SX_HASH_DIGESTSZ_SHA2_256) == 0) {
+			found = true;
+			break;
+		}
+	}
+	nrf_security_mutex_unlock(cracen_ecdsa_verify_cache_mutex);
+
+	return found;
+}
+
+static void verify_cache_add(const uint8_t *tag)
+{
+	nrf_security_mutex_lock(cracen_ecdsa_verify_cache_mutex);
+	memcpy(verify_cache[verify_cache_next], tag, SX_HASH_DIGESTSZ_SHA2_256);
+	verify_cache_next = (verify_cache_next + 1) % CONFIG_CRACEN_ECDSA_VERIFY_CACHE_ENTRIES;
+	verify_cache_count = MIN(verify_cache_count + 1, CONFIG_CRACEN_ECDSA_VERIFY_CACHE_ENTRIES);
+	nrf_security_mutex_unlock(cracen_ecdsa_verify_cache_mutex);
+}
+#endif /* CONFIG_CRACEN_ECDSA_VERIFY_CACHE */
+
+static int ecdsa_verify_digest_on_hw(const uint8_t *pubkey, const uint8_t *digest,
+				     const size_t digestsz, const struct sx_pk_ecurve *curve,
+				     const uint8_t *signature)
 {
 	int status;
 	size_t opsz = sx_pk_curve_opsize(curve);
@@ -587,3 +638,30 @@ int cracen_ecdsa_verify_digest(const uint8_t *pubkey, const uint8_t *digest, con
 
 	return status;
 }
+
+int cracen_ecdsa_verify_digest(const uint8_t *pubkey, const uint8_t *digest, const size_t digestsz,
+			       const struct sx_pk_ecurve *curve, const uint8_t *signature)
+{
+#if defined(CONFIG_CRACEN_ECDSA_VERIFY_CACHE)
+	uint8_t tag[SX_HASH_DIGESTSZ_SHA2_256];
+	int status;
+
+	status = verify_cache_tag(pubkey, digest, digestsz, curve, signature, tag);
+	if (status != SX_OK) {
+		return status;
+	}
+
+	if (verify_cache_find(tag)) {
+		return SX_OK;
+	}
+
+	status = ecdsa_verify_digest_on_hw(pubkey, digest, digestsz, curve, signature);
+	if (status == SX_OK) {
+		verify_cache_add(tag);
+	}
+
+	return status;
+#else
+	return ecdsa_verify_digest_on_hw(pubkey, digest, digestsz, curve, signature);
+#endif
+}
@@ -0,0 +1,98 @@
+/** Asynchronous job queue of the cryptomaster.
+ *
+ * @file
+ *
+ * @copyright Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ *
+ * Jobs submitted to the queue are run one after the other by a dedicated
+ * thread, which keeps the cryptomaster reserved until the queue is empty.
+ * The submitting thread does not wait for the job and is notified through
+ * the done callback instead.
+ *
+ * Requires the CONFIG_CRACEN_JOB_QUEUE Kconfig option.
+ *
+ * Example:
+ * The following example shows the typical sequence of function calls for
+ * hashing a message asynchronously.
+   @code
+   1. Submission, from any thread
+       sx_job_init(job, run, done)
+       sx_job_submit(job)
+   2. Run function of the job, from the thread of the queue
+       sx_hash_create(ctx, &sxhashalg_sha2_256, ctxsize)
+       sx_hash_feed(ctx, 'message')
+       sx_hash_digest(ctx, digest)
+       return sx_hash_wait(ctx)
+   3. Done function of the job, from the thread of the queue
+       use 'digest' or handle 'status'
+   @endcode
+ */
+
+#ifndef JOBQUEUE_HEADER_FILE
+#define JOBQUEUE_HEADER_FILE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct sx_job;
+
+/** Run a job.
+ *
+ * Called from the thread of the job queue, with the cryptomaster reserved.
+ * The function starts the operations of the job and waits for them. While it
+ * waits for the interrupt of the cryptomaster, the CPU is free for other
+ * threads.
+ *
+ * @param[in,out] job Job to run.
+ * @return ::SX_OK or an error code of the operations of the job.
+ */
+typedef int (*sx_job_run_t)(struct sx_job *job);
+
+/** Notify that a job is done.
+ *
+ * Called from the thread of the job queue. The job can be submitted again
+ * from this callback.
+ *
+ * @param[in,out] job Job that is done.
+ * @param[in] status Status returned by the run function of the job.
+ */
+typedef void (*sx_job_done_t)(struct sx_job *job, int status);
+
+/** A job of the queue.
+ *
+ * Initialized with sx_job_init(). All members should be considered INTERNAL
+ * and may not be accessed directly.
+ */
+struct sx_job {
+	void *fifo_reserved;
+	sx_job_run_t run;
+	sx_job_done_t done;
+};
+
+/** Initialize a job.
+ *
+ * @param[out] job Job to initialize.
+ * @param[in] run Function that runs the job.
+ * @param[in] done Function called when the job is done.
+ */
+void sx_job_init(struct sx_job *job, sx_job_run_t run, sx_job_done_t done);
+
+/** Submit a job to the queue.
+ *
+ * The job must not be modified or submitted again before its done callback
+ * is called.
+ *
+ * @param[in,out] job Job to submit.
+ * @return ::SX_OK
+ * @return ::SX_ERR_INVALID_ARG if the job is not initialized.
+ */
+int sx_job_submit(struct sx_job *job);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+
+#include <cracen/statuscodes.h>
+#include <sxsymcrypt/internal.h>
+#include <sxsymcrypt/jobqueue.h>
+
+static K_FIFO_DEFINE(sx_jobs);
+
+void sx_job_init(struct sx_job *job, sx_job_run_t run, sx_job_done_t done)
+{
+	job->run = run;
+	job->done = done;
+}
+
+int sx_job_submit(struct sx_job *job)
+{
+	if (job == NULL || job->run == NULL || job->done == NULL) {
+		return SX_ERR_INVALID_ARG;
+	}
+
+	k_fifo_put(&sx_jobs, job);
+
+	return SX_OK;
+}
+
+static void sx_job_thread(void *p1, void *p2, void *p3)
+{
+	struct sx_job *job;
+	int status;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		job = k_fifo_get(&sx_jobs, K_FOREVER);
+
+		/* Keep the cryptomaster reserved and powered while jobs are
+		 * queued, so that they run back to back. The reservations of
+		 * the operations of the jobs nest into this one.
+		 */
+		status = sx_hw_reserve(NULL, SX_HW_RESERVE_DEFAULT);
+		if (status != SX_OK) {
+			job->done(job, status);
+			continue;
+		}
+
+		do {
+			status = job->run(job);
+			job->done(job, status);
+			job = k_fifo_get(&sx_jobs, K_NO_WAIT);
+		} while (job != NULL);
+
+		sx_hw_release(NULL);
+	}
+}
+
+K_THREAD_DEFINE(sx_job_tid, CONFIG_CRACEN_JOB_QUEUE_STACK_SIZE, sx_job_thread, NULL, NULL, NULL,
+		CONFIG_CRACEN_JOB_QUEUE_THREAD_PRIO, 0, 0);
@@ -16,6 +16,12 @@ list(APPEND cracen_driver_sources
   ${CMAKE_CURRENT_LIST_DIR}/src/platform/baremetal/interrupts.c
 )
 
+if(CONFIG_CRACEN_JOB_QUEUE)
+  list(APPEND cracen_driver_sources
+    ${CMAKE_CURRENT_LIST_DIR}/src/platform/baremetal/jobqueue.c
+  )
+endif()
+
 list(APPEND cracen_driver_include_dirs
     ${CMAKE_CURRENT_LIST_DIR}/include
 )
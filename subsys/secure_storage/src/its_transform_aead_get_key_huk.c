@@ -6,8 +6,90 @@
 #include <hw_unique_key.h>
 #include <psa/crypto_values.h>
 
+#ifdef CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_CACHE
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <mbedtls/platform_util.h>
+#include <secure_storage_key_cache.h>
+#endif
+
 LOG_MODULE_DECLARE(secure_storage, CONFIG_SECURE_STORAGE_LOG_LEVEL);
 
+#ifdef CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_CACHE
+
+struct key_cache_entry {
+	secure_storage_its_uid_t uid;
+	uint8_t key[CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_SIZE];
+	bool valid;
+};
+
+static struct key_cache_entry key_cache[CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_CACHE_SIZE];
+/* Entry replaced by the next cached key. */
+static size_t key_cache_next;
+static bool key_cache_locked;
+static K_MUTEX_DEFINE(key_cache_mutex);
+
+__weak bool secure_storage_key_cache_policy(secure_storage_its_uid_t uid)
+{
+	ARG_UNUSED(uid);
+
+	return true;
+}
+
+void secure_storage_key_cache_lock(void)
+{
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	mbedtls_platform_zeroize(key_cache, sizeof(key_cache));
+	key_cache_next = 0;
+	key_cache_locked = true;
+	k_mutex_unlock(&key_cache_mutex);
+}
+
+void secure_storage_key_cache_unlock(void)
+{
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	key_cache_locked = false;
+	k_mutex_unlock(&key_cache_mutex);
+}
+
+static bool key_cache_get(secure_storage_its_uid_t uid, uint8_t *key)
+{
+	bool found = false;
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(key_cache); i++) {
+		if (key_cache[i].valid && memcmp(&key_cache[i].uid, &uid, sizeof(uid)) == 0) {
+			memcpy(key, key_cache[i].key, sizeof(key_cache[i].key));
+			found = true;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&key_cache_mutex);
+
+	return found;
+}
+
+static void key_cache_add(secure_storage_its_uid_t uid, const uint8_t *key)
+{
+	struct key_cache_entry *entry;
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+
+	if (!key_cache_locked) {
+		entry = &key_cache[key_cache_next];
+		entry->uid = uid;
+		memcpy(entry->key, key, sizeof(entry->key));
+		entry->valid = true;
+		key_cache_next = (key_cache_next + 1) % ARRAY_SIZE(key_cache);
+	}
+
+	k_mutex_unlock(&key_cache_mutex);
+}
+
+#endif /* CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_CACHE */
+
 psa_status_t secure_storage_its_transform_aead_get_key(
 		secure_storage_its_uid_t uid,
 		uint8_t key[static CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_SIZE])
@@ -15,6 +97,14 @@ psa_status_t secure_storage_its_transform_aead_get_key(
 	int result;
 	enum hw_unique_key_slot key_slot;
 
+#ifdef CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_CACHE
+	const bool cacheable = secure_storage_key_cache_policy(uid);
+
+	if (cacheable && key_cache_get(uid, key)) {
+		return PSA_SUCCESS;
+	}
+#endif
+
 	if (!hw_unique_key_are_any_written()) {
 		return PSA_ERROR_BAD_STATE;
 	}
@@ -32,5 +122,11 @@ psa_status_t secure_storage_its_transform_aead_get_key(
 		return PSA_ERROR_GENERIC_ERROR;
 	}
 
+#ifdef CONFIG_SECURE_STORAGE_ITS_TRANSFORM_AEAD_KEY_CACHE
+	if (cacheable) {
+		key_cache_add(uid, key);
+	}
+#endif
+
 	return PSA_SUCCESS;
 }
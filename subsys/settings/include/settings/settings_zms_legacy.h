@@ -42,7 +42,6 @@ struct settings_zms {
 		uint32_t name_id;
 	} cache[CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE];
 
-	uint32_t cache_next;
 	uint32_t cache_total;
 	bool loaded;
 #endif
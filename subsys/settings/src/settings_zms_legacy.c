@@ -66,32 +66,52 @@ int settings_zms_dst(struct settings_zms *cf)
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
 #define SETTINGS_ZMS_CACHE_OVFL(cf) ((cf)->cache_total > ARRAY_SIZE((cf)->cache))
 
+/* The cache is a hash table with linear probing. Empty slots have a name ID that is not
+ * greater than ZMS_NAMECNT_ID. Slots are never emptied, so that a probe sequence is never
+ * broken. If the table is full, the first slot of the probe sequence is replaced.
+ */
 static void settings_zms_cache_add(struct settings_zms *cf, const char *name, uint32_t name_id)
 {
 	uint32_t name_hash = sys_hash32(name, strnlen(name, SETTINGS_FULL_NAME_LEN));
+	uint32_t first = name_hash % CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
+	uint32_t idx = first;
 
-	cf->cache[cf->cache_next].name_hash = name_hash;
-	cf->cache[cf->cache_next++].name_id = name_id;
+	for (uint32_t i = 0; i < CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE; i++) {
+		if ((cf->cache[idx].name_id <= ZMS_NAMECNT_ID) ||
+		    (cf->cache[idx].name_id == name_id)) {
+			break;
+		}
+
+		idx = (idx + 1) % CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
+	}
 
-	cf->cache_next %= CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
+	if ((cf->cache[idx].name_id > ZMS_NAMECNT_ID) && (cf->cache[idx].name_id != name_id)) {
+		idx = first;
+	}
+
+	cf->cache[idx].name_hash = name_hash;
+	cf->cache[idx].name_id = name_id;
 }
 
 static uint32_t settings_zms_cache_match(struct settings_zms *cf, const char *name, char *rdname,
 					 size_t len)
 {
 	uint32_t name_hash = sys_hash32(name, strnlen(name, SETTINGS_FULL_NAME_LEN));
+	uint32_t idx = name_hash % CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
 	int rc;
 
-	for (int i = 0; i < CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE; i++) {
-		if (cf->cache[i].name_hash != name_hash) {
-			continue;
+	for (uint32_t i = 0; i < CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
+	     i++, idx = (idx + 1) % CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE) {
+		if (cf->cache[idx].name_id <= ZMS_NAMECNT_ID) {
+			/* End of the probe sequence. */
+			break;
 		}
 
-		if (cf->cache[i].name_id <= ZMS_NAMECNT_ID) {
+		if (cf->cache[idx].name_hash != name_hash) {
 			continue;
 		}
 
-		rc = zms_read(&cf->cf_zms, cf->cache[i].name_id, rdname, len);
+		rc = zms_read(&cf->cf_zms, cf->cache[idx].name_id, rdname, len);
 		if (rc < 0) {
 			continue;
 		}
@@ -102,7 +122,7 @@ static uint32_t settings_zms_cache_match(struct settings_zms *cf, const char *na
 			continue;
 		}
 
-		return cf->cache[i].name_id;
+		return cf->cache[idx].name_id;
 	}
 
 	return ZMS_NAMECNT_ID;
@@ -142,6 +162,23 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		 * setting's value.
 		 */
 		rc1 = zms_read(&cf->cf_zms, name_id, &name, sizeof(name));
+
+		if ((rc1 > 0) && (arg != NULL) && (arg->subtree != NULL)) {
+			name[rc1] = '\0';
+
+			if (!settings_name_steq(name, arg->subtree, NULL)) {
+				/* The setting is not loaded, so its value entry is not
+				 * looked up. Dirty entries are cleaned when all
+				 * settings are loaded.
+				 */
+#if CONFIG_SETTINGS_ZMS_NAME_CACHE
+				settings_zms_cache_add(cf, name, name_id);
+				cached++;
+#endif
+				continue;
+			}
+		}
+
 		/* get the length of data and verify that it exists */
 		rc2 = zms_get_data_length(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
 
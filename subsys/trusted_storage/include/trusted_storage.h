@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TRUSTED_STORAGE_H
+#define TRUSTED_STORAGE_H
+
+#include "psa/error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup trusted_storage_transaction Trusted storage transactions
+ * @{
+ *
+ * A transaction buffers the objects written with @c psa_its_set and
+ * @c psa_ps_set, and writes them to the settings storage when it is committed.
+ * Several writes of the same object within a transaction result in one write
+ * to the storage.
+ *
+ * Requires the CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION
+ * Kconfig option. The transaction is global: while it is open, the writes
+ * and removals of all threads are buffered.
+ */
+
+/**
+ * @brief Start a transaction.
+ *
+ * @retval PSA_SUCCESS        The transaction was started.
+ * @retval PSA_ERROR_BAD_STATE A transaction is already open.
+ */
+psa_status_t trusted_storage_transaction_begin(void);
+
+/**
+ * @brief Write the buffered objects to the storage and close the transaction.
+ *
+ * The objects are written in the order of their last change. The transaction
+ * is closed also if a write fails.
+ *
+ * @retval PSA_SUCCESS        All objects were written.
+ * @retval PSA_ERROR_BAD_STATE No transaction is open.
+ * @return Error of the first failing write otherwise.
+ */
+psa_status_t trusted_storage_transaction_commit(void);
+
+/**
+ * @brief Discard the buffered objects and close the transaction.
+ *
+ * Objects that were written to the storage because the buffer was full are
+ * not restored.
+ */
+void trusted_storage_transaction_abort(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRUSTED_STORAGE_H */
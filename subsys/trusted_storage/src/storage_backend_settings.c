@@ -13,6 +13,7 @@
 #include <zephyr/settings/settings.h>
 
 #include "storage_backend.h"
+#include "trusted_storage.h"
 
 LOG_MODULE_REGISTER(internal_trusted_storage_settings, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
 
@@ -28,6 +29,160 @@ struct load_object_info {
 	int ret;
 };
 
+#if defined(CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION)
+struct transaction_entry {
+	char path[TRUSTED_STORAGE_SETTINGS_BACKEND_FILENAME_MAX_LENGTH + 1];
+	/* Offset of the object in the transaction buffer */
+	size_t offset;
+	/* Size of the object, 0 if the object is removed */
+	size_t size;
+};
+
+static struct {
+	struct transaction_entry entries[CONFIG_TRUSTED_STORAGE_SETTINGS_TRANSACTION_MAX_OBJECTS];
+	uint8_t buf[CONFIG_TRUSTED_STORAGE_SETTINGS_TRANSACTION_BUFFER_SIZE];
+	size_t entry_count;
+	size_t buf_used;
+	bool open;
+} transaction;
+
+static K_MUTEX_DEFINE(transaction_mutex);
+
+static struct transaction_entry *transaction_find(const char *path)
+{
+	for (size_t i = 0; i < transaction.entry_count; i++) {
+		if (strcmp(transaction.entries[i].path, path) == 0) {
+			return &transaction.entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Removes an entry, keeping the order of the other entries */
+static void transaction_drop(struct transaction_entry *entry)
+{
+	size_t index = entry - transaction.entries;
+	uint8_t *data = &transaction.buf[entry->offset];
+	size_t size = entry->size;
+
+	memmove(data, data + size, transaction.buf_used - entry->offset - size);
+	transaction.buf_used -= size;
+
+	for (size_t i = index + 1; i < transaction.entry_count; i++) {
+		transaction.entries[i].offset -= size;
+	}
+
+	memmove(entry, entry + 1, (transaction.entry_count - index - 1) * sizeof(*entry));
+	transaction.entry_count--;
+}
+
+static void transaction_clear(void)
+{
+	memset(transaction.buf, 0, transaction.buf_used);
+	transaction.entry_count = 0;
+	transaction.buf_used = 0;
+}
+
+/* Writes the buffered entries, returns the error of the first failing write */
+static int transaction_flush(void)
+{
+	struct transaction_entry *entry;
+	int ret = 0;
+	int err;
+
+	for (size_t i = 0; i < transaction.entry_count; i++) {
+		entry = &transaction.entries[i];
+
+		if (entry->size == 0) {
+			err = settings_delete(entry->path);
+		} else {
+			err = settings_save_one(entry->path, &transaction.buf[entry->offset],
+						entry->size);
+		}
+
+		LOG_DBG("Commit object with filename %s. Size: %zd, ret: %d", entry->path,
+			entry->size, err);
+
+		if (ret == 0) {
+			ret = err;
+		}
+	}
+
+	transaction_clear();
+
+	return ret;
+}
+
+/*
+ * Buffers an object, or its removal if size is 0.
+ * Returns 1 if the object must be written directly instead.
+ */
+static int transaction_add(const char *path, const void *data, size_t size)
+{
+	struct transaction_entry *entry;
+	int ret;
+
+	if (!transaction.open) {
+		return 1;
+	}
+
+	entry = transaction_find(path);
+	if (entry != NULL) {
+		transaction_drop(entry);
+	}
+
+	if (transaction.entry_count == ARRAY_SIZE(transaction.entries) ||
+	    size > sizeof(transaction.buf) - transaction.buf_used) {
+		ret = transaction_flush();
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	if (size > sizeof(transaction.buf)) {
+		return 1;
+	}
+
+	entry = &transaction.entries[transaction.entry_count++];
+	strcpy(entry->path, path);
+	entry->offset = transaction.buf_used;
+	entry->size = size;
+
+	memcpy(&transaction.buf[entry->offset], data, size);
+	transaction.buf_used += size;
+
+	return 0;
+}
+
+/*
+ * Reads a buffered object.
+ * Returns 1 if the object is not buffered.
+ */
+static int transaction_get(const char *path, void *data, size_t size)
+{
+	struct transaction_entry *entry;
+
+	if (!transaction.open) {
+		return 1;
+	}
+
+	entry = transaction_find(path);
+	if (entry == NULL) {
+		return 1;
+	}
+
+	if (entry->size == 0) {
+		return -ENOENT;
+	}
+
+	size = MIN(size, entry->size);
+	memcpy(data, &transaction.buf[entry->offset], size);
+
+	return size;
+}
+#endif /* CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION */
+
 /* Helper to fill filename with a suffix */
 static psa_status_t create_filename(char *filename, const size_t filename_size, const char *prefix,
 				    const psa_storage_uid_t uid)
@@ -100,6 +255,24 @@ psa_status_t storage_get_object(const psa_storage_uid_t uid, const char *prefix,
 		return status;
 	}
 
+#if defined(CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION)
+	k_mutex_lock(&transaction_mutex, K_FOREVER);
+	ret = transaction_get(path, object_data, object_size);
+	k_mutex_unlock(&transaction_mutex);
+
+	if (ret != 1) {
+		LOG_DBG("Get buffered object with filename %s (max_size: %zd), ret: %d", path,
+			object_size, ret);
+
+		if (ret < 0) {
+			return error_to_psa_error(ret);
+		}
+
+		*object_length = ret;
+		return PSA_SUCCESS;
+	}
+#endif
+
 	info.data = object_data;
 	info.size = object_size;
 	/* Set a fallback error if storage_settings_load_object isn't called */
@@ -128,6 +301,7 @@ psa_status_t storage_set_object(const psa_storage_uid_t uid, const char *prefix,
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 	char path[TRUSTED_STORAGE_SETTINGS_BACKEND_FILENAME_MAX_LENGTH + 1];
+	int ret;
 
 	if (object_size == 0 || object_data == NULL || prefix == NULL) {
 		return PSA_ERROR_INVALID_ARGUMENT;
@@ -142,7 +316,19 @@ psa_status_t storage_set_object(const psa_storage_uid_t uid, const char *prefix,
 		return status;
 	}
 
-	return error_to_psa_error(settings_save_one(path, object_data, object_size));
+#if defined(CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION)
+	k_mutex_lock(&transaction_mutex, K_FOREVER);
+	ret = transaction_add(path, object_data, object_size);
+	k_mutex_unlock(&transaction_mutex);
+
+	if (ret != 1) {
+		return error_to_psa_error(ret);
+	}
+#endif
+
+	ret = settings_save_one(path, object_data, object_size);
+
+	return error_to_psa_error(ret);
 }
 
 psa_status_t storage_remove_object(const psa_storage_uid_t uid, const char *prefix)
@@ -161,9 +347,72 @@ psa_status_t storage_remove_object(const psa_storage_uid_t uid, const char *pref
 		return status;
 	}
 
+#if defined(CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION)
+	int ret;
+
+	k_mutex_lock(&transaction_mutex, K_FOREVER);
+	ret = transaction_add(path, NULL, 0);
+	k_mutex_unlock(&transaction_mutex);
+
+	if (ret != 1) {
+		status = error_to_psa_error(ret);
+
+		LOG_DBG("Remove buffered object with filename: %s, status %d", path, status);
+
+		return status;
+	}
+#endif
+
 	status = error_to_psa_error(settings_delete(path));
 
 	LOG_DBG("Remove object with filename: %s, status %d", path, status);
 
 	return status;
 }
+
+#if defined(CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION)
+psa_status_t trusted_storage_transaction_begin(void)
+{
+	psa_status_t status = PSA_SUCCESS;
+
+	k_mutex_lock(&transaction_mutex, K_FOREVER);
+
+	if (transaction.open) {
+		status = PSA_ERROR_BAD_STATE;
+	} else {
+		transaction.open = true;
+	}
+
+	k_mutex_unlock(&transaction_mutex);
+
+	return status;
+}
+
+psa_status_t trusted_storage_transaction_commit(void)
+{
+	psa_status_t status;
+
+	k_mutex_lock(&transaction_mutex, K_FOREVER);
+
+	if (!transaction.open) {
+		status = PSA_ERROR_BAD_STATE;
+	} else {
+		status = error_to_psa_error(transaction_flush());
+		transaction.open = false;
+	}
+
+	k_mutex_unlock(&transaction_mutex);
+
+	return status;
+}
+
+void trusted_storage_transaction_abort(void)
+{
+	k_mutex_lock(&transaction_mutex, K_FOREVER);
+
+	transaction_clear();
+	transaction.open = false;
+
+	k_mutex_unlock(&transaction_mutex);
+}
+#endif /* CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_SETTINGS_TRANSACTION */
@@ -139,6 +139,45 @@ static inline void switch_rx_buffer(const struct device *dev, bool request_new)
 	}
 }
 
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+/**
+ * @brief Move the data from the RX ring buffer to the user buffers
+ *
+ * Full user buffers are notified and switched.
+ * The data that does not fit into the user buffers is kept in the ring buffer.
+ *
+ * @param dev Adapter device.
+ */
+static void rx_ring_flush(const struct device *dev)
+{
+	struct uart_async_adapter_data *data = access_dev_data(dev);
+	bool need_switch;
+
+	do {
+		k_spinlock_key_t key = k_spin_lock(&(data->lock));
+
+		need_switch = false;
+		if (!ring_buf_is_empty(&data->rx.ring)) {
+			if (data->rx.size_left) {
+				uint32_t len = ring_buf_get(&data->rx.ring, data->rx.curr_buf,
+							    data->rx.size_left);
+
+				data->rx.curr_buf += len;
+				data->rx.size_left -= len;
+			}
+			need_switch = !data->rx.size_left && (data->rx.buf || data->rx.next_buf);
+		}
+
+		k_spin_unlock(&(data->lock), key);
+
+		if (need_switch) {
+			notify_rx_buffer(dev);
+			switch_rx_buffer(dev, true);
+		}
+	} while (need_switch);
+}
+#endif
+
 static int tx(const struct device *dev, const uint8_t *buf, size_t len, int32_t timeout)
 {
 	int ret = 0;
@@ -224,6 +263,9 @@ static int rx_enable(const struct device *dev, uint8_t *buf, size_t len, int32_t
 	data->rx.next_buf_len = len;
 	data->rx.timeout = timeout;
 	data->rx.enabled = true;
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+	ring_buf_reset(&data->rx.ring);
+#endif
 
 	k_spin_unlock(&(data->lock), key);
 
@@ -247,8 +289,19 @@ static int rx_buf_rsp(const struct device *dev, uint8_t *buf, size_t len)
 		data->rx.next_buf_len = len;
 	}
 
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+	bool pending = !ring_buf_is_empty(&data->rx.ring);
+#endif
+
 	k_spin_unlock(&(data->lock), key);
 
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+	/* Data waiting for a buffer is moved to the new buffer from the timeout */
+	if (!ret && pending && data->rx.timeout != SYS_FOREVER_US) {
+		k_timer_start(&data->rx.timeout_timer, K_NO_WAIT, K_NO_WAIT);
+	}
+#endif
+
 	return ret;
 }
 
@@ -261,6 +314,10 @@ static int rx_disable(const struct device *dev)
 	data->rx.enabled = false;
 	uart_irq_rx_disable(data->target);
 	uart_irq_err_disable(data->target);
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+	rx_ring_flush(dev);
+	notify_rx_buffer(dev);
+#endif
 	while (data->rx.buf) {
 		switch_rx_buffer(dev, false);
 	}
@@ -439,6 +496,59 @@ static inline void on_tx_complete(const struct device *dev, struct uart_async_ad
 	LOG_DBG("%s: Exit", __func__);
 }
 
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+static inline void on_rx_ready(const struct device *dev, struct uart_async_adapter_data *data)
+{
+	int ret;
+	uint8_t *dst;
+	uint32_t claimed;
+
+	LOG_DBG("%s: Enter (%s)", __func__, dev->name);
+	if (data->rx.timeout != SYS_FOREVER_US) {
+		k_timer_start(&data->rx.timeout_timer, K_USEC(data->rx.timeout), K_NO_WAIT);
+	}
+	do {
+		k_spinlock_key_t key = k_spin_lock(&(data->lock));
+
+		claimed = ring_buf_put_claim(&data->rx.ring, &dst, UINT32_MAX);
+		if (!claimed) {
+			/* Ring buffer full - dropping */
+			uint8_t dummy;
+			size_t cnt = 0;
+
+			do {
+				ret = uart_fifo_read(data->target, &dummy, 1);
+				if (ret < 0) {
+					LOG_ERR("Unexpected error on FIFO dropping: %d", ret);
+					ret = 0;
+				}
+				cnt += ret;
+			} while (ret);
+			LOG_ERR("RX ring buffer full, dropped %d bytes", cnt);
+		} else {
+			ret = uart_fifo_read(data->target, dst, claimed);
+			LOG_DBG("Received %d characters", ret);
+			if (ret < 0) {
+				LOG_ERR("Unexpected error on FIFO read: %d", ret);
+				ret = 0;
+			}
+			(void)ring_buf_put_finish(&data->rx.ring, ret);
+		}
+
+		k_spin_unlock(&(data->lock), key);
+
+	} while (ret);
+
+	/* Move the data to the user buffers in batches, the rest is moved on timeout. */
+	if (data->rx.timeout == 0) {
+		rx_ring_flush(dev);
+		notify_rx_buffer(dev);
+	} else if (ring_buf_size_get(&data->rx.ring) >= ring_buf_capacity_get(&data->rx.ring) / 2) {
+		rx_ring_flush(dev);
+	}
+	LOG_DBG("%s: Exit", __func__);
+}
+#else
 static inline void on_rx_ready(const struct device *dev, struct uart_async_adapter_data *data)
 {
 	int ret;
@@ -498,6 +608,7 @@ static inline void on_rx_ready(const struct device *dev, struct uart_async_adapt
 	}
 	LOG_DBG("%s: Exit", __func__);
 }
+#endif /* CONFIG_UART_ASYNC_ADAPTER_RX_RING */
 
 static inline void on_error(const struct device *dev,
 			    struct uart_async_adapter_data *data,
@@ -586,6 +697,9 @@ static void rx_timeout(struct k_timer *timer)
 {
 	const struct device *dev = k_timer_user_data_get(timer);
 
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+	rx_ring_flush(dev);
+#endif
 	notify_rx_buffer(dev);
 }
 
@@ -605,6 +719,9 @@ void uart_async_adapter_init(const struct device *dev, const struct device *targ
 	k_timer_user_data_set(&data->tx.timeout_timer, (void *)dev);
 	k_timer_init(&data->rx.timeout_timer, rx_timeout, NULL);
 	k_timer_user_data_set(&data->rx.timeout_timer, (void *)dev);
+#if defined(CONFIG_UART_ASYNC_ADAPTER_RX_RING)
+	ring_buf_init(&data->rx.ring, sizeof(data->rx.ring_data), data->rx.ring_data);
+#endif
 
 	dev->state->initialized = true;
 }
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <psa/crypto.h>
+#include <cracen_psa_aead.h>
+
+#define ITERATIONS 20
+#define PACKET_COUNT 16
+/* Typical size of an IEEE 802.15.4 frame payload. */
+#define PAYLOAD_SIZE 64
+#define AAD_SIZE 16
+/* Largest nonce of the benchmarked algorithms, the one of AES-CCM. */
+#define NONCE_SIZE 13
+#define GCM_NONCE_SIZE 12
+#define TAG_SIZE 16
+
+static const uint8_t key[16] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static uint8_t nonces[PACKET_COUNT][NONCE_SIZE];
+static uint8_t aad[PACKET_COUNT][AAD_SIZE];
+static uint8_t plaintexts[PACKET_COUNT][PAYLOAD_SIZE];
+static uint8_t ciphertexts[PACKET_COUNT][PAYLOAD_SIZE + TAG_SIZE];
+static uint8_t decrypted[PACKET_COUNT][PAYLOAD_SIZE];
+static struct cracen_aead_batch_item items[PACKET_COUNT];
+
+static uint64_t ops_per_s(uint32_t cycles)
+{
+	return ((uint64_t)ITERATIONS * PACKET_COUNT * sys_clock_hw_cycles_per_sec()) /
+	       MAX(cycles, 1);
+}
+
+static int run_single(const psa_key_attributes_t *attr, psa_algorithm_t alg,
+		      size_t nonce_size)
+{
+	psa_status_t status;
+	size_t length;
+
+	for (int i = 0; i < PACKET_COUNT; i++) {
+		status = cracen_aead_encrypt(attr, key, sizeof(key), alg, nonces[i], nonce_size,
+					     aad[i], AAD_SIZE, plaintexts[i], PAYLOAD_SIZE,
+					     ciphertexts[i], sizeof(ciphertexts[i]), &length);
+		if (status != PSA_SUCCESS) {
+			return status;
+		}
+	}
+
+	return PSA_SUCCESS;
+}
+
+static void items_fill(bool encrypt, size_t nonce_size)
+{
+	for (int i = 0; i < PACKET_COUNT; i++) {
+		items[i] = (struct cracen_aead_batch_item){
+			.nonce = nonces[i],
+			.nonce_length = nonce_size,
+			.additional_data = aad[i],
+			.additional_data_length = AAD_SIZE,
+			.input = encrypt ? plaintexts[i] : ciphertexts[i],
+			.input_length = encrypt ? PAYLOAD_SIZE : sizeof(ciphertexts[i]),
+			.output = encrypt ? ciphertexts[i] : decrypted[i],
+			.output_size = encrypt ? sizeof(ciphertexts[i]) : sizeof(decrypted[i]),
+		};
+	}
+}
+
+static int benchmark(const char *name, psa_algorithm_t alg, size_t nonce_size)
+{
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+	psa_status_t status;
+	uint32_t start;
+	uint32_t single_cycles;
+	uint32_t batch_cycles;
+
+	psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attr, 128);
+	psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+	psa_set_key_algorithm(&attr, alg);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		status = run_single(&attr, alg, nonce_size);
+		if (status != PSA_SUCCESS) {
+			printk("Test FAIL: single encryption failed (%d)\n", status);
+			return status;
+		}
+	}
+	single_cycles = k_cycle_get_32() - start;
+
+	items_fill(true, nonce_size);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		status = cracen_aead_encrypt_batch(&attr, key, sizeof(key), alg, items,
+						   PACKET_COUNT);
+		if (status != PSA_SUCCESS) {
+			printk("Test FAIL: batched encryption failed (%d)\n", status);
+			return status;
+		}
+	}
+	batch_cycles = k_cycle_get_32() - start;
+
+	/* The batch must produce the same result as the single operations. */
+	items_fill(false, nonce_size);
+	status = cracen_aead_decrypt_batch(&attr, key, sizeof(key), alg, items, PACKET_COUNT);
+	if (status != PSA_SUCCESS || memcmp(decrypted, plaintexts, sizeof(plaintexts)) != 0) {
+		printk("Test FAIL: batched decryption failed (%d)\n", status);
+		return status != PSA_SUCCESS ? status : PSA_ERROR_CORRUPTION_DETECTED;
+	}
+
+	printk("%s single ops per second: %llu\n", name, ops_per_s(single_cycles));
+	printk("%s batched ops per second: %llu\n", name, ops_per_s(batch_cycles));
+
+	return PSA_SUCCESS;
+}
+
+int main(void)
+{
+	psa_status_t status;
+
+	printk("CRACEN AEAD benchmark: %d packets of %d bytes\n", PACKET_COUNT, PAYLOAD_SIZE);
+
+	status = psa_crypto_init();
+	if (status != PSA_SUCCESS) {
+		printk("Test FAIL: psa_crypto_init failed (%d)\n", status);
+		return 0;
+	}
+
+	for (int i = 0; i < PACKET_COUNT; i++) {
+		memset(nonces[i], i, NONCE_SIZE);
+		memset(aad[i], 0xa0 + i, AAD_SIZE);
+		memset(plaintexts[i], 0x50 + i, PAYLOAD_SIZE);
+	}
+
+	if (benchmark("AES-CCM", PSA_ALG_CCM, NONCE_SIZE) != PSA_SUCCESS ||
+	    benchmark("AES-GCM", PSA_ALG_GCM, GCM_NONCE_SIZE) != PSA_SUCCESS) {
+		return 0;
+	}
+
+	printk("Test PASS\n");
+
+	return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <psa/crypto.h>
+
+#define ITERATIONS 50
+
+static uint8_t hash[PSA_HASH_LENGTH(PSA_ALG_SHA_256)];
+static uint8_t signature[PSA_SIGN_OUTPUT_SIZE(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+					      256, PSA_ALG_ECDSA(PSA_ALG_SHA_256))];
+static uint8_t public_key[PSA_EXPORT_PUBLIC_KEY_OUTPUT_SIZE(
+	PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 256)];
+
+static psa_status_t key_pair_create(psa_key_id_t *key_id)
+{
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+
+	psa_set_key_type(&attr, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
+	psa_set_key_bits(&attr, 256);
+	psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_SIGN_HASH);
+	psa_set_key_algorithm(&attr, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+
+	return psa_generate_key(&attr, key_id);
+}
+
+static psa_status_t public_key_import(const uint8_t *data, size_t length, psa_key_id_t *key_id)
+{
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+
+	psa_set_key_type(&attr, PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1));
+	psa_set_key_bits(&attr, 256);
+	psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_VERIFY_HASH);
+	psa_set_key_algorithm(&attr, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+
+	return psa_import_key(&attr, data, length, key_id);
+}
+
+int main(void)
+{
+	psa_key_id_t key_pair;
+	psa_key_id_t verify_key;
+	size_t length;
+	size_t signature_length;
+	psa_status_t status;
+	uint32_t start;
+	uint32_t cycles;
+
+	printk("CRACEN ECDSA benchmark: secp256r1, verification cache %s\n",
+	       IS_ENABLED(CONFIG_CRACEN_ECDSA_VERIFY_CACHE) ? "enabled" : "disabled");
+
+	status = psa_crypto_init();
+	if (status != PSA_SUCCESS) {
+		printk("Test FAIL: psa_crypto_init failed (%d)\n", status);
+		return 0;
+	}
+
+	status = key_pair_create(&key_pair);
+	if (status == PSA_SUCCESS) {
+		status = psa_export_public_key(key_pair, public_key, sizeof(public_key), &length);
+	}
+	if (status == PSA_SUCCESS) {
+		status = public_key_import(public_key, length, &verify_key);
+	}
+	if (status == PSA_SUCCESS) {
+		status = psa_hash_compute(PSA_ALG_SHA_256, (const uint8_t *)"manifest", 8, hash,
+					  sizeof(hash), &length);
+	}
+	if (status == PSA_SUCCESS) {
+		status = psa_sign_hash(key_pair, PSA_ALG_ECDSA(PSA_ALG_SHA_256), hash,
+				       sizeof(hash), signature, sizeof(signature),
+				       &signature_length);
+	}
+	if (status != PSA_SUCCESS) {
+		printk("Test FAIL: key setup failed (%d)\n", status);
+		return 0;
+	}
+
+	/* The same signature is verified repeatedly, like a firmware manifest or a token. */
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		status = psa_verify_hash(verify_key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), hash,
+					 sizeof(hash), signature, signature_length);
+		if (status != PSA_SUCCESS) {
+			printk("Test FAIL: verification failed (%d)\n", status);
+			return 0;
+		}
+	}
+	cycles = k_cycle_get_32() - start;
+
+	/* A modified signature must still be rejected. */
+	signature[signature_length - 1] ^= 1;
+	status = psa_verify_hash(verify_key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), hash, sizeof(hash),
+				 signature, signature_length);
+	if (status != PSA_ERROR_INVALID_SIGNATURE) {
+		printk("Test FAIL: modified signature not rejected (%d)\n", status);
+		return 0;
+	}
+
+	printk("Cycles per verification: %u\n", cycles / ITERATIONS);
+	printk("Verifications per second: %llu\n",
+	       ((uint64_t)ITERATIONS * sys_clock_hw_cycles_per_sec()) / MAX(cycles, 1));
+	printk("Test PASS\n");
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <psa/crypto.h>
+
+/* Number of hash operations that are updated in turn, like a TLS transcript
+ * hash, a DRBG and an image verification running at the same time.
+ */
+#define OPERATION_COUNT 3
+#define UPDATE_COUNT 64
+/* Typical size of a small update, for example a TLS handshake message fragment. */
+#define UPDATE_SIZE 32
+
+static uint8_t input[UPDATE_SIZE];
+
+static int benchmark(const char *name, psa_algorithm_t alg)
+{
+	psa_hash_operation_t operations[OPERATION_COUNT];
+	uint8_t hashes[OPERATION_COUNT][PSA_HASH_MAX_SIZE];
+	uint8_t reference[PSA_HASH_MAX_SIZE];
+	size_t length;
+	psa_status_t status;
+	uint32_t start;
+	uint32_t cycles;
+
+	for (int op = 0; op < OPERATION_COUNT; op++) {
+		operations[op] = psa_hash_operation_init();
+	}
+
+	start = k_cycle_get_32();
+
+	for (int op = 0; op < OPERATION_COUNT; op++) {
+		status = psa_hash_setup(&operations[op], alg);
+		if (status != PSA_SUCCESS) {
+			goto error;
+		}
+	}
+
+	for (int i = 0; i < UPDATE_COUNT; i++) {
+		for (int op = 0; op < OPERATION_COUNT; op++) {
+			status = psa_hash_update(&operations[op], input, sizeof(input));
+			if (status != PSA_SUCCESS) {
+				goto error;
+			}
+		}
+	}
+
+	for (int op = 0; op < OPERATION_COUNT; op++) {
+		status = psa_hash_finish(&operations[op], hashes[op], sizeof(hashes[op]),
+					 &length);
+		if (status != PSA_SUCCESS) {
+			goto error;
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	/* The interleaved operations must give the same hash as a single-part operation
+	 * over the same data.
+	 */
+	status = psa_hash_setup(&operations[0], alg);
+	for (int i = 0; i < UPDATE_COUNT && status == PSA_SUCCESS; i++) {
+		status = psa_hash_update(&operations[0], input, sizeof(input));
+	}
+	if (status == PSA_SUCCESS) {
+		status = psa_hash_finish(&operations[0], reference, sizeof(reference), &length);
+	}
+	if (status != PSA_SUCCESS) {
+		goto error;
+	}
+
+	for (int op = 0; op < OPERATION_COUNT; op++) {
+		if (memcmp(hashes[op], reference, length) != 0) {
+			printk("Test FAIL: %s hash mismatch\n", name);
+			return PSA_ERROR_CORRUPTION_DETECTED;
+		}
+	}
+
+	printk("%s: %u cycles per update\n", name, cycles / (OPERATION_COUNT * UPDATE_COUNT));
+
+	return PSA_SUCCESS;
+
+error:
+	printk("Test FAIL: %s failed (%d)\n", name, status);
+	for (int op = 0; op < OPERATION_COUNT; op++) {
+		(void)psa_hash_abort(&operations[op]);
+	}
+
+	return status;
+}
+
+int main(void)
+{
+	psa_status_t status;
+
+	printk("CRACEN hash benchmark: %d interleaved operations, %d byte updates, "
+	       "%d buffered blocks\n", OPERATION_COUNT, UPDATE_SIZE,
+	       CONFIG_CRACEN_HASH_BUFFER_BLOCKS);
+
+	status = psa_crypto_init();
+	if (status != PSA_SUCCESS) {
+		printk("Test FAIL: psa_crypto_init failed (%d)\n", status);
+		return 0;
+	}
+
+	memset(input, 0xa5, sizeof(input));
+
+	if (benchmark("SHA-256", PSA_ALG_SHA_256) != PSA_SUCCESS ||
+	    benchmark("SHA-512", PSA_ALG_SHA_512) != PSA_SUCCESS ||
+	    benchmark("SHA3-256", PSA_ALG_SHA3_256) != PSA_SUCCESS) {
+		return 0;
+	}
+
+	printk("Test PASS\n");
+
+	return 0;
+}
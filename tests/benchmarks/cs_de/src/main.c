@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <bluetooth/cs_de.h>
+
+#define ITERATIONS 100
+#define DISTANCE_M 10.0f
+
+#define PI		       (3.14159265358979f)
+#define CHANNEL_SPACING_HZ     (1e6f)
+#define SPEED_OF_LIGHT_M_PER_S (299792458.0f)
+
+static cs_de_report_t report;
+
+static void generate_ideal_iq_data(float distance, cs_de_iq_tones_t *iq_tones)
+{
+	float rotation_per_channel =
+		2 * PI * CHANNEL_SPACING_HZ * distance / SPEED_OF_LIGHT_M_PER_S;
+
+	for (int i = 0; i < CS_DE_NUM_CHANNELS; i++) {
+		iq_tones->i_local[i] = 100 * cosf(-rotation_per_channel * i);
+		iq_tones->q_local[i] = 100 * sinf(-rotation_per_channel * i);
+		iq_tones->i_remote[i] = 100 * cosf(-rotation_per_channel * i);
+		iq_tones->q_remote[i] = 100 * sinf(-rotation_per_channel * i);
+	}
+}
+
+int main(void)
+{
+	uint32_t start;
+	uint32_t cycles;
+	uint64_t updates_per_s;
+
+	printk("CS DE benchmark: NFFT %d, %d antenna paths\n", CONFIG_BT_CS_DE_NFFT_SIZE,
+	       CONFIG_BT_CS_DE_MAX_NUM_ANTENNA_PATHS);
+
+	report.n_ap = CONFIG_BT_CS_DE_MAX_NUM_ANTENNA_PATHS;
+
+	for (uint8_t ap = 0; ap < report.n_ap; ap++) {
+		report.tone_quality[ap] = CS_DE_TONE_QUALITY_OK;
+		generate_ideal_iq_data(DISTANCE_M, &report.iq_tones[ap]);
+	}
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		/* The IQ data is not modified, so the same report is processed in every round. */
+		if (cs_de_calc(&report) != CS_DE_QUALITY_OK) {
+			printk("Test FAIL: no valid estimate\n");
+			return 0;
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+	updates_per_s = ((uint64_t)ITERATIONS * sys_clock_hw_cycles_per_sec()) / MAX(cycles, 1);
+
+	printk("Cycles per ranging update: %u\n", cycles / ITERATIONS);
+	printk("Ranging updates per second: %llu\n", updates_per_s);
+	printk("Estimated distance: %d mm\n", (int)(report.distance_estimates[0].best * 1000));
+	printk("Test PASS\n");
+
+	return 0;
+}
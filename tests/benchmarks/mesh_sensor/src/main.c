@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <bluetooth/mesh/sensor_types.h>
+#include <sensor.h> /* private header from the source folder */
+
+#define ITERATIONS 10000
+#define VALUE_COUNT 40
+#define MICRO (1000000LL)
+
+struct bench_set {
+	const struct bt_mesh_sensor_format *format;
+	struct bt_mesh_sensor_value values[VALUE_COUNT];
+	struct bt_mesh_sensor_deltas deltas;
+	struct bt_mesh_sensor_threshold threshold;
+};
+
+/* Temperature is a scalar format evaluated with integer math, the
+ * coefficient format is a raw float and is evaluated with float math.
+ */
+static struct bench_set fixed = { .format = &bt_mesh_sensor_format_temp };
+static struct bench_set flt = { .format = &bt_mesh_sensor_format_coefficient };
+
+static void bench_set_init(struct bench_set *set)
+{
+	const struct bt_mesh_sensor_format *pct = &bt_mesh_sensor_format_percentage_delta_trigger;
+
+	for (int i = 0; i < VALUE_COUNT; i++) {
+		/* Values sweep 15 to 25 degrees in both directions, in steps
+		 * that are exact in both formats.
+		 */
+		int64_t micro = (15 * MICRO) + ((i * 10 * MICRO) / VALUE_COUNT);
+
+		if (!(i & 1)) {
+			micro = (40 * MICRO) - micro;
+		}
+
+		(void)bt_mesh_sensor_value_from_micro(set->format, micro, &set->values[i]);
+	}
+
+	/* 4.9 %, which no pair of values hits exactly. */
+	(void)bt_mesh_sensor_value_from_micro(pct, 4900000, &set->deltas.up);
+	(void)bt_mesh_sensor_value_from_micro(pct, 4900000, &set->deltas.down);
+	(void)bt_mesh_sensor_value_from_micro(set->format, 18 * MICRO, &set->threshold.range.low);
+	(void)bt_mesh_sensor_value_from_micro(set->format, 22 * MICRO, &set->threshold.range.high);
+}
+
+static uint32_t bench_run(const struct bench_set *set, uint32_t *triggers)
+{
+	const struct bt_mesh_sensor_format_cb *cb = set->format->cb;
+	uint32_t start = k_cycle_get_32();
+
+	*triggers = 0;
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		const struct bt_mesh_sensor_value *prev = &set->values[i % VALUE_COUNT];
+		const struct bt_mesh_sensor_value *curr = &set->values[(i + 1) % VALUE_COUNT];
+
+		/* Same evaluation as the sensor server does on every sample:
+		 * a range check followed by a delta check.
+		 */
+		if (BT_MESH_SENSOR_VALUE_IN_RANGE(curr, &set->threshold.range.low,
+						  &set->threshold.range.high) ||
+		    cb->delta_check(curr, prev, &set->deltas)) {
+			(*triggers)++;
+		}
+	}
+
+	return MAX(k_cycle_get_32() - start, 1);
+}
+
+int main(void)
+{
+	uint32_t fixed_cycles, flt_cycles;
+	uint32_t fixed_triggers, flt_triggers;
+
+	bench_set_init(&fixed);
+	bench_set_init(&flt);
+
+	fixed_cycles = bench_run(&fixed, &fixed_triggers);
+	flt_cycles = bench_run(&flt, &flt_triggers);
+
+	printk("Fixed-point delta checks per second: %llu\n",
+	       ((uint64_t)ITERATIONS * sys_clock_hw_cycles_per_sec()) / fixed_cycles);
+	printk("Float delta checks per second: %llu\n",
+	       ((uint64_t)ITERATIONS * sys_clock_hw_cycles_per_sec()) / flt_cycles);
+
+	if (fixed_triggers != flt_triggers) {
+		printk("Test FAIL: %u fixed-point triggers, %u float triggers\n", fixed_triggers,
+		       flt_triggers);
+		return 0;
+	}
+
+	printk("Test PASS\n");
+
+	return 0;
+}
@@ -118,4 +118,49 @@ ZTEST(flash_driver, test_read_unaligned_address)
 	}
 }
 
+ZTEST(flash_driver, test_small_sequential_access)
+{
+	int rc;
+	const size_t chunk = 8;
+
+	zassert_true(device_is_ready(flash_dev));
+
+	for (int i = 0; i < TEST_AREA_PAGE_SIZE; i++) {
+		expected[i] = i ^ CANARY;
+	}
+
+	rc = flash_erase(flash_dev, TEST_AREA_START_ADDR, TEST_AREA_PAGE_SIZE);
+	zassert_equal(rc, 0, "Flash memory erase failed");
+
+	for (size_t off = 0; off < TEST_AREA_PAGE_SIZE; off += chunk) {
+		rc = flash_write(flash_dev, TEST_AREA_START_ADDR + off, expected + off, chunk);
+		zassert_equal(rc, 0, "Cannot write to flash off=%zu", off);
+
+		/* Read back the written data, and the erased data after it. */
+		rc = flash_read(flash_dev, TEST_AREA_START_ADDR + off, buf, chunk);
+		zassert_equal(rc, 0, "Cannot read flash off=%zu", off);
+		zassert_equal(memcmp(buf, expected + off, chunk), 0, "Flash read failed off=%zu",
+			      off);
+
+		if (off + chunk < TEST_AREA_PAGE_SIZE) {
+			rc = flash_read(flash_dev, TEST_AREA_START_ADDR + off + chunk, buf, 1);
+			zassert_equal(rc, 0, "Cannot read flash off=%zu", off);
+			zassert_equal(buf[0], 0xff, "Unexpected data after off=%zu", off);
+		}
+	}
+
+	for (size_t off = 0; off < TEST_AREA_PAGE_SIZE; off++) {
+		rc = flash_read(flash_dev, TEST_AREA_START_ADDR + off, buf, 1);
+		zassert_equal(rc, 0, "Cannot read flash off=%zu", off);
+		zassert_equal(buf[0], expected[off], "Flash read failed off=%zu", off);
+	}
+
+	rc = flash_erase(flash_dev, TEST_AREA_START_ADDR, TEST_AREA_PAGE_SIZE);
+	zassert_equal(rc, 0, "Flash memory erase failed");
+
+	rc = flash_read(flash_dev, TEST_AREA_START_ADDR, buf, chunk);
+	zassert_equal(rc, 0, "Cannot read flash");
+	zassert_equal(buf[0], 0xff, "Erased data expected");
+}
+
 ZTEST_SUITE(flash_driver, NULL, NULL, NULL, NULL, NULL);
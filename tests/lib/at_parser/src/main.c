@@ -2190,4 +2190,117 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+ZTEST(at_parser, test_at_parser_index_set_einval)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index_entry index[4];
+
+	ret = at_parser_init(&parser, "+NOTIF: 1\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_index_set(NULL, index, ARRAY_SIZE(index));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_index_set(&parser, NULL, ARRAY_SIZE(index));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_index_set(&parser, index, 0);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_index_set)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index_entry index[8];
+	int32_t num = 0;
+	char buffer[16] = { 0 };
+	size_t len;
+
+	const char *str1 = "+NOTIF: 1,\"two\",,4\r\n"
+			   "+NOTIF2: 5,6\r\n"
+			   "OK\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	ret = at_parser_index_set(&parser, index, ARRAY_SIZE(index));
+	zassert_ok(ret);
+
+	/* Values can be read in any order. */
+	ret = at_parser_num_get(&parser, 4, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 4);
+
+	len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 2, buffer, &len);
+	zassert_ok(ret);
+	zassert_equal(len, strlen("two"));
+	zassert_mem_equal("two", buffer, len);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -ENODATA);
+
+	len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 0, buffer, &len);
+	zassert_ok(ret);
+	zassert_mem_equal("+NOTIF", buffer, len);
+
+	ret = at_parser_num_get(&parser, 5, &num);
+	zassert_equal(ret, -EAGAIN);
+
+	/* The index is rebuilt for the next line. */
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 6);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 5);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -EIO);
+}
+
+ZTEST(at_parser, test_at_parser_index_set_partial)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index_entry index[2];
+	int32_t num = 0;
+	size_t count = 0;
+
+	const char *str1 = "+NOTIF: 1,2,3,4\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	ret = at_parser_index_set(&parser, index, ARRAY_SIZE(index));
+	zassert_ok(ret);
+
+	/* Values that are not indexed are still available. */
+	ret = at_parser_num_get(&parser, 4, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 4);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 3);
+
+	ret = at_parser_num_get(&parser, 5, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 5);
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <modem/at_parser.h>
+
+#define MAX_VALUES 32
+
+struct value_record {
+	size_t line;
+	size_t index;
+	enum at_parser_value_type type;
+	enum at_parser_cmd_type cmd_type;
+	char str[80];
+	int64_t num;
+};
+
+static struct value_record values[MAX_VALUES];
+static size_t values_count;
+static int cb_err;
+
+static int value_cb(const struct at_parser_value *value, void *user_data)
+{
+	struct value_record *rec = &values[values_count];
+
+	ARG_UNUSED(user_data);
+
+	zassert_true(values_count < MAX_VALUES);
+	zassert_true(value->len < sizeof(rec->str));
+
+	rec->line = value->line;
+	rec->index = value->index;
+	rec->type = value->type;
+	rec->cmd_type = value->cmd_type;
+	rec->num = value->num;
+	memcpy(rec->str, value->str, value->len);
+	rec->str[value->len] = '\0';
+
+	values_count++;
+
+	return cb_err;
+}
+
+static int stream_parse(const char *at, size_t chunk_size, size_t buf_size)
+{
+	static char buf[128];
+	struct at_parser_stream stream;
+	size_t len = strlen(at);
+	int err;
+
+	zassert_true(buf_size <= sizeof(buf));
+
+	values_count = 0;
+	memset(values, 0, sizeof(values));
+
+	err = at_parser_stream_init(&stream, buf, buf_size, value_cb, NULL);
+	zassert_ok(err);
+
+	for (size_t i = 0; i < len; i += chunk_size) {
+		err = at_parser_stream_feed(&stream, at + i, MIN(chunk_size, len - i));
+		if (err) {
+			return err;
+		}
+	}
+
+	return at_parser_stream_finish(&stream);
+}
+
+static void value_check(size_t i, size_t line, size_t index, enum at_parser_value_type type,
+			const char *str)
+{
+	zassert_true(i < values_count);
+	zassert_equal(values[i].line, line);
+	zassert_equal(values[i].index, index);
+	zassert_equal(values[i].type, type);
+	zassert_str_equal(values[i].str, str);
+}
+
+ZTEST(at_parser_stream, test_at_parser_stream_notif)
+{
+	static const char at[] = "+CEREG: 2,\"76C1\",\"0102DA04\", 7\r\n";
+
+	/* Feed the notification one byte at a time. */
+	zassert_ok(stream_parse(at, 1, 32));
+
+	zassert_equal(values_count, 5);
+	value_check(0, 0, 0, AT_PARSER_VALUE_TYPE_PREFIX, "+CEREG");
+	zassert_equal(values[0].cmd_type, AT_PARSER_CMD_TYPE_UNKNOWN);
+	value_check(1, 0, 1, AT_PARSER_VALUE_TYPE_INT, "2");
+	zassert_equal(values[1].num, 2);
+	value_check(2, 0, 2, AT_PARSER_VALUE_TYPE_STRING, "76C1");
+	value_check(3, 0, 3, AT_PARSER_VALUE_TYPE_STRING, "0102DA04");
+	value_check(4, 0, 4, AT_PARSER_VALUE_TYPE_INT, "7");
+	zassert_equal(values[4].num, 7);
+}
+
+ZTEST(at_parser_stream, test_at_parser_stream_multiline)
+{
+	static const char at[] =
+		"+CGEQOSRDP: 0,0,,\r\n"
+		"+CGEQOSRDP: 2,4,,,1,65280000\r\n"
+		"OK\r\n"
+		"+IGNORED: 1\r\n";
+
+	zassert_ok(stream_parse(at, 7, 32));
+
+	zassert_equal(values_count, 12);
+	value_check(0, 0, 0, AT_PARSER_VALUE_TYPE_PREFIX, "+CGEQOSRDP");
+	value_check(3, 0, 3, AT_PARSER_VALUE_TYPE_EMPTY, "");
+	value_check(4, 0, 4, AT_PARSER_VALUE_TYPE_EMPTY, "");
+	value_check(5, 1, 0, AT_PARSER_VALUE_TYPE_PREFIX, "+CGEQOSRDP");
+	value_check(9, 1, 4, AT_PARSER_VALUE_TYPE_EMPTY, "");
+	value_check(11, 1, 6, AT_PARSER_VALUE_TYPE_INT, "65280000");
+	zassert_equal(values[11].num, 65280000);
+}
+
+ZTEST(at_parser_stream, test_at_parser_stream_cmd)
+{
+	zassert_ok(stream_parse("AT+CGDCONT=0,\"IP\",\"a,b\"", 3, 32));
+
+	zassert_equal(values_count, 4);
+	value_check(0, 0, 0, AT_PARSER_VALUE_TYPE_PREFIX, "AT+CGDCONT");
+	zassert_equal(values[0].cmd_type, AT_PARSER_CMD_TYPE_SET);
+	value_check(3, 0, 3, AT_PARSER_VALUE_TYPE_STRING, "a,b");
+
+	zassert_ok(stream_parse("AT+CFUN=?", 1, 32));
+
+	zassert_equal(values_count, 1);
+	zassert_equal(values[0].cmd_type, AT_PARSER_CMD_TYPE_TEST);
+
+	zassert_ok(stream_parse("+CSCON: (0,1),\"x\"\r\n", 2, 32));
+
+	zassert_equal(values_count, 3);
+	value_check(1, 0, 1, AT_PARSER_VALUE_TYPE_ARRAY, "0,1");
+}
+
+ZTEST(at_parser_stream, test_at_parser_stream_pdu)
+{
+	static const char at[] =
+		"\r\n+CMT: \"12345678\", 24\r\n"
+		"06917429000171040A91747966543100009160402143708006C8329BFD0601\r\n"
+		"\r\nOK\r\n";
+
+	zassert_ok(stream_parse(at, 5, 128));
+
+	zassert_equal(values_count, 4);
+	value_check(2, 0, 2, AT_PARSER_VALUE_TYPE_INT, "24");
+	value_check(3, 1, 0, AT_PARSER_VALUE_TYPE_STRING,
+		    "06917429000171040A91747966543100009160402143708006C8329BFD0601");
+}
+
+ZTEST(at_parser_stream, test_at_parser_stream_chunk_size)
+{
+	static const char at[] =
+		"%NCELLMEAS: 0,\"021D\",\"24201\",\"0B23\",65535,5300,2315,36,23,0,"
+		"\"021D\",1200,15,60\r\nOK\r\n";
+	struct value_record ref[MAX_VALUES];
+	size_t ref_count;
+
+	zassert_ok(stream_parse(at, sizeof(at), 128));
+	zassert_equal(values_count, 15);
+
+	memcpy(ref, values, sizeof(ref));
+	ref_count = values_count;
+
+	/* The values must not depend on how the string is split. */
+	for (size_t chunk_size = 1; chunk_size < 24; chunk_size++) {
+		zassert_ok(stream_parse(at, chunk_size, 16));
+		zassert_equal(values_count, ref_count);
+		zassert_mem_equal(values, ref, sizeof(ref));
+	}
+}
+
+ZTEST(at_parser_stream, test_at_parser_stream_errors)
+{
+	/* The quoted string does not fit the buffer. */
+	zassert_equal(stream_parse("+CMD: \"0123456789ABCDEF\"\r\n", 4, 16), -ENOMEM);
+
+	/* Missing comma between subparameters. */
+	zassert_equal(stream_parse("+CEREG: 1,2 3\r\n", 4, 32), -EBADMSG);
+	zassert_equal(values_count, 3);
+
+	/* The callback stops parsing. */
+	cb_err = -ECANCELED;
+	zassert_equal(stream_parse("+CEREG: 1,2\r\n", 1, 32), -ECANCELED);
+	zassert_equal(values_count, 1);
+	cb_err = 0;
+}
+
+ZTEST(at_parser_stream, test_at_parser_stream_invalid)
+{
+	struct at_parser_stream stream;
+	char buf[16];
+
+	zassert_equal(at_parser_stream_init(NULL, buf, sizeof(buf), value_cb, NULL), -EINVAL);
+	zassert_equal(at_parser_stream_init(&stream, NULL, sizeof(buf), value_cb, NULL), -EINVAL);
+	zassert_equal(at_parser_stream_init(&stream, buf, 1, value_cb, NULL), -EINVAL);
+	zassert_equal(at_parser_stream_init(&stream, buf, sizeof(buf), NULL, NULL), -EINVAL);
+
+	zassert_ok(at_parser_stream_init(&stream, buf, sizeof(buf), value_cb, NULL));
+	zassert_equal(at_parser_stream_feed(NULL, "AT", 2), -EINVAL);
+	zassert_equal(at_parser_stream_feed(&stream, NULL, 2), -EINVAL);
+	zassert_equal(at_parser_stream_finish(NULL), -EINVAL);
+}
+
+ZTEST_SUITE(at_parser_stream, NULL, NULL, NULL, NULL, NULL);
@@ -7,6 +7,7 @@
 #include <zephyr/ztest.h>
 #include <errno.h>
 #include <data_fifo.h>
+#include <zephyr/irq_offload.h>
 
 /* Catch asserts to fail test */
 void assert_post_action(const char *file, unsigned int line)
@@ -231,4 +232,152 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_get_ok)
+{
+#define SPSC_BLOCKS_NUM 4
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Wrap around the ring a few times. */
+	for (uint32_t i = 0; i < 3 * SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		data_ptr[0] = i;
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], i, "data contents are not identical");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+
+		internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "_last_filled_get did not return -ENOMSG");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_too_many)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not time out");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, 0, "_last_filled_get did not return 0");
+
+	data_fifo_block_free(&data_fifo, data_ptr_read);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	zassert_equal_ptr(data_ptr, data_ptr_read, "freed block was not reused");
+
+	/* A block that failed to be locked is given back by the producer. */
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 0);
+	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
+
+	data_fifo_block_free(&data_fifo, data_ptr);
+
+	internal_test_remaining_elements(&data_fifo, SPSC_BLOCKS_NUM - 1, SPSC_BLOCKS_NUM - 1,
+					 __LINE__);
+
+	ret = data_fifo_uninit(&data_fifo);
+	zassert_equal(ret, 0, "deinit did not return 0");
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+static struct data_fifo *spsc_isr_fifo;
+static uint32_t spsc_isr_count;
+
+static void spsc_isr_producer(const void *arg)
+{
+	int ret;
+	uint32_t *data_ptr;
+
+	ARG_UNUSED(arg);
+
+	ret = data_fifo_pointer_first_vacant_get(spsc_isr_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	*data_ptr = spsc_isr_count++;
+
+	ret = data_fifo_block_lock(spsc_isr_fifo, (void **)&data_ptr, sizeof(uint32_t));
+	zassert_equal(ret, 0, "block_lock did not return 0");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_isr_producer)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, 128);
+
+	int ret;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	spsc_isr_fifo = &data_fifo;
+	spsc_isr_count = 0;
+
+	for (uint32_t i = 0; i < 2 * SPSC_BLOCKS_NUM; i++) {
+		irq_offload(spsc_isr_producer, NULL);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_MSEC(10));
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(*(uint32_t *)data_ptr_read, i, "data contents are not identical");
+		zassert_equal(data_size, sizeof(uint32_t), "data size incorrect");
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+	}
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+						K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "_last_filled_get did not time out");
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
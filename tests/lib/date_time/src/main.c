@@ -256,6 +256,7 @@ void test_date_time_no_valid_time_fail(void)
 {
 	int ret;
 	int64_t ts_unix_ms = 0;
+	uint32_t uncertainty_ms = 0;
 
 	ret = date_time_now(&ts_unix_ms);
 	TEST_ASSERT_EQUAL(-ENODATA, ret);
@@ -268,6 +269,11 @@ void test_date_time_no_valid_time_fail(void)
 	ret = date_time_uptime_to_unix_time_ms(&ts_unix_ms);
 	TEST_ASSERT_EQUAL(-ENODATA, ret);
 	TEST_ASSERT_EQUAL(0, ts_unix_ms);
+
+	ret = date_time_now_uncertainty(&ts_unix_ms, &uncertainty_ms);
+	TEST_ASSERT_EQUAL(-ENODATA, ret);
+	TEST_ASSERT_EQUAL(0, ts_unix_ms);
+	TEST_ASSERT_EQUAL(0, uncertainty_ms);
 }
 
 void test_date_time_uptime_to_unix_time_ms_already_converted(void)
@@ -425,6 +431,25 @@ void test_date_time_is_valid(void)
 	TEST_ASSERT_EQUAL(0, ts_unix_ms);
 }
 
+void test_date_time_now_uncertainty(void)
+{
+	int ret;
+	int64_t ts_unix_ms = 0;
+	uint32_t uncertainty_ms = 0;
+
+	ret = date_time_now_uncertainty(NULL, &uncertainty_ms);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	ret = date_time_now_uncertainty(&ts_unix_ms, NULL);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	/* The time set in the previous test was obtained from an external source. */
+	ret = date_time_now_uncertainty(&ts_unix_ms, &uncertainty_ms);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_INT64_WITHIN(100, date_time_global_unix, ts_unix_ms);
+	TEST_ASSERT_UINT32_WITHIN(10, 1000, uncertainty_ms);
+}
+
 void test_date_time_xtime_subscribe_fail(void)
 {
 #if !defined(CONFIG_DATE_TIME_MODEM)
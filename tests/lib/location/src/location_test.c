@@ -1452,6 +1452,18 @@ void test_location_pgps_data_process_fail_notsup(void)
 	TEST_ASSERT_EQUAL(-ENOTSUP, err);
 }
 
+/* Test location cache functions not supported. */
+void test_location_cache_fail_notsup(void)
+{
+	int err;
+
+	err = location_stationary_hint_set(true);
+	TEST_ASSERT_EQUAL(-ENOTSUP, err);
+
+	err = location_cache_clear();
+	TEST_ASSERT_EQUAL(-ENOTSUP, err);
+}
+
 /* Tests a use case where external cloud location result is delayed and arrives at an unexpected
  * time during the next location request execution. This can happen when the request can not be
  * sent immediately to the cloud and the first location request times out before the results are
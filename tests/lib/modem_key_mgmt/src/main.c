@@ -139,6 +139,93 @@ ZTEST(suite_modem_key_mgmt, test_digest_invalid_response)
 	zassert_equal(err, -EINVAL);
 }
 
+static int nrf_modem_at_scanf_test_digest_cmp(const char *cmd, const char *fmt, va_list args)
+{
+	if (strcmp("AT+CMEE?", cmd) == 0) {
+		/* For the purpose of this test, simplify by having the cmee already enabled. */
+		return vsscanf(test_cmee_enabled, fmt, args);
+	}
+
+	zassert_equal(0, strcmp("AT%CMNG=1,16842753,1", cmd));
+	return vsscanf(test_data_digest, fmt, args);
+}
+
+ZTEST(suite_modem_key_mgmt, test_digest_cmp_match)
+{
+	int err;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_test_digest_cmp;
+
+	err = modem_key_mgmt_digest_cmp(16842753, MODEM_KEY_MGMT_CRED_TYPE_PUBLIC_CERT,
+					expected_digest);
+	zassert_equal(err, 0);
+}
+
+ZTEST(suite_modem_key_mgmt, test_digest_cmp_mismatch)
+{
+	uint8_t digest[sizeof(expected_digest)];
+	int err;
+
+	memcpy(digest, expected_digest, sizeof(digest));
+	digest[sizeof(digest) - 1] ^= 0xFF;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_test_digest_cmp;
+
+	err = modem_key_mgmt_digest_cmp(16842753, MODEM_KEY_MGMT_CRED_TYPE_PUBLIC_CERT, digest);
+	zassert_equal(err, 1);
+}
+
+static const char test_cert[] = "-----BEGIN CERTIFICATE-----";
+
+ZTEST(suite_modem_key_mgmt, test_write_if_changed_skip)
+{
+	int err;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_test_digest_cmp;
+
+	err = modem_key_mgmt_write_if_changed(16842753, MODEM_KEY_MGMT_CRED_TYPE_PUBLIC_CERT,
+					      test_cert, strlen(test_cert), expected_digest);
+	zassert_ok(err);
+	zassert_equal(nrf_modem_at_printf_fake.call_count, 0);
+}
+
+ZTEST(suite_modem_key_mgmt, test_write_if_changed_write)
+{
+	uint8_t digest[sizeof(expected_digest)];
+	int err;
+
+	memset(digest, 0, sizeof(digest));
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_test_digest_cmp;
+
+	err = modem_key_mgmt_write_if_changed(16842753, MODEM_KEY_MGMT_CRED_TYPE_PUBLIC_CERT,
+					      test_cert, strlen(test_cert), digest);
+	zassert_ok(err);
+	zassert_equal(nrf_modem_at_printf_fake.call_count, 1);
+	zassert_equal(0, strcmp("AT%%CMNG=0,%u,%d,\"%.*s\"", nrf_modem_at_printf_fake.arg0_val));
+}
+
+static int nrf_modem_at_scanf_test_write_if_changed_no_entry(const char *cmd, const char *fmt,
+							      va_list args)
+{
+	if (strcmp("AT+CMEE?", cmd) == 0) {
+		return vsscanf(test_cmee_enabled, fmt, args);
+	}
+
+	return vsscanf(test_data_empty_list, fmt, args);
+}
+
+ZTEST(suite_modem_key_mgmt, test_write_if_changed_no_entry)
+{
+	int err;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_test_write_if_changed_no_entry;
+
+	err = modem_key_mgmt_write_if_changed(0, MODEM_KEY_MGMT_CRED_TYPE_CA_CHAIN,
+					      test_cert, strlen(test_cert), expected_digest);
+	zassert_ok(err);
+	zassert_equal(nrf_modem_at_printf_fake.call_count, 1);
+}
 
 ZTEST(suite_modem_key_mgmt, test_list_response_too_big)
 {
@@ -141,10 +141,49 @@ static struct nrf_802154_callbacks client_b_cbs = {
 NRF_802154_CALLBACKS_DISPATCHER_REGISTER(client_a, client_a_cbs);
 NRF_802154_CALLBACKS_DISPATCHER_REGISTER(client_b, client_b_cbs);
 
+struct observer_test_stats {
+	int evt_count[NRF_802154_CB_OBSERVER_EVT_COUNT];
+	uint8_t last_psdu[PHR_SIZE + MAX_PACKET_SIZE];
+	bool in_sys_work_q;
+};
+
+static struct observer_test_stats direct_observer_stats;
+static struct observer_test_stats deferred_observer_stats;
+
+static void observer_stats_update(struct observer_test_stats *stats,
+				  const struct nrf_802154_cb_observer_evt *evt)
+{
+	stats->evt_count[evt->type]++;
+
+	if (evt->psdu != NULL) {
+		memcpy(stats->last_psdu, evt->psdu, evt->psdu[0] + PHR_SIZE);
+	}
+
+	stats->in_sys_work_q = (k_current_get() == k_work_queue_thread_get(&k_sys_work_q));
+}
+
+static void direct_observer_handler(const struct nrf_802154_cb_observer_evt *evt)
+{
+	observer_stats_update(&direct_observer_stats, evt);
+}
+
+static void deferred_observer_handler(const struct nrf_802154_cb_observer_evt *evt)
+{
+	observer_stats_update(&deferred_observer_stats, evt);
+}
+
+NRF_802154_CALLBACKS_DISPATCHER_OBSERVER_REGISTER(direct_observer,
+	NRF_802154_CB_OBSERVER_EVT_MASK(RECEIVED), false, direct_observer_handler);
+NRF_802154_CALLBACKS_DISPATCHER_OBSERVER_REGISTER(deferred_observer,
+	NRF_802154_CB_OBSERVER_EVT_MASK(RECEIVED) | NRF_802154_CB_OBSERVER_EVT_MASK(ENERGY_DETECTED),
+	true, deferred_observer_handler);
+
 static void reset_client_stats(void)
 {
 	memset(&client_a_stats, 0, sizeof(client_a_stats));
 	memset(&client_b_stats, 0, sizeof(client_b_stats));
+	memset(&direct_observer_stats, 0, sizeof(direct_observer_stats));
+	memset(&deferred_observer_stats, 0, sizeof(deferred_observer_stats));
 }
 
 static void *suite_setup(void)
@@ -304,3 +343,48 @@ ZTEST(nrf_802154_callbacks_dispatcher, test_reinit_resets_radio_state)
 	zassert_true(nrf_802154_stub_stats.tx_power_set_count > 0);
 	zassert_equal(nrf_802154_stub_stats.ack_data_remove_all_count, 2);
 }
+
+ZTEST(nrf_802154_callbacks_dispatcher, test_observers_follow_interest_masks)
+{
+	uint8_t frame[16] = { 3, 0x01, 0x02, 0x03 };
+	nrf_802154_transmit_done_metadata_t metadata = { 0 };
+	nrf_802154_energy_detected_t ed_result = { .ed_dbm = -70 };
+
+	nrf_802154_received_timestamp_raw(frame, -50, 200, 1234);
+	nrf_802154_transmitted_raw(frame, &metadata);
+	nrf_802154_energy_detected(&ed_result);
+	nrf_802154_energy_detection_failed(NRF_802154_ED_ERROR_ABORTED);
+
+	/* Let the system workqueue handle the deferred events. */
+	k_sleep(K_MSEC(10));
+
+	zassert_equal(direct_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_RECEIVED], 1);
+	zassert_equal(direct_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_TRANSMITTED], 0);
+	zassert_equal(direct_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTED],
+		      0);
+	zassert_false(direct_observer_stats.in_sys_work_q);
+	zassert_mem_equal(direct_observer_stats.last_psdu, frame, frame[0] + PHR_SIZE);
+
+	zassert_equal(deferred_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_RECEIVED], 1);
+	zassert_equal(deferred_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_TRANSMITTED], 0);
+	zassert_equal(deferred_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTED],
+		      1);
+	zassert_equal(deferred_observer_stats.evt_count
+		      [NRF_802154_CB_OBSERVER_EVT_ENERGY_DETECTION_FAILED], 0);
+	zassert_true(deferred_observer_stats.in_sys_work_q);
+	zassert_mem_equal(deferred_observer_stats.last_psdu, frame, frame[0] + PHR_SIZE);
+}
+
+ZTEST(nrf_802154_callbacks_dispatcher, test_observers_run_with_active_client)
+{
+	uint8_t frame[16] = { 3, 0x01, 0x02, 0x03 };
+
+	zassert_ok(nrf_802154_callbacks_dispatcher_switch("client_a"));
+
+	nrf_802154_received_timestamp_raw(frame, -50, 200, 1234);
+	k_sleep(K_MSEC(10));
+
+	zassert_equal(client_a_stats.received_count, 1);
+	zassert_equal(direct_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_RECEIVED], 1);
+	zassert_equal(deferred_observer_stats.evt_count[NRF_802154_CB_OBSERVER_EVT_RECEIVED], 1);
+}
@@ -13,6 +13,8 @@
 #include <nrf_socket.h>
 #include <nrf_gai_errors.h>
 
+#include <modem/nrf_modem_lib.h>
+
 #include "cmock_nrf_socket.h"
 #include "cmock_nrf_modem_os.h"
 
@@ -1629,6 +1631,99 @@ void test_nrf9x_socket_offload_sendmsg_not_fits_buf(void)
 	TEST_ASSERT_EQUAL(ret, 0);
 }
 
+void test_nrf9x_socket_offload_sendmsg_single_buf(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = NET_AF_INET;
+	int type = NET_SOCK_STREAM;
+	int proto = NET_IPPROTO_TCP;
+	int flags = ZSOCK_MSG_DONTWAIT;
+	struct net_msghdr msg = { 0 };
+	struct net_iovec chunks[3] = { 0 };
+	uint8_t data[16] = { 0 };
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM, NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	/* A single non-empty buffer, larger than the intermediate buffer */
+	chunks[1].iov_base = data;
+	chunks[1].iov_len = sizeof(data);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 3;
+
+	/* The buffer is passed as is, and the remainder after a partial send */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, data, sizeof(data),
+					   NRF_MSG_DONTWAIT,
+					   NULL, 0, sizeof(data) - 4);
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, data + sizeof(data) - 4, 4,
+					   NRF_MSG_DONTWAIT,
+					   NULL, 0, 4);
+
+	ret = zsock_sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, sizeof(data));
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf9x_socket_offload_sendmsg_dgram_not_fits_buf(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = NET_AF_INET;
+	int type = NET_SOCK_DGRAM;
+	int proto = NET_IPPROTO_UDP;
+	int flags = ZSOCK_MSG_DONTWAIT;
+	struct net_msghdr msg = { 0 };
+	struct net_iovec chunks[3] = { 0 };
+	int chunk_1 = 42;
+	int chunk_2 = 43;
+	int chunk_3 = 44;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = &chunk_1;
+	chunks[0].iov_len = sizeof(int);
+	chunks[1].iov_base = &chunk_2;
+	chunks[1].iov_len = sizeof(int);
+	chunks[2].iov_base = &chunk_3;
+	chunks[2].iov_len = sizeof(int);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 3;
+
+	/* The datagram is sent in a single call even if it does not fit the
+	 * intermediate buffer.
+	 */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, NULL, 3 * sizeof(int),
+					   NRF_MSG_DONTWAIT,
+					   NULL, 0, 3 * sizeof(int));
+	__cmock_nrf_sendto_IgnoreArg_message();
+
+	ret = zsock_sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, 3 * sizeof(int));
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
 void test_nrf9x_socket_offload_fcntl_einval(void)
 {
 	int ret;
@@ -1916,6 +2011,111 @@ void test_nrf9x_socket_offload_dtls_frag_ext(void)
 	TEST_ASSERT_EQUAL(ret, 0);
 }
 
+static ssize_t nrf_recvfrom_loan_stub(int socket, void *buffer, size_t length, int flags,
+				      struct nrf_sockaddr *address, nrf_socklen_t *address_len,
+				      int cmock_num_calls)
+{
+	static const uint8_t payload[] = { 0xde, 0xad, 0xbe, 0xef };
+
+	TEST_ASSERT_EQUAL(CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_SIZE, length);
+	TEST_ASSERT_NULL(address);
+	TEST_ASSERT_NULL(address_len);
+
+	memcpy(buffer, payload, sizeof(payload));
+
+	return sizeof(payload);
+}
+
+void test_nrf_modem_lib_recv_loan_success(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = NRF_FD;
+	const uint8_t *data;
+	const uint8_t *loaned;
+	const uint8_t expected[] = { 0xde, 0xad, 0xbe, 0xef };
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM, NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = zsock_socket(NET_AF_INET, NET_SOCK_STREAM, NET_IPPROTO_TCP);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	__cmock_nrf_recvfrom_Stub(nrf_recvfrom_loan_stub);
+
+	ret = nrf_modem_lib_recv_loan(fd, (const void **)&data, 0);
+
+	TEST_ASSERT_EQUAL(sizeof(expected), ret);
+	TEST_ASSERT_NOT_NULL(data);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, data, sizeof(expected));
+
+	loaned = data;
+
+	/* All buffers are loaned. */
+	ret = nrf_modem_lib_recv_loan(fd, (const void **)&data, 0);
+
+	TEST_ASSERT_EQUAL(-1, ret);
+	TEST_ASSERT_EQUAL(ENOBUFS, errno);
+	TEST_ASSERT_NULL(data);
+
+	nrf_modem_lib_recv_loan_release(loaned);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf_modem_lib_recv_loan_error(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = NRF_FD;
+	const void *data;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM, NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = zsock_socket(NET_AF_INET, NET_SOCK_STREAM, NET_IPPROTO_TCP);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	__cmock_nrf_recvfrom_ExpectAndReturn(nrf_fd, NULL, CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_SIZE,
+					     0, NULL, NULL, -1);
+	__cmock_nrf_recvfrom_IgnoreArg_buffer();
+
+	ret = nrf_modem_lib_recv_loan(fd, &data, 0);
+
+	TEST_ASSERT_EQUAL(-1, ret);
+	TEST_ASSERT_NULL(data);
+
+	/* The buffer is returned to the pool on failure. */
+	__cmock_nrf_recvfrom_ExpectAndReturn(nrf_fd, NULL, CONFIG_NRF_MODEM_LIB_RECV_LOAN_BUF_SIZE,
+					     0, NULL, NULL, 0);
+	__cmock_nrf_recvfrom_IgnoreArg_buffer();
+
+	ret = nrf_modem_lib_recv_loan(fd, &data, 0);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_NULL(data);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf_modem_lib_recv_loan_einval(void)
+{
+	int ret;
+
+	ret = nrf_modem_lib_recv_loan(0, NULL, 0);
+
+	TEST_ASSERT_EQUAL(-1, ret);
+	TEST_ASSERT_EQUAL(EINVAL, errno);
+}
+
 /* It is required to be added to each test. That is because unity's
  * main may return nonzero, while zephyr's main currently must
  * return 0 in all cases (other values are reserved).
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <unity.h>
+#include <zephyr/kernel.h>
+
+#include "nrf_modem_lib_trace.h"
+#include "trace_backend.h"
+
+#define QUEUE_SIZE CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_RTT_QUEUE_SIZE
+#define CHUNK_SIZE CONFIG_NRF_MODEM_LIB_TRACE_FANOUT_CHUNK_SIZE
+
+#define SINK_WAIT_MS 1000
+
+extern struct nrf_modem_lib_trace_backend trace_backend;
+
+static K_SEM_DEFINE(sink_write_entered, 0, 1);
+static K_SEM_DEFINE(sink_write_release, 0, 1);
+
+static bool sink_write_block;
+static int sink_init_err;
+static uint8_t sink_data[512];
+static size_t sink_data_len;
+static size_t processed_len;
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+void nrf_modem_lib_trace_callback(enum nrf_modem_lib_trace_event evt)
+{
+}
+
+static int processed_cb(size_t len)
+{
+	processed_len += len;
+
+	return 0;
+}
+
+/* Fake backend standing in for the RTT backend, written by the fan-out RTT sink thread. */
+static int sink_init(trace_backend_processed_cb trace_processed_cb)
+{
+	return sink_init_err;
+}
+
+static int sink_deinit(void)
+{
+	return 0;
+}
+
+static int sink_write(const void *data, size_t len)
+{
+	if (sink_write_block) {
+		sink_write_block = false;
+		k_sem_give(&sink_write_entered);
+		k_sem_take(&sink_write_release, K_FOREVER);
+	}
+
+	TEST_ASSERT_LESS_OR_EQUAL(sizeof(sink_data) - sink_data_len, len);
+
+	memcpy(&sink_data[sink_data_len], data, len);
+	sink_data_len += len;
+
+	return (int)len;
+}
+
+struct nrf_modem_lib_trace_backend trace_backend_rtt = {
+	.init = sink_init,
+	.deinit = sink_deinit,
+	.write = sink_write,
+};
+
+static void sink_data_wait(size_t len)
+{
+	for (int i = 0; i < SINK_WAIT_MS / 10 && sink_data_len < len; i++) {
+		k_sleep(K_MSEC(10));
+	}
+}
+
+static void trace_data_fill(uint8_t *buf, size_t len, uint8_t first)
+{
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = first + i;
+	}
+}
+
+void setUp(void)
+{
+	int ret;
+
+	sink_write_block = false;
+	sink_init_err = 0;
+	sink_data_len = 0;
+	processed_len = 0;
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = trace_backend.clear();
+	TEST_ASSERT_EQUAL(0, ret);
+}
+
+void tearDown(void)
+{
+	trace_backend.deinit();
+}
+
+void test_fanout_init_efault(void)
+{
+	int ret;
+
+	ret = trace_backend.init(NULL);
+	TEST_ASSERT_EQUAL(-EFAULT, ret);
+}
+
+void test_fanout_write(void)
+{
+	int ret;
+	uint8_t data[40];
+	uint8_t out[sizeof(data)];
+
+	trace_data_fill(data, sizeof(data), 0);
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL(sizeof(data), ret);
+
+	/* The trace data is processed once queued, without waiting for the sink. */
+	TEST_ASSERT_EQUAL(sizeof(data), processed_len);
+
+	/* The RAM backend is written directly. */
+	TEST_ASSERT_EQUAL(sizeof(data), trace_backend.data_size());
+
+	ret = trace_backend.read(out, sizeof(out));
+	TEST_ASSERT_EQUAL(sizeof(out), ret);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(data, out, sizeof(data));
+
+	sink_data_wait(sizeof(data));
+	TEST_ASSERT_EQUAL(sizeof(data), sink_data_len);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(data, sink_data, sizeof(data));
+}
+
+void test_fanout_slow_sink_drop_oldest(void)
+{
+	int ret;
+	uint8_t first[CHUNK_SIZE];
+	uint8_t data[QUEUE_SIZE + 36];
+
+	trace_data_fill(first, sizeof(first), 0);
+	trace_data_fill(data, sizeof(data), 100);
+
+	/* Stall the sink while it writes the first chunk. */
+	sink_write_block = true;
+
+	ret = trace_backend.write(first, sizeof(first));
+	TEST_ASSERT_EQUAL(sizeof(first), ret);
+
+	ret = k_sem_take(&sink_write_entered, K_MSEC(SINK_WAIT_MS));
+	TEST_ASSERT_EQUAL(0, ret);
+
+	/* More data than the queue holds, the writer must not be blocked by the sink. */
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL(sizeof(data), ret);
+	TEST_ASSERT_EQUAL(sizeof(first) + sizeof(data), processed_len);
+
+	k_sem_give(&sink_write_release);
+
+	/* The sink receives the first chunk and the most recent data that fit in the queue. */
+	sink_data_wait(sizeof(first) + QUEUE_SIZE);
+	k_sleep(K_MSEC(50));
+
+	TEST_ASSERT_EQUAL(sizeof(first) + QUEUE_SIZE, sink_data_len);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(first, sink_data, sizeof(first));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&data[sizeof(data) - QUEUE_SIZE], &sink_data[sizeof(first)],
+				      QUEUE_SIZE);
+}
+
+void test_fanout_sink_init_fail(void)
+{
+	int ret;
+	uint8_t data[16];
+
+	trace_data_fill(data, sizeof(data), 0);
+
+	trace_backend.deinit();
+
+	/* Tracing continues to the other backends when a sink fails to initialize. */
+	sink_init_err = -EIO;
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL(sizeof(data), ret);
+	TEST_ASSERT_EQUAL(sizeof(data), trace_backend.data_size());
+
+	k_sleep(K_MSEC(50));
+	TEST_ASSERT_EQUAL(0, sink_data_len);
+}
+
+void test_fanout_deinit_flush(void)
+{
+	int ret;
+	uint8_t data[QUEUE_SIZE];
+
+	trace_data_fill(data, sizeof(data), 0);
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL(sizeof(data), ret);
+
+	/* Queued trace data is written to the sink before deinit returns. */
+	ret = trace_backend.deinit();
+	TEST_ASSERT_EQUAL(0, ret);
+
+	TEST_ASSERT_EQUAL(sizeof(data), sink_data_len);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(data, sink_data, sizeof(data));
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <pcm_mix.h>
+
+/* One 10 ms stereo block at 48 kHz */
+#define BENCH_SAMPLES_MONO   480
+#define BENCH_SAMPLES_STEREO (2 * BENCH_SAMPLES_MONO)
+
+static int16_t pcm_a[BENCH_SAMPLES_STEREO] __aligned(4);
+static int16_t pcm_ref[BENCH_SAMPLES_STEREO] __aligned(4);
+static int16_t pcm_b[BENCH_SAMPLES_STEREO] __aligned(4);
+
+/* Deterministic full scale pseudo-random samples */
+static void pcm_fill(int16_t *pcm, size_t samples, uint32_t seed)
+{
+	for (size_t i = 0; i < samples; i++) {
+		seed = seed * 1664525 + 1013904223;
+		pcm[i] = (int16_t)(seed >> 16);
+	}
+}
+
+static int16_t ref_add(int16_t a, int16_t b)
+{
+	return CLAMP((int32_t)a + b, INT16_MIN, INT16_MAX);
+}
+
+/* Scalar reference implementation of pcm_mix */
+static void ref_mix(int16_t *a, int16_t const *b, size_t samples_b, enum pcm_mix_mode mix_mode)
+{
+	for (size_t i = 0; i < samples_b; i++) {
+		switch (mix_mode) {
+		case B_STEREO_INTO_A_STEREO:
+		case B_MONO_INTO_A_MONO:
+			a[i] = ref_add(a[i], b[i]);
+			break;
+		case B_MONO_INTO_A_STEREO_LR:
+			a[2 * i] = ref_add(a[2 * i], b[i]);
+			a[2 * i + 1] = ref_add(a[2 * i + 1], b[i]);
+			break;
+		case B_MONO_INTO_A_STEREO_L:
+			a[2 * i] = ref_add(a[2 * i], b[i]);
+			break;
+		case B_MONO_INTO_A_STEREO_R:
+			a[2 * i + 1] = ref_add(a[2 * i + 1], b[i]);
+			break;
+		}
+	}
+}
+
+static void bench_mix(enum pcm_mix_mode mix_mode, size_t samples_b, const char *name)
+{
+	int ret;
+	uint32_t start;
+	uint32_t cycles_lib;
+	uint32_t cycles_ref;
+
+	/* Full scale input to exercise the saturation. */
+	pcm_fill(pcm_a, ARRAY_SIZE(pcm_a), 1);
+	pcm_fill(pcm_b, ARRAY_SIZE(pcm_b), 2);
+	memcpy(pcm_ref, pcm_a, sizeof(pcm_a));
+
+	start = k_cycle_get_32();
+	ret = pcm_mix(pcm_a, sizeof(pcm_a), pcm_b, samples_b * sizeof(int16_t), mix_mode);
+	cycles_lib = k_cycle_get_32() - start;
+	zassert_equal(ret, 0, "pcm_mix failed: %d", ret);
+
+	start = k_cycle_get_32();
+	ref_mix(pcm_ref, pcm_b, samples_b, mix_mode);
+	cycles_ref = k_cycle_get_32() - start;
+
+	zassert_mem_equal(pcm_a, pcm_ref, sizeof(pcm_a), "%s differs from reference", name);
+
+	TC_PRINT("%s: %u cycles, scalar reference %u cycles\n", name, cycles_lib, cycles_ref);
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_stereo_into_stereo)
+{
+	bench_mix(B_STEREO_INTO_A_STEREO, BENCH_SAMPLES_STEREO, "stereo into stereo");
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_mono_into_stereo_lr)
+{
+	bench_mix(B_MONO_INTO_A_STEREO_LR, BENCH_SAMPLES_MONO, "mono into stereo LR");
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_mono_into_stereo_l)
+{
+	bench_mix(B_MONO_INTO_A_STEREO_L, BENCH_SAMPLES_MONO, "mono into stereo L");
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_mono_into_stereo_r)
+{
+	bench_mix(B_MONO_INTO_A_STEREO_R, BENCH_SAMPLES_MONO, "mono into stereo R");
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <pcm_stream_channel_modifier.h>
+
+/* One 10 ms block at 48 kHz */
+#define BENCH_SAMPLES	   480
+#define BENCH_BUF_WORDS	   (BENCH_SAMPLES * 2)
+
+static uint32_t input_left[BENCH_SAMPLES];
+static uint32_t input_right[BENCH_SAMPLES];
+static uint32_t output[BENCH_BUF_WORDS];
+static uint32_t output_ref[BENCH_BUF_WORDS];
+
+static void buf_fill(uint32_t *buf, size_t words, uint32_t seed)
+{
+	for (size_t i = 0; i < words; i++) {
+		seed = seed * 1664525 + 1013904223;
+		buf[i] = seed;
+	}
+}
+
+/* Byte wise scalar reference implementations */
+static void ref_interleave(uint8_t const *input, size_t input_size, uint8_t channel,
+			   uint8_t bytes_per_sample, uint8_t *out, uint8_t channels)
+{
+	for (size_t i = 0; i < input_size / bytes_per_sample; i++) {
+		memcpy(&out[(i * channels + channel) * bytes_per_sample],
+		       &input[i * bytes_per_sample], bytes_per_sample);
+	}
+}
+
+static void ref_deinterleave(uint8_t const *input, size_t input_size, uint8_t channels,
+			     uint8_t channel, uint8_t bytes_per_sample, uint8_t *out)
+{
+	for (size_t i = 0; i < input_size / channels / bytes_per_sample; i++) {
+		memcpy(&out[i * bytes_per_sample],
+		       &input[(i * channels + channel) * bytes_per_sample], bytes_per_sample);
+	}
+}
+
+static void ref_combine(uint8_t const *left, uint8_t const *right, size_t input_size,
+			uint8_t bytes_per_sample, uint8_t *out)
+{
+	for (size_t i = 0; i < input_size / bytes_per_sample; i++) {
+		memcpy(&out[2 * i * bytes_per_sample], &left[i * bytes_per_sample],
+		       bytes_per_sample);
+		memcpy(&out[(2 * i + 1) * bytes_per_sample], &right[i * bytes_per_sample],
+		       bytes_per_sample);
+	}
+}
+
+static void bench_print(const char *name, uint8_t bits, uint32_t cycles_lib, uint32_t cycles_ref)
+{
+	TC_PRINT("%s %u bit: %u cycles, scalar reference %u cycles\n", name, bits, cycles_lib,
+		 cycles_ref);
+}
+
+static void bench_interleave(uint8_t bits)
+{
+	int ret;
+	uint32_t start, cycles_lib, cycles_ref;
+	size_t input_size = BENCH_SAMPLES * bits / 8;
+
+	for (uint8_t channel = 0; channel < 2; channel++) {
+		buf_fill(input_left, ARRAY_SIZE(input_left), channel + 1);
+		buf_fill(output, ARRAY_SIZE(output), 3);
+		memcpy(output_ref, output, sizeof(output));
+
+		start = k_cycle_get_32();
+		ret = pscm_interleave(input_left, input_size, channel, bits, output, sizeof(output),
+				      2);
+		cycles_lib = k_cycle_get_32() - start;
+		zassert_equal(ret, 0, "pscm_interleave failed: %d", ret);
+
+		start = k_cycle_get_32();
+		ref_interleave((uint8_t *)input_left, input_size, channel, bits / 8,
+			       (uint8_t *)output_ref, 2);
+		cycles_ref = k_cycle_get_32() - start;
+
+		zassert_mem_equal(output, output_ref, sizeof(output),
+				  "Interleave differs from reference");
+		bench_print("pscm_interleave", bits, cycles_lib, cycles_ref);
+	}
+}
+
+static void bench_deinterleave(uint8_t bits)
+{
+	int ret;
+	uint32_t start, cycles_lib, cycles_ref;
+	size_t input_size = 2 * BENCH_SAMPLES * bits / 8;
+
+	for (uint8_t channel = 0; channel < 2; channel++) {
+		buf_fill(output, ARRAY_SIZE(output), channel + 1);
+
+		start = k_cycle_get_32();
+		ret = pscm_deinterleave(output, input_size, 2, channel, bits, input_left,
+					sizeof(input_left));
+		cycles_lib = k_cycle_get_32() - start;
+		zassert_equal(ret, 0, "pscm_deinterleave failed: %d", ret);
+
+		start = k_cycle_get_32();
+		ref_deinterleave((uint8_t *)output, input_size, 2, channel, bits / 8,
+				 (uint8_t *)input_right);
+		cycles_ref = k_cycle_get_32() - start;
+
+		zassert_mem_equal(input_left, input_right, input_size / 2,
+				  "Deinterleave differs from reference");
+		bench_print("pscm_deinterleave", bits, cycles_lib, cycles_ref);
+	}
+}
+
+static void bench_combine(uint8_t bits)
+{
+	int ret;
+	uint32_t start, cycles_lib, cycles_ref;
+	size_t input_size = BENCH_SAMPLES * bits / 8;
+	size_t output_size;
+
+	buf_fill(input_left, ARRAY_SIZE(input_left), 1);
+	buf_fill(input_right, ARRAY_SIZE(input_right), 2);
+
+	start = k_cycle_get_32();
+	ret = pscm_combine(input_left, input_right, input_size, bits, output, &output_size);
+	cycles_lib = k_cycle_get_32() - start;
+	zassert_equal(ret, 0, "pscm_combine failed: %d", ret);
+	zassert_equal(output_size, 2 * input_size, "Wrong output size %d", output_size);
+
+	start = k_cycle_get_32();
+	ref_combine((uint8_t *)input_left, (uint8_t *)input_right, input_size, bits / 8,
+		    (uint8_t *)output_ref);
+	cycles_ref = k_cycle_get_32() - start;
+
+	zassert_mem_equal(output, output_ref, output_size, "Combine differs from reference");
+	bench_print("pscm_combine", bits, cycles_lib, cycles_ref);
+}
+
+ZTEST(suite_pscm_benchmark, test_bench_interleave)
+{
+	bench_interleave(16);
+	bench_interleave(32);
+}
+
+ZTEST(suite_pscm_benchmark, test_bench_deinterleave)
+{
+	bench_deinterleave(16);
+	bench_deinterleave(32);
+}
+
+ZTEST(suite_pscm_benchmark, test_bench_combine)
+{
+	bench_combine(16);
+	bench_combine(32);
+}
+
+ZTEST_SUITE(suite_pscm_benchmark, NULL, NULL, NULL, NULL, NULL);
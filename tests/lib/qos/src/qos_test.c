@@ -29,6 +29,8 @@ static void ctx_verify(struct ctx *expected)
 			      expected->timeout_handler_work.work.handler);
 	TEST_ASSERT_EQUAL_PTR(ctx.pending_list.head, expected->pending_list.head);
 	TEST_ASSERT_EQUAL_PTR(ctx.pending_list.tail, expected->pending_list.tail);
+	TEST_ASSERT_EQUAL_PTR(ctx.free_list.head, expected->free_list.head);
+	TEST_ASSERT_EQUAL_PTR(ctx.free_list.tail, expected->free_list.tail);
 	TEST_ASSERT_EQUAL(ctx.initialized, expected->initialized);
 	TEST_ASSERT_EQUAL(ctx.message_id_next, expected->message_id_next);
 }
@@ -74,6 +76,8 @@ static void init(void)
 		.app_evt_handler = NULL,
 		.pending_list.head = NULL,
 		.pending_list.tail = NULL,
+		.free_list.head = NULL,
+		.free_list.tail = NULL,
 		.initialized = false,
 		.timeout_handler_work.work.handler = NULL,
 		.message_id_next = QOS_MESSAGE_ID_BASE
@@ -92,6 +96,10 @@ static void init(void)
 	expected.app_evt_handler = &dut_event_handler;
 	expected.initialized = true;
 	expected.timeout_handler_work.work.handler = &timeout_handler_work_fn;
+	expected.pending_list.head = &ctx.pending_list;
+	expected.pending_list.tail = &ctx.pending_list;
+	expected.free_list.head = &ctx.list_internal[0].header;
+	expected.free_list.tail = &ctx.list_internal[CONFIG_QOS_PENDING_MESSAGES_MAX - 1].header;
 
 	ctx_verify(&expected);
 
@@ -137,7 +145,7 @@ void test_message_add(void)
 	TEST_ASSERT_EQUAL(2, callback_count);
 
 	/* Verify that internal list contains no entries. */
-	TEST_ASSERT_TRUE(sys_slist_is_empty(&ctx.pending_list));
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
 
 	/* Fill pending list */
 	callback_count = 0;
@@ -155,7 +163,7 @@ void test_message_add(void)
 	TEST_ASSERT_EQUAL(-ENOMEM, qos_message_add(&message));
 
 	/* Check number of list entries populated. */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		count++;
 	};
 
@@ -196,7 +204,7 @@ void test_message_remove(void)
 	TEST_ASSERT_EQUAL(-ENODATA, qos_message_remove(QOS_MESSAGE_ID_BASE));
 
 	/* Check number of list entries populated. */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		count++;
 	};
 
@@ -225,7 +233,7 @@ void test_message_remove_all(void)
 	/* Verify that the internal list has been emptied and the internal delayed
 	 * work is not running.
 	 */
-	TEST_ASSERT_TRUE(sys_slist_is_empty(&ctx.pending_list));
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
 	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, callback_count);
 	TEST_ASSERT_FALSE(k_work_delayable_is_pending(&ctx.timeout_handler_work));
 }
@@ -309,6 +317,17 @@ void test_message_timeout_work(void)
 	callback_count = 0;
 	ctx.app_evt_handler = &dut_event_handler_expired;
 
+	/* Messages are not notified before their deadline. */
+	timeout_handler_work_fn(NULL);
+	k_work_cancel_delayable(&ctx.timeout_handler_work);
+
+	TEST_ASSERT_EQUAL(0, callback_count);
+
+	/* Expire every list item. */
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+		node->deadline = 0;
+	};
+
 	/* Manually run the internal work. */
 	timeout_handler_work_fn(NULL);
 	k_work_cancel_delayable(&ctx.timeout_handler_work);
@@ -319,9 +338,10 @@ void test_message_timeout_work(void)
 	callback_count = 0;
 	ctx.app_evt_handler = &dut_event_handler_removed;
 
-	/* Set every list item to the maximum allowed notified count. */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	/* Set every list item to the maximum allowed notified count and expire it. */
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		node->message.notified_count = CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX;
+		node->deadline = 0;
 	};
 
 	timeout_handler_work_fn(NULL);
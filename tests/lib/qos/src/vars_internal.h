@@ -5,11 +5,18 @@
  */
 
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
 #include <qos.h>
 
 struct qos_metadata {
-	/* Mandatory variable used to construct a linked list. */
-	sys_snode_t header;
+	/* Node in the pending list, or in the free list if the entry is unused. */
+	sys_dnode_t header;
+
+	/* Node in the message ID index. */
+	sys_snode_t index_node;
+
+	/* Uptime in milliseconds at which the message is notified next. */
+	int64_t deadline;
 
 	/* Message associated with each node in the linked list. */
 	struct qos_data message;
@@ -22,8 +29,14 @@ extern struct ctx {
 	/* Internal array of pending messages. Used in combination with linked list. */
 	struct qos_metadata list_internal[CONFIG_QOS_PENDING_MESSAGES_MAX];
 
-	/* Linked list used to keep track of pending messages. */
-	sys_slist_t pending_list;
+	/* Linked list of pending messages, ordered by the notify deadline. */
+	sys_dlist_t pending_list;
+
+	/* Linked list of unused entries of the internal array. */
+	sys_dlist_t free_list;
+
+	/* Pending messages hashed by message ID. */
+	sys_slist_t index[CONFIG_QOS_PENDING_MESSAGES_MAX];
 
 	/* Variable used to prevent multiple library initializations. */
 	bool initialized;
@@ -1152,4 +1152,231 @@ ZTEST(suite_sample_rate_converter, test_invalid_process_output_buf_too_small)
 		      "Sample rate conversion process did not fail when output buffer is to small");
 }
 
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL) && defined(CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16)
+#define FRAC_BLOCKS	     100
+#define FRAC_SAMPLES_44KHZ1 441
+
+static int16_t frac_input[FRAC_SAMPLES_44KHZ1];
+static int16_t frac_output[FRAC_SAMPLES_44KHZ1 * 2];
+
+static size_t frac_blocks_process(int32_t ppm)
+{
+	int ret;
+	size_t output_written;
+	size_t total_samples = 0;
+
+	ret = sample_rate_converter_ratio_adjust(&conv_ctx, ppm);
+	zassert_equal(ret, 0, "Ratio adjust failed (%d)", ret);
+
+	for (int i = 0; i < FRAC_BLOCKS; i++) {
+		ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_FRACTIONAL,
+						    frac_input, sizeof(frac_input), 44100,
+						    frac_output, sizeof(frac_output),
+						    &output_written, 48000);
+		zassert_equal(ret, 0, "Sample rate conversion process failed (%d)", ret);
+		total_samples += output_written / sizeof(int16_t);
+	}
+
+	return total_samples;
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_fractional_44khz1_to_48khz)
+{
+	size_t total_samples;
+
+	for (int i = 0; i < ARRAY_SIZE(frac_input); i++) {
+		frac_input[i] = 10000;
+	}
+
+	/* One second of audio gives one second of audio */
+	total_samples = frac_blocks_process(0);
+	zassert_within(total_samples, 48000, 1, "Unexpected number of output samples %d",
+		       total_samples);
+	zassert_equal(conv_ctx.filter_type, SAMPLE_RATE_FILTER_FRACTIONAL,
+		      "Filter not as expected");
+
+	/* The filter has unity gain, so a constant input gives the same constant output */
+	for (int i = 0; i < 48000 / FRAC_BLOCKS; i++) {
+		zassert_within(frac_output[i], 10000, 16, "Sample %d not as expected: %d", i,
+			       frac_output[i]);
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_fractional_ratio_adjust)
+{
+	size_t total_samples;
+
+	(void)frac_blocks_process(0);
+
+	/* 1000 ppm faster output gives 48 more samples per second */
+	total_samples = frac_blocks_process(1000);
+	zassert_within(total_samples, 48048, 1, "Unexpected number of output samples %d",
+		       total_samples);
+
+	total_samples = frac_blocks_process(-1000);
+	zassert_within(total_samples, 47952, 1, "Unexpected number of output samples %d",
+		       total_samples);
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_fractional_equal_sample_rates)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_FRACTIONAL, frac_input,
+					    sizeof(frac_input), 48000, frac_output,
+					    sizeof(frac_output), &output_written, 48000);
+
+	zassert_equal(ret, 0, "Sample rate conversion process failed (%d)", ret);
+	zassert_equal(output_written, sizeof(frac_input), "Output size was not as expected (%d)",
+		      output_written);
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_fractional_ratio_too_large)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_FRACTIONAL, frac_input,
+					    sizeof(frac_input), 16000, frac_output,
+					    sizeof(frac_output), &output_written, 48000);
+
+	zassert_equal(ret, -EINVAL, "Process did not fail on invalid ratio");
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_fractional_output_buf_too_small)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_FRACTIONAL, frac_input,
+					    sizeof(frac_input), 44100, frac_output,
+					    sizeof(frac_input), &output_written, 48000);
+
+	zassert_equal(ret, -EINVAL, "Process did not fail on too small output buffer");
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_fractional_ratio_adjust)
+{
+	int ret;
+
+	ret = sample_rate_converter_ratio_adjust(NULL, 0);
+	zassert_equal(ret, -EINVAL, "Ratio adjust did not fail on NULL context");
+
+	ret = sample_rate_converter_ratio_adjust(
+		&conv_ctx, SAMPLE_RATE_CONVERTER_FRACTIONAL_ADJUST_PPM_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Ratio adjust did not fail on too large adjustment");
+
+	ret = sample_rate_converter_ratio_adjust(
+		&conv_ctx, -SAMPLE_RATE_CONVERTER_FRACTIONAL_ADJUST_PPM_MAX - 1);
+	zassert_equal(ret, -EINVAL, "Ratio adjust did not fail on too large adjustment");
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL && CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL) && defined(CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16)
+#define MC_SAMPLES 48
+
+static struct sample_rate_converter_mc_ctx mc_ctx;
+static struct sample_rate_converter_ctx mc_ref_ctx[2];
+
+static void mc_compare(enum sample_rate_converter_filter filter, uint32_t input_sample_rate,
+		       uint32_t output_sample_rate)
+{
+	int ret;
+	int16_t input[2][MC_SAMPLES];
+	int16_t input_interleaved[2 * MC_SAMPLES];
+	int16_t output[2][MC_SAMPLES * 3];
+	int16_t output_interleaved[2 * MC_SAMPLES * 3];
+	size_t output_written[2];
+	size_t mc_output_written;
+
+	ret = sample_rate_converter_mc_open(&mc_ctx, 2);
+	zassert_equal(ret, 0, "Multi-channel open failed (%d)", ret);
+
+	for (int c = 0; c < 2; c++) {
+		sample_rate_converter_open(&mc_ref_ctx[c]);
+	}
+
+	for (int block = 0; block < 4; block++) {
+		for (int i = 0; i < MC_SAMPLES; i++) {
+			input[0][i] = (block * MC_SAMPLES + i) * 100;
+			input[1][i] = -(block * MC_SAMPLES + i) * 50;
+			input_interleaved[2 * i] = input[0][i];
+			input_interleaved[2 * i + 1] = input[1][i];
+		}
+
+		for (int c = 0; c < 2; c++) {
+			ret = sample_rate_converter_process(
+				&mc_ref_ctx[c], filter, input[c], sizeof(input[c]),
+				input_sample_rate, output[c], sizeof(output[c]), &output_written[c],
+				output_sample_rate);
+			zassert_equal(ret, 0, "Sample rate conversion process failed (%d)", ret);
+		}
+
+		ret = sample_rate_converter_mc_process(&mc_ctx, filter, input_interleaved,
+						       sizeof(input_interleaved), input_sample_rate,
+						       output_interleaved,
+						       sizeof(output_interleaved),
+						       &mc_output_written, output_sample_rate);
+		zassert_equal(ret, 0, "Multi-channel conversion process failed (%d)", ret);
+		zassert_equal(mc_output_written, output_written[0] + output_written[1],
+			      "Output size was not as expected (%d)", mc_output_written);
+
+		for (int i = 0; i < output_written[0] / sizeof(int16_t); i++) {
+			zassert_equal(output_interleaved[2 * i], output[0][i],
+				      "Left sample %d differs", i);
+			zassert_equal(output_interleaved[2 * i + 1], output[1][i],
+				      "Right sample %d differs", i);
+		}
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_mc_interpolate_matches_single_channel)
+{
+	mc_compare(SAMPLE_RATE_FILTER_TEST, 16000, 48000);
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_mc_decimate_matches_single_channel)
+{
+	mc_compare(SAMPLE_RATE_FILTER_SIMPLE, 48000, 24000);
+}
+
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL)
+ZTEST(suite_sample_rate_converter, test_valid_mc_fractional_matches_single_channel)
+{
+	mc_compare(SAMPLE_RATE_FILTER_FRACTIONAL, 44100, 48000);
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
+ZTEST(suite_sample_rate_converter, test_invalid_mc_open)
+{
+	int ret;
+
+	ret = sample_rate_converter_mc_open(NULL, 2);
+	zassert_equal(ret, -EINVAL, "Open did not fail on NULL context");
+
+	ret = sample_rate_converter_mc_open(&mc_ctx, 0);
+	zassert_equal(ret, -EINVAL, "Open did not fail on zero channels");
+
+	ret = sample_rate_converter_mc_open(&mc_ctx, CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Open did not fail on too many channels");
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_mc_process_input_not_frame_multiple)
+{
+	int ret;
+	int16_t input[3] = {0};
+	int16_t output[12];
+	size_t output_written;
+
+	ret = sample_rate_converter_mc_open(&mc_ctx, 2);
+	zassert_equal(ret, 0, "Multi-channel open failed (%d)", ret);
+
+	ret = sample_rate_converter_mc_process(&mc_ctx, SAMPLE_RATE_FILTER_TEST, input,
+					       sizeof(input), 24000, output, sizeof(output),
+					       &output_written, 48000);
+	zassert_equal(ret, -EINVAL, "Process did not fail on partial frame");
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_MULTI_CHANNEL && CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
 ZTEST_SUITE(suite_sample_rate_converter, NULL, NULL, test_setup, NULL, NULL);
@@ -342,3 +342,66 @@ ZTEST(suite_tone_gen_size, test_tone_gen_size_illegal_args)
 
 ZTEST_SUITE(suite_tone, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(suite_tone_gen_size, NULL, NULL, NULL, NULL, NULL);
+
+#if defined(CONFIG_TONE_OSC)
+ZTEST(suite_tone_osc, test_tone_osc_matches_tone_gen)
+{
+	struct tone_osc osc;
+	int16_t tone[100];
+	int16_t osc_tone[100];
+	size_t tone_size;
+
+	zassert_equal(tone_gen(tone, &tone_size, 480, 48000, 1), 0, "Err code returned");
+	zassert_equal(tone_osc_init(&osc, 480, 48000, 1), 0, "Err code returned");
+	zassert_equal(tone_osc_gen(&osc, osc_tone, ARRAY_SIZE(osc_tone), 16), 0,
+		      "Err code returned");
+
+	for (size_t i = 0; i < ARRAY_SIZE(osc_tone); i++) {
+		zassert_within(osc_tone[i], tone[i], 4, "Sample %d differs: %d, %d", i,
+			       osc_tone[i], tone[i]);
+	}
+}
+
+ZTEST(suite_tone_osc, test_tone_osc_phase_continuous)
+{
+	struct tone_osc osc;
+	int32_t tone[96];
+	int32_t tone_split[96];
+
+	/* 441 Hz does not divide 48 kHz, so a period spans a non-integer number of samples */
+	zassert_equal(tone_osc_init(&osc, 441, 48000, 0.5), 0, "Err code returned");
+	zassert_equal(tone_osc_gen(&osc, tone, ARRAY_SIZE(tone), 32), 0, "Err code returned");
+
+	zassert_equal(tone_osc_init(&osc, 441, 48000, 0.5), 0, "Err code returned");
+	zassert_equal(tone_osc_gen(&osc, tone_split, 32, 32), 0, "Err code returned");
+	zassert_equal(tone_osc_gen(&osc, &tone_split[32], 64, 32), 0, "Err code returned");
+
+	zassert_mem_equal(tone, tone_split, sizeof(tone), "Tone not continuous between calls");
+	zassert_equal(tone[0], 0, "First sample not zero");
+	/* Peak of the period is reached after 48000 / 441 / 4 = 27.2 samples */
+	zassert_within(tone[27], INT32_MAX / 2, INT32_MAX / 1000, "Peak sample not as expected");
+}
+
+ZTEST(suite_tone_osc, test_tone_osc_illegal_args)
+{
+	struct tone_osc osc;
+	int16_t tone[10];
+
+	zassert_equal(tone_osc_init(NULL, 1000, 48000, 1), -ENXIO, "Did not return -ENXIO");
+	zassert_equal(tone_osc_init(&osc, 99, 48000, 1), -EINVAL, "Did not return -EINVAL");
+	zassert_equal(tone_osc_init(&osc, 10001, 48000, 1), -EINVAL, "Did not return -EINVAL");
+	zassert_equal(tone_osc_init(&osc, 8000, 16000, 1), -EINVAL, "Did not return -EINVAL");
+	zassert_equal(tone_osc_init(&osc, 1000, 48000, 0), -EPERM, "Did not return -EPERM");
+	zassert_equal(tone_osc_init(&osc, 1000, 48000, 1.1), -EPERM, "Did not return -EPERM");
+
+	zassert_equal(tone_osc_init(&osc, 1000, 48000, 1), 0, "Err code returned");
+	zassert_equal(tone_osc_gen(NULL, tone, ARRAY_SIZE(tone), 16), -ENXIO,
+		      "Did not return -ENXIO");
+	zassert_equal(tone_osc_gen(&osc, NULL, ARRAY_SIZE(tone), 16), -ENXIO,
+		      "Did not return -ENXIO");
+	zassert_equal(tone_osc_gen(&osc, tone, ARRAY_SIZE(tone), 24), -EINVAL,
+		      "Did not return -EINVAL");
+}
+
+ZTEST_SUITE(suite_tone_osc, NULL, NULL, NULL, NULL, NULL);
+#endif /* CONFIG_TONE_OSC */
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <zephyr/fs/fs.h>
+
+#include "modules/lc3_file.h"
+
+#include "sd_card/sd_card_fake.h"
+#include "sd_card/lc3_file_data.h"
+
+#define FRAME_BUFFER_SIZE 40
+
+static void test_setup(void *f)
+{
+	ARG_UNUSED(f);
+
+	DO_FOREACH_FAKE(RESET_FAKE);
+
+	FFF_RESET_HISTORY();
+
+	sd_card_fake_reset_counter();
+}
+
+ZTEST(lc3_file_read_ahead, test_lc3_file_frame_get_valid)
+{
+	int ret;
+	struct lc3_file_ctx file;
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+	const uint8_t *const frames[] = {
+		lc3_file_dataset1_valid_frame1, lc3_file_dataset1_valid_frame2,
+		lc3_file_dataset1_valid_frame3, lc3_file_dataset1_valid_frame4,
+		lc3_file_dataset1_valid_frame5};
+	const size_t frame_sizes[] = {
+		lc3_file_dataset1_valid_frame1_size, lc3_file_dataset1_valid_frame2_size,
+		lc3_file_dataset1_valid_frame3_size, lc3_file_dataset1_valid_frame4_size,
+		lc3_file_dataset1_valid_frame5_size};
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+	zassert_equal(1, sd_card_read_fake.call_count, "Only the header should be read on open");
+
+	for (int i = 0; i < ARRAY_SIZE(frames); i++) {
+		ret = lc3_file_frame_get(&file, frame_buffer, sizeof(frame_buffer));
+		zassert_equal(0, ret, "lc3_file_frame_get() should return 0");
+		zassert_mem_equal(frames[i], frame_buffer, frame_sizes[i],
+				  "Frame %d data should match", i + 1);
+	}
+
+	/* The whole file fits in the first read, which ends short and marks end of file */
+	zassert_equal(2, sd_card_read_fake.call_count, "sd_card_read() should be called twice");
+
+	ret = lc3_file_frame_get(&file, frame_buffer, sizeof(frame_buffer));
+	zassert_equal(-ENODATA, ret, "lc3_file_frame_get() should return -ENODATA");
+	zassert_equal(2, sd_card_read_fake.call_count, "No reads should be issued after EOF");
+
+	ret = lc3_file_close(&file);
+	zassert_equal(0, ret, "lc3_file_close() should return 0");
+}
+
+ZTEST(lc3_file_read_ahead, test_lc3_file_frame_get_invalid_frame_size_mismatch)
+{
+	int ret;
+	struct lc3_file_ctx file;
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_invalid_frame;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	ret = lc3_file_frame_get(&file, frame_buffer, sizeof(frame_buffer));
+	zassert_equal(-EIO, ret, "lc3_file_frame_get() should return -EIO");
+
+	ret = lc3_file_close(&file);
+	zassert_equal(0, ret, "lc3_file_close() should return 0");
+}
+
+ZTEST(lc3_file_read_ahead, test_lc3_file_frame_get_invalid_buf_size_too_small)
+{
+	int ret;
+	struct lc3_file_ctx file;
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	ret = lc3_file_frame_get(&file, frame_buffer, 10);
+	zassert_equal(-ENOMEM, ret, "lc3_file_frame_get() should return -ENOMEM");
+
+	ret = lc3_file_close(&file);
+	zassert_equal(0, ret, "lc3_file_close() should return 0");
+}
+
+ZTEST(lc3_file_read_ahead, test_lc3_file_frame_get_valid_pool_exhausted)
+{
+	int ret;
+	struct lc3_file_ctx file_buffered;
+	struct lc3_file_ctx file_direct;
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
+
+	/* Test is built with a single read-ahead buffer */
+	ret = lc3_file_open(&file_buffered, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	sd_card_fake_reset_counter();
+
+	ret = lc3_file_open(&file_direct, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+	zassert_is_null(file_direct.read_ahead_buf, "Second file should not get a buffer");
+
+	ret = lc3_file_frame_get(&file_direct, frame_buffer, sizeof(frame_buffer));
+	zassert_equal(0, ret, "lc3_file_frame_get() should return 0");
+	zassert_mem_equal(lc3_file_dataset1_valid_frame1, frame_buffer,
+			  lc3_file_dataset1_valid_frame1_size, "Frame 1 data should match");
+	zassert_equal(4, sd_card_read_fake.call_count,
+		      "Direct frame read should use a header and a data read");
+
+	ret = lc3_file_close(&file_direct);
+	zassert_equal(0, ret, "lc3_file_close() should return 0");
+
+	ret = lc3_file_close(&file_buffered);
+	zassert_equal(0, ret, "lc3_file_close() should return 0");
+
+	/* Buffer is returned to the pool on close */
+	sd_card_fake_reset_counter();
+
+	ret = lc3_file_open(&file_direct, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+	zassert_not_null(file_direct.read_ahead_buf, "Buffer should be available again");
+
+	ret = lc3_file_close(&file_direct);
+	zassert_equal(0, ret, "lc3_file_close() should return 0");
+}
+
+ZTEST_SUITE(lc3_file_read_ahead, NULL, NULL, test_setup, NULL, NULL);
@@ -657,4 +657,48 @@ ZTEST(lc3_streamer, test_lc3_streamer_is_looping_invalid)
 		      "lc3_streamer_is_looping should return false on an invalid index");
 }
 
+ZTEST(lc3_streamer, test_lc3_streamer_underruns_get_valid)
+{
+	int ret;
+	uint32_t underruns;
+	uint8_t streamer_idx;
+	const uint8_t *frame_buffer = NULL;
+
+	/* Work items are not executed, so only the frame loaded at registration is available */
+	lc3_file_frame_get_fake.custom_fake = lc3_file_frame_get_fake_valid;
+	k_work_init_fake.custom_fake = k_work_init_valid_fake;
+
+	ret = lc3_streamer_stream_register("test", &streamer_idx, false);
+	zassert_equal(0, ret, "lc3_streamer_stream_register should return success");
+
+	ret = lc3_streamer_underruns_get(streamer_idx, &underruns);
+	zassert_equal(0, ret, "lc3_streamer_underruns_get should return success");
+	zassert_equal(0, underruns, "No underruns should be counted after register");
+
+	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer);
+	zassert_equal(0, ret, "lc3_streamer_next_frame_get should return success");
+
+	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer);
+	zassert_equal(-ENOMSG, ret, "lc3_streamer_next_frame_get should return -ENOMSG");
+
+	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer);
+	zassert_equal(-ENOMSG, ret, "lc3_streamer_next_frame_get should return -ENOMSG");
+
+	ret = lc3_streamer_underruns_get(streamer_idx, &underruns);
+	zassert_equal(0, ret, "lc3_streamer_underruns_get should return success");
+	zassert_equal(2, underruns, "Two underruns should be counted");
+}
+
+ZTEST(lc3_streamer, test_lc3_streamer_underruns_get_invalid)
+{
+	int ret;
+	uint32_t underruns;
+
+	ret = lc3_streamer_underruns_get(CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS, &underruns);
+	zassert_equal(-EINVAL, ret, "lc3_streamer_underruns_get should return -EINVAL");
+
+	ret = lc3_streamer_underruns_get(0, NULL);
+	zassert_equal(-EINVAL, ret, "lc3_streamer_underruns_get should return -EINVAL");
+}
+
 ZTEST_SUITE(lc3_streamer, NULL, suite_setup, test_setup, test_teardown, NULL);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _COALESCE_EVENTS_H_
+#define _COALESCE_EVENTS_H_
+
+/**
+ * @brief Coalesce Events
+ * @defgroup coalesce_events Coalesce Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct replace_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(replace_event);
+
+struct accumulate_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(accumulate_event);
+
+struct drop_oldest_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(drop_oldest_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _COALESCE_EVENTS_H_ */
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PRIO_EVENTS_H_
+#define _PRIO_EVENTS_H_
+
+/**
+ * @brief Priority Events
+ * @defgroup prio_events Priority Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct normal_prio_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(normal_prio_event);
+
+struct high_prio_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(high_prio_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _PRIO_EVENTS_H_ */
@@ -29,6 +29,11 @@ enum test_id {
 	TEST_OOM,
 	TEST_MULTICONTEXT,
 	TEST_NAME_STYLE_SORTING,
+	TEST_EVENT_PRIORITY,
+	TEST_LISTENER_WORKQ,
+	TEST_LISTENER_DEFERRED,
+	TEST_EVENT_COALESCING,
+	TEST_STATS,
 
 	TEST_CNT
 };
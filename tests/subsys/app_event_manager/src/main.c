@@ -184,6 +184,41 @@ ZTEST(suite0, test_name_style_events_sorting)
 	test_start(TEST_NAME_STYLE_SORTING);
 }
 
+ZTEST(suite0, test_event_priority)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_APP_EVENT_MANAGER_LOCKLESS_QUEUE);
+
+	test_start(TEST_EVENT_PRIORITY);
+}
+
+ZTEST(suite0, test_listener_workq)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_APP_EVENT_MANAGER_LISTENER_WORKQ);
+
+	test_start(TEST_LISTENER_WORKQ);
+}
+
+ZTEST(suite0, test_listener_deferred)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_APP_EVENT_MANAGER_LISTENER_DEFERRED);
+
+	test_start(TEST_LISTENER_DEFERRED);
+}
+
+ZTEST(suite0, test_event_coalescing)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING);
+
+	test_start(TEST_EVENT_COALESCING);
+}
+
+ZTEST(suite0, test_stats)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_APP_EVENT_MANAGER_STATS);
+
+	test_start(TEST_STATS);
+}
+
 ZTEST_SUITE(suite0, NULL, test_init, NULL, NULL, NULL);
 
 static bool app_event_handler(const struct app_event_header *aeh)
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "coalesce_events.h"
+
+#define MODULE test_coalesce
+
+#define TEST_COALESCE_CNT 4
+
+enum test_coalesce_step {
+	STEP_REPLACE,
+	STEP_ACCUMULATE,
+	STEP_DROP_OLDEST,
+	STEP_DONE,
+};
+
+static enum test_coalesce_step step;
+
+static void accumulate_merge(struct app_event_header *queued,
+			     const struct app_event_header *aeh)
+{
+	cast_accumulate_event(queued)->val += cast_accumulate_event(aeh)->val;
+}
+
+APP_EVENT_COALESCE(replace_event, APP_EVENT_COALESCE_REPLACE_LATEST, NULL);
+APP_EVENT_COALESCE(accumulate_event, APP_EVENT_COALESCE_ACCUMULATE, accumulate_merge);
+APP_EVENT_COALESCE(drop_oldest_event, APP_EVENT_COALESCE_DROP_OLDEST, NULL);
+
+static void submit_events(void)
+{
+	/* All events are queued before the handler returns, so each type is expected to be
+	 * coalesced into a single event. The drop oldest event is expected to be moved behind
+	 * the other events.
+	 */
+	for (size_t i = 0; i < TEST_COALESCE_CNT; i++) {
+		struct drop_oldest_event *drop_oldest = new_drop_oldest_event();
+
+		drop_oldest->val = i;
+		APP_EVENT_SUBMIT(drop_oldest);
+
+		struct replace_event *replace = new_replace_event();
+
+		replace->val = i;
+		APP_EVENT_SUBMIT(replace);
+
+		struct accumulate_event *accumulate = new_accumulate_event();
+
+		accumulate->val = i;
+		APP_EVENT_SUBMIT(accumulate);
+	}
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id == TEST_EVENT_COALESCING) {
+			step = STEP_REPLACE;
+			submit_events();
+		}
+
+		return false;
+	}
+
+	if (is_replace_event(aeh)) {
+		zassert_equal(step, STEP_REPLACE, "Replaced event not coalesced");
+		zassert_equal(cast_replace_event(aeh)->val, TEST_COALESCE_CNT - 1,
+			      "Replaced event has wrong value");
+		step = STEP_ACCUMULATE;
+
+		return false;
+	}
+
+	if (is_accumulate_event(aeh)) {
+		zassert_equal(step, STEP_ACCUMULATE, "Accumulated event not coalesced");
+		zassert_equal(cast_accumulate_event(aeh)->val,
+			      TEST_COALESCE_CNT * (TEST_COALESCE_CNT - 1) / 2,
+			      "Accumulated event has wrong value");
+		step = STEP_DROP_OLDEST;
+
+		return false;
+	}
+
+	if (is_drop_oldest_event(aeh)) {
+		zassert_equal(step, STEP_DROP_OLDEST, "Oldest event not dropped");
+		zassert_equal(cast_drop_oldest_event(aeh)->val, TEST_COALESCE_CNT - 1,
+			      "Wrong event dropped");
+		step = STEP_DONE;
+
+		struct test_end_event *te = new_test_end_event();
+
+		te->test_id = TEST_EVENT_COALESCING;
+		APP_EVENT_SUBMIT(te);
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, replace_event);
+APP_EVENT_SUBSCRIBE(MODULE, accumulate_event);
+APP_EVENT_SUBSCRIBE(MODULE, drop_oldest_event);
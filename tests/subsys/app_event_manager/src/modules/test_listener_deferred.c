@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "data_event.h"
+
+#define DEFERRED_QUEUE_SIZE	2
+
+static enum test_id cur_test_id;
+static atomic_t dispatched;
+
+static bool deferred_event_handler(const struct app_event_header *aeh)
+{
+	if (is_data_event(aeh)) {
+		if (cur_test_id == TEST_LISTENER_DEFERRED) {
+			zassert_equal(k_thread_priority_get(k_current_get()),
+				      K_LOWEST_APPLICATION_THREAD_PRIO,
+				      "Deferred listener notified with wrong priority");
+			zassert_true(atomic_get(&dispatched),
+				     "Deferred listener notified before event dispatch ended");
+
+			struct test_end_event *te = new_test_end_event();
+
+			te->test_id = cur_test_id;
+			APP_EVENT_SUBMIT(te);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+/* Subscribed before the listener below, but notified after the event dispatch. */
+APP_EVENT_LISTENER_DEFERRED(test_listener_deferred_idle, deferred_event_handler,
+			    DEFERRED_QUEUE_SIZE);
+APP_EVENT_SUBSCRIBE_EARLY(test_listener_deferred_idle, data_event);
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		cur_test_id = st->test_id;
+
+		if (cur_test_id == TEST_LISTENER_DEFERRED) {
+			struct data_event *event = new_data_event();
+
+			atomic_clear(&dispatched);
+			APP_EVENT_SUBMIT(event);
+		}
+
+		return false;
+	}
+
+	if (is_data_event(aeh)) {
+		if (cur_test_id == TEST_LISTENER_DEFERRED) {
+			atomic_set(&dispatched, true);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(test_listener_deferred, app_event_handler);
+APP_EVENT_SUBSCRIBE(test_listener_deferred, test_start_event);
+APP_EVENT_SUBSCRIBE(test_listener_deferred, data_event);
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "data_event.h"
+
+#define WORKQ_STACK_SIZE	1024
+#define WORKQ_PRIORITY		K_PRIO_PREEMPT(0)
+#define WORKQ_QUEUE_SIZE	2
+
+#define DELIVERY_TIMEOUT	K_SECONDS(1)
+
+static K_THREAD_STACK_DEFINE(workq_stack, WORKQ_STACK_SIZE);
+static struct k_work_q workq;
+
+static K_SEM_DEFINE(workq_delivered_sem, 0, 1);
+static enum test_id cur_test_id;
+
+static bool workq_event_handler(const struct app_event_header *aeh)
+{
+	if (is_data_event(aeh)) {
+		if (cur_test_id == TEST_LISTENER_WORKQ) {
+			zassert_equal_ptr(k_current_get(), k_work_queue_thread_get(&workq),
+					  "Listener notified from wrong context");
+			k_sem_give(&workq_delivered_sem);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+/* Subscribed before the listener below, but notified from the dedicated work queue. */
+APP_EVENT_LISTENER_WORKQ(test_listener_workq_async, workq_event_handler, &workq,
+			 WORKQ_QUEUE_SIZE);
+APP_EVENT_SUBSCRIBE_EARLY(test_listener_workq_async, data_event);
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		cur_test_id = st->test_id;
+
+		if (cur_test_id == TEST_LISTENER_WORKQ) {
+			struct data_event *event = new_data_event();
+
+			k_sem_reset(&workq_delivered_sem);
+			APP_EVENT_SUBMIT(event);
+		}
+
+		return false;
+	}
+
+	if (is_data_event(aeh)) {
+		if (cur_test_id == TEST_LISTENER_WORKQ) {
+			/* The dispatcher is blocked here, so the listener must be notified
+			 * in parallel to release the semaphore.
+			 */
+			int err = k_sem_take(&workq_delivered_sem, DELIVERY_TIMEOUT);
+
+			zassert_equal(err, 0, "Listener on work queue not notified in parallel");
+
+			struct test_end_event *te = new_test_end_event();
+
+			te->test_id = cur_test_id;
+			APP_EVENT_SUBMIT(te);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(test_listener_workq, app_event_handler);
+APP_EVENT_SUBSCRIBE(test_listener_workq, test_start_event);
+APP_EVENT_SUBSCRIBE(test_listener_workq, data_event);
+
+static int workq_init(void)
+{
+	k_work_queue_start(&workq, workq_stack, K_THREAD_STACK_SIZEOF(workq_stack),
+			   WORKQ_PRIORITY, NULL);
+
+	return 0;
+}
+
+SYS_INIT(workq_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "prio_events.h"
+
+#include "test_config.h"
+
+#define MODULE test_prio
+
+static int normal_cnt;
+static bool high_received;
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id == TEST_EVENT_PRIORITY) {
+			normal_cnt = 0;
+			high_received = false;
+
+			/* All events are queued before the handler returns, and the high priority
+			 * event is expected to overtake the normal priority ones.
+			 */
+			for (size_t i = 0; i < TEST_EVENT_PRIO_CNT; i++) {
+				struct normal_prio_event *event = new_normal_prio_event();
+
+				event->val = i;
+				APP_EVENT_SUBMIT(event);
+			}
+
+			struct high_prio_event *event = new_high_prio_event();
+
+			APP_EVENT_SUBMIT(event);
+		}
+
+		return false;
+	}
+
+	if (is_high_prio_event(aeh)) {
+		zassert_equal(normal_cnt, 0, "High priority event processed too late");
+		high_received = true;
+
+		return false;
+	}
+
+	if (is_normal_prio_event(aeh)) {
+		struct normal_prio_event *event = cast_normal_prio_event(aeh);
+
+		zassert_true(high_received, "Normal priority event processed too early");
+		zassert_equal(event->val, normal_cnt, "Normal priority events out of order");
+		normal_cnt++;
+
+		if (normal_cnt == TEST_EVENT_PRIO_CNT) {
+			struct test_end_event *te = new_test_end_event();
+
+			te->test_id = TEST_EVENT_PRIORITY;
+			APP_EVENT_SUBMIT(te);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, normal_prio_event);
+APP_EVENT_SUBSCRIBE(MODULE, high_prio_event);
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "stats_event.h"
+
+#define MODULE test_stats
+
+#define TEST_STATS_EVENT_CNT 3
+
+static void check_listener_stats(const char *name, uint32_t notified)
+{
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		if (!strcmp(el->name, name)) {
+			struct app_event_manager_listener_stats stats;
+
+			app_event_manager_listener_stats_get(el, &stats);
+			zassert_equal(stats.notified, notified,
+				      "Wrong number of notifications of %s", name);
+			return;
+		}
+	}
+
+	zassert_true(false, "Listener %s not found", name);
+}
+
+static void check_stats(void)
+{
+	struct app_event_manager_event_stats stats;
+
+	app_event_manager_event_stats_get(APP_EVENT_ID(stats_event), &stats);
+
+	zassert_equal(stats.submitted, TEST_STATS_EVENT_CNT, "Wrong number of submitted events");
+	/* Every event is delivered to two listeners, the second one consumes the event. */
+	zassert_equal(stats.delivered, 2 * TEST_STATS_EVENT_CNT,
+		      "Wrong number of delivered events");
+	zassert_equal(stats.consumed, TEST_STATS_EVENT_CNT, "Wrong number of consumed events");
+	zassert_equal(stats.queued, 0, "Events left in the queue");
+	/* Events were submitted from a listener, so none of them was processed meanwhile. */
+	zassert_equal(stats.max_queued, TEST_STATS_EVENT_CNT, "Wrong peak queue depth");
+
+	check_listener_stats(STRINGIFY(MODULE), TEST_STATS_EVENT_CNT);
+	check_listener_stats("test_stats_consumer", TEST_STATS_EVENT_CNT);
+	check_listener_stats("test_stats_late", 0);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id == TEST_STATS) {
+			app_event_manager_stats_reset();
+
+			for (size_t i = 0; i < TEST_STATS_EVENT_CNT; i++) {
+				struct stats_event *event = new_stats_event();
+
+				event->val = i;
+				APP_EVENT_SUBMIT(event);
+			}
+
+			struct test_end_event *te = new_test_end_event();
+
+			te->test_id = TEST_STATS;
+			APP_EVENT_SUBMIT(te);
+		}
+
+		return false;
+	}
+
+	if (is_test_end_event(aeh)) {
+		struct test_end_event *te = cast_test_end_event(aeh);
+
+		if (te->test_id == TEST_STATS) {
+			check_stats();
+		}
+
+		return false;
+	}
+
+	if (is_stats_event(aeh)) {
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE_EARLY(MODULE, test_end_event);
+APP_EVENT_SUBSCRIBE_EARLY(MODULE, stats_event);
+
+static bool stats_event_consumer(const struct app_event_header *aeh)
+{
+	zassert_true(is_stats_event(aeh), "Event unhandled");
+
+	return true;
+}
+
+APP_EVENT_LISTENER(test_stats_consumer, stats_event_consumer);
+APP_EVENT_SUBSCRIBE(test_stats_consumer, stats_event);
+
+static bool stats_event_late(const struct app_event_header *aeh)
+{
+	zassert_true(false, "Consumed event delivered");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(test_stats_late, stats_event_late);
+APP_EVENT_SUBSCRIBE_FINAL(test_stats_late, stats_event);
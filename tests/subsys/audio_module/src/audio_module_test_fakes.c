@@ -178,6 +178,30 @@ int fake_data_fifo_pointer_last_filled_get__succeeds(struct data_fifo *data_fifo
 	return 0;
 }
 
+int fake_data_fifo_pointer_last_filled_get__empty_fails(struct data_fifo *data_fifo, void **data,
+							size_t *size, k_timeout_t timeout)
+{
+	struct audio_module_message *msg;
+	struct test_msg_fifo_queue *test_fifo_msg =
+		(struct test_msg_fifo_queue *)data_fifo->msgq_buffer;
+
+	zassert_not_equal(data_fifo, NULL, "Data FIFO pointer is NULL");
+
+	if (k_sem_take(&test_fifo_msg->sem, timeout)) {
+		return -ENOMSG;
+	}
+
+	msg = (struct audio_module_message *)test_fifo_msg->data[test_fifo_msg->tail];
+
+	test_fifo_msg->data[test_fifo_msg->tail] = NULL;
+	test_fifo_msg->tail = (test_fifo_msg->tail + 1) % test_fifo_msg->size;
+
+	*data = msg;
+	*size = sizeof(struct audio_module_message);
+
+	return 0;
+}
+
 int fake_data_fifo_pointer_last_filled_get__no_wait_fails(struct data_fifo *data_fifo, void **data,
 							  size_t *size, k_timeout_t timeout)
 {
@@ -1101,3 +1101,133 @@ ZTEST(suite_audio_module_functional, test_data_rx_fnct)
 		      "Data RX function failed to free item, data FIFO free called %d times",
 		      data_fifo_block_free_fake.call_count);
 }
+
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+K_THREAD_STACK_DEFINE(graph_stack, TEST_MOD_THREAD_STACK_SIZE);
+
+ZTEST(suite_audio_module_functional, test_graph_fnct)
+{
+	int ret;
+	char test_data[TEST_MOD_DATA_SIZE];
+	char data[TEST_MOD_DATA_SIZE] = {0};
+	struct audio_data audio_data_in = {0};
+	struct audio_data audio_data_out = {0};
+	struct data_fifo fifo_rx_first = {0};
+	struct data_fifo fifo_rx_second = {0};
+	struct data_fifo fifo_tx_second = {0};
+	struct mod_context context_first, context_second;
+	struct audio_module_handle handle_first = {0};
+	struct audio_module_handle handle_second = {0};
+	struct audio_module_graph graph = {0};
+	struct audio_module_description graph_description = {
+		.name = "Graph base name", .type = AUDIO_MODULE_TYPE_IN_OUT, .functions = &ft_pop};
+	struct audio_module_parameters graph_parameters = {
+		.description = &graph_description,
+		.thread = {.stack = NULL,
+			   .stack_size = 0,
+			   .priority = TEST_MOD_THREAD_PRIORITY,
+			   .data_slab = &data_slab,
+			   .data_size = TEST_MOD_DATA_SIZE}};
+
+	/* Fake internal empty data FIFO success */
+	data_fifo_init_fake.custom_fake = fake_data_fifo_init__succeeds;
+	data_fifo_uninit_fake.custom_fake = fake_data_fifo_uninit__succeeds;
+	data_fifo_empty_fake.custom_fake = fake_data_fifo_empty__succeeds;
+	data_fifo_pointer_first_vacant_get_fake.custom_fake =
+		fake_data_fifo_pointer_first_vacant_get__succeeds;
+	data_fifo_block_lock_fake.custom_fake = fake_data_fifo_block_lock__succeeds;
+	data_fifo_pointer_last_filled_get_fake.custom_fake =
+		fake_data_fifo_pointer_last_filled_get__empty_fails;
+	data_fifo_block_free_fake.custom_fake = fake_data_fifo_block_free__succeeds;
+	data_fifo_state_fake.custom_fake = fake_data_fifo_state__succeeds;
+
+	fake_fifo_counter_reset();
+
+	data_fifo_init(&fifo_rx_first);
+	data_fifo_init(&fifo_rx_second);
+	data_fifo_init(&fifo_tx_second);
+
+	graph_parameters.thread.msg_rx = &fifo_rx_first;
+	graph_parameters.thread.msg_tx = NULL;
+
+	ret = audio_module_open(&graph_parameters, (struct audio_module_configuration *)&mod_config,
+				"TEST graph first", (struct audio_module_context *)&context_first,
+				&handle_first);
+	zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+	zassert_is_null(handle_first.thread_id, "Module without stack has a thread");
+
+	graph_parameters.thread.msg_rx = &fifo_rx_second;
+	graph_parameters.thread.msg_tx = &fifo_tx_second;
+
+	ret = audio_module_open(&graph_parameters, (struct audio_module_configuration *)&mod_config,
+				"TEST graph second", (struct audio_module_context *)&context_second,
+				&handle_second);
+	zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect(&handle_first, &handle_second, false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect(&handle_second, NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_graph_init(&graph, &handle_second, graph_stack,
+				      K_THREAD_STACK_SIZEOF(graph_stack), TEST_MOD_THREAD_PRIORITY);
+	zassert_equal(ret, 0, "Graph init function did not return successfully: ret %d", ret);
+
+	ret = audio_module_graph_uninit(&graph);
+	zassert_equal(ret, 0, "Graph uninit function did not return successfully: ret %d", ret);
+
+	ret = audio_module_graph_init(&graph, &handle_first, graph_stack,
+				      K_THREAD_STACK_SIZEOF(graph_stack), TEST_MOD_THREAD_PRIORITY);
+	zassert_equal(ret, 0, "Graph init function did not return successfully: ret %d", ret);
+	zassert_equal(graph.modules_num, 2, "Graph should have 2 modules, but has %zu",
+		      graph.modules_num);
+	zassert_equal_ptr(graph.modules[0], &handle_first, "Graph order is incorrect");
+	zassert_equal_ptr(graph.modules[1], &handle_second, "Graph order is incorrect");
+
+	ret = audio_module_start(&handle_first);
+	zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+
+	ret = audio_module_start(&handle_second);
+	zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < TEST_MOD_DATA_SIZE; i++) {
+		test_data[i] = TEST_MOD_DATA_SIZE - i;
+	}
+
+	audio_data_in.data = test_data;
+	audio_data_in.data_size = TEST_MOD_DATA_SIZE;
+
+	ret = audio_module_data_tx(&handle_first, &audio_data_in, NULL);
+	zassert_equal(ret, 0, "Data TX function did not return successfully: ret %d", ret);
+
+	ret = audio_module_graph_trigger(&graph);
+	zassert_equal(ret, 0, "Graph trigger function did not return successfully: ret %d", ret);
+
+	audio_data_out.data = data;
+	audio_data_out.data_size = TEST_MOD_DATA_SIZE;
+
+	ret = audio_module_data_rx(&handle_second, &audio_data_out, K_MSEC(100));
+	zassert_equal(ret, 0, "Data RX function did not return successfully: ret %d", ret);
+	zassert_mem_equal(test_data, audio_data_out.data, TEST_MOD_DATA_SIZE,
+			  "Failed graph run, data differs");
+
+	ret = audio_module_stop(&handle_first);
+	zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+	ret = audio_module_stop(&handle_second);
+	zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+	ret = audio_module_close(&handle_first);
+	zassert_equal(ret, -EBUSY, "Close function did not return -EBUSY: ret %d", ret);
+
+	ret = audio_module_graph_uninit(&graph);
+	zassert_equal(ret, 0, "Graph uninit function did not return successfully: ret %d", ret);
+
+	ret = audio_module_close(&handle_first);
+	zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+
+	ret = audio_module_close(&handle_second);
+	zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
@@ -254,6 +254,56 @@ ZTEST(suite_fast_pair_storage_common, test_find)
 	zassert_equal(err, -ESRCH, "Expected error when key cannot be found");
 }
 
+struct account_key_check_count_context {
+	uint8_t seed;
+	size_t check_cnt;
+};
+
+static bool account_key_check_count_cb(const struct fp_account_key *account_key, void *context)
+{
+	struct account_key_check_count_context *ctx = context;
+
+	ctx->check_cnt++;
+
+	return cu_check_account_key_seed(ctx->seed, account_key);
+}
+
+ZTEST(suite_fast_pair_storage_common, test_find_recently_used_first)
+{
+	static const uint8_t first_seed;
+	static const size_t test_key_cnt = MIN(ACCOUNT_KEY_MAX_CNT, 3);
+	struct account_key_check_count_context ctx;
+	int err;
+
+	cu_account_keys_generate_and_store(first_seed, test_key_cnt);
+
+	/* The last saved key is the most recently used one. */
+	ctx.seed = first_seed + test_key_cnt - 1;
+	ctx.check_cnt = 0;
+	err = fp_storage_ak_find(NULL, account_key_check_count_cb, &ctx);
+	zassert_ok(err, "Failed to find Account Key");
+	zassert_equal(ctx.check_cnt, 1, "Most recently used key should be checked first");
+
+	/* The found key becomes the most recently used one. */
+	ctx.seed = first_seed;
+	ctx.check_cnt = 0;
+	err = fp_storage_ak_find(NULL, account_key_check_count_cb, &ctx);
+	zassert_ok(err, "Failed to find Account Key");
+	zassert_equal(ctx.check_cnt, test_key_cnt, "Least recently used key should be checked last");
+
+	ctx.check_cnt = 0;
+	err = fp_storage_ak_find(NULL, account_key_check_count_cb, &ctx);
+	zassert_ok(err, "Failed to find Account Key");
+	zassert_equal(ctx.check_cnt, 1, "Most recently used key should be checked first");
+
+	/* Reload keys from storage and validate the order again. */
+	reload_keys_from_storage();
+	ctx.check_cnt = 0;
+	err = fp_storage_ak_find(NULL, account_key_check_count_cb, &ctx);
+	zassert_ok(err, "Failed to find Account Key");
+	zassert_equal(ctx.check_cnt, 1, "Most recently used key should be checked first");
+}
+
 ZTEST(suite_fast_pair_storage_common, test_bt_has_ak)
 {
 	static const uint8_t first_seed;
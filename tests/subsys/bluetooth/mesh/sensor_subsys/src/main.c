@@ -975,4 +975,90 @@ TEST_SENSOR_TYPE(rel_dev_runtime_in_a_generic_level_range, 0x0061,
 
 TEST_SENSOR_TYPE(total_dev_runtime, 0x006e, CHANNEL(time_hour_24, 3))
 
+static struct bt_mesh_sensor_value micro_val(const struct bt_mesh_sensor_format *format,
+					     int64_t micro)
+{
+	struct bt_mesh_sensor_value val;
+
+	zassert_ok(bt_mesh_sensor_value_from_micro(format, micro, &val));
+
+	return val;
+}
+
+static bool delta_check(const struct bt_mesh_sensor_format *format, int64_t prev,
+			int64_t curr, const struct bt_mesh_sensor_deltas *deltas)
+{
+	struct bt_mesh_sensor_value prev_val = micro_val(format, prev);
+	struct bt_mesh_sensor_value curr_val = micro_val(format, curr);
+
+	return format->cb->delta_check(&curr_val, &prev_val, deltas);
+}
+
+ZTEST(sensor_types_test, test_delta_check_percentage)
+{
+	const struct bt_mesh_sensor_format *fmt = &bt_mesh_sensor_format_temp;
+	struct bt_mesh_sensor_deltas deltas = {
+		/* 10 % */
+		.up = micro_val(&bt_mesh_sensor_format_percentage_delta_trigger, 10 * MICRO),
+		.down = micro_val(&bt_mesh_sensor_format_percentage_delta_trigger, 10 * MICRO),
+	};
+
+	zassert_false(delta_check(fmt, 20 * MICRO, 20 * MICRO, &deltas));
+	zassert_false(delta_check(fmt, 20 * MICRO, 21990000, &deltas));
+	zassert_false(delta_check(fmt, 20 * MICRO, 22 * MICRO, &deltas));
+	zassert_true(delta_check(fmt, 20 * MICRO, 22010000, &deltas));
+	zassert_false(delta_check(fmt, 20 * MICRO, 18 * MICRO, &deltas));
+	zassert_true(delta_check(fmt, 20 * MICRO, 17990000, &deltas));
+
+	/* The percentage is relative to the magnitude of the previous value. */
+	zassert_false(delta_check(fmt, -20 * MICRO, -21990000, &deltas));
+	zassert_true(delta_check(fmt, -20 * MICRO, -22010000, &deltas));
+	zassert_true(delta_check(fmt, -20 * MICRO, -17990000, &deltas));
+
+	/* All changes from zero trigger. */
+	zassert_true(delta_check(fmt, 0, 10000, &deltas));
+
+	/* Check the integer and float implementations for agreement. */
+	const struct bt_mesh_sensor_format *float_fmt = &bt_mesh_sensor_format_coefficient;
+
+	for (int64_t curr = 17 * MICRO; curr <= 23 * MICRO; curr += 10000) {
+		zassert_equal(delta_check(fmt, 20 * MICRO, curr, &deltas),
+			      delta_check(float_fmt, 20 * MICRO, curr, &deltas),
+			      "Mismatch at %lld", curr);
+	}
+}
+
+ZTEST(sensor_types_test, test_delta_check_value)
+{
+	const struct bt_mesh_sensor_format *fmt = &bt_mesh_sensor_format_temp;
+	struct bt_mesh_sensor_deltas deltas = {
+		.up = micro_val(fmt, 1 * MICRO),
+		.down = micro_val(fmt, 2 * MICRO),
+	};
+
+	zassert_false(delta_check(fmt, 20 * MICRO, 21 * MICRO, &deltas));
+	zassert_true(delta_check(fmt, 20 * MICRO, 21010000, &deltas));
+	zassert_false(delta_check(fmt, 20 * MICRO, 18 * MICRO, &deltas));
+	zassert_true(delta_check(fmt, 20 * MICRO, 17990000, &deltas));
+}
+
+ZTEST(sensor_types_test, test_compare_mixed_formats)
+{
+	struct bt_mesh_sensor_value a = micro_val(&bt_mesh_sensor_format_temp_8, 20500000);
+	struct bt_mesh_sensor_value b = micro_val(&bt_mesh_sensor_format_temp, 20500000);
+	struct bt_mesh_sensor_value c = micro_val(&bt_mesh_sensor_format_temp, 20510000);
+
+	zassert_equal(bt_mesh_sensor_value_compare(&a, &b), 0);
+	zassert_equal(bt_mesh_sensor_value_compare(&a, &c), -1);
+	zassert_equal(bt_mesh_sensor_value_compare(&c, &a), 1);
+
+	struct bt_mesh_sensor_column col = {
+		.start = micro_val(&bt_mesh_sensor_format_temp_8, 20 * MICRO),
+		.width = micro_val(&bt_mesh_sensor_format_temp_8, 500000),
+	};
+
+	zassert_true(bt_mesh_sensor_value_in_column(&b, &col));
+	zassert_false(bt_mesh_sensor_value_in_column(&c, &col));
+}
+
 ZTEST_SUITE(sensor_types_test, NULL, NULL, NULL, NULL, NULL);
@@ -56,6 +56,7 @@ struct comparison_context {
 	size_t saved_image_offsets[CONFIG_DFU_MULTI_IMAGE_MAX_IMAGE_COUNT];
 	bool ignore_image_size;
 	bool reset_current_image_on_next_call;
+	bool fail_write;
 };
 
 static struct comparison_context ctx;
@@ -101,6 +102,10 @@ static int image_comparator_write(const uint8_t *chunk, size_t chunk_size)
 {
 	const struct expected_image *image = &ctx.expected.images[ctx.current_image_no];
 
+	if (ctx.fail_write) {
+		return -EIO;
+	}
+
 	zassert_true(ctx.current_image_offset + chunk_size <= image->content_size,
 		     "Too large image written");
 	zassert_ok(memcmp(image->content + ctx.current_image_offset, chunk, chunk_size),
@@ -116,7 +121,7 @@ static int image_comparator_write(const uint8_t *chunk, size_t chunk_size)
 
 static int image_comparator_close(bool success)
 {
-	zassert_true(success, "Closing image with failure");
+	zassert_true(success || ctx.fail_write, "Closing image with failure");
 
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
 	if (success) {
@@ -335,6 +340,22 @@ ZTEST(dfu_multi_image_test, test_skipped_image)
 		   "DFU failed");
 }
 
+ZTEST(dfu_multi_image_test, test_writer_error)
+{
+	int err;
+	uint8_t buffer[128];
+
+	/*
+	 * Test that an error reported by an image writer is returned to the caller,
+	 * either from the write call or, if the image is written in the background,
+	 * from the done call.
+	 */
+	ctx.fail_write = true;
+	err = comparison_test(two_image_package, sizeof(two_image_package),
+			      &two_image_package_expected, buffer, sizeof(buffer), 100);
+	zassert_equal(err, -EIO, "Writer error not reported");
+}
+
 /*
  * See CMakeLists.txt of the test project for parameters passed to the script generating
  * the DFU Multi Image package. The expected values below should match the parameters.
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <string.h>
+#include <stdbool.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/byteorder.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot_compressed.h>
+#include <psa/crypto.h>
+
+#define HEADER_SIZE sizeof(struct dfu_target_mcuboot_compressed_header)
+#define FRAGMENT_SIZE 100
+#define SHA256_SIZE 32
+
+/* Valid lzma2 compressed data */
+static const uint8_t dummy_data_input[] = {
+#include "dummy_data_input.inc"
+};
+
+/* File size and sha256 hash of decompressed data */
+static const uint32_t dummy_data_output_size = 66477;
+static const uint8_t dummy_data_output_sha256[] = {
+	0x87, 0xee, 0x2e, 0x17, 0xa5, 0xdb, 0x98, 0xbe,
+	0x8c, 0xcb, 0xfe, 0xc9, 0x70, 0x8c, 0x7a, 0x43,
+	0x66, 0xda, 0x63, 0xff, 0x48, 0x15, 0x48, 0x88,
+	0xd7, 0xed, 0x64, 0x87, 0xba, 0xb9, 0xef, 0xc5
+};
+
+static psa_hash_operation_t hash_operation;
+static size_t init_param_file_size;
+static size_t offset_get_out_param;
+static size_t write_total_len;
+static int done_param_successful;
+static int done_count;
+static int reset_count;
+
+bool dfu_target_mcuboot_identify(const void *const buf)
+{
+	return false;
+}
+
+int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	init_param_file_size = file_size;
+	return 0;
+}
+
+int dfu_target_mcuboot_offset_get(size_t *offset)
+{
+	*offset = offset_get_out_param;
+	return 0;
+}
+
+int dfu_target_mcuboot_write(const void *const buf, size_t len)
+{
+	psa_status_t status;
+
+	status = psa_hash_update(&hash_operation, buf, len);
+	zassert_equal(status, PSA_SUCCESS, "%d", status);
+
+	write_total_len += len;
+	return 0;
+}
+
+int dfu_target_mcuboot_done(bool successful)
+{
+	done_param_successful = successful;
+	done_count++;
+	return 0;
+}
+
+int dfu_target_mcuboot_schedule_update(int img_num)
+{
+	return 0;
+}
+
+int dfu_target_mcuboot_reset(void)
+{
+	offset_get_out_param = 0;
+	reset_count++;
+	return 0;
+}
+
+static void header_set(uint8_t *buf, uint32_t flags, uint32_t image_size)
+{
+	memset(buf, 0, HEADER_SIZE);
+	sys_put_le32(DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC, &buf[0]);
+	sys_put_le32(flags, &buf[4]);
+	sys_put_le32(image_size, &buf[8]);
+}
+
+static void init(void)
+{
+	int err;
+
+	err = dfu_target_init(DFU_TARGET_IMAGE_TYPE_MCUBOOT_COMPRESSED, 0,
+			      HEADER_SIZE + sizeof(dummy_data_input), NULL);
+	zassert_equal(err, 0, NULL);
+}
+
+static int image_write(size_t len)
+{
+	int err;
+	uint8_t header[HEADER_SIZE];
+
+	header_set(header, 0, dummy_data_output_size);
+
+	err = dfu_target_write(header, sizeof(header));
+	if (err) {
+		return err;
+	}
+
+	for (size_t pos = 0; pos < len; pos += FRAGMENT_SIZE) {
+		err = dfu_target_write(&dummy_data_input[pos], MIN(FRAGMENT_SIZE, len - pos));
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static void *setup(void)
+{
+	psa_status_t status;
+
+	status = psa_crypto_init();
+	zassert_equal(status, PSA_SUCCESS, "%d", status);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	psa_status_t status;
+
+	ARG_UNUSED(fixture);
+
+	(void)dfu_target_reset();
+
+	hash_operation = psa_hash_operation_init();
+	status = psa_hash_setup(&hash_operation, PSA_ALG_SHA_256);
+	zassert_equal(status, PSA_SUCCESS, "%d", status);
+
+	init_param_file_size = 0;
+	offset_get_out_param = 0;
+	write_total_len = 0;
+	done_param_successful = -1;
+	done_count = 0;
+	reset_count = 0;
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)psa_hash_abort(&hash_operation);
+}
+
+ZTEST(dfu_target_mcuboot_compressed, test_img_type)
+{
+	uint8_t buf[64] = {0};
+
+	header_set(buf, 0, dummy_data_output_size);
+
+	zassert_equal(dfu_target_img_type(buf, sizeof(buf)),
+		      DFU_TARGET_IMAGE_TYPE_MCUBOOT_COMPRESSED, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_compressed, test_write)
+{
+	int err;
+	size_t offset;
+	uint8_t sha[SHA256_SIZE];
+	size_t hash_len;
+	psa_status_t status;
+
+	init();
+
+	err = image_write(sizeof(dummy_data_input));
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_offset_get(&offset);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(offset, HEADER_SIZE + sizeof(dummy_data_input), NULL);
+
+	/* The MCUboot target is sized for the decompressed image */
+	zassert_equal(init_param_file_size, dummy_data_output_size, NULL);
+
+	err = dfu_target_done(true);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(done_param_successful, true, NULL);
+	zassert_equal(write_total_len, dummy_data_output_size, NULL);
+
+	status = psa_hash_finish(&hash_operation, sha, sizeof(sha), &hash_len);
+	zassert_equal(status, PSA_SUCCESS, "%d", status);
+	zassert_mem_equal(sha, dummy_data_output_sha256, SHA256_SIZE,
+			  "Decompressed image does not match");
+}
+
+ZTEST(dfu_target_mcuboot_compressed, test_stored_progress_discarded)
+{
+	int err;
+
+	/* Progress stored by an earlier upgrade can not be resumed */
+	offset_get_out_param = 42;
+
+	init();
+
+	err = image_write(sizeof(dummy_data_input));
+	zassert_equal(err, 0, NULL);
+	zassert_equal(reset_count, 1, NULL);
+
+	err = dfu_target_done(true);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(write_total_len, dummy_data_output_size, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_compressed, test_unsupported_flags)
+{
+	int err;
+	uint8_t header[HEADER_SIZE];
+
+	init();
+
+	header_set(header, BIT(1), dummy_data_output_size);
+
+	err = dfu_target_write(header, sizeof(header));
+	zassert_equal(err, -ENOTSUP, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_compressed, test_truncated)
+{
+	int err;
+
+	init();
+
+	err = image_write(sizeof(dummy_data_input) / 2);
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_done(true);
+	zassert_true(err < 0, "Truncated image should fail");
+	zassert_equal(done_param_successful, false, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_compressed, test_abort_restart)
+{
+	int err;
+	size_t offset;
+
+	init();
+
+	err = image_write(sizeof(dummy_data_input) / 2);
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_done(false);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(done_param_successful, false, NULL);
+
+	/* The decompression can not be resumed, the download starts over */
+	init();
+
+	err = dfu_target_offset_get(&offset);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(offset, 0, NULL);
+
+	write_total_len = 0;
+	(void)psa_hash_abort(&hash_operation);
+	hash_operation = psa_hash_operation_init();
+	(void)psa_hash_setup(&hash_operation, PSA_ALG_SHA_256);
+
+	err = image_write(sizeof(dummy_data_input));
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_done(true);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(write_total_len, dummy_data_output_size, NULL);
+}
+
+ZTEST_SUITE(dfu_target_mcuboot_compressed, NULL, setup, before, after, NULL);
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <string.h>
+#include <stdbool.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/storage/flash_map.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot_delta.h>
+
+#define HEADER_SIZE sizeof(struct dfu_target_mcuboot_delta_header)
+#define CMD_SIZE sizeof(struct dfu_target_mcuboot_delta_cmd)
+#define FRAGMENT_SIZE 7
+#define IMAGE_SIZE 1024
+#define INSERT_SIZE 10
+#define ADD_SIZE 200
+
+static uint8_t source[IMAGE_SIZE];
+static uint8_t expected[IMAGE_SIZE];
+static uint8_t output[2 * IMAGE_SIZE];
+static uint8_t patch[512];
+static size_t patch_size;
+
+static const struct flash_area source_fa = {
+	.fa_size = IMAGE_SIZE,
+};
+
+static size_t init_param_file_size;
+static size_t offset_get_out_param;
+static size_t write_total_len;
+static int done_param_successful;
+static int done_count;
+static int reset_count;
+
+int flash_area_open(uint8_t id, const struct flash_area **fa)
+{
+	*fa = &source_fa;
+	return 0;
+}
+
+void flash_area_close(const struct flash_area *fa)
+{
+}
+
+int flash_area_read(const struct flash_area *fa, off_t off, void *dst, size_t len)
+{
+	zassert_true(off + len <= IMAGE_SIZE, "Read outside of source image");
+	memcpy(dst, &source[off], len);
+	return 0;
+}
+
+bool dfu_target_mcuboot_identify(const void *const buf)
+{
+	return false;
+}
+
+int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	init_param_file_size = file_size;
+	return 0;
+}
+
+int dfu_target_mcuboot_offset_get(size_t *offset)
+{
+	*offset = offset_get_out_param;
+	return 0;
+}
+
+int dfu_target_mcuboot_write(const void *const buf, size_t len)
+{
+	zassert_true(write_total_len + len <= sizeof(output), "Too much data written");
+	memcpy(&output[write_total_len], buf, len);
+	write_total_len += len;
+	return 0;
+}
+
+int dfu_target_mcuboot_done(bool successful)
+{
+	done_param_successful = successful;
+	done_count++;
+	return 0;
+}
+
+int dfu_target_mcuboot_schedule_update(int img_num)
+{
+	return 0;
+}
+
+int dfu_target_mcuboot_reset(void)
+{
+	offset_get_out_param = 0;
+	reset_count++;
+	return 0;
+}
+
+static uint8_t *cmd_add(uint8_t *buf, uint32_t type, uint32_t length, uint32_t source_offset)
+{
+	sys_put_le32(type, &buf[0]);
+	sys_put_le32(length, &buf[4]);
+	sys_put_le32(source_offset, &buf[8]);
+
+	return buf + CMD_SIZE;
+}
+
+/* Patch using all command types, see the expected image in setup() */
+static void patch_create(uint32_t source_crc)
+{
+	uint8_t *pos = patch;
+
+	sys_put_le32(DFU_TARGET_MCUBOOT_DELTA_MAGIC, &pos[0]);
+	sys_put_le32(IMAGE_SIZE, &pos[4]);
+	sys_put_le32(source_crc, &pos[8]);
+	sys_put_le32(IMAGE_SIZE, &pos[12]);
+	sys_put_le32(crc32_ieee(expected, IMAGE_SIZE), &pos[16]);
+	pos += HEADER_SIZE;
+
+	pos = cmd_add(pos, DFU_TARGET_MCUBOOT_DELTA_CMD_COPY, 300, 0);
+
+	pos = cmd_add(pos, DFU_TARGET_MCUBOOT_DELTA_CMD_INSERT, INSERT_SIZE, 0);
+	for (size_t i = 0; i < INSERT_SIZE; i++) {
+		*pos++ = 0xa0 + i;
+	}
+
+	pos = cmd_add(pos, DFU_TARGET_MCUBOOT_DELTA_CMD_ADD, ADD_SIZE, 300);
+	memset(pos, 1, ADD_SIZE);
+	pos += ADD_SIZE;
+
+	pos = cmd_add(pos, DFU_TARGET_MCUBOOT_DELTA_CMD_COPY,
+		      IMAGE_SIZE - 300 - INSERT_SIZE - ADD_SIZE, 300 + ADD_SIZE);
+
+	patch_size = pos - patch;
+}
+
+static void init(void)
+{
+	int err;
+
+	err = dfu_target_init(DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA, 0, patch_size, NULL);
+	zassert_equal(err, 0, NULL);
+}
+
+static int patch_write(size_t len)
+{
+	int err;
+
+	for (size_t pos = 0; pos < len; pos += FRAGMENT_SIZE) {
+		err = dfu_target_write(&patch[pos], MIN(FRAGMENT_SIZE, len - pos));
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static void *setup(void)
+{
+	uint32_t seed = 1;
+
+	for (size_t i = 0; i < IMAGE_SIZE; i++) {
+		seed = seed * 1103515245 + 12345;
+		source[i] = seed >> 16;
+	}
+
+	memcpy(expected, source, 300);
+	for (size_t i = 0; i < INSERT_SIZE; i++) {
+		expected[300 + i] = 0xa0 + i;
+	}
+	for (size_t i = 0; i < ADD_SIZE; i++) {
+		expected[300 + INSERT_SIZE + i] = source[300 + i] + 1;
+	}
+	memcpy(&expected[300 + INSERT_SIZE + ADD_SIZE], &source[300 + ADD_SIZE],
+	       IMAGE_SIZE - 300 - INSERT_SIZE - ADD_SIZE);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)dfu_target_reset();
+
+	patch_create(crc32_ieee(source, IMAGE_SIZE));
+
+	memset(output, 0, sizeof(output));
+	init_param_file_size = 0;
+	offset_get_out_param = 0;
+	write_total_len = 0;
+	done_param_successful = -1;
+	done_count = 0;
+	reset_count = 0;
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_img_type)
+{
+	zassert_equal(dfu_target_img_type(patch, 64), DFU_TARGET_IMAGE_TYPE_MCUBOOT_DELTA, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_write)
+{
+	int err;
+	size_t offset;
+
+	init();
+
+	err = patch_write(patch_size);
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_offset_get(&offset);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(offset, patch_size, NULL);
+
+	/* The MCUboot target is sized for the patched image */
+	zassert_equal(init_param_file_size, IMAGE_SIZE, NULL);
+
+	err = dfu_target_done(true);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(done_param_successful, true, NULL);
+	zassert_equal(write_total_len, IMAGE_SIZE, NULL);
+	zassert_mem_equal(output, expected, IMAGE_SIZE, "Patched image does not match");
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_stored_progress_discarded)
+{
+	int err;
+
+	/* Progress stored by an earlier upgrade can not be resumed */
+	offset_get_out_param = 42;
+
+	init();
+
+	err = patch_write(patch_size);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(reset_count, 1, NULL);
+
+	err = dfu_target_done(true);
+	zassert_equal(err, 0, NULL);
+	zassert_mem_equal(output, expected, IMAGE_SIZE, "Patched image does not match");
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_source_mismatch)
+{
+	int err;
+
+	patch_create(crc32_ieee(source, IMAGE_SIZE) ^ 1);
+
+	init();
+
+	err = dfu_target_write(patch, HEADER_SIZE);
+	zassert_equal(err, -EINVAL, NULL);
+	zassert_equal(write_total_len, 0, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_invalid_source_offset)
+{
+	int err;
+	uint8_t buf[CMD_SIZE];
+
+	init();
+
+	err = dfu_target_write(patch, HEADER_SIZE);
+	zassert_equal(err, 0, NULL);
+
+	(void)cmd_add(buf, DFU_TARGET_MCUBOOT_DELTA_CMD_COPY, 100, IMAGE_SIZE - 50);
+
+	err = dfu_target_write(buf, sizeof(buf));
+	zassert_equal(err, -EINVAL, NULL);
+	zassert_equal(done_param_successful, false, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_truncated)
+{
+	int err;
+
+	init();
+
+	err = patch_write(patch_size - CMD_SIZE);
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_done(true);
+	zassert_true(err < 0, "Truncated patch should fail");
+	zassert_equal(done_param_successful, false, NULL);
+}
+
+ZTEST(dfu_target_mcuboot_delta, test_abort_restart)
+{
+	int err;
+	size_t offset;
+
+	init();
+
+	err = patch_write(patch_size / 2);
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_done(false);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(done_param_successful, false, NULL);
+
+	/* The patch can not be resumed, the download starts over */
+	init();
+
+	err = dfu_target_offset_get(&offset);
+	zassert_equal(err, 0, NULL);
+	zassert_equal(offset, 0, NULL);
+
+	write_total_len = 0;
+
+	err = patch_write(patch_size);
+	zassert_equal(err, 0, NULL);
+
+	err = dfu_target_done(true);
+	zassert_equal(err, 0, NULL);
+	zassert_mem_equal(output, expected, IMAGE_SIZE, "Patched image does not match");
+}
+
+ZTEST_SUITE(dfu_target_mcuboot_delta, NULL, setup, before, NULL, NULL);
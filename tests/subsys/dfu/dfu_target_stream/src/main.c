@@ -290,6 +290,66 @@ ZTEST(dfu_target_stream_test, test_dfu_target_stream_save_progress)
 
 #endif
 
+#if defined(CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD) && CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD > 0
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_erase_ahead)
+{
+	int err;
+	struct flash_pages_info page;
+
+	err = flash_get_page_info_by_offs(fdev, FLASH_BASE, &page);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_true(page.size * 2 <= BUF_LEN, "BUF_LEN must be at least two pages long");
+
+	/* Reset state to avoid failure when initializing */
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* Fill the first pages with data */
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_1, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_write(write_buf, sizeof(write_buf));
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* Start a new stream, the pages following the write position are
+	 * erased in the background.
+	 */
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_1, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_write(write_buf, 16);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	k_sleep(K_MSEC(500));
+
+	err = flash_read(fdev, FLASH_BASE + page.size, read_buf, page.size);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	for (size_t i = 0; i < page.size; i++) {
+		zassert_equal(read_buf[i], 0xff, "Page not erased ahead at %zu", i);
+	}
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = flash_read(fdev, FLASH_BASE, read_buf, 16);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(read_buf, write_buf, 16, "Incorrect value");
+}
+#else
+
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_erase_ahead)
+{
+	ztest_test_skip();
+}
+
+#endif
+
 static void *setup(void)
 {
 	__ASSERT_NO_MSG(device_is_ready(fdev));
@@ -179,7 +179,7 @@ ZTEST(emds_flash, test_scanning_partitions_equality)
 {
 	struct emds_snapshot_candidate candidate;
 	struct emds_snapshot_metadata *metadata = NULL;
-	off_t metadata_off = partition[0].fa->fa_size;
+	off_t metadata_off = emds_flash_metadata_end(&partition[0]);
 	uint32_t fresh_cnt = 0;
 
 	candidate.metadata.fresh_cnt = 0;
@@ -192,7 +192,7 @@ ZTEST(emds_flash, test_scanning_partitions_equality)
 	}
 
 	metadata = NULL;
-	metadata_off = partition[1].fa->fa_size;
+	metadata_off = emds_flash_metadata_end(&partition[1]);
 	for (int i = 0; i < CONFIG_EMDS_MAX_CANDIDATES; i++) {
 		metadata_off -= sizeof(struct emds_snapshot_metadata);
 		fresh_cnt++;
@@ -204,7 +204,7 @@ ZTEST(emds_flash, test_scanning_partitions_equality)
 	zassert_ok(emds_flash_scan_partition(&partition[0], &candidate),
 		   "Failed to scan partition 0");
 	zassert_equal(candidate.metadata_off,
-		      partition[0].fa->fa_size -
+		      emds_flash_metadata_end(&partition[0]) -
 			      CONFIG_EMDS_MAX_CANDIDATES * sizeof(struct emds_snapshot_metadata),
 		      "Metadata offset mismatch for partition 0");
 	zassert_equal(candidate.metadata.fresh_cnt, CONFIG_EMDS_MAX_CANDIDATES,
@@ -213,7 +213,7 @@ ZTEST(emds_flash, test_scanning_partitions_equality)
 	zassert_ok(emds_flash_scan_partition(&partition[1], &candidate),
 		   "Failed to scan partition 1");
 	zassert_equal(candidate.metadata_off,
-		      partition[1].fa->fa_size -
+		      emds_flash_metadata_end(&partition[1]) -
 			      CONFIG_EMDS_MAX_CANDIDATES * sizeof(struct emds_snapshot_metadata),
 		      "Metadata offset mismatch for partition 1");
 	zassert_equal(candidate.metadata.fresh_cnt, CONFIG_EMDS_MAX_CANDIDATES * 2,
@@ -226,7 +226,7 @@ ZTEST(emds_flash, test_scanning_partitions_deepness)
 	struct emds_snapshot_candidate candidate;
 	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
 	struct emds_snapshot_metadata *metadata = NULL;
-	off_t metadata_off = partition[partition_index].fa->fa_size;
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]);
 	uint32_t fresh_cnt = 0;
 
 	candidate.metadata.fresh_cnt = 0;
@@ -249,7 +249,7 @@ ZTEST(emds_flash, test_scanning_partitions_freshness)
 	struct emds_snapshot_candidate candidate;
 	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
 	struct emds_snapshot_metadata *metadata = NULL;
-	off_t metadata_off = partition[partition_index].fa->fa_size;
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]);
 	uint32_t fresh_cnt = 0;
 	uint32_t fresh_cnt_max = 0;
 
@@ -275,7 +275,7 @@ ZTEST(emds_flash, test_scanning_partitions_wrong_crc)
 	struct emds_snapshot_candidate candidate;
 	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
 	struct emds_snapshot_metadata *metadata = NULL;
-	off_t metadata_off = partition[partition_index].fa->fa_size;
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]);
 	uint32_t fresh_cnt = 1;
 
 	candidate.metadata.fresh_cnt = 0;
@@ -313,7 +313,7 @@ ZTEST(emds_flash, test_scanning_limitations)
 	struct emds_snapshot_candidate candidate;
 	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
 	struct emds_snapshot_metadata *metadata = NULL;
-	off_t metadata_off = partition[partition_index].fa->fa_size;
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]);
 	uint32_t fresh_cnt = 1;
 
 	candidate.metadata.fresh_cnt = 0;
@@ -368,7 +368,7 @@ ZTEST(emds_flash, test_allocation_empty_partition)
 	zassert_equal(allocated_snapshot.partition_index, partition_index,
 		      "Partition index is not equal to the requested one");
 	zassert_equal(allocated_snapshot.metadata_off,
-		      partition[partition_index].fa->fa_size -
+		      emds_flash_metadata_end(&partition[partition_index]) -
 			      sizeof(struct emds_snapshot_metadata),
 		      "Metadata offset is not equal to the end of the partition");
 	zassert_equal(allocated_snapshot.metadata.data_instance_off, 0,
@@ -393,8 +393,8 @@ ZTEST(emds_flash, test_allocation_after_freshest_same_partition)
 		.metadata.fresh_cnt = 2
 	};
 	struct emds_snapshot_metadata *metadata = NULL;
-	off_t metadata_off =
-		partition[partition_index].fa->fa_size - sizeof(struct emds_snapshot_metadata);
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]) -
+			     sizeof(struct emds_snapshot_metadata);
 	uint32_t fresh_cnt = 1;
 
 	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, true,
@@ -410,7 +410,7 @@ ZTEST(emds_flash, test_allocation_after_freshest_same_partition)
 	zassert_equal(allocated_snapshot.partition_index, partition_index,
 		      "Partition index is not equal to the requested one");
 	zassert_equal(allocated_snapshot.metadata_off,
-		      partition[partition_index].fa->fa_size -
+		      emds_flash_metadata_end(&partition[partition_index]) -
 			      2 * sizeof(struct emds_snapshot_metadata),
 		      "Metadata offset is not equal to expected");
 	zassert_equal(allocated_snapshot.metadata.data_instance_off,
@@ -450,7 +450,7 @@ ZTEST(emds_flash, test_allocation_next_partition_if_freshest_full)
 	struct emds_snapshot_candidate allocated_snapshot;
 	struct emds_snapshot_metadata *metadata = NULL;
 	struct emds_snapshot_metadata metadata_prev;
-	off_t metadata_off = partition[partition_index].fa->fa_size;
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]);
 	off_t metadata_off_prev;
 	uint32_t fresh_cnt = 0;
 	int rc;
@@ -490,7 +490,10 @@ ZTEST(emds_flash, test_allocation_if_metadata_garbaged)
 		garbage[i] = sys_rand32_get() % 256;
 	}
 
-	zassert_ok(flash_area_write(fa, fa->fa_size - sizeof(garbage), &garbage, sizeof(garbage)),
+	zassert_ok(flash_area_write(fa,
+				    emds_flash_metadata_end(&partition[partition_index]) -
+					    sizeof(garbage),
+				    &garbage, sizeof(garbage)),
 		   "Failed to write garbage into metadata flash area");
 
 	rc = emds_flash_allocate_snapshot(&partition[partition_index], NULL, &allocated_snapshot,
@@ -508,7 +511,8 @@ ZTEST(emds_flash, test_allocation_if_metadata_garbaged)
 	zassert_equal(allocated_snapshot.partition_index, partition_index,
 		      "Partition index is not equal to the requested one");
 	zassert_equal(allocated_snapshot.metadata_off,
-		      fa->fa_size - sizeof(struct emds_snapshot_metadata),
+		      emds_flash_metadata_end(&partition[partition_index]) -
+			      sizeof(struct emds_snapshot_metadata),
 		      "Metadata offset is not equal to the end of the partition");
 	zassert_equal(allocated_snapshot.metadata.data_instance_off, 0,
 		      "Data instance offset is not equal to 0");
@@ -556,7 +560,8 @@ ZTEST(emds_flash, test_allocation_if_data_garbaged)
 	zassert_equal(allocated_snapshot.partition_index, partition_index,
 		      "Partition index is not equal to the requested one");
 	zassert_equal(allocated_snapshot.metadata_off,
-		      fa->fa_size - sizeof(struct emds_snapshot_metadata),
+		      emds_flash_metadata_end(&partition[partition_index]) -
+			      sizeof(struct emds_snapshot_metadata),
 		      "Metadata offset is not equal to the end of the partition");
 	zassert_equal(allocated_snapshot.metadata.data_instance_off, 0,
 		      "Data instance offset is not equal to 0");
@@ -570,6 +575,82 @@ ZTEST(emds_flash, test_allocation_if_data_garbaged)
 }
 
 /* Test measures write timings. */
+#if defined(CONFIG_EMDS_SNAPSHOT_INDEX)
+/* Test checks that scanning starts at the indexed snapshot and finds snapshots stored after it. */
+ZTEST(emds_flash, test_index_scan_from_index)
+{
+	struct emds_snapshot_candidate candidate = {0};
+	struct emds_snapshot_candidate indexed;
+	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
+	struct emds_snapshot_metadata *metadata = NULL;
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]);
+	uint32_t fresh_cnt = 0;
+
+	metadata_off -= sizeof(struct emds_snapshot_metadata);
+	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, true,
+				 ++fresh_cnt);
+	zassert_not_null(metadata, "Failed to create snapshot on partition %d", partition_index);
+
+	/* Broken metadata that stops the scanning of the whole partition. */
+	for (int i = 0; i <= CONFIG_EMDS_SCANNING_FAILURES; i++) {
+		metadata_off -= sizeof(struct emds_snapshot_metadata);
+		metadata = snapshot_make(&partition[partition_index], metadata, metadata_off,
+					 false, true, ++fresh_cnt);
+		zassert_not_null(metadata, "Failed to create snapshot on partition %d",
+				 partition_index);
+	}
+
+	metadata_off -= sizeof(struct emds_snapshot_metadata);
+	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, true,
+				 ++fresh_cnt);
+	zassert_not_null(metadata, "Failed to create snapshot on partition %d", partition_index);
+	indexed.metadata_off = metadata_off;
+	indexed.metadata = *metadata;
+	zassert_ok(emds_flash_index_update(&partition[partition_index], &indexed),
+		   "Failed to update snapshot index");
+
+	metadata_off -= sizeof(struct emds_snapshot_metadata);
+	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, true,
+				 ++fresh_cnt);
+	zassert_not_null(metadata, "Failed to create snapshot on partition %d", partition_index);
+
+	zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+		   "Failed to scan partition %d", partition_index);
+	zassert_equal(candidate.metadata.fresh_cnt, fresh_cnt, "Fresh count mismatch");
+	zassert_equal(candidate.metadata_off, metadata_off, "Metadata offset mismatch");
+}
+
+/* Test checks that the whole partition is scanned if the index points to no valid snapshot. */
+ZTEST(emds_flash, test_index_fallback_to_full_scan)
+{
+	struct emds_snapshot_candidate candidate = {0};
+	struct emds_snapshot_candidate indexed = {0};
+	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
+	struct emds_snapshot_metadata *metadata = NULL;
+	off_t metadata_off = emds_flash_metadata_end(&partition[partition_index]);
+	uint32_t fresh_cnt = 0;
+
+	for (int i = 0; i < CONFIG_EMDS_MAX_CANDIDATES; i++) {
+		metadata_off -= sizeof(struct emds_snapshot_metadata);
+		metadata = snapshot_make(&partition[partition_index], metadata, metadata_off,
+					 true, true, ++fresh_cnt);
+		zassert_not_null(metadata, "Failed to create snapshot on partition %d",
+				 partition_index);
+	}
+
+	/* Point the index to the empty metadata slot after the freshest snapshot. */
+	indexed.metadata_off = metadata_off - sizeof(struct emds_snapshot_metadata);
+	indexed.metadata.fresh_cnt = fresh_cnt + 1;
+	zassert_ok(emds_flash_index_update(&partition[partition_index], &indexed),
+		   "Failed to update snapshot index");
+
+	zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+		   "Failed to scan partition %d", partition_index);
+	zassert_equal(candidate.metadata.fresh_cnt, fresh_cnt, "Fresh count mismatch");
+	zassert_equal(candidate.metadata_off, metadata_off, "Metadata offset mismatch");
+}
+#endif /* CONFIG_EMDS_SNAPSHOT_INDEX */
+
 ZTEST(emds_flash, test_write_speed)
 {
 	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <unity.h>
+#include <string.h>
+#include <errno.h>
+
+#include "azure_iot_hub_coalesce_private.h"
+
+#define TEST_OUT_SIZE		256
+
+static char out[TEST_OUT_SIZE];
+static size_t out_len;
+
+static int merge(const char *base, const char *patch, size_t out_size)
+{
+	return coalesce_json_merge(base, (base == NULL) ? 0 : strlen(base),
+				   patch, strlen(patch), out, out_size, &out_len);
+}
+
+#define TEST_ASSERT_MERGED(expected)						\
+	do {									\
+		TEST_ASSERT_EQUAL(sizeof(expected) - 1, out_len);		\
+		TEST_ASSERT_EQUAL_MEMORY(expected, out, out_len);		\
+	} while (0)
+
+void setUp(void)
+{
+	memset(out, 0, sizeof(out));
+	out_len = 0;
+}
+
+void test_merge_empty_base(void)
+{
+	TEST_ASSERT_EQUAL(0, merge(NULL, " { \"a\": 1 } ", sizeof(out)));
+	TEST_ASSERT_MERGED("{\"a\":1}");
+}
+
+void test_merge_last_writer_wins(void)
+{
+	TEST_ASSERT_EQUAL(0, merge("{\"a\":1,\"b\":\"x\"}", "{\"b\":\"y\",\"c\":true}",
+				   sizeof(out)));
+	TEST_ASSERT_MERGED("{\"a\":1,\"b\":\"y\",\"c\":true}");
+}
+
+void test_merge_nested_objects(void)
+{
+	TEST_ASSERT_EQUAL(0, merge("{\"cfg\":{\"x\":1,\"y\":2}}", "{\"cfg\":{\"y\":3,\"z\":4}}",
+				   sizeof(out)));
+	TEST_ASSERT_MERGED("{\"cfg\":{\"x\":1,\"y\":3,\"z\":4}}");
+}
+
+void test_merge_object_replaced_by_value(void)
+{
+	TEST_ASSERT_EQUAL(0, merge("{\"cfg\":{\"x\":1}}", "{\"cfg\":null}", sizeof(out)));
+	TEST_ASSERT_MERGED("{\"cfg\":null}");
+}
+
+void test_merge_strings_and_arrays(void)
+{
+	TEST_ASSERT_EQUAL(0, merge("{\"s\":\"a}b\"}", "{\"s\":\"c\\\"{\",\"l\":[1,{\"s\":2}]}",
+				   sizeof(out)));
+	TEST_ASSERT_MERGED("{\"s\":\"c\\\"{\",\"l\":[1,{\"s\":2}]}");
+}
+
+void test_merge_invalid_patch(void)
+{
+	TEST_ASSERT_EQUAL(-EBADMSG, merge("{\"a\":1}", "[1,2]", sizeof(out)));
+	TEST_ASSERT_EQUAL(-EBADMSG, merge("{\"a\":1}", "{\"a\":}", sizeof(out)));
+	TEST_ASSERT_EQUAL(-EBADMSG, merge("{\"a\":1}", "{\"a\":1", sizeof(out)));
+	TEST_ASSERT_EQUAL(-EBADMSG, merge("{\"a\":1}", "{\"a\":1} {}", sizeof(out)));
+}
+
+void test_merge_no_space(void)
+{
+	TEST_ASSERT_EQUAL(-ENOMEM, merge("{\"a\":1}", "{\"b\":2}", sizeof("{\"a\":1,\"b\":2}") - 2));
+	TEST_ASSERT_EQUAL(0, merge("{\"a\":1}", "{\"b\":2}", sizeof("{\"a\":1,\"b\":2}") - 1));
+	TEST_ASSERT_MERGED("{\"a\":1,\"b\":2}");
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
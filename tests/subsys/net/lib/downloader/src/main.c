@@ -150,6 +150,12 @@
 "Vary: Accept-Encoding\r\n" \
 "X-Cache: HIT\r\n\r\n"
 
+#define HTTPS_HDR_PIPELINED(range) \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Length: 32\r\n" \
+"Connection: keep-alive\r\n" \
+"Content-Range: bytes " range "/96\r\n\r\n"
+
 #define HTTP_HDR_REDIRECT "HTTP/1.1 308 Permanent Redirect\r\n" \
 "Date: Wed, 29 Jan 2025 11:16:09 GMT\r\n" \
 "Content-Type: text/html\r\n" \
@@ -898,6 +904,39 @@ static ssize_t z_impl_zsock_recvfrom_https_partial_content(
 	return 0;
 }
 
+/* The second and third responses to pipelined range requests are received at once. */
+static ssize_t z_impl_zsock_recvfrom_https_pipelined(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	char *p = buf;
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(sizeof(dl_buf) >= max_len);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		memcpy(p, HTTPS_HDR_PIPELINED("0-31"), strlen(HTTPS_HDR_PIPELINED("0-31")));
+		p += strlen(HTTPS_HDR_PIPELINED("0-31"));
+		memset(p, 23, 32);
+		return p + 32 - (char *)buf;
+	case 2:
+		/* Both remaining fragments must have been requested by now */
+		TEST_ASSERT_EQUAL(3, z_impl_zsock_sendto_fake.call_count);
+
+		memcpy(p, HTTPS_HDR_PIPELINED("32-63"), strlen(HTTPS_HDR_PIPELINED("32-63")));
+		p += strlen(HTTPS_HDR_PIPELINED("32-63"));
+		memset(p, 23, 32);
+		p += 32;
+		memcpy(p, HTTPS_HDR_PIPELINED("64-95"), strlen(HTTPS_HDR_PIPELINED("64-95")));
+		p += strlen(HTTPS_HDR_PIPELINED("64-95"));
+		memset(p, 23, 32);
+		return p + 32 - (char *)buf;
+	}
+
+	return 0;
+}
+
 static ssize_t z_impl_zsock_recvfrom_https_partial_content_partial_2nd_header(
 	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
 	net_socklen_t *addrlen)
@@ -1289,6 +1328,67 @@ struct coap_transmission_parameters coap_get_transmission_parameters_ok(void)
 	return coap_transmission_params;
 }
 
+#define COAP_WINDOW_BLOCK_SIZE 16
+#define COAP_WINDOW_FILE_SIZE (3 * COAP_WINDOW_BLOCK_SIZE)
+
+static struct coap_block_context *coap_window_block_ctx;
+
+/* Every response is for the expected block, which has been requested before the
+ * second response is received.
+ */
+static ssize_t z_impl_zsock_recvfrom_coap_window(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	if (z_impl_zsock_recvfrom_fake.call_count == 2) {
+		TEST_ASSERT_EQUAL(3, z_impl_zsock_sendto_fake.call_count);
+	}
+
+	memset(buf, 23, 32);
+	return 32;
+}
+
+int coap_block_transfer_init_window(struct coap_block_context *ctx,
+				    enum coap_block_size block_size,
+				    size_t total_size)
+{
+	coap_window_block_ctx = ctx;
+	ctx->block_size = COAP_BLOCK_16;
+	ctx->total_size = total_size;
+	ctx->current = 0;
+
+	return 0;
+}
+
+int coap_get_option_int_window(const struct coap_packet *cpkt, uint16_t code)
+{
+	/* Block2 option of the expected block */
+	return (coap_window_block_ctx->current / COAP_WINDOW_BLOCK_SIZE) << 4;
+}
+
+int coap_update_from_block_window(const struct coap_packet *cpkt,
+				  struct coap_block_context *ctx)
+{
+	ctx->total_size = COAP_WINDOW_FILE_SIZE;
+
+	return 0;
+}
+
+size_t coap_next_block_window(const struct coap_packet *cpkt,
+			      struct coap_block_context *ctx)
+{
+	ctx->current += COAP_WINDOW_BLOCK_SIZE;
+
+	return ctx->current < ctx->total_size ? ctx->current : 0;
+}
+
+const uint8_t *coap_packet_get_payload_window(const struct coap_packet *cpkt, uint16_t *len)
+{
+	*len = COAP_WINDOW_BLOCK_SIZE;
+
+	return COAP_PAYLOAD;
+}
+
 struct pipe {
 	struct downloader_evt data[10];
 	uint8_t wr_idx;
@@ -1632,6 +1732,37 @@ void test_downloader_get_https_partial_content_partial_2nd_header(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_https_pipelined(void)
+{
+	int err;
+	struct downloader_evt evt;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_https_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_https_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_https_pipelined;
+
+	err = downloader_get(&dl, &dl_host_conf_w_sec_tags_range_override_32, HTTPS_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	for (int i = 0; i < 3; i++) {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		TEST_ASSERT_EQUAL(32, evt.fragment.len);
+	}
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(2, z_impl_zsock_recvfrom_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_https_unlimited_redirect(void)
 {
 	int err;
@@ -2216,6 +2347,50 @@ void test_downloader_get_coap_retransmission_recovery(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_coap_window(void)
+{
+	int err;
+	struct downloader_evt evt;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_coap_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_coap_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_coap_window;
+
+	coap_get_transmission_parameters_fake.custom_fake = coap_get_transmission_parameters_ok;
+	coap_pending_cycle_fake.custom_fake = coap_pending_cycle_ok;
+	coap_header_get_type_fake.custom_fake = coap_header_get_type_ack;
+	coap_header_get_code_fake.custom_fake = coap_header_get_code_ok;
+	coap_block_transfer_init_fake.custom_fake = coap_block_transfer_init_window;
+	coap_get_option_int_fake.custom_fake = coap_get_option_int_window;
+	coap_update_from_block_fake.custom_fake = coap_update_from_block_window;
+	coap_next_block_fake.custom_fake = coap_next_block_window;
+	coap_packet_get_payload_fake.custom_fake = coap_packet_get_payload_window;
+
+	err = downloader_get(&dl, &dl_host_cfg, COAP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	for (int i = 0; i < 3; i++) {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		TEST_ASSERT_EQUAL(COAP_WINDOW_BLOCK_SIZE, evt.fragment.len);
+	}
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	/* The first block, then the two remaining blocks at once */
+	TEST_ASSERT_EQUAL(3, z_impl_zsock_sendto_fake.call_count);
+	TEST_ASSERT_EQUAL(3, z_impl_zsock_recvfrom_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_get_einval(void)
 {
 	int err;
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include <net/lwm2m_client_utils.h>
+#include "stubs.h"
+
+static struct lwm2m_ctx ctx;
+
+static void setup(void)
+{
+	/* Register resets */
+	DO_FOREACH_FAKE(RESET_FAKE);
+
+	/* Drop the paths left in the batch by other tests. */
+	lwm2m_rd_client_ctx_fake.return_val = &ctx;
+	(void)lwm2m_utils_send_batch_flush();
+
+	/* reset common FFF internal structures */
+	FFF_RESET_HISTORY();
+	RESET_FAKE(lwm2m_send_cb);
+}
+
+ZTEST_SUITE(lwm2m_client_utils_send_batch, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(lwm2m_client_utils_send_batch, test_add_invalid)
+{
+	setup();
+
+	zassert_equal(lwm2m_utils_send_batch_add(NULL), -EINVAL, "Wrong return value");
+}
+
+ZTEST(lwm2m_client_utils_send_batch, test_flush)
+{
+	setup();
+
+	zassert_equal(lwm2m_utils_send_batch_add(&LWM2M_OBJ(4, 0, 2)), 0, "Wrong return value");
+	zassert_equal(lwm2m_utils_send_batch_add(&LWM2M_OBJ(4, 0, 8)), 0, "Wrong return value");
+	zassert_equal(lwm2m_utils_send_batch_add(&LWM2M_OBJ(4, 0, 2)), 0, "Wrong return value");
+	zassert_equal(lwm2m_send_cb_fake.call_count, 0, "Batch sent before the window");
+
+	zassert_equal(lwm2m_utils_send_batch_flush(), 0, "Wrong return value");
+	zassert_equal(lwm2m_send_cb_fake.call_count, 1, "Batch not sent");
+	zassert_equal(lwm2m_send_cb_fake.arg2_val, 2, "Duplicate path sent");
+
+	/* An empty batch is not sent. */
+	zassert_equal(lwm2m_utils_send_batch_flush(), 0, "Wrong return value");
+	zassert_equal(lwm2m_send_cb_fake.call_count, 1, "Empty batch sent");
+}
+
+ZTEST(lwm2m_client_utils_send_batch, test_window)
+{
+	setup();
+
+	zassert_equal(lwm2m_utils_send_batch_add(&LWM2M_OBJ(4, 0, 2)), 0, "Wrong return value");
+	k_sleep(K_SECONDS(CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH_WINDOW - 1));
+	zassert_equal(lwm2m_send_cb_fake.call_count, 0, "Batch sent before the window");
+
+	zassert_equal(lwm2m_utils_send_batch_add(&LWM2M_OBJ(4, 0, 8)), 0, "Wrong return value");
+	k_sleep(K_SECONDS(2));
+	zassert_equal(lwm2m_send_cb_fake.call_count, 1, "Batch not sent");
+	zassert_equal(lwm2m_send_cb_fake.arg2_val, 2, "Wrong number of paths");
+}
+
+ZTEST(lwm2m_client_utils_send_batch, test_full)
+{
+	setup();
+
+	for (int i = 0; i < CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH_PATHS_MAX; i++) {
+		zassert_equal(lwm2m_utils_send_batch_add(&LWM2M_OBJ(4, 0, 2, i)), 0,
+			      "Wrong return value");
+	}
+
+	k_sleep(K_MSEC(100));
+	zassert_equal(lwm2m_send_cb_fake.call_count, 1, "Full batch not sent");
+	zassert_equal(lwm2m_send_cb_fake.arg2_val, CONFIG_LWM2M_CLIENT_UTILS_SEND_BATCH_PATHS_MAX,
+		      "Wrong number of paths");
+}
+
+ZTEST(lwm2m_client_utils_send_batch, test_not_registered)
+{
+	setup();
+
+	lwm2m_rd_client_ctx_fake.return_val = NULL;
+	zassert_equal(lwm2m_utils_send_batch_add(&LWM2M_OBJ(4, 0, 2)), 0, "Wrong return value");
+	zassert_equal(lwm2m_utils_send_batch_flush(), -ENOTCONN, "Wrong return value");
+	zassert_equal(lwm2m_send_cb_fake.call_count, 0, "Batch sent without a client");
+
+	/* The paths are kept until the client is registered. */
+	lwm2m_rd_client_ctx_fake.return_val = &ctx;
+	zassert_equal(lwm2m_utils_send_batch_flush(), 0, "Wrong return value");
+	zassert_equal(lwm2m_send_cb_fake.call_count, 1, "Batch not sent");
+	zassert_equal(lwm2m_send_cb_fake.arg2_val, 1, "Wrong number of paths");
+}
@@ -313,6 +313,10 @@ static int lwm2m_firmware_event(struct lwm2m_fota_event *event)
 	case LWM2M_FOTA_UPDATE_MODEM_RECONNECT_REQ:
 		fota_event.reconnect_req.obj_inst_id = event->reconnect_req.obj_inst_id;
 		break;
+	case LWM2M_FOTA_DOWNLOAD_PROGRESS:
+		fota_event.download_progress.obj_inst_id = event->download_progress.obj_inst_id;
+		fota_event.download_progress.percent = event->download_progress.percent;
+		break;
 	}
 
 	return 0;
@@ -604,6 +608,16 @@ ZTEST(lwm2m_client_utils_firmware, test_firmware_pull_success_cb)
 
 	/* Test FOTA download progress report. */
 	pull_callback_event_stub(FOTA_DOWNLOAD_EVT_PROGRESS, 0);
+	zassert_equal(fota_event.id, LWM2M_FOTA_DOWNLOAD_PROGRESS, "Wrong event ID received");
+	zassert_equal(fota_event.download_progress.obj_inst_id, app_instance,
+		      "Wrong instance ID received");
+	zassert_equal(fota_event.download_progress.percent, 10, "Wrong progress received");
+
+	/* Progress is reported only when the percentage grows. */
+	fota_event.id = LWM2M_FOTA_DOWNLOAD_START;
+	pull_callback_event_stub(FOTA_DOWNLOAD_EVT_PROGRESS, 0);
+	zassert_equal(fota_event.id, LWM2M_FOTA_DOWNLOAD_START, "Progress reported again");
+
 	pull_callback_event_stub(FOTA_DOWNLOAD_EVT_FINISHED, 0);
 	state = get_app_state();
 	printf("State %d\r\n", state);
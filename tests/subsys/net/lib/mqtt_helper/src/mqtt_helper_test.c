@@ -70,6 +70,12 @@ static K_SEM_DEFINE(puback_sem, 0, 1);
 static K_SEM_DEFINE(suback_sem, 0, 1);
 static K_SEM_DEFINE(publish_sem, 0, 1);
 static K_SEM_DEFINE(error_msg_size_sem, 0, 1);
+static K_SEM_DEFINE(publish_window_sem, 0, 1);
+
+/* Reassembled payload of the chunked publish test. */
+static char chunked_payload[TEST_PAYLOAD_LEN];
+static size_t chunked_payload_len;
+static int chunked_payload_chunks;
 
 void setUp(void)
 {
@@ -96,6 +102,18 @@ static int mqtt_readall_publish_payload_stub(struct mqtt_client *client, uint8_t
 	return 0;
 }
 
+/* Returns the payload in chunks of at most 5 bytes. */
+static int mqtt_read_publish_payload_blocking_stub(struct mqtt_client *client, void *buffer,
+						   size_t length, int num_calls)
+{
+	size_t offset = num_calls * 5;
+	size_t len = MIN(MIN(length, 5), TEST_PAYLOAD_LEN - offset);
+
+	memcpy(buffer, &TEST_PAYLOAD[offset], len);
+
+	return len;
+}
+
 static int poll_stub_pollin(struct zsock_pollfd *fds, int nfds, int timeout, int num_calls)
 {
 	fds[0].revents = fds[0].events & ZSOCK_POLLIN;
@@ -196,6 +214,23 @@ static void cb_on_publish(struct mqtt_helper_buf topic, struct mqtt_helper_buf p
 	k_sem_give(&publish_sem);
 }
 
+static void cb_on_publish_chunk(struct mqtt_helper_buf topic, struct mqtt_helper_buf chunk,
+				size_t offset, size_t payload_len)
+{
+	TEST_ASSERT_EQUAL(TEST_TOPIC_1_LEN, topic.size);
+	TEST_ASSERT_EQUAL(TEST_PAYLOAD_LEN, payload_len);
+	TEST_ASSERT_EQUAL(chunked_payload_len, offset);
+	TEST_ASSERT_LESS_OR_EQUAL(payload_len, offset + chunk.size);
+
+	memcpy(&chunked_payload[offset], chunk.ptr, chunk.size);
+	chunked_payload_len += chunk.size;
+	chunked_payload_chunks++;
+
+	if (offset + chunk.size == payload_len) {
+		k_sem_give(&publish_sem);
+	}
+}
+
 static void cb_on_connack(enum mqtt_conn_return_code return_code, bool session_present)
 {
 	switch (return_code) {
@@ -231,6 +266,11 @@ static void cb_on_suback(uint16_t message_id, int result)
 	}
 }
 
+static void cb_on_publish_window_available(void)
+{
+	k_sem_give(&publish_window_sem);
+}
+
 static void cb_on_error(enum mqtt_helper_error error)
 {
 	if (error == MQTT_HELPER_ERROR_MSG_SIZE) {
@@ -631,6 +671,82 @@ void test_mqtt_helper_poll_loop_pollerr(void)
 	mqtt_helper_poll_loop();
 }
 
+void test_on_publish_chunked(void)
+{
+	struct mqtt_helper_cfg cfg = {
+		.cb = {
+			.on_publish = cb_on_publish,
+			.on_publish_chunk = cb_on_publish_chunk,
+		},
+	};
+
+	__cmock_mqtt_client_init_Expect(&mqtt_client);
+	TEST_ASSERT_EQUAL(0, mqtt_helper_init(&cfg));
+
+	chunked_payload_len = 0;
+	chunked_payload_chunks = 0;
+
+	__cmock_mqtt_read_publish_payload_blocking_Stub(mqtt_read_publish_payload_blocking_stub);
+	__cmock_mqtt_publish_qos1_ack_ExpectAnyArgsAndReturn(0);
+
+	send_mqtt_event(MQTT_EVT_PUBLISH, TEST_MESSAGE_ID);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&publish_sem, K_SECONDS(1)));
+	TEST_ASSERT_EQUAL(DIV_ROUND_UP(TEST_PAYLOAD_LEN, 5), chunked_payload_chunks);
+	TEST_ASSERT_EQUAL_MEMORY(TEST_PAYLOAD, chunked_payload, TEST_PAYLOAD_LEN);
+}
+
+void test_mqtt_helper_publish_window(void)
+{
+	struct mqtt_helper_cfg cfg = {
+		.cb = {
+			.on_puback = cb_on_puback,
+			.on_publish_window_available = cb_on_publish_window_available,
+		},
+	};
+	struct mqtt_publish_param pub_param = {
+		.message = {
+			.topic = {
+				.topic = {
+					.utf8 = TEST_TOPIC_1,
+					.size = TEST_TOPIC_1_LEN,
+				},
+				.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+			},
+		},
+	};
+
+	__cmock_mqtt_client_init_Expect(&mqtt_client);
+	TEST_ASSERT_EQUAL(0, mqtt_helper_init(&cfg));
+
+	mqtt_state = MQTT_STATE_CONNECTED;
+
+	/* Fill the window. */
+	__cmock_mqtt_publish_ExpectAnyArgsAndReturn(0);
+	pub_param.message_id = TEST_MESSAGE_ID;
+	TEST_ASSERT_EQUAL(0, mqtt_helper_publish(&pub_param));
+
+	__cmock_mqtt_publish_ExpectAnyArgsAndReturn(0);
+	pub_param.message_id = TEST_MESSAGE_ID + 1;
+	TEST_ASSERT_EQUAL(0, mqtt_helper_publish(&pub_param));
+
+	pub_param.message_id = TEST_MESSAGE_ID + 2;
+	TEST_ASSERT_EQUAL(-EAGAIN, mqtt_helper_publish(&pub_param));
+
+	/* QoS 0 messages are not limited by the window. */
+	__cmock_mqtt_publish_ExpectAnyArgsAndReturn(0);
+	pub_param.message.topic.qos = MQTT_QOS_0_AT_MOST_ONCE;
+	TEST_ASSERT_EQUAL(0, mqtt_helper_publish(&pub_param));
+
+	send_mqtt_event(MQTT_EVT_PUBACK, TEST_MESSAGE_ID);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&puback_sem, K_SECONDS(1)));
+	TEST_ASSERT_EQUAL(0, k_sem_take(&publish_window_sem, K_SECONDS(1)));
+
+	__cmock_mqtt_publish_ExpectAnyArgsAndReturn(0);
+	pub_param.message.topic.qos = MQTT_QOS_1_AT_LEAST_ONCE;
+	TEST_ASSERT_EQUAL(0, mqtt_helper_publish(&pub_param));
+}
+
 void test_mqtt_helper_msg_id_get_returns_valid_ids(void)
 {
 	for (int i = 1; i == UINT16_MAX; i++) {
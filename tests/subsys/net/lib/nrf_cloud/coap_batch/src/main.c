@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+#include <date_time.h>
+#include <net/nrf_cloud_coap.h>
+#include <cJSON.h>
+
+#define TEMP_MSG(_val) "{\"appId\":\"TEMP\",\"messageType\":\"DATA\",\"ts\":1000,\"data\":" _val "}"
+
+static char sent_msg[CONFIG_NRF_CLOUD_COAP_BATCH_BUF_SIZE];
+static int send_count;
+static int send_ret;
+static bool sent_bulk;
+static bool sent_confirmable;
+
+int nrf_cloud_coap_json_message_send(const char *message, bool bulk, bool confirmable)
+{
+	send_count++;
+	sent_bulk = bulk;
+	sent_confirmable = confirmable;
+	strncpy(sent_msg, message, sizeof(sent_msg) - 1);
+
+	return send_ret;
+}
+
+bool nrf_cloud_obj_bulk_check(struct nrf_cloud_obj *const obj)
+{
+	return cJSON_IsArray(obj->json);
+}
+
+int date_time_now(int64_t *unix_time_ms)
+{
+	*unix_time_ms = 5000;
+	return 0;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	send_ret = 0;
+	zassert_equal(nrf_cloud_coap_batch_flush(), 0);
+
+	send_count = 0;
+	memset(sent_msg, 0, sizeof(sent_msg));
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush)
+{
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 1, 1000), 0);
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 2.5, 1000), 0);
+	zassert_equal(nrf_cloud_coap_batch_count(), 2);
+	zassert_equal(send_count, 0);
+
+	zassert_equal(nrf_cloud_coap_batch_flush(), 0);
+	zassert_equal(send_count, 1);
+	zassert_true(sent_bulk);
+	zassert_true(sent_confirmable);
+	zassert_str_equal(sent_msg, "[" TEMP_MSG("1") "," TEMP_MSG("2.5") "]");
+	zassert_equal(nrf_cloud_coap_batch_count(), 0);
+
+	/* Nothing is sent for an empty batch */
+	zassert_equal(nrf_cloud_coap_batch_flush(), 0);
+	zassert_equal(send_count, 1);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush_on_size)
+{
+	/* The buffer holds two of these messages */
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 1, 1000), 0);
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 2, 1000), 0);
+	zassert_equal(send_count, 0);
+
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 3, 1000), 0);
+	zassert_equal(send_count, 1);
+	zassert_str_equal(sent_msg, "[" TEMP_MSG("1") "," TEMP_MSG("2") "]");
+	zassert_equal(nrf_cloud_coap_batch_count(), 1);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush_on_age)
+{
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 1, 1000), 0);
+
+	k_sleep(K_MSEC(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE * MSEC_PER_SEC + 500));
+
+	zassert_equal(send_count, 1);
+	zassert_str_equal(sent_msg, "[" TEMP_MSG("1") "]");
+	zassert_equal(nrf_cloud_coap_batch_count(), 0);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_send_error_keeps_messages)
+{
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 1, 1000), 0);
+
+	send_ret = -EACCES;
+	zassert_equal(nrf_cloud_coap_batch_flush(), -EACCES);
+	zassert_equal(nrf_cloud_coap_batch_count(), 1);
+
+	send_ret = 0;
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 2, 1000), 0);
+	zassert_equal(nrf_cloud_coap_batch_flush(), 0);
+	zassert_str_equal(sent_msg, "[" TEMP_MSG("1") "," TEMP_MSG("2") "]");
+}
+
+ZTEST(nrf_cloud_coap_batch, test_cloud_error_drops_messages)
+{
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 1, 1000), 0);
+
+	send_ret = COAP_RESPONSE_CODE_BAD_REQUEST;
+	zassert_equal(nrf_cloud_coap_batch_flush(), COAP_RESPONSE_CODE_BAD_REQUEST);
+	zassert_equal(nrf_cloud_coap_batch_count(), 0);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_timestamp)
+{
+	zassert_equal(nrf_cloud_coap_sensor_batch_add("TEMP", 1, NRF_CLOUD_NO_TIMESTAMP), 0);
+	zassert_equal(nrf_cloud_coap_batch_flush(), 0);
+	zassert_str_equal(sent_msg,
+			  "[{\"appId\":\"TEMP\",\"messageType\":\"DATA\",\"ts\":5000,\"data\":1}]");
+}
+
+ZTEST(nrf_cloud_coap_batch, test_obj)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+
+	obj.json = cJSON_CreateObject();
+	zassert_not_null(cJSON_AddStringToObject(obj.json, "appId", "MSG"));
+
+	zassert_equal(nrf_cloud_coap_obj_batch_add(&obj), 0);
+	cJSON_Delete(obj.json);
+
+	zassert_equal(nrf_cloud_coap_batch_flush(), 0);
+	zassert_str_equal(sent_msg, "[{\"appId\":\"MSG\"}]");
+
+	obj.json = cJSON_CreateArray();
+	zassert_equal(nrf_cloud_coap_obj_batch_add(&obj), -ENOTSUP);
+	cJSON_Delete(obj.json);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_too_big)
+{
+	char app_id[CONFIG_NRF_CLOUD_COAP_BATCH_BUF_SIZE];
+
+	memset(app_id, 'A', sizeof(app_id) - 1);
+	app_id[sizeof(app_id) - 1] = '\0';
+
+	zassert_equal(nrf_cloud_coap_sensor_batch_add(app_id, 1, 1000), -E2BIG);
+	zassert_equal(nrf_cloud_coap_batch_count(), 0);
+	zassert_equal(send_count, 0);
+}
+
+ZTEST_SUITE(nrf_cloud_coap_batch, NULL, NULL, before, NULL, NULL);
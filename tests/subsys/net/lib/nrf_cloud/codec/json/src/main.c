@@ -17,8 +17,8 @@
  *   better validated through hardware-in-the-loop and system-level
  *   integration tests.
  *
- * Coverage: JSON object lifecycle, adders, getters, bulk operations, and
- * cloud encoding.  CBOR coverage is intentionally deferred to a separate
+ * Coverage: JSON object lifecycle, adders, getters, bulk operations,
+ * cloud encoding, buffer encoding and JSON stream objects.  CBOR coverage is intentionally deferred to a separate
  * suite (codec/cbor/) which exercises the internal coap_codec.h layer.
  *
  * No mocks are used: cJSON is a pure heap-based library with no
@@ -30,6 +30,7 @@
 #include <zephyr/ztest.h>
 #include <net/nrf_cloud_codec.h>
 #include <net/nrf_cloud_defs.h>
+#include <nrf_cloud_codec_internal.h>
 #include <cJSON.h>
 #include <math.h>
 #include <stdint.h>
@@ -1002,3 +1003,258 @@ ZTEST(nrf_cloud_codec_encode, test_obj_cloud_encoded_free_not_encoded)
 	zassert_equal(nrf_cloud_obj_cloud_encoded_free(&obj), -EACCES);
 	nrf_cloud_obj_free(&obj);
 }
+
+/*
+ * SUITE: nrf_cloud_codec_buf_encode
+ * Tests for nrf_cloud_msg_json_buf_encode and nrf_cloud_obj_cloud_buf_encode.
+ */
+
+ZTEST_SUITE(nrf_cloud_codec_buf_encode, NULL, NULL, NULL, NULL, NULL);
+
+static char enc_buf[256];
+
+ZTEST(nrf_cloud_codec_buf_encode, test_msg_double)
+{
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = "TEMP", .type = NRF_CLOUD_DATA_TYPE_DOUBLE, .double_val = 21.5, .ts = 42
+	};
+	size_t len = sizeof(enc_buf);
+
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, enc_buf, &len), 0);
+	zassert_str_equal(enc_buf,
+			  "{\"appId\":\"TEMP\",\"messageType\":\"DATA\",\"ts\":42,\"data\":21.5}");
+	zassert_equal(len, strlen(enc_buf));
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_msg_int_no_ts)
+{
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = "RSRP", .type = NRF_CLOUD_DATA_TYPE_INT, .int_val = -97,
+		.ts = NRF_CLOUD_NO_TIMESTAMP
+	};
+	size_t len = sizeof(enc_buf);
+
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, enc_buf, &len), 0);
+	zassert_str_equal(enc_buf, "{\"appId\":\"RSRP\",\"messageType\":\"DATA\",\"data\":-97}");
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_msg_str_escaped)
+{
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = "MSG", .type = NRF_CLOUD_DATA_TYPE_STR, .str_val = "a\"b\\c\n\x01"
+	};
+	size_t len = sizeof(enc_buf);
+
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, enc_buf, &len), 0);
+	zassert_str_equal(enc_buf,
+			  "{\"appId\":\"MSG\",\"messageType\":\"DATA\",\"data\":\"a\\\"b\\\\c\\n\\u0001\"}");
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_msg_pvt)
+{
+	struct nrf_cloud_gnss_pvt pvt = {
+		.lat = 63.5, .lon = 10.25, .accuracy = 5, .has_alt = true, .alt = 120
+	};
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = "GNSS", .type = NRF_CLOUD_DATA_TYPE_PVT, .pvt = &pvt
+	};
+	size_t len = sizeof(enc_buf);
+	cJSON *root;
+	cJSON *data;
+
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, enc_buf, &len), 0);
+
+	root = cJSON_Parse(enc_buf);
+	zassert_not_null(root);
+	data = cJSON_GetObjectItem(root, NRF_CLOUD_JSON_DATA_KEY);
+	zassert_true(cJSON_IsObject(data));
+	zassert_equal(cJSON_GetNumberValue(cJSON_GetObjectItem(data, "lat")), 63.5);
+	zassert_equal(cJSON_GetNumberValue(cJSON_GetObjectItem(data, "lon")), 10.25);
+	zassert_equal(cJSON_GetNumberValue(cJSON_GetObjectItem(data, "alt")), 120);
+	zassert_is_null(cJSON_GetObjectItem(data, "spd"));
+	cJSON_Delete(root);
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_msg_size_query)
+{
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = "TEMP", .type = NRF_CLOUD_DATA_TYPE_DOUBLE, .double_val = 21.5
+	};
+	size_t required = 0;
+	size_t len;
+
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, NULL, &required), -E2BIG);
+
+	/* No room for the terminator */
+	len = required;
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, enc_buf, &len), -E2BIG);
+	zassert_equal(len, required);
+
+	len = required + 1;
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, enc_buf, &len), 0);
+	zassert_equal(len, required);
+	zassert_equal(strlen(enc_buf), required);
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_msg_invalid)
+{
+	struct nrf_cloud_obj_coap_cbor msg = { .app_id = "MSG", .type = NRF_CLOUD_DATA_TYPE_STR };
+	size_t len = sizeof(enc_buf);
+
+	zassert_equal(nrf_cloud_msg_json_buf_encode(&msg, enc_buf, &len), -EINVAL);
+	zassert_equal(nrf_cloud_msg_json_buf_encode(NULL, enc_buf, &len), -EINVAL);
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_obj_json)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	size_t len = sizeof(enc_buf);
+
+	zassert_equal(nrf_cloud_obj_init(&obj), 0);
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "val", 3, false), 0);
+	zassert_equal(nrf_cloud_obj_cloud_buf_encode(&obj, enc_buf, &len), 0);
+	zassert_str_equal(enc_buf, "{\"val\":3}");
+	zassert_equal(obj.enc_src, NRF_CLOUD_ENC_SRC_PRE_ENCODED);
+	zassert_equal(obj.encoded_data.ptr, enc_buf);
+	zassert_equal(obj.encoded_data.len, strlen(enc_buf));
+
+	/* The object now holds encoded data */
+	len = sizeof(enc_buf);
+	zassert_equal(nrf_cloud_obj_cloud_buf_encode(&obj, enc_buf, &len), -EACCES);
+	nrf_cloud_obj_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_obj_json_too_small)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	size_t len = 4;
+
+	zassert_equal(nrf_cloud_obj_init(&obj), 0);
+	zassert_equal(nrf_cloud_obj_str_add(&obj, "key", "value", false), 0);
+	zassert_equal(nrf_cloud_obj_cloud_buf_encode(&obj, enc_buf, &len), -E2BIG);
+	zassert_equal(obj.enc_src, NRF_CLOUD_ENC_SRC_NONE);
+	nrf_cloud_obj_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_buf_encode, test_obj_coap_cbor_as_json)
+{
+	/* Without CoAP, the message model of CBOR objects is encoded as JSON */
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = "TEMP", .type = NRF_CLOUD_DATA_TYPE_DOUBLE, .double_val = 21.5
+	};
+	NRF_CLOUD_OBJ_COAP_CBOR_DEFINE(obj);
+
+	obj.coap_cbor = &msg;
+
+	zassert_equal(nrf_cloud_obj_cloud_encode(&obj), 0);
+	zassert_str_equal(obj.encoded_data.ptr,
+			  "{\"appId\":\"TEMP\",\"messageType\":\"DATA\",\"data\":21.5}");
+	zassert_equal(nrf_cloud_obj_cloud_encoded_free(&obj), 0);
+}
+
+/*
+ * SUITE: nrf_cloud_codec_json_stream
+ * Tests for objects of type NRF_CLOUD_OBJ_TYPE_JSON_STREAM.
+ */
+
+ZTEST_SUITE(nrf_cloud_codec_json_stream, NULL, NULL, NULL, NULL, NULL);
+
+static char stream_buf[256];
+
+ZTEST(nrf_cloud_codec_json_stream, test_stream_msg)
+{
+	NRF_CLOUD_OBJ_JSON_STREAM_DEFINE(obj, stream_buf, sizeof(stream_buf));
+	const uint32_t bands[] = { 3, 20 };
+
+	zassert_equal(nrf_cloud_obj_msg_init(&obj, "DEVICE", NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA), 0);
+	zassert_equal(nrf_cloud_obj_ts_add(&obj, 1000), 0);
+	zassert_equal(nrf_cloud_obj_str_add(&obj, "fw", "1.0", true), 0);
+	zassert_equal(nrf_cloud_obj_object_begin(&obj, "net", true), 0);
+	zassert_equal(nrf_cloud_obj_int_array_add(&obj, "bands", bands, ARRAY_SIZE(bands), false),
+		      0);
+	zassert_equal(nrf_cloud_obj_bool_add(&obj, "roaming", false, false), 0);
+	zassert_equal(nrf_cloud_obj_object_end(&obj), 0);
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "rsrp", -97, true), 0);
+	zassert_equal(nrf_cloud_obj_null_add(&obj, "extra", false), 0);
+
+	zassert_equal(nrf_cloud_obj_cloud_encode(&obj), 0);
+	zassert_equal(obj.enc_src, NRF_CLOUD_ENC_SRC_CLOUD_ENCODED);
+	zassert_equal(obj.encoded_data.ptr, stream_buf);
+	zassert_str_equal(stream_buf,
+			  "{\"appId\":\"DEVICE\",\"messageType\":\"DATA\",\"ts\":1000,"
+			  "\"data\":{\"fw\":\"1.0\",\"net\":{\"bands\":[3,20],\"roaming\":false},"
+			  "\"rsrp\":-97},\"extra\":null}");
+	zassert_equal(obj.encoded_data.len, strlen(stream_buf));
+
+	zassert_equal(nrf_cloud_obj_cloud_encoded_free(&obj), 0);
+	zassert_is_null(obj.encoded_data.ptr);
+	zassert_equal(nrf_cloud_obj_free(&obj), 0);
+}
+
+ZTEST(nrf_cloud_codec_json_stream, test_stream_matches_json)
+{
+	NRF_CLOUD_OBJ_JSON_STREAM_DEFINE(stream_obj, stream_buf, sizeof(stream_buf));
+	NRF_CLOUD_OBJ_JSON_DEFINE(json_obj);
+	const char *const strs[] = { "a\"b", "c" };
+
+	zassert_equal(nrf_cloud_obj_init(&json_obj), 0);
+	zassert_equal(nrf_cloud_obj_init(&stream_obj), 0);
+
+	zassert_equal(nrf_cloud_obj_num_add(&json_obj, "pi", 3.14159, false), 0);
+	zassert_equal(nrf_cloud_obj_num_add(&stream_obj, "pi", 3.14159, false), 0);
+	zassert_equal(nrf_cloud_obj_str_array_add(&json_obj, "strs", strs, 2, false), 0);
+	zassert_equal(nrf_cloud_obj_str_array_add(&stream_obj, "strs", strs, 2, false), 0);
+
+	zassert_equal(nrf_cloud_obj_cloud_encode(&json_obj), 0);
+	zassert_equal(nrf_cloud_obj_cloud_encode(&stream_obj), 0);
+	zassert_str_equal(stream_obj.encoded_data.ptr, json_obj.encoded_data.ptr);
+
+	nrf_cloud_obj_cloud_encoded_free(&json_obj);
+	nrf_cloud_obj_free(&json_obj);
+	nrf_cloud_obj_free(&stream_obj);
+}
+
+ZTEST(nrf_cloud_codec_json_stream, test_stream_data_closed)
+{
+	NRF_CLOUD_OBJ_JSON_STREAM_DEFINE(obj, stream_buf, sizeof(stream_buf));
+
+	zassert_equal(nrf_cloud_obj_init(&obj), 0);
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "a", 1, true), 0);
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "b", 2, false), 0);
+
+	/* The "data" object was closed by adding to the root object */
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "c", 3, true), -EPERM);
+	zassert_equal(nrf_cloud_obj_object_end(&obj), -ENOENT);
+	nrf_cloud_obj_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_json_stream, test_stream_buffer_full)
+{
+	char buf[16];
+	NRF_CLOUD_OBJ_JSON_STREAM_DEFINE(obj, buf, sizeof(buf));
+
+	zassert_equal(nrf_cloud_obj_init(&obj), 0);
+	zassert_equal(nrf_cloud_obj_str_add(&obj, "k", "value", false), 0);
+	zassert_equal(nrf_cloud_obj_str_add(&obj, "k2", "value", false), -ENOMEM);
+	zassert_equal(nrf_cloud_obj_cloud_encode(&obj), -ENOMEM);
+	zassert_equal(obj.enc_src, NRF_CLOUD_ENC_SRC_NONE);
+	nrf_cloud_obj_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_json_stream, test_stream_init)
+{
+	NRF_CLOUD_OBJ_JSON_STREAM_DEFINE(obj, stream_buf, sizeof(stream_buf));
+	NRF_CLOUD_OBJ_JSON_DEFINE(json_obj);
+
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "a", 1, false), -ENOENT);
+	zassert_equal(nrf_cloud_obj_init(&obj), 0);
+	zassert_equal(nrf_cloud_obj_init(&obj), -ENOTEMPTY);
+	zassert_equal(nrf_cloud_obj_free(&obj), 0);
+	zassert_equal(nrf_cloud_obj_init(&obj), 0);
+	nrf_cloud_obj_free(&obj);
+
+	/* Nested objects are only supported by the stream type */
+	zassert_equal(nrf_cloud_obj_init(&json_obj), 0);
+	zassert_equal(nrf_cloud_obj_object_begin(&json_obj, "a", false), -ENOTSUP);
+	nrf_cloud_obj_free(&json_obj);
+}
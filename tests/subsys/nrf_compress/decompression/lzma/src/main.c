@@ -821,6 +821,54 @@ ZTEST(nrf_compress_decompression, test_data_decompression_output_too_large)
 	zassert_ok(rc, "Expected deinit to be successful");
 }
 
+ZTEST(nrf_compress_decompression, test_decompression_throughput)
+{
+	int rc;
+	uint32_t pos = 0;
+	uint32_t offset;
+	uint8_t *output;
+	uint32_t output_size;
+	uint32_t total_output_size = 0;
+	uint32_t start;
+	uint64_t time_us;
+	struct nrf_compress_implementation *implementation;
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	void *inst = &lzma_inst;
+#else
+	void *inst = NULL;
+#endif
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+
+	start = k_cycle_get_32();
+
+	rc = implementation->init(inst, dummy_data_large_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	while (pos < sizeof(dummy_data_large_input)) {
+		uint32_t len = MIN(implementation->decompress_bytes_needed(inst),
+				   sizeof(dummy_data_large_input) - pos);
+
+		rc = implementation->decompress(inst, &dummy_data_large_input[pos], len,
+						(pos + len) == sizeof(dummy_data_large_input),
+						&offset, &output, &output_size);
+		zassert_ok(rc, "Expected data decompress to be successful");
+
+		total_output_size += output_size;
+		pos += offset;
+	}
+
+	time_us = k_cyc_to_us_floor64(k_cycle_get_32() - start);
+
+	(void)implementation->deinit(inst);
+
+	zassert_equal(total_output_size, dummy_data_large_output_size,
+		      "Expected decompressed data size to match");
+
+	TC_PRINT("Decompressed %u bytes in %llu us (%llu kB/s)\n", total_output_size, time_us,
+		 time_us ? ((uint64_t)total_output_size * USEC_PER_MSEC / time_us) : 0);
+}
+
 static void cleanup_test(void *p)
 {
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) && !defined(CONFIG_SOC_POSIX)
@@ -988,6 +988,51 @@ static void test_aes_ctr_crypt_unwrapped_key(mbedtls_svc_key_id_t key_id)
 		      MBEDTLS_SVC_KEY_ID_GET_KEY_ID(unwrapped_key_id), err);
 }
 
+/**
+ * @brief Function to test that the usage policy of an unwrapped key is enforced
+ *
+ * @param key_id Wrapped key that must be unwrapped with encryption usage only
+ */
+static void test_aes_ctr_policy_unwrapped_key(mbedtls_svc_key_id_t key_id)
+{
+	psa_status_t err;
+	psa_key_attributes_t key_attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_cipher_operation_t operation = PSA_CIPHER_OPERATION_INIT;
+	mbedtls_svc_key_id_t unwrapped_key_id;
+
+	psa_set_key_usage_flags(&key_attributes, PSA_KEY_USAGE_ENCRYPT);
+	psa_set_key_algorithm(&key_attributes, PSA_ALG_CTR);
+	psa_set_key_type(&key_attributes, PSA_KEY_TYPE_AES);
+
+	err = psa_unwrap_key(&key_attributes, key_id, PSA_ALG_KW,
+			     aes_kw_wrapped_key, ARRAY_SIZE(aes_kw_wrapped_key),
+			     &unwrapped_key_id);
+	zassert_equal(err, PSA_SUCCESS, "Failed to unwrap key: encryption key slot_id: %d, err: %d",
+		      KMU_GET_SLOT_ID(key_id), err);
+
+	/* Run the setup twice to also check a cached key slot */
+	for (int i = 0; i < 2; i++) {
+		err = psa_cipher_encrypt_setup(&operation, unwrapped_key_id, PSA_ALG_CTR);
+		zassert_equal(err, PSA_SUCCESS,
+			      "Failed to setup AES CTR encryption: key_id: %d, err: %d",
+			      MBEDTLS_SVC_KEY_ID_GET_KEY_ID(unwrapped_key_id), err);
+
+		err = psa_cipher_abort(&operation);
+		zassert_equal(err, PSA_SUCCESS, "Failed to abort AES CTR encryption: err: %d",
+			      err);
+	}
+
+	err = psa_cipher_decrypt_setup(&operation, unwrapped_key_id, PSA_ALG_CTR);
+	zassert_equal(err, PSA_ERROR_NOT_PERMITTED,
+		      "AES CTR decryption not rejected: key_id: %d, err: %d",
+		      MBEDTLS_SVC_KEY_ID_GET_KEY_ID(unwrapped_key_id), err);
+
+	/* The key was cleared on the error, destroying it must still succeed */
+	err = psa_destroy_key(unwrapped_key_id);
+	zassert_equal(err, PSA_SUCCESS, "Failed to destroy unwrapped key: slot_id: %d, err: %d",
+		      MBEDTLS_SVC_KEY_ID_GET_KEY_ID(unwrapped_key_id), err);
+}
+
 static void derive_key_from_shared_secret(mbedtls_svc_key_id_t private_key_id,
 					  const psa_key_attributes_t *output_key_attr,
 					  mbedtls_svc_key_id_t *output_key)
@@ -1138,6 +1183,7 @@ static void test_crypt(void)
 	/* AES CTR using unwrapped 256-bits key */
 	if (IS_ENABLED_ALL(PSA_WANT_ALG_CTR, PSA_WANT_ALG_AES_KW)) {
 		test_aes_ctr_crypt_unwrapped_key(KMU_KEY_ID_AES_256_KW_ENC_KEY_READ_ONLY);
+		test_aes_ctr_policy_unwrapped_key(KMU_KEY_ID_AES_256_KW_ENC_KEY_READ_ONLY);
 
 		ran_encrypt = true;
 	}